@@ -1,7 +1,7 @@
 #ifndef THREAD__ASYNCHRONOUS_THREAD_THREAD_HPP
 #define THREAD__ASYNCHRONOUS_THREAD_THREAD_HPP
 
-#include "../../../LibraryMeta/LibraryMeta.hpp"
+#include "../../../Meta/Meta.hpp"
 #include "../../../Debugging/Logging/Log.hpp"
 
 namespace Library::Asynchronous
@@ -147,11 +147,19 @@ namespace Library::Asynchronous
     bool operator!=(const Thread& p_left, const Thread& p_right);
 
 
-    Thread* StartRoutineOnThreadWithStackUsingAllocator(
+    /**
+     * @brief Starts p_routine with p_data on a new thread.
+     * 
+     * @details The handle of the thread is allocated using p_allocate. If the
+     * thread can not be started the handle is given back using p_deallocate
+     * and null is returned.
+     * 
+     */
+    Thread* StartRoutineOnThreadWithStackUsingAllocatorAndDeallocator(
         void* (&p_routine) (void*),
         void* p_data,
         const Stack& p_stack,
-        void* (&p_allocate) (Size),
+        void* (&p_allocate) (Size), void (&p_deallocate) (void*),
         void (*p_alloc_error) (void*), void* p_alloc_error_data
     );
     inline Thread* StartRoutineOnThreadWithStack(
@@ -160,13 +168,13 @@ namespace Library::Asynchronous
         const Stack& p_stack
     )
     {
-        LogDebugLine("Using defaults for StartRoutineOnThreadWithStackUsingAllocator.");
-        return StartRoutineOnThreadWithStackUsingAllocator(
+        LogDebugLine("Using defaults for StartRoutineOnThreadWithStackUsingAllocatorAndDeallocator.");
+        return StartRoutineOnThreadWithStackUsingAllocatorAndDeallocator(
             p_routine, p_data,
             p_stack,
-            Library::LibraryMeta::g_DEFAULT_ALLOCATOR,
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR,
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR_DATA
+            Library::g_DEFAULT_ALLOCATOR, Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR,
+            Library::g_DEFAULT_ALLOC_ERROR_DATA
         );
     }
 
@@ -180,9 +188,9 @@ namespace Library::Asynchronous
         LogDebugLine("Using defaults for CopyThreadUsingAllocator.");
         return CopyThreadUsingAllocator(
             p_thread,
-            Library::LibraryMeta::g_DEFAULT_ALLOCATOR,     
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR,
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR_DATA            
+            Library::g_DEFAULT_ALLOCATOR,     
+            Library::g_DEFAULT_ALLOC_ERROR,
+            Library::g_DEFAULT_ALLOC_ERROR_DATA            
         );
     }
    
@@ -196,9 +204,9 @@ namespace Library::Asynchronous
     {
         LogDebugLine("Using defaults for GetThisThreadUsingAllocator.");
         return GetThisThreadUsingAllocator(
-            Library::LibraryMeta::g_DEFAULT_ALLOCATOR,           
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR,                
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR_DATA                    
+            Library::g_DEFAULT_ALLOCATOR,           
+            Library::g_DEFAULT_ALLOC_ERROR,                
+            Library::g_DEFAULT_ALLOC_ERROR_DATA                    
         );
     }
 
@@ -229,7 +237,7 @@ namespace Library::Asynchronous
     {
         LogDebugLine("Using defaults for DestroyThreadUsingDeallocator.");
         DestroyThreadUsingDeallocator(
-            p_thread, Library::LibraryMeta::g_DEFAULT_DEALLOCATOR
+            p_thread, Library::g_DEFAULT_DEALLOCATOR
         );
     }
 
@@ -238,6 +246,13 @@ namespace Library::Asynchronous
 
     void YieldFromThisThread();
 
+    /**
+     * @brief Returns the number of processors that threads can currently run
+     * on, at least 1.
+     * 
+     */
+    Size GetNumberOfProcessors();
+
 }
 
 
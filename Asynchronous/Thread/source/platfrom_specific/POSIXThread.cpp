@@ -1,4 +1,6 @@
 #include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
 
 #include "../../include/Thread.hpp"
 
@@ -13,6 +15,20 @@ namespace Library::Asynchronous
         Size m_References;
     };
 
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const Thread& p_thread)
+    {
+
+        p_log << (void*)&p_thread << " {";
+        p_log << " m_Finished = " << p_thread.m_Finished;
+        p_log << " m_ReturnValue = " << p_thread.m_ReturnValue;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif // DEBUG
+
 
     bool operator==(const Thread& p_left, const Thread& p_right)
     {
@@ -54,16 +70,17 @@ namespace Library::Asynchronous
     }
 
 
-    Thread* StartRoutineOnThreadWithStackUsingAllocator(
+    Thread* StartRoutineOnThreadWithStackUsingAllocatorAndDeallocator(
         void* (&p_routine) (void*),
         void* p_data,
-        const Stack& m_Stack,
-        void* (&p_allocate) (Size),
+        const Stack& p_stack,
+        void* (&p_allocate) (Size), void (&p_deallocate) (void*),
         void (*p_alloc_error) (void*), void* p_alloc_error_data
     )
     {
 
-        LogDebugLine("Starting a routine on another thread with stack " << m_Stack);
+        (void)p_stack; //Only the default stack is supported for now.
+        LogDebugLine("Starting a routine on another thread with stack " << p_stack);
 
         LogDebugLine("Setting up thread attributes.");
         pthread_attr_t l_attribute;
@@ -80,21 +97,6 @@ namespace Library::Asynchronous
             return nullptr;
         }
 
-        LogDebugLine("Creating thread.");
-        pthread_t l_thread;
-        //TODO: Change routine
-        if(pthread_create(&l_thread, &l_attribute, p_routine, p_data) != 0)
-        {
-            LogDebugLine("Could not create thread, returing null.");
-            pthread_attr_destroy(&l_attribute);
-            return nullptr;
-        }
-
-        pthread_attr_destroy(&l_attribute);
-        LogDebugLine("Successfully created thread.");
-
-        //TODO: Think of way to block thread until all allocation can be finished.
-
         LogDebugLine("Allocating thread handle.");
         Thread* l_returnValue = AllocateThreadUsingAllocator(
             p_allocate, p_alloc_error, p_alloc_error_data
@@ -102,12 +104,25 @@ namespace Library::Asynchronous
         if(l_returnValue == nullptr)
         {
             LogDebugLine("Allocation of thread handle failed, returing null.");
+            pthread_attr_destroy(&l_attribute);
             return nullptr;
         }
 
+        LogDebugLine("Creating thread.");
+        if(pthread_create(&l_returnValue->m_ThreadID, &l_attribute, p_routine, p_data) != 0)
+        {
+            LogDebugLine("Could not create thread, returing null.");
+            pthread_attr_destroy(&l_attribute);
+            p_deallocate(l_returnValue);
+            return nullptr;
+        }
+
+        pthread_attr_destroy(&l_attribute);
+        LogDebugLine("Successfully created thread.");
+
         l_returnValue->m_Finished = false;
         l_returnValue->m_ReturnValue = nullptr;
-        l_returnValue->m_ThreadID = l_thread;
+        l_returnValue->m_References = 1;
 
         return l_returnValue;
 
@@ -121,7 +136,31 @@ namespace Library::Asynchronous
     );
 
 
-    bool WaitForThreadToFinish(const Thread& p_thread);
+    bool WaitForThreadToFinish(const Thread& p_thread)
+    {
+
+        LogDebugLine("Waiting for thread " << p_thread << " to finish.");
+
+        if(p_thread.m_Finished)
+        {
+            LogDebugLine("The thread has already been waited for, returning true.");
+            return true;
+        }
+
+        //The handle is only a view of the thread to the caller, waiting fills
+        //in the result.
+        Thread& l_thread = const_cast<Thread&>(p_thread);
+        if(pthread_join(l_thread.m_ThreadID, &l_thread.m_ReturnValue) != 0)
+        {
+            LogDebugLine("Could not join thread, returning false.");
+            return false;
+        }
+
+        l_thread.m_Finished = true;
+        LogDebugLine("Thread finished with " << l_thread.m_ReturnValue);
+        return true;
+
+    }
     bool ThreadIsFinished(const Thread& p_thread)
     {
 
@@ -137,7 +176,7 @@ namespace Library::Asynchronous
         if(p_thread.m_Finished)
         {
             LogDebugLine("The thread has finished, returning what is in m_ReturnValue.");
-            return &p_thread.m_ReturnValue;
+            return p_thread.m_ReturnValue;
         }
         else
         {
@@ -148,14 +187,44 @@ namespace Library::Asynchronous
     }
 
 
-    void DestroyThreadUsingDeallocator(Thread& p_thread, void (&p_deallocate) (void*));
+    void DestroyThreadUsingDeallocator(Thread& p_thread, void (&p_deallocate) (void*))
+    {
 
+        LogDebugLine("Destroying thread " << p_thread);
+
+        if(!p_thread.m_Finished)
+        {
+            LogDebugLine("The thread was not waited for, detaching it.");
+            pthread_detach(p_thread.m_ThreadID);
+        }
 
-    void ExitFromThisThread(void* p_return_value);
+        p_deallocate(&p_thread);
+
+    }
+
+
+    void ExitFromThisThread(void* p_return_value)
+    {
+        pthread_exit(p_return_value);
+    }
 
     void YieldFromThisThread()
     {
-        pthread_yield();
+        sched_yield();
+    }
+
+    Size GetNumberOfProcessors()
+    {
+
+        long l_count = sysconf(_SC_NPROCESSORS_ONLN);
+        if(l_count < 1)
+        {
+            LogDebugLine("Could not get the number of processors, returning 1.");
+            return 1;
+        }
+
+        return (Size)l_count;
+
     }
 
 
@@ -1 +1 @@
-g++ -Wall -Wextra -pedantic -g -Og -std=c++17 -DDEBUG -o ThreadTests.test ../../../LibraryMeta/LibraryMeta.cpp ../../../Debugging/Logging/Log.cpp ../source/Thread.cpp *.cpp
\ No newline at end of file
+g++ -Wall -Wextra -pedantic -g -Og -std=c++17 -DDEBUG -o ThreadTests.test ../../../Meta/Meta.cpp ../../../IO/source/IO.cpp ../../../Debugging/Logging/Log.cpp ../source/Thread.cpp ../source/platfrom_specific/POSIXThread.cpp -pthread *.cpp
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../include/Thread.hpp"
+
+using namespace Library;
+using namespace Library::Asynchronous;
+
+static void* AddOne(void* p_data)
+{
+    int* l_number = (int*)p_data;
+    ++*l_number;
+    return l_number;
+}
+
+TEST_CASE("Starting and waiting for threads", "[Asynchronous][Thread]")
+{
+
+    int l_numbers[4] = {0, 10, 20, 30};
+    Thread* l_threads[4];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        l_threads[i] = StartRoutineOnThreadWithStack(AddOne, &l_numbers[i], Stack());
+        REQUIRE(l_threads[i] != nullptr);
+    }
+
+    for(int i = 0; i < 4; ++i)
+    {
+        CHECK(WaitForThreadToFinish(*l_threads[i]));
+        CHECK(ThreadIsFinished(*l_threads[i]));
+        CHECK(GetThreadRoutineReturnValue(*l_threads[i]) == &l_numbers[i]);
+        CHECK(l_numbers[i] == i * 10 + 1);
+
+        //Waiting again does nothing.
+        CHECK(WaitForThreadToFinish(*l_threads[i]));
+
+        DestroyThread(*l_threads[i]);
+    }
+
+    CHECK(GetNumberOfProcessors() >= 1);
+
+}
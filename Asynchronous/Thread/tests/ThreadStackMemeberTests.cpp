@@ -3,6 +3,7 @@
 
 #include "../include/Thread.hpp"
 
+using namespace Library;
 using namespace Library::Asynchronous;
 
 TEST_CASE("Default constructor", "[Asynchronous][Thread][Stack][Member]")
@@ -0,0 +1,126 @@
+#ifndef THREAD_POOL__ASYNCHRONOUS_THREAD_POOL_THREAD_POOL_HPP
+#define THREAD_POOL__ASYNCHRONOUS_THREAD_POOL_THREAD_POOL_HPP
+
+#include "../../../Meta/Meta.hpp"
+#include "../../../Debugging/Logging/Log.hpp"
+
+namespace Library::Asynchronous
+{
+
+    /**
+     * @brief An opaque structure that is used for handles to a thread pool.
+     *
+     * @details A thread pool is a set of threads that are started once and
+     * then wait for work, so that running something on many threads does not
+     * have to start and stop a thread each time.
+     *
+     */
+    struct ThreadPool;
+
+    /**
+     * @brief A routine that does task number p_task of some work, with the
+     * data given to @ref RunRoutineForEachTaskOnThreadPool.
+     *
+     */
+    using ThreadPoolRoutine = void (&) (void* p_data, Size p_task);
+
+
+    /**
+     * @brief Creates a thread pool with p_threadCount threads that wait for
+     * work.
+     *
+     * @details The pool, the handles of its threads and everything they
+     * share is allocated using p_allocate. If not a single thread can be
+     * started, everything allocated is given back using p_deallocate.
+     *
+     * @param p_threadCount The number of threads to start. Work given to the
+     * pool is also done by the thread that gives it, so a pool of p - 1
+     * threads keeps p processors busy. May be 0, then all work is done by the
+     * thread giving it.
+     * @param p_allocate The allocator to use.
+     * @param p_deallocate The deallocator matching p_allocate.
+     * @param p_alloc_error A callback to be called if allocation fails.
+     * @param p_alloc_error_data Data for the callback.
+     * @return The pool, or null if allocation failed or not a single thread
+     * could be started. If only some of the threads could be started the pool
+     * only has those.
+     *
+     */
+    ThreadPool* CreateThreadPoolOfThreadCountUsingAllocatorAndDeallocator(
+        Size p_threadCount,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    inline ThreadPool* CreateThreadPoolOfThreadCount(Size p_threadCount)
+    {
+        LogDebugLine("Using defaults for CreateThreadPoolOfThreadCountUsingAllocatorAndDeallocator.");
+        return CreateThreadPoolOfThreadCountUsingAllocatorAndDeallocator(
+            p_threadCount,
+            Library::g_DEFAULT_ALLOCATOR, Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR,
+            Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Returns a thread pool shared by the whole process, with a thread
+     * for each processor but one.
+     *
+     * @details The pool is created the first time this is called and never
+     * destroyed, so it must not be passed to
+     * @ref DestroyThreadPoolUsingDeallocator. Functions that take a pool use
+     * this one by default. If it can not be created a pool without threads is
+     * returned instead, which does all work on the thread giving it.
+     *
+     */
+    ThreadPool& GetDefaultThreadPool();
+
+    /**
+     * @brief Returns the number of threads of p_pool, not counting the
+     * thread that gives it work.
+     *
+     */
+    Size GetThreadCountOfThreadPool(const ThreadPool& p_pool);
+
+    /**
+     * @brief Calls p_routine with p_data and each task number from 0 to
+     * p_taskCount - 1, on the threads of p_pool and the calling thread, and
+     * returns once all calls have returned.
+     *
+     * @details Tasks are handed out one at a time to whichever thread is free,
+     * in increasing order, so tasks that take longer do not hold up the
+     * others. Calls from different threads are run one after another. Calls
+     * from a routine running on the pool do all of their tasks on the calling
+     * thread, so a routine can use the pool without waiting for itself.
+     *
+     * @param p_pool The pool to use.
+     * @param p_routine The routine to call, it must be safe to call from many
+     * threads at once.
+     * @param p_data Passed to each call of p_routine.
+     * @param p_taskCount The number of tasks.
+     *
+     */
+    void RunRoutineForEachTaskOnThreadPool(
+        ThreadPool& p_pool,
+        ThreadPoolRoutine p_routine, void* p_data,
+        Size p_taskCount
+    );
+
+    /**
+     * @brief Stops the threads of p_pool, waiting for them to finish, and
+     * deallocates the pool with p_deallocate.
+     *
+     * @details No work may be running on the pool.
+     *
+     */
+    void DestroyThreadPoolUsingDeallocator(ThreadPool& p_pool, Deallocator p_deallocate);
+    inline void DestroyThreadPool(ThreadPool& p_pool)
+    {
+        LogDebugLine("Using defaults for DestroyThreadPoolUsingDeallocator.");
+        DestroyThreadPoolUsingDeallocator(p_pool, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+}
+
+
+#endif // !THREAD_POOL__ASYNCHRONOUS_THREAD_POOL_THREAD_POOL_HPP
@@ -0,0 +1,295 @@
+#include <pthread.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <new>
+
+#include "../../include/ThreadPool.hpp"
+#include "../../../Thread/include/Thread.hpp"
+
+namespace Library::Asynchronous
+{
+
+    struct ThreadPool
+    {
+        pthread_mutex_t m_Mutex;
+        /**
+         * @brief Signaled when there is new work or the pool is stopping.
+         *
+         */
+        pthread_cond_t m_WorkGiven;
+        /**
+         * @brief Signaled when the last thread is done with the work.
+         *
+         */
+        pthread_cond_t m_WorkDone;
+        /**
+         * @brief Held while work is given and run, so work from different
+         * threads is run one after another.
+         *
+         */
+        pthread_mutex_t m_GivingMutex;
+
+        void (*m_Routine) (void*, Size);
+        void* m_Data;
+        Size m_TaskCount;
+        std::atomic<Size> m_NextTask;
+        /**
+         * @brief Increased each time work is given, so a thread can tell new
+         * work apart from work it already did.
+         *
+         */
+        Size m_Generation;
+        /**
+         * @brief The number of threads that are done with the current work.
+         * The next work is not given until all of them are, so none of them
+         * can mistake the next work's tasks for the current work's.
+         *
+         */
+        Size m_DoneCount;
+        bool m_IsStopping;
+
+        Size m_ThreadCount;
+        Thread** m_Threads;
+    };
+
+    namespace
+    {
+        //Set on the threads of any pool, work given from them is done right
+        //away instead of waiting for the pool.
+        thread_local bool g_IsThreadOfThreadPool = false;
+
+        pthread_mutex_t g_DefaultThreadPoolMutex = PTHREAD_MUTEX_INITIALIZER;
+        ThreadPool* g_DefaultThreadPool = nullptr;
+    }
+
+
+    static void DoTasksOfThreadPool(ThreadPool& p_pool)
+    {
+
+        Size l_task;
+        while((l_task = p_pool.m_NextTask.fetch_add(1, std::memory_order_relaxed)) < p_pool.m_TaskCount)
+        {
+            p_pool.m_Routine(p_pool.m_Data, l_task);
+        }
+
+    }
+
+    static void* RunThreadOfThreadPool(void* p_pool)
+    {
+
+        ThreadPool& l_pool = *(ThreadPool*)p_pool;
+        g_IsThreadOfThreadPool = true;
+
+        Size l_doneGeneration = 0;
+
+        pthread_mutex_lock(&l_pool.m_Mutex);
+        while(true)
+        {
+            while(!l_pool.m_IsStopping && l_pool.m_Generation == l_doneGeneration)
+            {
+                pthread_cond_wait(&l_pool.m_WorkGiven, &l_pool.m_Mutex);
+            }
+            if(l_pool.m_IsStopping)
+            {
+                break;
+            }
+            l_doneGeneration = l_pool.m_Generation;
+            pthread_mutex_unlock(&l_pool.m_Mutex);
+
+            DoTasksOfThreadPool(l_pool);
+
+            pthread_mutex_lock(&l_pool.m_Mutex);
+            ++l_pool.m_DoneCount;
+            if(l_pool.m_DoneCount == l_pool.m_ThreadCount)
+            {
+                pthread_cond_signal(&l_pool.m_WorkDone);
+            }
+        }
+        pthread_mutex_unlock(&l_pool.m_Mutex);
+
+        return nullptr;
+
+    }
+
+
+    ThreadPool* CreateThreadPoolOfThreadCountUsingAllocatorAndDeallocator(
+        Size p_threadCount,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating a thread pool of " << p_threadCount << " threads.");
+
+        if(p_threadCount > (SIZE_MAX - sizeof(ThreadPool)) / sizeof(Thread*))
+        {
+            LogDebugLine("Too many threads, returning null.");
+            return nullptr;
+        }
+
+        //The handles of the threads come right after the pool.
+        void* l_block = p_allocate(sizeof(ThreadPool) + sizeof(Thread*) * p_threadCount);
+        if(l_block == nullptr)
+        {
+            LogDebugLine("Allocation of the thread pool failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return nullptr;
+        }
+
+        ThreadPool* l_pool = new (l_block) ThreadPool;
+        pthread_mutex_init(&l_pool->m_Mutex, nullptr);
+        pthread_mutex_init(&l_pool->m_GivingMutex, nullptr);
+        pthread_cond_init(&l_pool->m_WorkGiven, nullptr);
+        pthread_cond_init(&l_pool->m_WorkDone, nullptr);
+        l_pool->m_Routine = nullptr;
+        l_pool->m_Data = nullptr;
+        l_pool->m_TaskCount = 0;
+        l_pool->m_NextTask.store(0, std::memory_order_relaxed);
+        l_pool->m_Generation = 0;
+        l_pool->m_DoneCount = 0;
+        l_pool->m_IsStopping = false;
+        l_pool->m_ThreadCount = 0;
+        l_pool->m_Threads = (Thread**)(l_pool + 1);
+
+        for(Size i = 0; i < p_threadCount; ++i)
+        {
+            Thread* l_thread = StartRoutineOnThreadWithStackUsingAllocatorAndDeallocator(
+                RunThreadOfThreadPool, l_pool, Stack(),
+                p_allocate, p_deallocate,
+                p_alloc_error, p_alloc_error_data
+            );
+            if(l_thread == nullptr)
+            {
+                LogDebugLine("Could not start thread " << i << ", the pool "
+                "only has " << l_pool->m_ThreadCount << " threads.");
+                break;
+            }
+            l_pool->m_Threads[l_pool->m_ThreadCount++] = l_thread;
+        }
+
+        if(p_threadCount > 0 && l_pool->m_ThreadCount == 0)
+        {
+            LogDebugLine("Not a single thread could be started, returning null.");
+            pthread_cond_destroy(&l_pool->m_WorkDone);
+            pthread_cond_destroy(&l_pool->m_WorkGiven);
+            pthread_mutex_destroy(&l_pool->m_GivingMutex);
+            pthread_mutex_destroy(&l_pool->m_Mutex);
+            l_pool->~ThreadPool();
+            p_deallocate(l_block);
+            return nullptr;
+        }
+
+        LogDebugLine("Created thread pool at " << (void*)l_pool);
+        return l_pool;
+
+    }
+
+    ThreadPool& GetDefaultThreadPool()
+    {
+
+        pthread_mutex_lock(&g_DefaultThreadPoolMutex);
+        if(g_DefaultThreadPool == nullptr)
+        {
+            LogDebugLine("Creating the default thread pool.");
+            g_DefaultThreadPool = CreateThreadPoolOfThreadCount(GetNumberOfProcessors() - 1);
+            if(g_DefaultThreadPool == nullptr)
+            {
+                //Work given to a pool without threads never touches anything
+                //else in it.
+                LogDebugLine("Could not create it, using a pool without threads.");
+                static ThreadPool l_poolWithoutThreads;
+                l_poolWithoutThreads.m_ThreadCount = 0;
+                g_DefaultThreadPool = &l_poolWithoutThreads;
+            }
+        }
+        ThreadPool& l_pool = *g_DefaultThreadPool;
+        pthread_mutex_unlock(&g_DefaultThreadPoolMutex);
+
+        return l_pool;
+
+    }
+
+    Size GetThreadCountOfThreadPool(const ThreadPool& p_pool)
+    {
+        return p_pool.m_ThreadCount;
+    }
+
+    void RunRoutineForEachTaskOnThreadPool(
+        ThreadPool& p_pool,
+        ThreadPoolRoutine p_routine, void* p_data,
+        Size p_taskCount
+    )
+    {
+
+        LogDebugLine("Running " << p_taskCount << " tasks on thread pool " << (void*)&p_pool);
+
+        if(g_IsThreadOfThreadPool || p_pool.m_ThreadCount == 0 || p_taskCount < 2)
+        {
+            LogDebugLine("Doing the tasks on this thread.");
+            for(Size i = 0; i < p_taskCount; ++i)
+            {
+                p_routine(p_data, i);
+            }
+            return;
+        }
+
+        pthread_mutex_lock(&p_pool.m_GivingMutex);
+
+        pthread_mutex_lock(&p_pool.m_Mutex);
+        p_pool.m_Routine = p_routine;
+        p_pool.m_Data = p_data;
+        p_pool.m_TaskCount = p_taskCount;
+        p_pool.m_NextTask.store(0, std::memory_order_relaxed);
+        p_pool.m_DoneCount = 0;
+        ++p_pool.m_Generation;
+        pthread_cond_broadcast(&p_pool.m_WorkGiven);
+        pthread_mutex_unlock(&p_pool.m_Mutex);
+
+        //Routines running on this thread can give work too.
+        g_IsThreadOfThreadPool = true;
+        DoTasksOfThreadPool(p_pool);
+        g_IsThreadOfThreadPool = false;
+
+        pthread_mutex_lock(&p_pool.m_Mutex);
+        while(p_pool.m_DoneCount != p_pool.m_ThreadCount)
+        {
+            pthread_cond_wait(&p_pool.m_WorkDone, &p_pool.m_Mutex);
+        }
+        pthread_mutex_unlock(&p_pool.m_Mutex);
+
+        pthread_mutex_unlock(&p_pool.m_GivingMutex);
+
+    }
+
+    void DestroyThreadPoolUsingDeallocator(ThreadPool& p_pool, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying thread pool " << (void*)&p_pool);
+
+        pthread_mutex_lock(&p_pool.m_Mutex);
+        p_pool.m_IsStopping = true;
+        pthread_cond_broadcast(&p_pool.m_WorkGiven);
+        pthread_mutex_unlock(&p_pool.m_Mutex);
+
+        for(Size i = 0; i < p_pool.m_ThreadCount; ++i)
+        {
+            WaitForThreadToFinish(*p_pool.m_Threads[i]);
+            DestroyThreadUsingDeallocator(*p_pool.m_Threads[i], p_deallocate);
+        }
+
+        pthread_cond_destroy(&p_pool.m_WorkDone);
+        pthread_cond_destroy(&p_pool.m_WorkGiven);
+        pthread_mutex_destroy(&p_pool.m_GivingMutex);
+        pthread_mutex_destroy(&p_pool.m_Mutex);
+        p_pool.~ThreadPool();
+
+        p_deallocate(&p_pool);
+
+    }
+
+}
@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -g -Og -std=c++17 -DDEBUG -o ThreadPoolTests.test ../../../Meta/Meta.cpp ../../../IO/source/IO.cpp ../../../Debugging/Debugging.cpp ../../../Debugging/Logging/Log.cpp ../../Thread/source/Thread.cpp ../../Thread/source/platfrom_specific/POSIXThread.cpp ../source/platfrom_specific/POSIXThreadPool.cpp -pthread *.cpp
\ No newline at end of file
@@ -0,0 +1,122 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <stdlib.h>
+
+#include "../include/ThreadPool.hpp"
+#include "../../Thread/include/Thread.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::Asynchronous;
+using namespace Debugging;
+
+struct Counters
+{
+    std::atomic<Size> m_Calls;
+    std::atomic<Size> m_TaskSum;
+    ThreadPool* m_Pool;
+};
+
+static void CountTask(void* p_counters, Size p_task)
+{
+    Counters& l_counters = *(Counters*)p_counters;
+    ++l_counters.m_Calls;
+    l_counters.m_TaskSum += p_task;
+}
+
+static Size g_FreeCount = 0;
+static void CountingFree(void* p_pointer)
+{
+    ++g_FreeCount;
+    free(p_pointer);
+}
+
+//Gives more work to the pool from inside of a task.
+static void CountTasksOfTasks(void* p_counters, Size)
+{
+    Counters& l_counters = *(Counters*)p_counters;
+    RunRoutineForEachTaskOnThreadPool(*l_counters.m_Pool, CountTask, p_counters, 10);
+}
+
+TEST_CASE("Running tasks on a thread pool", "[Asynchronous][ThreadPool]")
+{
+
+    Size l_threadCount = GENERATE((Size)0, (Size)1, (Size)3, (Size)8);
+
+    ThreadPool* l_pool = CreateThreadPoolOfThreadCount(l_threadCount);
+    REQUIRE(l_pool != nullptr);
+    REQUIRE(GetThreadCountOfThreadPool(*l_pool) == l_threadCount);
+
+    Counters l_counters;
+    l_counters.m_Pool = l_pool;
+
+    SECTION("Tasks are each run once")
+    {
+        //The same pool again and again.
+        for(Size l_taskCount = 0; l_taskCount < 200; l_taskCount += 7)
+        {
+            l_counters.m_Calls = 0;
+            l_counters.m_TaskSum = 0;
+            RunRoutineForEachTaskOnThreadPool(*l_pool, CountTask, &l_counters, l_taskCount);
+            REQUIRE(l_counters.m_Calls == l_taskCount);
+            REQUIRE(l_counters.m_TaskSum == l_taskCount * (l_taskCount - (l_taskCount > 0)) / 2);
+        }
+    }
+    SECTION("Tasks that give work to the pool")
+    {
+        l_counters.m_Calls = 0;
+        l_counters.m_TaskSum = 0;
+        RunRoutineForEachTaskOnThreadPool(*l_pool, CountTasksOfTasks, &l_counters, 20);
+        REQUIRE(l_counters.m_Calls == 200);
+        REQUIRE(l_counters.m_TaskSum == 20 * 45);
+    }
+
+    DestroyThreadPool(*l_pool);
+
+}
+
+TEST_CASE("Thread pool creation failure", "[Asynchronous][ThreadPool]")
+{
+
+    bool l_called = false;
+    SECTION("The pool can not be allocated")
+    {
+        g_FreeCount = 0;
+        ThreadPool* l_pool = CreateThreadPoolOfThreadCountUsingAllocatorAndDeallocator(
+            4, NullMalloc, CountingFree, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_pool == nullptr);
+        CHECK(l_called);
+        CHECK(g_FreeCount == 0);
+    }
+    SECTION("No thread handle can be allocated")
+    {
+        //Only the pool itself is allocated, and it is given back.
+        g_FreeCount = 0;
+        SetCountOfNullMallocAfterCount(1);
+        ThreadPool* l_pool = CreateThreadPoolOfThreadCountUsingAllocatorAndDeallocator(
+            4, NullMallocAfterCount, CountingFree, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_pool == nullptr);
+        CHECK(l_called);
+        CHECK(g_FreeCount == 1);
+    }
+
+}
+
+TEST_CASE("Default thread pool", "[Asynchronous][ThreadPool]")
+{
+
+    ThreadPool& l_pool = GetDefaultThreadPool();
+    CHECK(&l_pool == &GetDefaultThreadPool());
+    CHECK(GetThreadCountOfThreadPool(l_pool) == GetNumberOfProcessors() - 1);
+
+    Counters l_counters;
+    l_counters.m_Calls = 0;
+    l_counters.m_TaskSum = 0;
+    RunRoutineForEachTaskOnThreadPool(l_pool, CountTask, &l_counters, 100);
+    CHECK(l_counters.m_Calls == 100);
+
+}
@@ -10,6 +10,40 @@
 #include "../../Meta/Meta.hpp"
 #include "../../Debugging/Logging/Log.hpp"
 
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif //__SSE2__
+
+/** @def ARRAY_CHECK_INDEXES
+ *
+ * @brief When 1 the index operator of
+ * @ref Library::DataStructures::Array::Array "Array" aborts the process if it
+ * is given an index outside of the buffer, when 0 it does not check.
+ *
+ * @details Unless it is defined before this file is included it is 1 when the
+ * macro DEBUG is defined and 0 otherwise. Defining it lets indexes be checked
+ * in a release build, or not checked in a debug build.
+ *
+ * The check is only meant to catch bugs. Loops over many items should use
+ * @ref Library::DataStructures::Array::Array::begin "begin" and
+ * @ref Library::DataStructures::Array::Array::end "end", which are never
+ * checked, so the compiler is free to vectorize them whatever this is.
+ *
+ */
+#ifndef ARRAY_CHECK_INDEXES
+    #ifdef DEBUG
+        #define ARRAY_CHECK_INDEXES 1
+    #else
+        #define ARRAY_CHECK_INDEXES 0
+    #endif //DEBUG
+#endif //!ARRAY_CHECK_INDEXES
+
 /**
  * @brief A
  * 
@@ -17,6 +51,176 @@
 namespace Library::DataStructures::Array
 {
 
+    /**
+     * @brief True if items of type T are equal exactly when their bytes are,
+     * which holds for integers, enums and pointers.
+     *
+     * @details Such items are compared as bytes, with memcmp and SSE2,
+     * instead of one by one with operator!=. Floating point numbers are left
+     * out, since 0.0 == -0.0 and NaN != NaN, and so are classes, whose
+     * operator== may not look at every byte.
+     *
+     */
+    template<typename T>
+    constexpr bool g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE =
+        (std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value) &&
+        std::has_unique_object_representations<T>::value;
+
+    /**
+     * @brief Returns the index of the first byte that differs between
+     * p_left and p_right, or p_size if there is none.
+     *
+     * @details Compares 16 bytes at a time using SSE2 and 8 at a time
+     * otherwise.
+     *
+     */
+    inline Size FindIndexOfFirstMismatchOfBytes(
+        const Byte* p_left, const Byte* p_right,
+        const Size& p_size
+    )
+    {
+
+        Size i = 0;
+
+        #if defined(__SSE2__)
+        //64 bytes at a time until a block differs, then 16 at a time to find
+        //where.
+        for(; i + 64 <= p_size; i += 64)
+        {
+            __m128i l_equal = _mm_and_si128(
+                _mm_and_si128(
+                    _mm_cmpeq_epi8(
+                        _mm_loadu_si128((const __m128i*)(p_left + i)),
+                        _mm_loadu_si128((const __m128i*)(p_right + i))
+                    ),
+                    _mm_cmpeq_epi8(
+                        _mm_loadu_si128((const __m128i*)(p_left + i + 16)),
+                        _mm_loadu_si128((const __m128i*)(p_right + i + 16))
+                    )
+                ),
+                _mm_and_si128(
+                    _mm_cmpeq_epi8(
+                        _mm_loadu_si128((const __m128i*)(p_left + i + 32)),
+                        _mm_loadu_si128((const __m128i*)(p_right + i + 32))
+                    ),
+                    _mm_cmpeq_epi8(
+                        _mm_loadu_si128((const __m128i*)(p_left + i + 48)),
+                        _mm_loadu_si128((const __m128i*)(p_right + i + 48))
+                    )
+                )
+            );
+            if(_mm_movemask_epi8(l_equal) != 0xFFFF)
+            {
+                break;
+            }
+        }
+        for(; i + 16 <= p_size; i += 16)
+        {
+            unsigned l_mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128((const __m128i*)(p_left + i)),
+                _mm_loadu_si128((const __m128i*)(p_right + i))
+            ));
+            if(l_mask != 0xFFFF)
+            {
+                return i + __builtin_ctz(~l_mask);
+            }
+        }
+        #endif //__SSE2__
+
+        #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        for(; i + 8 <= p_size; i += 8)
+        {
+            uint64_t l_left;
+            uint64_t l_right;
+            memcpy(&l_left, p_left + i, 8);
+            memcpy(&l_right, p_right + i, 8);
+            if(l_left != l_right)
+            {
+                return i + __builtin_ctzll(l_left ^ l_right) / 8;
+            }
+        }
+        #endif //__ORDER_LITTLE_ENDIAN__
+
+        for(; i < p_size; ++i)
+        {
+            if(p_left[i] != p_right[i])
+            {
+                return i;
+            }
+        }
+
+        return p_size;
+
+    }
+
+    /**
+     * @brief Returns the index of the first item that differs between the
+     * first p_count items of p_left and of p_right, or p_count if there is
+     * none.
+     *
+     * @details Items that are
+     * @ref g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE "bitwise comparable" are
+     * compared as bytes with @ref FindIndexOfFirstMismatchOfBytes, others one
+     * by one with operator!=.
+     *
+     */
+    template<typename T>
+    Size FindIndexOfFirstMismatchOfItems(const T* p_left, const T* p_right, const Size& p_count)
+    {
+        if constexpr(g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE<T>)
+        {
+            if(p_left == p_right)
+            {
+                return p_count;
+            }
+            return FindIndexOfFirstMismatchOfBytes(
+                (const Byte*)p_left, (const Byte*)p_right, p_count * sizeof(T)
+            ) / sizeof(T);
+        }
+        else
+        {
+            for(Size i = 0; i < p_count; ++i)
+            {
+                if(p_left[i] != p_right[i])
+                {
+                    return i;
+                }
+            }
+            return p_count;
+        }
+    }
+    /**
+     * @brief Returns true if the first p_count items of p_left and of p_right
+     * are equal.
+     *
+     * @details Items that are
+     * @ref g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE "bitwise comparable" are
+     * compared with memcmp, which is vectorized by the C library, and are
+     * equal right away if p_left and p_right are the same. Others are
+     * compared one by one with operator!=.
+     *
+     */
+    template<typename T>
+    bool ItemsOfBuffersAreEqual(const T* p_left, const T* p_right, const Size& p_count)
+    {
+        if constexpr(g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE<T>)
+        {
+            return p_count == 0 || p_left == p_right ||
+                memcmp(p_left, p_right, p_count * sizeof(T)) == 0;
+        }
+        else
+        {
+            for(Size i = 0; i < p_count; ++i)
+            {
+                if(p_left[i] != p_right[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
     /**
      * @brief A data structure used for addressing a continuous block of items
      * of type T with a dynamic size and capacity. 
@@ -312,7 +516,8 @@ namespace Library::DataStructures::Array
          * @brief Returns m_Buffer[p_index].
          * 
          * @details If the given index is invalid or if this list is empty then
-         * the behaviour is undefined.
+         * the behaviour is undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in
+         * which case an index of m_Capacity or more aborts the process.
          * 
          * @param p_index The index to use, if it is invalid then the behaviour
          * is undefined.
@@ -324,23 +529,24 @@ namespace Library::DataStructures::Array
                 "Index operator called for array " << *this << " and with index "
                 << p_index
             );
-            #ifdef DEBUG
+            #if ARRAY_CHECK_INDEXES
             if(p_index >= m_Capacity)
             {
                 LogDebugLine("\n------\nError invalid index " << p_index
                 << " in array " << *this << ", aborting proccess... (Note: this"
-                " sort of check only occurs when DEBUG is defined, otherwise "
-                "the behaviour is undefined.\n------\n");
+                " sort of check only occurs when ARRAY_CHECK_INDEXES is 1, "
+                "otherwise the behaviour is undefined.\n------\n");
                 abort();
             }
-            #endif //DEBUG
+            #endif //ARRAY_CHECK_INDEXES
             return m_Buffer[p_index];
         }
         /**
          * @brief Returns m_Buffer[p_index], readonly version.
          * 
          * @details If the given index is invalid or if this list is empty then
-         * the behaviour is undefined.
+         * the behaviour is undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in
+         * which case an index of m_Capacity or more aborts the process.
          * 
          * @param p_index The index to use, if it is invalid then the behaviour
          * is undefined.
@@ -352,19 +558,60 @@ namespace Library::DataStructures::Array
                 "Index operator called for array " << *this << " and with index "
                 << p_index
             );
-            #ifdef DEBUG
+            #if ARRAY_CHECK_INDEXES
             if(p_index >= m_Capacity)
             {
                 LogDebugLine("\n------\nError invalid index " << p_index
                 << " in array " << *this << ", aborting proccess... (Note: this"
-                " sort of check only occurs when DEBUG is defined, otherwise "
-                "the behaviour is undefined.\n------\n");
+                " sort of check only occurs when ARRAY_CHECK_INDEXES is 1, "
+                "otherwise the behaviour is undefined.\n------\n");
                 abort();
             }
-            #endif //DEBUG
+            #endif //ARRAY_CHECK_INDEXES
             return m_Buffer[p_index];
         }
 
+        /**
+         * @brief Returns @ref m_Buffer, where the items start.
+         * 
+         * @details Together with @ref end this lets the items be looped over
+         * with a range based for loop, for(T& l_item : l_array). Neither is
+         * checked nor logged, so such a loop compiles the same as one over a
+         * plain pointer, unlike one using the index operator. For a
+         * @ref ArrayTypesNull "null array" both return null, so the loop does
+         * nothing.
+         * 
+         */
+        T* begin()
+        {
+            return m_Buffer;
+        }
+        /**
+         * @brief Returns @ref m_Buffer, readonly version.
+         * 
+         */
+        const T* begin() const
+        {
+            return m_Buffer;
+        }
+        /**
+         * @brief Returns @ref m_Buffer + @ref m_Size, right after the last
+         * item.
+         * 
+         */
+        T* end()
+        {
+            return m_Buffer + m_Size;
+        }
+        /**
+         * @brief Returns @ref m_Buffer + @ref m_Size, readonly version.
+         * 
+         */
+        const T* end() const
+        {
+            return m_Buffer + m_Size;
+        }
+
         /**
          * @brief Comapres the arrays.
          * 
@@ -374,6 +621,11 @@ namespace Library::DataStructures::Array
          * arrays are null. The capacity of the arrays is not compared. In any
          * other case false is returned.
          * 
+         * @details Arrays of different sizes are unequal without looking at
+         * their items. Items that are
+         * @ref g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE "bitwise comparable" are
+         * compared using @ref ItemsOfBuffersAreEqual.
+         * 
          * @time O(n)
          * 
          */
@@ -397,21 +649,10 @@ namespace Library::DataStructures::Array
                 return false;
             }
 
-            LogDebugLine("Starting to compare each array item.");
-            //Comapres each item with each other, if any items are not equal
-            //false is returned.
-            for(Size i = 0; i < m_Size; ++i)
-            {
-                if(m_Buffer[i] != p_other.m_Buffer[i])
-                {
-                    LogDebugLine("Found a missmatch at index " << i);
-                    return false;
-                }
-            }
-
-            LogDebugLine("Both of the arrays are equal so true is being returned.");
-            //If control reaches this point then the two arrays are the same.
-            return true;
+            LogDebugLine("Starting to compare the array items.");
+            //Integers, enums and pointers are compared as bytes, anything
+            //else item by item.
+            return ItemsOfBuffersAreEqual(m_Buffer, p_other.m_Buffer, m_Size);
 
         }
         /**
@@ -565,6 +806,129 @@ namespace Library::DataStructures::Array
         );
     }
 
+    /**
+     * @brief Creates an array at outp_array whose buffer is aligned to
+     * p_alignment.
+     *
+     * @details The same as @ref CreateArrayAtOfCapacityUsingAllocator, except
+     * that the buffer is allocated with p_allocate and its location is a
+     * multiple of p_alignment, or of alignof(T) if that is bigger. Use this
+     * for arrays that are walked with vector instructions, or that are
+     * written to by different threads and must not share cache lines.
+     *
+     * If p_alignment is not a power of two a @ref ArrayTypesNull "null array"
+     * is created at outp_array and the function returns, p_allocate is not
+     * called.
+     *
+     * The array must be resized with
+     * @ref ResizeArrayToCapacityAndAlignmentUsingReallocator and destroyed
+     * with the deallocator that goes with p_allocate.
+     *
+     * @param outp_array Where the new array will be created.
+     * @param p_capacity How many items max should the new array be abel to
+     * hold.
+     * @param p_alignment What the location of the buffer must be a multiple
+     * of.
+     * @param p_allocate The aligned allocator to use for the buffer.
+     * @param p_alloc_error A callback for allocation failure.
+     * @param p_alloc_error_data The argument that will be passed to
+     * p_alloc_error, if it is called.
+     *
+     * @sa CreateArrayAtOfCapacityUsingAllocator
+     *
+     */
+    template<typename T>
+    void CreateArrayAtOfCapacityAndAlignmentUsingAllocator(
+        Array<T>& outp_array,
+        const Size& p_capacity,
+        const Size& p_alignment,
+        AlignedAllocator p_allocate, Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine(
+            "Creating array at " << &outp_array << " with capacity " << p_capacity
+            << " aligned to " << p_alignment
+        );
+
+        if(p_capacity == 0)
+        {
+            LogDebugLine("The given capacity is 0, returning.");
+            return;
+        }
+
+        if(p_alignment == 0 || (p_alignment & (p_alignment - 1)) != 0)
+        {
+            LogDebugLine("The alignment is not a power of two, creating an "
+            "empty array and returning.");
+            outp_array = Array<T>();
+
+            return;
+        }
+
+        if(p_capacity > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine(
+                "Unsigned multiplication overflow detected during allocation of "
+                " array buffer at line " << __LINE__ << " and in file " << __FILE__
+                << "Creating an empty array and returning"
+            );
+            outp_array = Array<T>();
+
+            return;
+        }
+
+        outp_array.m_Buffer = (T*)p_allocate(
+            p_alignment < alignof(T) ? alignof(T) : p_alignment,
+            sizeof(T) * p_capacity
+        );
+        if(outp_array.m_Buffer == nullptr)
+        {
+            LogDebugLine(
+                "Allocation error occurred during allocation of array buffer. "
+                "Creating empty array."
+            );
+            outp_array = Array<T>();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+
+            LogDebugLine("Returning after unsuccessful allocation");
+            return;
+        }
+
+        LogDebugLine(
+            "Allocation successfully completed setting size to 0 and capacity to"
+            " the given value. The allocated buffer is " << (void*)outp_array.m_Buffer
+        );
+        outp_array.m_Size = 0;
+        outp_array.m_Capacity = p_capacity;
+
+    }
+    /**
+     * @brief Default aligned allocator, callback and data.
+     *
+     * @details The array must be destroyed with
+     * @ref Library::g_DEFAULT_ALIGNED_DEALLOCATOR.
+     *
+     */
+    template<typename T>
+    inline void CreateArrayAtOfCapacityAndAlignment(
+        Array<T>& outp_array,
+        const Size& p_capacity,
+        const Size& p_alignment
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayAtOfCapacityAndAlignmentUsingAllocator");
+        CreateArrayAtOfCapacityAndAlignmentUsingAllocator(
+            outp_array, p_capacity, p_alignment,
+            Library::g_DEFAULT_ALIGNED_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
     //TODO: Re-documentation mark, continue bellow.
     /**
      * @brief Create a copy of p_array at outp_buffer.
@@ -669,596 +1033,3123 @@ namespace Library::DataStructures::Array
 
 
     /**
-     * @brief Returns the index were the first occurrence of the first item and
-     * all following items in p_toFind can be found in p_array.
-     * 
-     * @details Loops through the entire array starting from index zero and
-     * ending at the p_array.m_Size. When the first item from p_toFind is located
-     * the function checks if the following items are the same as in p_toFind.
-     * If they are the same then the index of were the first item was found is
-     * returned.
-     * 
-     * Generally in every error case p_array.m_Size is returned. Such errors are:
-     * - Either p_toFind or p_array have a null buffer or a size of 0;
-     * - p_toFind cannot be found in p_array;
-     * - p_toFind.m_Size > p_array.m_Size;
-     * - There is a special case where the index could overflow (see source for
-     * more info).
-     * 
-     * 
-     * @time O(n * m), n being the number of items in p_array and m being the
-     * number of items in p_toFind.
-     * 
-     * @param p_toFind The array that will be searched for.
-     * @param p_array The array that will be searched in.
-     * @return The first occurrence of p_toFind in p_array, the index is where
-     * the first item of p_toFind can be found. In any other case p_array.m_Size
-     * is returned.
-     * 
+     * @brief True if items of type T are 1 byte integers or enums.
+     *
+     * @details Such items are equal exactly when their bytes are equal, so
+     * the search functions look for them as bytes, using memchr, SIMD and
+     * Horspool skip tables instead of comparing items one by one.
+     *
      */
     template<typename T>
-    Size FindIndexOfFirstOccurrenceOfArrayInArray(const Array<T>& p_toFind, const Array<T>& p_array)
-    {
-
-        LogDebugLine("Finding the first occurrence of array " << p_toFind 
-        << " in array " << p_array);
+    constexpr bool g_ARRAY_ITEMS_ARE_BYTES =
+        sizeof(T) == 1 && (std::is_integral<T>::value || std::is_enum<T>::value);
+    /**
+     * @brief Byte needles with at least this many items are searched for using
+     * Horspool skip tables, shorter ones using the first and last byte filter.
+     *
+     * @details The filter looks at 16 positions at a time no matter how long
+     * the needle is, while a Horspool skip is close to the needle's length
+     * on most inputs, so long needles skip faster than the filter can scan.
+     *
+     */
+    constexpr Size g_ARRAY_SEARCH_HORSPOOL_THRESHOLD = 64;
+    /**
+     * @brief The longest needle of items that are not bytes for which the
+     * search functions that do not take an @ref ArrayNeedle build a prefix
+     * table on the stack.
+     *
+     * @details Longer needles are searched for by backtracking, which is
+     * O(n * m) in the worst case. Create an @ref ArrayNeedle for them to
+     * always get O(n + m).
+     *
+     */
+    constexpr Size g_ARRAY_SEARCH_STACK_TABLE_SIZE = 256;
 
-        if(ArrayIsEmpty(p_toFind))
+    /**
+     * @brief Fills the Horspool skip table of p_needle, used for searching
+     * from the start of a haystack.
+     *
+     * @details outp_table[b] is how far a window can move forward when its last
+     * byte is b and it did not match. p_size must be at least 1 and
+     * outp_table must have room for 256 items.
+     *
+     */
+    inline void FillHorspoolTableOfBytes(
+        const Byte* p_needle, const Size& p_size,
+        Size* outp_table
+    )
+    {
+        for(Size i = 0; i < 256; ++i)
         {
-            LogDebugLine("The array being searched for is empty, returning the size.");
-            return p_array.m_Size;
+            outp_table[i] = p_size;
         }
-        if(ArrayIsEmpty(p_array))
+        for(Size i = 0; i + 1 < p_size; ++i)
         {
-            LogDebugLine("The array being searched in is empty, returning the size.");
-            return p_array.m_Size;
+            outp_table[p_needle[i]] = p_size - 1 - i;
         }
-        if(p_toFind.m_Size > p_array.m_Size)
+    }
+    /**
+     * @brief The same as @ref FillHorspoolTableOfBytes, but for searching from
+     * the end of a haystack, the skip is chosen by the first byte of a window.
+     *
+     */
+    inline void FillReverseHorspoolTableOfBytes(
+        const Byte* p_needle, const Size& p_size,
+        Size* outp_table
+    )
+    {
+        for(Size i = 0; i < 256; ++i)
         {
-            LogDebugLine("The array that is being searched for has a bigger"
-            " size than the array that is being searched in.");
-            return p_array.m_Size;
+            outp_table[i] = p_size;
         }
-
-        //Optimized loop for this special case.
-        if(p_toFind.m_Size == p_array.m_Size)
+        for(Size i = p_size - 1; i > 0; --i)
         {
-            LogDebugLine("The array that is being searched for has a equal"
-            " size to the array that is being searched in, using optimized loop.");
-            for(Size i = 0; i < p_array.m_Size; ++i)
-            {
-                if(p_array[i] != p_toFind[i])
-                {
-                    LogDebugLine("A missmatch was found on index " << i);
-                    return p_array.m_Size;
-                }
-            }
-
-            LogDebugLine("No missmatches found returning 0.");
-            return 0;
-        }
-
-        for(Size i = 0, n = 0; i < p_array.m_Size; ++i)
-        {
-            if(p_array[i] == p_toFind[n])
-            {
-                LogDebugLine("Found match of item at index " << n << " in array"
-                " being searched for with index at index " << i << " in array "
-                "being searched in.");
-                ++n;
-                if(n >= p_toFind.m_Size)
-                {
-                    LogDebugLine("Reached end of array being searched for, "
-                    "returning index " << i - (n - 1));
-                    return i - (n - 1);
-                }
-            }
-            else
-            {
-                n = 0;
-            }
+            outp_table[p_needle[i]] = i;
         }
-
-        LogDebugLine("Did not find the array, returning the size.");
-        return p_array.m_Size;
-
     }
+
     /**
-     * @brief Returns the index were the last occurrence of the first item and
-     * all following items in p_toFind can be found in p_array.
-     * 
-     * @details Loops through the entire array starting from p_array.m_Size - 1
-     * and ending at 0. When the first item from p_toFind is located
-     * the function checks if the following items are the same as in p_toFind.
-     * If they are the same then the index of were the first item was found is
-     * returned.
-     * 
-     * Generally in every error case p_array.m_Size is returned. Such errors are:
-     * - Either p_toFind or p_array have a null buffer or a size of 0;
-     * - p_toFind cannot be found in p_array;
-     * - p_toFind.m_Size > p_array.m_Size;
-     * - There is a special case where the index could overflow (see source for
-     * more info).
-     * 
-     * 
-     * @time O(n * m), n being the number of items in p_array and m being the
-     * number of items in p_toFind.
-     * 
-     * @param p_toFind The array that will be searched for.
-     * @param p_array The array that will be searched in.
-     * @return The last occurrence of p_toFind in p_array, the index is where
-     * the first item of p_toFind can be found. In any other case p_array.m_Size
-     * is returned.
-     * 
+     * @brief Returns the index of the first occurrence of p_needle in
+     * p_haystack, or p_haystack_size if there is none.
+     *
+     * @details Needles of 1 byte use memchr. Needles shorter than
+     * @ref g_ARRAY_SEARCH_HORSPOOL_THRESHOLD, or any needle if p_table is
+     * null, go through a filter that compares the first and last byte of
+     * 16 windows at once using SSE2, only the windows whose both ends match are
+     * compared fully. Longer needles use p_table, filled by
+     * @ref FillHorspoolTableOfBytes.
+     *
+     * @warning p_needle_size must be at least 1 and at most p_haystack_size.
+     *
      */
-    template<typename T>
-    Size FindIndexOfLastOccurrenceOfArrayInArray(const Array<T>& p_toFind, const Array<T>& p_array)
+    inline Size FindIndexOfFirstOccurrenceOfBytesInBytes(
+        const Byte* p_needle, const Size& p_needle_size,
+        const Size* p_table,
+        const Byte* p_haystack, const Size& p_haystack_size
+    )
     {
 
-        LogDebugLine("Finding the last occurrence of array " << p_toFind 
-        << " in array " << p_array);
+        const Size l_last = p_needle_size - 1;
 
-        if(ArrayIsEmpty(p_toFind))
-        {
-            LogDebugLine("The array being searched for is empty, returning the size.");
-            return p_array.m_Size;
-        }
-        if(ArrayIsEmpty(p_array))
-        {
-            LogDebugLine("The array being searched in is empty, returning the size.");
-            return p_array.m_Size;
-        }
-        if(p_toFind.m_Size > p_array.m_Size)
+        if(p_needle_size == 1)
         {
-            LogDebugLine("The array that is being searched for has a bigger"
-            " size than the array that is being searched in.");
-            return p_array.m_Size;
+            const Byte* l_found = (const Byte*)memchr(p_haystack, p_needle[0], p_haystack_size);
+            return l_found == nullptr ? p_haystack_size : (Size)(l_found - p_haystack);
         }
 
-        //Optimized loop for this special case.
-        if(p_toFind.m_Size == p_array.m_Size)
+        if(p_table != nullptr && p_needle_size >= g_ARRAY_SEARCH_HORSPOOL_THRESHOLD)
         {
-            LogDebugLine("The array that is being searched for has a equal"
-            " size to the array that is being searched in, using optimized loop.");
-            for(Size i = 0; i < p_array.m_Size; ++i)
+            for(Size i = 0; i <= p_haystack_size - p_needle_size;)
             {
-                if(p_array[i] != p_toFind[i])
+                Byte l_byte = p_haystack[i + l_last];
+                if(
+                    l_byte == p_needle[l_last] &&
+                    memcmp(p_haystack + i, p_needle, l_last) == 0
+                )
                 {
-                    LogDebugLine("A missmatch was found on index " << i);
-                    return p_array.m_Size;
+                    return i;
                 }
+                i += p_table[l_byte];
             }
 
-            LogDebugLine("No missmatches found returning 0.");
-            return 0;
+            return p_haystack_size;
         }
 
-        for(Size i = p_array.m_Size, n = p_toFind.m_Size - 1; i-- > 0;)
+        //The number of places p_needle could start at.
+        const Size l_starts = p_haystack_size - p_needle_size + 1;
+        Size i = 0;
+
+        #if defined(__SSE2__)
+        const __m128i l_first = _mm_set1_epi8((char)p_needle[0]);
+        const __m128i l_lastByte = _mm_set1_epi8((char)p_needle[l_last]);
+        for(; i + 16 <= l_starts; i += 16)
         {
-            if(p_array[i] == p_toFind[n])
+            __m128i l_starting = _mm_loadu_si128((const __m128i*)(p_haystack + i));
+            __m128i l_ending = _mm_loadu_si128((const __m128i*)(p_haystack + i + l_last));
+            unsigned l_mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(l_starting, l_first),
+                _mm_cmpeq_epi8(l_ending, l_lastByte)
+            ));
+
+            while(l_mask != 0)
             {
-                LogDebugLine("Found match of item at index " << n << " in array"
-                " being searched for with index at index " << i << " in array "
-                "being searched in.");
-                if(n-- == 0)
+                Size l_start = i + __builtin_ctz(l_mask);
+                if(memcmp(p_haystack + l_start + 1, p_needle + 1, l_last - 1) == 0)
                 {
-                    LogDebugLine("Reached end of array being searched for, "
-                    "returning index " << i);
-                    return i;
+                    return l_start;
                 }
+                l_mask &= l_mask - 1;
             }
-            else
+        }
+        #endif //__SSE2__
+
+        for(; i < l_starts; ++i)
+        {
+            if(
+                p_haystack[i] == p_needle[0] &&
+                p_haystack[i + l_last] == p_needle[l_last] &&
+                memcmp(p_haystack + i + 1, p_needle + 1, l_last - 1) == 0
+            )
             {
-                n = p_toFind.m_Size - 1;
+                return i;
             }
         }
 
-        LogDebugLine("Did not find the array, returning the size.");
-        return p_array.m_Size;
+        return p_haystack_size;
 
     }
-
     /**
-     * @brief Finds the number of instances of p_toFind in p_array.
-     * 
-     * @details Loops from index 0 to p_array.m_Size and each time the first
-     * item of p_toFind is found the function checks if all of the following
-     * items are the same as in p_toFind. If that is true then the result is
-     * incremented. This continues until the end of p_array is reached.
-     * 
-     * If either p_array or p_toFind have an empty buffer or a size of 0, 0 is
-     * returned.\n
-     * If p_toFind.m_Size > p_array.m_Size, 0 is returned.
-     * 
-     * @time O(n), n being the number of items in the given array.
-     * 
-     * @param p_toFind The array that will be searched for.
-     * @param p_array The array that will be searched in.
-     * @return The number of instances of p_toFind in p_array.
+     * @brief The same as @ref FindIndexOfFirstOccurrenceOfBytesInBytes but
+     * returns the last occurrence, p_table is filled by
+     * @ref FillReverseHorspoolTableOfBytes.
+     *
      */
-    template<typename T>
-    Size FindNumberOfInstanceOfArrayInArray(const Array<T>& p_toFind, const Array<T>& p_array)
+    inline Size FindIndexOfLastOccurrenceOfBytesInBytes(
+        const Byte* p_needle, const Size& p_needle_size,
+        const Size* p_table,
+        const Byte* p_haystack, const Size& p_haystack_size
+    )
     {
 
-        LogDebugLine("Finding the number of occurrences of array " << p_toFind 
-        << " in array " << p_array);
+        const Size l_last = p_needle_size - 1;
 
-        if(ArrayIsEmpty(p_toFind))
-        {
-            LogDebugLine("The array being searched for is empty, returning the size.");
-            return 0;
-        }
-        if(ArrayIsEmpty(p_array))
-        {
-            LogDebugLine("The array being searched in is empty, returning the size.");
-            return 0;
-        }
-        if(p_toFind.m_Size > p_array.m_Size)
+        if(p_needle_size == 1)
         {
-            LogDebugLine("The array that is being searched for has a bigger"
-            " size than the array that is being searched in.");
-            return 0;
+            for(Size i = p_haystack_size; i-- > 0;)
+            {
+                if(p_haystack[i] == p_needle[0])
+                {
+                    return i;
+                }
+            }
+            return p_haystack_size;
         }
 
-        //Optimized loop for this special case.
-        if(p_toFind.m_Size == p_array.m_Size)
+        if(p_table != nullptr && p_needle_size >= g_ARRAY_SEARCH_HORSPOOL_THRESHOLD)
         {
-            LogDebugLine("The array that is being searched for has a equal"
-            " size to the array that is being searched in, using optimized loop.");
-            for(Size i = 0; i < p_array.m_Size; ++i)
+            for(Size i = p_haystack_size - p_needle_size;;)
             {
-                if(p_array[i] != p_toFind[i])
+                Byte l_byte = p_haystack[i];
+                if(
+                    l_byte == p_needle[0] &&
+                    memcmp(p_haystack + i + 1, p_needle + 1, l_last) == 0
+                )
+                {
+                    return i;
+                }
+                if(p_table[l_byte] > i)
                 {
-                    LogDebugLine("A missmatch was found on index " << i);
-                    return 0;
+                    return p_haystack_size;
                 }
+                i -= p_table[l_byte];
             }
-
-            LogDebugLine("No missmatches found returning 1.");
-            return 1;
         }
 
-        Size l_returnValue = 0;
+        //Windows are checked from the last start backwards, l_starts is the
+        //number of starts that have not been checked.
+        Size l_starts = p_haystack_size - p_needle_size + 1;
 
-        for(Size i = 0, n = 0; i < p_array.m_Size; ++i)
+        #if defined(__SSE2__)
+        const __m128i l_first = _mm_set1_epi8((char)p_needle[0]);
+        const __m128i l_lastByte = _mm_set1_epi8((char)p_needle[l_last]);
+        while(l_starts >= 16)
         {
-            if(p_array[i] == p_toFind[n])
+            l_starts -= 16;
+
+            __m128i l_starting = _mm_loadu_si128((const __m128i*)(p_haystack + l_starts));
+            __m128i l_ending = _mm_loadu_si128((const __m128i*)(p_haystack + l_starts + l_last));
+            unsigned l_mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(l_starting, l_first),
+                _mm_cmpeq_epi8(l_ending, l_lastByte)
+            ));
+
+            while(l_mask != 0)
             {
-                LogDebugLine("Found match of item at index " << n << " in array"
-                " being searched for with index at index " << i << " in array "
-                "being searched in.");
-                ++n;
-                if(n >= p_toFind.m_Size)
+                unsigned l_bit = 31 - __builtin_clz(l_mask);
+                Size l_start = l_starts + l_bit;
+                if(memcmp(p_haystack + l_start + 1, p_needle + 1, l_last - 1) == 0)
                 {
-                    LogDebugLine("Found instance of array being searched for");
-                    ++l_returnValue;
-                    n = 0;
+                    return l_start;
                 }
+                l_mask &= ~(1u << l_bit);
             }
-            else
+        }
+        #endif //__SSE2__
+
+        while(l_starts-- > 0)
+        {
+            if(
+                p_haystack[l_starts] == p_needle[0] &&
+                p_haystack[l_starts + l_last] == p_needle[l_last] &&
+                memcmp(p_haystack + l_starts + 1, p_needle + 1, l_last - 1) == 0
+            )
             {
-                n = 0;
+                return l_starts;
             }
         }
 
-        LogDebugLine("Returning the return value.");
-        return l_returnValue;
+        return p_haystack_size;
 
     }
-
     /**
-     * @brief Checks if p_array is empty
-     * 
-     * @details Checks if p_array.m_Buffer is null and if p_array.m_Size is null,
-     * if any of these are true, then true is returned, false otherwise.
-     * 
-     * @param p_array Is this array empty?
-     * @return True if either the array has a null buffer or a size of 0.
+     * @brief Returns the number of occurrences of p_needle in p_haystack that
+     * do not overlap, p_table is the same as for
+     * @ref FindIndexOfFirstOccurrenceOfBytesInBytes.
+     *
      */
-    template<typename T>
-    bool ArrayIsEmpty(const Array<T>& p_array)
+    inline Size FindNumberOfInstanceOfBytesInBytes(
+        const Byte* p_needle, const Size& p_needle_size,
+        const Size* p_table,
+        const Byte* p_haystack, const Size& p_haystack_size
+    )
     {
-        LogDebugLine("Checking if array " << p_array << " is empty.");
-        return p_array.m_Buffer == nullptr || p_array.m_Size == 0;
+
+        Size l_result = 0;
+
+        for(Size i = 0; p_haystack_size - i >= p_needle_size;)
+        {
+            Size l_index = FindIndexOfFirstOccurrenceOfBytesInBytes(
+                p_needle, p_needle_size, p_table,
+                p_haystack + i, p_haystack_size - i
+            );
+            if(l_index == p_haystack_size - i)
+            {
+                break;
+            }
+
+            ++l_result;
+            i += l_index + p_needle_size;
+        }
+
+        return l_result;
+
     }
 
     /**
-     * @brief Checks if p_array has p_toFind.
-     * 
-     * @details Loops through p_array and checks if any item matches the first
-     * item of p_toFind, if this is true and all following items are the same as
-     * in p_toFind, true is returned, otherwise the loop continues until the end
-     * of p_array is reached at which point if no match was found false is 
-     * returned.\n
-     * If p_array or p_toFind are empty or have a size of 0, false is returned.\n
-     * If p_toFind.m_Size > p_array.m_Size, false is returned.
-     * 
-     * @time O(n * m), n being the number of items in p_array and m being the
-     * number of items in p_toFind.
-     * 
-     * @param p_array The array that will be searched in. 
-     * @param p_toFind The array that will be searched for.
-     * 
-     * @return True if p_item can be found in p_array, false otherwise.
-     * 
+     * @brief Fills the prefix table of p_needle, used for searching from the
+     * start of a haystack.
+     *
+     * @details outp_table[i] is the length of the longest proper prefix of
+     * the first i + 1 items of p_needle that they also end with. After the
+     * first i + 1 items matched and the next one did not, the search can
+     * continue as if only outp_table[i] items matched, so no item of the
+     * haystack is looked at twice (Knuth-Morris-Pratt). Only == and != are used
+     * on the items.
+     *
+     * @warning p_size must be at least 1 and outp_table must have room for
+     * p_size items.
+     *
+     * @time O(n), n being p_size.
+     *
      */
     template<typename T>
-    bool ArrayContainsArray (const Array<T>& p_array, const Array<T>& p_toFind)
+    void FillPrefixTableOfItems(const T* p_needle, const Size& p_size, Size* outp_table)
     {
-        LogDebugLine("Checking if array " << p_array << " contains the array " << p_toFind);
-        //Again code reuse!!1!11!!!!1!
-        return FindIndexOfFirstOccurrenceOfArrayInArray(p_toFind, p_array) < p_array.m_Size;
+        outp_table[0] = 0;
+        for(Size i = 1, l_matched = 0; i < p_size; ++i)
+        {
+            while(l_matched > 0 && p_needle[i] != p_needle[l_matched])
+            {
+                l_matched = outp_table[l_matched - 1];
+            }
+            if(p_needle[i] == p_needle[l_matched])
+            {
+                ++l_matched;
+            }
+            outp_table[i] = l_matched;
+        }
     }
-
     /**
-     * @brief Checks if p_array starts with p_start.
-     * 
-     * @details Loops through index 0 to p_start.m_Size and checks if on each
-     * index the two array's items match. If any missmatch is found false is 
-     * returned. If the loop is completed successfully true is returned.\n
-     * False is also returned if either p_array ot p_start have a null buffer or
-     * size of zero.\n
-     * If p_start.m_Size > p_array.m_Size false is returned.
-     * 
-     * @time O(n), n being the number of items in p_start.
-     * 
-     * @param p_array The array to check in.
-     * @param p_start The array to check for.
-     * @return True if p_array starts with p_start, false if either of them are
-     * empty or p_array does not start with p_start.
-     * 
+     * @brief The same as @ref FillPrefixTableOfItems but for p_needle read
+     * backwards, used for searching from the end of a haystack.
+     *
      */
     template<typename T>
-    bool ArrayStartsWithArray(const Array<T>& p_array, const Array<T>& p_start)
+    void FillSuffixTableOfItems(const T* p_needle, const Size& p_size, Size* outp_table)
     {
+        const Size l_last = p_size - 1;
 
-        LogDebugLine("Checking if array " << p_array << " starts with " <<
-        p_start);
-
-        if(ArrayIsEmpty(p_array))
-        {
-            LogDebugLine("p_array is empty, returning false");
-            return false;
-        }
-        if(ArrayIsEmpty(p_start))
+        outp_table[0] = 0;
+        for(Size i = 1, l_matched = 0; i < p_size; ++i)
         {
-            LogDebugLine("p_start is empty, returning false");
-            return false;
+            while(l_matched > 0 && p_needle[l_last - i] != p_needle[l_last - l_matched])
+            {
+                l_matched = outp_table[l_matched - 1];
+            }
+            if(p_needle[l_last - i] == p_needle[l_last - l_matched])
+            {
+                ++l_matched;
+            }
+            outp_table[i] = l_matched;
         }
+    }
 
-        if(p_start.m_Size > p_array.m_Size)
+    /**
+     * @brief Returns the index of the first occurrence of p_needle in
+     * p_haystack, or p_haystack_size if there is none.
+     *
+     * @details Byte items are searched for by
+     * @ref FindIndexOfFirstOccurrenceOfBytesInBytes and p_table is a Horspool
+     * table. Other items use p_table as a prefix table filled by
+     * @ref FillPrefixTableOfItems, if it is null the search backtracks instead.
+     *
+     * @warning p_needle_size must be at least 1 and at most p_haystack_size.
+     *
+     * @time O(n + m) with a table, O(n * m) without one, n being
+     * p_haystack_size and m being p_needle_size.
+     *
+     */
+    template<typename T>
+    Size FindIndexOfFirstOccurrenceOfItemsInItemsUsingTable(
+        const T* p_needle, const Size& p_needle_size,
+        const Size* p_table,
+        const T* p_haystack, const Size& p_haystack_size
+    )
+    {
+
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
         {
-            LogDebugLine("p_start.m_Size is bigger than p_array.m_Size,"
-            " returning false");
-            return false;
+            return FindIndexOfFirstOccurrenceOfBytesInBytes(
+                (const Byte*)p_needle, p_needle_size, p_table,
+                (const Byte*)p_haystack, p_haystack_size
+            );
         }
+        else
+        {
+            if(p_table == nullptr)
+            {
+                for(Size i = 0; i <= p_haystack_size - p_needle_size; ++i)
+                {
+                    Size n = 0;
+                    while(n < p_needle_size && p_haystack[i + n] == p_needle[n])
+                    {
+                        ++n;
+                    }
+                    if(n == p_needle_size)
+                    {
+                        return i;
+                    }
+                }
 
-        LogDebugLine("Starting main loop for check.");
+                return p_haystack_size;
+            }
 
-        //There is a gurante that p_start.m_Size =< p_array.m_Size
-        for(Size i = 0; i < p_start.m_Size; ++i)
-        {
-            if(p_array[i] != p_start[i])
+            for(Size i = 0, l_matched = 0; i < p_haystack_size; ++i)
             {
-                LogDebugLine("Missmatch found on index " << i << " returning false");
-                return false;
+                while(l_matched > 0 && p_haystack[i] != p_needle[l_matched])
+                {
+                    l_matched = p_table[l_matched - 1];
+                }
+                if(p_haystack[i] == p_needle[l_matched] && ++l_matched == p_needle_size)
+                {
+                    return i + 1 - p_needle_size;
+                }
             }
-        }
 
-        LogDebugLine("No missmatches found, returning true");
-        return true;
+            return p_haystack_size;
+        }
 
     }
     /**
-     * @brief Checks if p_array ends with p_end.
-     * 
-     * @details Loops through index p_end.m_Size to 0 and checks if on each
-     * index the two array's items match. If any missmatch is found false is 
-     * returned. If the loop is completed successfully true is returned.\n
-     * False is also returned if either p_array ot p_start have a null buffer or
-     * size of zero.\n
-     * If p_end.m_Size > p_array.m_Size false is returned.
-     * 
-     * @time O(n), n being the number of items in p_end.
-     * 
-     * @param p_array The array to check in.
-     * @param p_end The array to check for.
-     * @return True if p_array ends with p_end, false if either of them are
-     * empty or p_array does not end with p_end.
-     * 
+     * @brief The same as @ref FindIndexOfFirstOccurrenceOfItemsInItemsUsingTable
+     * but returns the last occurrence. p_table is filled by
+     * @ref FillReverseHorspoolTableOfBytes or @ref FillSuffixTableOfItems.
+     *
      */
     template<typename T>
-    bool ArrayEndsWithArray(const Array<T>& p_array, const Array<T>& p_end)
+    Size FindIndexOfLastOccurrenceOfItemsInItemsUsingTable(
+        const T* p_needle, const Size& p_needle_size,
+        const Size* p_table,
+        const T* p_haystack, const Size& p_haystack_size
+    )
     {
 
-        LogDebugLine("Checking if array " << p_array << " ends with " <<
-        p_end);
-
-        if(ArrayIsEmpty(p_array))
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
         {
-            LogDebugLine("p_array is empty, returning false");
-            return false;
+            return FindIndexOfLastOccurrenceOfBytesInBytes(
+                (const Byte*)p_needle, p_needle_size, p_table,
+                (const Byte*)p_haystack, p_haystack_size
+            );
         }
-        if(ArrayIsEmpty(p_end))
+        else
         {
-            LogDebugLine("p_end is empty, returning false");
-            return false;
+            const Size l_last = p_needle_size - 1;
+
+            if(p_table == nullptr)
+            {
+                for(Size i = p_haystack_size - p_needle_size + 1; i-- > 0;)
+                {
+                    Size n = 0;
+                    while(n < p_needle_size && p_haystack[i + n] == p_needle[n])
+                    {
+                        ++n;
+                    }
+                    if(n == p_needle_size)
+                    {
+                        return i;
+                    }
+                }
+
+                return p_haystack_size;
+            }
+
+            for(Size i = p_haystack_size, l_matched = 0; i-- > 0;)
+            {
+                while(l_matched > 0 && p_haystack[i] != p_needle[l_last - l_matched])
+                {
+                    l_matched = p_table[l_matched - 1];
+                }
+                if(p_haystack[i] == p_needle[l_last - l_matched] && ++l_matched == p_needle_size)
+                {
+                    return i;
+                }
+            }
+
+            return p_haystack_size;
+        }
+
+    }
+    /**
+     * @brief Returns the number of occurrences of p_needle in p_haystack that
+     * do not overlap. p_table is the same as for
+     * @ref FindIndexOfFirstOccurrenceOfItemsInItemsUsingTable.
+     *
+     */
+    template<typename T>
+    Size FindNumberOfInstanceOfItemsInItemsUsingTable(
+        const T* p_needle, const Size& p_needle_size,
+        const Size* p_table,
+        const T* p_haystack, const Size& p_haystack_size
+    )
+    {
+
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            return FindNumberOfInstanceOfBytesInBytes(
+                (const Byte*)p_needle, p_needle_size, p_table,
+                (const Byte*)p_haystack, p_haystack_size
+            );
+        }
+        else
+        {
+            Size l_result = 0;
+
+            if(p_table == nullptr)
+            {
+                for(Size i = 0; p_haystack_size - i >= p_needle_size;)
+                {
+                    Size l_index = FindIndexOfFirstOccurrenceOfItemsInItemsUsingTable(
+                        p_needle, p_needle_size, p_table,
+                        p_haystack + i, p_haystack_size - i
+                    );
+                    if(l_index == p_haystack_size - i)
+                    {
+                        break;
+                    }
+
+                    ++l_result;
+                    i += l_index + p_needle_size;
+                }
+
+                return l_result;
+            }
+
+            for(Size i = 0, l_matched = 0; i < p_haystack_size; ++i)
+            {
+                while(l_matched > 0 && p_haystack[i] != p_needle[l_matched])
+                {
+                    l_matched = p_table[l_matched - 1];
+                }
+                if(p_haystack[i] == p_needle[l_matched] && ++l_matched == p_needle_size)
+                {
+                    //Instances do not overlap, so matching starts over.
+                    ++l_result;
+                    l_matched = 0;
+                }
+            }
+
+            return l_result;
+        }
+
+    }
+
+    /**
+     * @brief Returns the index were the first occurrence of the first item and
+     * all following items in p_toFind can be found in p_array.
+     * 
+     * @details Byte items are found using memchr, a SIMD filter on the first
+     * and last item of p_toFind, or a Horspool skip table built on the stack
+     * for long needles. Other items are found using a prefix table built on
+     * the stack (Knuth-Morris-Pratt), needles longer than
+     * @ref g_ARRAY_SEARCH_STACK_TABLE_SIZE are found by backtracking. Partial
+     * matches that overlap the real one, like "aab" in "aaab", are found.
+     *
+     * To search for the same array many times, create an @ref ArrayNeedle of
+     * it and use @ref FindIndexOfFirstOccurrenceOfArrayNeedleInArray.
+     * 
+     * Generally in every error case p_array.m_Size is returned. Such errors are:
+     * - Either p_toFind or p_array have a null buffer or a size of 0;
+     * - p_toFind cannot be found in p_array;
+     * - p_toFind.m_Size > p_array.m_Size.
+     * 
+     * 
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in p_toFind. O(n * m) for needles that are not bytes and
+     * are longer than @ref g_ARRAY_SEARCH_STACK_TABLE_SIZE.
+     * 
+     * @param p_toFind The array that will be searched for.
+     * @param p_array The array that will be searched in.
+     * @return The first occurrence of p_toFind in p_array, the index is where
+     * the first item of p_toFind can be found. In any other case p_array.m_Size
+     * is returned.
+     * 
+     */
+    template<typename T>
+    Size FindIndexOfFirstOccurrenceOfArrayInArray(const Array<T>& p_toFind, const Array<T>& p_array)
+    {
+
+        LogDebugLine("Finding the first occurrence of array " << p_toFind 
+        << " in array " << p_array);
+
+        if(ArrayIsEmpty(p_toFind))
+        {
+            LogDebugLine("The array being searched for is empty, returning the size.");
+            return p_array.m_Size;
+        }
+        if(ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("The array being searched in is empty, returning the size.");
+            return p_array.m_Size;
+        }
+        if(p_toFind.m_Size > p_array.m_Size)
+        {
+            LogDebugLine("The array that is being searched for has a bigger"
+            " size than the array that is being searched in.");
+            return p_array.m_Size;
+        }
+
+        Size l_table[g_ARRAY_ITEMS_ARE_BYTES<T> ? 256 : g_ARRAY_SEARCH_STACK_TABLE_SIZE];
+        const Size* l_usedTable = nullptr;
+
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            if(p_toFind.m_Size >= g_ARRAY_SEARCH_HORSPOOL_THRESHOLD)
+            {
+                FillHorspoolTableOfBytes((const Byte*)p_toFind.m_Buffer, p_toFind.m_Size, l_table);
+                l_usedTable = l_table;
+            }
+        }
+        else
+        {
+            if(p_toFind.m_Size <= g_ARRAY_SEARCH_STACK_TABLE_SIZE)
+            {
+                FillPrefixTableOfItems(p_toFind.m_Buffer, p_toFind.m_Size, l_table);
+                l_usedTable = l_table;
+            }
+        }
+
+        return FindIndexOfFirstOccurrenceOfItemsInItemsUsingTable(
+            p_toFind.m_Buffer, p_toFind.m_Size, l_usedTable,
+            p_array.m_Buffer, p_array.m_Size
+        );
+
+    }
+    /**
+     * @brief Returns the index were the last occurrence of the first item and
+     * all following items in p_toFind can be found in p_array.
+     * 
+     * @details The same as @ref FindIndexOfFirstOccurrenceOfArrayInArray,
+     * except p_array is searched from its end and the tables are built for
+     * p_toFind read backwards.
+     * 
+     * Generally in every error case p_array.m_Size is returned. Such errors are:
+     * - Either p_toFind or p_array have a null buffer or a size of 0;
+     * - p_toFind cannot be found in p_array;
+     * - p_toFind.m_Size > p_array.m_Size.
+     * 
+     * 
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in p_toFind. O(n * m) for needles that are not bytes and
+     * are longer than @ref g_ARRAY_SEARCH_STACK_TABLE_SIZE.
+     * 
+     * @param p_toFind The array that will be searched for.
+     * @param p_array The array that will be searched in.
+     * @return The last occurrence of p_toFind in p_array, the index is where
+     * the first item of p_toFind can be found. In any other case p_array.m_Size
+     * is returned.
+     * 
+     */
+    template<typename T>
+    Size FindIndexOfLastOccurrenceOfArrayInArray(const Array<T>& p_toFind, const Array<T>& p_array)
+    {
+
+        LogDebugLine("Finding the last occurrence of array " << p_toFind 
+        << " in array " << p_array);
+
+        if(ArrayIsEmpty(p_toFind))
+        {
+            LogDebugLine("The array being searched for is empty, returning the size.");
+            return p_array.m_Size;
+        }
+        if(ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("The array being searched in is empty, returning the size.");
+            return p_array.m_Size;
+        }
+        if(p_toFind.m_Size > p_array.m_Size)
+        {
+            LogDebugLine("The array that is being searched for has a bigger"
+            " size than the array that is being searched in.");
+            return p_array.m_Size;
+        }
+
+        Size l_table[g_ARRAY_ITEMS_ARE_BYTES<T> ? 256 : g_ARRAY_SEARCH_STACK_TABLE_SIZE];
+        const Size* l_usedTable = nullptr;
+
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            if(p_toFind.m_Size >= g_ARRAY_SEARCH_HORSPOOL_THRESHOLD)
+            {
+                FillReverseHorspoolTableOfBytes((const Byte*)p_toFind.m_Buffer, p_toFind.m_Size, l_table);
+                l_usedTable = l_table;
+            }
+        }
+        else
+        {
+            if(p_toFind.m_Size <= g_ARRAY_SEARCH_STACK_TABLE_SIZE)
+            {
+                FillSuffixTableOfItems(p_toFind.m_Buffer, p_toFind.m_Size, l_table);
+                l_usedTable = l_table;
+            }
+        }
+
+        return FindIndexOfLastOccurrenceOfItemsInItemsUsingTable(
+            p_toFind.m_Buffer, p_toFind.m_Size, l_usedTable,
+            p_array.m_Buffer, p_array.m_Size
+        );
+
+    }
+
+    /**
+     * @brief Finds the number of instances of p_toFind in p_array.
+     * 
+     * @details Searches the same way as
+     * @ref FindIndexOfFirstOccurrenceOfArrayInArray. After an instance is
+     * found searching continues after its last item, so instances that
+     * overlap are only counted once, "aa" is found 2 times in "aaaaa".
+     * 
+     * If either p_array or p_toFind have an empty buffer or a size of 0, 0 is
+     * returned.\n
+     * If p_toFind.m_Size > p_array.m_Size, 0 is returned.
+     * 
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in p_toFind. O(n * m) for needles that are not bytes and
+     * are longer than @ref g_ARRAY_SEARCH_STACK_TABLE_SIZE.
+     * 
+     * @param p_toFind The array that will be searched for.
+     * @param p_array The array that will be searched in.
+     * @return The number of instances of p_toFind in p_array.
+     */
+    template<typename T>
+    Size FindNumberOfInstanceOfArrayInArray(const Array<T>& p_toFind, const Array<T>& p_array)
+    {
+
+        LogDebugLine("Finding the number of occurrences of array " << p_toFind 
+        << " in array " << p_array);
+
+        if(ArrayIsEmpty(p_toFind))
+        {
+            LogDebugLine("The array being searched for is empty, returning the size.");
+            return 0;
+        }
+        if(ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("The array being searched in is empty, returning the size.");
+            return 0;
+        }
+        if(p_toFind.m_Size > p_array.m_Size)
+        {
+            LogDebugLine("The array that is being searched for has a bigger"
+            " size than the array that is being searched in.");
+            return 0;
+        }
+
+        Size l_table[g_ARRAY_ITEMS_ARE_BYTES<T> ? 256 : g_ARRAY_SEARCH_STACK_TABLE_SIZE];
+        const Size* l_usedTable = nullptr;
+
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            if(p_toFind.m_Size >= g_ARRAY_SEARCH_HORSPOOL_THRESHOLD)
+            {
+                FillHorspoolTableOfBytes((const Byte*)p_toFind.m_Buffer, p_toFind.m_Size, l_table);
+                l_usedTable = l_table;
+            }
+        }
+        else
+        {
+            if(p_toFind.m_Size <= g_ARRAY_SEARCH_STACK_TABLE_SIZE)
+            {
+                FillPrefixTableOfItems(p_toFind.m_Buffer, p_toFind.m_Size, l_table);
+                l_usedTable = l_table;
+            }
+        }
+
+        return FindNumberOfInstanceOfItemsInItemsUsingTable(
+            p_toFind.m_Buffer, p_toFind.m_Size, l_usedTable,
+            p_array.m_Buffer, p_array.m_Size
+        );
+
+    }
+
+    /**
+     * @brief Checks if p_array is empty
+     * 
+     * @details Checks if p_array.m_Buffer is null and if p_array.m_Size is null,
+     * if any of these are true, then true is returned, false otherwise.
+     * 
+     * @param p_array Is this array empty?
+     * @return True if either the array has a null buffer or a size of 0.
+     */
+    template<typename T>
+    bool ArrayIsEmpty(const Array<T>& p_array)
+    {
+        LogDebugLine("Checking if array " << p_array << " is empty.");
+        return p_array.m_Buffer == nullptr || p_array.m_Size == 0;
+    }
+
+    /**
+     * @brief Checks if p_array has p_toFind.
+     * 
+     * @details Searches for p_toFind using
+     * @ref FindIndexOfFirstOccurrenceOfArrayInArray, if it is found true is
+     * returned, false otherwise.\n
+     * If p_array or p_toFind are empty or have a size of 0, false is returned.\n
+     * If p_toFind.m_Size > p_array.m_Size, false is returned.
+     * 
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in p_toFind.
+     * 
+     * @param p_array The array that will be searched in. 
+     * @param p_toFind The array that will be searched for.
+     * 
+     * @return True if p_item can be found in p_array, false otherwise.
+     * 
+     */
+    template<typename T>
+    bool ArrayContainsArray (const Array<T>& p_array, const Array<T>& p_toFind)
+    {
+        LogDebugLine("Checking if array " << p_array << " contains the array " << p_toFind);
+        //Again code reuse!!1!11!!!!1!
+        return FindIndexOfFirstOccurrenceOfArrayInArray(p_toFind, p_array) < p_array.m_Size;
+    }
+
+    /**
+     * @brief An array that is going to be searched for many times, together
+     * with the tables the search functions would otherwise build each time.
+     *
+     * @details Created by @ref CreateArrayNeedleAtOfArrayUsingAllocator and
+     * searched for using @ref FindIndexOfFirstOccurrenceOfArrayNeedleInArray,
+     * @ref FindIndexOfLastOccurrenceOfArrayNeedleInArray,
+     * @ref FindNumberOfInstanceOfArrayNeedleInArray and
+     * @ref ArrayContainsArrayNeedle.
+     *
+     * For byte items the tables are the Horspool skip tables for both
+     * directions, only needles of at least
+     * @ref g_ARRAY_SEARCH_HORSPOOL_THRESHOLD items have them. For other items
+     * they are the prefix and suffix tables, so searching is O(n + m) no matter
+     * how long the needle is.
+     *
+     * @warning The items are not copied, m_Items.m_Buffer must stay valid and
+     * unchanged for as long as the needle is used.
+     *
+     */
+    template<typename T>
+    struct ArrayNeedle
+    {
+        /**
+         * @brief The array that is searched for.
+         *
+         */
+        Array<T> m_Items;
+        /**
+         * @brief The table for searching forwards followed by the one for
+         * searching backwards, null if the needle has no tables.
+         *
+         */
+        Size* m_Tables;
+        /**
+         * @brief The number of items in each of the two tables.
+         *
+         */
+        Size m_TableSize;
+
+        /**
+         * @brief Creates a needle with no items and no tables.
+         *
+         */
+        ArrayNeedle():
+        m_Items(),
+        m_Tables(nullptr),
+        m_TableSize(0)
+        {
+            LogDebugLine("Constructing an empty needle at " << this);
+        }
+    };
+
+    /**
+     * @brief Creates an @ref ArrayNeedle at outp_needle that searches for
+     * p_toFind.
+     *
+     * @details The tables are allocated using p_allocate and filled, which is
+     * O(m), m being p_toFind.m_Size.
+     *
+     * If p_toFind is empty, or it is a byte needle that is too short to use
+     * tables, no allocation happens and outp_needle has no tables.
+     *
+     * If allocation fails, or the size of the tables overflows, p_alloc_error
+     * is called and outp_needle has no tables. The needle can still be used,
+     * it is only searched for the same way as without one.
+     *
+     * @param outp_needle Where the needle will be created, it is overwritten.
+     * @param p_toFind The array to search for, it is not copied.
+     * @param p_allocate The allocator used for the tables.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     */
+    template<typename T>
+    void CreateArrayNeedleAtOfArrayUsingAllocator(
+        ArrayNeedle<T>& outp_needle,
+        const Array<T>& p_toFind,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating needle at " << &outp_needle << " of array " << p_toFind);
+
+        outp_needle.m_Items = p_toFind;
+        outp_needle.m_Tables = nullptr;
+        outp_needle.m_TableSize = 0;
+
+        if(ArrayIsEmpty(p_toFind))
+        {
+            LogDebugLine("p_toFind is empty, the needle has no tables.");
+            return;
+        }
+
+        Size l_tableSize = p_toFind.m_Size;
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            if(p_toFind.m_Size < g_ARRAY_SEARCH_HORSPOOL_THRESHOLD)
+            {
+                LogDebugLine("p_toFind is too short for Horspool tables.");
+                return;
+            }
+            l_tableSize = 256;
+        }
+
+        if(l_tableSize > SIZE_MAX / (2 * sizeof(Size)))
+        {
+            LogDebugLine("The size of the tables overflows.");
+            if(p_alloc_error != nullptr)
+            {
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        Size* l_tables = (Size*)p_allocate(2 * sizeof(Size) * l_tableSize);
+        if(l_tables == nullptr)
+        {
+            LogDebugLine("Allocation of the tables failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            FillHorspoolTableOfBytes((const Byte*)p_toFind.m_Buffer, p_toFind.m_Size, l_tables);
+            FillReverseHorspoolTableOfBytes((const Byte*)p_toFind.m_Buffer, p_toFind.m_Size, l_tables + l_tableSize);
+        }
+        else
+        {
+            FillPrefixTableOfItems(p_toFind.m_Buffer, p_toFind.m_Size, l_tables);
+            FillSuffixTableOfItems(p_toFind.m_Buffer, p_toFind.m_Size, l_tables + l_tableSize);
+        }
+
+        outp_needle.m_Tables = l_tables;
+        outp_needle.m_TableSize = l_tableSize;
+
+        LogDebugLine("Created needle with tables at " << (void*)l_tables);
+
+    }
+    template<typename T>
+    inline void CreateArrayNeedleAtOfArray(
+        ArrayNeedle<T>& outp_needle,
+        const Array<T>& p_toFind
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayNeedleAtOfArrayUsingAllocator");
+        CreateArrayNeedleAtOfArrayUsingAllocator(
+            outp_needle, p_toFind,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Deallocates the tables of p_needle using p_deallocate, p_needle
+     * is left with no items and no tables.
+     *
+     * @details The items of the needle are not deallocated since they were
+     * never copied.
+     *
+     * @param p_needle The needle to destroy.
+     * @param p_deallocate The deallocator matching the allocator the needle
+     * was created with.
+     *
+     */
+    template<typename T>
+    void DestroyArrayNeedleUsingDeallocator(ArrayNeedle<T>& p_needle, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying needle at " << &p_needle);
+
+        if(p_needle.m_Tables != nullptr)
+        {
+            p_deallocate(p_needle.m_Tables);
+        }
+
+        p_needle.m_Items = Array<T>();
+        p_needle.m_Tables = nullptr;
+        p_needle.m_TableSize = 0;
+
+    }
+    template<typename T>
+    inline void DestroyArrayNeedle(ArrayNeedle<T>& p_needle)
+    {
+        LogDebugLine("Using defaults for DestroyArrayNeedleUsingDeallocator");
+        DestroyArrayNeedleUsingDeallocator(p_needle, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+    /**
+     * @brief The same as @ref FindIndexOfFirstOccurrenceOfArrayInArray, using
+     * the tables of p_needle instead of building them.
+     *
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in the needle.
+     *
+     */
+    template<typename T>
+    Size FindIndexOfFirstOccurrenceOfArrayNeedleInArray(
+        const ArrayNeedle<T>& p_needle,
+        const Array<T>& p_array
+    )
+    {
+
+        LogDebugLine("Finding the first occurrence of needle " << p_needle.m_Items
+        << " in array " << p_array);
+
+        if(
+            ArrayIsEmpty(p_needle.m_Items) || ArrayIsEmpty(p_array) ||
+            p_needle.m_Items.m_Size > p_array.m_Size
+        )
+        {
+            LogDebugLine("The needle can not be in p_array, returning the size.");
+            return p_array.m_Size;
+        }
+        if(p_needle.m_Tables == nullptr)
+        {
+            return FindIndexOfFirstOccurrenceOfArrayInArray(p_needle.m_Items, p_array);
+        }
+
+        return FindIndexOfFirstOccurrenceOfItemsInItemsUsingTable(
+            p_needle.m_Items.m_Buffer, p_needle.m_Items.m_Size, p_needle.m_Tables,
+            p_array.m_Buffer, p_array.m_Size
+        );
+
+    }
+    /**
+     * @brief The same as @ref FindIndexOfLastOccurrenceOfArrayInArray, using
+     * the tables of p_needle instead of building them.
+     *
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in the needle.
+     *
+     */
+    template<typename T>
+    Size FindIndexOfLastOccurrenceOfArrayNeedleInArray(
+        const ArrayNeedle<T>& p_needle,
+        const Array<T>& p_array
+    )
+    {
+
+        LogDebugLine("Finding the last occurrence of needle " << p_needle.m_Items
+        << " in array " << p_array);
+
+        if(
+            ArrayIsEmpty(p_needle.m_Items) || ArrayIsEmpty(p_array) ||
+            p_needle.m_Items.m_Size > p_array.m_Size
+        )
+        {
+            LogDebugLine("The needle can not be in p_array, returning the size.");
+            return p_array.m_Size;
+        }
+        if(p_needle.m_Tables == nullptr)
+        {
+            return FindIndexOfLastOccurrenceOfArrayInArray(p_needle.m_Items, p_array);
+        }
+
+        return FindIndexOfLastOccurrenceOfItemsInItemsUsingTable(
+            p_needle.m_Items.m_Buffer, p_needle.m_Items.m_Size,
+            p_needle.m_Tables + p_needle.m_TableSize,
+            p_array.m_Buffer, p_array.m_Size
+        );
+
+    }
+    /**
+     * @brief The same as @ref FindNumberOfInstanceOfArrayInArray, using the
+     * tables of p_needle instead of building them.
+     *
+     * @time O(n + m), n being the number of items in p_array and m being the
+     * number of items in the needle.
+     *
+     */
+    template<typename T>
+    Size FindNumberOfInstanceOfArrayNeedleInArray(
+        const ArrayNeedle<T>& p_needle,
+        const Array<T>& p_array
+    )
+    {
+
+        LogDebugLine("Finding the number of occurrences of needle " <<
+        p_needle.m_Items << " in array " << p_array);
+
+        if(
+            ArrayIsEmpty(p_needle.m_Items) || ArrayIsEmpty(p_array) ||
+            p_needle.m_Items.m_Size > p_array.m_Size
+        )
+        {
+            LogDebugLine("The needle can not be in p_array, returning 0.");
+            return 0;
+        }
+        if(p_needle.m_Tables == nullptr)
+        {
+            return FindNumberOfInstanceOfArrayInArray(p_needle.m_Items, p_array);
+        }
+
+        return FindNumberOfInstanceOfItemsInItemsUsingTable(
+            p_needle.m_Items.m_Buffer, p_needle.m_Items.m_Size, p_needle.m_Tables,
+            p_array.m_Buffer, p_array.m_Size
+        );
+
+    }
+    /**
+     * @brief The same as @ref ArrayContainsArray, using the tables of p_needle
+     * instead of building them.
+     *
+     */
+    template<typename T>
+    bool ArrayContainsArrayNeedle(const Array<T>& p_array, const ArrayNeedle<T>& p_needle)
+    {
+        LogDebugLine("Checking if array " << p_array << " contains the needle " << p_needle.m_Items);
+        return FindIndexOfFirstOccurrenceOfArrayNeedleInArray(p_needle, p_array) < p_array.m_Size;
+    }
+
+    /**
+     * @brief Checks if p_array starts with p_start.
+     * 
+     * @details Compares the first p_start.m_Size items of p_array with the
+     * items of p_start using @ref ItemsOfBuffersAreEqual, so integers, enums
+     * and pointers are compared as bytes.\n
+     * False is also returned if either p_array ot p_start have a null buffer or
+     * size of zero.\n
+     * If p_start.m_Size > p_array.m_Size false is returned.
+     * 
+     * @time O(n), n being the number of items in p_start.
+     * 
+     * @param p_array The array to check in.
+     * @param p_start The array to check for.
+     * @return True if p_array starts with p_start, false if either of them are
+     * empty or p_array does not start with p_start.
+     * 
+     */
+    template<typename T>
+    bool ArrayStartsWithArray(const Array<T>& p_array, const Array<T>& p_start)
+    {
+
+        LogDebugLine("Checking if array " << p_array << " starts with " <<
+        p_start);
+
+        if(ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("p_array is empty, returning false");
+            return false;
+        }
+        if(ArrayIsEmpty(p_start))
+        {
+            LogDebugLine("p_start is empty, returning false");
+            return false;
+        }
+
+        if(p_start.m_Size > p_array.m_Size)
+        {
+            LogDebugLine("p_start.m_Size is bigger than p_array.m_Size,"
+            " returning false");
+            return false;
+        }
+
+        LogDebugLine("Starting main loop for check.");
+
+        //There is a gurante that p_start.m_Size =< p_array.m_Size
+        return ItemsOfBuffersAreEqual(p_array.m_Buffer, p_start.m_Buffer, p_start.m_Size);
+
+    }
+    /**
+     * @brief Checks if p_array ends with p_end.
+     * 
+     * @details Compares the last p_end.m_Size items of p_array with the
+     * items of p_end using @ref ItemsOfBuffersAreEqual, so integers, enums
+     * and pointers are compared as bytes.\n
+     * False is also returned if either p_array ot p_start have a null buffer or
+     * size of zero.\n
+     * If p_end.m_Size > p_array.m_Size false is returned.
+     * 
+     * @time O(n), n being the number of items in p_end.
+     * 
+     * @param p_array The array to check in.
+     * @param p_end The array to check for.
+     * @return True if p_array ends with p_end, false if either of them are
+     * empty or p_array does not end with p_end.
+     * 
+     */
+    template<typename T>
+    bool ArrayEndsWithArray(const Array<T>& p_array, const Array<T>& p_end)
+    {
+
+        LogDebugLine("Checking if array " << p_array << " ends with " <<
+        p_end);
+
+        if(ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("p_array is empty, returning false");
+            return false;
+        }
+        if(ArrayIsEmpty(p_end))
+        {
+            LogDebugLine("p_end is empty, returning false");
+            return false;
+        }
+
+        if(p_end.m_Size > p_array.m_Size)
+        {
+            LogDebugLine("p_end.m_Size is bigger than p_array.m_Size, "
+            "returning false");
+            return false;
+        }
+
+        LogDebugLine("Starting main loop for check.");
+
+        //There is a gurante that p_start.m_Size =< p_array.m_Size, so compare
+        //the last p_end.m_Size items from the front, in the order they are in
+        //memory.
+        return ItemsOfBuffersAreEqual(p_array.end() - p_end.m_Size, p_end.m_Buffer, p_end.m_Size);
+
+    }
+
+    /**
+     * @brief Returns the index of the first item that differs between
+     * p_left and p_right.
+     *
+     * @details If one of them starts with the other, or both are equal, the
+     * size of the shorter one is returned, so the result is p_left.m_Size
+     * exactly when p_right starts with p_left. Null and empty arrays have no
+     * items, for them 0 is returned.
+     *
+     * Items that are @ref g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE
+     * "bitwise comparable" are compared 16 bytes at a time, see
+     * @ref FindIndexOfFirstMismatchOfItems.
+     *
+     * @time O(n), n being the index returned.
+     *
+     */
+    template<typename T>
+    Size FindIndexOfFirstMismatchOfArrayAndArray(const Array<T>& p_left, const Array<T>& p_right)
+    {
+
+        LogDebugLine("Finding the first mismatch of array " << p_left <<
+        " and array " << p_right);
+
+        if(ArrayIsEmpty(p_left) || ArrayIsEmpty(p_right))
+        {
+            LogDebugLine("One of the arrays is empty, returning 0");
+            return 0;
+        }
+
+        return FindIndexOfFirstMismatchOfItems(
+            p_left.m_Buffer, p_right.m_Buffer,
+            p_left.m_Size < p_right.m_Size ? p_left.m_Size : p_right.m_Size
+        );
+
+    }
+
+
+    /**
+     * @brief Reverses p_array.
+     * 
+     * @details If the given array is empty the function returns.
+     * 
+     * @time O(n / 2), n being the nubmer of items in the array.
+     * 
+     * @param p_array The array to reverse.
+     * 
+     * 
+     */
+    template<typename T>
+    void ReverseArray(Array<T>& p_array)
+    {
+
+        LogDebugLine("Reversing array " << p_array);
+
+        if(ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("p_array is empty, returning.");
+            return;
+        }
+
+        LogDebugLine("Begining to loop now.");
+        //Have two pointers start from the begining of the array and the end of
+        //the array. Loop initil they meet in the middle.
+        T* l_last = p_array.end();
+        for(T* l_first = p_array.begin(); l_first < --l_last; ++l_first)
+        {
+            T l_temp(std::move(*l_first));
+            *l_first = std::move(*l_last);
+            *l_last = std::move(l_temp);
+        }
+
+        LogDebugLine("Loop finished, returning");
+
+    }
+
+
+    /**
+     * @brief Ranges of at most this many items are sorted by insertion
+     * instead of being partitioned or merged further.
+     *
+     */
+    constexpr Size g_ARRAY_INSERTION_SORT_THRESHOLD = 24;
+    /**
+     * @brief Ranges with more items than this take their pivot from the
+     * median of 3 medians instead of the median of 3 items.
+     *
+     */
+    constexpr Size g_ARRAY_NINTHER_THRESHOLD = 128;
+    /**
+     * @brief The number of items that are looked at together by the block
+     * partition, see @ref PartitionItemsAroundFirstByBlocksUsingComparator.
+     *
+     * @details 64 so that an offset fits into a Byte and the offsets of a
+     * block fit into a cache line.
+     *
+     */
+    constexpr Size g_ARRAY_PARTITION_BLOCK_SIZE = 64;
+    /**
+     * @brief Arrays with fewer items than this are not radix sorted, the
+     * histograms alone cost more than sorting them by comparison.
+     *
+     */
+    constexpr Size g_ARRAY_RADIX_SORT_THRESHOLD = 256;
+
+    /**
+     * @brief True if the partition of @ref SortArrayUsingComparator should use
+     * blocks of comparison results instead of branching on each comparison.
+     *
+     * @details Only worth it if comparing is cheap and does not branch, which
+     * is assumed for numbers and pointers.
+     *
+     */
+    template<typename T>
+    constexpr bool g_ARRAY_SORT_WITHOUT_BRANCHES =
+        std::is_arithmetic_v<T> || std::is_pointer_v<T> || std::is_enum_v<T>;
+
+    /**
+     * @brief Sorts the items in [p_begin, p_end) by insertion, items that
+     * are not before each other keep their order.
+     *
+     * @details If Unguarded is true the item before p_begin must exist and
+     * must not be after any item in the range, it stops the search for where
+     * an item goes instead of checking for p_begin.
+     *
+     * @time O(n^2), O(n) for a sorted range.
+     *
+     */
+    template<bool Unguarded, typename T, typename C>
+    void SortItemsByInsertionUsingComparator(T* p_begin, T* p_end, C& p_isBefore)
+    {
+
+        if(p_begin == p_end)
+        {
+            return;
+        }
+
+        for(T* l_current = p_begin + 1; l_current != p_end; ++l_current)
+        {
+            T* l_hole = l_current;
+            T* l_previous = l_current - 1;
+
+            if(p_isBefore(*l_hole, *l_previous))
+            {
+                T l_item(std::move(*l_hole));
+                do
+                {
+                    *l_hole = std::move(*l_previous);
+                    --l_hole;
+                }
+                while((Unguarded || l_hole != p_begin) && p_isBefore(l_item, *--l_previous));
+                *l_hole = std::move(l_item);
+            }
+        }
+
+    }
+
+    /**
+     * @brief Same as @ref SortItemsByInsertionUsingComparator, but gives up
+     * once more than 8 items have been moved in total.
+     *
+     * @return True if the range is sorted, false if it gave up. The range is
+     * a permutation of what it was either way.
+     *
+     */
+    template<typename T, typename C>
+    bool SortItemsByInsertionUsingComparatorUpToLimit(T* p_begin, T* p_end, C& p_isBefore)
+    {
+
+        if(p_begin == p_end)
+        {
+            return true;
+        }
+
+        Size l_moved = 0;
+        for(T* l_current = p_begin + 1; l_current != p_end; ++l_current)
+        {
+            if(l_moved > 8)
+            {
+                return false;
+            }
+
+            T* l_hole = l_current;
+            T* l_previous = l_current - 1;
+
+            if(p_isBefore(*l_hole, *l_previous))
+            {
+                T l_item(std::move(*l_hole));
+                do
+                {
+                    *l_hole = std::move(*l_previous);
+                    --l_hole;
+                }
+                while(l_hole != p_begin && p_isBefore(l_item, *--l_previous));
+                *l_hole = std::move(l_item);
+                l_moved += (Size)(l_current - l_hole);
+            }
+        }
+
+        return true;
+
+    }
+
+    /**
+     * @brief Sorts the items in [p_begin, p_end) as a heap, used when
+     * partitioning keeps going badly.
+     *
+     * @time O(n log n) for every input.
+     *
+     */
+    template<typename T, typename C>
+    void SortItemsByHeapUsingComparator(T* p_begin, T* p_end, C& p_isBefore)
+    {
+
+        Size l_size = (Size)(p_end - p_begin);
+
+        //Moves the item at p_index down until neither child is after it.
+        auto l_siftDown = [&](Size p_index, Size p_heapSize)
+        {
+            T l_item(std::move(p_begin[p_index]));
+            Size l_child;
+            while((l_child = 2 * p_index + 1) < p_heapSize)
+            {
+                if(l_child + 1 < p_heapSize && p_isBefore(p_begin[l_child], p_begin[l_child + 1]))
+                {
+                    ++l_child;
+                }
+                if(!p_isBefore(l_item, p_begin[l_child]))
+                {
+                    break;
+                }
+                p_begin[p_index] = std::move(p_begin[l_child]);
+                p_index = l_child;
+            }
+            p_begin[p_index] = std::move(l_item);
+        };
+
+        for(Size i = l_size / 2; i-- > 0;)
+        {
+            l_siftDown(i, l_size);
+        }
+        for(Size i = l_size; i-- > 1;)
+        {
+            std::swap(p_begin[0], p_begin[i]);
+            l_siftDown(0, i);
+        }
+
+    }
+
+    /**
+     * @brief Orders the 3 items so that *p_a is not after *p_b and *p_b is not
+     * after *p_c.
+     *
+     */
+    template<typename T, typename C>
+    inline void SortThreeItemsUsingComparator(T* p_a, T* p_b, T* p_c, C& p_isBefore)
+    {
+        if(p_isBefore(*p_b, *p_a))
+        {
+            std::swap(*p_a, *p_b);
+        }
+        if(p_isBefore(*p_c, *p_b))
+        {
+            std::swap(*p_b, *p_c);
+        }
+        if(p_isBefore(*p_b, *p_a))
+        {
+            std::swap(*p_a, *p_b);
+        }
+    }
+
+    /**
+     * @brief Partitions [p_begin, p_end) around the pivot *p_begin, items
+     * that are before the pivot go to its left and all others to its right.
+     *
+     * @details There must be an item that is not before the pivot after
+     * p_begin, and if p_begin is not the first item of the whole array the
+     * item before it must not be after the pivot. Both are given by how
+     * @ref SortItemsUsingComparator picks pivots, and they let the scans run
+     * without bounds checks.
+     *
+     * @param outp_wasPartitioned Set to true if no items had to be swapped.
+     * @return Where the pivot ended up.
+     *
+     */
+    template<typename T, typename C>
+    T* PartitionItemsAroundFirstUsingComparator(
+        T* p_begin, T* p_end, C& p_isBefore,
+        bool& outp_wasPartitioned
+    )
+    {
+
+        T l_pivot(std::move(*p_begin));
+        T* l_first = p_begin;
+        T* l_last = p_end;
+
+        while(p_isBefore(*++l_first, l_pivot));
+
+        //If no item was skipped on the left nothing is known to stop the scan
+        //from the right before it passes l_first, so it checks.
+        if(l_first - 1 == p_begin)
+        {
+            while(l_first < l_last && !p_isBefore(*--l_last, l_pivot));
+        }
+        else
+        {
+            while(!p_isBefore(*--l_last, l_pivot));
+        }
+
+        outp_wasPartitioned = l_first >= l_last;
+
+        while(l_first < l_last)
+        {
+            std::swap(*l_first, *l_last);
+            while(p_isBefore(*++l_first, l_pivot));
+            while(!p_isBefore(*--l_last, l_pivot));
+        }
+
+        T* l_pivotPosition = l_first - 1;
+        *p_begin = std::move(*l_pivotPosition);
+        *l_pivotPosition = std::move(l_pivot);
+
+        return l_pivotPosition;
+
+    }
+
+    /**
+     * @brief Swaps p_count items at the offsets in p_leftOffsets from p_left
+     * with the items at the offsets in p_rightOffsets back from p_right.
+     *
+     * @details When the counts differ a cycle of moves is used instead of
+     * swaps, which is one move per item instead of three.
+     *
+     */
+    template<typename T>
+    inline void SwapItemsAtOffsets(
+        T* p_left, T* p_right,
+        const Byte* p_leftOffsets, const Byte* p_rightOffsets,
+        Size p_count, bool p_useSwaps
+    )
+    {
+        if(p_useSwaps)
+        {
+            for(Size i = 0; i < p_count; ++i)
+            {
+                std::swap(p_left[p_leftOffsets[i]], *(p_right - p_rightOffsets[i]));
+            }
+        }
+        else if(p_count > 0)
+        {
+            T* l_left = p_left + p_leftOffsets[0];
+            T* l_right = p_right - p_rightOffsets[0];
+            T l_item(std::move(*l_left));
+            *l_left = std::move(*l_right);
+            for(Size i = 1; i < p_count; ++i)
+            {
+                l_left = p_left + p_leftOffsets[i];
+                *l_right = std::move(*l_left);
+                l_right = p_right - p_rightOffsets[i];
+                *l_left = std::move(*l_right);
+            }
+            *l_right = std::move(l_item);
+        }
+    }
+
+    /**
+     * @brief Same as @ref PartitionItemsAroundFirstUsingComparator, but
+     * compares a block of items at a time and writes down the offsets of the
+     * misplaced ones instead of branching on each comparison.
+     *
+     * @details Branches on comparisons of random items are mispredicted half
+     * of the time, this way the comparisons only feed into additions.
+     * See "BlockQuicksort: How Branch Mispredictions don't affect Quicksort"
+     * by Edelkamp and Weiß.
+     *
+     */
+    template<typename T, typename C>
+    T* PartitionItemsAroundFirstByBlocksUsingComparator(
+        T* p_begin, T* p_end, C& p_isBefore,
+        bool& outp_wasPartitioned
+    )
+    {
+
+        T l_pivot(std::move(*p_begin));
+        T* l_first = p_begin;
+        T* l_last = p_end;
+
+        while(p_isBefore(*++l_first, l_pivot));
+
+        if(l_first - 1 == p_begin)
+        {
+            while(l_first < l_last && !p_isBefore(*--l_last, l_pivot));
+        }
+        else
+        {
+            while(!p_isBefore(*--l_last, l_pivot));
+        }
+
+        outp_wasPartitioned = l_first >= l_last;
+
+        if(!outp_wasPartitioned)
+        {
+            std::swap(*l_first, *l_last);
+            ++l_first;
+
+            alignas(64) Byte l_leftOffsets[g_ARRAY_PARTITION_BLOCK_SIZE];
+            alignas(64) Byte l_rightOffsets[g_ARRAY_PARTITION_BLOCK_SIZE];
+            T* l_leftBase = l_first;
+            T* l_rightBase = l_last;
+            Size l_leftCount = 0, l_rightCount = 0;
+            Size l_leftStart = 0, l_rightStart = 0;
+
+            while(l_first < l_last)
+            {
+                //Fill whichever blocks are empty, splitting what is left
+                //between them if both are.
+                Size l_unknown = (Size)(l_last - l_first);
+                Size l_leftSplit = l_leftCount == 0 ? (l_rightCount == 0 ? l_unknown / 2 : l_unknown) : 0;
+                Size l_rightSplit = l_rightCount == 0 ? l_unknown - l_leftSplit : 0;
+
+                if(l_leftSplit > g_ARRAY_PARTITION_BLOCK_SIZE)
+                {
+                    l_leftSplit = g_ARRAY_PARTITION_BLOCK_SIZE;
+                }
+                for(Size i = 0; i < l_leftSplit; ++i)
+                {
+                    l_leftOffsets[l_leftCount] = (Byte)i;
+                    l_leftCount += !p_isBefore(*l_first, l_pivot);
+                    ++l_first;
+                }
+
+                if(l_rightSplit > g_ARRAY_PARTITION_BLOCK_SIZE)
+                {
+                    l_rightSplit = g_ARRAY_PARTITION_BLOCK_SIZE;
+                }
+                for(Size i = 0; i < l_rightSplit;)
+                {
+                    l_rightOffsets[l_rightCount] = (Byte)++i;
+                    l_rightCount += p_isBefore(*--l_last, l_pivot);
+                }
+
+                Size l_count = l_leftCount < l_rightCount ? l_leftCount : l_rightCount;
+                SwapItemsAtOffsets(
+                    l_leftBase, l_rightBase,
+                    l_leftOffsets + l_leftStart, l_rightOffsets + l_rightStart,
+                    l_count, l_leftCount == l_rightCount
+                );
+                l_leftCount -= l_count;
+                l_rightCount -= l_count;
+                l_leftStart += l_count;
+                l_rightStart += l_count;
+
+                if(l_leftCount == 0)
+                {
+                    l_leftStart = 0;
+                    l_leftBase = l_first;
+                }
+                if(l_rightCount == 0)
+                {
+                    l_rightStart = 0;
+                    l_rightBase = l_last;
+                }
+            }
+
+            //At most one block has misplaced items left, they go to the
+            //middle.
+            if(l_leftCount > 0)
+            {
+                const Byte* l_offsets = l_leftOffsets + l_leftStart;
+                while(l_leftCount-- > 0)
+                {
+                    std::swap(l_leftBase[l_offsets[l_leftCount]], *--l_last);
+                }
+                l_first = l_last;
+            }
+            if(l_rightCount > 0)
+            {
+                const Byte* l_offsets = l_rightOffsets + l_rightStart;
+                while(l_rightCount-- > 0)
+                {
+                    std::swap(*(l_rightBase - l_offsets[l_rightCount]), *l_first);
+                    ++l_first;
+                }
+            }
+        }
+
+        T* l_pivotPosition = l_first - 1;
+        *p_begin = std::move(*l_pivotPosition);
+        *l_pivotPosition = std::move(l_pivot);
+
+        return l_pivotPosition;
+
+    }
+
+    /**
+     * @brief Partitions [p_begin, p_end) around the pivot *p_begin, items
+     * that are after the pivot go to its right and all others to its left.
+     *
+     * @details Used when the pivot is equal to the item before p_begin, then
+     * every item equal to the pivot ends up on the left and is never looked at
+     * again, which makes many repeated items linear.
+     *
+     * @return Where the pivot ended up.
+     *
+     */
+    template<typename T, typename C>
+    T* PartitionItemsAroundFirstKeepingEqualLeftUsingComparator(T* p_begin, T* p_end, C& p_isBefore)
+    {
+
+        T l_pivot(std::move(*p_begin));
+        T* l_first = p_begin;
+        T* l_last = p_end;
+
+        while(p_isBefore(l_pivot, *--l_last));
+
+        if(l_last + 1 == p_end)
+        {
+            while(l_first < l_last && !p_isBefore(l_pivot, *++l_first));
+        }
+        else
+        {
+            while(!p_isBefore(l_pivot, *++l_first));
+        }
+
+        while(l_first < l_last)
+        {
+            std::swap(*l_first, *l_last);
+            while(p_isBefore(l_pivot, *--l_last));
+            while(!p_isBefore(l_pivot, *++l_first));
+        }
+
+        *p_begin = std::move(*l_last);
+        *l_last = std::move(l_pivot);
+
+        return l_last;
+
+    }
+
+    /**
+     * @brief Sorts [p_begin, p_end), the loop of @ref SortArrayUsingComparator.
+     *
+     * @details A pattern-defeating quicksort, see "Pattern-defeating
+     * Quicksort" by Orson Peters. On top of an introsort it:
+     * - Checks whether a partition needed no swaps and then tries to finish
+     * both sides by insertion, which makes sorted and almost sorted ranges
+     * linear.
+     * - Puts items equal to a pivot that was already used on one side and
+     * skips them, which makes ranges of few distinct items linear.
+     * - Swaps a few items around when a partition is too unbalanced, to break
+     * up patterns, and only falls back to a heapsort after p_badAllowed such
+     * partitions.
+     *
+     * @tparam WithoutBranches Whether to partition in blocks, see
+     * @ref PartitionItemsAroundFirstByBlocksUsingComparator.
+     * @param p_isLeftmost False if there is an item right before p_begin that
+     * is not after any item in the range.
+     *
+     */
+    template<bool WithoutBranches, typename T, typename C>
+    void SortItemsUsingComparator(
+        T* p_begin, T* p_end, C& p_isBefore,
+        Size p_badAllowed, bool p_isLeftmost
+    )
+    {
+
+        while(true)
+        {
+            Size l_size = (Size)(p_end - p_begin);
+
+            if(l_size <= g_ARRAY_INSERTION_SORT_THRESHOLD)
+            {
+                if(p_isLeftmost)
+                {
+                    SortItemsByInsertionUsingComparator<false>(p_begin, p_end, p_isBefore);
+                }
+                else
+                {
+                    SortItemsByInsertionUsingComparator<true>(p_begin, p_end, p_isBefore);
+                }
+                return;
+            }
+
+            //The pivot goes to p_begin, the median of 3 leaves an item that is
+            //not before it at the end, which guards the partition.
+            Size l_half = l_size / 2;
+            if(l_size > g_ARRAY_NINTHER_THRESHOLD)
+            {
+                SortThreeItemsUsingComparator(p_begin, p_begin + l_half, p_end - 1, p_isBefore);
+                SortThreeItemsUsingComparator(p_begin + 1, p_begin + (l_half - 1), p_end - 2, p_isBefore);
+                SortThreeItemsUsingComparator(p_begin + 2, p_begin + (l_half + 1), p_end - 3, p_isBefore);
+                SortThreeItemsUsingComparator(
+                    p_begin + (l_half - 1), p_begin + l_half, p_begin + (l_half + 1), p_isBefore
+                );
+                std::swap(*p_begin, p_begin[l_half]);
+            }
+            else
+            {
+                SortThreeItemsUsingComparator(p_begin + l_half, p_begin, p_end - 1, p_isBefore);
+            }
+
+            //The pivot is equal to the item before this range, which was a
+            //pivot itself, so nothing in this range is before it.
+            if(!p_isLeftmost && !p_isBefore(*(p_begin - 1), *p_begin))
+            {
+                p_begin = PartitionItemsAroundFirstKeepingEqualLeftUsingComparator(
+                    p_begin, p_end, p_isBefore
+                ) + 1;
+                continue;
+            }
+
+            bool l_wasPartitioned;
+            T* l_pivot;
+            if constexpr(WithoutBranches)
+            {
+                l_pivot = PartitionItemsAroundFirstByBlocksUsingComparator(
+                    p_begin, p_end, p_isBefore, l_wasPartitioned
+                );
+            }
+            else
+            {
+                l_pivot = PartitionItemsAroundFirstUsingComparator(
+                    p_begin, p_end, p_isBefore, l_wasPartitioned
+                );
+            }
+
+            Size l_leftSize = (Size)(l_pivot - p_begin);
+            Size l_rightSize = (Size)(p_end - (l_pivot + 1));
+
+            if(l_leftSize < l_size / 8 || l_rightSize < l_size / 8)
+            {
+                if(--p_badAllowed == 0)
+                {
+                    SortItemsByHeapUsingComparator(p_begin, p_end, p_isBefore);
+                    return;
+                }
+
+                if(l_leftSize >= g_ARRAY_INSERTION_SORT_THRESHOLD)
+                {
+                    Size l_quarter = l_leftSize / 4;
+                    std::swap(*p_begin, p_begin[l_quarter]);
+                    std::swap(*(l_pivot - 1), *(l_pivot - l_quarter));
+                    if(l_leftSize > g_ARRAY_NINTHER_THRESHOLD)
+                    {
+                        std::swap(p_begin[1], p_begin[l_quarter + 1]);
+                        std::swap(p_begin[2], p_begin[l_quarter + 2]);
+                        std::swap(*(l_pivot - 2), *(l_pivot - (l_quarter + 1)));
+                        std::swap(*(l_pivot - 3), *(l_pivot - (l_quarter + 2)));
+                    }
+                }
+                if(l_rightSize >= g_ARRAY_INSERTION_SORT_THRESHOLD)
+                {
+                    Size l_quarter = l_rightSize / 4;
+                    std::swap(l_pivot[1], l_pivot[1 + l_quarter]);
+                    std::swap(*(p_end - 1), *(p_end - l_quarter));
+                    if(l_rightSize > g_ARRAY_NINTHER_THRESHOLD)
+                    {
+                        std::swap(l_pivot[2], l_pivot[2 + l_quarter]);
+                        std::swap(l_pivot[3], l_pivot[3 + l_quarter]);
+                        std::swap(*(p_end - 2), *(p_end - (1 + l_quarter)));
+                        std::swap(*(p_end - 3), *(p_end - (2 + l_quarter)));
+                    }
+                }
+            }
+            else if(
+                l_wasPartitioned &&
+                SortItemsByInsertionUsingComparatorUpToLimit(p_begin, l_pivot, p_isBefore) &&
+                SortItemsByInsertionUsingComparatorUpToLimit(l_pivot + 1, p_end, p_isBefore)
+            )
+            {
+                return;
+            }
+
+            //The left side is recursed into and the right side looped over.
+            SortItemsUsingComparator<WithoutBranches>(
+                p_begin, l_pivot, p_isBefore, p_badAllowed, p_isLeftmost
+            );
+            p_begin = l_pivot + 1;
+            p_isLeftmost = false;
+        }
+
+    }
+
+    /**
+     * @brief Sorts p_array so that no item is before the item preceding it,
+     * as told by p_isBefore.
+     *
+     * @details A pattern-defeating quicksort, see @ref SortItemsUsingComparator.
+     * Items are moved with std::move and std::swap. Items that are not
+     * before each other can end up in any order, use
+     * @ref StableSortArrayUsingComparatorAndAllocatorAndDeallocator to keep
+     * them in the order they were in.
+     *
+     * @tparam C Anything that can be called with two const T& and returns
+     * bool, it must be a strict weak ordering like <.
+     *
+     * @param p_array The array to sort.
+     * @param p_isBefore Returns true if its first argument goes before its
+     * second.
+     *
+     * **p_array.m_Buffer, p_array.m_Size and p_array.m_Capacity** are not
+     * mutated in any way.
+     *
+     * @time O(n log n) in the worst case, O(n) for sorted, reversed and
+     * mostly equal arrays. n being p_array.m_Size.
+     *
+     */
+    template<typename T, typename C>
+    void SortArrayUsingComparator(Array<T>& p_array, C&& p_isBefore)
+    {
+
+        LogDebugLine("Sorting array " << p_array);
+
+        if(p_array.m_Size < 2)
+        {
+            LogDebugLine("Nothing to sort, returning.");
+            return;
+        }
+
+        //The log of the size, that many bad partitions are allowed.
+        Size l_badAllowed = 0;
+        for(Size l_size = p_array.m_Size; l_size > 0; l_size >>= 1)
+        {
+            ++l_badAllowed;
+        }
+
+        SortItemsUsingComparator<g_ARRAY_SORT_WITHOUT_BRANCHES<T>>(
+            p_array.m_Buffer, p_array.m_Buffer + p_array.m_Size, p_isBefore,
+            l_badAllowed, true
+        );
+
+        LogDebugLine("Sorted array: " << p_array);
+
+    }
+    /**
+     * @brief Sorts p_array using <.
+     *
+     */
+    template<typename T>
+    inline void SortArray(Array<T>& p_array)
+    {
+        LogDebugLine("Using < for SortArrayUsingComparator");
+        SortArrayUsingComparator(
+            p_array,
+            [](const T& p_left, const T& p_right) { return p_left < p_right; }
+        );
+    }
+
+    /**
+     * @brief Reverses the items in [p_begin, p_end).
+     *
+     */
+    template<typename T>
+    inline void ReverseItems(T* p_begin, T* p_end)
+    {
+        while(p_begin < p_end)
+        {
+            --p_end;
+            std::swap(*p_begin, *p_end);
+            ++p_begin;
+        }
+    }
+
+    /**
+     * @brief Merges the sorted [p_begin, p_middle) and [p_middle, p_end)
+     * without extra memory, items that are not before each other keep their
+     * order.
+     *
+     * @details Splits both ranges so that the right part of the left one and
+     * the left part of the right one can be rotated past each other, then
+     * merges both halves the same way. See "Stable Minimum Storage Merging by
+     * Symmetric Comparisons" by Kim and Kutzner.
+     *
+     * @time O(n log n) moves and O(n) comparisons.
+     *
+     */
+    template<typename T, typename C>
+    void MergeItemsInPlaceUsingComparator(T* p_begin, T* p_middle, T* p_end, C& p_isBefore)
+    {
+
+        if(p_begin == p_middle || p_middle == p_end)
+        {
+            return;
+        }
+        if(p_end - p_begin == 2)
+        {
+            if(p_isBefore(*p_middle, *p_begin))
+            {
+                std::swap(*p_begin, *p_middle);
+            }
+            return;
+        }
+
+        T* l_leftCut;
+        T* l_rightCut;
+        if(p_middle - p_begin > p_end - p_middle)
+        {
+            //The first item of the right range that is not before the cut.
+            l_leftCut = p_begin + (p_middle - p_begin) / 2;
+            T* l_low = p_middle;
+            T* l_high = p_end;
+            while(l_low < l_high)
+            {
+                T* l_probe = l_low + (l_high - l_low) / 2;
+                if(p_isBefore(*l_probe, *l_leftCut))
+                {
+                    l_low = l_probe + 1;
+                }
+                else
+                {
+                    l_high = l_probe;
+                }
+            }
+            l_rightCut = l_low;
+        }
+        else
+        {
+            //The first item of the left range that is after the cut.
+            l_rightCut = p_middle + (p_end - p_middle) / 2;
+            T* l_low = p_begin;
+            T* l_high = p_middle;
+            while(l_low < l_high)
+            {
+                T* l_probe = l_low + (l_high - l_low) / 2;
+                if(p_isBefore(*l_rightCut, *l_probe))
+                {
+                    l_high = l_probe;
+                }
+                else
+                {
+                    l_low = l_probe + 1;
+                }
+            }
+            l_leftCut = l_low;
+        }
+
+        //Rotate [l_leftCut, p_middle) past [p_middle, l_rightCut).
+        ReverseItems(l_leftCut, p_middle);
+        ReverseItems(p_middle, l_rightCut);
+        ReverseItems(l_leftCut, l_rightCut);
+        T* l_newMiddle = l_leftCut + (l_rightCut - p_middle);
+
+        MergeItemsInPlaceUsingComparator(p_begin, l_leftCut, l_newMiddle, p_isBefore);
+        MergeItemsInPlaceUsingComparator(l_newMiddle, l_rightCut, p_end, p_isBefore);
+
+    }
+
+    /**
+     * @brief Merges the sorted [p_begin, p_middle) and [p_middle, p_end),
+     * items that are not before each other keep their order.
+     *
+     * @details The left range is moved into p_buffer, which must have room
+     * for p_middle - p_begin items that are not constructed, and then merged
+     * back with the right range. Items in p_buffer are destroyed before
+     * returning.
+     *
+     * @time O(n).
+     *
+     */
+    template<typename T, typename C>
+    void MergeItemsUsingComparatorAndBuffer(
+        T* p_begin, T* p_middle, T* p_end, C& p_isBefore,
+        T* p_buffer
+    )
+    {
+
+        Size l_leftSize = (Size)(p_middle - p_begin);
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            memcpy((void*)p_buffer, (const void*)p_begin, sizeof(T) * l_leftSize);
+        }
+        else
+        {
+            for(Size i = 0; i < l_leftSize; ++i)
+            {
+                new (p_buffer + i) T(std::move(p_begin[i]));
+            }
+        }
+
+        T* l_left = p_buffer;
+        T* l_leftEnd = p_buffer + l_leftSize;
+        T* l_right = p_middle;
+        T* l_out = p_begin;
+        while(l_left != l_leftEnd && l_right != p_end)
+        {
+            if(p_isBefore(*l_right, *l_left))
+            {
+                *l_out = std::move(*l_right);
+                ++l_right;
+            }
+            else
+            {
+                *l_out = std::move(*l_left);
+                ++l_left;
+            }
+            ++l_out;
+        }
+        //Whatever is left of the right range is already in place.
+        while(l_left != l_leftEnd)
+        {
+            *l_out = std::move(*l_left);
+            ++l_left;
+            ++l_out;
+        }
+
+        if constexpr(!std::is_trivially_destructible_v<T>)
+        {
+            for(Size i = 0; i < l_leftSize; ++i)
+            {
+                p_buffer[i].~T();
+            }
+        }
+
+    }
+
+    /**
+     * @brief Sorts [p_begin, p_end) by merging, items that are not before
+     * each other keep their order.
+     *
+     * @details p_buffer is used by @ref MergeItemsUsingComparatorAndBuffer
+     * and must have room for half of the items rounded up. If p_buffer is null
+     * the halves are merged with @ref MergeItemsInPlaceUsingComparator.
+     *
+     */
+    template<typename T, typename C>
+    void StableSortItemsUsingComparatorAndBuffer(
+        T* p_begin, T* p_end, C& p_isBefore,
+        T* p_buffer
+    )
+    {
+
+        if((Size)(p_end - p_begin) <= g_ARRAY_INSERTION_SORT_THRESHOLD)
+        {
+            SortItemsByInsertionUsingComparator<false>(p_begin, p_end, p_isBefore);
+            return;
+        }
+
+        T* l_middle = p_begin + (p_end - p_begin + 1) / 2;
+        StableSortItemsUsingComparatorAndBuffer(p_begin, l_middle, p_isBefore, p_buffer);
+        StableSortItemsUsingComparatorAndBuffer(l_middle, p_end, p_isBefore, p_buffer);
+
+        //Already in order, common for sorted and partially sorted input.
+        if(!p_isBefore(*l_middle, *(l_middle - 1)))
+        {
+            return;
+        }
+
+        if(p_buffer != nullptr)
+        {
+            MergeItemsUsingComparatorAndBuffer(p_begin, l_middle, p_end, p_isBefore, p_buffer);
+        }
+        else
+        {
+            MergeItemsInPlaceUsingComparator(p_begin, l_middle, p_end, p_isBefore);
+        }
+
+    }
+
+    /**
+     * @brief Sorts p_array so that no item is before the item preceding it,
+     * as told by p_isBefore, items that are not before each other keep the
+     * order they were in.
+     *
+     * @details A merge sort, runs of up to
+     * @ref g_ARRAY_INSERTION_SORT_THRESHOLD items are sorted by insertion and
+     * then merged. Merging needs scratch memory for half of the items, which
+     * is allocated with p_allocate and deallocated with p_deallocate before
+     * returning. Pass an arena or stack allocator to avoid the heap.
+     *
+     * @tparam C See @ref SortArrayUsingComparator.
+     *
+     * @param p_array The array to sort.
+     * @param p_isBefore Returns true if its first argument goes before its
+     * second.
+     * @param p_allocate The allocator used for the scratch memory.
+     * @param p_deallocate The deallocator used for the scratch memory.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * **p_array.m_Buffer, p_array.m_Size and p_array.m_Capacity** are not
+     * mutated in any way.
+     *
+     * **If allocation of the scratch memory fails** p_alloc_error is called and
+     * the array is then sorted by merging in place, so the result is the same.
+     *
+     * @time O(n log n), O(n) for a sorted array. O(n log^2 n) if allocation
+     * fails. n being p_array.m_Size.
+     *
+     */
+    template<typename T, typename C>
+    void StableSortArrayUsingComparatorAndAllocatorAndDeallocator(
+        Array<T>& p_array,
+        C&& p_isBefore,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Stable sorting array " << p_array);
+
+        if(p_array.m_Size < 2)
+        {
+            LogDebugLine("Nothing to sort, returning.");
+            return;
+        }
+
+        T* l_buffer = nullptr;
+        if(p_array.m_Size > g_ARRAY_INSERTION_SORT_THRESHOLD)
+        {
+            l_buffer = (T*)p_allocate(sizeof(T) * ((p_array.m_Size + 1) / 2));
+            if(l_buffer == nullptr)
+            {
+                LogDebugLine("Allocation of the scratch memory failed, merging "
+                "in place.");
+                if(p_alloc_error != nullptr)
+                {
+                    p_alloc_error(p_alloc_error_data);
+                }
+            }
+        }
+
+        StableSortItemsUsingComparatorAndBuffer(
+            p_array.m_Buffer, p_array.m_Buffer + p_array.m_Size, p_isBefore,
+            l_buffer
+        );
+
+        if(l_buffer != nullptr)
+        {
+            p_deallocate(l_buffer);
+        }
+
+        LogDebugLine("Sorted array: " << p_array);
+
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data.
+     *
+     */
+    template<typename T, typename C>
+    inline void StableSortArrayUsingComparator(Array<T>& p_array, C&& p_isBefore)
+    {
+        LogDebugLine("Using defaults for StableSortArrayUsingComparatorAndAllocatorAndDeallocator");
+        StableSortArrayUsingComparatorAndAllocatorAndDeallocator(
+            p_array, p_isBefore,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data, sorts using <.
+     *
+     */
+    template<typename T>
+    inline void StableSortArray(Array<T>& p_array)
+    {
+        LogDebugLine("Using defaults and < for StableSortArrayUsingComparatorAndAllocatorAndDeallocator");
+        StableSortArrayUsingComparatorAndAllocatorAndDeallocator(
+            p_array,
+            [](const T& p_left, const T& p_right) { return p_left < p_right; },
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Sorts p_array by the integer key p_getKey returns for each item,
+     * smallest key first, items with equal keys keep the order they were in.
+     *
+     * @details A least significant digit radix sort on bytes. The histograms
+     * of every byte of the keys are counted in one pass over the array and
+     * bytes that are the same for every key are skipped, so narrow keys in a
+     * wide type cost only as many passes as they need. Each pass moves every
+     * item between p_array.m_Buffer and a scratch buffer of p_array.m_Size
+     * items, which is allocated with p_allocate and deallocated with
+     * p_deallocate before returning.
+     *
+     * Arrays with fewer than @ref g_ARRAY_RADIX_SORT_THRESHOLD items are
+     * sorted with @ref StableSortItemsUsingComparatorAndBuffer instead, comparing
+     * keys, and nothing is allocated.
+     *
+     * @tparam T Must be trivially copyable, the items are copied around as
+     * bytes.
+     * @tparam K Anything that can be called with a const T& and returns a
+     * signed or unsigned integer that is not bool. It is called for each item
+     * once per pass, so it should be cheap.
+     *
+     * @param p_array The array to sort.
+     * @param p_getKey Returns the key of an item.
+     * @param p_allocate The allocator used for the scratch buffer.
+     * @param p_deallocate The deallocator used for the scratch buffer.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * **p_array.m_Buffer, p_array.m_Size and p_array.m_Capacity** are not
+     * mutated in any way.
+     *
+     * **If allocation of the scratch buffer fails** p_alloc_error is called and
+     * the array is then sorted by merging in place, so the result is the same.
+     *
+     * @time O(n * k), n being p_array.m_Size and k being the number of bytes
+     * in which the keys differ.
+     *
+     */
+    template<typename T, typename K>
+    void SortArrayByIntegerKeyUsingAllocatorAndDeallocator(
+        Array<T>& p_array,
+        K&& p_getKey,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        using Key = std::decay_t<decltype(p_getKey(*p_array.m_Buffer))>;
+        static_assert(
+            std::is_integral_v<Key> && !std::is_same_v<Key, bool>,
+            "The key must be an integer."
+        );
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+        using Bits = std::make_unsigned_t<Key>;
+        constexpr Size l_byteCount = sizeof(Key);
+        //Flipping the sign bit orders signed keys the same as their bits.
+        constexpr Bits l_flip = std::is_signed_v<Key> ? (Bits)((Bits)1 << (l_byteCount * 8 - 1)) : 0;
+
+        LogDebugLine("Radix sorting array " << p_array);
+
+        if(p_array.m_Size < 2)
+        {
+            LogDebugLine("Nothing to sort, returning.");
+            return;
+        }
+
+        auto l_isBefore = [&p_getKey](const T& p_left, const T& p_right)
+        {
+            return p_getKey(p_left) < p_getKey(p_right);
+        };
+
+        if(p_array.m_Size < g_ARRAY_RADIX_SORT_THRESHOLD)
+        {
+            LogDebugLine("Array is small, sorting by comparison.");
+            StableSortItemsUsingComparatorAndBuffer(
+                p_array.m_Buffer, p_array.m_Buffer + p_array.m_Size, l_isBefore,
+                (T*)nullptr
+            );
+            return;
+        }
+
+        T* l_scratch = nullptr;
+        if(p_array.m_Size <= SIZE_MAX / sizeof(T))
+        {
+            l_scratch = (T*)p_allocate(sizeof(T) * p_array.m_Size);
+        }
+        if(l_scratch == nullptr)
+        {
+            LogDebugLine("Allocation of the scratch buffer failed, sorting by "
+            "comparison.");
+            if(p_alloc_error != nullptr)
+            {
+                p_alloc_error(p_alloc_error_data);
+            }
+            StableSortItemsUsingComparatorAndBuffer(
+                p_array.m_Buffer, p_array.m_Buffer + p_array.m_Size, l_isBefore,
+                (T*)nullptr
+            );
+            return;
+        }
+
+        Size l_counts[l_byteCount][256] = {};
+        for(Size i = 0; i < p_array.m_Size; ++i)
+        {
+            Bits l_bits = (Bits)p_getKey(p_array.m_Buffer[i]) ^ l_flip;
+            for(Size n = 0; n < l_byteCount; ++n)
+            {
+                ++l_counts[n][(Byte)(l_bits >> (n * 8))];
+            }
+        }
+
+        T* l_from = p_array.m_Buffer;
+        T* l_to = l_scratch;
+        for(Size n = 0; n < l_byteCount; ++n)
+        {
+            Size* l_count = l_counts[n];
+
+            //Every key has the same byte here, the pass would change nothing.
+            Byte l_anyByte = (Byte)(((Bits)p_getKey(*l_from) ^ l_flip) >> (n * 8));
+            if(l_count[l_anyByte] == p_array.m_Size)
+            {
+                continue;
+            }
+
+            //Counts into where each byte's items start.
+            Size l_start = 0;
+            for(Size b = 0; b < 256; ++b)
+            {
+                Size l_itemsOfByte = l_count[b];
+                l_count[b] = l_start;
+                l_start += l_itemsOfByte;
+            }
+
+            for(Size i = 0; i < p_array.m_Size; ++i)
+            {
+                Byte l_byte = (Byte)(((Bits)p_getKey(l_from[i]) ^ l_flip) >> (n * 8));
+                memcpy((void*)(l_to + l_count[l_byte]), (const void*)(l_from + i), sizeof(T));
+                ++l_count[l_byte];
+            }
+
+            T* l_swap = l_from;
+            l_from = l_to;
+            l_to = l_swap;
+        }
+
+        if(l_from != p_array.m_Buffer)
+        {
+            memcpy((void*)p_array.m_Buffer, (const void*)l_from, sizeof(T) * p_array.m_Size);
+        }
+
+        p_deallocate(l_scratch);
+
+        LogDebugLine("Sorted array: " << p_array);
+
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data.
+     *
+     */
+    template<typename T, typename K>
+    inline void SortArrayByIntegerKey(Array<T>& p_array, K&& p_getKey)
+    {
+        LogDebugLine("Using defaults for SortArrayByIntegerKeyUsingAllocatorAndDeallocator");
+        SortArrayByIntegerKeyUsingAllocatorAndDeallocator(
+            p_array, p_getKey,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+    /**
+     * @brief Sorts an array of integers, smallest first, see
+     * @ref SortArrayByIntegerKeyUsingAllocatorAndDeallocator.
+     *
+     */
+    template<typename T>
+    inline void SortArrayOfIntegersUsingAllocatorAndDeallocator(
+        Array<T>& p_array,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+        SortArrayByIntegerKeyUsingAllocatorAndDeallocator(
+            p_array,
+            [](const T& p_item) { return p_item; },
+            p_allocate, p_deallocate,
+            p_alloc_error, p_alloc_error_data
+        );
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data.
+     *
+     */
+    template<typename T>
+    inline void SortArrayOfIntegers(Array<T>& p_array)
+    {
+        LogDebugLine("Using defaults for SortArrayOfIntegersUsingAllocatorAndDeallocator");
+        SortArrayOfIntegersUsingAllocatorAndDeallocator(
+            p_array,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Changes the array's capacity by reallocating its buffer.
+     * 
+     * @details Reallocates p_array's buffer to be the size of p_new_capacity.
+     * After reallocation is successful p_array.m_Capacity is set to p_new_capacity.
+     * If p_new_capacity > p_array.m_Size, p_array.m_Size is set to p_new_capacity.
+     * 
+     * If p_new_capacity is 0 the array is destroyed (m_Buffer = nullptr, m_Size
+     * and m_Capacity = 0).
+     * 
+     * If p_new_capacity == p_array.m_Capacity the function does nothing and
+     * returned, p_array is not mutated.
+     * 
+     * If reallocation fails p_realloc_error is called and the function returns. 
+     * The array is not mutated.
+     * 
+     * If sizeof(T) * p_new_capacity overflows, the function returns without
+     * mutating the array or calling p_reallocate. 
+     *
+     * @param p_array The array who's capacity will be changed. 
+     * @param p_new_capacity The new capacity.
+     * @param p_reallocate The reallocator that will be used.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     * 
+     */
+    template<typename T>
+    void ResizeArrayToCapacityUsingReallocator(
+        Array<T>& p_array,
+        const Size& p_new_capacity,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Changing the capacity of array " << p_array << " to "
+        << p_new_capacity);
+
+        if(p_new_capacity == p_array.m_Capacity)
+        {
+            LogDebugLine("p_new_capacity is the same as p_array.m_Capacity");
+            return;
+        }
+
+        if(p_new_capacity == 0)
+        {
+            LogDebugLine("The new capcity is 0, destroying array and returning");
+            p_reallocate(p_array.m_Buffer, 0);
+
+            p_array.m_Buffer = nullptr;
+            p_array.m_Size = 0;
+            p_array.m_Capacity = 0;
+            
+            return;
+        }
+
+        LogDebugLine("Reallocating the buffer.");
+        //Checks for overflows occurring during sizeof(T) * p_new_capacity.
+        if(p_new_capacity > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine("Detected that sizeof(T) = " << sizeof(T) << " * "
+            "p_new_capacity = " << p_new_capacity << " would overflow! Returning."
+            );
+            return;
+        }
+        T* l_newBuffer = (T*)p_reallocate(p_array.m_Buffer, sizeof(T) * p_new_capacity);
+        if(l_newBuffer == nullptr)
+        {
+            LogDebugLine("Reallocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            LogDebugLine("Returning now.");
+
+            return;
+        }
+       
+        LogDebugLine("Reallocation was successful, new buffer is " << 
+        (void*)l_newBuffer << ", configuring the array aproproately");
+
+        p_array.m_Buffer = l_newBuffer;
+        p_array.m_Capacity = p_new_capacity;
+        if(p_array.m_Size > p_array.m_Capacity)
+        {
+            LogDebugLine("The array's size is greater than the arrays capacity, "
+            "setting the arrays size to its capacity.");
+            p_array.m_Size = p_array.m_Capacity;
+        }
+
+        LogDebugLine("Capacity change has been successfully completed");
+
+    }
+    template<typename T>
+    inline void ResizeArrayToCapacity(
+        Array<T>& p_array,
+        const Size& p_new_capacity
+    )
+    {
+        LogDebugLine("Using defaults for ResizeArrayToCapacityUsingReallocator");
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, p_new_capacity,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Changes the array's capacity by reallocating its buffer, keeping
+     * it aligned to p_alignment.
+     *
+     * @details The same as @ref ResizeArrayToCapacityUsingReallocator, for
+     * arrays created with
+     * @ref CreateArrayAtOfCapacityAndAlignmentUsingAllocator. The new buffer
+     * is a multiple of p_alignment, or of alignof(T) if that is bigger. Only
+     * the first p_array.m_Size items are kept, so if the reallocator has to
+     * copy it copies no more than that.
+     *
+     * If p_alignment is not a power of two the function returns without
+     * mutating the array or calling p_reallocate.
+     *
+     * @param p_array The array who's capacity will be changed.
+     * @param p_new_capacity The new capacity.
+     * @param p_alignment What the location of the buffer must be a multiple
+     * of, should be the one the array was created with.
+     * @param p_reallocate The aligned reallocator that will be used.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     */
+    template<typename T>
+    void ResizeArrayToCapacityAndAlignmentUsingReallocator(
+        Array<T>& p_array,
+        const Size& p_new_capacity,
+        const Size& p_alignment,
+        AlignedReallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Changing the capacity of array " << p_array << " to "
+        << p_new_capacity << " aligned to " << p_alignment);
+
+        if(p_new_capacity == p_array.m_Capacity)
+        {
+            LogDebugLine("p_new_capacity is the same as p_array.m_Capacity");
+            return;
+        }
+
+        if(p_alignment == 0 || (p_alignment & (p_alignment - 1)) != 0)
+        {
+            LogDebugLine("The alignment is not a power of two, returning.");
+            return;
+        }
+        Size l_alignment = p_alignment < alignof(T) ? alignof(T) : p_alignment;
+
+        if(p_new_capacity == 0)
+        {
+            LogDebugLine("The new capcity is 0, destroying array and returning");
+            p_reallocate(p_array.m_Buffer, sizeof(T) * p_array.m_Size, l_alignment, 0);
+
+            p_array.m_Buffer = nullptr;
+            p_array.m_Size = 0;
+            p_array.m_Capacity = 0;
+
+            return;
+        }
+
+        //Checks for overflows occurring during sizeof(T) * p_new_capacity.
+        if(p_new_capacity > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine("Detected that sizeof(T) = " << sizeof(T) << " * "
+            "p_new_capacity = " << p_new_capacity << " would overflow! Returning."
+            );
+            return;
+        }
+        T* l_newBuffer = (T*)p_reallocate(
+            p_array.m_Buffer,
+            sizeof(T) * p_array.m_Size,
+            l_alignment,
+            sizeof(T) * p_new_capacity
+        );
+        if(l_newBuffer == nullptr)
+        {
+            LogDebugLine("Reallocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            LogDebugLine("Returning now.");
+
+            return;
+        }
+
+        LogDebugLine("Reallocation was successful, new buffer is " <<
+        (void*)l_newBuffer << ", configuring the array aproproately");
+
+        p_array.m_Buffer = l_newBuffer;
+        p_array.m_Capacity = p_new_capacity;
+        if(p_array.m_Size > p_array.m_Capacity)
+        {
+            LogDebugLine("The array's size is greater than the arrays capacity, "
+            "setting the arrays size to its capacity.");
+            p_array.m_Size = p_array.m_Capacity;
+        }
+
+    }
+    template<typename T>
+    inline void ResizeArrayToCapacityAndAlignment(
+        Array<T>& p_array,
+        const Size& p_new_capacity,
+        const Size& p_alignment
+    )
+    {
+        LogDebugLine("Using defaults for ResizeArrayToCapacityAndAlignmentUsingReallocator");
+        ResizeArrayToCapacityAndAlignmentUsingReallocator(
+            p_array, p_new_capacity, p_alignment,
+            Library::g_DEFAULT_ALIGNED_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Increases p_array's capacity by p_amount.
+     * 
+     * @details Reallocates p_array.m_Buffer using p_reallocate so that the
+     * capacity of the buffer is p_array.m_Capacity + p_amount. If
+     * p_array.m_Capacity + p_amount overflows the function returns without
+     * mutating p_array.
+     * 
+     * If the array is empty then a new buffer is allocated for it.
+     * 
+     * If reallocation fails, p_realloc_error is called and the function returns.
+     * p_array is not mutated. 
+     * 
+     * If p_amount is 0 the function returns.
+     * 
+     * @param p_array The array who's capacity will be increased. 
+     * @param p_amount By how much the capacity will be increased.
+     * @param p_reallocate The reallocator that will be used to reallocated the buffer.
+     * @param p_realloc_error The callback that will be called on failed reallocation.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     * 
+     */
+    template<typename T>
+    void IncreaseArrayCapacityByAmountUsingReallocator(
+        Array<T>& p_array,
+        const Size& p_amount,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Increasing the capacity of array " << p_array << 
+        " by " << p_amount);
+
+        Size l_result = p_array.m_Capacity + p_amount;
+        LogDebugLine("The new capacity has been calculated it is " << l_result);
+
+        //This indicates an overflow
+        if(l_result < p_array.m_Capacity)
+        {
+            LogDebugLine("An overflow has been detected, returning");
+            return;
+        }
+
+        ResizeArrayToCapacityUsingReallocator(
+            p_array,
+            l_result,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T>
+    inline void IncreaseArrayCapacityByAmount(
+        Array<T>& p_array,
+        const Size& p_amount
+    )
+    {
+        LogDebugLine("Using defaults for IncreaseArrayCapacityByAmountUsingReallocator");
+        IncreaseArrayCapacityByAmountUsingReallocator(
+            p_array, p_amount,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+    
+    /**
+     * @brief Decreases p_array's capacity by p_amount.
+     * 
+     * @details Reallocates p_array.m_Buffer using p_reallocate so that the
+     * capacity of the buffer is p_array.m_Capacity - p_amount. If
+     * p_array.m_Capacity - p_amount overflows the function returns without
+     * mutating p_array. If the new capacity is smaller than p_array.m_Size then
+     * p_array.m_Size is set to p_array.m_Capacity.
+     *  
+     * If reallocation fails, p_realloc_error is called and the function returns.
+     * p_array is not mutated. 
+     * 
+     * If p_amount is 0 the function returns.
+     *
+     * If p_array.m_Capacity - p_amount == 0, p_array.m_Buffer is reallocated
+     * with a size of 0 and it is set to null, p_array.m_Size and
+     * p_array.m_Capacity are set to 0.
+     *  
+     * @param p_array The array who's capacity will be increased. 
+     * @param p_amount By how much the capacity will be increased.
+     * @param p_reallocate The reallocator that will be used to reallocated the buffer.
+     * @param p_realloc_error The callback that will be called on failed reallocation.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     * 
+     */
+    template<typename T>
+    void DecreaseArrayCapacityByAmountUsingReallocator(
+        Array<T>& p_array,
+        const Size& p_amount,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Decreaseing the capacity of array " << p_array 
+        << " by " << p_amount);
+
+        Size l_result = p_array.m_Capacity - p_amount;
+        LogDebugLine("The needed capacity has been calculated, it is " << l_result);
+
+        //This indicates an overflow
+        if(l_result > p_array.m_Capacity)
+        {
+            LogDebugLine("An overflow has been detected, returning");
+            return;
+        }
+
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, l_result,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T>
+    inline void DecreaseArrayCapacityByAmount(
+        Array<T>& p_array,
+        const Size& p_amount
+    )
+    {
+        LogDebugLine("Using defaults for DecreaseArrayCapacityByAmountUsingReallocator");
+        DecreaseArrayCapacityByAmountUsingReallocator(
+            p_array, p_amount,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief How the capacity of an array grows when items are added to its
+     * end and it is full.
+     *
+     * @details Growing by a factor instead of by exactly the number of
+     * missing items means that adding n items one by one only reallocates
+     * O(log n) times, so each addition costs O(1) amortized.
+     *
+     * - OneAndAHalf: the capacity is multiplied by 1.5. Wastes at most a third
+     * of the buffer and lets the allocator reuse freed blocks for later growth.
+     * - Double: the capacity is multiplied by 2. Reallocates the least but
+     * wastes up to half of the buffer.
+     * - SizeClass: the capacity is multiplied by 1.5 and then rounded up so
+     * that the buffer's size in bytes is a size class, there being 4 size
+     * classes between each 2 powers of two (16, 20, 24, 28, 32, 40...).
+     * Allocators that round requests up to such classes, like most malloc
+     * implementations, then give out no memory that the array does not use.
+     *
+     */
+    enum class ArrayGrowthPolicy : Byte
+    {
+        OneAndAHalf,
+        Double,
+        SizeClass
+    };
+
+    /**
+     * @brief The growth policy used by the functions that do not take one.
+     *
+     */
+    constexpr ArrayGrowthPolicy g_DEFAULT_ARRAY_GROWTH_POLICY = ArrayGrowthPolicy::Double;
+    /**
+     * @brief The smallest capacity an array is grown to by
+     * @ref FindGrownCapacityOfArrayForSizeUsingGrowthPolicy.
+     *
+     * @details Without it an array with a capacity of 1 would take a number of
+     * reallocations to get to a useful size when growing by 1.5.
+     *
+     */
+    constexpr Size g_ARRAY_MINIMUM_GROWN_CAPACITY = 8;
+
+    /**
+     * @brief Finds the capacity p_array should be grown to for it to be able
+     * to hold p_size items, according to p_policy.
+     *
+     * @details If p_array.m_Capacity is already at least p_size, it is
+     * returned. Otherwise the capacity is grown by the factor of p_policy and
+     * if that is still not enough p_size is used instead. The result is never
+     * smaller than @ref g_ARRAY_MINIMUM_GROWN_CAPACITY.
+     *
+     * If growing would make sizeof(T) * capacity overflow the capacity is
+     * clamped to the largest one that does not. If even p_size does not fit
+     * then 0 is returned.
+     *
+     * @param p_array The array that is going to grow, only its capacity is
+     * looked at.
+     * @param p_size The number of items the array must be able to hold.
+     * @param p_policy How the capacity grows.
+     *
+     * @return The new capacity, or 0 if sizeof(T) * p_size overflows.
+     *
+     * @time O(1).
+     *
+     */
+    template<typename T>
+    Size FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(
+        const Array<T>& p_array,
+        const Size& p_size,
+        const ArrayGrowthPolicy& p_policy
+    )
+    {
+
+        const Size l_maximum = SIZE_MAX / sizeof(T);
+
+        if(p_size > l_maximum)
+        {
+            LogDebugLine("sizeof(T) * " << p_size << " overflows, returning 0.");
+            return 0;
+        }
+        if(p_size <= p_array.m_Capacity)
+        {
+            return p_array.m_Capacity;
         }
 
-        if(p_end.m_Size > p_array.m_Size)
+        const Size l_capacity = p_array.m_Capacity;
+        Size l_result;
+
+        if(p_policy == ArrayGrowthPolicy::Double)
         {
-            LogDebugLine("p_end.m_Size is bigger than p_array.m_Size, "
-            "returning false");
-            return false;
+            l_result = l_capacity > l_maximum / 2 ? l_maximum : l_capacity * 2;
+        }
+        else
+        {
+            l_result = l_capacity > l_maximum - l_capacity / 2 ?
+                l_maximum : l_capacity + l_capacity / 2;
         }
 
-        LogDebugLine("Starting main loop for check.");
+        if(l_result < p_size)
+        {
+            l_result = p_size;
+        }
+        if(l_result < g_ARRAY_MINIMUM_GROWN_CAPACITY)
+        {
+            l_result = l_maximum < g_ARRAY_MINIMUM_GROWN_CAPACITY ?
+                l_maximum : g_ARRAY_MINIMUM_GROWN_CAPACITY;
+        }
 
-        //There is a gurante that p_start.m_Size =< p_array.m_Size
-        for
-        (
-            Size i = p_array.m_Size - 1, n = p_end.m_Size;
-            n-- > 0;
-            --i
-        )
+        if(p_policy == ArrayGrowthPolicy::SizeClass)
         {
-            if(p_array[i] != p_end[n])
+            Size l_bytes = sizeof(T) * l_result;
+            Size l_classBytes;
+
+            if(l_bytes <= 16)
             {
-                LogDebugLine("Missmatch found on index " << i << " returning false");
-                return false;
+                l_classBytes = 16;
+            }
+            else
+            {
+                //Finds the biggest power of two less than l_bytes, a quarter
+                //of it is the distance between size classes after it.
+                Size l_power = l_bytes - 1;
+                for(Size i = 1; i < sizeof(Size) * 8; i *= 2)
+                {
+                    l_power |= l_power >> i;
+                }
+                l_power = (l_power >> 1) + 1;
+
+                Size l_step = l_power / 4;
+                l_classBytes = (l_bytes + (l_step - 1)) & ~(l_step - 1);
+            }
+
+            //If rounding up overflows the unrounded size is kept.
+            if(l_classBytes >= l_bytes)
+            {
+                l_result = l_classBytes / sizeof(T);
             }
         }
 
-        LogDebugLine("No missmatches found, returning true");
-        return true;
+        LogDebugLine("Grown capacity of array " << p_array << " for " << p_size
+        << " items is " << l_result);
 
-    }
+        return l_result;
 
+    }
 
     /**
-     * @brief Reverses p_array.
-     * 
-     * @details If the given array is empty the function returns.
-     * 
-     * @time O(n / 2), n being the nubmer of items in the array.
-     * 
-     * @param p_array The array to reverse.
-     * 
-     * 
+     * @brief Makes sure that p_array can hold at least p_capacity items
+     * without reallocating.
+     *
+     * @details If p_array.m_Capacity is less than p_capacity, the buffer is
+     * reallocated to exactly p_capacity items using
+     * @ref ResizeArrayToCapacityUsingReallocator, otherwise the function does
+     * nothing. Unlike resizing, reserving never shrinks the array or loses
+     * items.
+     *
+     * If reallocation fails, p_realloc_error is called and p_array is not
+     * mutated. If sizeof(T) * p_capacity overflows the function returns
+     * without mutating p_array.
+     *
+     * @param p_array The array to reserve capacity in.
+     * @param p_capacity The capacity p_array should at least have.
+     * @param p_reallocate The reallocator that will be used.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
      */
     template<typename T>
-    void ReverseArray(Array<T>& p_array)
+    void ReserveArrayCapacityUsingReallocator(
+        Array<T>& p_array,
+        const Size& p_capacity,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
     {
 
-        LogDebugLine("Reversing array " << p_array);
+        LogDebugLine("Reserving a capacity of " << p_capacity << " in array "
+        << p_array);
 
-        if(ArrayIsEmpty(p_array))
+        if(p_capacity <= p_array.m_Capacity)
         {
-            LogDebugLine("p_array is empty, returning.");
+            LogDebugLine("The array already has enough capacity, returning.");
             return;
         }
 
-        Size l_to = p_array.m_Size / 2;
-        LogDebugLine("The middle of the array is index " << l_to);
-
-        LogDebugLine("Begining to loop now.");
-        T l_temp;
-        //Have two indexes start from the begining of the array and the end of
-        //the array. Loop initil you reach the middle.
-        for(Size i = 0, n = p_array.m_Size; n-- > l_to; ++i)
-        {
-            l_temp = p_array[i];
-            p_array[i] = p_array[n];
-            p_array[n] = l_temp;
-        }
-
-        LogDebugLine("Loop finished, returning");
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, p_capacity,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
 
     }
+    template<typename T>
+    inline void ReserveArrayCapacity(
+        Array<T>& p_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for ReserveArrayCapacityUsingReallocator");
+        ReserveArrayCapacityUsingReallocator(
+            p_array, p_capacity,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
 
     /**
-     * @brief Changes the array's capacity by reallocating its buffer.
-     * 
-     * @details Reallocates p_array's buffer to be the size of p_new_capacity.
-     * After reallocation is successful p_array.m_Capacity is set to p_new_capacity.
-     * If p_new_capacity > p_array.m_Size, p_array.m_Size is set to p_new_capacity.
-     * 
-     * If p_new_capacity is 0 the array is destroyed (m_Buffer = nullptr, m_Size
-     * and m_Capacity = 0).
-     * 
-     * If p_new_capacity == p_array.m_Capacity the function does nothing and
-     * returned, p_array is not mutated.
-     * 
-     * If reallocation fails p_realloc_error is called and the function returns. 
-     * The array is not mutated.
-     * 
-     * If sizeof(T) * p_new_capacity overflows, the function returns without
-     * mutating the array or calling p_reallocate. 
+     * @brief Reallocates p_array's buffer so that its capacity is the same as
+     * its size.
      *
-     * @param p_array The array who's capacity will be changed. 
-     * @param p_new_capacity The new capacity.
+     * @details The counterpart to @ref DecreaseArrayCapacityByAmountUsingReallocator
+     * for when the amount is however much capacity is unused, meant for
+     * arrays that were grown by @ref AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy
+     * and will not grow anymore.
+     *
+     * If p_array.m_Size is 0 the buffer is freed and p_array becomes a null
+     * array. If p_array.m_Size is already p_array.m_Capacity nothing happens.
+     *
+     * If reallocation fails, p_realloc_error is called and p_array is not
+     * mutated.
+     *
+     * @param p_array The array to shrink.
      * @param p_reallocate The reallocator that will be used.
      * @param p_realloc_error The callback for a reallocation error.
      * @param p_realloc_error_data The data that will be passed to p_realloc_error.
-     * 
+     *
      */
     template<typename T>
-    void ResizeArrayToCapacityUsingReallocator(
+    void ShrinkArrayCapacityToSizeUsingReallocator(
         Array<T>& p_array,
-        const Size& p_new_capacity,
         Reallocator p_reallocate,
         Callback p_realloc_error, void* p_realloc_error_data
     )
     {
 
-        LogDebugLine("Changing the capacity of array " << p_array << " to "
-        << p_new_capacity);
-
-        if(p_new_capacity == p_array.m_Capacity)
-        {
-            LogDebugLine("p_new_capacity is the same as p_array.m_Capacity");
-            return;
-        }
-
-        if(p_new_capacity == 0)
-        {
-            LogDebugLine("The new capcity is 0, destroying array and returning");
-            p_reallocate(p_array.m_Buffer, 0);
-
-            p_array.m_Buffer = nullptr;
-            p_array.m_Size = 0;
-            p_array.m_Capacity = 0;
-            
-            return;
-        }
+        LogDebugLine("Shrinking the capacity of array " << p_array << " to "
+        "its size");
 
-        LogDebugLine("Reallocating the buffer.");
-        //Checks for overflows occurring during sizeof(T) * p_new_capacity.
-        if(p_new_capacity > SIZE_MAX / sizeof(T))
-        {
-            LogDebugLine("Detected that sizeof(T) = " << sizeof(T) << " * "
-            "p_new_capacity = " << p_new_capacity << " would overflow! Returning."
-            );
-            return;
-        }
-        T* l_newBuffer = (T*)p_reallocate(p_array.m_Buffer, sizeof(T) * p_new_capacity);
-        if(l_newBuffer == nullptr)
+        if(p_array.m_Buffer == nullptr)
         {
-            LogDebugLine("Reallocation failed.");
-            if(p_realloc_error != nullptr)
-            {
-                LogDebugLine("Realloc error is not null so calling it.");
-                p_realloc_error(p_realloc_error_data);
-            }
-            LogDebugLine("Returning now.");
-
+            LogDebugLine("The array is null, returning.");
             return;
         }
-       
-        LogDebugLine("Reallocation was successful, new buffer is " << 
-        (void*)l_newBuffer << ", configuring the array aproproately");
-
-        p_array.m_Buffer = l_newBuffer;
-        p_array.m_Capacity = p_new_capacity;
-        if(p_array.m_Size > p_array.m_Capacity)
-        {
-            LogDebugLine("The array's size is greater than the arrays capacity, "
-            "setting the arrays size to its capacity.");
-            p_array.m_Size = p_array.m_Capacity;
-        }
 
-        LogDebugLine("Capacity change has been successfully completed");
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, p_array.m_Size,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
 
     }
     template<typename T>
-    inline void ResizeArrayToCapacity(
-        Array<T>& p_array,
-        const Size& p_new_capacity
-    )
+    inline void ShrinkArrayCapacityToSize(Array<T>& p_array)
     {
-        LogDebugLine("Using defaults for ResizeArrayToCapacityUsingReallocator");
-        ResizeArrayToCapacityUsingReallocator(
-            p_array, p_new_capacity,
+        LogDebugLine("Using defaults for ShrinkArrayCapacityToSizeUsingReallocator");
+        ShrinkArrayCapacityToSizeUsingReallocator(
+            p_array,
             Library::g_DEFAULT_REALLOCATOR,
             Library::g_DEFAULT_REALLOC_ERROR,
             Library::g_DEFAULT_REALLOC_ERROR_DATA
@@ -1266,133 +4157,212 @@ namespace Library::DataStructures::Array
     }
 
     /**
-     * @brief Increases p_array's capacity by p_amount.
-     * 
-     * @details Reallocates p_array.m_Buffer using p_reallocate so that the
-     * capacity of the buffer is p_array.m_Capacity + p_amount. If
-     * p_array.m_Capacity + p_amount overflows the function returns without
-     * mutating p_array.
-     * 
-     * If the array is empty then a new buffer is allocated for it.
-     * 
-     * If reallocation fails, p_realloc_error is called and the function returns.
-     * p_array is not mutated. 
-     * 
-     * If p_amount is 0 the function returns.
-     * 
-     * @param p_array The array who's capacity will be increased. 
-     * @param p_amount By how much the capacity will be increased.
-     * @param p_reallocate The reallocator that will be used to reallocated the buffer.
-     * @param p_realloc_error The callback that will be called on failed reallocation.
+     * @brief Adds p_item after the last item of p_array, growing p_array
+     * according to p_policy if it is full.
+     *
+     * @details If p_array is full its capacity is grown to the one given by
+     * @ref FindGrownCapacityOfArrayForSizeUsingGrowthPolicy, then p_item is
+     * copied to index p_array.m_Size and p_array.m_Size is increased by 1.
+     * A null array gets a new buffer.
+     *
+     * If reallocation fails, p_realloc_error is called and the function
+     * returns without mutating p_array. If the grown capacity would overflow,
+     * the function returns without mutating p_array.
+     *
+     * @param p_item The item to add.
+     * @param p_array The array to add the item to.
+     * @param p_policy How p_array's capacity grows.
+     * @param p_reallocate The reallocator that will be used to grow p_array.
+     * @param p_realloc_error The callback for a reallocation error.
      * @param p_realloc_error_data The data that will be passed to p_realloc_error.
-     * 
+     *
+     * p_item may be an item of p_array, it is found again after growing.
+     *
+     * @time O(1) amortized, O(n) when p_array has to grow, n being
+     * p_array.m_Size.
+     *
      */
     template<typename T>
-    void IncreaseArrayCapacityByAmountUsingReallocator(
+    void AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+        const T& p_item,
         Array<T>& p_array,
-        const Size& p_amount,
+        const ArrayGrowthPolicy& p_policy,
         Reallocator p_reallocate,
         Callback p_realloc_error, void* p_realloc_error_data
     )
     {
 
-        LogDebugLine("Increasing the capacity of array " << p_array << 
-        " by " << p_amount);
+        LogDebugLine("Adding item to the end of array " << p_array);
 
-        Size l_result = p_array.m_Capacity + p_amount;
-        LogDebugLine("The new capacity has been calculated it is " << l_result);
+        const T* l_item = &p_item;
 
-        //This indicates an overflow
-        if(l_result < p_array.m_Capacity)
+        if(p_array.m_Size == p_array.m_Capacity)
         {
-            LogDebugLine("An overflow has been detected, returning");
-            return;
+            LogDebugLine("Array " << p_array << " is full, growing it.");
+
+            if(p_array.m_Size == SIZE_MAX)
+            {
+                LogDebugLine("The size of the array would overflow, returning.");
+                return;
+            }
+
+            Size l_newCapacity = FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(
+                p_array, p_array.m_Size + 1, p_policy
+            );
+            if(l_newCapacity == 0)
+            {
+                LogDebugLine("The new capacity overflows, returning.");
+                return;
+            }
+
+            //Pointers are compared as integers since p_item is usually not in
+            //the buffer, and comparing unrelated pointers is unspecified.
+            bool l_itemIsInArray =
+                (uintptr_t)l_item >= (uintptr_t)p_array.m_Buffer &&
+                (uintptr_t)l_item < (uintptr_t)(p_array.m_Buffer + p_array.m_Size);
+            Size l_itemIndex = l_itemIsInArray ? l_item - p_array.m_Buffer : 0;
+
+            ResizeArrayToCapacityUsingReallocator(
+                p_array, l_newCapacity,
+                p_reallocate, p_realloc_error, p_realloc_error_data
+            );
+            if(p_array.m_Capacity != l_newCapacity)
+            {
+                LogDebugLine("Growing failed, returning.");
+                return;
+            }
+
+            if(l_itemIsInArray)
+            {
+                l_item = p_array.m_Buffer + l_itemIndex;
+            }
         }
 
-        ResizeArrayToCapacityUsingReallocator(
-            p_array,
-            l_result,
-            p_reallocate, p_realloc_error, p_realloc_error_data
-        );
+        //The slot past m_Size does not hold an item.
+        new(p_array.m_Buffer + p_array.m_Size) T(*l_item);
+        ++p_array.m_Size;
 
     }
     template<typename T>
-    inline void IncreaseArrayCapacityByAmount(
-        Array<T>& p_array,
-        const Size& p_amount
+    inline void AddItemToEndOfArray(
+        const T& p_item,
+        Array<T>& p_array
     )
     {
-        LogDebugLine("Using defaults for IncreaseArrayCapacityByAmountUsingReallocator");
-        IncreaseArrayCapacityByAmountUsingReallocator(
-            p_array, p_amount,
+        LogDebugLine("Using defaults for AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy");
+        AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            p_item, p_array,
+            g_DEFAULT_ARRAY_GROWTH_POLICY,
             Library::g_DEFAULT_REALLOCATOR,
             Library::g_DEFAULT_REALLOC_ERROR,
             Library::g_DEFAULT_REALLOC_ERROR_DATA
         );
     }
-    
+
     /**
-     * @brief Decreases p_array's capacity by p_amount.
-     * 
-     * @details Reallocates p_array.m_Buffer using p_reallocate so that the
-     * capacity of the buffer is p_array.m_Capacity - p_amount. If
-     * p_array.m_Capacity - p_amount overflows the function returns without
-     * mutating p_array. If the new capacity is smaller than p_array.m_Size then
-     * p_array.m_Size is set to p_array.m_Capacity.
-     *  
-     * If reallocation fails, p_realloc_error is called and the function returns.
-     * p_array is not mutated. 
-     * 
-     * If p_amount is 0 the function returns.
+     * @brief Adds all of the items of p_to_add after the last item of
+     * p_array, growing p_array according to p_policy if it does not have
+     * enough capacity.
      *
-     * If p_array.m_Capacity - p_amount == 0, p_array.m_Buffer is reallocated
-     * with a size of 0 and it is set to null, p_array.m_Size and
-     * p_array.m_Capacity are set to 0.
-     *  
-     * @param p_array The array who's capacity will be increased. 
-     * @param p_amount By how much the capacity will be increased.
-     * @param p_reallocate The reallocator that will be used to reallocated the buffer.
-     * @param p_realloc_error The callback that will be called on failed reallocation.
+     * @details The items are added in order, so afterwards p_array ends with
+     * p_to_add. If p_to_add is empty the function returns without mutating
+     * p_array. p_to_add may be p_array itself, in which case its items are
+     * repeated once.
+     *
+     * If reallocation fails, p_realloc_error is called and the function
+     * returns without mutating p_array. If the new size or capacity would
+     * overflow, the function returns without mutating p_array.
+     *
+     * @param p_to_add The array whose items will be added.
+     * @param p_array The array to add the items to.
+     * @param p_policy How p_array's capacity grows.
+     * @param p_reallocate The reallocator that will be used to grow p_array.
+     * @param p_realloc_error The callback for a reallocation error.
      * @param p_realloc_error_data The data that will be passed to p_realloc_error.
-     * 
+     *
+     * @time O(n) amortized, n being p_to_add.m_Size.
+     *
+     * @warning If p_to_add is not p_array but shares its buffer, the behaviour
+     * is undefined if p_array has to grow.
+     *
      */
     template<typename T>
-    void DecreaseArrayCapacityByAmountUsingReallocator(
+    void AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+        const Array<T>& p_to_add,
         Array<T>& p_array,
-        const Size& p_amount,
+        const ArrayGrowthPolicy& p_policy,
         Reallocator p_reallocate,
         Callback p_realloc_error, void* p_realloc_error_data
     )
     {
 
-        LogDebugLine("Decreaseing the capacity of array " << p_array 
-        << " by " << p_amount);
+        LogDebugLine("Adding array " << p_to_add << " to the end of array "
+        << p_array);
 
-        Size l_result = p_array.m_Capacity - p_amount;
-        LogDebugLine("The needed capacity has been calculated, it is " << l_result);
+        //Read before growing, if p_to_add is p_array its size changes.
+        const Size l_count = p_to_add.m_Size;
 
-        //This indicates an overflow
-        if(l_result > p_array.m_Capacity)
+        if(l_count == 0 || p_to_add.m_Buffer == nullptr)
         {
-            LogDebugLine("An overflow has been detected, returning");
+            LogDebugLine("p_to_add is empty, returning.");
             return;
         }
 
-        ResizeArrayToCapacityUsingReallocator(
-            p_array, l_result,
-            p_reallocate, p_realloc_error, p_realloc_error_data
-        );
+        Size l_newSize = p_array.m_Size + l_count;
+        if(l_newSize < p_array.m_Size)
+        {
+            LogDebugLine("The new size of p_array overflows, returning.");
+            return;
+        }
+
+        if(l_newSize > p_array.m_Capacity)
+        {
+            Size l_newCapacity = FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(
+                p_array, l_newSize, p_policy
+            );
+            if(l_newCapacity == 0)
+            {
+                LogDebugLine("The new capacity overflows, returning.");
+                return;
+            }
+
+            ResizeArrayToCapacityUsingReallocator(
+                p_array, l_newCapacity,
+                p_reallocate, p_realloc_error, p_realloc_error_data
+            );
+            if(p_array.m_Capacity != l_newCapacity)
+            {
+                LogDebugLine("Growing failed, returning.");
+                return;
+            }
+        }
+
+        T* l_destination = p_array.m_Buffer + p_array.m_Size;
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            memcpy(l_destination, p_to_add.m_Buffer, sizeof(T) * l_count);
+        }
+        else
+        {
+            //The slots past m_Size do not hold items.
+            for(Size i = 0; i < l_count; ++i)
+            {
+                new(l_destination + i) T(p_to_add.m_Buffer[i]);
+            }
+        }
+        p_array.m_Size = l_newSize;
 
     }
     template<typename T>
-    inline void DecreaseArrayCapacityByAmount(
-        Array<T>& p_array,
-        const Size& p_amount
+    inline void AddArrayToEndOfArray(
+        const Array<T>& p_to_add,
+        Array<T>& p_array
     )
     {
-        LogDebugLine("Using defaults for DecreaseArrayCapacityByAmountUsingReallocator");
-        DecreaseArrayCapacityByAmountUsingReallocator(
-            p_array, p_amount,
+        LogDebugLine("Using defaults for AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy");
+        AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            p_to_add, p_array,
+            g_DEFAULT_ARRAY_GROWTH_POLICY,
             Library::g_DEFAULT_REALLOCATOR,
             Library::g_DEFAULT_REALLOC_ERROR,
             Library::g_DEFAULT_REALLOC_ERROR_DATA
@@ -1409,9 +4379,12 @@ namespace Library::DataStructures::Array
      * then the item before that... and so on until p_index is reached and
      * shifted. All of the items are kept in the same order and non are lost.
      * 
-     * @tparam T Must be a valid type. Must be able to be copied using the =
-     * operator to other parts of the array. Old items will be overwritten using
-     * the = operator.
+     * If T is trivially copyable all of the items are moved with a single
+     * memmove. Otherwise items are moved with std::move, items that end up past
+     * p_array.m_Size are move constructed there and the rest are move assigned.
+     *
+     * @tparam T Must be a valid type. Must be move constructible and move
+     * assignable, unless it is trivially copyable.
      * @param p_array The array to shift items in.
      * @param p_shift_amount By how much to shift those items.
      * @param p_index The index where shifting will begin.
@@ -1479,7 +4452,7 @@ namespace Library::DataStructures::Array
             "undefined.");
             abort();
         }
-        if(p_array.m_Capacity > (p_array.m_Size - 1) + p_shift_amount)
+        if(p_array.m_Capacity <= (p_array.m_Size - 1) + p_shift_amount)
         {
             LogDebugLine("\n\n\n--- ERROR ---\n\n\n");
             LogDebugLine("In function ShiftItemsRightInArrayByAmountStartingFromIndexNoErrorCheckAssumptions"
@@ -1495,17 +4468,38 @@ namespace Library::DataStructures::Array
         //Note: None of the arithmetic here can overflow as long as all of the
         //assumptions made by this function are true. (Details given in comment
         //block after the loop.)
-        for
-        (
-            Size i = p_array.m_Size - 1,              //Starts at the last item in the array.
-            n = (p_array.m_Size - 1) + p_shift_amount;  //Get extra space after the array.
-            i >= p_index;                               //Keep on looping until the item at the index is shifted. 
-            --i, --n                                    //Shifting is done backwards, this is so that no temporaries are
-                                                        //used, instead already shifted items are overwritten by not yet
-                                                        //shifted items.
-        )
+        T* l_items = p_array.m_Buffer;
+        if constexpr(std::is_trivially_copyable_v<T>)
         {
-            p_array[n] = p_array[i];
+            memmove(
+                l_items + p_index + p_shift_amount,
+                l_items + p_index,
+                sizeof(T) * (p_array.m_Size - p_index)
+            );
+        }
+        else
+        {
+            //Shifting is done backwards, this is so that no temporaries are
+            //used, instead already shifted items are overwritten by not yet
+            //shifted items. Items shifted past m_Size are moved into slots that
+            //do not hold an item yet, so they are constructed there.
+            for
+            (
+                Size i = p_array.m_Size,               //One past the item being shifted.
+                n = (p_array.m_Size - 1) + p_shift_amount; //Get extra space after the array.
+                i > p_index;                               //Keep on looping until the item at the index is shifted.
+                --i, --n
+            )
+            {
+                if(n >= p_array.m_Size)
+                {
+                    new(l_items + n) T(std::move(l_items[i - 1]));
+                }
+                else
+                {
+                    l_items[n] = std::move(l_items[i - 1]);
+                }
+            }
         }
 
         /***!!!--- OVERFLOW INFO ---!!!***/
@@ -1536,8 +4530,8 @@ namespace Library::DataStructures::Array
         //      - This number can fit into a Size.
         //  - That means that no matter what the result of the addition is, it
         //can be put into a Size, as such no overflow will occur.
-        //3. //TODO: for --i
-        //4. //TODO: for --n
+        //3. --i stops at p_index, which is at least 0, so it does not wrap.
+        //4. n is always i - 1 + p_shift_amount, so it does not wrap either.
         /***!!!--- END OVERFLOW INFO ---!!!***/
 
     }
@@ -1549,6 +4543,11 @@ namespace Library::DataStructures::Array
      * shifted to the right by p_to_add.m_Size. After the shift, after p_index
      * there are p_to_add.m_Size empty items, these are overwritten by the items
      * in p_to_add. And finally p_array.m_Size is increased by p_to_add.m_Size.
+     *
+     * If T is trivially copyable the items of p_to_add are copied with a
+     * single memcpy, otherwise they are copied with the = operator or copy
+     * constructed into slots past the old p_array.m_Size. p_to_add must not be
+     * part of p_array.
      * 
      * If p_to_add is empty the function returns without mutating p_array.
      * 
@@ -1562,7 +4561,7 @@ namespace Library::DataStructures::Array
      * @warning This function **ASSUMES** that the following conditions are true:
      * -# p_array.m_Buffer != nullptr;
      * -# p_index < p_array.m_Size;
-     * -# p_index + p_to_add.m_Size <= p_array.m_Capacity.
+     * -# p_array.m_Size + p_to_add.m_Size <= p_array.m_Capacity.
      * If any of these assumptions are false, the behaviour of this function is
      * undefined.
      * 
@@ -1588,28 +4587,44 @@ namespace Library::DataStructures::Array
         }
 
         //Note: thanks to all of the assumptions that this function makes, it is
-        //guranteed to not cause any overflows.
+        //guranteed to not cause any overflows. p_index + 1 <= p_array.m_Size
+        //and p_array.m_Size + p_to_add.m_Size <= p_array.m_Capacity, which is
+        //a Size.
 
-        //TODO: Why +-1 and why no overflows.
-        ShiftItemsRightInArrayByAmountStartingFromIndexNoErrorCheckAssumptions(
-            p_array,
-            p_to_add.m_Size - 1,
-            p_index + 1
-        );
-        LogDebugLine("Item shifting done.");
+        //The items after p_index make room for p_to_add, if p_index is the
+        //last item there is nothing to shift.
+        if(p_index + 1 < p_array.m_Size)
+        {
+            ShiftItemsRightInArrayByAmountStartingFromIndexNoErrorCheckAssumptions(
+                p_array,
+                p_to_add.m_Size,
+                p_index + 1
+            );
+            LogDebugLine("Item shifting done.");
+        }
 
         LogDebugLine("Doing the actual addition.");
-        for
-        (
-            Size i = p_index + 1, //Start adding stuff right after the index.
-            n = 0; //For indexing the array being added from.
-            n < p_to_add.m_Size; //Until all items are added.
-            ++i, ++n
-        )
+        T* l_items = p_array.m_Buffer + p_index + 1;
+        if constexpr(std::is_trivially_copyable_v<T>)
         {
-            p_array[i] = p_to_add[n];
+            memcpy(l_items, p_to_add.m_Buffer, sizeof(T) * p_to_add.m_Size);
+        }
+        else
+        {
+            //Slots that were past m_Size before the shift do not hold an item.
+            Size l_assigned = p_array.m_Size - (p_index + 1);
+            for(Size n = 0; n < p_to_add.m_Size; ++n)
+            {
+                if(n < l_assigned)
+                {
+                    l_items[n] = p_to_add.m_Buffer[n];
+                }
+                else
+                {
+                    new(l_items + n) T(p_to_add.m_Buffer[n]);
+                }
+            }
         }
-        //TODO: Overflow why not.
         LogDebugLine("Addition compelted.");
 
         LogDebugLine("Updating p_array.m_Size and returning.");
@@ -1737,9 +4752,10 @@ namespace Library::DataStructures::Array
             }
 
             LogDebugLine("Begining to copy items");
-            for(Size i = 0; i < p_to_add.m_Size; ++i)
+            T* l_to = p_array.begin();
+            for(const T& l_item : p_to_add)
             {
-                p_array[i] = p_to_add[i];
+                *l_to++ = l_item;
             }
             p_array.m_Size = p_to_add.m_Size;
 
@@ -1862,18 +4878,18 @@ namespace Library::DataStructures::Array
                 }
 
                 LogDebugLine("Reallocation was successful, new buffer is "
-                << l_newBuffer << " and new capacity is " << sizeof(T) * l_newCapacity);
+                << l_newBuffer << " and new capacity is " << l_newCapacity);
 
                 p_array.m_Buffer = l_newBuffer;
-                p_array.m_Capacity = sizeof(T) * l_newCapacity;
+                p_array.m_Capacity = l_newCapacity;
 
             }
             else
             {
                 LogDebugLine("Reallocation was successful, new buffer is "
-                << ((void*)l_newBuffer) << " and new capacity is " << sizeof(T) * l_newCapacity);
+                << ((void*)l_newBuffer) << " and new capacity is " << l_newCapacity);
                 p_array.m_Buffer = l_newBuffer;
-                p_array.m_Capacity = sizeof(T) * l_newCapacity;
+                p_array.m_Capacity = l_newCapacity;
             }
 
         }
@@ -1914,6 +4930,9 @@ namespace Library::DataStructures::Array
      * ending at index p_index + p_numberOfItems, with items after p_index +
      * p_numberOfItems. After this is done p_array.m_Size is subtracted by
      * p_numberOfItems + 1.
+     *
+     * If T is trivially copyable the items are moved with a single memmove,
+     * otherwise they are move assigned one by one.
      * 
      * @time O(n), n being p_numberOfItems + 1.
      * 
@@ -1955,19 +4974,31 @@ namespace Library::DataStructures::Array
         //p_array.m_Size has to be able to fit into a Size. The values of i
         //and n never exceed p_array.m_Size and never go bellow 0, therefore i 
         //and n cannot overflow.
-        for
-        (
-            Size i = p_index + p_numberOfItems + 1,/*The first item after the
-                                                        remove location.*/
-            n = p_index;//The first item that is being removed
-            i < p_array.m_Size; //Loops until all items are the remove location
-                                //are shifted.
-            ++i, ++n
-        )
+        T* l_items = p_array.m_Buffer;
+        if constexpr(std::is_trivially_copyable_v<T>)
         {
-            //Overwrite the item that is being removed with the item after the
-            //remove location.
-            p_array[n] = p_array[i];
+            memmove(
+                l_items + p_index,
+                l_items + p_index + p_numberOfItems + 1,
+                sizeof(T) * (p_array.m_Size - (p_index + p_numberOfItems + 1))
+            );
+        }
+        else
+        {
+            for
+            (
+                Size i = p_index + p_numberOfItems + 1,/*The first item after the
+                                                            remove location.*/
+                n = p_index;//The first item that is being removed
+                i < p_array.m_Size; //Loops until all items are the remove location
+                                    //are shifted.
+                ++i, ++n
+            )
+            {
+                //Overwrite the item that is being removed with the item after
+                //the remove location.
+                l_items[n] = std::move(l_items[i]);
+            }
         }
 
         //+1 since the item at the index is also removed.
@@ -2065,172 +5096,340 @@ namespace Library::DataStructures::Array
     }
     
     /**
-     * @brief Removes all instances of the items in p_items from p_array.
-     * 
-     * @details Items are removed by pushing the **matching items (items whose
-     * == operator returns true when compared with any of the items in p_items
-     * OR whose != operator return false when compared with any of the items in
-     * p_items)** to the end of p_array. Once all of the matching items have
-     * been pushed to the end of p_array's buffer, p_array's size is shrunk down
-     * by the amount of matching items.\n **Non matching items (items whose ==
-     * operator returns false when compared with any of the items in p_items OR
-     * whose != operator return true when compared with any of the items in
-     * p_items)** are swapped with the nearest matching items, with a preference
-     * to swap the items closest to the end of p_array (for example an array
-     * with the matching items M1,M2,M3 and the non matching items NM1, NM2,
-     * NM3, NM4, NM5, NM6, where the items are arrange in the following order:
-     * NM1-M1-NM2-NM3-M2-NM4-NM5-M3-NM6, will produce an array with the follow
-     * order once all of the swapping is done: NM1-NM2-NM3-NM4-NM5-NM6-M2-M3-M1).
-     * 
-     * @tparam T Must be complete type that can be copied with the = operator as
-     * well as compared to itself with the == and != operators.
-     * @param p_items An array of items to remove from p_array.
-     * @param p_array The array from which items will be removed.
-     * 
-     * **p_array.m_Buffer and p_array.m_Capacity** are not mutated in any way.
-     * 
-     * **p_items** is not mutated in any way.
-     * 
-     * **If p_array.m_Size is 0** the function returns without doing anything.
-     * 
-     * **If p_items.m_Size is 0** the function loops p_array.m_Size times and
-     * returns without changing anything.
-     * 
-     * **Items in p_array are swapped with each other** using a temporary
-     * variable of type T. Items are copied from p_array into this temporary
-     * using = operator and then they are copied form the temporary to p_array
-     * once again using the = operator.
-     * 
-     * **In the case where p_items has repeated items**, the behaviour of this
-     * function depends on whether DEBUG is defined:
-     * - *If DEBUG is defined* then p_items is checked for repeating items and
-     * if they are found the index of all of the repeated items is logged. The
-     * function will still run normally, but it will be wasting item checking
-     * redundant items.
-     * - *If DEBUG is not defined* then this function only wastes time checking
-     * redundant items, no error will occur and the function will execute
-     * properly.
-     * 
-     * @time **O(n * m)**, n being the number of items in p_array and m being
-     * the number of items in p_items. **HOWEVER if DEBUG is defined** the time
-     * complexity of this function changes to **O(m^2)** since the function also
-     * checks to see if there are any repeating items.
-     * 
+     * @brief The order the items that are kept end up in when items are
+     * removed from an array.
+     *
+     * - Stable: the kept items stay in the same order they were in.
+     * - Unstable: the holes left by removed items are filled with items from
+     * the end of the array, fewer items are moved but the order of the kept
+     * items is not kept.
+     *
      */
-    template<typename T>
-    void RemoveEachInstanceOfArrayOfItemsFromArray(
-        const Array<T>& p_items,
-        Array<T>& p_array
-    )
+    enum class ArrayRemovalOrder : Byte
     {
+        Stable,
+        Unstable
+    };
 
-        LogDebugLine("Removing each instance of items in array " << p_items
-        << " from array " << p_array);
+    /**
+     * @brief Whether items of type T can be put into a hash set by
+     * @ref RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator.
+     *
+     * @details Only integers, enums and pointers, since for them == is the
+     * same as comparing their bits. Floats are not, 0.0 == -0.0 and NaN != NaN.
+     *
+     */
+    template<typename T>
+    constexpr bool g_ARRAY_ITEMS_ARE_HASHABLE =
+        std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+    /**
+     * @brief The number of items to remove from which a hash set is built
+     * instead of comparing each item with each item to remove.
+     *
+     */
+    constexpr Size g_ARRAY_REMOVAL_HASH_SET_THRESHOLD = 16;
 
-        //This algorithm works by "pushing" all of the matching items in p_array
-        //by constantly swapping them with non matching items. The entire
-        //algorithm only loops through the entire array once.
-        //
-        //"Pushing" of the matching items is done in the following way:
-        //There are 2 indexes, 1 is the matching item with the lowest index and
-        //the other is the index of the current item. Once a non matching item
-        //is found, the matching item with the lowest index is swapped with it
-        //and the lowest item index is incremented. The new index is either the
-        //location of a new matching item or the same matching item that was
-        //just swapped.
-        //Once a matching item is found, it is ignored.
-        //
-        //This is turn causes a matching item blob to slowly form in the array.
-        //By the time the algorightm is done all matching items are now at the
-        //end of the array right next to each other and all other non matching
-        //items have been arranged in their proper space. Then all that is left
-        //is to decrease the array's size.
+    /**
+     * @brief Returns a hash of p_item, T must be hashable, see
+     * @ref g_ARRAY_ITEMS_ARE_HASHABLE.
+     *
+     * @details Fibonacci hashing, the high bits are the best mixed so use those.
+     *
+     */
+    template<typename T>
+    inline uint64_t HashArrayItem(const T& p_item)
+    {
+        static_assert(g_ARRAY_ITEMS_ARE_HASHABLE<T>, "T is not hashable.");
 
-        #ifdef DEBUG
-        LogDebugLine("Checking if there are any repeated items in the item "
-        "array. (This check only occurs when DEBUG is defined, it also doesn't "
-        "do anything other than log the indexes of the repeated items.)");
-        for(Size i = 0; i < p_items.m_Size; ++i)
+        uint64_t l_bits;
+        if constexpr(std::is_pointer_v<T>)
         {
-            //The item will never be mutated anyway.
-            Array<T> l_tmp((int&)p_items[i]);
-            if(FindNumberOfInstanceOfArrayInArray<T>(l_tmp, p_items) > 1)
-            {
-                LogDebugLine("Repeated item found at index " << i);
-            }
+            l_bits = (uint64_t)(uintptr_t)p_item;
         }
-        #endif //DEBUG
+        else
+        {
+            l_bits = (uint64_t)p_item;
+        }
+
+        return l_bits * 0x9E3779B97F4A7C15ull;
+    }
+
+    /**
+     * @brief Removes the items of p_array for which p_isRemoved returns true,
+     * in the order p_order says.
+     *
+     * @details Each item is passed to p_isRemoved once, unless p_order is
+     * Unstable and an item is moved into a hole, then it is passed again.
+     * Items are moved with the move = operator. p_array.m_Buffer and
+     * p_array.m_Capacity are not mutated, the items after the new m_Size are
+     * left in an unspecified state.
+     *
+     * @tparam F Anything that can be called with a const T& and returns bool.
+     *
+     * @time O(n) calls to p_isRemoved, n being p_array.m_Size.
+     *
+     */
+    template<typename T, typename F>
+    void RemoveEachItemForWhichFunctionReturnsTrueFromArray(
+        Array<T>& p_array,
+        const ArrayRemovalOrder& p_order,
+        F&& p_isRemoved
+    )
+    {
+
+        LogDebugLine("Removing items from array " << p_array);
 
-        if(p_array.m_Size == 0)
+        if(p_array.m_Buffer == nullptr)
         {
-            LogDebugLine("The array having items removed does not contain any "
-            "items itself, bummer! Returning.");
             return;
         }
-        //Case of p_items.m_Size being 0 is covered by the all of the loops and
-        //checks them selfs. In this case the first case will make it so that
-        //l_firstMatch is equal to p_array.m_Size(since no match will be found
-        //due to the ArrayContainsArray function returning false all of the time
-        //), this inturn causes the second loop to be skipped and the last
-        //assignment of p_array.m_Size will have no effect as l_firstMatch is
-        //equal to p_array.m_Size.
 
-        //l_firstMatch is the smallest index that has a matching item.
-        Size l_firstMatch;
+        T* l_items = p_array.m_Buffer;
 
-        LogDebugLine("Searching for first item match.");
-        //The first loop finds the first item that matches p_items
-        for(l_firstMatch = 0; l_firstMatch < p_array.m_Size; ++l_firstMatch)
+        if(p_order == ArrayRemovalOrder::Stable)
         {
-            if(ArrayContainsArray<T>(p_items, p_array[l_firstMatch]))
+            //Nothing has to be moved until the first removed item.
+            Size l_write = 0;
+            while(l_write < p_array.m_Size && !p_isRemoved(l_items[l_write]))
             {
-                LogDebugLine("Found first item match at index " << l_firstMatch);
-                break;
+                ++l_write;
+            }
+            for(Size i = l_write + 1; i < p_array.m_Size; ++i)
+            {
+                if(!p_isRemoved(l_items[i]))
+                {
+                    l_items[l_write] = std::move(l_items[i]);
+                    ++l_write;
+                }
+            }
+            if(l_write < p_array.m_Size)
+            {
+                p_array.m_Size = l_write;
+            }
+        }
+        else
+        {
+            Size l_end = p_array.m_Size;
+            Size i = 0;
+            while(i < l_end)
+            {
+                if(!p_isRemoved(l_items[i]))
+                {
+                    ++i;
+                    continue;
+                }
+                //The last item is moved into the hole and checked next.
+                --l_end;
+                if(i != l_end)
+                {
+                    l_items[i] = std::move(l_items[l_end]);
+                }
             }
+            p_array.m_Size = l_end;
         }
 
-        //This condition is here mainly because it would cause an overflow in
-        //the loop below.
-        if(l_firstMatch == SIZE_MAX)
+        LogDebugLine("Array after removal: " << p_array);
+
+    }
+
+    /**
+     * @brief Removes all instances of the items in p_items from p_array.
+     *
+     * @details An item of p_array is removed if it is == to any of the items
+     * in p_items. How items are looked up in p_items depends on T:
+     * - *1 byte items* (see @ref g_ARRAY_ITEMS_ARE_BYTES) are looked up in a
+     * 256 bit bitmap on the stack.
+     * - *Hashable items* (see @ref g_ARRAY_ITEMS_ARE_HASHABLE), when p_items
+     * has at least @ref g_ARRAY_REMOVAL_HASH_SET_THRESHOLD items, are put into
+     * an open addressing hash set allocated with p_allocate and deallocated
+     * with p_deallocate once p_array has been gone through.
+     * - *Everything else*, as well as small p_items, are compared with each
+     * item of p_items one by one.
+     *
+     * Then p_array is gone through once, see
+     * @ref RemoveEachItemForWhichFunctionReturnsTrueFromArray for how items
+     * are moved.
+     *
+     * @param p_items An array of items to remove from p_array, repeated items
+     * are fine.
+     * @param p_array The array from which items will be removed.
+     * @param p_order Whether the items that are kept stay in order.
+     * @param p_allocate The allocator used for the hash set.
+     * @param p_deallocate The deallocator used for the hash set.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * **p_array.m_Buffer and p_array.m_Capacity** are not mutated in any way.
+     *
+     * **p_items** is not mutated in any way.
+     *
+     * **If allocation of the hash set fails** p_alloc_error is called and the
+     * items are then compared one by one, so the result is the same.
+     *
+     * @time **O(n + m)** for bytes and hashable items, n being the number of
+     * items in p_array and m being the number of items in p_items. **O(n * m)**
+     * for everything else.
+     *
+     */
+    template<typename T>
+    void RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator(
+        const Array<T>& p_items,
+        Array<T>& p_array,
+        const ArrayRemovalOrder& p_order,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Removing each instance of items in array " << p_items
+        << " from array " << p_array);
+
+        if(ArrayIsEmpty(p_array) || ArrayIsEmpty(p_items))
         {
-            LogDebugLine("Special case of the only matching index being "
-            "SIZE_MAX, decrementing array " << p_array
-            << "'s m_Size by 1 and returning.");
-            //p_array.m_Size is guranteed to be SIZE_MAX in the case so it won't
-            //underflow.
-            --p_array.m_Size;
+            LogDebugLine("Nothing to remove, returning.");
             return;
         }
 
-        LogDebugLine("Pushing all matches to the end of the array.");
-        T l_tmp;
-        for(Size i = l_firstMatch + 1; i < p_array.m_Size; ++i)
+        if constexpr(g_ARRAY_ITEMS_ARE_BYTES<T>)
         {
-            if(ArrayContainsArray<T>(p_items, p_array[i]))
+            uint64_t l_bitmap[4] = {0, 0, 0, 0};
+            for(Size i = 0; i < p_items.m_Size; ++i)
             {
-                LogDebugLine("Found match at index " << i  << ", not swaping "
-                "and skipping.");
-                continue;
+                Byte l_byte = (Byte)p_items.m_Buffer[i];
+                l_bitmap[l_byte >> 6] |= (uint64_t)1 << (l_byte & 63);
             }
-            else
+
+            RemoveEachItemForWhichFunctionReturnsTrueFromArray(
+                p_array, p_order,
+                [&l_bitmap](const T& p_item)
+                {
+                    Byte l_byte = (Byte)p_item;
+                    return (l_bitmap[l_byte >> 6] >> (l_byte & 63) & 1) != 0;
+                }
+            );
+            return;
+        }
+        else if constexpr(g_ARRAY_ITEMS_ARE_HASHABLE<T>)
+        {
+            if(p_items.m_Size >= g_ARRAY_REMOVAL_HASH_SET_THRESHOLD)
             {
-                LogDebugLine("Did not find match at index " << i << ", swaping "
-                "and incrementing the first item index.");
-                l_tmp = p_array[i];
-                p_array[i] = p_array[l_firstMatch];
-                p_array[l_firstMatch] = l_tmp;
+                //A power of 2 at least twice p_items.m_Size, so the set is at
+                //most half full.
+                Size l_slotCount = 1;
+                unsigned l_shift = 64;
+                while(l_slotCount < p_items.m_Size * 2 && l_slotCount <= SIZE_MAX / sizeof(T) / 4)
+                {
+                    l_slotCount *= 2;
+                    --l_shift;
+                }
+
+                T* l_slots = nullptr;
+                if(l_slotCount >= p_items.m_Size * 2)
+                {
+                    l_slots = (T*)p_allocate(sizeof(T) * l_slotCount);
+                }
+
+                if(l_slots == nullptr)
+                {
+                    LogDebugLine("Allocation of the hash set failed, comparing "
+                    "items one by one.");
+                    if(p_alloc_error != nullptr)
+                    {
+                        p_alloc_error(p_alloc_error_data);
+                    }
+                }
+                else
+                {
+                    //Empty slots hold the zero item, whether the zero item is
+                    //in the set is kept apart.
+                    const T l_zero = T();
+                    bool l_hasZero = false;
+                    for(Size i = 0; i < l_slotCount; ++i)
+                    {
+                        l_slots[i] = l_zero;
+                    }
+
+                    const Size l_mask = l_slotCount - 1;
+                    for(Size i = 0; i < p_items.m_Size; ++i)
+                    {
+                        const T& l_item = p_items.m_Buffer[i];
+                        if(l_item == l_zero)
+                        {
+                            l_hasZero = true;
+                            continue;
+                        }
+                        Size l_slot = (Size)(HashArrayItem(l_item) >> l_shift) & l_mask;
+                        while(l_slots[l_slot] != l_zero && l_slots[l_slot] != l_item)
+                        {
+                            l_slot = (l_slot + 1) & l_mask;
+                        }
+                        l_slots[l_slot] = l_item;
+                    }
 
-                ++l_firstMatch;
+                    RemoveEachItemForWhichFunctionReturnsTrueFromArray(
+                        p_array, p_order,
+                        [&](const T& p_item)
+                        {
+                            if(p_item == l_zero)
+                            {
+                                return l_hasZero;
+                            }
+                            Size l_slot = (Size)(HashArrayItem(p_item) >> l_shift) & l_mask;
+                            while(l_slots[l_slot] != l_zero)
+                            {
+                                if(l_slots[l_slot] == p_item)
+                                {
+                                    return true;
+                                }
+                                l_slot = (l_slot + 1) & l_mask;
+                            }
+                            return false;
+                        }
+                    );
+
+                    p_deallocate(l_slots);
+                    return;
+                }
             }
         }
 
-        LogDebugLine("All matches have been pushed to the end, adjusting array "
-        "size...");
-        //l_firstMatch is the smallest index that has a matching item, which in
-        //this case is the exact value that needs to be in p_array.m_Size.
-        p_array.m_Size = l_firstMatch;
+        RemoveEachItemForWhichFunctionReturnsTrueFromArray(
+            p_array, p_order,
+            [&p_items](const T& p_item)
+            {
+                for(Size i = 0; i < p_items.m_Size; ++i)
+                {
+                    if(p_items.m_Buffer[i] == p_item)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+        );
 
     }
+    /**
+     * @brief Default allocator, deallocator, callback and data, the kept
+     * items stay in order.
+     *
+     */
+    template<typename T>
+    inline void RemoveEachInstanceOfArrayOfItemsFromArray(
+        const Array<T>& p_items,
+        Array<T>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator");
+        RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator(
+            p_items, p_array,
+            ArrayRemovalOrder::Stable,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
 
 
     /**
@@ -0,0 +1,79 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <string>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//The key sizes looked at, from a short route to a big request body.
+static const Size g_KEY_SIZES[] = {8, 64, 512, 4 * 1024, 64 * 1024};
+
+//How the items were compared before, one by one.
+static bool ItemsAreEqualOneByOne(const Array<char>& p_left, const Array<char>& p_right)
+{
+    if(p_left.m_Size != p_right.m_Size)
+    {
+        return false;
+    }
+    for(Size i = 0; i < p_left.m_Size; ++i)
+    {
+        if(p_left.m_Buffer[i] != p_right.m_Buffer[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Comparing keys", "[Array][Benchmark]")
+{
+
+    for(Size l_size : g_KEY_SIZES)
+    {
+        //Equal keys in different buffers are the slowest to compare, every
+        //item has to be looked at.
+        Array<char> l_key;
+        Array<char> l_other;
+        CreateArrayAtOfCapacity(l_key, l_size);
+        CreateArrayAtOfCapacity(l_other, l_size);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            l_key.m_Buffer[i] = 'a' + i % 26;
+            l_other.m_Buffer[i] = 'a' + i % 26;
+        }
+        l_key.m_Size = l_size;
+        l_other.m_Size = l_size;
+        Array<char> l_start(l_other.m_Buffer, l_size / 2);
+        Array<char> l_end(l_other.m_Buffer + l_size / 2, l_size - l_size / 2);
+
+        const std::string l_name = std::to_string(l_size) + "B ";
+
+        BENCHMARK(l_name + "one by one")
+        {
+            return ItemsAreEqualOneByOne(l_key, l_other);
+        };
+        BENCHMARK(l_name + "operator==")
+        {
+            return l_key == l_other;
+        };
+        BENCHMARK(l_name + "starts with half")
+        {
+            return ArrayStartsWithArray(l_key, l_start);
+        };
+        BENCHMARK(l_name + "ends with half")
+        {
+            return ArrayEndsWithArray(l_key, l_end);
+        };
+        BENCHMARK(l_name + "first mismatch")
+        {
+            return FindIndexOfFirstMismatchOfArrayAndArray(l_key, l_other);
+        };
+
+        DestoryArray(l_key);
+        DestoryArray(l_other);
+    }
+
+}
@@ -0,0 +1,115 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//Adds p_count ints one by one and returns the last one, so that the
+//compiler can not throw the work away.
+static int AddIntsToEndOfArrayUsingGrowthPolicy(
+    const Size& p_count,
+    const ArrayGrowthPolicy& p_policy
+)
+{
+
+    Array<int> l_array;
+
+    for(Size i = 0; i < p_count; ++i)
+    {
+        AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            (int)i, l_array, p_policy,
+            realloc, nullptr, nullptr
+        );
+    }
+
+    int l_last = l_array.m_Buffer[l_array.m_Size - 1];
+    DestoryArray(l_array);
+
+    return l_last;
+
+}
+
+//Grows the capacity by exactly one item for every addition, like the
+//functions without a growth policy do.
+static int AddIntsToEndOfArrayExactly(const Size& p_count)
+{
+
+    Array<int> l_array;
+
+    for(Size i = 0; i < p_count; ++i)
+    {
+        IncreaseArrayCapacityByAmountUsingReallocator(l_array, 1, realloc, nullptr, nullptr);
+        l_array.m_Buffer[l_array.m_Size] = (int)i;
+        ++l_array.m_Size;
+    }
+
+    int l_last = l_array.m_Buffer[l_array.m_Size - 1];
+    DestoryArray(l_array);
+
+    return l_last;
+
+}
+
+TEST_CASE("Adding 10^8 ints to the end of an array", "[Array][Benchmark]")
+{
+
+    const Size l_count = 100000000;
+
+    BENCHMARK("OneAndAHalf")
+    {
+        return AddIntsToEndOfArrayUsingGrowthPolicy(l_count, ArrayGrowthPolicy::OneAndAHalf);
+    };
+    BENCHMARK("Double")
+    {
+        return AddIntsToEndOfArrayUsingGrowthPolicy(l_count, ArrayGrowthPolicy::Double);
+    };
+    BENCHMARK("SizeClass")
+    {
+        return AddIntsToEndOfArrayUsingGrowthPolicy(l_count, ArrayGrowthPolicy::SizeClass);
+    };
+    BENCHMARK("Reserved")
+    {
+        Array<int> l_array;
+        ReserveArrayCapacityUsingReallocator(l_array, l_count, realloc, nullptr, nullptr);
+        for(Size i = 0; i < l_count; ++i)
+        {
+            AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+                (int)i, l_array, ArrayGrowthPolicy::Double,
+                realloc, nullptr, nullptr
+            );
+        }
+        int l_last = l_array.m_Buffer[l_array.m_Size - 1];
+        DestoryArray(l_array);
+        return l_last;
+    };
+
+}
+
+//The time per item should stay the same as the count grows by 10x for
+//geometric growth, and grow with the count for exact growth.
+TEST_CASE("Amortized cost of adding to the end of an array", "[Array][Benchmark]")
+{
+
+    BENCHMARK("Double 10^6")
+    {
+        return AddIntsToEndOfArrayUsingGrowthPolicy(1000000, ArrayGrowthPolicy::Double);
+    };
+    BENCHMARK("Double 10^7")
+    {
+        return AddIntsToEndOfArrayUsingGrowthPolicy(10000000, ArrayGrowthPolicy::Double);
+    };
+    BENCHMARK("Exact 10^5")
+    {
+        return AddIntsToEndOfArrayExactly(100000);
+    };
+    BENCHMARK("Exact 10^6")
+    {
+        return AddIntsToEndOfArrayExactly(1000000);
+    };
+
+}
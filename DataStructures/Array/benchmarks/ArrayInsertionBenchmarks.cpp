@@ -0,0 +1,87 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//The same as an int, but not trivially copyable, so items are moved one by
+//one like they all were before.
+struct SlowInt
+{
+    int m_Value;
+
+    SlowInt(int p_value): m_Value(p_value) {}
+    SlowInt(const SlowInt& p_other): m_Value(p_other.m_Value) {}
+    SlowInt& operator= (const SlowInt& p_other)
+    {
+        m_Value = p_other.m_Value;
+        return *this;
+    }
+};
+
+//The number of items in the arrays inserted into.
+static const Size g_ITEM_COUNT = 10000000;
+
+//Inserts 16 items in the middle of p_array and removes them again, so the
+//array is the same for the next run.
+template<typename T>
+static Size InsertAndRemoveInMiddle(Array<T>& p_array, const Array<T>& p_toAdd)
+{
+
+    AddArrayToArrayAfterIndexNoErrorCheckAssumingEnoughCapacity(p_toAdd, p_array, p_array.m_Size / 2);
+    RemoveNumberOfItemsStartingFromAndIncludingIndexNoErrorCheckFromArray(
+        p_toAdd.m_Size - 1, p_array.m_Size / 2, p_array
+    );
+
+    return p_array.m_Size;
+
+}
+
+template<typename T>
+static void FillArrays(Array<T>& p_array, Array<T>& p_toAdd)
+{
+
+    CreateArrayAtOfCapacity(p_array, g_ITEM_COUNT + 16);
+    CreateArrayAtOfCapacity(p_toAdd, 16);
+    for(Size i = 0; i < g_ITEM_COUNT; ++i)
+    {
+        new(p_array.m_Buffer + i) T((int)i);
+    }
+    p_array.m_Size = g_ITEM_COUNT;
+    for(Size i = 0; i < 16; ++i)
+    {
+        new(p_toAdd.m_Buffer + i) T((int)i);
+    }
+    p_toAdd.m_Size = 16;
+
+}
+
+TEST_CASE("Inserting into the middle of a big array", "[Array][Benchmark]")
+{
+
+    Array<int> l_ints;
+    Array<int> l_intsToAdd;
+    FillArrays(l_ints, l_intsToAdd);
+    Array<SlowInt> l_slowInts;
+    Array<SlowInt> l_slowIntsToAdd;
+    FillArrays(l_slowInts, l_slowIntsToAdd);
+
+    BENCHMARK("Insert and remove 16 ints, memmove")
+    {
+        return InsertAndRemoveInMiddle(l_ints, l_intsToAdd);
+    };
+    BENCHMARK("Insert and remove 16 ints, item by item")
+    {
+        return InsertAndRemoveInMiddle(l_slowInts, l_slowIntsToAdd);
+    };
+
+    DestoryArray(l_slowIntsToAdd);
+    DestoryArray(l_slowInts);
+    DestoryArray(l_intsToAdd);
+    DestoryArray(l_ints);
+
+}
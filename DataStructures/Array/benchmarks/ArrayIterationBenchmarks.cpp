@@ -0,0 +1,61 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//32KiB of ints, so the items stay in the level 1 cache and the loops are not
+//held up by memory.
+static const Size g_ITERATION_SIZE = 8 * 1024;
+
+TEST_CASE("Looping over an array", "[Array][Benchmark]")
+{
+
+    Array<int> l_array;
+    Array<int> l_same;
+    CreateArrayAtOfCapacity(l_array, g_ITERATION_SIZE);
+    CreateArrayAtOfCapacity(l_same, g_ITERATION_SIZE);
+    for(Size i = 0; i < g_ITERATION_SIZE; ++i)
+    {
+        l_array.m_Buffer[l_array.m_Size++] = (int)(i * 7 % 1000);
+        l_same.m_Buffer[l_same.m_Size++] = (int)(i * 7 % 1000);
+    }
+
+    BENCHMARK("Summing with operator[]")
+    {
+        int l_sum = 0;
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            l_sum += l_array[i];
+        }
+        return l_sum;
+    };
+    BENCHMARK("Summing with range for")
+    {
+        int l_sum = 0;
+        for(int l_item : l_array)
+        {
+            l_sum += l_item;
+        }
+        return l_sum;
+    };
+    BENCHMARK("ArrayStartsWithArray, all of it")
+    {
+        return ArrayStartsWithArray(l_array, l_same);
+    };
+    BENCHMARK("ArrayEndsWithArray, all of it")
+    {
+        return ArrayEndsWithArray(l_array, l_same);
+    };
+    BENCHMARK("ReverseArray")
+    {
+        ReverseArray(l_array);
+        return l_array.m_Buffer[0];
+    };
+
+    DestoryArray(l_same);
+    DestoryArray(l_array);
+
+}
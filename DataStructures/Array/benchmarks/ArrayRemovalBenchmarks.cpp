@@ -0,0 +1,94 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//Always fails, so the removal falls back to comparing items one by one.
+static void* FailingMalloc(Size)
+{
+    return nullptr;
+}
+
+TEST_CASE("Removing many IDs from a big array", "[Array][Benchmark]")
+{
+
+    //A million IDs, 5000 distinct ones of them are removed.
+    const Size l_arraySize = 1000000;
+    const Size l_itemCount = 5000;
+
+    Array<unsigned> l_ids;
+    Array<unsigned> l_source;
+    Array<unsigned> l_toRemove;
+    CreateArrayAtOfCapacity(l_ids, l_arraySize);
+    CreateArrayAtOfCapacity(l_source, l_arraySize);
+    CreateArrayAtOfCapacity(l_toRemove, l_itemCount);
+
+    srand(3);
+    for(Size i = 0; i < l_arraySize; ++i)
+    {
+        l_source.m_Buffer[l_source.m_Size++] = (unsigned)rand() % 200000;
+    }
+    for(Size i = 0; i < l_itemCount; ++i)
+    {
+        l_toRemove.m_Buffer[l_toRemove.m_Size++] = (unsigned)i * 40;
+    }
+
+    auto l_reset = [&]()
+    {
+        memcpy(l_ids.m_Buffer, l_source.m_Buffer, sizeof(unsigned) * l_arraySize);
+        l_ids.m_Size = l_arraySize;
+    };
+
+    //Every benchmark copies the IDs back first, this is how long that takes.
+    BENCHMARK("Copying the IDs")
+    {
+        l_reset();
+        return l_ids.m_Size;
+    };
+    BENCHMARK_ADVANCED("Hash set, stable")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            RemoveEachInstanceOfArrayOfItemsFromArray(l_toRemove, l_ids);
+            return l_ids.m_Size;
+        });
+    };
+    BENCHMARK_ADVANCED("Hash set, unstable")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator(
+                l_toRemove, l_ids, ArrayRemovalOrder::Unstable,
+                malloc, free, nullptr, nullptr
+            );
+            return l_ids.m_Size;
+        });
+    };
+    //A 100th of the array, comparing with every item is that slow.
+    BENCHMARK_ADVANCED("Comparing one by one, 10000 IDs")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            l_ids.m_Size = l_arraySize / 100;
+            RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator(
+                l_toRemove, l_ids, ArrayRemovalOrder::Stable,
+                FailingMalloc, free, nullptr, nullptr
+            );
+            return l_ids.m_Size;
+        });
+    };
+
+    DestoryArray(l_toRemove);
+    DestoryArray(l_source);
+    DestoryArray(l_ids);
+
+}
@@ -0,0 +1,189 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//The size of a log file worth searching, 16MiB.
+static const Size g_LOG_SIZE = 16 * 1024 * 1024;
+
+//Fills p_log with lines that look like the ones a server writes, the
+//needles searched for are never in them so the whole log is scanned.
+static void FillLog(Array<char>& p_log)
+{
+
+    static const char* s_levels[] = {"INFO", "DEBUG", "WARN", "INFO"};
+    static const char* s_paths[] = {"/api/users", "/api/orders", "/static/app.js", "/health"};
+
+    char l_line[128];
+    Size l_size = 0;
+    for(unsigned i = 0; l_size < g_LOG_SIZE; ++i)
+    {
+        int l_length = snprintf(
+            l_line, sizeof(l_line),
+            "2024-03-%02u 12:%02u:%02u [%s] GET %s took %ums status 200\n",
+            i % 28 + 1, i / 60 % 60, i % 60, s_levels[i % 4], s_paths[i / 3 % 4], i % 997
+        );
+        for(int n = 0; n < l_length && l_size < g_LOG_SIZE; ++n)
+        {
+            p_log.m_Buffer[l_size++] = l_line[n];
+        }
+    }
+    p_log.m_Size = l_size;
+
+}
+
+//The search that was used before, it compares at every start.
+static Size FindByComparingAtEveryStart(const Array<char>& p_toFind, const Array<char>& p_array)
+{
+    for(Size i = 0; i + p_toFind.m_Size <= p_array.m_Size; ++i)
+    {
+        Size n = 0;
+        while(n < p_toFind.m_Size && p_array.m_Buffer[i + n] == p_toFind.m_Buffer[n])
+        {
+            ++n;
+        }
+        if(n == p_toFind.m_Size)
+        {
+            return i;
+        }
+    }
+    return p_array.m_Size;
+}
+
+TEST_CASE("Searching a log", "[Array][Benchmark]")
+{
+
+    Array<char> l_log;
+    CreateArrayAtOfCapacity(l_log, g_LOG_SIZE);
+    FillLog(l_log);
+
+    char l_shortItems[] = "ERROR";
+    char l_mediumItems[] = "[WARN] GET /api/admin";
+    char l_longItems[] =
+        "2024-03-01 12:00:00 [INFO] GET /api/users took 0ms status 500\n"
+        "2024-03-02 12:00:01 [DEBUG] GET /api/users took 1ms status 500\n";
+
+    Array<char> l_short(l_shortItems, sizeof(l_shortItems) - 1);
+    Array<char> l_medium(l_mediumItems, sizeof(l_mediumItems) - 1);
+    Array<char> l_long(l_longItems, sizeof(l_longItems) - 1);
+
+    REQUIRE(FindIndexOfFirstOccurrenceOfArrayInArray(l_short, l_log) == l_log.m_Size);
+    REQUIRE(FindIndexOfFirstOccurrenceOfArrayInArray(l_medium, l_log) == l_log.m_Size);
+    REQUIRE(FindIndexOfFirstOccurrenceOfArrayInArray(l_long, l_log) == l_log.m_Size);
+
+    ArrayNeedle<char> l_longNeedle;
+    CreateArrayNeedleAtOfArray(l_longNeedle, l_long);
+
+    BENCHMARK("Every start, 5 bytes")
+    {
+        return FindByComparingAtEveryStart(l_short, l_log);
+    };
+    BENCHMARK("Array search, 5 bytes")
+    {
+        return FindIndexOfFirstOccurrenceOfArrayInArray(l_short, l_log);
+    };
+    BENCHMARK("memmem, 5 bytes")
+    {
+        return memmem(l_log.m_Buffer, l_log.m_Size, l_short.m_Buffer, l_short.m_Size);
+    };
+
+    BENCHMARK("Every start, 21 bytes")
+    {
+        return FindByComparingAtEveryStart(l_medium, l_log);
+    };
+    BENCHMARK("Array search, 21 bytes")
+    {
+        return FindIndexOfFirstOccurrenceOfArrayInArray(l_medium, l_log);
+    };
+    BENCHMARK("Array search from the end, 21 bytes")
+    {
+        return FindIndexOfLastOccurrenceOfArrayInArray(l_medium, l_log);
+    };
+    BENCHMARK("memmem, 21 bytes")
+    {
+        return memmem(l_log.m_Buffer, l_log.m_Size, l_medium.m_Buffer, l_medium.m_Size);
+    };
+
+    BENCHMARK("Every start, 127 bytes")
+    {
+        return FindByComparingAtEveryStart(l_long, l_log);
+    };
+    BENCHMARK("Array search, 127 bytes")
+    {
+        return FindIndexOfFirstOccurrenceOfArrayInArray(l_long, l_log);
+    };
+    BENCHMARK("Array needle, 127 bytes")
+    {
+        return FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_longNeedle, l_log);
+    };
+    BENCHMARK("memmem, 127 bytes")
+    {
+        return memmem(l_log.m_Buffer, l_log.m_Size, l_long.m_Buffer, l_long.m_Size);
+    };
+
+    DestroyArrayNeedle(l_longNeedle);
+    DestoryArray(l_log);
+
+}
+
+TEST_CASE("Searching log records", "[Array][Benchmark]")
+{
+
+    //Records are ints that repeat a lot, the worst case for searches that
+    //compare at every start.
+    const Size l_count = 4 * 1024 * 1024;
+
+    Array<int> l_records;
+    CreateArrayAtOfCapacity(l_records, l_count);
+    l_records.m_Size = l_count;
+    for(Size i = 0; i < l_count; ++i)
+    {
+        l_records.m_Buffer[i] = i % 64 == 63 ? 2 : 1;
+    }
+
+    int l_needleItems[32];
+    for(Size i = 0; i < 32; ++i)
+    {
+        l_needleItems[i] = 1;
+    }
+    l_needleItems[31] = 3;
+    Array<int> l_needle(l_needleItems, 32);
+
+    ArrayNeedle<int> l_prepared;
+    CreateArrayNeedleAtOfArray(l_prepared, l_needle);
+
+    BENCHMARK("Every start, 32 ints")
+    {
+        for(Size i = 0; i + l_needle.m_Size <= l_records.m_Size; ++i)
+        {
+            Size n = 0;
+            while(n < l_needle.m_Size && l_records.m_Buffer[i + n] == l_needle.m_Buffer[n])
+            {
+                ++n;
+            }
+            if(n == l_needle.m_Size)
+            {
+                return i;
+            }
+        }
+        return l_records.m_Size;
+    };
+    BENCHMARK("Array search, 32 ints")
+    {
+        return FindIndexOfFirstOccurrenceOfArrayInArray(l_needle, l_records);
+    };
+    BENCHMARK("Array needle, 32 ints")
+    {
+        return FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_prepared, l_records);
+    };
+
+    DestroyArrayNeedle(l_prepared);
+    DestoryArray(l_records);
+
+}
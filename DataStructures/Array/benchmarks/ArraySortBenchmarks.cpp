@@ -0,0 +1,113 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "../Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+TEST_CASE("Sorting a million integers", "[Array][Benchmark]")
+{
+
+    const Size l_size = 1000000;
+
+    const char* l_input = GENERATE("Random", "Sorted", "Reversed", "Few distinct");
+
+    Array<int> l_items;
+    Array<int> l_source;
+    CreateArrayAtOfCapacity(l_items, l_size);
+    CreateArrayAtOfCapacity(l_source, l_size);
+
+    srand(5);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        int l_item;
+        if(strcmp(l_input, "Random") == 0)
+        {
+            l_item = rand();
+        }
+        else if(strcmp(l_input, "Sorted") == 0)
+        {
+            l_item = (int)i;
+        }
+        else if(strcmp(l_input, "Reversed") == 0)
+        {
+            l_item = (int)(l_size - i);
+        }
+        else
+        {
+            l_item = rand() % 16;
+        }
+        l_source.m_Buffer[l_source.m_Size++] = l_item;
+    }
+
+    auto l_reset = [&]()
+    {
+        memcpy(l_items.m_Buffer, l_source.m_Buffer, sizeof(int) * l_size);
+        l_items.m_Size = l_size;
+    };
+
+    SECTION(l_input)
+    {
+        //Every benchmark copies the items back first, this is how long that
+        //takes.
+        BENCHMARK("Copying the items")
+        {
+            l_reset();
+            return l_items.m_Size;
+        };
+        BENCHMARK_ADVANCED("std::sort")(Catch::Benchmark::Chronometer p_meter)
+        {
+            p_meter.measure([&]
+            {
+                l_reset();
+                std::sort(l_items.m_Buffer, l_items.m_Buffer + l_size);
+                return l_items.m_Buffer[0];
+            });
+        };
+        BENCHMARK_ADVANCED("std::stable_sort")(Catch::Benchmark::Chronometer p_meter)
+        {
+            p_meter.measure([&]
+            {
+                l_reset();
+                std::stable_sort(l_items.m_Buffer, l_items.m_Buffer + l_size);
+                return l_items.m_Buffer[0];
+            });
+        };
+        BENCHMARK_ADVANCED("SortArray")(Catch::Benchmark::Chronometer p_meter)
+        {
+            p_meter.measure([&]
+            {
+                l_reset();
+                SortArray(l_items);
+                return l_items.m_Buffer[0];
+            });
+        };
+        BENCHMARK_ADVANCED("StableSortArray")(Catch::Benchmark::Chronometer p_meter)
+        {
+            p_meter.measure([&]
+            {
+                l_reset();
+                StableSortArray(l_items);
+                return l_items.m_Buffer[0];
+            });
+        };
+        BENCHMARK_ADVANCED("SortArrayOfIntegers")(Catch::Benchmark::Chronometer p_meter)
+        {
+            p_meter.measure([&]
+            {
+                l_reset();
+                SortArrayOfIntegers(l_items);
+                return l_items.m_Buffer[0];
+            });
+        };
+    }
+
+    DestoryArray(l_source);
+    DestoryArray(l_items);
+
+}
@@ -148,6 +148,64 @@ TEST_CASE("Create array at of capacity")
 
 }
 
+TEST_CASE("Create array at of capacity and alignment")
+{
+
+    Size l_capacity = GENERATE(range(1, 100));
+    Size l_alignment = GENERATE(1, 2, 16, 64, 4096);
+
+    Array<double> l_array;
+
+    SECTION("Defaults")
+    {
+        CreateArrayAtOfCapacityAndAlignment(l_array, l_capacity, l_alignment);
+    }
+    SECTION("Customs")
+    {
+        bool l_called = false;
+
+        CreateArrayAtOfCapacityAndAlignmentUsingAllocator(
+            l_array, l_capacity, l_alignment,
+            g_DEFAULT_ALIGNED_ALLOCATOR, &GeneralErrorCallback, &l_called
+        );
+
+        CHECK(l_called == false);
+    }
+
+    REQUIRE(l_array.m_Buffer != nullptr);
+    CHECK(l_array.m_Capacity == l_capacity);
+    CHECK(l_array.m_Size == 0);
+    CHECK((uintptr_t)l_array.m_Buffer % l_alignment == 0);
+    CHECK((uintptr_t)l_array.m_Buffer % alignof(double) == 0);
+
+    for(Size i = 0; i < l_capacity; ++i)
+    {
+        l_array.m_Buffer[i] = (double)i;
+    }
+    for(Size i = 0; i < l_capacity; ++i)
+    {
+        INFO("i = " << i);
+        CHECK(l_array.m_Buffer[i] == (double)i);
+    }
+
+    DestroyArrayUsingDeallocator(l_array, g_DEFAULT_ALIGNED_DEALLOCATOR);
+
+}
+
+TEST_CASE("Create array at of capacity and invalid alignment")
+{
+
+    Size l_alignment = GENERATE(0, 3, 48);
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacityAndAlignment(l_array, 10, l_alignment);
+
+    CHECK(l_array.m_Buffer == nullptr);
+    CHECK(l_array.m_Capacity == 0);
+    CHECK(l_array.m_Size == 0);
+
+}
+
 TEST_CASE("Create copy at")
 {
 
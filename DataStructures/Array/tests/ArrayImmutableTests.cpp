@@ -1,9 +1,14 @@
 #include <catch2/catch.hpp>
 
+#include <math.h>
+#include <stdlib.h>
+
 #include "../Array.hpp"
+#include "../../../Debugging/Debugging.hpp"
 
 using namespace Library;
 using namespace Library::DataStructures::Array;
+using namespace Debugging;
 
 TEST_CASE("Find and contains tests", "[Array][Immutable]")
 {
@@ -325,3 +330,285 @@ TEST_CASE("Find and contains tests", "[Array][Immutable]")
     DestoryArray(l_emptyArray);
 
 }
+
+//Searches by comparing at every start, used to check the real search
+//functions against.
+template<typename T>
+static Size FindIndexOfFirstOccurrenceSlowly(const Array<T>& p_toFind, const Array<T>& p_array)
+{
+    for(Size i = 0; i + p_toFind.m_Size <= p_array.m_Size; ++i)
+    {
+        Size n = 0;
+        while(n < p_toFind.m_Size && p_array.m_Buffer[i + n] == p_toFind.m_Buffer[n])
+        {
+            ++n;
+        }
+        if(n == p_toFind.m_Size)
+        {
+            return i;
+        }
+    }
+    return p_array.m_Size;
+}
+template<typename T>
+static Size FindIndexOfLastOccurrenceSlowly(const Array<T>& p_toFind, const Array<T>& p_array)
+{
+    Size l_result = p_array.m_Size;
+    for(Size i = 0; i + p_toFind.m_Size <= p_array.m_Size; ++i)
+    {
+        Size n = 0;
+        while(n < p_toFind.m_Size && p_array.m_Buffer[i + n] == p_toFind.m_Buffer[n])
+        {
+            ++n;
+        }
+        if(n == p_toFind.m_Size)
+        {
+            l_result = i;
+        }
+    }
+    return l_result;
+}
+template<typename T>
+static Size FindNumberOfInstanceSlowly(const Array<T>& p_toFind, const Array<T>& p_array)
+{
+    Size l_result = 0;
+    for(Size i = 0; i + p_toFind.m_Size <= p_array.m_Size;)
+    {
+        Size n = 0;
+        while(n < p_toFind.m_Size && p_array.m_Buffer[i + n] == p_toFind.m_Buffer[n])
+        {
+            ++n;
+        }
+        if(n == p_toFind.m_Size)
+        {
+            ++l_result;
+            i += n;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return l_result;
+}
+
+TEST_CASE("Find overlapping prefixes", "[Array][Immutable]")
+{
+
+    char l_haystackItems[] = "aaab";
+    char l_needleItems[] = "aab";
+    Array<char> l_haystack(l_haystackItems, 4);
+    Array<char> l_needle(l_needleItems, 3);
+
+    CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(l_needle, l_haystack) == 1);
+    CHECK(FindIndexOfLastOccurrenceOfArrayInArray(l_needle, l_haystack) == 1);
+    CHECK(FindNumberOfInstanceOfArrayInArray(l_needle, l_haystack) == 1);
+    CHECK(ArrayContainsArray(l_haystack, l_needle) == true);
+
+    int l_intHaystackItems[] = {1, 1, 1, 2, 1, 1, 2};
+    int l_intNeedleItems[] = {1, 1, 2};
+    Array<int> l_intHaystack(l_intHaystackItems, 7);
+    Array<int> l_intNeedle(l_intNeedleItems, 3);
+
+    CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(l_intNeedle, l_intHaystack) == 1);
+    CHECK(FindIndexOfLastOccurrenceOfArrayInArray(l_intNeedle, l_intHaystack) == 4);
+    CHECK(FindNumberOfInstanceOfArrayInArray(l_intNeedle, l_intHaystack) == 2);
+
+    //Instances that overlap are only counted once.
+    int l_onesItems[] = {1, 1, 1, 1, 1};
+    Array<int> l_ones(l_onesItems, 5);
+    Array<int> l_twoOnes(l_onesItems, 2);
+    CHECK(FindNumberOfInstanceOfArrayInArray(l_twoOnes, l_ones) == 2);
+    CHECK(FindIndexOfLastOccurrenceOfArrayInArray(l_twoOnes, l_ones) == 3);
+
+}
+
+TEMPLATE_TEST_CASE("Search matches a slow search", "[Array][Immutable]", char, int)
+{
+
+    //Lengths cover the SIMD blocks, the Horspool threshold and the size of
+    //the tables built on the stack.
+    Size l_needleSize = GENERATE(1, 2, 3, 17, 70, 300);
+    int l_alphabet = GENERATE(2, 4);
+    //Seeded so that failures can be reproduced.
+    srand((unsigned)(l_needleSize * 31 + l_alphabet));
+
+    Array<TestType> l_haystack;
+    Array<TestType> l_needle;
+    CreateArrayAtOfCapacity(l_haystack, 5000);
+    CreateArrayAtOfCapacity(l_needle, l_needleSize);
+    l_haystack.m_Size = l_haystack.m_Capacity;
+    l_needle.m_Size = l_needle.m_Capacity;
+
+    for(Size l_round = 0; l_round < 20; ++l_round)
+    {
+        for(Size i = 0; i < l_haystack.m_Size; ++i)
+        {
+            l_haystack.m_Buffer[i] = (TestType)('a' + rand() % l_alphabet);
+        }
+        //Long needles are copied out of the haystack so they are found.
+        Size l_from = rand() % (l_haystack.m_Size - l_needleSize);
+        for(Size i = 0; i < l_needle.m_Size; ++i)
+        {
+            l_needle.m_Buffer[i] = l_round % 2 == 0 ?
+                l_haystack.m_Buffer[l_from + i] :
+                (TestType)('a' + rand() % l_alphabet);
+        }
+
+        ArrayNeedle<TestType> l_prepared;
+        CreateArrayNeedleAtOfArray(l_prepared, l_needle);
+
+        Size l_first = FindIndexOfFirstOccurrenceSlowly(l_needle, l_haystack);
+        Size l_last = FindIndexOfLastOccurrenceSlowly(l_needle, l_haystack);
+        Size l_count = FindNumberOfInstanceSlowly(l_needle, l_haystack);
+
+        REQUIRE(FindIndexOfFirstOccurrenceOfArrayInArray(l_needle, l_haystack) == l_first);
+        REQUIRE(FindIndexOfLastOccurrenceOfArrayInArray(l_needle, l_haystack) == l_last);
+        REQUIRE(FindNumberOfInstanceOfArrayInArray(l_needle, l_haystack) == l_count);
+
+        REQUIRE(FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_prepared, l_haystack) == l_first);
+        REQUIRE(FindIndexOfLastOccurrenceOfArrayNeedleInArray(l_prepared, l_haystack) == l_last);
+        REQUIRE(FindNumberOfInstanceOfArrayNeedleInArray(l_prepared, l_haystack) == l_count);
+        REQUIRE(ArrayContainsArrayNeedle(l_haystack, l_prepared) == (l_first != l_haystack.m_Size));
+
+        DestroyArrayNeedle(l_prepared);
+    }
+
+    DestoryArray(l_haystack);
+    DestoryArray(l_needle);
+
+}
+
+TEST_CASE("Array needle creation", "[Array][Immutable]")
+{
+
+    Array<char> l_nullArray;
+    char l_items[100] = {};
+    Array<char> l_short(l_items, 10);
+    Array<char> l_long(l_items, 100);
+    Array<int> l_ints((int*)l_items, 5);
+
+    ArrayNeedle<char> l_needle;
+    ArrayNeedle<int> l_intNeedle;
+
+    SECTION("Empty needle")
+    {
+        CreateArrayNeedleAtOfArrayUsingAllocator(l_needle, l_nullArray, NullMalloc, nullptr, nullptr);
+        CHECK(l_needle.m_Tables == nullptr);
+        CHECK(FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_needle, l_long) == l_long.m_Size);
+        CHECK(FindNumberOfInstanceOfArrayNeedleInArray(l_needle, l_long) == 0);
+    }
+    SECTION("Short byte needle has no tables")
+    {
+        CreateArrayNeedleAtOfArrayUsingAllocator(l_needle, l_short, NullMalloc, nullptr, nullptr);
+        CHECK(l_needle.m_Tables == nullptr);
+        CHECK(FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_needle, l_long) == 0);
+    }
+    SECTION("Tables")
+    {
+        CreateArrayNeedleAtOfArray(l_needle, l_long);
+        CreateArrayNeedleAtOfArray(l_intNeedle, l_ints);
+        CHECK(l_needle.m_Tables != nullptr);
+        CHECK(l_needle.m_TableSize == 256);
+        CHECK(l_intNeedle.m_Tables != nullptr);
+        CHECK(l_intNeedle.m_TableSize == 5);
+    }
+    SECTION("Alloc error")
+    {
+        bool l_called = false;
+
+        CreateArrayNeedleAtOfArrayUsingAllocator(
+            l_intNeedle, l_ints,
+            NullMalloc, &GeneralErrorCallback, &l_called
+        );
+
+        CHECK(l_called == true);
+        CHECK(l_intNeedle.m_Tables == nullptr);
+        //The needle still works without its tables.
+        CHECK(FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_intNeedle, l_ints) == 0);
+    }
+
+    DestroyArrayNeedle(l_needle);
+    DestroyArrayNeedle(l_intNeedle);
+    CHECK(l_needle.m_Tables == nullptr);
+    CHECK(l_needle.m_Items.m_Buffer == nullptr);
+
+}
+
+TEMPLATE_TEST_CASE("Comparison finds every mismatch", "[Array][Immutable]", char, short, int, double)
+{
+
+    //Sizes cover the SSE2 blocks and 8 byte words, and what is left after
+    //them.
+    Size l_size = GENERATE(1, 7, 8, 15, 16, 17, 40, 100);
+    TestType l_leftItems[100];
+    TestType l_rightItems[100];
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_leftItems[i] = (TestType)(i % 50 + 1);
+        l_rightItems[i] = l_leftItems[i];
+    }
+    Array<TestType> l_left(l_leftItems, l_size);
+    Array<TestType> l_right(l_rightItems, l_size);
+
+    CHECK(l_left == l_right);
+    CHECK(l_left == l_left);
+    CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_left, l_right) == l_size);
+    CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_left, l_left) == l_size);
+
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_rightItems[i] = (TestType)100;
+
+        REQUIRE(FindIndexOfFirstMismatchOfArrayAndArray(l_left, l_right) == i);
+        REQUIRE(FindIndexOfFirstMismatchOfArrayAndArray(l_right, l_left) == i);
+        REQUIRE(l_left != l_right);
+        REQUIRE(ArrayStartsWithArray(l_left, Array<TestType>(l_rightItems, i)) == (i > 0));
+        REQUIRE_FALSE(ArrayStartsWithArray(l_left, Array<TestType>(l_rightItems, i + 1)));
+        REQUIRE_FALSE(ArrayEndsWithArray(l_left, Array<TestType>(l_rightItems + i, l_size - i)));
+        REQUIRE(ArrayEndsWithArray(l_left, Array<TestType>(l_rightItems + i + 1, l_size - i - 1)) == (i + 1 < l_size));
+
+        l_rightItems[i] = l_leftItems[i];
+    }
+
+    SECTION("Different sizes")
+    {
+        Array<TestType> l_shorter(l_rightItems, l_size - 1);
+        CHECK(l_left != l_shorter);
+        CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_left, l_shorter) == l_size - 1);
+        CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_shorter, l_left) == l_size - 1);
+    }
+    SECTION("Null and empty arrays")
+    {
+        Array<TestType> l_null;
+        Array<TestType> l_empty(l_leftItems, 0);
+        CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_null, l_left) == 0);
+        CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_left, l_empty) == 0);
+        CHECK(l_null == l_null);
+        CHECK(l_null != l_empty);
+        CHECK(l_empty == Array<TestType>(l_rightItems, 0));
+    }
+
+}
+
+TEST_CASE("Floating point items are not compared as bytes", "[Array][Immutable]")
+{
+
+    double l_zeros[] = {0.0, 1.0};
+    double l_negativeZeros[] = {-0.0, 1.0};
+    double l_notANumber[] = {1.0, NAN};
+    Array<double> l_zero(l_zeros, 2);
+    Array<double> l_negativeZero(l_negativeZeros, 2);
+    Array<double> l_nan(l_notANumber, 2);
+
+    CHECK(l_zero == l_negativeZero);
+    CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_zero, l_negativeZero) == 2);
+    //Not even when both are the same buffer.
+    CHECK(l_nan != l_nan);
+    CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_nan, l_nan) == 1);
+
+    CHECK(g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE<int>);
+    CHECK(g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE<char*>);
+    CHECK_FALSE(g_ARRAY_ITEMS_ARE_BITWISE_COMPARABLE<double>);
+
+}
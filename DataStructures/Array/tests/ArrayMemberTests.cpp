@@ -113,6 +113,54 @@ TEST_CASE("Index operator")
 
 }
 
+TEST_CASE("Iteration")
+{
+
+    Size l_size = GENERATE(Catch::Generators::range(0, 20));
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size + 5);
+    l_array.m_Size = l_size;
+
+    SECTION("Writing and reading with range for")
+    {
+        int l_next = 0;
+        for(int& l_item : l_array)
+        {
+            l_item = l_next++;
+        }
+        CHECK(l_next == (int)l_size);
+
+        const Array<int>& l_constArray = l_array;
+        REQUIRE(l_constArray.end() - l_constArray.begin() == (std::ptrdiff_t)l_size);
+        int l_expected = 0;
+        for(const int& l_item : l_constArray)
+        {
+            CHECK(l_item == l_expected++);
+        }
+    }
+    SECTION("Pointers")
+    {
+        CHECK(l_array.begin() == l_array.m_Buffer);
+        CHECK(l_array.end() == l_array.m_Buffer + l_size);
+    }
+
+    DestoryArray(l_array);
+
+}
+TEST_CASE("Iteration over a null array")
+{
+
+    Array<int> l_array;
+    CHECK(l_array.begin() == nullptr);
+    CHECK(l_array.end() == nullptr);
+    for(int& l_item : l_array)
+    {
+        FAIL("Got item " << l_item);
+    }
+
+}
+
 TEST_CASE("Comparison operators")
 {
 
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include <stdint.h>
+#include <stdlib.h>
 #include "../Array.hpp"
 #include "../../../Debugging/Debugging.hpp"
 
@@ -185,6 +186,88 @@ TEST_CASE("Change array capacity", "[Array][Mutable][Capacity]")
 
 }
 
+TEST_CASE("Change array capacity and alignment", "[Array][Mutable][Capacity]")
+{
+
+    Size l_capacity = GENERATE(range(20, 60));
+    Size l_alignment = GENERATE(8, 64, 256);
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacityAndAlignment(l_array, l_capacity, l_alignment);
+
+    REQUIRE(l_array.m_Buffer != nullptr);
+    for(Size i = 0; i < l_capacity; ++i)
+    {
+        l_array.m_Buffer[i] = (int)i;
+    }
+    l_array.m_Size = l_capacity / 2;
+    Size l_oldSize = l_array.m_Size;
+
+    SECTION("Bigger")
+    {
+        SECTION("Defaults")
+        {
+            ResizeArrayToCapacityAndAlignment(l_array, l_capacity * 100, l_alignment);
+        }
+        SECTION("Customs")
+        {
+            bool l_called = false;
+
+            ResizeArrayToCapacityAndAlignmentUsingReallocator(
+                l_array, l_capacity * 100, l_alignment,
+                g_DEFAULT_ALIGNED_REALLOCATOR, &GeneralErrorCallback, &l_called
+            );
+
+            CHECK(l_called == false);
+        }
+
+        REQUIRE(l_array.m_Buffer != nullptr);
+        CHECK(l_array.m_Capacity == l_capacity * 100);
+        CHECK(l_array.m_Size == l_oldSize);
+        CHECK((uintptr_t)l_array.m_Buffer % l_alignment == 0);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            INFO("i = " << i);
+            CHECK(l_array.m_Buffer[i] == (int)i);
+        }
+    }
+    SECTION("Smaller than m_Size")
+    {
+        ResizeArrayToCapacityAndAlignment(l_array, l_oldSize / 2, l_alignment);
+
+        REQUIRE(l_array.m_Buffer != nullptr);
+        CHECK(l_array.m_Capacity == l_oldSize / 2);
+        CHECK(l_array.m_Size == l_oldSize / 2);
+        CHECK((uintptr_t)l_array.m_Buffer % l_alignment == 0);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            INFO("i = " << i);
+            CHECK(l_array.m_Buffer[i] == (int)i);
+        }
+    }
+    SECTION("Invalid alignment")
+    {
+        int* l_oldBuffer = l_array.m_Buffer;
+
+        ResizeArrayToCapacityAndAlignment(l_array, l_capacity * 2, 24);
+
+        CHECK(l_array.m_Buffer == l_oldBuffer);
+        CHECK(l_array.m_Capacity == l_capacity);
+        CHECK(l_array.m_Size == l_oldSize);
+    }
+    SECTION("Zero")
+    {
+        ResizeArrayToCapacityAndAlignment(l_array, 0, l_alignment);
+
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Capacity == 0);
+        CHECK(l_array.m_Size == 0);
+    }
+
+    DestroyArrayUsingDeallocator(l_array, g_DEFAULT_ALIGNED_DEALLOCATOR);
+
+}
+
 TEST_CASE("Increase array capacity", "[Array][Mutable][Capacity]")
 {
 
@@ -560,6 +643,360 @@ TEST_CASE("Decrease array capacity", "[Array][Mutable][Capacity]")
 
 }
 
+TEST_CASE("Find grown array capacity", "[Array][Mutable][Capacity]")
+{
+
+    Array<int> l_array;
+
+    SECTION("Enough capacity")
+    {
+        l_array.m_Capacity = 20;
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 20, ArrayGrowthPolicy::Double) == 20);
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 3, ArrayGrowthPolicy::OneAndAHalf) == 20);
+    }
+    SECTION("Growth factors")
+    {
+        l_array.m_Capacity = 100;
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 101, ArrayGrowthPolicy::Double) == 200);
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 101, ArrayGrowthPolicy::OneAndAHalf) == 150);
+        //150 * 4 = 600 bytes, the size classes after 512 are 640, 768...
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 101, ArrayGrowthPolicy::SizeClass) == 160);
+    }
+    SECTION("Needs more than the factor")
+    {
+        l_array.m_Capacity = 10;
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 1000, ArrayGrowthPolicy::Double) == 1000);
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 1000, ArrayGrowthPolicy::SizeClass) == 1024);
+    }
+    SECTION("Minimum")
+    {
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, 1, ArrayGrowthPolicy::OneAndAHalf) == g_ARRAY_MINIMUM_GROWN_CAPACITY);
+    }
+    SECTION("Overflow")
+    {
+        l_array.m_Capacity = SIZE_MAX / sizeof(int) - 1;
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, SIZE_MAX / sizeof(int), ArrayGrowthPolicy::Double) == SIZE_MAX / sizeof(int));
+        CHECK(FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(l_array, SIZE_MAX, ArrayGrowthPolicy::Double) == 0);
+    }
+
+}
+
+TEST_CASE("Reserve array capacity", "[Array][Mutable][Capacity]")
+{
+
+    Size l_capacity = GENERATE(Catch::Generators::range(20, 30));
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, l_capacity);
+    l_array.m_Size = l_capacity / 2;
+    for(Size i = 0; i < l_array.m_Size; ++i)
+    {
+        l_array[i] = (int)i;
+    }
+
+    SECTION("Bigger")
+    {
+        SECTION("Defaults")
+        {
+            ReserveArrayCapacity(l_array, l_capacity * 3);
+        }
+        SECTION("Customs")
+        {
+            bool l_called = false;
+            ReserveArrayCapacityUsingReallocator(
+                l_array, l_capacity * 3,
+                realloc, &GeneralErrorCallback, &l_called
+            );
+            CHECK(l_called == false);
+        }
+
+        REQUIRE(l_array.m_Buffer != nullptr);
+        CHECK(l_array.m_Capacity == l_capacity * 3);
+        CHECK(l_array.m_Size == l_capacity / 2);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            CHECK(l_array[i] == (int)i);
+        }
+    }
+    SECTION("Smaller does nothing")
+    {
+        int* l_oldBuffer = l_array.m_Buffer;
+
+        ReserveArrayCapacityUsingReallocator(
+            l_array, 1,
+            NullRealloc, nullptr, nullptr
+        );
+
+        CHECK(l_array.m_Buffer == l_oldBuffer);
+        CHECK(l_array.m_Capacity == l_capacity);
+        CHECK(l_array.m_Size == l_capacity / 2);
+    }
+    SECTION("Realloc error")
+    {
+        bool l_called = false;
+
+        ReserveArrayCapacityUsingReallocator(
+            l_array, l_capacity * 3,
+            NullRealloc, &GeneralErrorCallback, &l_called
+        );
+
+        CHECK(l_called == true);
+        CHECK(l_array.m_Capacity == l_capacity);
+        CHECK(l_array.m_Size == l_capacity / 2);
+    }
+
+    DestoryArray(l_array);
+
+}
+
+TEST_CASE("Shrink array capacity to size", "[Array][Mutable][Capacity]")
+{
+
+    Size l_capacity = GENERATE(Catch::Generators::range(20, 30));
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, l_capacity);
+
+    SECTION("Normal execution")
+    {
+        l_array.m_Size = l_capacity / 2;
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            l_array[i] = (int)i;
+        }
+
+        SECTION("Defaults")
+        {
+            ShrinkArrayCapacityToSize(l_array);
+        }
+        SECTION("Customs")
+        {
+            bool l_called = false;
+            ShrinkArrayCapacityToSizeUsingReallocator(
+                l_array,
+                realloc, &GeneralErrorCallback, &l_called
+            );
+            CHECK(l_called == false);
+        }
+
+        REQUIRE(l_array.m_Buffer != nullptr);
+        CHECK(l_array.m_Capacity == l_capacity / 2);
+        CHECK(l_array.m_Size == l_capacity / 2);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            CHECK(l_array[i] == (int)i);
+        }
+    }
+    SECTION("Empty array")
+    {
+        ShrinkArrayCapacityToSize(l_array);
+
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Capacity == 0);
+        CHECK(l_array.m_Size == 0);
+    }
+    SECTION("Null array")
+    {
+        Array<int> l_nullArray;
+
+        ShrinkArrayCapacityToSizeUsingReallocator(
+            l_nullArray,
+            NullRealloc, nullptr, nullptr
+        );
+
+        CHECK(l_nullArray.m_Buffer == nullptr);
+        CHECK(l_nullArray.m_Capacity == 0);
+    }
+    SECTION("Realloc error")
+    {
+        bool l_called = false;
+        l_array.m_Size = 3;
+
+        ShrinkArrayCapacityToSizeUsingReallocator(
+            l_array,
+            NullRealloc, &GeneralErrorCallback, &l_called
+        );
+
+        CHECK(l_called == true);
+        CHECK(l_array.m_Capacity == l_capacity);
+        CHECK(l_array.m_Size == 3);
+    }
+
+    DestoryArray(l_array);
+
+}
+
+TEST_CASE("Add item to end of array", "[Array][Mutable][Size][Capacity]")
+{
+
+    Array<int> l_array;
+
+    SECTION("Growth")
+    {
+        ArrayGrowthPolicy l_policy = GENERATE(
+            ArrayGrowthPolicy::OneAndAHalf,
+            ArrayGrowthPolicy::Double,
+            ArrayGrowthPolicy::SizeClass
+        );
+
+        Size l_reallocations = 0;
+        Size l_oldCapacity = 0;
+
+        for(Size i = 0; i < 10000; ++i)
+        {
+            AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+                (int)i, l_array, l_policy,
+                realloc, nullptr, nullptr
+            );
+
+            REQUIRE(l_array.m_Size == i + 1);
+            REQUIRE(l_array.m_Capacity >= l_array.m_Size);
+            if(l_array.m_Capacity != l_oldCapacity)
+            {
+                ++l_reallocations;
+                l_oldCapacity = l_array.m_Capacity;
+            }
+        }
+
+        //Geometric growth reallocates O(log n) times.
+        CHECK(l_reallocations < 30);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            REQUIRE(l_array[i] == (int)i);
+        }
+    }
+    SECTION("Defaults")
+    {
+        for(Size i = 0; i < 100; ++i)
+        {
+            AddItemToEndOfArray((int)i, l_array);
+        }
+
+        REQUIRE(l_array.m_Size == 100);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            CHECK(l_array[i] == (int)i);
+        }
+    }
+    SECTION("Item from the array itself")
+    {
+        AddItemToEndOfArray(5, l_array);
+        ShrinkArrayCapacityToSize(l_array);
+
+        //The array is full so the buffer the item is in gets reallocated.
+        for(Size i = 0; i < 20; ++i)
+        {
+            AddItemToEndOfArray(l_array[0], l_array);
+        }
+
+        REQUIRE(l_array.m_Size == 21);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            CHECK(l_array[i] == 5);
+        }
+    }
+    SECTION("Realloc error")
+    {
+        bool l_called = false;
+
+        AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            1, l_array, ArrayGrowthPolicy::Double,
+            NullRealloc, &GeneralErrorCallback, &l_called
+        );
+
+        CHECK(l_called == true);
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Size == 0);
+        CHECK(l_array.m_Capacity == 0);
+    }
+
+    DestoryArray(l_array);
+
+}
+
+TEST_CASE("Add array to end of array", "[Array][Mutable][Size][Capacity]")
+{
+
+    Array<int> l_array;
+    Array<int> l_toAdd;
+    CreateArrayAtOfCapacity(l_toAdd, 7);
+    l_toAdd.m_Size = 7;
+    for(Size i = 0; i < l_toAdd.m_Size; ++i)
+    {
+        l_toAdd[i] = (int)i;
+    }
+
+    SECTION("Normal execution")
+    {
+        bool l_useDefaults = GENERATE(true, false);
+
+        for(Size i = 0; i < 100; ++i)
+        {
+            if(l_useDefaults)
+            {
+                AddArrayToEndOfArray(l_toAdd, l_array);
+            }
+            else
+            {
+                bool l_called = false;
+                AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+                    l_toAdd, l_array, ArrayGrowthPolicy::OneAndAHalf,
+                    realloc, &GeneralErrorCallback, &l_called
+                );
+                CHECK(l_called == false);
+            }
+        }
+
+        REQUIRE(l_array.m_Size == 700);
+        CHECK(l_array.m_Capacity >= 700);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            REQUIRE(l_array[i] == (int)(i % 7));
+        }
+    }
+    SECTION("Adding to itself")
+    {
+        AddArrayToEndOfArray(l_toAdd, l_array);
+        AddArrayToEndOfArray(l_array, l_array);
+        AddArrayToEndOfArray(l_array, l_array);
+
+        REQUIRE(l_array.m_Size == 28);
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            CHECK(l_array[i] == (int)(i % 7));
+        }
+    }
+    SECTION("Empty addition array")
+    {
+        Array<int> l_empty;
+
+        AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            l_empty, l_array, ArrayGrowthPolicy::Double,
+            NullRealloc, nullptr, nullptr
+        );
+
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Size == 0);
+    }
+    SECTION("Realloc error")
+    {
+        bool l_called = false;
+
+        AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            l_toAdd, l_array, ArrayGrowthPolicy::Double,
+            NullRealloc, &GeneralErrorCallback, &l_called
+        );
+
+        CHECK(l_called == true);
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Size == 0);
+    }
+
+    DestoryArray(l_array);
+    DestoryArray(l_toAdd);
+
+}
+
 TEST_CASE("Reverse array", "[Array][Mutable]")
 {
 
@@ -926,6 +1363,90 @@ TEST_CASE("Add array to array abstract", "[Array][Mutable][Size][Capacity]")
 
 }
 
+//Only knows whether it was constructed, so assigning to a slot that was never
+//constructed is caught.
+struct ConstructedItem
+{
+    int m_Value;
+    ConstructedItem* m_Self;
+
+    ConstructedItem(int p_value): m_Value(p_value), m_Self(this) {}
+    ConstructedItem(const ConstructedItem& p_other): m_Value(p_other.m_Value), m_Self(this) {}
+    ConstructedItem(ConstructedItem&& p_other): m_Value(p_other.m_Value), m_Self(this)
+    {
+        p_other.m_Value = -1;
+    }
+    ConstructedItem& operator= (const ConstructedItem& p_other)
+    {
+        REQUIRE(m_Self == this);
+        m_Value = p_other.m_Value;
+        return *this;
+    }
+    ConstructedItem& operator= (ConstructedItem&& p_other)
+    {
+        REQUIRE(m_Self == this);
+        m_Value = p_other.m_Value;
+        p_other.m_Value = -1;
+        return *this;
+    }
+};
+
+TEST_CASE("Add and remove items that are not trivially copyable", "[Array][Mutable][Size]")
+{
+
+    Array<ConstructedItem> l_array;
+    Array<ConstructedItem> l_additionArray;
+    CreateArrayAtOfCapacity(l_array, 30);
+    CreateArrayAtOfCapacity(l_additionArray, 5);
+
+    for(int i = 0; i < 10; ++i)
+    {
+        new(l_array.m_Buffer + i) ConstructedItem(i);
+    }
+    l_array.m_Size = 10;
+    for(int i = 0; i < 5; ++i)
+    {
+        new(l_additionArray.m_Buffer + i) ConstructedItem(100 + i);
+    }
+    l_additionArray.m_Size = 5;
+
+    //Both shifted items and added items end up in slots that were and were not
+    //constructed before.
+    Size l_index = GENERATE(range((Size)0, (Size)10));
+    AddArrayToArrayAfterIndexNoErrorCheckAssumingEnoughCapacity(l_additionArray, l_array, l_index);
+
+    REQUIRE(l_array.m_Size == 15);
+    for(Size i = 0; i < l_array.m_Size; ++i)
+    {
+        int l_expected;
+        if(i <= l_index)
+        {
+            l_expected = (int)i;
+        }
+        else if(i <= l_index + 5)
+        {
+            l_expected = 100 + (int)(i - l_index - 1);
+        }
+        else
+        {
+            l_expected = (int)(i - 5);
+        }
+        CHECK(l_array.m_Buffer[i].m_Value == l_expected);
+        CHECK(l_array.m_Buffer[i].m_Self == l_array.m_Buffer + i);
+    }
+
+    RemoveNumberOfItemsStartingFromAndIncludingIndexNoErrorCheckFromArray(4, l_index + 1, l_array);
+    REQUIRE(l_array.m_Size == 10);
+    for(Size i = 0; i < l_array.m_Size; ++i)
+    {
+        CHECK(l_array.m_Buffer[i].m_Value == (int)i);
+    }
+
+    DestoryArray(l_additionArray);
+    DestoryArray(l_array);
+
+}
+
 TEST_CASE("Remove items simple", "[Array][Mutable][Size]")
 {
 
@@ -1138,3 +1659,375 @@ TEST_CASE("Remove each instance of item", "[Array][Mutable][Size]")
     DestoryArray(l_items);
 
 }
+
+TEMPLATE_TEST_CASE("Remove each instance of items matches a slow removal", "[Array][Mutable][Size]", char, int, double)
+{
+
+    srand(GENERATE(1, 2, 3));
+    //Below and above the hash set threshold.
+    Size l_itemCount = GENERATE((Size)3, (Size)100);
+    ArrayRemovalOrder l_order = GENERATE(ArrayRemovalOrder::Stable, ArrayRemovalOrder::Unstable);
+
+    Array<TestType> l_array;
+    Array<TestType> l_items;
+    CreateArrayAtOfCapacity(l_array, 1000);
+    CreateArrayAtOfCapacity(l_items, l_itemCount);
+
+    for(Size i = 0; i < l_array.m_Capacity; ++i)
+    {
+        l_array[l_array.m_Size++] = (TestType)(rand() % 200 - 50);
+    }
+    for(Size i = 0; i < l_items.m_Capacity; ++i)
+    {
+        //Repeated items and 0 are both in here sometimes.
+        l_items[l_items.m_Size++] = (TestType)(rand() % 200 - 50);
+    }
+
+    //The kept items, in order.
+    Array<TestType> l_expected;
+    CreateArrayAtOfCapacity(l_expected, l_array.m_Size);
+    for(Size i = 0; i < l_array.m_Size; ++i)
+    {
+        bool l_removed = false;
+        for(Size n = 0; n < l_items.m_Size; ++n)
+        {
+            l_removed = l_removed || l_items[n] == l_array[i];
+        }
+        if(!l_removed)
+        {
+            l_expected[l_expected.m_Size++] = l_array[i];
+        }
+    }
+
+    TestType* l_oldBuffer = l_array.m_Buffer;
+    bool l_called = false;
+
+    SECTION("Normal removal")
+    {
+        RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator(
+            l_items, l_array, l_order, malloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(!l_called);
+    }
+    SECTION("Allocation failure")
+    {
+        RemoveEachInstanceOfArrayOfItemsFromArrayUsingAllocatorAndDeallocator(
+            l_items, l_array, l_order, NullMalloc, free, GeneralErrorCallback, &l_called
+        );
+        //Only the hash set allocates.
+        CHECK(l_called == (g_ARRAY_ITEMS_ARE_HASHABLE<TestType> &&
+            !g_ARRAY_ITEMS_ARE_BYTES<TestType> &&
+            l_itemCount >= g_ARRAY_REMOVAL_HASH_SET_THRESHOLD));
+    }
+
+    REQUIRE(l_array.m_Buffer == l_oldBuffer);
+    REQUIRE(l_array.m_Capacity == 1000);
+    REQUIRE(l_array.m_Size == l_expected.m_Size);
+    if(l_order == ArrayRemovalOrder::Stable)
+    {
+        for(Size i = 0; i < l_expected.m_Size; ++i)
+        {
+            REQUIRE(l_array[i] == l_expected[i]);
+        }
+    }
+    else
+    {
+        for(Size i = 0; i < l_expected.m_Size; ++i)
+        {
+            REQUIRE(FindNumberOfInstanceOfArrayInArray<TestType>(l_expected[i], l_array) ==
+                FindNumberOfInstanceOfArrayInArray<TestType>(l_expected[i], l_expected));
+        }
+    }
+
+    DestoryArray(l_expected);
+    DestoryArray(l_items);
+    DestoryArray(l_array);
+
+}
+
+enum class SortInput
+{
+    Random,
+    Sorted,
+    Reversed,
+    FewDistinct,
+    OrganPipe
+};
+
+//Fills p_array up to its capacity with items shaped like p_input.
+template<typename T>
+static void FillArrayForSorting(Array<T>& p_array, const SortInput& p_input)
+{
+
+    Size l_count = p_array.m_Capacity;
+    for(Size i = 0; i < l_count; ++i)
+    {
+        int l_value = 0;
+        switch(p_input)
+        {
+        case SortInput::Random: l_value = rand() % 2000 - 1000; break;
+        case SortInput::Sorted: l_value = (int)i - 50; break;
+        case SortInput::Reversed: l_value = (int)(l_count - i) - 50; break;
+        case SortInput::FewDistinct: l_value = rand() % 4; break;
+        case SortInput::OrganPipe: l_value = (int)(i < l_count / 2 ? i : l_count - i) - 50; break;
+        }
+        p_array.m_Buffer[p_array.m_Size++] = (T)l_value;
+    }
+
+}
+
+//Sorts p_array the slow way, by insertion.
+template<typename T>
+static void SortArraySlowly(Array<T>& p_array)
+{
+
+    T* l_items = p_array.m_Buffer;
+    for(Size i = 1; i < p_array.m_Size; ++i)
+    {
+        for(Size n = i; n > 0 && l_items[n] < l_items[n - 1]; --n)
+        {
+            T l_temp = l_items[n];
+            l_items[n] = l_items[n - 1];
+            l_items[n - 1] = l_temp;
+        }
+    }
+
+}
+
+TEMPLATE_TEST_CASE("Sort array matches a slow sort", "[Array][Mutable][Sort]", char, int, int64_t, double)
+{
+
+    srand(GENERATE(1, 2));
+    //Around the insertion sort and ninther thresholds and the partition
+    //block size.
+    Size l_size = GENERATE((Size)0, (Size)1, (Size)2, (Size)24, (Size)25, (Size)129, (Size)600);
+    SortInput l_input = GENERATE(
+        SortInput::Random, SortInput::Sorted, SortInput::Reversed,
+        SortInput::FewDistinct, SortInput::OrganPipe
+    );
+
+    Array<TestType> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size);
+    FillArrayForSorting(l_array, l_input);
+
+    Array<TestType> l_expected;
+    CreateCopyAtOfArray(l_expected, l_array);
+    SortArraySlowly(l_expected);
+
+    SECTION("Introsort")
+    {
+        SortArray(l_array);
+    }
+    SECTION("Introsort by a comparator")
+    {
+        //Sort the other way and reverse.
+        SortArrayUsingComparator(
+            l_array,
+            [](const TestType& p_left, const TestType& p_right) { return p_right < p_left; }
+        );
+        ReverseArray(l_array);
+    }
+    SECTION("Stable sort")
+    {
+        StableSortArray(l_array);
+    }
+    SECTION("Stable sort without scratch memory")
+    {
+        bool l_called = false;
+        StableSortArrayUsingComparatorAndAllocatorAndDeallocator(
+            l_array,
+            [](const TestType& p_left, const TestType& p_right) { return p_left < p_right; },
+            NullMalloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == (l_size > g_ARRAY_INSERTION_SORT_THRESHOLD));
+    }
+    if constexpr(std::is_integral_v<TestType>)
+    {
+        SECTION("Radix sort")
+        {
+            SortArrayOfIntegers(l_array);
+        }
+        SECTION("Radix sort without scratch memory")
+        {
+            bool l_called = false;
+            SortArrayOfIntegersUsingAllocatorAndDeallocator(
+                l_array, NullMalloc, free, GeneralErrorCallback, &l_called
+            );
+            CHECK(l_called == (l_size >= g_ARRAY_RADIX_SORT_THRESHOLD));
+        }
+    }
+
+    REQUIRE(l_array.m_Size == l_size);
+    REQUIRE(l_array == l_expected);
+
+    DestoryArray(l_expected);
+    DestoryArray(l_array);
+
+}
+
+//Counts how many times an item was copy assigned.
+struct CopyCountedItem
+{
+    static Size s_Copies;
+    int m_Value;
+
+    CopyCountedItem(int p_value): m_Value(p_value) {}
+    CopyCountedItem(const CopyCountedItem& p_other) = default;
+    CopyCountedItem& operator= (const CopyCountedItem& p_other)
+    {
+        ++s_Copies;
+        m_Value = p_other.m_Value;
+        return *this;
+    }
+    CopyCountedItem& operator= (CopyCountedItem&& p_other) = default;
+};
+Size CopyCountedItem::s_Copies = 0;
+
+TEST_CASE("Kept items are moved over instead of copied", "[Array][Mutable][Size]")
+{
+
+    ArrayRemovalOrder l_order = GENERATE(ArrayRemovalOrder::Stable, ArrayRemovalOrder::Unstable);
+
+    Array<CopyCountedItem> l_array;
+    CreateArrayAtOfCapacity(l_array, 20);
+    for(int i = 0; i < 20; ++i)
+    {
+        new(l_array.m_Buffer + i) CopyCountedItem(i);
+    }
+    l_array.m_Size = 20;
+
+    CopyCountedItem::s_Copies = 0;
+    RemoveEachItemForWhichFunctionReturnsTrueFromArray(
+        l_array, l_order,
+        [](const CopyCountedItem& p_item) { return p_item.m_Value % 3 == 0; }
+    );
+
+    CHECK(CopyCountedItem::s_Copies == 0);
+    REQUIRE(l_array.m_Size == 13);
+    for(Size i = 0; i < l_array.m_Size; ++i)
+    {
+        CHECK(l_array.m_Buffer[i].m_Value % 3 != 0);
+    }
+
+    DestoryArray(l_array);
+
+}
+
+TEST_CASE("Items added to the end are constructed instead of assigned", "[Array][Mutable][Size]")
+{
+
+    Array<CopyCountedItem> l_array;
+    CopyCountedItem::s_Copies = 0;
+
+    for(int i = 0; i < 20; ++i)
+    {
+        AddItemToEndOfArray(CopyCountedItem(i), l_array);
+    }
+    //Repeats the items, the slots past m_Size are new each time.
+    AddArrayToEndOfArray(l_array, l_array);
+
+    CHECK(CopyCountedItem::s_Copies == 0);
+    REQUIRE(l_array.m_Size == 40);
+    for(Size i = 0; i < l_array.m_Size; ++i)
+    {
+        CHECK(l_array.m_Buffer[i].m_Value == (int)(i % 20));
+    }
+
+    DestoryArray(l_array);
+
+}
+
+struct KeyedItem
+{
+    int64_t m_Key;
+    Size m_Index;
+};
+
+TEST_CASE("Stable sorts keep the order of equal items", "[Array][Mutable][Sort]")
+{
+
+    srand(GENERATE(1, 2, 3));
+    Size l_size = GENERATE((Size)20, (Size)1000);
+
+    Array<KeyedItem> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        //Negative keys and keys that only differ in high bytes.
+        int64_t l_key = (int64_t)(rand() % 16 - 8) * ((int64_t)1 << 40);
+        l_array[l_array.m_Size++] = KeyedItem{l_key, i};
+    }
+
+    SECTION("Merge sort")
+    {
+        StableSortArrayUsingComparator(
+            l_array,
+            [](const KeyedItem& p_left, const KeyedItem& p_right) { return p_left.m_Key < p_right.m_Key; }
+        );
+    }
+    SECTION("Merge sort without scratch memory")
+    {
+        StableSortArrayUsingComparatorAndAllocatorAndDeallocator(
+            l_array,
+            [](const KeyedItem& p_left, const KeyedItem& p_right) { return p_left.m_Key < p_right.m_Key; },
+            NullMalloc, free, nullptr, nullptr
+        );
+    }
+    SECTION("Radix sort by key")
+    {
+        SortArrayByIntegerKey(l_array, [](const KeyedItem& p_item) { return p_item.m_Key; });
+    }
+
+    for(Size i = 1; i < l_size; ++i)
+    {
+        REQUIRE(l_array[i - 1].m_Key <= l_array[i].m_Key);
+        if(l_array[i - 1].m_Key == l_array[i].m_Key)
+        {
+            REQUIRE(l_array[i - 1].m_Index < l_array[i].m_Index);
+        }
+    }
+
+    DestoryArray(l_array);
+
+}
+
+TEST_CASE("Sort items that are not trivially copyable", "[Array][Mutable][Sort]")
+{
+
+    srand(GENERATE(1, 2));
+    const Size l_size = 500;
+
+    Array<ConstructedItem> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        new(l_array.m_Buffer + i) ConstructedItem(rand() % 100);
+    }
+    l_array.m_Size = l_size;
+
+    auto l_isBefore = [](const ConstructedItem& p_left, const ConstructedItem& p_right)
+    {
+        return p_left.m_Value < p_right.m_Value;
+    };
+
+    SECTION("Introsort")
+    {
+        SortArrayUsingComparator(l_array, l_isBefore);
+    }
+    SECTION("Stable sort")
+    {
+        StableSortArrayUsingComparator(l_array, l_isBefore);
+    }
+
+    for(Size i = 0; i < l_size; ++i)
+    {
+        CHECK(l_array.m_Buffer[i].m_Self == l_array.m_Buffer + i);
+        if(i > 0)
+        {
+            REQUIRE(l_array.m_Buffer[i - 1].m_Value <= l_array.m_Buffer[i].m_Value);
+        }
+    }
+
+    DestoryArray(l_array);
+
+}
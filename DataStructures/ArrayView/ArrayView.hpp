@@ -0,0 +1,595 @@
+/** @file ArrayView.hpp
+ * @brief Defines everything in the @ref ArrayViewMod module.
+ *
+ */
+
+#ifndef ARRAY_VIEW__DATA_STRUCTURES_ARRAY_VIEW_ARRAY_VIEW_HPP
+#define ARRAY_VIEW__DATA_STRUCTURES_ARRAY_VIEW_ARRAY_VIEW_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+#include <stdlib.h>
+#include <type_traits>
+
+namespace Library::DataStructures::ArrayView
+{
+
+    /**
+     * @brief A range of items of type T that are owned by something else,
+     * like part of an array.
+     *
+     * @details A view is only a pointer to its first item and its number of
+     * items, it never allocates or deallocates. Slicing, splitting and
+     * windowing a view give views of its items, so a parser can cut its input
+     * into pieces without copying any of them.
+     *
+     * The read only functions of the @ref ArrayMod module that search and
+     * compare, like
+     * @ref Library::DataStructures::Array::FindIndexOfFirstOccurrenceOfArrayInArray "FindIndexOfFirstOccurrenceOfArrayInArray",
+     * @ref Library::DataStructures::Array::ArrayStartsWithArray "ArrayStartsWithArray"
+     * and ==, can be given views in place of any of their arrays, see
+     * @ref FindArrayOfView for how. Indexes they return are indexes into the
+     * view.
+     *
+     * T may be const, an ArrayView<const T> can be made from an Array<T> or
+     * an ArrayView<T> and does not let its items be changed.
+     *
+     * @warning The items must stay valid for as long as the view is used.
+     *
+     */
+    template<typename T>
+    struct ArrayView
+    {
+
+        /**
+         * @brief The first item, null for a null view.
+         *
+         */
+        T* m_Buffer;
+        /**
+         * @brief The number of items.
+         *
+         */
+        Size m_Size;
+
+        /**
+         * @brief Creates a null view, without items.
+         *
+         */
+        ArrayView():
+        m_Buffer(nullptr),
+        m_Size(0)
+        {
+            LogDebugLine("Constructing null array view at " << this);
+        }
+        /**
+         * @brief Creates a view of the p_size items starting at p_buffer.
+         *
+         */
+        ArrayView(T* const p_buffer, const Size& p_size):
+        m_Buffer(p_buffer),
+        m_Size(p_size)
+        {
+            LogDebugLine("Constructing array view of " << p_size << " items at "
+            << (void*)p_buffer << " at " << this);
+        }
+        /**
+         * @brief Creates a view of all items of p_array.
+         *
+         */
+        ArrayView(const Array::Array<std::remove_const_t<T>>& p_array):
+        m_Buffer(p_array.m_Buffer),
+        m_Size(p_array.m_Buffer == nullptr ? 0 : p_array.m_Size)
+        {
+            LogDebugLine("Constructing array view of array " << p_array << " at " << this);
+        }
+        /**
+         * @brief Creates a readonly view of the items of p_view.
+         *
+         */
+        template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_const_v<U>>>
+        ArrayView(const ArrayView<U>& p_view):
+        m_Buffer(p_view.m_Buffer),
+        m_Size(p_view.m_Size)
+        {
+            LogDebugLine("Constructing readonly array view at " << this);
+        }
+
+        /**
+         * @brief Returns m_Buffer[p_index].
+         *
+         * @details If p_index is not less than m_Size the behaviour is
+         * undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in which case the
+         * process is aborted.
+         *
+         */
+        T& operator[] (const Size& p_index) const
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(p_index >= m_Size)
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in array view " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return m_Buffer[p_index];
+        }
+
+        /**
+         * @brief Returns @ref m_Buffer, where the items start.
+         *
+         * @details Together with @ref end this lets the items be looped over
+         * with a range based for loop, the same as for arrays.
+         *
+         */
+        T* begin() const
+        {
+            return m_Buffer;
+        }
+        /**
+         * @brief Returns @ref m_Buffer + @ref m_Size, right after the last
+         * item.
+         *
+         */
+        T* end() const
+        {
+            return m_Buffer + m_Size;
+        }
+
+    };
+
+    /**
+     * @brief True if T is an ArrayView.
+     *
+     */
+    template<typename T>
+    constexpr bool g_IS_ARRAY_VIEW = false;
+    template<typename T>
+    constexpr bool g_IS_ARRAY_VIEW<ArrayView<T>> = true;
+
+    /**
+     * @brief Returns an array with the items of p_view, that can be given to
+     * any read only function of the @ref ArrayMod module.
+     *
+     * @details The array has the buffer of p_view and its size as its size
+     * and capacity, so nothing is copied or allocated. For a readonly view
+     * the constness of the items is cast away, the array must then only be
+     * given to functions that do not change items.
+     *
+     * The functions of this module that take views in place of arrays all
+     * call their array version with the result of this.
+     *
+     */
+    template<typename T>
+    inline Array::Array<std::remove_const_t<T>> FindArrayOfView(const ArrayView<T>& p_view)
+    {
+        return Array::Array<std::remove_const_t<T>>(
+            const_cast<std::remove_const_t<T>*>(p_view.m_Buffer),
+            p_view.m_Size
+        );
+    }
+    /**
+     * @brief Returns p_array, so the functions that take views in place of
+     * arrays can also be given arrays.
+     *
+     */
+    template<typename T>
+    inline const Array::Array<T>& FindArrayOfView(const Array::Array<T>& p_array)
+    {
+        return p_array;
+    }
+
+    /**
+     * @brief Enables the functions of this module that take an array or a
+     * view in place of each array, when at least one of A and B is a view.
+     * When both are arrays the functions of the @ref ArrayMod module are
+     * used.
+     *
+     */
+    template<typename A, typename B>
+    using EnableIfEitherIsArrayView = std::enable_if_t<g_IS_ARRAY_VIEW<A> || g_IS_ARRAY_VIEW<B>, int>;
+
+
+    /**
+     * @brief Returns a view of p_size items of p_view, starting from index
+     * p_index.
+     *
+     * @details If p_index is greater than p_view.m_Size it is taken to be
+     * p_view.m_Size, if there are less than p_size items from p_index on
+     * the view has only those. Slicing a null view gives a null view.
+     *
+     * @time O(1)
+     *
+     */
+    template<typename T>
+    ArrayView<T> FindSliceOfViewFromIndexOfSize(const ArrayView<T>& p_view, Size p_index, Size p_size)
+    {
+
+        LogDebugLine("Slicing " << p_size << " items from index " << p_index
+        << " of array view " << p_view);
+
+        if(p_view.m_Buffer == nullptr)
+        {
+            return ArrayView<T>();
+        }
+
+        p_index = p_index < p_view.m_Size ? p_index : p_view.m_Size;
+        p_size = p_size < p_view.m_Size - p_index ? p_size : p_view.m_Size - p_index;
+        return ArrayView<T>(p_view.m_Buffer + p_index, p_size);
+
+    }
+
+    /**
+     * @brief Removes p_count items from the start of p_view, which then
+     * starts at the item after them.
+     *
+     * @details If p_view has less than p_count items it is left with none.
+     * Used to move over input that was read.
+     *
+     * @time O(1)
+     *
+     */
+    template<typename T>
+    void RemoveNumberOfItemsFromStartOfView(const Size& p_count, ArrayView<T>& p_view)
+    {
+        Size l_count = p_count < p_view.m_Size ? p_count : p_view.m_Size;
+        p_view.m_Buffer += l_count;
+        p_view.m_Size -= l_count;
+    }
+    /**
+     * @brief Removes p_count items from the end of p_view.
+     *
+     * @details If p_view has less than p_count items it is left with none.
+     *
+     * @time O(1)
+     *
+     */
+    template<typename T>
+    void RemoveNumberOfItemsFromEndOfView(const Size& p_count, ArrayView<T>& p_view)
+    {
+        p_view.m_Size -= p_count < p_view.m_Size ? p_count : p_view.m_Size;
+    }
+
+    /**
+     * @brief Sets outp_before to a view of the first p_index items of
+     * p_view and outp_after to a view of the rest.
+     *
+     * @details If p_index is greater than p_view.m_Size it is taken to be
+     * p_view.m_Size. p_view may be outp_before or outp_after.
+     *
+     * @time O(1)
+     *
+     */
+    template<typename T>
+    void SplitViewAtIndex(
+        const ArrayView<T>& p_view,
+        const Size& p_index,
+        ArrayView<T>& outp_before,
+        ArrayView<T>& outp_after
+    )
+    {
+
+        LogDebugLine("Splitting array view " << p_view << " at index " << p_index);
+
+        ArrayView<T> l_view = p_view;
+        outp_before = FindSliceOfViewFromIndexOfSize(l_view, 0, p_index);
+        outp_after = FindSliceOfViewFromIndexOfSize(l_view, p_index, l_view.m_Size);
+
+    }
+
+    /**
+     * @brief Splits p_view around the first occurrence of p_separator,
+     * outp_before getting the items before it and outp_after the items after
+     * it.
+     *
+     * @details The separator is found using
+     * @ref Library::DataStructures::Array::FindIndexOfFirstOccurrenceOfArrayInArray "FindIndexOfFirstOccurrenceOfArrayInArray",
+     * its items are in neither view. If it is not found, or is empty,
+     * outp_before is p_view, outp_after has no items and false is returned.
+     * p_view may be outp_before or outp_after.
+     *
+     * @param p_view The view to split.
+     * @param p_separator An array or view of the items to split at.
+     * @param outp_before Set to the items before the separator.
+     * @param outp_after Set to the items after the separator.
+     * @return True if the separator was found.
+     *
+     * @time O(n + m), n being p_view.m_Size and m the size of p_separator.
+     *
+     */
+    template<typename T, typename S>
+    bool SplitViewAtFirstOccurrenceOfArray(
+        const ArrayView<T>& p_view,
+        const S& p_separator,
+        ArrayView<T>& outp_before,
+        ArrayView<T>& outp_after
+    )
+    {
+
+        LogDebugLine("Splitting array view " << p_view << " at the first separator.");
+
+        ArrayView<T> l_view = p_view;
+        auto&& l_separator = FindArrayOfView(p_separator);
+        Size l_index = Array::FindIndexOfFirstOccurrenceOfArrayInArray(l_separator, FindArrayOfView(l_view));
+        if(l_index >= l_view.m_Size)
+        {
+            LogDebugLine("The separator was not found.");
+            outp_before = l_view;
+            outp_after = FindSliceOfViewFromIndexOfSize(l_view, l_view.m_Size, 0);
+            return false;
+        }
+
+        outp_before = FindSliceOfViewFromIndexOfSize(l_view, 0, l_index);
+        outp_after = FindSliceOfViewFromIndexOfSize(l_view, l_index + l_separator.m_Size, l_view.m_Size);
+        return true;
+
+    }
+
+    /**
+     * @brief Calls p_function with a view of each part of p_view between
+     * occurrences of p_separator, in order.
+     *
+     * @details The separators are found the same way as by
+     * @ref SplitViewAtFirstOccurrenceOfArray and are in none of the parts.
+     * Parts may have no items, as between two separators next to each other,
+     * so a view with k separators always has k + 1 parts. A null view has
+     * no parts.
+     *
+     * @param p_view The view to split.
+     * @param p_separator An array or view of the items between parts.
+     * @param p_function Called with an ArrayView<T>.
+     *
+     * @time O(n + k * m), n being p_view.m_Size, k the number of separators
+     * and m the size of p_separator.
+     *
+     */
+    template<typename T, typename S, typename F>
+    void ForEachPartOfViewSeparatedByArray(const ArrayView<T>& p_view, const S& p_separator, F&& p_function)
+    {
+
+        LogDebugLine("Calling a function for each part of array view " << p_view);
+
+        if(p_view.m_Buffer == nullptr)
+        {
+            LogDebugLine("The view is null, returning.");
+            return;
+        }
+
+        ArrayView<T> l_rest = p_view;
+        ArrayView<T> l_part;
+        while(SplitViewAtFirstOccurrenceOfArray(l_rest, p_separator, l_part, l_rest))
+        {
+            p_function(l_part);
+        }
+        p_function(l_part);
+
+    }
+
+    /**
+     * @brief Calls p_function with a view of each p_windowSize items of
+     * p_view, the first starting at index 0 and each one p_step items after
+     * the one before.
+     *
+     * @details Windows that would go past the end are not given, so if
+     * p_view has less than p_windowSize items p_function is not called. If
+     * p_windowSize or p_step is 0 p_function is not called.
+     *
+     * @param p_view The view to go over.
+     * @param p_windowSize The number of items of each window.
+     * @param p_step The number of items between the starts of windows.
+     * Windows overlap if it is less than p_windowSize.
+     * @param p_function Called with an ArrayView<T>.
+     *
+     * @time O(n / p_step), n being p_view.m_Size, plus whatever p_function
+     * takes.
+     *
+     */
+    template<typename T, typename F>
+    void ForEachWindowOfView(
+        const ArrayView<T>& p_view,
+        const Size& p_windowSize,
+        const Size& p_step,
+        F&& p_function
+    )
+    {
+
+        LogDebugLine("Calling a function for each window of " << p_windowSize
+        << " items of array view " << p_view);
+
+        if(p_windowSize == 0 || p_step == 0 || p_view.m_Size < p_windowSize)
+        {
+            LogDebugLine("There are no windows, returning.");
+            return;
+        }
+
+        for(Size i = 0; i <= p_view.m_Size - p_windowSize; i += p_step)
+        {
+            p_function(ArrayView<T>(p_view.m_Buffer + i, p_windowSize));
+            if(p_step > p_view.m_Size - p_windowSize - i)
+            {
+                break;
+            }
+        }
+
+    }
+
+
+    /**
+     * @brief @ref Library::DataStructures::Array::FindIndexOfFirstOccurrenceOfArrayInArray "FindIndexOfFirstOccurrenceOfArrayInArray"
+     * for views, each of p_toFind and p_array may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline Size FindIndexOfFirstOccurrenceOfArrayInArray(const A& p_toFind, const B& p_array)
+    {
+        return Array::FindIndexOfFirstOccurrenceOfArrayInArray(FindArrayOfView(p_toFind), FindArrayOfView(p_array));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::FindIndexOfLastOccurrenceOfArrayInArray "FindIndexOfLastOccurrenceOfArrayInArray"
+     * for views, each of p_toFind and p_array may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline Size FindIndexOfLastOccurrenceOfArrayInArray(const A& p_toFind, const B& p_array)
+    {
+        return Array::FindIndexOfLastOccurrenceOfArrayInArray(FindArrayOfView(p_toFind), FindArrayOfView(p_array));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::FindNumberOfInstanceOfArrayInArray "FindNumberOfInstanceOfArrayInArray"
+     * for views, each of p_toFind and p_array may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline Size FindNumberOfInstanceOfArrayInArray(const A& p_toFind, const B& p_array)
+    {
+        return Array::FindNumberOfInstanceOfArrayInArray(FindArrayOfView(p_toFind), FindArrayOfView(p_array));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::ArrayContainsArray "ArrayContainsArray"
+     * for views, each of p_array and p_toFind may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline bool ArrayContainsArray(const A& p_array, const B& p_toFind)
+    {
+        return Array::ArrayContainsArray(FindArrayOfView(p_array), FindArrayOfView(p_toFind));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::ArrayStartsWithArray "ArrayStartsWithArray"
+     * for views, each of p_array and p_start may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline bool ArrayStartsWithArray(const A& p_array, const B& p_start)
+    {
+        return Array::ArrayStartsWithArray(FindArrayOfView(p_array), FindArrayOfView(p_start));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::ArrayEndsWithArray "ArrayEndsWithArray"
+     * for views, each of p_array and p_end may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline bool ArrayEndsWithArray(const A& p_array, const B& p_end)
+    {
+        return Array::ArrayEndsWithArray(FindArrayOfView(p_array), FindArrayOfView(p_end));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::FindIndexOfFirstMismatchOfArrayAndArray
+     * "FindIndexOfFirstMismatchOfArrayAndArray" for views, each of p_left and
+     * p_right may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline Size FindIndexOfFirstMismatchOfArrayAndArray(const A& p_left, const B& p_right)
+    {
+        return Array::FindIndexOfFirstMismatchOfArrayAndArray(FindArrayOfView(p_left), FindArrayOfView(p_right));
+    }
+    /**
+     * @brief Returns true if p_view has a null buffer or no items, see
+     * @ref Library::DataStructures::Array::ArrayIsEmpty "ArrayIsEmpty".
+     *
+     */
+    template<typename T>
+    inline bool ArrayIsEmpty(const ArrayView<T>& p_view)
+    {
+        return p_view.m_Buffer == nullptr || p_view.m_Size == 0;
+    }
+
+    /**
+     * @brief @ref Library::DataStructures::Array::FindIndexOfFirstOccurrenceOfArrayNeedleInArray "FindIndexOfFirstOccurrenceOfArrayNeedleInArray"
+     * for views.
+     *
+     */
+    template<typename T, typename U>
+    inline Size FindIndexOfFirstOccurrenceOfArrayNeedleInArray(
+        const Array::ArrayNeedle<T>& p_needle,
+        const ArrayView<U>& p_view
+    )
+    {
+        return Array::FindIndexOfFirstOccurrenceOfArrayNeedleInArray(p_needle, FindArrayOfView(p_view));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::FindIndexOfLastOccurrenceOfArrayNeedleInArray "FindIndexOfLastOccurrenceOfArrayNeedleInArray"
+     * for views.
+     *
+     */
+    template<typename T, typename U>
+    inline Size FindIndexOfLastOccurrenceOfArrayNeedleInArray(
+        const Array::ArrayNeedle<T>& p_needle,
+        const ArrayView<U>& p_view
+    )
+    {
+        return Array::FindIndexOfLastOccurrenceOfArrayNeedleInArray(p_needle, FindArrayOfView(p_view));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::FindNumberOfInstanceOfArrayNeedleInArray "FindNumberOfInstanceOfArrayNeedleInArray"
+     * for views.
+     *
+     */
+    template<typename T, typename U>
+    inline Size FindNumberOfInstanceOfArrayNeedleInArray(
+        const Array::ArrayNeedle<T>& p_needle,
+        const ArrayView<U>& p_view
+    )
+    {
+        return Array::FindNumberOfInstanceOfArrayNeedleInArray(p_needle, FindArrayOfView(p_view));
+    }
+    /**
+     * @brief @ref Library::DataStructures::Array::ArrayContainsArrayNeedle "ArrayContainsArrayNeedle"
+     * for views.
+     *
+     */
+    template<typename T, typename U>
+    inline bool ArrayContainsArrayNeedle(const ArrayView<U>& p_view, const Array::ArrayNeedle<T>& p_needle)
+    {
+        return Array::ArrayContainsArrayNeedle(FindArrayOfView(p_view), p_needle);
+    }
+
+    /**
+     * @brief Compares the items of p_left and p_right the same as
+     * @ref Library::DataStructures::Array::Array::operator== "Array's ==",
+     * each may be an array or a view.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline bool operator== (const A& p_left, const B& p_right)
+    {
+        return FindArrayOfView(p_left) == FindArrayOfView(p_right);
+    }
+    /**
+     * @brief Returns the NOT value of ==.
+     *
+     */
+    template<typename A, typename B, EnableIfEitherIsArrayView<A, B> = 0>
+    inline bool operator!= (const A& p_left, const B& p_right)
+    {
+        return !(p_left == p_right);
+    }
+
+
+    #ifdef DEBUG
+    /**
+     * @brief Logs the fields of p_view, its items are not logged.
+     *
+     */
+    template<typename T>
+    const Debugging::Log& operator<< (const Debugging::Log& p_log, const ArrayView<T>& p_view)
+    {
+
+        p_log << &p_view;
+        p_log << " { m_Buffer = " << (const void*)p_view.m_Buffer;
+        p_log << ", m_Size = " << p_view.m_Size;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+}
+
+#endif //ARRAY_VIEW__DATA_STRUCTURES_ARRAY_VIEW_ARRAY_VIEW_HPP
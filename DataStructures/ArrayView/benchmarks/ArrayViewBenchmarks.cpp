@@ -0,0 +1,94 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../ArrayView.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ArrayView;
+
+//The size of the text that is tokenized, 16MiB of chars.
+static const Size g_TEXT_SIZE = 16 * 1024 * 1024;
+
+//Lines of random length, some of them starting with "GET ".
+static Array<char> CreateText()
+{
+
+    Array<char> l_text;
+    CreateArrayAtOfCapacity(l_text, g_TEXT_SIZE);
+    srand(42);
+
+    Size l_lineEnd = 0;
+    for(Size i = 0; i < g_TEXT_SIZE; ++i)
+    {
+        if(i == l_lineEnd)
+        {
+            l_text.m_Buffer[i] = '\n';
+            l_lineEnd = i + rand() % 120 + 1;
+        }
+        else if(i == l_lineEnd - 1 || rand() % 8 == 0)
+        {
+            l_text.m_Buffer[i] = ' ';
+        }
+        else
+        {
+            l_text.m_Buffer[i] = 'A' + rand() % 26;
+        }
+    }
+    l_text.m_Size = g_TEXT_SIZE;
+
+    return l_text;
+
+}
+
+TEST_CASE("Tokenizing lines", "[ArrayView][Benchmark]")
+{
+
+    Array<char> l_text = CreateText();
+    char l_newLine = '\n';
+    char l_get[] = {'G', 'E', 'T'};
+    Array<char> l_separator(l_newLine);
+    Array<char> l_prefix(l_get, 3);
+
+    //Counting the lines that start with "GET", once with a copy of each
+    //line and once with a view of it.
+    BENCHMARK("Copying lines")
+    {
+        Size l_count = 0;
+        Size l_start = 0;
+        while(l_start <= l_text.m_Size)
+        {
+            Array<char> l_rest(l_text.m_Buffer + l_start, l_text.m_Size - l_start);
+            Size l_end = FindIndexOfFirstOccurrenceOfArrayInArray(l_separator, l_rest);
+
+            Array<char> l_line;
+            CreateCopyAtOfArray(l_line, Array<char>(l_rest.m_Buffer, l_end));
+            if(ArrayStartsWithArray(l_line, l_prefix))
+            {
+                ++l_count;
+            }
+            DestoryArray(l_line);
+
+            l_start += l_end + 1;
+        }
+        return l_count;
+    };
+    BENCHMARK("Viewing lines")
+    {
+        Size l_count = 0;
+        ForEachPartOfViewSeparatedByArray(ArrayView<const char>(l_text), l_separator, [&](const ArrayView<const char>& p_line)
+        {
+            if(ArrayStartsWithArray(p_line, l_prefix))
+            {
+                ++l_count;
+            }
+        });
+        return l_count;
+    };
+
+    DestoryArray(l_text);
+
+}
@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -O2 -std=c++17 -o ArrayViewBenchmarks.bench ../../../Meta/Meta.cpp *.cpp
\ No newline at end of file
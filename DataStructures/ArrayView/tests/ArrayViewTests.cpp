@@ -0,0 +1,240 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "../ArrayView.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ArrayView;
+
+static ArrayView<const char> ViewOfCString(const char* p_string)
+{
+    return ArrayView<const char>(p_string, strlen(p_string));
+}
+
+static std::string StringOfView(const ArrayView<const char>& p_view)
+{
+    return std::string(p_view.m_Buffer, p_view.m_Size);
+}
+
+TEST_CASE("Array view creation", "[ArrayView]")
+{
+
+    SECTION("Null view")
+    {
+        ArrayView<int> l_view;
+        CHECK(l_view.m_Buffer == nullptr);
+        CHECK(l_view.m_Size == 0);
+        CHECK(ArrayIsEmpty(l_view));
+        CHECK(l_view.begin() == l_view.end());
+    }
+    SECTION("From an array")
+    {
+        int l_items[] = {1, 2, 3, 4};
+        Array<int> l_array(l_items, 3, 4);
+        ArrayView<int> l_view(l_array);
+        CHECK(l_view.m_Buffer == l_items);
+        CHECK(l_view.m_Size == 3);
+
+        //Changing items through a view changes the array's.
+        l_view[1] = 5;
+        CHECK(l_items[1] == 5);
+
+        ArrayView<const int> l_readonly(l_view);
+        CHECK(l_readonly.m_Buffer == l_items);
+        CHECK(l_readonly.m_Size == 3);
+        ArrayView<const int> l_readonlyOfArray(l_array);
+        CHECK(l_readonlyOfArray.m_Size == 3);
+
+        int l_sum = 0;
+        for(const int& l_item : l_readonly)
+        {
+            l_sum += l_item;
+        }
+        CHECK(l_sum == 9);
+    }
+    SECTION("From a null array")
+    {
+        Array<int> l_array(nullptr, 5);
+        ArrayView<int> l_view(l_array);
+        CHECK(l_view.m_Buffer == nullptr);
+        CHECK(l_view.m_Size == 0);
+    }
+
+}
+
+TEST_CASE("Array view slicing and splitting", "[ArrayView]")
+{
+
+    ArrayView<const char> l_view = ViewOfCString("key=value");
+
+    SECTION("Slicing")
+    {
+        CHECK(StringOfView(FindSliceOfViewFromIndexOfSize(l_view, 0, 3)) == "key");
+        CHECK(StringOfView(FindSliceOfViewFromIndexOfSize(l_view, 4, 100)) == "value");
+        CHECK(FindSliceOfViewFromIndexOfSize(l_view, 4, 100).m_Buffer == l_view.m_Buffer + 4);
+
+        ArrayView<const char> l_past = FindSliceOfViewFromIndexOfSize(l_view, 100, 3);
+        CHECK(l_past.m_Buffer == l_view.end());
+        CHECK(l_past.m_Size == 0);
+
+        CHECK(FindSliceOfViewFromIndexOfSize(ArrayView<const char>(), 0, 3).m_Buffer == nullptr);
+    }
+    SECTION("Removing from the ends")
+    {
+        RemoveNumberOfItemsFromStartOfView(4, l_view);
+        CHECK(StringOfView(l_view) == "value");
+        RemoveNumberOfItemsFromEndOfView(2, l_view);
+        CHECK(StringOfView(l_view) == "val");
+        RemoveNumberOfItemsFromEndOfView(10, l_view);
+        CHECK(l_view.m_Size == 0);
+    }
+    SECTION("Splitting at an index")
+    {
+        Size l_index = GENERATE((Size)0, (Size)3, (Size)9, (Size)20);
+        ArrayView<const char> l_before;
+        ArrayView<const char> l_after;
+        SplitViewAtIndex(l_view, l_index, l_before, l_after);
+        Size l_expected = l_index < 9 ? l_index : 9;
+        CHECK(l_before.m_Size == l_expected);
+        CHECK(l_after.m_Size == 9 - l_expected);
+        CHECK(l_after.m_Buffer == l_view.m_Buffer + l_expected);
+    }
+    SECTION("Splitting at a separator")
+    {
+        ArrayView<const char> l_key;
+        ArrayView<const char> l_value;
+        char l_equals = '=';
+        CHECK(SplitViewAtFirstOccurrenceOfArray(l_view, Array<char>(l_equals), l_key, l_value));
+        CHECK(StringOfView(l_key) == "key");
+        CHECK(StringOfView(l_value) == "value");
+
+        //Into the view being split.
+        CHECK_FALSE(SplitViewAtFirstOccurrenceOfArray(l_value, ViewOfCString("=="), l_key, l_value));
+        CHECK(StringOfView(l_key) == "value");
+        CHECK(l_value.m_Size == 0);
+    }
+
+}
+
+TEST_CASE("Array view parts and windows", "[ArrayView]")
+{
+
+    SECTION("Parts")
+    {
+        const char* l_text = GENERATE("a,bb,,ccc", ",", "", "abc");
+        ArrayView<const char> l_view = ViewOfCString(l_text);
+        std::vector<std::string> l_parts;
+        ForEachPartOfViewSeparatedByArray(l_view, ViewOfCString(","), [&](const ArrayView<const char>& p_part)
+        {
+            //Parts point into the text, nothing is copied.
+            CHECK(p_part.m_Buffer >= l_text);
+            l_parts.push_back(StringOfView(p_part));
+        });
+
+        std::vector<std::string> l_expected;
+        std::string l_string(l_text);
+        Size l_start = 0;
+        for(Size i = 0; i <= l_string.size(); ++i)
+        {
+            if(i == l_string.size() || l_string[i] == ',')
+            {
+                l_expected.push_back(l_string.substr(l_start, i - l_start));
+                l_start = i + 1;
+            }
+        }
+        CHECK(l_parts == l_expected);
+
+        Size l_count = 0;
+        ForEachPartOfViewSeparatedByArray(ArrayView<const char>(), ViewOfCString(","), [&](const ArrayView<const char>&)
+        {
+            ++l_count;
+        });
+        CHECK(l_count == 0);
+    }
+    SECTION("Windows")
+    {
+        int l_items[] = {0, 1, 2, 3, 4, 5, 6};
+        ArrayView<int> l_view(l_items, 7);
+        Size l_windowSize = GENERATE((Size)0, (Size)1, (Size)3, (Size)7, (Size)8);
+        Size l_step = GENERATE((Size)0, (Size)1, (Size)2, (Size)100);
+
+        std::vector<int> l_starts;
+        ForEachWindowOfView(l_view, l_windowSize, l_step, [&](const ArrayView<int>& p_window)
+        {
+            CHECK(p_window.m_Size == l_windowSize);
+            l_starts.push_back(p_window[0]);
+        });
+
+        std::vector<int> l_expected;
+        for(Size i = 0; l_windowSize > 0 && l_step > 0 && i + l_windowSize <= 7; i += l_step)
+        {
+            l_expected.push_back((int)i);
+        }
+        CHECK(l_starts == l_expected);
+    }
+
+}
+
+TEST_CASE("Array algorithms on array views", "[ArrayView]")
+{
+
+    char l_text[] = "GET /index.html HTTP/1.1";
+    Array<char> l_array(l_text, strlen(l_text));
+    ArrayView<const char> l_view(l_array);
+    //"index.html HTTP"
+    ArrayView<const char> l_slice = FindSliceOfViewFromIndexOfSize(l_view, 5, 15);
+    char l_dot = '.';
+
+    SECTION("Finding")
+    {
+        CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(ViewOfCString("HTTP"), l_view) == 16);
+        CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(ViewOfCString("HTTP"), l_slice) == 11);
+        CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(Array<char>(l_dot), l_slice) == 5);
+        CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(ViewOfCString("1.1"), l_slice) == l_slice.m_Size);
+        CHECK(FindIndexOfLastOccurrenceOfArrayInArray(Array<char>(l_dot), l_view) == 22);
+        CHECK(FindIndexOfLastOccurrenceOfArrayInArray(Array<char>(l_dot), l_slice) == 5);
+        CHECK(FindNumberOfInstanceOfArrayInArray(Array<char>(l_dot), l_view) == 2);
+        CHECK(FindNumberOfInstanceOfArrayInArray(ViewOfCString("T"), l_slice) == 2);
+        //An array searched for a view.
+        CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(l_slice, l_array) == 5);
+    }
+    SECTION("Needles")
+    {
+        ArrayNeedle<char> l_needle;
+        char l_http[] = "HTTP";
+        CreateArrayNeedleAtOfArray(l_needle, Array<char>(l_http, 4));
+        CHECK(FindIndexOfFirstOccurrenceOfArrayNeedleInArray(l_needle, l_slice) == 11);
+        CHECK(FindIndexOfLastOccurrenceOfArrayNeedleInArray(l_needle, l_slice) == 11);
+        CHECK(FindNumberOfInstanceOfArrayNeedleInArray(l_needle, l_slice) == 1);
+        CHECK(ArrayContainsArrayNeedle(l_slice, l_needle));
+        CHECK_FALSE(ArrayContainsArrayNeedle(FindSliceOfViewFromIndexOfSize(l_view, 0, 14), l_needle));
+        DestroyArrayNeedle(l_needle);
+    }
+    SECTION("Starts, ends and contains")
+    {
+        CHECK(ArrayStartsWithArray(l_view, ViewOfCString("GET ")));
+        CHECK(ArrayStartsWithArray(l_slice, ViewOfCString("index")));
+        CHECK_FALSE(ArrayStartsWithArray(l_slice, ViewOfCString("GET")));
+        CHECK(ArrayEndsWithArray(l_slice, ViewOfCString("HTTP")));
+        CHECK(ArrayEndsWithArray(l_array, ViewOfCString("1.1")));
+        CHECK(ArrayContainsArray(l_slice, ViewOfCString(".html")));
+        CHECK_FALSE(ArrayContainsArray(l_slice, ViewOfCString("GET")));
+    }
+    SECTION("Comparing")
+    {
+        CHECK(l_slice == ViewOfCString("index.html HTTP"));
+        CHECK(l_slice != ViewOfCString("index.html HTTQ"));
+        CHECK(l_slice != ViewOfCString("index.html"));
+        CHECK(l_view == l_array);
+        CHECK(l_array == l_view);
+        CHECK(ArrayView<const char>() == ArrayView<const char>());
+        CHECK(ArrayView<const char>() != l_view);
+    }
+
+}
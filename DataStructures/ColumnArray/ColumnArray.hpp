@@ -0,0 +1,717 @@
+/** @file ColumnArray.hpp
+ * @brief Defines everything in the @ref ColumnArrayMod module.
+ *
+ */
+
+#ifndef COLUMN_ARRAY__DATA_STRUCTURES_COLUMN_ARRAY_COLUMN_ARRAY_HPP
+#define COLUMN_ARRAY__DATA_STRUCTURES_COLUMN_ARRAY_COLUMN_ARRAY_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+#include "../ArrayView/ArrayView.hpp"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Library::DataStructures::ColumnArray
+{
+
+    /**
+     * @brief Each column of a column array starts at a multiple of this many
+     * bytes from the start of its buffer, which is allocated at this
+     * alignment.
+     *
+     * @details The size of a cache line, so the end of one column and the
+     * start of the next never share one.
+     *
+     */
+    constexpr Size g_COLUMN_ARRAY_COLUMN_ALIGNMENT = 64;
+
+    /**
+     * @brief An array of rows, each made of one item of each of the types
+     * Fields, that keeps the items of each field contiguous in a column of
+     * their own.
+     *
+     * @details Where an Array<Record> keeps whole records one after the
+     * other, a column array keeps all of the first fields, then all of the
+     * second fields and so on. Going over one field of every row then only
+     * reads that field, so every byte of every cache line read is used, and
+     * the loop is over a plain buffer of one type, which compilers
+     * vectorize.
+     *
+     * All of the columns are in m_Buffer, one after the other. Column i has
+     * room for m_Capacity items and starts at
+     * @ref FindOffsetOfColumnOfColumnArray bytes into m_Buffer, a multiple of
+     * @ref g_COLUMN_ARRAY_COLUMN_ALIGNMENT. A column is gotten as a view with
+     * @ref FindColumnOfArray, which can be used with the read only functions
+     * of the @ref ArrayMod module.
+     *
+     * Rows are added and removed whole, see @ref AddRowToEndOfArray and
+     * @ref RemoveRowAtIndexFromArray. Items are moved with memcpy and memmove,
+     * so every field must be trivially copyable.
+     *
+     * A default constructed column array is null, it has no buffer. Copying
+     * one copies the handle only, the same as for arrays.
+     *
+     * @tparam Fields The type of each field, in the order of the columns.
+     *
+     */
+    template<typename... Fields>
+    struct ColumnArray
+    {
+        static_assert(sizeof...(Fields) > 0, "A column array must have at least 1 field.");
+        static_assert(
+            (std::is_trivially_copyable_v<Fields> && ...),
+            "The items of a column array are moved with memcpy and must be trivially copyable."
+        );
+        static_assert(
+            ((alignof(Fields) <= g_COLUMN_ARRAY_COLUMN_ALIGNMENT) && ...),
+            "Each column starts at a multiple of g_COLUMN_ARRAY_COLUMN_ALIGNMENT, so no field can need more."
+        );
+
+        /**
+         * @brief A row, one item of each field.
+         *
+         */
+        using Row = std::tuple<Fields...>;
+        /**
+         * @brief The type of field I.
+         *
+         */
+        template<Size I>
+        using Field = std::tuple_element_t<I, Row>;
+
+        /**
+         * @brief The columns, each with room for m_Capacity items.
+         *
+         */
+        Byte* m_Buffer;
+        /**
+         * @brief The number of rows.
+         *
+         */
+        Size m_Size;
+        /**
+         * @brief The number of rows the columns have room for.
+         *
+         */
+        Size m_Capacity;
+
+        /**
+         * @brief Creates a null column array.
+         *
+         */
+        ColumnArray():
+        m_Buffer(nullptr),
+        m_Size(0),
+        m_Capacity(0)
+        {
+            LogDebugLine("Constructing column array at " << this);
+        }
+    };
+
+    /**
+     * @brief Returns the number of bytes from the start of the buffer of a
+     * column array of capacity p_capacity at which column p_column starts.
+     *
+     * @details Each column ends sizeof(field) * p_capacity bytes after it
+     * starts, the next one starts at the next multiple of
+     * @ref g_COLUMN_ARRAY_COLUMN_ALIGNMENT. Passing the number of fields as
+     * p_column gives the size of the whole buffer. Overflow is not checked,
+     * see @ref FindSizeOfBufferOfColumnArrayOfCapacity.
+     *
+     */
+    template<typename... Fields>
+    constexpr Size FindOffsetOfColumnOfColumnArray(const Size& p_column, const Size& p_capacity)
+    {
+        constexpr Size l_sizes[] = {sizeof(Fields)...};
+        Size l_offset = 0;
+        for(Size i = 0; i < p_column; ++i)
+        {
+            l_offset += l_sizes[i] * p_capacity;
+            l_offset = (l_offset + g_COLUMN_ARRAY_COLUMN_ALIGNMENT - 1) & ~(g_COLUMN_ARRAY_COLUMN_ALIGNMENT - 1);
+        }
+        return l_offset;
+    }
+    /**
+     * @brief Returns the number of bytes the buffer of a column array of
+     * capacity p_capacity takes, or 0 if that overflows.
+     *
+     */
+    template<typename... Fields>
+    constexpr Size FindSizeOfBufferOfColumnArrayOfCapacity(const Size& p_capacity)
+    {
+        constexpr Size l_rowSize = (sizeof(Fields) + ...);
+        constexpr Size l_padding = sizeof...(Fields) * g_COLUMN_ARRAY_COLUMN_ALIGNMENT;
+        if(p_capacity > (SIZE_MAX - l_padding) / l_rowSize)
+        {
+            return 0;
+        }
+        return FindOffsetOfColumnOfColumnArray<Fields...>(sizeof...(Fields), p_capacity);
+    }
+
+    /**
+     * @brief Returns a pointer to the first item of column I of p_array, null
+     * if p_array is null.
+     *
+     */
+    template<Size I, typename... Fields>
+    inline typename ColumnArray<Fields...>::template Field<I>* FindBufferOfColumnOfArray(
+        const ColumnArray<Fields...>& p_array
+    )
+    {
+        if(p_array.m_Buffer == nullptr)
+        {
+            return nullptr;
+        }
+        return (typename ColumnArray<Fields...>::template Field<I>*)(
+            p_array.m_Buffer + FindOffsetOfColumnOfColumnArray<Fields...>(I, p_array.m_Capacity)
+        );
+    }
+
+    /**
+     * @brief Returns a view of the items of field I of each row of p_array.
+     *
+     * @details The view can be used with the read only functions of the
+     * @ref ArrayMod module, like any @ref ArrayViewMod "array view", and its
+     * items can be changed. It is valid until p_array is reallocated, which
+     * adding rows can do.
+     *
+     */
+    template<Size I, typename... Fields>
+    inline ArrayView::ArrayView<typename ColumnArray<Fields...>::template Field<I>> FindColumnOfArray(
+        ColumnArray<Fields...>& p_array
+    )
+    {
+        return ArrayView::ArrayView<typename ColumnArray<Fields...>::template Field<I>>(
+            FindBufferOfColumnOfArray<I>(p_array), p_array.m_Size
+        );
+    }
+    /**
+     * @brief Returns a view of the items of field I of each row of p_array,
+     * readonly version.
+     *
+     */
+    template<Size I, typename... Fields>
+    inline ArrayView::ArrayView<const typename ColumnArray<Fields...>::template Field<I>> FindColumnOfArray(
+        const ColumnArray<Fields...>& p_array
+    )
+    {
+        return ArrayView::ArrayView<const typename ColumnArray<Fields...>::template Field<I>>(
+            FindBufferOfColumnOfArray<I>(p_array), p_array.m_Size
+        );
+    }
+
+    /**
+     * @brief Returns the row of p_array at p_index, see
+     * @ref FindRowOfArrayAtIndex.
+     *
+     */
+    template<typename... Fields, Size... I>
+    inline typename ColumnArray<Fields...>::Row FindRowOfArrayAtIndexOfColumns(
+        const ColumnArray<Fields...>& p_array,
+        const Size& p_index,
+        std::index_sequence<I...>
+    )
+    {
+        return typename ColumnArray<Fields...>::Row(FindBufferOfColumnOfArray<I>(p_array)[p_index]...);
+    }
+    /**
+     * @brief Copies the items of p_row into row p_index of p_array, see
+     * @ref SetRowOfArrayAtIndex.
+     *
+     */
+    template<typename... Fields, Size... I>
+    inline void SetRowOfArrayAtIndexOfColumns(
+        const typename ColumnArray<Fields...>::Row& p_row,
+        const Size& p_index,
+        ColumnArray<Fields...>& p_array,
+        std::index_sequence<I...>
+    )
+    {
+        ((FindBufferOfColumnOfArray<I>(p_array)[p_index] = std::get<I>(p_row)), ...);
+    }
+
+    /**
+     * @brief Returns a copy of the items of row p_index of p_array.
+     *
+     * @details If p_index is not less than p_array.m_Size the behaviour is
+     * undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in which case the
+     * process is aborted.
+     *
+     * @time O(number of fields).
+     *
+     */
+    template<typename... Fields>
+    typename ColumnArray<Fields...>::Row FindRowOfArrayAtIndex(
+        const ColumnArray<Fields...>& p_array,
+        const Size& p_index
+    )
+    {
+        #if ARRAY_CHECK_INDEXES
+        if(p_index >= p_array.m_Size)
+        {
+            LogDebugLine("\n------\nError invalid index " << p_index
+            << " in column array " << &p_array << ", aborting proccess...\n------\n");
+            abort();
+        }
+        #endif //ARRAY_CHECK_INDEXES
+        return FindRowOfArrayAtIndexOfColumns(p_array, p_index, std::index_sequence_for<Fields...>());
+    }
+    /**
+     * @brief Copies each item of p_row into its column of p_array at
+     * p_index.
+     *
+     * @details If p_index is not less than p_array.m_Size the behaviour is
+     * undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in which case the
+     * process is aborted.
+     *
+     * @time O(number of fields).
+     *
+     */
+    template<typename... Fields>
+    void SetRowOfArrayAtIndex(
+        const typename ColumnArray<Fields...>::Row& p_row,
+        const Size& p_index,
+        ColumnArray<Fields...>& p_array
+    )
+    {
+        #if ARRAY_CHECK_INDEXES
+        if(p_index >= p_array.m_Size)
+        {
+            LogDebugLine("\n------\nError invalid index " << p_index
+            << " in column array " << &p_array << ", aborting proccess...\n------\n");
+            abort();
+        }
+        #endif //ARRAY_CHECK_INDEXES
+        SetRowOfArrayAtIndexOfColumns(p_row, p_index, p_array, std::index_sequence_for<Fields...>());
+    }
+
+    /**
+     * @brief Creates a column array at outp_array with room for p_capacity
+     * rows, allocating its buffer using p_allocate.
+     *
+     * @details The buffer is allocated at
+     * @ref g_COLUMN_ARRAY_COLUMN_ALIGNMENT, so every column starts at a cache
+     * line. If p_capacity is 0 a null column array is created and nothing
+     * is allocated. If the size of the buffer overflows or allocation fails
+     * a null column array is created, and in the second case p_alloc_error is
+     * called.
+     *
+     * @time O(1).
+     *
+     */
+    template<typename... Fields>
+    void CreateColumnArrayAtOfCapacityUsingAllocator(
+        ColumnArray<Fields...>& outp_array,
+        const Size& p_capacity,
+        AlignedAllocator p_allocate, Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating column array at " << &outp_array << " with "
+        "capacity " << p_capacity);
+
+        outp_array = ColumnArray<Fields...>();
+
+        if(p_capacity == 0)
+        {
+            LogDebugLine("The given capacity is 0, returning.");
+            return;
+        }
+
+        Size l_bytes = FindSizeOfBufferOfColumnArrayOfCapacity<Fields...>(p_capacity);
+        if(l_bytes == 0)
+        {
+            LogDebugLine("The size of the buffer overflows, returning.");
+            return;
+        }
+
+        outp_array.m_Buffer = (Byte*)p_allocate(g_COLUMN_ARRAY_COLUMN_ALIGNMENT, l_bytes);
+        if(outp_array.m_Buffer == nullptr)
+        {
+            LogDebugLine("Allocation of the buffer failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        outp_array.m_Capacity = p_capacity;
+
+    }
+    /**
+     * @brief Default aligned allocator, callback and data.
+     *
+     */
+    template<typename... Fields>
+    inline void CreateColumnArrayAtOfCapacity(
+        ColumnArray<Fields...>& outp_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for CreateColumnArrayAtOfCapacityUsingAllocator");
+        CreateColumnArrayAtOfCapacityUsingAllocator(
+            outp_array, p_capacity,
+            Library::g_DEFAULT_ALIGNED_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Moves the rows of p_array into a new buffer with room for
+     * p_capacity rows, allocated using p_allocate, and deallocates the old
+     * one using p_deallocate.
+     *
+     * @details Since every column starts at an offset that depends on the
+     * capacity the buffer cannot be reallocated in place, each column is
+     * copied to where it starts in the new buffer. If p_capacity is less
+     * than p_array.m_Size the rows after it are dropped. If p_capacity is 0
+     * the buffer is deallocated and p_array becomes null.
+     *
+     * If the size of the buffer overflows, or allocation fails in which case
+     * p_alloc_error is called, p_array is not mutated.
+     *
+     * @time O(n), n being the number of rows kept.
+     *
+     */
+    template<typename... Fields>
+    void ResizeColumnArrayToCapacityUsingAllocatorAndDeallocator(
+        ColumnArray<Fields...>& p_array,
+        const Size& p_capacity,
+        AlignedAllocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Resizing column array " << p_array << " to capacity "
+        << p_capacity);
+
+        if(p_capacity == p_array.m_Capacity)
+        {
+            LogDebugLine("The capacity is already " << p_capacity << ", returning.");
+            return;
+        }
+
+        ColumnArray<Fields...> l_resized;
+        CreateColumnArrayAtOfCapacityUsingAllocator(
+            l_resized, p_capacity,
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(p_capacity != 0 && l_resized.m_Buffer == nullptr)
+        {
+            LogDebugLine("Creating the new buffer failed, returning.");
+            return;
+        }
+
+        l_resized.m_Size = p_array.m_Size < p_capacity ? p_array.m_Size : p_capacity;
+        if(l_resized.m_Size > 0)
+        {
+            constexpr Size l_sizes[] = {sizeof(Fields)...};
+            for(Size i = 0; i < sizeof...(Fields); ++i)
+            {
+                memcpy(
+                    l_resized.m_Buffer + FindOffsetOfColumnOfColumnArray<Fields...>(i, l_resized.m_Capacity),
+                    p_array.m_Buffer + FindOffsetOfColumnOfColumnArray<Fields...>(i, p_array.m_Capacity),
+                    l_sizes[i] * l_resized.m_Size
+                );
+            }
+        }
+
+        p_deallocate(p_array.m_Buffer);
+        p_array = l_resized;
+
+    }
+    /**
+     * @brief Default aligned allocator, deallocator, callback and data.
+     *
+     */
+    template<typename... Fields>
+    inline void ResizeColumnArrayToCapacity(
+        ColumnArray<Fields...>& p_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for ResizeColumnArrayToCapacityUsingAllocatorAndDeallocator");
+        ResizeColumnArrayToCapacityUsingAllocatorAndDeallocator(
+            p_array, p_capacity,
+            Library::g_DEFAULT_ALIGNED_ALLOCATOR, Library::g_DEFAULT_ALIGNED_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Adds p_row after the last row of p_array, doubling its capacity
+     * if it is full.
+     *
+     * @details Grows the same way arrays do by default, to at least
+     * @ref Library::DataStructures::Array::g_ARRAY_MINIMUM_GROWN_CAPACITY
+     * "g_ARRAY_MINIMUM_GROWN_CAPACITY" rows, see
+     * @ref ResizeColumnArrayToCapacityUsingAllocatorAndDeallocator. If growing
+     * fails p_array is not mutated.
+     *
+     * p_row can be given as a braced list of its items, {item0, item1...}.
+     *
+     * @time O(1) amortized, O(n) when p_array has to grow, n being
+     * p_array.m_Size.
+     *
+     */
+    template<typename... Fields>
+    void AddRowToEndOfArrayUsingAllocatorAndDeallocator(
+        const typename ColumnArray<Fields...>::Row& p_row,
+        ColumnArray<Fields...>& p_array,
+        AlignedAllocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding a row to the end of column array " << p_array);
+
+        if(p_array.m_Size == p_array.m_Capacity)
+        {
+            LogDebugLine("Column array " << p_array << " is full, growing it.");
+
+            if(p_array.m_Capacity > SIZE_MAX / 2)
+            {
+                LogDebugLine("The capacity would overflow, returning.");
+                return;
+            }
+            Size l_capacity = p_array.m_Capacity * 2;
+            if(l_capacity < Array::g_ARRAY_MINIMUM_GROWN_CAPACITY)
+            {
+                l_capacity = Array::g_ARRAY_MINIMUM_GROWN_CAPACITY;
+            }
+
+            ResizeColumnArrayToCapacityUsingAllocatorAndDeallocator(
+                p_array, l_capacity,
+                p_allocate, p_deallocate,
+                p_alloc_error, p_alloc_error_data
+            );
+            if(p_array.m_Capacity != l_capacity)
+            {
+                LogDebugLine("Growing failed, returning.");
+                return;
+            }
+        }
+
+        ++p_array.m_Size;
+        SetRowOfArrayAtIndexOfColumns(p_row, p_array.m_Size - 1, p_array, std::index_sequence_for<Fields...>());
+
+    }
+    /**
+     * @brief Default aligned allocator, deallocator, callback and data.
+     *
+     */
+    template<typename... Fields>
+    inline void AddRowToEndOfArray(
+        const typename ColumnArray<Fields...>::Row& p_row,
+        ColumnArray<Fields...>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for AddRowToEndOfArrayUsingAllocatorAndDeallocator");
+        AddRowToEndOfArrayUsingAllocatorAndDeallocator(
+            p_row, p_array,
+            Library::g_DEFAULT_ALIGNED_ALLOCATOR, Library::g_DEFAULT_ALIGNED_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Removes row p_index from p_array, in the order p_order says.
+     *
+     * @details If p_order is Stable the rows after it are moved back by one,
+     * column by column with memmove. If it is Unstable the last row is moved
+     * into its place. The buffer and capacity are not mutated.
+     *
+     * If p_index is not less than p_array.m_Size p_index_error is called and
+     * p_array is not mutated.
+     *
+     * @time O(n) if Stable, n being the number of rows after p_index, O(1)
+     * if Unstable.
+     *
+     */
+    template<typename... Fields>
+    void RemoveRowAtIndexFromArray(
+        const Size& p_index,
+        const Array::ArrayRemovalOrder& p_order,
+        Callback p_index_error, void* p_index_error_data,
+        ColumnArray<Fields...>& p_array
+    )
+    {
+
+        LogDebugLine("Removing row " << p_index << " from column array " << p_array);
+
+        if(p_index >= p_array.m_Size)
+        {
+            LogDebugLine("The index is invalid.");
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+
+        constexpr Size l_sizes[] = {sizeof(Fields)...};
+        const Size l_last = p_array.m_Size - 1;
+        for(Size i = 0; i < sizeof...(Fields); ++i)
+        {
+            Byte* l_column = p_array.m_Buffer + FindOffsetOfColumnOfColumnArray<Fields...>(i, p_array.m_Capacity);
+            if(p_order == Array::ArrayRemovalOrder::Stable)
+            {
+                memmove(
+                    l_column + l_sizes[i] * p_index,
+                    l_column + l_sizes[i] * (p_index + 1),
+                    l_sizes[i] * (l_last - p_index)
+                );
+            }
+            else if(p_index != l_last)
+            {
+                memcpy(l_column + l_sizes[i] * p_index, l_column + l_sizes[i] * l_last, l_sizes[i]);
+            }
+        }
+        p_array.m_Size = l_last;
+
+    }
+
+    /**
+     * @brief Removes the rows of p_array for which p_isRemoved returns true,
+     * in the order p_order says.
+     *
+     * @details p_isRemoved is given the index of a row and can look at any of
+     * its columns, using p_array. The row is still where that index says when
+     * p_isRemoved is called. Each row is looked at once, unless p_order is
+     * Unstable and a row is moved into a hole, then it is looked at again.
+     * The buffer and capacity are not mutated.
+     *
+     * @tparam F Anything that can be called with a Size and returns bool.
+     *
+     * @time O(n * number of fields), n being p_array.m_Size.
+     *
+     */
+    template<typename F, typename... Fields>
+    void RemoveEachRowForWhichFunctionReturnsTrueFromArray(
+        ColumnArray<Fields...>& p_array,
+        const Array::ArrayRemovalOrder& p_order,
+        F&& p_isRemoved
+    )
+    {
+
+        LogDebugLine("Removing rows from column array " << p_array);
+
+        if(p_array.m_Buffer == nullptr)
+        {
+            return;
+        }
+
+        constexpr Size l_sizes[] = {sizeof(Fields)...};
+        Byte* l_columns[sizeof...(Fields)];
+        for(Size i = 0; i < sizeof...(Fields); ++i)
+        {
+            l_columns[i] = p_array.m_Buffer + FindOffsetOfColumnOfColumnArray<Fields...>(i, p_array.m_Capacity);
+        }
+        auto l_moveRow = [&](Size p_from, Size p_to)
+        {
+            for(Size i = 0; i < sizeof...(Fields); ++i)
+            {
+                memcpy(l_columns[i] + l_sizes[i] * p_to, l_columns[i] + l_sizes[i] * p_from, l_sizes[i]);
+            }
+        };
+
+        if(p_order == Array::ArrayRemovalOrder::Stable)
+        {
+            //Rows are only ever moved back, so row i has not been written
+            //over when it is looked at.
+            Size l_write = 0;
+            for(Size i = 0; i < p_array.m_Size; ++i)
+            {
+                if(!p_isRemoved(i))
+                {
+                    if(l_write != i)
+                    {
+                        l_moveRow(i, l_write);
+                    }
+                    ++l_write;
+                }
+            }
+            p_array.m_Size = l_write;
+        }
+        else
+        {
+            Size l_end = p_array.m_Size;
+            Size i = 0;
+            while(i < l_end)
+            {
+                if(!p_isRemoved(i))
+                {
+                    ++i;
+                    continue;
+                }
+                //The last row is moved into the hole and looked at next.
+                --l_end;
+                if(i != l_end)
+                {
+                    l_moveRow(l_end, i);
+                }
+            }
+            p_array.m_Size = l_end;
+        }
+
+        LogDebugLine("Column array after removal: " << p_array);
+
+    }
+
+    /**
+     * @brief Deallocates the buffer of p_array using p_deallocate and sets it
+     * to a null column array.
+     *
+     */
+    template<typename... Fields>
+    void DestroyColumnArrayUsingDeallocator(ColumnArray<Fields...>& p_array, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying column array " << p_array);
+
+        p_deallocate(p_array.m_Buffer);
+        p_array = ColumnArray<Fields...>();
+
+    }
+    template<typename... Fields>
+    inline void DestroyColumnArray(ColumnArray<Fields...>& p_array)
+    {
+        LogDebugLine("Using defaults for DestroyColumnArrayUsingDeallocator");
+        DestroyColumnArrayUsingDeallocator(p_array, Library::g_DEFAULT_ALIGNED_DEALLOCATOR);
+    }
+
+
+    #ifdef DEBUG
+    /**
+     * @brief Logs the fields of p_array, its items are not logged.
+     *
+     */
+    template<typename... Fields>
+    const Debugging::Log& operator<< (const Debugging::Log& p_log, const ColumnArray<Fields...>& p_array)
+    {
+
+        p_log << &p_array;
+        p_log << " { m_Buffer = " << (void*)p_array.m_Buffer;
+        p_log << ", m_Size = " << p_array.m_Size;
+        p_log << ", m_Capacity = " << p_array.m_Capacity;
+        p_log << ", fields = " << sizeof...(Fields);
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+}
+
+#endif //COLUMN_ARRAY__DATA_STRUCTURES_COLUMN_ARRAY_COLUMN_ARRAY_HPP
@@ -0,0 +1,109 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../ColumnArray.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ArrayView;
+using namespace Library::DataStructures::ColumnArray;
+
+//4Mi trades, 256MiB of them either way.
+static const Size g_TRADE_COUNT = 4 * 1024 * 1024;
+
+//A wide record, of which a filter looks at 1 or 2 fields.
+struct Trade
+{
+    uint64_t m_Id;
+    double m_Price;
+    uint32_t m_Quantity;
+    uint32_t m_Venue;
+    double m_Fees;
+    uint64_t m_Time;
+    uint64_t m_Account;
+    uint64_t m_Flags;
+};
+using TradeColumns = ColumnArray<uint64_t, double, uint32_t, uint32_t, double, uint64_t, uint64_t, uint64_t>;
+
+TEST_CASE("Columnar filters", "[ColumnArray][Benchmark]")
+{
+
+    Array<Trade> l_rows;
+    TradeColumns l_columns;
+    CreateArrayAtOfCapacity(l_rows, g_TRADE_COUNT);
+    CreateColumnArrayAtOfCapacity(l_columns, g_TRADE_COUNT);
+    srand(42);
+    for(Size i = 0; i < g_TRADE_COUNT; ++i)
+    {
+        Trade l_trade;
+        l_trade.m_Id = i;
+        l_trade.m_Price = rand() % 10000 / 100.0;
+        l_trade.m_Quantity = rand() % 1000;
+        l_trade.m_Venue = rand() % 8;
+        l_trade.m_Fees = 0.01;
+        l_trade.m_Time = i * 1000;
+        l_trade.m_Account = rand() % 5000;
+        l_trade.m_Flags = 0;
+        AddItemToEndOfArray(l_trade, l_rows);
+        AddRowToEndOfArray(
+            {
+                l_trade.m_Id, l_trade.m_Price, l_trade.m_Quantity, l_trade.m_Venue,
+                l_trade.m_Fees, l_trade.m_Time, l_trade.m_Account, l_trade.m_Flags
+            },
+            l_columns
+        );
+    }
+
+    SECTION("Counting by 1 field")
+    {
+        BENCHMARK("Rows")
+        {
+            Size l_count = 0;
+            for(const Trade& l_trade : l_rows)
+            {
+                l_count += l_trade.m_Venue == 3;
+            }
+            return l_count;
+        };
+        BENCHMARK("Columns")
+        {
+            Size l_count = 0;
+            for(const uint32_t& l_venue : FindColumnOfArray<3>((const TradeColumns&)l_columns))
+            {
+                l_count += l_venue == 3;
+            }
+            return l_count;
+        };
+    }
+    SECTION("Summing 1 field filtered by another")
+    {
+        BENCHMARK("Rows")
+        {
+            uint64_t l_sum = 0;
+            for(const Trade& l_trade : l_rows)
+            {
+                l_sum += l_trade.m_Venue == 3 ? l_trade.m_Quantity : 0;
+            }
+            return l_sum;
+        };
+        BENCHMARK("Columns")
+        {
+            const uint32_t* l_quantities = FindBufferOfColumnOfArray<2>(l_columns);
+            const uint32_t* l_venues = FindBufferOfColumnOfArray<3>(l_columns);
+            uint64_t l_sum = 0;
+            for(Size i = 0; i < l_columns.m_Size; ++i)
+            {
+                l_sum += l_venues[i] == 3 ? l_quantities[i] : 0;
+            }
+            return l_sum;
+        };
+    }
+
+    DestoryArray(l_rows);
+    DestroyColumnArray(l_columns);
+
+}
@@ -0,0 +1,246 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <tuple>
+#include <vector>
+
+#include "../ColumnArray.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ArrayView;
+using namespace Library::DataStructures::ColumnArray;
+using namespace Debugging;
+
+//An AlignedAllocator that always fails.
+static void* NullAlignedMalloc(Size p_alignment, Size p_size)
+{
+    (void)p_alignment;
+    (void)p_size;
+    return nullptr;
+}
+
+//Fields of different sizes, so that every column starts somewhere else.
+using Trade = ColumnArray<uint32_t, double, char, uint16_t>;
+
+static Trade::Row CreateRowOfIndex(Size p_index)
+{
+    return Trade::Row((uint32_t)p_index, p_index * 0.5, (char)('a' + p_index % 26), (uint16_t)(p_index * 3));
+}
+
+static bool IsArrayEqualToRows(const Trade& p_array, const std::vector<Trade::Row>& p_rows)
+{
+    if(p_array.m_Size != p_rows.size())
+    {
+        return false;
+    }
+    for(Size i = 0; i < p_rows.size(); ++i)
+    {
+        if(FindRowOfArrayAtIndex(p_array, i) != p_rows[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Column array creation", "[ColumnArray]")
+{
+
+    Trade l_array;
+    CHECK(l_array.m_Buffer == nullptr);
+    CHECK(FindColumnOfArray<1>(l_array).m_Buffer == nullptr);
+    CHECK(FindColumnOfArray<1>(l_array).m_Size == 0);
+
+    SECTION("Of capacity")
+    {
+        Size l_capacity = GENERATE((Size)0, (Size)1, (Size)100);
+        CreateColumnArrayAtOfCapacity(l_array, l_capacity);
+        CHECK(l_array.m_Capacity == l_capacity);
+        CHECK(l_array.m_Size == 0);
+        CHECK((l_array.m_Buffer == nullptr) == (l_capacity == 0));
+    }
+    SECTION("Columns do not overlap and start on cache lines")
+    {
+        CreateColumnArrayAtOfCapacity(l_array, 100);
+        Byte* l_columns[] = {
+            (Byte*)FindBufferOfColumnOfArray<0>(l_array),
+            (Byte*)FindBufferOfColumnOfArray<1>(l_array),
+            (Byte*)FindBufferOfColumnOfArray<2>(l_array),
+            (Byte*)FindBufferOfColumnOfArray<3>(l_array)
+        };
+        Size l_sizes[] = {sizeof(uint32_t), sizeof(double), sizeof(char), sizeof(uint16_t)};
+        for(Size i = 0; i < 4; ++i)
+        {
+            CHECK((uintptr_t)l_columns[i] % g_COLUMN_ARRAY_COLUMN_ALIGNMENT == 0);
+            if(i > 0)
+            {
+                CHECK(l_columns[i] >= l_columns[i - 1] + l_sizes[i - 1] * 100);
+            }
+        }
+        CHECK(FindSizeOfBufferOfColumnArrayOfCapacity<uint32_t, double, char, uint16_t>(100) >=
+            (Size)(l_columns[3] - l_array.m_Buffer) + sizeof(uint16_t) * 100);
+    }
+    SECTION("Overflow and allocation failure")
+    {
+        CreateColumnArrayAtOfCapacity(l_array, SIZE_MAX / 4);
+        CHECK(l_array.m_Buffer == nullptr);
+
+        bool l_called = false;
+        CreateColumnArrayAtOfCapacityUsingAllocator(l_array, 10, NullAlignedMalloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Capacity == 0);
+    }
+
+    DestroyColumnArray(l_array);
+    CHECK(l_array.m_Buffer == nullptr);
+
+}
+
+TEST_CASE("Column array rows", "[ColumnArray]")
+{
+
+    Trade l_array;
+    std::vector<Trade::Row> l_expected;
+    for(Size i = 0; i < 100; ++i)
+    {
+        AddRowToEndOfArray(CreateRowOfIndex(i), l_array);
+        l_expected.push_back(CreateRowOfIndex(i));
+    }
+    REQUIRE(IsArrayEqualToRows(l_array, l_expected));
+    CHECK(l_array.m_Capacity >= 100);
+
+    SECTION("Braced rows and setting rows")
+    {
+        AddRowToEndOfArray({7, 1.5, 'x', 9}, l_array);
+        CHECK(FindRowOfArrayAtIndex(l_array, 100) == Trade::Row(7, 1.5, 'x', 9));
+
+        SetRowOfArrayAtIndex({1, 2.0, 'y', 3}, 50, l_array);
+        CHECK(FindRowOfArrayAtIndex(l_array, 50) == Trade::Row(1, 2.0, 'y', 3));
+        CHECK(FindColumnOfArray<2>(l_array)[50] == 'y');
+    }
+    SECTION("Resizing")
+    {
+        ResizeColumnArrayToCapacity(l_array, 1000);
+        CHECK(l_array.m_Capacity == 1000);
+        CHECK(IsArrayEqualToRows(l_array, l_expected));
+
+        ResizeColumnArrayToCapacity(l_array, 40);
+        l_expected.resize(40);
+        CHECK(IsArrayEqualToRows(l_array, l_expected));
+
+        ResizeColumnArrayToCapacity(l_array, 0);
+        CHECK(l_array.m_Buffer == nullptr);
+        CHECK(l_array.m_Size == 0);
+    }
+    SECTION("Growing failure")
+    {
+        bool l_called = false;
+        ResizeColumnArrayToCapacityUsingAllocatorAndDeallocator(
+            l_array, 1000,
+            NullAlignedMalloc, free,
+            GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(IsArrayEqualToRows(l_array, l_expected));
+
+        while(l_array.m_Size < l_array.m_Capacity)
+        {
+            AddRowToEndOfArray(CreateRowOfIndex(l_array.m_Size), l_array);
+            l_expected.push_back(CreateRowOfIndex(l_expected.size()));
+        }
+        l_called = false;
+        AddRowToEndOfArrayUsingAllocatorAndDeallocator(
+            CreateRowOfIndex(0), l_array,
+            NullAlignedMalloc, free,
+            GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(IsArrayEqualToRows(l_array, l_expected));
+    }
+    SECTION("Removing a row")
+    {
+        ArrayRemovalOrder l_order = GENERATE(ArrayRemovalOrder::Stable, ArrayRemovalOrder::Unstable);
+        Size l_index = GENERATE((Size)0, (Size)42, (Size)99);
+        RemoveRowAtIndexFromArray(l_index, l_order, nullptr, nullptr, l_array);
+        if(l_order == ArrayRemovalOrder::Stable)
+        {
+            l_expected.erase(l_expected.begin() + l_index);
+        }
+        else
+        {
+            l_expected[l_index] = l_expected.back();
+            l_expected.pop_back();
+        }
+        CHECK(IsArrayEqualToRows(l_array, l_expected));
+
+        bool l_called = false;
+        RemoveRowAtIndexFromArray(99, l_order, GeneralErrorCallback, &l_called, l_array);
+        CHECK(l_called);
+        CHECK(IsArrayEqualToRows(l_array, l_expected));
+    }
+    SECTION("Removing rows by a function")
+    {
+        ArrayRemovalOrder l_order = GENERATE(ArrayRemovalOrder::Stable, ArrayRemovalOrder::Unstable);
+        ArrayView<const uint16_t> l_column = FindColumnOfArray<3>((const Trade&)l_array);
+        RemoveEachRowForWhichFunctionReturnsTrueFromArray(l_array, l_order, [&](Size p_index)
+        {
+            return l_column[p_index] % 2 == 0;
+        });
+
+        std::vector<Trade::Row> l_kept;
+        for(const Trade::Row& l_row : l_expected)
+        {
+            if(std::get<3>(l_row) % 2 != 0)
+            {
+                l_kept.push_back(l_row);
+            }
+        }
+        REQUIRE(l_array.m_Size == l_kept.size());
+        if(l_order == ArrayRemovalOrder::Stable)
+        {
+            CHECK(IsArrayEqualToRows(l_array, l_kept));
+        }
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            CHECK(std::get<3>(FindRowOfArrayAtIndex(l_array, i)) % 2 != 0);
+        }
+    }
+
+    DestroyColumnArray(l_array);
+
+}
+
+TEST_CASE("Array algorithms on columns", "[ColumnArray]")
+{
+
+    ColumnArray<char, int> l_array;
+    const char* l_text = "GET /index.html";
+    for(Size i = 0; l_text[i] != '\0'; ++i)
+    {
+        AddRowToEndOfArray({l_text[i], (int)i}, l_array);
+    }
+    ArrayView<char> l_letters = FindColumnOfArray<0>(l_array);
+    ArrayView<int> l_numbers = FindColumnOfArray<1>(l_array);
+    char l_get[] = {'G', 'E', 'T'};
+    char l_dot = '.';
+
+    CHECK(l_letters.m_Size == 15);
+    CHECK(ArrayStartsWithArray(l_letters, Array<char>(l_get, 3)));
+    CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(Array<char>(l_dot), l_letters) == 10);
+    CHECK(FindNumberOfInstanceOfArrayInArray(Array<char>(l_dot), l_letters) == 1);
+
+    int l_seven = 7;
+    CHECK(FindIndexOfFirstOccurrenceOfArrayInArray(Array<int>(l_seven), l_numbers) == 7);
+    CHECK(FindIndexOfFirstMismatchOfArrayAndArray(l_numbers, l_numbers) == 15);
+
+    //Changing a column through its view changes the rows.
+    l_numbers[0] = 100;
+    CHECK(std::get<1>(FindRowOfArrayAtIndex(l_array, 0)) == 100);
+
+    DestroyColumnArray(l_array);
+
+}
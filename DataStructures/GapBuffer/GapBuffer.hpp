@@ -0,0 +1,597 @@
+/** @file GapBuffer.hpp
+ * @brief Defines everything in the @ref GapBufferMod module.
+ *
+ */
+
+#ifndef GAP_BUFFER__DATA_STRUCTURES_GAP_BUFFER_GAP_BUFFER_HPP
+#define GAP_BUFFER__DATA_STRUCTURES_GAP_BUFFER_GAP_BUFFER_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <type_traits>
+
+namespace Library::DataStructures::GapBuffer
+{
+
+    /**
+     * @brief The size of the gap a gap buffer gets when it is created from an
+     * array and no size is given.
+     *
+     */
+    constexpr Size g_GAP_BUFFER_DEFAULT_GAP_SIZE = 4 * 1024;
+
+    /**
+     * @brief A buffer of items of type T with a gap of unused items in it,
+     * so that items can be added and removed where the gap is without moving
+     * any other item.
+     *
+     * @details The items before the gap are m_Buffer[0] to
+     * m_Buffer[m_GapStart - 1], the items after it are m_Buffer[m_GapEnd] to
+     * m_Buffer[m_Capacity - 1]. Adding or removing items at an index first
+     * moves the gap there, which moves only the items between the old and new
+     * place of the gap. Edits that stay close to each other, like typing in a
+     * text editor, only ever move a few items, no matter how many there are.
+     *
+     * Items are moved with memmove, so T must be trivially copyable.
+     *
+     * A default constructed gap buffer is empty and has no buffer. Copying
+     * one copies the handle only, the same as for arrays.
+     *
+     */
+    template<typename T>
+    struct GapBuffer
+    {
+        static_assert(
+            std::is_trivially_copyable_v<T>,
+            "The items of a gap buffer are moved with memmove and must be trivially copyable."
+        );
+
+        /**
+         * @brief The items and the gap.
+         *
+         */
+        T* m_Buffer;
+        /**
+         * @brief The number of items m_Buffer has room for, including the
+         * gap.
+         *
+         */
+        Size m_Capacity;
+        /**
+         * @brief The index of the first item of the gap, also the number of
+         * items before it.
+         *
+         */
+        Size m_GapStart;
+        /**
+         * @brief The index of the first item after the gap, m_Capacity if the
+         * gap is at the end.
+         *
+         */
+        Size m_GapEnd;
+
+        /**
+         * @brief Creates an empty gap buffer without a buffer.
+         *
+         */
+        GapBuffer():
+        m_Buffer(nullptr),
+        m_Capacity(0),
+        m_GapStart(0),
+        m_GapEnd(0)
+        {
+            LogDebugLine("Constructing gap buffer at " << this);
+        }
+
+        /**
+         * @brief Returns item p_index, not counting the gap.
+         *
+         * @details If p_index is not less than the number of items the
+         * behaviour is undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in
+         * which case the process is aborted.
+         *
+         */
+        T& operator[] (const Size& p_index)
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(p_index >= m_Capacity - (m_GapEnd - m_GapStart))
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in gap buffer " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return m_Buffer[p_index < m_GapStart ? p_index : p_index + (m_GapEnd - m_GapStart)];
+        }
+        /**
+         * @brief Returns item p_index, readonly version.
+         *
+         */
+        const T& operator[] (const Size& p_index) const
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(p_index >= m_Capacity - (m_GapEnd - m_GapStart))
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in gap buffer " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return m_Buffer[p_index < m_GapStart ? p_index : p_index + (m_GapEnd - m_GapStart)];
+        }
+    };
+
+    /**
+     * @brief Returns the number of items in p_buffer, not counting the gap.
+     *
+     */
+    template<typename T>
+    inline Size FindSizeOfGapBuffer(const GapBuffer<T>& p_buffer)
+    {
+        return p_buffer.m_Capacity - (p_buffer.m_GapEnd - p_buffer.m_GapStart);
+    }
+
+    /**
+     * @brief Creates an empty gap buffer at outp_buffer whose gap has room
+     * for p_capacity items.
+     *
+     * @details outp_buffer is overwritten without being destroyed. If
+     * p_capacity is 0 no buffer is allocated. If allocation fails
+     * p_alloc_error is called and a gap buffer without a buffer is created.
+     *
+     */
+    template<typename T>
+    void CreateGapBufferAtOfCapacityUsingAllocator(
+        GapBuffer<T>& outp_buffer,
+        const Size& p_capacity,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating gap buffer at " << &outp_buffer << " of capacity "
+        << p_capacity);
+
+        outp_buffer = GapBuffer<T>();
+
+        if(p_capacity == 0)
+        {
+            LogDebugLine("The given capacity is 0, returning.");
+            return;
+        }
+        if(p_capacity > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine("The size of the buffer overflows, returning.");
+            return;
+        }
+
+        outp_buffer.m_Buffer = (T*)p_allocate(sizeof(T) * p_capacity);
+        if(outp_buffer.m_Buffer == nullptr)
+        {
+            LogDebugLine("Allocation of the buffer failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+        outp_buffer.m_Capacity = p_capacity;
+        outp_buffer.m_GapEnd = p_capacity;
+
+    }
+    template<typename T>
+    inline void CreateGapBufferAtOfCapacity(
+        GapBuffer<T>& outp_buffer,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for CreateGapBufferAtOfCapacityUsingAllocator");
+        CreateGapBufferAtOfCapacityUsingAllocator(
+            outp_buffer, p_capacity,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Moves the gap of p_buffer so that it starts at p_index, p_index
+     * items being before it.
+     *
+     * @details Only the items between the old and the new place of the gap
+     * are moved. If p_index is greater than the number of items p_index_error
+     * is called and the gap is not moved.
+     *
+     * @time O(d), d being the distance the gap moves.
+     *
+     */
+    template<typename T>
+    void MoveGapOfGapBufferToIndex(
+        GapBuffer<T>& p_buffer,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data
+    )
+    {
+
+        if(p_index > FindSizeOfGapBuffer(p_buffer))
+        {
+            LogDebugLine("Index " << p_index << " is past the end of gap buffer "
+            << p_buffer);
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+
+        if(p_index < p_buffer.m_GapStart)
+        {
+            //The items from p_index up to the gap go right before its end.
+            Size l_count = p_buffer.m_GapStart - p_index;
+            memmove(
+                (void*)(p_buffer.m_Buffer + p_buffer.m_GapEnd - l_count),
+                (const void*)(p_buffer.m_Buffer + p_index),
+                sizeof(T) * l_count
+            );
+            p_buffer.m_GapStart -= l_count;
+            p_buffer.m_GapEnd -= l_count;
+        }
+        else if(p_index > p_buffer.m_GapStart)
+        {
+            //The items after the gap up to p_index go right where it starts.
+            Size l_count = p_index - p_buffer.m_GapStart;
+            memmove(
+                (void*)(p_buffer.m_Buffer + p_buffer.m_GapStart),
+                (const void*)(p_buffer.m_Buffer + p_buffer.m_GapEnd),
+                sizeof(T) * l_count
+            );
+            p_buffer.m_GapStart += l_count;
+            p_buffer.m_GapEnd += l_count;
+        }
+
+    }
+
+    /**
+     * @brief Adds a copy of each item of p_to_add to p_buffer so that the
+     * first one is at p_index, the items from p_index on coming after them.
+     *
+     * @details The gap is moved to p_index and the items are copied into it.
+     * If the gap is too small the buffer is reallocated to at least double
+     * its capacity, and the items after the gap are moved to its new end.
+     *
+     * If p_index is greater than the number of items p_index_error is called
+     * and p_buffer is not mutated. If reallocation fails p_realloc_error is
+     * called and no item is added, though the gap may have moved.
+     *
+     * @param p_to_add The array whose items will be added, its buffer must
+     * not be in p_buffer.
+     * @param p_buffer The gap buffer to add the items to.
+     * @param p_index The index the first added item will have. If it is the
+     * number of items, the items are added to the end.
+     * @param p_index_error A callback in case the index is incorrect.
+     * @param p_index_error_data Data that will be passed to p_index_error.
+     * @param p_reallocate The reallocator used to grow the buffer.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     * @time O(n + d), n being p_to_add.m_Size and d the distance the gap
+     * moves, or O(n + m) amortized when growing, m being the number of
+     * items.
+     *
+     */
+    template<typename T>
+    void AddArrayToGapBufferAtIndexUsingReallocator(
+        const Array::Array<T>& p_to_add,
+        GapBuffer<T>& p_buffer,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding array " << p_to_add << " to gap buffer " << p_buffer
+        << " at index " << p_index);
+
+        Size l_size = FindSizeOfGapBuffer(p_buffer);
+        if(p_index > l_size)
+        {
+            LogDebugLine("Index " << p_index << " is past the end.");
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+        if(p_to_add.m_Buffer == nullptr || p_to_add.m_Size == 0)
+        {
+            LogDebugLine("p_to_add is empty, returning.");
+            return;
+        }
+        if((l_size + p_to_add.m_Size) < l_size || (l_size + p_to_add.m_Size) > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine("The new size overflows, returning.");
+            return;
+        }
+
+        MoveGapOfGapBufferToIndex(p_buffer, p_index, nullptr, nullptr);
+
+        if(p_buffer.m_GapEnd - p_buffer.m_GapStart < p_to_add.m_Size)
+        {
+            Size l_newCapacity = l_size + p_to_add.m_Size;
+            if(p_buffer.m_Capacity <= SIZE_MAX / sizeof(T) / 2 && p_buffer.m_Capacity * 2 > l_newCapacity)
+            {
+                l_newCapacity = p_buffer.m_Capacity * 2;
+            }
+            LogDebugLine("The gap is too small, growing the buffer to " << l_newCapacity);
+
+            T* l_newBuffer = (T*)p_reallocate(p_buffer.m_Buffer, sizeof(T) * l_newCapacity);
+            if(l_newBuffer == nullptr)
+            {
+                LogDebugLine("Reallocation failed.");
+                if(p_realloc_error != nullptr)
+                {
+                    LogDebugLine("Realloc error is not null so calling it.");
+                    p_realloc_error(p_realloc_error_data);
+                }
+                return;
+            }
+
+            Size l_countAfterGap = p_buffer.m_Capacity - p_buffer.m_GapEnd;
+            memmove(
+                (void*)(l_newBuffer + l_newCapacity - l_countAfterGap),
+                (const void*)(l_newBuffer + p_buffer.m_GapEnd),
+                sizeof(T) * l_countAfterGap
+            );
+            p_buffer.m_Buffer = l_newBuffer;
+            p_buffer.m_Capacity = l_newCapacity;
+            p_buffer.m_GapEnd = l_newCapacity - l_countAfterGap;
+        }
+
+        memcpy(
+            (void*)(p_buffer.m_Buffer + p_buffer.m_GapStart),
+            (const void*)p_to_add.m_Buffer,
+            sizeof(T) * p_to_add.m_Size
+        );
+        p_buffer.m_GapStart += p_to_add.m_Size;
+
+    }
+    template<typename T>
+    inline void AddArrayToGapBufferAtIndex(
+        const Array::Array<T>& p_to_add,
+        GapBuffer<T>& p_buffer,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data
+    )
+    {
+        LogDebugLine("Using defaults for AddArrayToGapBufferAtIndexUsingReallocator");
+        AddArrayToGapBufferAtIndexUsingReallocator(
+            p_to_add, p_buffer,
+            p_index, p_index_error, p_index_error_data,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Removes p_numberOfItems items from p_buffer, starting from and
+     * including the one at p_index.
+     *
+     * @details Unlike for arrays exactly p_numberOfItems items are removed,
+     * so 0 removes nothing and p_index may be the number of items.
+     *
+     * The gap is moved to p_index and then grown over the removed items, so
+     * none of the items after them are moved. The capacity does not change.
+     *
+     * If p_index + p_numberOfItems is greater than the number of items, or
+     * overflows, p_index_error is called and p_buffer is not mutated.
+     *
+     * @time O(d), d being the distance the gap moves.
+     *
+     */
+    template<typename T>
+    void RemoveNumberOfItemsAtIndexFromGapBuffer(
+        const Size& p_numberOfItems,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        GapBuffer<T>& p_buffer
+    )
+    {
+
+        LogDebugLine("Removing " << p_numberOfItems << " items starting from "
+        "index " << p_index << " in gap buffer " << p_buffer);
+
+        Size l_size = FindSizeOfGapBuffer(p_buffer);
+        if(p_index + p_numberOfItems < p_index || p_index + p_numberOfItems > l_size)
+        {
+            LogDebugLine("The items to remove go past the end.");
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+
+        MoveGapOfGapBufferToIndex(p_buffer, p_index, nullptr, nullptr);
+        p_buffer.m_GapEnd += p_numberOfItems;
+
+    }
+
+    /**
+     * @brief Creates a gap buffer at outp_buffer with a copy of each item of
+     * p_from, in order, followed by a gap of p_gapSize items.
+     *
+     * @details outp_buffer is overwritten without being destroyed. If
+     * allocation fails p_alloc_error is called and an empty gap buffer
+     * without a buffer is created.
+     *
+     * @time O(n), n being p_from.m_Size.
+     *
+     */
+    template<typename T>
+    void CreateGapBufferAtFromArrayUsingAllocator(
+        GapBuffer<T>& outp_buffer,
+        const Array::Array<T>& p_from,
+        const Size& p_gapSize,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating gap buffer at " << &outp_buffer << " from array "
+        << p_from << " with a gap of " << p_gapSize);
+
+        Size l_size = p_from.m_Buffer == nullptr ? 0 : p_from.m_Size;
+        if(l_size + p_gapSize < l_size)
+        {
+            LogDebugLine("The capacity overflows, creating an empty gap buffer.");
+            outp_buffer = GapBuffer<T>();
+            return;
+        }
+
+        CreateGapBufferAtOfCapacityUsingAllocator(
+            outp_buffer, l_size + p_gapSize,
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(outp_buffer.m_Buffer == nullptr)
+        {
+            LogDebugLine("The gap buffer has no buffer, returning.");
+            return;
+        }
+
+        if(l_size > 0)
+        {
+            memcpy((void*)outp_buffer.m_Buffer, (const void*)p_from.m_Buffer, sizeof(T) * l_size);
+        }
+        outp_buffer.m_GapStart = l_size;
+
+    }
+    template<typename T>
+    inline void CreateGapBufferAtFromArray(
+        GapBuffer<T>& outp_buffer,
+        const Array::Array<T>& p_from
+    )
+    {
+        LogDebugLine("Using defaults for CreateGapBufferAtFromArrayUsingAllocator");
+        CreateGapBufferAtFromArrayUsingAllocator(
+            outp_buffer, p_from, g_GAP_BUFFER_DEFAULT_GAP_SIZE,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Creates an array at outp_array with a copy of each item of
+     * p_from, in order, without the gap.
+     *
+     * @details The array's buffer is allocated using p_allocate and has a
+     * capacity of the number of items of p_from. If p_from is empty or
+     * allocation fails, in which case p_alloc_error is called, a null array
+     * is created.
+     *
+     * @time O(n), n being the number of items of p_from.
+     *
+     */
+    template<typename T>
+    void CreateArrayAtFromGapBufferUsingAllocator(
+        Array::Array<T>& outp_array,
+        const GapBuffer<T>& p_from,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating array at " << &outp_array << " from gap buffer "
+        << p_from);
+
+        outp_array = Array::Array<T>();
+        Array::CreateArrayAtOfCapacityUsingAllocator(
+            outp_array, FindSizeOfGapBuffer(p_from),
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(outp_array.m_Buffer == nullptr)
+        {
+            LogDebugLine("The array is null, returning.");
+            return;
+        }
+
+        Size l_countAfterGap = p_from.m_Capacity - p_from.m_GapEnd;
+        memcpy((void*)outp_array.m_Buffer, (const void*)p_from.m_Buffer, sizeof(T) * p_from.m_GapStart);
+        memcpy(
+            (void*)(outp_array.m_Buffer + p_from.m_GapStart),
+            (const void*)(p_from.m_Buffer + p_from.m_GapEnd),
+            sizeof(T) * l_countAfterGap
+        );
+        outp_array.m_Size = p_from.m_GapStart + l_countAfterGap;
+
+    }
+    template<typename T>
+    inline void CreateArrayAtFromGapBuffer(
+        Array::Array<T>& outp_array,
+        const GapBuffer<T>& p_from
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayAtFromGapBufferUsingAllocator");
+        CreateArrayAtFromGapBufferUsingAllocator(
+            outp_array, p_from,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Deallocates the buffer of p_buffer using p_deallocate, leaving
+     * it empty without a buffer.
+     *
+     */
+    template<typename T>
+    void DestroyGapBufferUsingDeallocator(GapBuffer<T>& p_buffer, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying gap buffer " << p_buffer);
+
+        p_deallocate(p_buffer.m_Buffer);
+        p_buffer = GapBuffer<T>();
+
+    }
+    template<typename T>
+    inline void DestroyGapBuffer(GapBuffer<T>& p_buffer)
+    {
+        LogDebugLine("Using defaults for DestroyGapBufferUsingDeallocator");
+        DestroyGapBufferUsingDeallocator(p_buffer, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+
+    #ifdef DEBUG
+    /**
+     * @brief Logs the fields of p_buffer, its items are not logged.
+     *
+     */
+    template<typename T>
+    const Debugging::Log& operator<< (const Debugging::Log& p_log, const GapBuffer<T>& p_buffer)
+    {
+
+        p_log << &p_buffer;
+        p_log << " { m_Buffer = " << (void*)p_buffer.m_Buffer;
+        p_log << ", m_Capacity = " << p_buffer.m_Capacity;
+        p_log << ", m_GapStart = " << p_buffer.m_GapStart;
+        p_log << ", m_GapEnd = " << p_buffer.m_GapEnd;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+}
+
+#endif //GAP_BUFFER__DATA_STRUCTURES_GAP_BUFFER_GAP_BUFFER_HPP
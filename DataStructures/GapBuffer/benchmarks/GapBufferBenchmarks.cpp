@@ -0,0 +1,116 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../GapBuffer.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::GapBuffer;
+
+//The size of the text that is edited, 4MiB of chars.
+static const Size g_TEXT_SIZE = 4 * 1024 * 1024;
+static const Size g_EDIT_COUNT = 2000;
+
+struct Edit
+{
+    Size m_Index;
+    Size m_Count;
+    bool m_IsAdd;
+};
+
+//Someone typing in the middle of the text, moving the cursor a little
+//between edits and deleting now and then. Every edit is at least 1 item
+//away from the start and stays before the end.
+static Array<Edit> CreateTypingEditTrace()
+{
+
+    Array<Edit> l_trace;
+    CreateArrayAtOfCapacity(l_trace, g_EDIT_COUNT);
+    srand(42);
+
+    Size l_cursor = g_TEXT_SIZE / 2;
+    for(Size i = 0; i < g_EDIT_COUNT; ++i)
+    {
+        l_cursor += rand() % 65;
+        l_cursor -= rand() % 65;
+        Edit l_edit;
+        l_edit.m_Index = l_cursor;
+        l_edit.m_Count = rand() % 16 + 1;
+        l_edit.m_IsAdd = rand() % 4 != 0;
+        l_trace.m_Buffer[i] = l_edit;
+    }
+    l_trace.m_Size = g_EDIT_COUNT;
+
+    return l_trace;
+
+}
+
+TEST_CASE("Typing edit trace", "[GapBuffer][Benchmark]")
+{
+
+    Array<char> l_text;
+    CreateArrayAtOfCapacity(l_text, g_TEXT_SIZE);
+    for(Size i = 0; i < g_TEXT_SIZE; ++i)
+    {
+        l_text.m_Buffer[i] = 'a' + i % 26;
+    }
+    l_text.m_Size = g_TEXT_SIZE;
+    Array<Edit> l_trace = CreateTypingEditTrace();
+    char l_typed[16] = {'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x'};
+
+    //Each run starts with a copy of the text, which takes the same time for
+    //both.
+    BENCHMARK_ADVANCED("Array")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            Array<char> l_array;
+            CreateArrayAtOfCapacity(l_array, g_TEXT_SIZE + g_EDIT_COUNT * 16);
+            memcpy(l_array.m_Buffer, l_text.m_Buffer, g_TEXT_SIZE);
+            l_array.m_Size = g_TEXT_SIZE;
+            for(const Edit& l_edit : l_trace)
+            {
+                if(l_edit.m_IsAdd)
+                {
+                    AddArrayToArrayAfterIndex(Array<char>(l_typed, l_edit.m_Count), l_array, l_edit.m_Index - 1, nullptr, nullptr);
+                }
+                else
+                {
+                    RemoveNumberOfItemsStartingFromAndIncludingIndexFromArray(l_edit.m_Count - 1, l_edit.m_Index, nullptr, nullptr, l_array);
+                }
+            }
+            Size l_size = l_array.m_Size;
+            DestoryArray(l_array);
+            return l_size;
+        });
+    };
+    BENCHMARK_ADVANCED("GapBuffer")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            GapBuffer<char> l_buffer;
+            CreateGapBufferAtFromArray(l_buffer, l_text);
+            for(const Edit& l_edit : l_trace)
+            {
+                if(l_edit.m_IsAdd)
+                {
+                    AddArrayToGapBufferAtIndex(Array<char>(l_typed, l_edit.m_Count), l_buffer, l_edit.m_Index, nullptr, nullptr);
+                }
+                else
+                {
+                    RemoveNumberOfItemsAtIndexFromGapBuffer(l_edit.m_Count, l_edit.m_Index, nullptr, nullptr, l_buffer);
+                }
+            }
+            Size l_size = FindSizeOfGapBuffer(l_buffer);
+            DestroyGapBuffer(l_buffer);
+            return l_size;
+        });
+    };
+
+    DestoryArray(l_trace);
+    DestoryArray(l_text);
+
+}
@@ -0,0 +1,201 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <vector>
+
+#include "../GapBuffer.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::GapBuffer;
+using namespace Debugging;
+
+static bool IsGapBufferEqualToItems(const GapBuffer<int>& p_buffer, const std::vector<int>& p_items)
+{
+    if(FindSizeOfGapBuffer(p_buffer) != p_items.size())
+    {
+        return false;
+    }
+    for(Size i = 0; i < p_items.size(); ++i)
+    {
+        if(p_buffer[i] != p_items[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Gap buffer creation", "[GapBuffer]")
+{
+
+    GapBuffer<int> l_buffer;
+    CHECK(l_buffer.m_Buffer == nullptr);
+    CHECK(FindSizeOfGapBuffer(l_buffer) == 0);
+
+    SECTION("Of capacity")
+    {
+        Size l_capacity = GENERATE((Size)0, (Size)1, (Size)100);
+        CreateGapBufferAtOfCapacity(l_buffer, l_capacity);
+        CHECK(l_buffer.m_Capacity == l_capacity);
+        CHECK(FindSizeOfGapBuffer(l_buffer) == 0);
+        CHECK(l_buffer.m_GapStart == 0);
+        CHECK(l_buffer.m_GapEnd == l_capacity);
+    }
+    SECTION("From an array")
+    {
+        int l_items[] = {1, 2, 3, 4, 5};
+        Array<int> l_array(l_items, 5);
+        Size l_gapSize = GENERATE((Size)0, (Size)3);
+        CreateGapBufferAtFromArrayUsingAllocator(l_buffer, l_array, l_gapSize, malloc, nullptr, nullptr);
+        CHECK(l_buffer.m_Capacity == 5 + l_gapSize);
+        CHECK(IsGapBufferEqualToItems(l_buffer, {1, 2, 3, 4, 5}));
+
+        Array<int> l_back;
+        CreateArrayAtFromGapBuffer(l_back, l_buffer);
+        CHECK(l_back == l_array);
+        DestoryArray(l_back);
+    }
+    SECTION("Allocation failure")
+    {
+        bool l_called = false;
+        CreateGapBufferAtOfCapacityUsingAllocator(l_buffer, 10, NullMalloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(l_buffer.m_Buffer == nullptr);
+        CHECK(l_buffer.m_Capacity == 0);
+    }
+
+    DestroyGapBuffer(l_buffer);
+    CHECK(l_buffer.m_Buffer == nullptr);
+
+}
+
+TEST_CASE("Gap buffer edits", "[GapBuffer]")
+{
+
+    int l_items[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    Array<int> l_array(l_items, 8);
+    GapBuffer<int> l_buffer;
+    CreateGapBufferAtFromArrayUsingAllocator(l_buffer, l_array, 2, malloc, nullptr, nullptr);
+    std::vector<int> l_expected(l_items, l_items + 8);
+
+    SECTION("Moving the gap does not change the items")
+    {
+        Size l_index = GENERATE((Size)0, (Size)3, (Size)8);
+        MoveGapOfGapBufferToIndex(l_buffer, l_index, nullptr, nullptr);
+        CHECK(l_buffer.m_GapStart == l_index);
+        CHECK(IsGapBufferEqualToItems(l_buffer, l_expected));
+
+        bool l_called = false;
+        MoveGapOfGapBufferToIndex(l_buffer, 9, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(l_buffer.m_GapStart == l_index);
+    }
+    SECTION("Adding items")
+    {
+        int l_toAddItems[] = {10, 11, 12};
+        Array<int> l_toAdd(l_toAddItems, 3);
+        Size l_index = GENERATE((Size)0, (Size)5, (Size)8);
+
+        //Bigger than the gap, so the buffer grows.
+        AddArrayToGapBufferAtIndex(l_toAdd, l_buffer, l_index, nullptr, nullptr);
+        l_expected.insert(l_expected.begin() + l_index, l_toAddItems, l_toAddItems + 3);
+        CHECK(IsGapBufferEqualToItems(l_buffer, l_expected));
+        CHECK(l_buffer.m_Capacity >= 11);
+
+        //Right after the last ones, which fits in the gap.
+        Size l_capacity = l_buffer.m_Capacity;
+        AddArrayToGapBufferAtIndex(Array<int>(l_toAddItems, 1), l_buffer, l_index + 3, nullptr, nullptr);
+        l_expected.insert(l_expected.begin() + l_index + 3, 10);
+        CHECK(IsGapBufferEqualToItems(l_buffer, l_expected));
+        CHECK(l_buffer.m_Capacity == l_capacity);
+    }
+    SECTION("Removing items")
+    {
+        Size l_index = GENERATE((Size)0, (Size)2, (Size)5);
+        RemoveNumberOfItemsAtIndexFromGapBuffer(3, l_index, nullptr, nullptr, l_buffer);
+        l_expected.erase(l_expected.begin() + l_index, l_expected.begin() + l_index + 3);
+        CHECK(IsGapBufferEqualToItems(l_buffer, l_expected));
+        CHECK(l_buffer.m_Capacity == 10);
+
+        RemoveNumberOfItemsAtIndexFromGapBuffer(5, 0, nullptr, nullptr, l_buffer);
+        CHECK(FindSizeOfGapBuffer(l_buffer) == 0);
+    }
+    SECTION("Index errors")
+    {
+        bool l_called = false;
+        AddArrayToGapBufferAtIndex(l_array, l_buffer, 9, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+
+        l_called = false;
+        RemoveNumberOfItemsAtIndexFromGapBuffer(3, 6, GeneralErrorCallback, &l_called, l_buffer);
+        CHECK(l_called);
+
+        l_called = false;
+        RemoveNumberOfItemsAtIndexFromGapBuffer(SIZE_MAX, 1, GeneralErrorCallback, &l_called, l_buffer);
+        CHECK(l_called);
+
+        CHECK(IsGapBufferEqualToItems(l_buffer, l_expected));
+    }
+    SECTION("Reallocation failure")
+    {
+        bool l_called = false;
+        AddArrayToGapBufferAtIndexUsingReallocator(
+            l_array, l_buffer, 4,
+            nullptr, nullptr,
+            NullRealloc, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(IsGapBufferEqualToItems(l_buffer, l_expected));
+    }
+
+    DestroyGapBuffer(l_buffer);
+
+}
+
+TEST_CASE("Gap buffer edit trace", "[GapBuffer]")
+{
+
+    GapBuffer<int> l_buffer;
+    std::vector<int> l_expected;
+    srand(42);
+
+    int l_items[16];
+    for(int i = 0; i < 2000; ++i)
+    {
+        Size l_size = l_expected.size();
+        Size l_index = rand() % (l_size + 1);
+        if(rand() % 3 != 0 || l_size == 0)
+        {
+            Size l_count = rand() % 16 + 1;
+            for(Size n = 0; n < l_count; ++n)
+            {
+                l_items[n] = i;
+            }
+            AddArrayToGapBufferAtIndex(Array<int>(l_items, l_count), l_buffer, l_index, nullptr, nullptr);
+            l_expected.insert(l_expected.begin() + l_index, l_items, l_items + l_count);
+        }
+        else
+        {
+            Size l_count = rand() % (l_size - (l_index == l_size ? l_size : l_index) + 1);
+            l_index = l_index == l_size ? 0 : l_index;
+            RemoveNumberOfItemsAtIndexFromGapBuffer(l_count, l_index, nullptr, nullptr, l_buffer);
+            l_expected.erase(l_expected.begin() + l_index, l_expected.begin() + l_index + l_count);
+        }
+        REQUIRE(FindSizeOfGapBuffer(l_buffer) == l_expected.size());
+    }
+
+    Array<int> l_array;
+    CreateArrayAtFromGapBuffer(l_array, l_buffer);
+    REQUIRE(l_array.m_Size == l_expected.size());
+    for(Size i = 0; i < l_expected.size(); ++i)
+    {
+        REQUIRE(l_array.m_Buffer[i] == l_expected[i]);
+    }
+
+    DestoryArray(l_array);
+    DestroyGapBuffer(l_buffer);
+
+}
@@ -0,0 +1,894 @@
+/** @file ParallelArray.hpp
+ * @brief Defines everything in the @ref ParallelArrayMod module.
+ *
+ */
+
+#ifndef PARALLEL_ARRAY__DATA_STRUCTURES_PARALLEL_ARRAY_PARALLEL_ARRAY_HPP
+#define PARALLEL_ARRAY__DATA_STRUCTURES_PARALLEL_ARRAY_PARALLEL_ARRAY_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+#include "../../Asynchronous/ThreadPool/include/ThreadPool.hpp"
+
+#include <stdint.h>
+#include <atomic>
+#include <new>
+
+namespace Library::DataStructures::ParallelArray
+{
+
+    /**
+     * @brief The number of bytes of items each chunk has when the work is
+     * split up automatically.
+     *
+     * @details Half of a typical 256 KiB level 2 cache, so that the items of a
+     * chunk and whatever is written for them stay in the cache of the
+     * processor working on it.
+     *
+     */
+    constexpr Size g_PARALLEL_ARRAY_CHUNK_SIZE = 128 * 1024;
+
+    /**
+     * @brief The fewest items each thread is given by
+     * @ref SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator.
+     *
+     * @details Merging the sorted pieces is done by fewer and fewer threads,
+     * so fewer items per piece would not pay for it.
+     *
+     */
+    constexpr Size g_PARALLEL_ARRAY_SORT_MINIMUM_ITEMS_PER_THREAD = 1 << 14;
+
+    /**
+     * @brief Returns the number of items each chunk has, p_grainSize if it is
+     * not 0 or otherwise as many items of T as fit in
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE, at least 1.
+     *
+     */
+    template<typename T>
+    constexpr Size FindChunkSizeForGrainSize(Size p_grainSize)
+    {
+        if(p_grainSize != 0)
+        {
+            return p_grainSize;
+        }
+        return sizeof(T) < g_PARALLEL_ARRAY_CHUNK_SIZE ? g_PARALLEL_ARRAY_CHUNK_SIZE / sizeof(T) : 1;
+    }
+
+    /**
+     * @brief Calls (*(F*)p_function)(p_chunk), used to run a function object
+     * for each chunk on a thread pool.
+     *
+     */
+    template<typename F>
+    void DoParallelArrayChunk(void* p_function, Size p_chunk)
+    {
+        (*(F*)p_function)(p_chunk);
+    }
+
+    /**
+     * @brief Splits [0, p_size) into chunks of p_chunkSize and calls
+     * p_doChunk(begin, end) for each on p_pool, returning once all are done.
+     *
+     * @details The last chunk may be smaller. Nothing is called if p_size is
+     * 0.
+     *
+     */
+    template<typename F>
+    void DoEachChunkOnThreadPool(
+        Size p_size, Size p_chunkSize, F&& p_doChunk,
+        Asynchronous::ThreadPool& p_pool
+    )
+    {
+
+        Size l_chunkCount = p_size / p_chunkSize + (p_size % p_chunkSize != 0);
+        auto l_doChunk = [&](Size p_chunk)
+        {
+            Size l_begin = p_chunk * p_chunkSize;
+            Size l_end = p_size - l_begin > p_chunkSize ? l_begin + p_chunkSize : p_size;
+            p_doChunk(l_begin, l_end);
+        };
+
+        LogDebugLine("Doing " << l_chunkCount << " chunks of " << p_chunkSize << " items.");
+        Asynchronous::RunRoutineForEachTaskOnThreadPool(
+            p_pool,
+            DoParallelArrayChunk<decltype(l_doChunk)>, &l_doChunk,
+            l_chunkCount
+        );
+
+    }
+
+
+    /**
+     * @brief Calls p_function with each item of p_array, on p_pool.
+     *
+     * @details The array is split into chunks of consecutive items, each
+     * chunk is done by one thread in order.
+     *
+     * @param p_array The array whose items to give to p_function.
+     * @param p_function Called with a reference to an item, from many threads
+     * at once. It may change the item it is given but no other.
+     * @param p_pool The pool to use.
+     * @param p_grainSize The number of items of a chunk, 0 to size chunks to
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE.
+     *
+     * **p_array.m_Buffer, p_array.m_Size and p_array.m_Capacity** are not
+     * mutated in any way.
+     *
+     * @time O(n / p), n being p_array.m_Size and p the number of threads.
+     *
+     */
+    template<typename T, typename F>
+    void ForEachItemOfArrayOnThreadPool(
+        Array::Array<T>& p_array,
+        F&& p_function,
+        Asynchronous::ThreadPool& p_pool, Size p_grainSize
+    )
+    {
+
+        LogDebugLine("Calling a function for each item of " << p_array << " in parallel.");
+
+        T* l_items = p_array.m_Buffer;
+        DoEachChunkOnThreadPool(
+            p_array.m_Size, FindChunkSizeForGrainSize<T>(p_grainSize),
+            [&](Size p_begin, Size p_end)
+            {
+                for(Size i = p_begin; i < p_end; ++i)
+                {
+                    p_function(l_items[i]);
+                }
+            },
+            p_pool
+        );
+
+    }
+    /**
+     * @brief Uses the default thread pool and sizes chunks automatically.
+     *
+     */
+    template<typename T, typename F>
+    inline void ForEachItemOfArrayInParallel(Array::Array<T>& p_array, F&& p_function)
+    {
+        LogDebugLine("Using defaults for ForEachItemOfArrayOnThreadPool");
+        ForEachItemOfArrayOnThreadPool(p_array, p_function, Asynchronous::GetDefaultThreadPool(), 0);
+    }
+
+    /**
+     * @brief Sets each item of p_to to p_transform called with the item of
+     * p_from at the same index, on p_pool.
+     *
+     * @param p_from The array whose items to transform.
+     * @param p_to The array to put the results into, may be p_from.
+     * @param p_transform Called with a const reference to an item of p_from,
+     * from many threads at once, returns what to assign to p_to.
+     * @param p_pool The pool to use.
+     * @param p_grainSize The number of items of a chunk, 0 to size chunks to
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE.
+     *
+     * **p_from** is not mutated in any way, unless it is p_to.
+     *
+     * **p_to.m_Buffer and p_to.m_Capacity** are not mutated in any way.
+     *
+     * **p_to.m_Size** is set to p_from.m_Size.
+     *
+     * **If p_to.m_Capacity is less than p_from.m_Size** p_to is not mutated in
+     * any way.
+     *
+     * @time O(n / p), n being p_from.m_Size and p the number of threads.
+     *
+     */
+    template<typename T, typename U, typename F>
+    void TransformArrayIntoArrayOnThreadPool(
+        const Array::Array<T>& p_from,
+        Array::Array<U>& p_to,
+        F&& p_transform,
+        Asynchronous::ThreadPool& p_pool, Size p_grainSize
+    )
+    {
+
+        LogDebugLine("Transforming " << p_from << " into " << p_to << " in parallel.");
+
+        if(p_to.m_Capacity < p_from.m_Size)
+        {
+            LogDebugLine("The array to transform into is too small, not doing anything.");
+            return;
+        }
+
+        const T* l_from = p_from.m_Buffer;
+        U* l_to = p_to.m_Buffer;
+        DoEachChunkOnThreadPool(
+            p_from.m_Size, FindChunkSizeForGrainSize<T>(p_grainSize),
+            [&](Size p_begin, Size p_end)
+            {
+                for(Size i = p_begin; i < p_end; ++i)
+                {
+                    l_to[i] = p_transform(l_from[i]);
+                }
+            },
+            p_pool
+        );
+        p_to.m_Size = p_from.m_Size;
+
+    }
+    /**
+     * @brief Uses the default thread pool and sizes chunks automatically.
+     *
+     */
+    template<typename T, typename U, typename F>
+    inline void TransformArrayIntoArrayInParallel(const Array::Array<T>& p_from, Array::Array<U>& p_to, F&& p_transform)
+    {
+        LogDebugLine("Using defaults for TransformArrayIntoArrayOnThreadPool");
+        TransformArrayIntoArrayOnThreadPool(p_from, p_to, p_transform, Asynchronous::GetDefaultThreadPool(), 0);
+    }
+
+    /**
+     * @brief Returns the number of items of p_array for which p_function
+     * returns true, calling it on p_pool.
+     *
+     * @param p_array The array whose items to count.
+     * @param p_function Called with a const reference to an item, from many
+     * threads at once.
+     * @param p_pool The pool to use.
+     * @param p_grainSize The number of items of a chunk, 0 to size chunks to
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE.
+     *
+     * **p_array** is not mutated in any way.
+     *
+     * @time O(n / p), n being p_array.m_Size and p the number of threads.
+     *
+     */
+    template<typename T, typename F>
+    Size FindNumberOfItemsForWhichFunctionReturnsTrueInArrayOnThreadPool(
+        const Array::Array<T>& p_array,
+        F&& p_function,
+        Asynchronous::ThreadPool& p_pool, Size p_grainSize
+    )
+    {
+
+        LogDebugLine("Counting items of " << p_array << " in parallel.");
+
+        const T* l_items = p_array.m_Buffer;
+        std::atomic<Size> l_count(0);
+        DoEachChunkOnThreadPool(
+            p_array.m_Size, FindChunkSizeForGrainSize<T>(p_grainSize),
+            [&](Size p_begin, Size p_end)
+            {
+                Size l_chunkCount = 0;
+                for(Size i = p_begin; i < p_end; ++i)
+                {
+                    l_chunkCount += p_function(l_items[i]) ? 1 : 0;
+                }
+                l_count.fetch_add(l_chunkCount, std::memory_order_relaxed);
+            },
+            p_pool
+        );
+
+        LogDebugLine("Counted " << l_count.load() << " items.");
+        return l_count.load(std::memory_order_relaxed);
+
+    }
+    /**
+     * @brief Uses the default thread pool and sizes chunks automatically.
+     *
+     */
+    template<typename T, typename F>
+    inline Size FindNumberOfItemsForWhichFunctionReturnsTrueInArrayInParallel(const Array::Array<T>& p_array, F&& p_function)
+    {
+        LogDebugLine("Using defaults for FindNumberOfItemsForWhichFunctionReturnsTrueInArrayOnThreadPool");
+        return FindNumberOfItemsForWhichFunctionReturnsTrueInArrayOnThreadPool(
+            p_array, p_function, Asynchronous::GetDefaultThreadPool(), 0
+        );
+    }
+
+    /**
+     * @brief Returns the index of the first item of p_array for which
+     * p_function returns true, calling it on p_pool.
+     *
+     * @details Chunks that start after an item that was already found are
+     * skipped, and a chunk stops at its first such item, so p_function is not
+     * necessarily called for every item, nor only for items before the one
+     * found.
+     *
+     * @param p_array The array to search.
+     * @param p_function Called with a const reference to an item, from many
+     * threads at once.
+     * @param p_pool The pool to use.
+     * @param p_grainSize The number of items of a chunk, 0 to size chunks to
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE.
+     * @return The index of the first such item, or p_array.m_Size if there is
+     * none.
+     *
+     * **p_array** is not mutated in any way.
+     *
+     * @time O(n / p), n being p_array.m_Size and p the number of threads.
+     *
+     */
+    template<typename T, typename F>
+    Size FindIndexOfFirstItemForWhichFunctionReturnsTrueInArrayOnThreadPool(
+        const Array::Array<T>& p_array,
+        F&& p_function,
+        Asynchronous::ThreadPool& p_pool, Size p_grainSize
+    )
+    {
+
+        LogDebugLine("Searching " << p_array << " in parallel.");
+
+        const T* l_items = p_array.m_Buffer;
+        std::atomic<Size> l_first(p_array.m_Size);
+        DoEachChunkOnThreadPool(
+            p_array.m_Size, FindChunkSizeForGrainSize<T>(p_grainSize),
+            [&](Size p_begin, Size p_end)
+            {
+                for(Size i = p_begin; i < p_end; ++i)
+                {
+                    //Checked each item so a chunk stops early as well.
+                    Size l_found = l_first.load(std::memory_order_relaxed);
+                    if(l_found <= i)
+                    {
+                        return;
+                    }
+                    if(p_function(l_items[i]))
+                    {
+                        while(i < l_found && !l_first.compare_exchange_weak(l_found, i, std::memory_order_relaxed));
+                        return;
+                    }
+                }
+            },
+            p_pool
+        );
+
+        LogDebugLine("Found index " << l_first.load());
+        return l_first.load(std::memory_order_relaxed);
+
+    }
+    /**
+     * @brief Uses the default thread pool and sizes chunks automatically.
+     *
+     */
+    template<typename T, typename F>
+    inline Size FindIndexOfFirstItemForWhichFunctionReturnsTrueInArrayInParallel(const Array::Array<T>& p_array, F&& p_function)
+    {
+        LogDebugLine("Using defaults for FindIndexOfFirstItemForWhichFunctionReturnsTrueInArrayOnThreadPool");
+        return FindIndexOfFirstItemForWhichFunctionReturnsTrueInArrayOnThreadPool(
+            p_array, p_function, Asynchronous::GetDefaultThreadPool(), 0
+        );
+    }
+
+    /**
+     * @brief Allocates room for a result of each chunk of an array of p_size
+     * items, the number of chunks is put in outp_chunkCount.
+     *
+     * @details If allocation fails p_alloc_error is called, if it is not
+     * null, and null is returned.
+     *
+     */
+    template<typename T>
+    T* AllocateResultOfEachChunkUsingAllocator(
+        Size p_size, Size p_chunkSize, Size& outp_chunkCount,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        outp_chunkCount = p_size / p_chunkSize + (p_size % p_chunkSize != 0);
+        T* l_results = nullptr;
+        if(outp_chunkCount <= SIZE_MAX / sizeof(T))
+        {
+            l_results = (T*)p_allocate(sizeof(T) * outp_chunkCount);
+        }
+        if(l_results == nullptr)
+        {
+            LogDebugLine("Allocation of the result of each chunk failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+        }
+        return l_results;
+
+    }
+
+    /**
+     * @brief Returns p_initial combined with each item of p_array in order
+     * using p_combine, on p_pool.
+     *
+     * @details Each chunk is combined on its own starting with its first item,
+     * then the results of the chunks are combined in order on the calling
+     * thread, starting with p_initial. So p_combine has to be associative,
+     * but does not have to be commutative, for the result to be the same as
+     * combining on one thread.
+     *
+     * @param p_array The array to reduce.
+     * @param p_initial What the result starts as, also the result if the
+     * array is empty.
+     * @param p_combine Called with two const references to T and returns the
+     * T they combine into, from many threads at once.
+     * @param p_pool The pool to use.
+     * @param p_grainSize The number of items of a chunk, 0 to size chunks to
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE.
+     * @param p_allocate The allocator used for the result of each chunk.
+     * @param p_deallocate The deallocator used for the result of each chunk.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     * @return The combined items.
+     *
+     * **p_array** is not mutated in any way.
+     *
+     * **If allocation fails** p_alloc_error is called and the array is
+     * reduced on the calling thread, so the result is the same.
+     *
+     * @time O(n / p + c), n being p_array.m_Size, p the number of threads and
+     * c the number of chunks.
+     *
+     */
+    template<typename T, typename F>
+    T ReduceArrayOnThreadPoolUsingAllocatorAndDeallocator(
+        const Array::Array<T>& p_array,
+        const T& p_initial,
+        F&& p_combine,
+        Asynchronous::ThreadPool& p_pool, Size p_grainSize,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Reducing " << p_array << " in parallel.");
+
+        const T* l_items = p_array.m_Buffer;
+        T l_result = p_initial;
+        if(p_array.m_Size == 0)
+        {
+            return l_result;
+        }
+
+        Size l_chunkSize = FindChunkSizeForGrainSize<T>(p_grainSize);
+        Size l_chunkCount;
+        T* l_chunkResults = AllocateResultOfEachChunkUsingAllocator<T>(
+            p_array.m_Size, l_chunkSize, l_chunkCount,
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(l_chunkResults == nullptr)
+        {
+            LogDebugLine("Reducing on this thread.");
+            for(Size i = 0; i < p_array.m_Size; ++i)
+            {
+                l_result = p_combine(l_result, l_items[i]);
+            }
+            return l_result;
+        }
+
+        DoEachChunkOnThreadPool(
+            p_array.m_Size, l_chunkSize,
+            [&](Size p_begin, Size p_end)
+            {
+                T l_chunkResult = l_items[p_begin];
+                for(Size i = p_begin + 1; i < p_end; ++i)
+                {
+                    l_chunkResult = p_combine(l_chunkResult, l_items[i]);
+                }
+                new (l_chunkResults + p_begin / l_chunkSize) T(std::move(l_chunkResult));
+            },
+            p_pool
+        );
+
+        for(Size i = 0; i < l_chunkCount; ++i)
+        {
+            l_result = p_combine(l_result, l_chunkResults[i]);
+            l_chunkResults[i].~T();
+        }
+        p_deallocate(l_chunkResults);
+
+        return l_result;
+
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data, uses the
+     * default thread pool and sizes chunks automatically.
+     *
+     */
+    template<typename T, typename F>
+    inline T ReduceArrayInParallel(const Array::Array<T>& p_array, const T& p_initial, F&& p_combine)
+    {
+        LogDebugLine("Using defaults for ReduceArrayOnThreadPoolUsingAllocatorAndDeallocator");
+        return ReduceArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            p_array, p_initial, p_combine,
+            Asynchronous::GetDefaultThreadPool(), 0,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Sets each item of p_to to the items of p_from up to and including
+     * the one at the same index combined in order using p_combine, on p_pool.
+     *
+     * @details This is an inclusive scan, also known as a prefix sum. It is
+     * done in 2 passes over the items: first each chunk is combined on its
+     * own, then the results of the chunks before each chunk are combined on
+     * the calling thread and each chunk is scanned starting from them. So
+     * p_combine is called about twice as many times as on one thread, and
+     * has to be associative for the result to be the same.
+     *
+     * @param p_from The array to scan.
+     * @param p_to The array to put the results into, may be p_from.
+     * @param p_combine Called with two const references to T and returns the
+     * T they combine into, from many threads at once.
+     * @param p_pool The pool to use.
+     * @param p_grainSize The number of items of a chunk, 0 to size chunks to
+     * @ref g_PARALLEL_ARRAY_CHUNK_SIZE.
+     * @param p_allocate The allocator used for the result of each chunk.
+     * @param p_deallocate The deallocator used for the result of each chunk.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * **p_from** is not mutated in any way, unless it is p_to.
+     *
+     * **p_to.m_Buffer and p_to.m_Capacity** are not mutated in any way.
+     *
+     * **p_to.m_Size** is set to p_from.m_Size.
+     *
+     * **If p_to.m_Capacity is less than p_from.m_Size** p_to is not mutated in
+     * any way.
+     *
+     * **If allocation fails** p_alloc_error is called and the array is
+     * scanned on the calling thread, so the result is the same.
+     *
+     * @time O(n / p + c), n being p_from.m_Size, p the number of threads and
+     * c the number of chunks.
+     *
+     */
+    template<typename T, typename F>
+    void ScanArrayIntoArrayOnThreadPoolUsingAllocatorAndDeallocator(
+        const Array::Array<T>& p_from,
+        Array::Array<T>& p_to,
+        F&& p_combine,
+        Asynchronous::ThreadPool& p_pool, Size p_grainSize,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Scanning " << p_from << " into " << p_to << " in parallel.");
+
+        if(p_to.m_Capacity < p_from.m_Size)
+        {
+            LogDebugLine("The array to scan into is too small, not doing anything.");
+            return;
+        }
+        if(p_from.m_Size == 0)
+        {
+            p_to.m_Size = 0;
+            return;
+        }
+
+        const T* l_from = p_from.m_Buffer;
+        T* l_to = p_to.m_Buffer;
+        auto l_scanChunk = [&](const T& p_before, Size p_begin, Size p_end)
+        {
+            //The item is read before it is written, as l_from may be l_to.
+            const T* l_previous = &p_before;
+            for(Size i = p_begin; i < p_end; ++i)
+            {
+                l_to[i] = p_combine(*l_previous, l_from[i]);
+                l_previous = l_to + i;
+            }
+        };
+
+        Size l_chunkSize = FindChunkSizeForGrainSize<T>(p_grainSize);
+        Size l_chunkCount;
+        T* l_chunkResults = AllocateResultOfEachChunkUsingAllocator<T>(
+            p_from.m_Size, l_chunkSize, l_chunkCount,
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(l_chunkResults == nullptr)
+        {
+            LogDebugLine("Scanning on this thread.");
+            l_to[0] = l_from[0];
+            l_scanChunk(l_to[0], 1, p_from.m_Size);
+            p_to.m_Size = p_from.m_Size;
+            return;
+        }
+
+        //The last chunk's result is not needed by any other chunk.
+        DoEachChunkOnThreadPool(
+            p_from.m_Size - (p_from.m_Size - 1) % l_chunkSize - 1, l_chunkSize,
+            [&](Size p_begin, Size p_end)
+            {
+                T l_chunkResult = l_from[p_begin];
+                for(Size i = p_begin + 1; i < p_end; ++i)
+                {
+                    l_chunkResult = p_combine(l_chunkResult, l_from[i]);
+                }
+                new (l_chunkResults + p_begin / l_chunkSize) T(std::move(l_chunkResult));
+            },
+            p_pool
+        );
+
+        //Each chunk result becomes the result of all chunks up to it.
+        for(Size i = 1; i + 1 < l_chunkCount; ++i)
+        {
+            l_chunkResults[i] = p_combine(l_chunkResults[i - 1], l_chunkResults[i]);
+        }
+
+        DoEachChunkOnThreadPool(
+            p_from.m_Size, l_chunkSize,
+            [&](Size p_begin, Size p_end)
+            {
+                if(p_begin == 0)
+                {
+                    l_to[0] = l_from[0];
+                    l_scanChunk(l_to[0], 1, p_end);
+                }
+                else
+                {
+                    l_scanChunk(l_chunkResults[p_begin / l_chunkSize - 1], p_begin, p_end);
+                }
+            },
+            p_pool
+        );
+
+        for(Size i = 0; i + 1 < l_chunkCount; ++i)
+        {
+            l_chunkResults[i].~T();
+        }
+        p_deallocate(l_chunkResults);
+
+        p_to.m_Size = p_from.m_Size;
+
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data, uses the
+     * default thread pool and sizes chunks automatically.
+     *
+     */
+    template<typename T, typename F>
+    inline void ScanArrayIntoArrayInParallel(const Array::Array<T>& p_from, Array::Array<T>& p_to, F&& p_combine)
+    {
+        LogDebugLine("Using defaults for ScanArrayIntoArrayOnThreadPoolUsingAllocatorAndDeallocator");
+        ScanArrayIntoArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            p_from, p_to, p_combine,
+            Asynchronous::GetDefaultThreadPool(), 0,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+
+    /**
+     * @brief A piece of work of a parallel sort, either sorting
+     * [m_Begin, m_End) or merging [m_Begin, m_Middle) with
+     * [m_Middle, m_End).
+     *
+     */
+    template<typename T, typename C>
+    struct ParallelSortTask
+    {
+        T* m_Begin;
+        T* m_Middle;
+        T* m_End;
+        /**
+         * @brief Room for the items of [m_Begin, m_Middle) when merging,
+         * null when sorting.
+         *
+         */
+        T* m_Buffer;
+        C* m_IsBefore;
+        Size m_BadAllowed;
+    };
+
+    /**
+     * @brief Does task number p_task of p_tasks, which are ParallelSortTask<T, C>.
+     * Can be run on a thread pool.
+     *
+     */
+    template<typename T, typename C>
+    void DoParallelSortTask(void* p_tasks, Size p_task)
+    {
+
+        ParallelSortTask<T, C>& l_task = ((ParallelSortTask<T, C>*)p_tasks)[p_task];
+
+        if(l_task.m_Buffer == nullptr)
+        {
+            Array::SortItemsUsingComparator<Array::g_ARRAY_SORT_WITHOUT_BRANCHES<T>>(
+                l_task.m_Begin, l_task.m_End, *l_task.m_IsBefore,
+                l_task.m_BadAllowed, true
+            );
+        }
+        else if((*l_task.m_IsBefore)(*l_task.m_Middle, *(l_task.m_Middle - 1)))
+        {
+            Array::MergeItemsUsingComparatorAndBuffer(
+                l_task.m_Begin, l_task.m_Middle, l_task.m_End, *l_task.m_IsBefore,
+                l_task.m_Buffer
+            );
+        }
+
+    }
+
+    /**
+     * @brief Sorts p_array on the threads of p_pool so that no item is before
+     * the item preceding it, as told by p_isBefore.
+     *
+     * @details The array is split into a power of 2 number of pieces, no more
+     * than the threads of the pool plus the calling thread, each with at
+     * least @ref g_PARALLEL_ARRAY_SORT_MINIMUM_ITEMS_PER_THREAD items. Each
+     * piece is sorted on its own thread the same way as
+     * @ref Library::DataStructures::Array::SortArrayUsingComparator "SortArrayUsingComparator"
+     * does, then neighbouring pieces are merged pairwise, again each pair on
+     * its own thread, until one piece is left. If the array is too small for
+     * 2 pieces it is sorted on the calling thread.
+     *
+     * Merging needs scratch memory for every item, which is allocated with
+     * p_allocate together with the bookkeeping of the pieces and deallocated
+     * with p_deallocate before returning.
+     *
+     * Items that are not before each other can end up in any order.
+     *
+     * @tparam C See @ref Library::DataStructures::Array::SortArrayUsingComparator "SortArrayUsingComparator",
+     * it is called from many threads at once.
+     *
+     * @param p_array The array to sort.
+     * @param p_isBefore Returns true if its first argument goes before its
+     * second.
+     * @param p_pool The pool to use.
+     * @param p_allocate The allocator used for the scratch memory.
+     * @param p_deallocate The deallocator used for the scratch memory.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * **p_array.m_Buffer, p_array.m_Size and p_array.m_Capacity** are not
+     * mutated in any way.
+     *
+     * **If allocation of the scratch memory fails** p_alloc_error is called and
+     * the array is then sorted on the calling thread, so the result is the
+     * same.
+     *
+     * @time O((n / p) log n + n), n being p_array.m_Size and p the number of
+     * threads used. The last merge is done by a single thread.
+     *
+     */
+    template<typename T, typename C>
+    void SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator(
+        Array::Array<T>& p_array,
+        C&& p_isBefore,
+        Asynchronous::ThreadPool& p_pool,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        using Task = ParallelSortTask<T, std::remove_reference_t<C>>;
+
+        Size l_threadCount = Asynchronous::GetThreadCountOfThreadPool(p_pool) + 1;
+        LogDebugLine("Sorting array " << p_array << " on up to " << l_threadCount << " threads.");
+
+        Size l_pieceCount = 1;
+        while(
+            l_pieceCount * 2 <= l_threadCount &&
+            p_array.m_Size / (l_pieceCount * 2) >= g_PARALLEL_ARRAY_SORT_MINIMUM_ITEMS_PER_THREAD
+        )
+        {
+            l_pieceCount *= 2;
+        }
+
+        if(l_pieceCount < 2)
+        {
+            LogDebugLine("Too few items or threads, sorting on this thread.");
+            Array::SortArrayUsingComparator(p_array, p_isBefore);
+            return;
+        }
+
+        //The tasks come first and then the scratch items, aligned for T.
+        Size l_tasksSize = sizeof(Task) * l_pieceCount;
+        Size l_scratchOffset = (l_tasksSize + alignof(T) - 1) / alignof(T) * alignof(T);
+        void* l_block = nullptr;
+        if(p_array.m_Size <= (SIZE_MAX - l_scratchOffset) / sizeof(T))
+        {
+            l_block = p_allocate(l_scratchOffset + sizeof(T) * p_array.m_Size);
+        }
+        if(l_block == nullptr)
+        {
+            LogDebugLine("Allocation of the scratch memory failed, sorting on "
+            "this thread.");
+            if(p_alloc_error != nullptr)
+            {
+                p_alloc_error(p_alloc_error_data);
+            }
+            Array::SortArrayUsingComparator(p_array, p_isBefore);
+            return;
+        }
+
+        Task* l_tasks = (Task*)l_block;
+        T* l_scratch = (T*)((Byte*)l_block + l_scratchOffset);
+
+        //The same bad partition allowance as for the whole array.
+        Size l_badAllowed = 0;
+        for(Size l_size = p_array.m_Size; l_size > 0; l_size >>= 1)
+        {
+            ++l_badAllowed;
+        }
+
+        auto l_pieceStart = [&](Size p_piece)
+        {
+            return p_array.m_Buffer + p_array.m_Size / l_pieceCount * p_piece +
+                (p_piece == l_pieceCount ? p_array.m_Size % l_pieceCount : 0);
+        };
+
+        for(Size i = 0; i < l_pieceCount; ++i)
+        {
+            new (l_tasks + i) Task{
+                l_pieceStart(i), nullptr, l_pieceStart(i + 1),
+                nullptr, &p_isBefore, l_badAllowed
+            };
+        }
+        Asynchronous::RunRoutineForEachTaskOnThreadPool(
+            p_pool, DoParallelSortTask<T, std::remove_reference_t<C>>, l_tasks, l_pieceCount
+        );
+
+        for(Size l_width = 1; l_width < l_pieceCount; l_width *= 2)
+        {
+            Size l_taskCount = 0;
+            for(Size i = 0; i < l_pieceCount; i += l_width * 2)
+            {
+                T* l_begin = l_pieceStart(i);
+                new (l_tasks + l_taskCount) Task{
+                    l_begin, l_pieceStart(i + l_width), l_pieceStart(i + l_width * 2),
+                    l_scratch + (l_begin - p_array.m_Buffer), &p_isBefore, 0
+                };
+                ++l_taskCount;
+            }
+            LogDebugLine("Merging " << l_taskCount << " pairs of pieces.");
+            Asynchronous::RunRoutineForEachTaskOnThreadPool(
+                p_pool, DoParallelSortTask<T, std::remove_reference_t<C>>, l_tasks, l_taskCount
+            );
+        }
+
+        p_deallocate(l_block);
+
+        LogDebugLine("Sorted array: " << p_array);
+
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data, uses the
+     * default thread pool.
+     *
+     */
+    template<typename T, typename C>
+    inline void SortArrayInParallelUsingComparator(Array::Array<T>& p_array, C&& p_isBefore)
+    {
+        LogDebugLine("Using defaults for SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator");
+        SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator(
+            p_array, p_isBefore,
+            Asynchronous::GetDefaultThreadPool(),
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data, uses the
+     * default thread pool and sorts using <.
+     *
+     */
+    template<typename T>
+    inline void SortArrayInParallel(Array::Array<T>& p_array)
+    {
+        LogDebugLine("Using defaults and < for SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator");
+        SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator(
+            p_array,
+            [](const T& p_left, const T& p_right) { return p_left < p_right; },
+            Asynchronous::GetDefaultThreadPool(),
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+}
+
+#endif //PARALLEL_ARRAY__DATA_STRUCTURES_PARALLEL_ARRAY_PARALLEL_ARRAY_HPP
@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -O2 -std=c++17 -o ParallelArrayBenchmarks.bench ../../../Meta/Meta.cpp ../../../Asynchronous/Thread/source/Thread.cpp ../../../Asynchronous/Thread/source/platfrom_specific/POSIXThread.cpp ../../../Asynchronous/ThreadPool/source/platfrom_specific/POSIXThreadPool.cpp -pthread *.cpp
\ No newline at end of file
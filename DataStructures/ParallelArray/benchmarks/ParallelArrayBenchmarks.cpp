@@ -0,0 +1,144 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <numeric>
+
+#include "../ParallelArray.hpp"
+#include "../../../Asynchronous/Thread/include/Thread.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ParallelArray;
+
+TEST_CASE("Sorting 8 million integers on many threads", "[ParallelArray][Benchmark]")
+{
+
+    const Size l_size = 8 * 1024 * 1024;
+
+    Array<int> l_items;
+    Array<int> l_source;
+    CreateArrayAtOfCapacity(l_items, l_size);
+    CreateArrayAtOfCapacity(l_source, l_size);
+
+    srand(5);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_source.m_Buffer[l_source.m_Size++] = rand();
+    }
+
+    auto l_reset = [&]()
+    {
+        memcpy(l_items.m_Buffer, l_source.m_Buffer, sizeof(int) * l_size);
+        l_items.m_Size = l_size;
+    };
+    auto l_isBefore = [](const int& p_left, const int& p_right) { return p_left < p_right; };
+    Asynchronous::ThreadPool* l_pool = Asynchronous::CreateThreadPoolOfThreadCount(3);
+
+    WARN("Processors: " << Asynchronous::GetNumberOfProcessors());
+
+    BENCHMARK_ADVANCED("std::sort")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            std::sort(l_items.m_Buffer, l_items.m_Buffer + l_size);
+            return l_items.m_Buffer[0];
+        });
+    };
+    BENCHMARK_ADVANCED("SortArray")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            SortArray(l_items);
+            return l_items.m_Buffer[0];
+        });
+    };
+    BENCHMARK_ADVANCED("SortArrayInParallel, 4 threads")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator(
+                l_items, l_isBefore, *l_pool, malloc, free, nullptr, nullptr
+            );
+            return l_items.m_Buffer[0];
+        });
+    };
+    BENCHMARK_ADVANCED("SortArrayInParallel, each processor")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            l_reset();
+            SortArrayInParallel(l_items);
+            return l_items.m_Buffer[0];
+        });
+    };
+
+    Asynchronous::DestroyThreadPool(*l_pool);
+    DestroyArrayUsingDeallocator(l_source, free);
+    DestroyArrayUsingDeallocator(l_items, free);
+
+}
+
+TEST_CASE("Algorithms over 16 million doubles on many threads", "[ParallelArray][Benchmark]")
+{
+
+    const Size l_size = 16 * 1024 * 1024;
+
+    Array<double> l_items;
+    Array<double> l_results;
+    CreateArrayAtOfCapacity(l_items, l_size);
+    CreateArrayAtOfCapacity(l_results, l_size);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_items.m_Buffer[l_items.m_Size++] = (double)(i % 1000) / 7;
+    }
+
+    auto l_add = [](const double& p_left, const double& p_right) { return p_left + p_right; };
+    auto l_isBig = [](const double& p_item) { return p_item > 100; };
+
+    WARN("Processors: " << Asynchronous::GetNumberOfProcessors());
+
+    BENCHMARK("std::accumulate")
+    {
+        return std::accumulate(l_items.m_Buffer, l_items.m_Buffer + l_size, 0.0);
+    };
+    BENCHMARK("ReduceArrayInParallel")
+    {
+        return ReduceArrayInParallel(l_items, 0.0, l_add);
+    };
+    BENCHMARK("std::partial_sum")
+    {
+        std::partial_sum(l_items.m_Buffer, l_items.m_Buffer + l_size, l_results.m_Buffer);
+        return l_results.m_Buffer[l_size - 1];
+    };
+    BENCHMARK("ScanArrayIntoArrayInParallel")
+    {
+        ScanArrayIntoArrayInParallel(l_items, l_results, l_add);
+        return l_results.m_Buffer[l_size - 1];
+    };
+    BENCHMARK("std::count_if")
+    {
+        return std::count_if(l_items.m_Buffer, l_items.m_Buffer + l_size, l_isBig);
+    };
+    BENCHMARK("FindNumberOfItemsForWhichFunctionReturnsTrueInArrayInParallel")
+    {
+        return FindNumberOfItemsForWhichFunctionReturnsTrueInArrayInParallel(l_items, l_isBig);
+    };
+    BENCHMARK("TransformArrayIntoArrayInParallel")
+    {
+        TransformArrayIntoArrayInParallel(
+            l_items, l_results, [](const double& p_item) { return p_item * p_item; }
+        );
+        return l_results.m_Buffer[l_size - 1];
+    };
+
+    DestroyArrayUsingDeallocator(l_results, free);
+    DestroyArrayUsingDeallocator(l_items, free);
+
+}
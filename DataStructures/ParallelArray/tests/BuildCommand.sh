@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -g -Og -std=c++17 -DDEBUG -o ParallelArrayTests.test ../../../IO/source/IO.cpp ../../../Meta/Meta.cpp ../../../Debugging/Debugging.cpp ../../../Debugging/Logging/Log.cpp ../../../Asynchronous/Thread/source/Thread.cpp ../../../Asynchronous/Thread/source/platfrom_specific/POSIXThread.cpp ../../../Asynchronous/ThreadPool/source/platfrom_specific/POSIXThreadPool.cpp -pthread *.cpp
\ No newline at end of file
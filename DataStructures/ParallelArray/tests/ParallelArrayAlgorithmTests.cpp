@@ -0,0 +1,181 @@
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../ParallelArray.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ParallelArray;
+using namespace Debugging;
+
+TEST_CASE("Parallel algorithms match doing them on one thread", "[ParallelArray]")
+{
+
+    Size l_threadCount = GENERATE((Size)0, (Size)1, (Size)3);
+    //0 sizes the chunks automatically.
+    Size l_grainSize = GENERATE((Size)0, (Size)1, (Size)7, (Size)1000);
+    Size l_size = GENERATE((Size)0, (Size)1, (Size)999, (Size)70000);
+
+    Asynchronous::ThreadPool* l_pool = Asynchronous::CreateThreadPoolOfThreadCount(l_threadCount);
+    REQUIRE(l_pool != nullptr);
+
+    Array<long> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size);
+    srand(3);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_array.m_Buffer[i] = rand() % 1000 - 500;
+    }
+    l_array.m_Size = l_size;
+
+    SECTION("For each")
+    {
+        ForEachItemOfArrayOnThreadPool(l_array, [](long& p_item) { p_item *= 2; }, *l_pool, l_grainSize);
+        srand(3);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            REQUIRE(l_array.m_Buffer[i] == (rand() % 1000 - 500) * 2);
+        }
+    }
+    SECTION("Transform")
+    {
+        Array<double> l_halves;
+        CreateArrayAtOfCapacity(l_halves, l_size);
+        TransformArrayIntoArrayOnThreadPool(
+            l_array, l_halves, [](const long& p_item) { return p_item / 2.0; },
+            *l_pool, l_grainSize
+        );
+        REQUIRE(l_halves.m_Size == l_size);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            REQUIRE(l_halves.m_Buffer[i] == l_array.m_Buffer[i] / 2.0);
+        }
+        DestroyArrayUsingDeallocator(l_halves, free);
+    }
+    SECTION("Reduce")
+    {
+        long l_expected = 5;
+        for(Size i = 0; i < l_size; ++i)
+        {
+            l_expected += l_array.m_Buffer[i];
+        }
+        bool l_called = false;
+        long l_sum = ReduceArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            l_array, 5L, [](const long& p_left, const long& p_right) { return p_left + p_right; },
+            *l_pool, l_grainSize,
+            malloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(!l_called);
+        CHECK(l_sum == l_expected);
+    }
+    SECTION("Scan")
+    {
+        Array<long> l_expected;
+        CreateCopyAtOfArray(l_expected, l_array);
+        for(Size i = 1; i < l_size; ++i)
+        {
+            l_expected.m_Buffer[i] += l_expected.m_Buffer[i - 1];
+        }
+        auto l_add = [](const long& p_left, const long& p_right) { return p_left + p_right; };
+
+        bool l_called = false;
+        Array<long> l_sums;
+        CreateArrayAtOfCapacity(l_sums, l_size);
+        ScanArrayIntoArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            l_array, l_sums, l_add, *l_pool, l_grainSize,
+            malloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(!l_called);
+        REQUIRE(l_sums == l_expected);
+
+        //In place.
+        ScanArrayIntoArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            l_array, l_array, l_add, *l_pool, l_grainSize,
+            malloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(!l_called);
+        REQUIRE(l_array == l_expected);
+
+        DestroyArrayUsingDeallocator(l_sums, free);
+        DestroyArrayUsingDeallocator(l_expected, free);
+    }
+    SECTION("Count")
+    {
+        Size l_expected = 0;
+        for(Size i = 0; i < l_size; ++i)
+        {
+            l_expected += l_array.m_Buffer[i] > 100;
+        }
+        CHECK(FindNumberOfItemsForWhichFunctionReturnsTrueInArrayOnThreadPool(
+            l_array, [](const long& p_item) { return p_item > 100; }, *l_pool, l_grainSize
+        ) == l_expected);
+    }
+    SECTION("Find first")
+    {
+        Size l_at = GENERATE_COPY((Size)0, l_size / 2, l_size - 1, l_size);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            l_array.m_Buffer[i] = i < l_at ? 0 : 1;
+        }
+        CHECK(FindIndexOfFirstItemForWhichFunctionReturnsTrueInArrayOnThreadPool(
+            l_array, [](const long& p_item) { return p_item == 1; }, *l_pool, l_grainSize
+        ) == (l_at < l_size ? l_at : l_size));
+    }
+
+    Asynchronous::DestroyThreadPool(*l_pool);
+    DestroyArrayUsingDeallocator(l_array, free);
+
+}
+
+TEST_CASE("Parallel algorithm errors", "[ParallelArray]")
+{
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, 100);
+    for(int i = 0; i < 100; ++i)
+    {
+        l_array.m_Buffer[l_array.m_Size++] = i;
+    }
+    auto l_add = [](const int& p_left, const int& p_right) { return p_left + p_right; };
+
+    SECTION("Destination too small")
+    {
+        Array<int> l_small;
+        CreateArrayAtOfCapacity(l_small, 99);
+        TransformArrayIntoArrayInParallel(l_array, l_small, [](const int& p_item) { return p_item; });
+        CHECK(l_small.m_Size == 0);
+        ScanArrayIntoArrayInParallel(l_array, l_small, l_add);
+        CHECK(l_small.m_Size == 0);
+        DestroyArrayUsingDeallocator(l_small, free);
+    }
+    SECTION("Allocation failure")
+    {
+        Asynchronous::ThreadPool& l_pool = Asynchronous::GetDefaultThreadPool();
+
+        bool l_called = false;
+        CHECK(ReduceArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            l_array, 0, l_add, l_pool, 10, NullMalloc, free, GeneralErrorCallback, &l_called
+        ) == 4950);
+        CHECK(l_called);
+
+        l_called = false;
+        ScanArrayIntoArrayOnThreadPoolUsingAllocatorAndDeallocator(
+            l_array, l_array, l_add, l_pool, 10, NullMalloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(l_array.m_Buffer[99] == 4950);
+        CHECK(l_array.m_Buffer[10] == 55);
+    }
+    SECTION("Defaults")
+    {
+        ForEachItemOfArrayInParallel(l_array, [](int& p_item) { ++p_item; });
+        CHECK(ReduceArrayInParallel(l_array, 0, l_add) == 5050);
+        CHECK(FindNumberOfItemsForWhichFunctionReturnsTrueInArrayInParallel(l_array, [](const int& p_item) { return p_item % 2 == 0; }) == 50);
+        CHECK(FindIndexOfFirstItemForWhichFunctionReturnsTrueInArrayInParallel(l_array, [](const int& p_item) { return p_item > 50; }) == 50);
+    }
+
+    DestroyArrayUsingDeallocator(l_array, free);
+
+}
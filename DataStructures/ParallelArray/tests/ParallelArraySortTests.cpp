@@ -0,0 +1,101 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../ParallelArray.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::ParallelArray;
+using namespace Debugging;
+
+TEST_CASE("Parallel sort matches a sort on one thread", "[ParallelArray][Sort]")
+{
+
+    srand(GENERATE(1, 2));
+    Size l_threadCount = GENERATE((Size)1, (Size)2, (Size)3, (Size)8);
+    //Too small for 2 pieces, exactly 4 pieces and uneven pieces.
+    Size l_size = g_PARALLEL_ARRAY_SORT_MINIMUM_ITEMS_PER_THREAD * GENERATE((Size)1, (Size)4, (Size)9) + GENERATE((Size)0, (Size)7);
+    bool l_fewDistinct = GENERATE(false, true);
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_array.m_Buffer[i] = l_fewDistinct ? rand() % 3 : rand();
+    }
+    l_array.m_Size = l_size;
+
+    Array<int> l_expected;
+    CreateCopyAtOfArray(l_expected, l_array);
+    SortArray(l_expected);
+
+    auto l_isBefore = [](const int& p_left, const int& p_right) { return p_left < p_right; };
+    Asynchronous::ThreadPool* l_pool = Asynchronous::CreateThreadPoolOfThreadCount(l_threadCount - 1);
+    REQUIRE(l_pool != nullptr);
+
+    SECTION("Sorting")
+    {
+        bool l_called = false;
+        SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator(
+            l_array, l_isBefore, *l_pool, malloc, free, GeneralErrorCallback, &l_called
+        );
+        CHECK(!l_called);
+    }
+    SECTION("Allocation failure")
+    {
+        bool l_called = false;
+        SortArrayOnThreadPoolUsingComparatorAndAllocatorAndDeallocator(
+            l_array, l_isBefore, *l_pool, NullMalloc, free, GeneralErrorCallback, &l_called
+        );
+        //Nothing is allocated when it is sorted on this thread anyway.
+        CHECK(l_called == (l_threadCount > 1 && l_size >= g_PARALLEL_ARRAY_SORT_MINIMUM_ITEMS_PER_THREAD * 2));
+    }
+
+    REQUIRE(l_array.m_Size == l_size);
+    REQUIRE(l_array == l_expected);
+
+    Asynchronous::DestroyThreadPool(*l_pool);
+    DestroyArrayUsingDeallocator(l_expected, free);
+    DestroyArrayUsingDeallocator(l_array, free);
+
+}
+
+TEST_CASE("Parallel sort with the defaults", "[ParallelArray][Sort]")
+{
+
+    const Size l_size = g_PARALLEL_ARRAY_SORT_MINIMUM_ITEMS_PER_THREAD * 8;
+
+    Array<double> l_array;
+    CreateArrayAtOfCapacity(l_array, l_size);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_array.m_Buffer[i] = (double)(l_size - i) / 3;
+    }
+    l_array.m_Size = l_size;
+
+    SECTION("Using <")
+    {
+        SortArrayInParallel(l_array);
+        for(Size i = 1; i < l_size; ++i)
+        {
+            REQUIRE(l_array.m_Buffer[i - 1] <= l_array.m_Buffer[i]);
+        }
+    }
+    SECTION("Using a comparator")
+    {
+        SortArrayInParallelUsingComparator(
+            l_array,
+            [](const double& p_left, const double& p_right) { return p_right < p_left; }
+        );
+        for(Size i = 1; i < l_size; ++i)
+        {
+            REQUIRE(l_array.m_Buffer[i - 1] >= l_array.m_Buffer[i]);
+        }
+    }
+
+    DestroyArrayUsingDeallocator(l_array, free);
+
+}
@@ -0,0 +1,1164 @@
+/** @file PatternMatcher.hpp
+ * @brief Defines everything in the @ref PatternMatcherMod module.
+ *
+ * @details Functions for searching in ASCIIStrings are only defined if the
+ * ASCIIString.hpp header guard is detected, so include it before this file to
+ * use them.
+ *
+ */
+
+#ifndef PATTERN_MATCHER__DATA_STRUCTURES_PATTERN_MATCHER_PATTERN_MATCHER_HPP
+#define PATTERN_MATCHER__DATA_STRUCTURES_PATTERN_MATCHER_PATTERN_MATCHER_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+namespace Library::DataStructures::PatternMatcher
+{
+
+    /**
+     * @brief The biggest a dense transition table can be, in bytes, for
+     * @ref PatternMatcherLayout::Automatic to choose it.
+     *
+     * @details Half of a common L2 cache, so that the table stays cached
+     * while the haystack streams through.
+     *
+     */
+    constexpr Size g_PATTERN_MATCHER_DENSE_TABLE_LIMIT = 512 * 1024;
+
+    /**
+     * @brief How the transitions of a @ref PatternMatcher are stored.
+     *
+     * @details Items are first mapped to classes, each item that is in a
+     * pattern gets its own class and every other item shares class 0. The
+     * number of classes is the alphabet the automaton works on.
+     *
+     * - Dense: every state has a transition for every class, already
+     * following failures. Searching is one table lookup per item, but the
+     * table is number of states * number of classes big.
+     * - Banded: every state only stores the transitions to its children, for
+     * the classes from its smallest to its biggest child class. Items outside
+     * of the band or without a child follow the state's failure. The table is
+     * about as big as the patterns, at the cost of following failures while
+     * searching.
+     * - Automatic: Dense if the table is at most
+     * @ref g_PATTERN_MATCHER_DENSE_TABLE_LIMIT bytes, Banded otherwise.
+     *
+     */
+    enum class PatternMatcherLayout : Byte
+    {
+        Automatic,
+        Dense,
+        Banded
+    };
+
+    /**
+     * @brief A single match found by a @ref PatternMatcher.
+     *
+     */
+    struct PatternMatch
+    {
+        /**
+         * @brief The index of the pattern that matched, in the array of
+         * patterns the matcher was created from.
+         *
+         */
+        Size m_Pattern;
+        /**
+         * @brief The index in the haystack of the first item of the match.
+         *
+         */
+        Size m_Index;
+    };
+
+    /**
+     * @brief A compiled set of patterns that are all searched for in one pass
+     * over a haystack (Aho-Corasick).
+     *
+     * @details Created by @ref CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator
+     * and used by @ref ForEachMatchOfPatternMatcherInArray and the functions
+     * built on it. Every match of every pattern is found, including ones
+     * that overlap, in O(n + z) time, n being the size of the haystack and z
+     * the number of matches.
+     *
+     * States are numbered in breadth first order, so the states near the
+     * root, which are used the most, are next to each other in memory. All of
+     * the tables are in one allocation, m_Block.
+     *
+     * Items of 1 byte types (see @ref Library::DataStructures::Array::g_ARRAY_ITEMS_ARE_BYTES)
+     * are mapped to classes using a 256 entry table. Other items are looked up
+     * in m_Alphabet one by one, so their alphabet should be small.
+     *
+     * @tparam T The type of the items. Must meet the same requirements as for
+     * @ref Library::DataStructures::Array::Array.
+     *
+     */
+    template<typename T>
+    struct PatternMatcher
+    {
+        /**
+         * @brief The transitions, m_StateCount * m_ClassCount of them for a
+         * dense matcher, the bands of every state one after another for a
+         * banded one. 0 means no child for a banded matcher.
+         *
+         */
+        uint32_t* m_Transitions;
+        /**
+         * @brief For each state of a banded matcher, the class of the first
+         * transition in its band.
+         *
+         */
+        uint32_t* m_BandStarts;
+        /**
+         * @brief For each state of a banded matcher, the number of transitions
+         * in its band.
+         *
+         */
+        uint32_t* m_BandSizes;
+        /**
+         * @brief For each state of a banded matcher, the index of its band in
+         * m_Transitions.
+         *
+         */
+        uint32_t* m_BandOffsets;
+        /**
+         * @brief For each state of a banded matcher, the state of the longest
+         * proper suffix of it that is also a prefix of a pattern.
+         *
+         */
+        uint32_t* m_Failures;
+        /**
+         * @brief For each state, itself if a pattern ends at it, otherwise the
+         * first state on its failure chain that a pattern ends at. 0 if there
+         * is no such state.
+         *
+         */
+        uint32_t* m_FirstMatchStates;
+        /**
+         * @brief For each state, the first match state of its failure.
+         *
+         */
+        uint32_t* m_NextMatchStates;
+        /**
+         * @brief The patterns that end at state s are m_Patterns[i] for i from
+         * m_PatternStarts[s] to m_PatternStarts[s + 1], m_StateCount + 1 items.
+         *
+         */
+        uint32_t* m_PatternStarts;
+        /**
+         * @brief The indexes of patterns, grouped by the state they end at.
+         *
+         */
+        uint32_t* m_Patterns;
+        /**
+         * @brief The size of each pattern.
+         *
+         */
+        Size* m_PatternSizes;
+        /**
+         * @brief The items of classes 1 to m_ClassCount - 1, only used when T
+         * is not a byte.
+         *
+         */
+        T* m_Alphabet;
+        /**
+         * @brief The class of each byte, only used when T is a byte.
+         *
+         */
+        uint16_t m_ClassOfByte[256];
+        /**
+         * @brief The number of patterns the matcher was created from,
+         * including empty ones that never match.
+         *
+         */
+        Size m_PatternCount;
+        /**
+         * @brief The number of states, the root being state 0.
+         *
+         */
+        Size m_StateCount;
+        /**
+         * @brief The number of item classes, class 0 is for items that are not
+         * in any pattern.
+         *
+         */
+        Size m_ClassCount;
+        /**
+         * @brief Either Dense or Banded, never Automatic.
+         *
+         */
+        PatternMatcherLayout m_Layout;
+        /**
+         * @brief The allocation all of the tables are in.
+         *
+         */
+        void* m_Block;
+
+        /**
+         * @brief Creates a null matcher, it has no patterns and matches
+         * nothing.
+         *
+         */
+        PatternMatcher():
+        m_Transitions(nullptr),
+        m_BandStarts(nullptr),
+        m_BandSizes(nullptr),
+        m_BandOffsets(nullptr),
+        m_Failures(nullptr),
+        m_FirstMatchStates(nullptr),
+        m_NextMatchStates(nullptr),
+        m_PatternStarts(nullptr),
+        m_Patterns(nullptr),
+        m_PatternSizes(nullptr),
+        m_Alphabet(nullptr),
+        m_ClassOfByte(),
+        m_PatternCount(0),
+        m_StateCount(0),
+        m_ClassCount(0),
+        m_Layout(PatternMatcherLayout::Dense),
+        m_Block(nullptr)
+        {
+            LogDebugLine("Constructing a null pattern matcher at " << this);
+        }
+
+        PatternMatcher(const PatternMatcher<T>&) = delete;
+        PatternMatcher<T>& operator= (const PatternMatcher<T>&) = delete;
+    };
+
+    /**
+     * @brief Returns the class of p_item in p_matcher.
+     *
+     * @time O(1) for bytes, O(k) otherwise, k being the number of distinct
+     * items in the patterns.
+     *
+     */
+    template<typename T>
+    inline uint32_t FindClassOfItemInPatternMatcher(const PatternMatcher<T>& p_matcher, const T& p_item)
+    {
+        if constexpr(Array::g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            return p_matcher.m_ClassOfByte[(Byte)p_item];
+        }
+        else
+        {
+            for(Size i = 1; i < p_matcher.m_ClassCount; ++i)
+            {
+                if(p_matcher.m_Alphabet[i - 1] == p_item)
+                {
+                    return (uint32_t)i;
+                }
+            }
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Returns the state p_matcher goes to from p_state on an item of
+     * class p_class.
+     *
+     */
+    template<typename T>
+    inline uint32_t FindNextStateOfPatternMatcher(
+        const PatternMatcher<T>& p_matcher,
+        uint32_t p_state,
+        const uint32_t& p_class
+    )
+    {
+
+        if(p_matcher.m_Layout == PatternMatcherLayout::Dense)
+        {
+            return p_matcher.m_Transitions[p_state * p_matcher.m_ClassCount + p_class];
+        }
+
+        for(;;)
+        {
+            //Classes before the band wrap around to big numbers.
+            uint32_t l_offset = p_class - p_matcher.m_BandStarts[p_state];
+            if(l_offset < p_matcher.m_BandSizes[p_state])
+            {
+                uint32_t l_next = p_matcher.m_Transitions[p_matcher.m_BandOffsets[p_state] + l_offset];
+                if(l_next != 0)
+                {
+                    return l_next;
+                }
+            }
+            //The root's band has every class, a missing child means staying.
+            if(p_state == 0)
+            {
+                return 0;
+            }
+            p_state = p_matcher.m_Failures[p_state];
+        }
+
+    }
+
+    /**
+     * @brief Creates a @ref PatternMatcher at outp_matcher that searches for
+     * all of p_patterns.
+     *
+     * @details The patterns are put into a trie, the failure of every state is
+     * found by a breadth first walk over it and the states are then renumbered
+     * in that order and laid out as p_layout says. The items of the patterns
+     * are copied, p_patterns does not have to outlive the matcher.
+     *
+     * Empty patterns are kept so that pattern indexes stay the same, but they
+     * never match. The same pattern given more than once matches once for
+     * each time it was given.
+     *
+     * Temporary tables of about 7 * 4 bytes per item of the patterns are
+     * allocated using p_allocate and deallocated using p_deallocate, the
+     * matcher itself is one allocation made using p_allocate.
+     *
+     * If any allocation fails, p_alloc_error is called and a null matcher
+     * is created at outp_matcher. If the patterns have 2^32 - 1 or more items
+     * in total, or any size calculation overflows, a null matcher is created
+     * at outp_matcher and the function returns.
+     *
+     * @param outp_matcher Where the matcher will be created, it is
+     * overwritten without being destroyed.
+     * @param p_patterns The patterns to search for.
+     * @param p_layout How the transitions are stored.
+     * @param p_allocate The allocator used for the matcher and the temporary
+     * tables.
+     * @param p_deallocate The deallocator used for the temporary tables.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * @time O(m * k), m being the number of items in all of the patterns and k
+     * the number of distinct items in them.
+     *
+     */
+    template<typename T>
+    void CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+        PatternMatcher<T>& outp_matcher,
+        const Array::Array<Array::Array<T>>& p_patterns,
+        const PatternMatcherLayout& p_layout,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating pattern matcher at " << &outp_matcher << " of "
+        "patterns " << p_patterns);
+
+        outp_matcher.m_Transitions = nullptr;
+        outp_matcher.m_BandStarts = nullptr;
+        outp_matcher.m_BandSizes = nullptr;
+        outp_matcher.m_BandOffsets = nullptr;
+        outp_matcher.m_Failures = nullptr;
+        outp_matcher.m_FirstMatchStates = nullptr;
+        outp_matcher.m_NextMatchStates = nullptr;
+        outp_matcher.m_PatternStarts = nullptr;
+        outp_matcher.m_Patterns = nullptr;
+        outp_matcher.m_PatternSizes = nullptr;
+        outp_matcher.m_Alphabet = nullptr;
+        outp_matcher.m_PatternCount = 0;
+        outp_matcher.m_StateCount = 0;
+        outp_matcher.m_ClassCount = 0;
+        outp_matcher.m_Layout = PatternMatcherLayout::Dense;
+        outp_matcher.m_Block = nullptr;
+        for(Size i = 0; i < 256; ++i)
+        {
+            outp_matcher.m_ClassOfByte[i] = 0;
+        }
+
+        const Size l_patternCount = p_patterns.m_Buffer == nullptr ? 0 : p_patterns.m_Size;
+        if(l_patternCount >= UINT32_MAX)
+        {
+            LogDebugLine("Too many patterns, returning a null matcher.");
+            return;
+        }
+
+        Size l_itemCount = 0;
+        for(Size i = 0; i < l_patternCount; ++i)
+        {
+            if(p_patterns.m_Buffer[i].m_Buffer == nullptr)
+            {
+                continue;
+            }
+            l_itemCount += p_patterns.m_Buffer[i].m_Size;
+            if(l_itemCount >= UINT32_MAX - 1)
+            {
+                LogDebugLine("The patterns have too many items, returning a null matcher.");
+                return;
+            }
+        }
+
+        //The trie can have at most one node per item, plus the root.
+        const Size l_maxNodeCount = l_itemCount + 1;
+
+        //Temporary tables, all of them are l_maxNodeCount items long:
+        //the first child, the next sibling, the class and failure of each
+        //node, the breadth first order and the node each new state number
+        //belongs to. Followed by the end node of each pattern and, for items
+        //that are not bytes, room for the alphabet.
+        const Size l_nodeTableCount = 6;
+        Size l_temporarySize = sizeof(uint32_t) * (l_nodeTableCount * l_maxNodeCount + l_patternCount);
+        Size l_alphabetOffset = (l_temporarySize + alignof(T) - 1) / alignof(T) * alignof(T);
+        if constexpr(!Array::g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            if(l_itemCount > (SIZE_MAX - l_alphabetOffset) / sizeof(T))
+            {
+                LogDebugLine("The size of the temporary tables overflows.");
+                return;
+            }
+            l_temporarySize = l_alphabetOffset + sizeof(T) * l_itemCount;
+        }
+
+        Byte* l_temporary = (Byte*)p_allocate(l_temporarySize);
+        if(l_temporary == nullptr)
+        {
+            LogDebugLine("Allocation of the temporary tables failed.");
+            if(p_alloc_error != nullptr)
+            {
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        uint32_t* l_firstChildren = (uint32_t*)l_temporary;
+        uint32_t* l_nextSiblings = l_firstChildren + l_maxNodeCount;
+        uint32_t* l_nodeClasses = l_nextSiblings + l_maxNodeCount;
+        uint32_t* l_failures = l_nodeClasses + l_maxNodeCount;
+        uint32_t* l_order = l_failures + l_maxNodeCount;
+        uint32_t* l_stateOfNode = l_order + l_maxNodeCount;
+        uint32_t* l_patternEnds = l_stateOfNode + l_maxNodeCount;
+        T* l_alphabet = (T*)(l_temporary + l_alphabetOffset);
+
+        //Gives every item that is in a pattern a class, class 0 is for
+        //everything else.
+        Size l_classCount = 1;
+        uint16_t l_classOfByte[256] = {};
+        if constexpr(Array::g_ARRAY_ITEMS_ARE_BYTES<T>)
+        {
+            for(Size i = 0; i < l_patternCount; ++i)
+            {
+                const Array::Array<T>& l_pattern = p_patterns.m_Buffer[i];
+                for(Size n = 0; l_pattern.m_Buffer != nullptr && n < l_pattern.m_Size; ++n)
+                {
+                    l_classOfByte[(Byte)l_pattern.m_Buffer[n]] = 1;
+                }
+            }
+            for(Size i = 0; i < 256; ++i)
+            {
+                if(l_classOfByte[i] != 0)
+                {
+                    l_classOfByte[i] = (uint16_t)l_classCount++;
+                }
+            }
+        }
+        else
+        {
+            for(Size i = 0; i < l_patternCount; ++i)
+            {
+                const Array::Array<T>& l_pattern = p_patterns.m_Buffer[i];
+                for(Size n = 0; l_pattern.m_Buffer != nullptr && n < l_pattern.m_Size; ++n)
+                {
+                    Size l_class = 1;
+                    while(l_class < l_classCount && !(l_alphabet[l_class - 1] == l_pattern.m_Buffer[n]))
+                    {
+                        ++l_class;
+                    }
+                    if(l_class == l_classCount)
+                    {
+                        l_alphabet[l_classCount - 1] = l_pattern.m_Buffer[n];
+                        ++l_classCount;
+                    }
+                }
+            }
+        }
+
+        //Puts the patterns into a trie, children are kept in sibling lists.
+        Size l_nodeCount = 1;
+        l_firstChildren[0] = 0;
+        l_nextSiblings[0] = 0;
+        l_nodeClasses[0] = 0;
+
+        for(Size i = 0; i < l_patternCount; ++i)
+        {
+            const Array::Array<T>& l_pattern = p_patterns.m_Buffer[i];
+            uint32_t l_node = 0;
+
+            for(Size n = 0; l_pattern.m_Buffer != nullptr && n < l_pattern.m_Size; ++n)
+            {
+                uint32_t l_class;
+                if constexpr(Array::g_ARRAY_ITEMS_ARE_BYTES<T>)
+                {
+                    l_class = l_classOfByte[(Byte)l_pattern.m_Buffer[n]];
+                }
+                else
+                {
+                    l_class = 1;
+                    while(!(l_alphabet[l_class - 1] == l_pattern.m_Buffer[n]))
+                    {
+                        ++l_class;
+                    }
+                }
+
+                uint32_t l_child = l_firstChildren[l_node];
+                while(l_child != 0 && l_nodeClasses[l_child] != l_class)
+                {
+                    l_child = l_nextSiblings[l_child];
+                }
+                if(l_child == 0)
+                {
+                    l_child = (uint32_t)l_nodeCount++;
+                    l_firstChildren[l_child] = 0;
+                    l_nodeClasses[l_child] = l_class;
+                    l_nextSiblings[l_child] = l_firstChildren[l_node];
+                    l_firstChildren[l_node] = l_child;
+                }
+                l_node = l_child;
+            }
+
+            //Empty patterns end at the root, which is never reported.
+            l_patternEnds[i] = l_node;
+        }
+
+        //Walks the trie breadth first, finding the failure of each node. The
+        //failure of a node is always shallower, so it is already known.
+        l_order[0] = 0;
+        l_failures[0] = 0;
+        for(Size l_read = 0, l_write = 1; l_read < l_write; ++l_read)
+        {
+            uint32_t l_node = l_order[l_read];
+            l_stateOfNode[l_node] = (uint32_t)l_read;
+
+            for(uint32_t l_child = l_firstChildren[l_node]; l_child != 0; l_child = l_nextSiblings[l_child])
+            {
+                l_order[l_write++] = l_child;
+
+                uint32_t l_failure = 0;
+                if(l_node != 0)
+                {
+                    for(uint32_t l_candidate = l_failures[l_node];; l_candidate = l_failures[l_candidate])
+                    {
+                        uint32_t l_next = l_firstChildren[l_candidate];
+                        while(l_next != 0 && l_nodeClasses[l_next] != l_nodeClasses[l_child])
+                        {
+                            l_next = l_nextSiblings[l_next];
+                        }
+                        if(l_next != 0)
+                        {
+                            l_failure = l_next;
+                            break;
+                        }
+                        if(l_candidate == 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+                l_failures[l_child] = l_failure;
+            }
+        }
+
+        const Size l_stateCount = l_nodeCount;
+
+        //Chooses the layout and finds the size of the transitions.
+        PatternMatcherLayout l_layout = p_layout;
+        bool l_denseFits = l_stateCount <= SIZE_MAX / sizeof(uint32_t) / l_classCount;
+        if(l_layout == PatternMatcherLayout::Automatic)
+        {
+            l_layout = l_denseFits &&
+                sizeof(uint32_t) * l_stateCount * l_classCount <= g_PATTERN_MATCHER_DENSE_TABLE_LIMIT ?
+                PatternMatcherLayout::Dense : PatternMatcherLayout::Banded;
+        }
+        if(l_layout == PatternMatcherLayout::Dense && !l_denseFits)
+        {
+            LogDebugLine("The dense table overflows, returning a null matcher.");
+            p_deallocate(l_temporary);
+            return;
+        }
+
+        Size l_transitionCount = 0;
+        if(l_layout == PatternMatcherLayout::Dense)
+        {
+            l_transitionCount = l_stateCount * l_classCount;
+        }
+        else
+        {
+            //The root's band has every class.
+            l_transitionCount = l_classCount;
+            for(Size i = 1; i < l_stateCount; ++i)
+            {
+                uint32_t l_smallest = UINT32_MAX;
+                uint32_t l_biggest = 0;
+                for(uint32_t l_child = l_firstChildren[i]; l_child != 0; l_child = l_nextSiblings[l_child])
+                {
+                    l_smallest = l_nodeClasses[l_child] < l_smallest ? l_nodeClasses[l_child] : l_smallest;
+                    l_biggest = l_nodeClasses[l_child] > l_biggest ? l_nodeClasses[l_child] : l_biggest;
+                }
+                if(l_smallest != UINT32_MAX)
+                {
+                    l_transitionCount += l_biggest - l_smallest + 1;
+                }
+            }
+        }
+
+        //Lays out the block, Size and T items first so everything after them
+        //stays aligned.
+        const Size l_perStateCount = l_layout == PatternMatcherLayout::Dense ? 2 : 6;
+        Size l_alphabetSize = Array::g_ARRAY_ITEMS_ARE_BYTES<T> ? 0 : l_classCount - 1;
+        Size l_blockAlphabetOffset = sizeof(Size) * l_patternCount;
+        l_blockAlphabetOffset = (l_blockAlphabetOffset + alignof(T) - 1) / alignof(T) * alignof(T);
+        Size l_tablesOffset = l_blockAlphabetOffset + sizeof(T) * l_alphabetSize;
+        l_tablesOffset = (l_tablesOffset + alignof(uint32_t) - 1) / alignof(uint32_t) * alignof(uint32_t);
+
+        //l_transitionCount is at most l_stateCount * 256 for bytes, the rest
+        //is bounded by the patterns, so only the transitions can overflow.
+        if(l_transitionCount > SIZE_MAX / sizeof(uint32_t) - (l_perStateCount + 1) * l_stateCount - l_patternCount - l_tablesOffset)
+        {
+            LogDebugLine("The size of the matcher overflows, returning a null matcher.");
+            p_deallocate(l_temporary);
+            return;
+        }
+        Size l_blockSize = l_tablesOffset + sizeof(uint32_t) *
+            (l_transitionCount + l_perStateCount * l_stateCount + (l_stateCount + 1) + l_patternCount);
+
+        Byte* l_block = (Byte*)p_allocate(l_blockSize);
+        if(l_block == nullptr)
+        {
+            LogDebugLine("Allocation of the matcher failed.");
+            p_deallocate(l_temporary);
+            if(p_alloc_error != nullptr)
+            {
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        PatternMatcher<T>& l_matcher = outp_matcher;
+        l_matcher.m_Block = l_block;
+        l_matcher.m_PatternCount = l_patternCount;
+        l_matcher.m_StateCount = l_stateCount;
+        l_matcher.m_ClassCount = l_classCount;
+        l_matcher.m_Layout = l_layout;
+
+        l_matcher.m_PatternSizes = (Size*)l_block;
+        l_matcher.m_Alphabet = l_alphabetSize == 0 ? nullptr : (T*)(l_block + l_blockAlphabetOffset);
+        uint32_t* l_tables = (uint32_t*)(l_block + l_tablesOffset);
+        l_matcher.m_FirstMatchStates = l_tables;
+        l_matcher.m_NextMatchStates = l_tables + l_stateCount;
+        l_tables += 2 * l_stateCount;
+        if(l_layout == PatternMatcherLayout::Banded)
+        {
+            l_matcher.m_BandStarts = l_tables;
+            l_matcher.m_BandSizes = l_tables + l_stateCount;
+            l_matcher.m_BandOffsets = l_tables + 2 * l_stateCount;
+            l_matcher.m_Failures = l_tables + 3 * l_stateCount;
+            l_tables += 4 * l_stateCount;
+        }
+        l_matcher.m_PatternStarts = l_tables;
+        l_matcher.m_Patterns = l_tables + l_stateCount + 1;
+        l_matcher.m_Transitions = l_tables + l_stateCount + 1 + l_patternCount;
+
+        for(Size i = 0; i < 256; ++i)
+        {
+            l_matcher.m_ClassOfByte[i] = l_classOfByte[i];
+        }
+        for(Size i = 0; i < l_alphabetSize; ++i)
+        {
+            l_matcher.m_Alphabet[i] = l_alphabet[i];
+        }
+
+        //Groups the patterns by the state they end at, counting first.
+        for(Size i = 0; i <= l_stateCount; ++i)
+        {
+            l_matcher.m_PatternStarts[i] = 0;
+        }
+        for(Size i = 0; i < l_patternCount; ++i)
+        {
+            const Array::Array<T>& l_pattern = p_patterns.m_Buffer[i];
+            l_matcher.m_PatternSizes[i] = l_pattern.m_Buffer == nullptr ? 0 : l_pattern.m_Size;
+            if(l_patternEnds[i] != 0)
+            {
+                ++l_matcher.m_PatternStarts[l_stateOfNode[l_patternEnds[i]] + 1];
+            }
+        }
+        for(Size i = 0; i < l_stateCount; ++i)
+        {
+            l_matcher.m_PatternStarts[i + 1] += l_matcher.m_PatternStarts[i];
+        }
+        //The start of each state is used as its write position, which moves
+        //it to the start of the next state, so the starts are shifted back
+        //afterwards.
+        for(Size i = 0; i < l_patternCount; ++i)
+        {
+            if(l_patternEnds[i] != 0)
+            {
+                l_matcher.m_Patterns[l_matcher.m_PatternStarts[l_stateOfNode[l_patternEnds[i]]]++] = (uint32_t)i;
+            }
+        }
+        for(Size i = l_stateCount; i > 0; --i)
+        {
+            l_matcher.m_PatternStarts[i] = l_matcher.m_PatternStarts[i - 1];
+        }
+        l_matcher.m_PatternStarts[0] = 0;
+
+        //Fills the tables in breadth first order, so failures are done
+        //before the states that use them.
+        Size l_bandOffset = 0;
+        for(Size l_state = 0; l_state < l_stateCount; ++l_state)
+        {
+            uint32_t l_node = l_order[l_state];
+            uint32_t l_failure = l_stateOfNode[l_failures[l_node]];
+
+            if(l_state == 0)
+            {
+                l_matcher.m_FirstMatchStates[0] = 0;
+                l_matcher.m_NextMatchStates[0] = 0;
+            }
+            else
+            {
+                bool l_hasPatterns = l_matcher.m_PatternStarts[l_state] != l_matcher.m_PatternStarts[l_state + 1];
+                l_matcher.m_NextMatchStates[l_state] = l_matcher.m_FirstMatchStates[l_failure];
+                l_matcher.m_FirstMatchStates[l_state] = l_hasPatterns ?
+                    (uint32_t)l_state : l_matcher.m_FirstMatchStates[l_failure];
+            }
+
+            if(l_layout == PatternMatcherLayout::Dense)
+            {
+                uint32_t* l_row = l_matcher.m_Transitions + l_state * l_classCount;
+                const uint32_t* l_failureRow = l_matcher.m_Transitions + l_failure * l_classCount;
+                for(Size i = 0; i < l_classCount; ++i)
+                {
+                    l_row[i] = l_state == 0 ? 0 : l_failureRow[i];
+                }
+                for(uint32_t l_child = l_firstChildren[l_node]; l_child != 0; l_child = l_nextSiblings[l_child])
+                {
+                    l_row[l_nodeClasses[l_child]] = l_stateOfNode[l_child];
+                }
+            }
+            else
+            {
+                uint32_t l_smallest = l_state == 0 ? 0 : UINT32_MAX;
+                uint32_t l_biggest = l_state == 0 ? (uint32_t)l_classCount - 1 : 0;
+                for(uint32_t l_child = l_firstChildren[l_node]; l_child != 0; l_child = l_nextSiblings[l_child])
+                {
+                    l_smallest = l_nodeClasses[l_child] < l_smallest ? l_nodeClasses[l_child] : l_smallest;
+                    l_biggest = l_nodeClasses[l_child] > l_biggest ? l_nodeClasses[l_child] : l_biggest;
+                }
+
+                l_matcher.m_Failures[l_state] = l_failure;
+                l_matcher.m_BandOffsets[l_state] = (uint32_t)l_bandOffset;
+                if(l_smallest == UINT32_MAX)
+                {
+                    l_matcher.m_BandStarts[l_state] = 0;
+                    l_matcher.m_BandSizes[l_state] = 0;
+                    continue;
+                }
+
+                l_matcher.m_BandStarts[l_state] = l_smallest;
+                l_matcher.m_BandSizes[l_state] = l_biggest - l_smallest + 1;
+                uint32_t* l_band = l_matcher.m_Transitions + l_bandOffset;
+                for(Size i = 0; i < l_matcher.m_BandSizes[l_state]; ++i)
+                {
+                    l_band[i] = 0;
+                }
+                for(uint32_t l_child = l_firstChildren[l_node]; l_child != 0; l_child = l_nextSiblings[l_child])
+                {
+                    l_band[l_nodeClasses[l_child] - l_smallest] = l_stateOfNode[l_child];
+                }
+                l_bandOffset += l_matcher.m_BandSizes[l_state];
+            }
+        }
+
+        p_deallocate(l_temporary);
+
+        LogDebugLine("Created pattern matcher with " << l_stateCount << " states, "
+        << l_classCount << " classes and " << l_transitionCount << " transitions, "
+        "it is " << l_blockSize << " bytes big.");
+
+    }
+    template<typename T>
+    inline void CreatePatternMatcherAtOfPatterns(
+        PatternMatcher<T>& outp_matcher,
+        const Array::Array<Array::Array<T>>& p_patterns
+    )
+    {
+        LogDebugLine("Using defaults for CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator");
+        CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+            outp_matcher, p_patterns,
+            PatternMatcherLayout::Automatic,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Deallocates the tables of p_matcher using p_deallocate, leaving a
+     * null matcher.
+     *
+     */
+    template<typename T>
+    void DestroyPatternMatcherUsingDeallocator(PatternMatcher<T>& p_matcher, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying pattern matcher at " << &p_matcher);
+
+        if(p_matcher.m_Block != nullptr)
+        {
+            p_deallocate(p_matcher.m_Block);
+        }
+
+        p_matcher.m_Transitions = nullptr;
+        p_matcher.m_BandStarts = nullptr;
+        p_matcher.m_BandSizes = nullptr;
+        p_matcher.m_BandOffsets = nullptr;
+        p_matcher.m_Failures = nullptr;
+        p_matcher.m_FirstMatchStates = nullptr;
+        p_matcher.m_NextMatchStates = nullptr;
+        p_matcher.m_PatternStarts = nullptr;
+        p_matcher.m_Patterns = nullptr;
+        p_matcher.m_PatternSizes = nullptr;
+        p_matcher.m_Alphabet = nullptr;
+        p_matcher.m_PatternCount = 0;
+        p_matcher.m_StateCount = 0;
+        p_matcher.m_ClassCount = 0;
+        p_matcher.m_Block = nullptr;
+
+    }
+    template<typename T>
+    inline void DestroyPatternMatcher(PatternMatcher<T>& p_matcher)
+    {
+        LogDebugLine("Using defaults for DestroyPatternMatcherUsingDeallocator");
+        DestroyPatternMatcherUsingDeallocator(p_matcher, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+    /**
+     * @brief Calls p_function(pattern, index) for every match of every pattern
+     * of p_matcher in p_array, pattern being the index of the pattern and
+     * index the index of its first item in p_array.
+     *
+     * @details p_array is gone through once. Matches are reported in the
+     * order they end in, matches that end at the same item are reported
+     * from the longest pattern to the shortest.
+     *
+     * If p_matcher is null or p_array is empty p_function is never called.
+     *
+     * @tparam F Anything that can be called with two Size arguments, like a
+     * lambda.
+     *
+     * @time O(n + z) for bytes, n being p_array.m_Size and z the number of
+     * matches. See @ref PatternMatcher for other items.
+     *
+     */
+    template<typename T, typename F>
+    void ForEachMatchOfPatternMatcherInArray(
+        const PatternMatcher<T>& p_matcher,
+        const Array::Array<T>& p_array,
+        F&& p_function
+    )
+    {
+
+        LogDebugLine("Finding matches of pattern matcher " << &p_matcher <<
+        " in array " << p_array);
+
+        if(p_matcher.m_Block == nullptr || Array::ArrayIsEmpty(p_array))
+        {
+            LogDebugLine("The matcher is null or the array is empty, returning.");
+            return;
+        }
+
+        const T* l_items = p_array.m_Buffer;
+        const Size l_size = p_array.m_Size;
+        const uint32_t* l_firstMatchStates = p_matcher.m_FirstMatchStates;
+        uint32_t l_state = 0;
+
+        //Reports the matches that end at index p_end.
+        auto l_report = [&](const Size& p_end)
+        {
+            for(
+                uint32_t l_matchState = l_firstMatchStates[l_state];
+                l_matchState != 0;
+                l_matchState = p_matcher.m_NextMatchStates[l_matchState]
+            )
+            {
+                for(
+                    uint32_t i = p_matcher.m_PatternStarts[l_matchState];
+                    i < p_matcher.m_PatternStarts[l_matchState + 1];
+                    ++i
+                )
+                {
+                    Size l_pattern = p_matcher.m_Patterns[i];
+                    p_function(l_pattern, p_end + 1 - p_matcher.m_PatternSizes[l_pattern]);
+                }
+            }
+        };
+
+        //The dense loop is kept apart so that it is only a lookup per item.
+        if(p_matcher.m_Layout == PatternMatcherLayout::Dense)
+        {
+            const uint32_t* l_transitions = p_matcher.m_Transitions;
+            const Size l_classCount = p_matcher.m_ClassCount;
+            for(Size i = 0; i < l_size; ++i)
+            {
+                l_state = l_transitions[l_state * l_classCount + FindClassOfItemInPatternMatcher(p_matcher, l_items[i])];
+                if(l_firstMatchStates[l_state] != 0)
+                {
+                    l_report(i);
+                }
+            }
+        }
+        else
+        {
+            for(Size i = 0; i < l_size; ++i)
+            {
+                l_state = FindNextStateOfPatternMatcher(
+                    p_matcher, l_state, FindClassOfItemInPatternMatcher(p_matcher, l_items[i])
+                );
+                if(l_firstMatchStates[l_state] != 0)
+                {
+                    l_report(i);
+                }
+            }
+        }
+
+    }
+
+    /**
+     * @brief Adds every match of p_matcher in p_array to the end of
+     * outp_matches, in the order @ref ForEachMatchOfPatternMatcherInArray
+     * finds them.
+     *
+     * @details outp_matches grows as described by
+     * @ref Library::DataStructures::Array::AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy.
+     * If reallocation fails p_realloc_error is called once, outp_matches
+     * keeps the matches that were added before the failure and the rest are
+     * dropped.
+     *
+     * @param p_matcher The patterns to search for.
+     * @param p_array The array to search in.
+     * @param outp_matches The array the matches are added to, may be null.
+     * @param p_reallocate The reallocator used to grow outp_matches.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     */
+    template<typename T>
+    void AddEachMatchOfPatternMatcherInArrayToArrayUsingReallocator(
+        const PatternMatcher<T>& p_matcher,
+        const Array::Array<T>& p_array,
+        Array::Array<PatternMatch>& outp_matches,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding the matches of pattern matcher " << &p_matcher <<
+        " in array " << p_array << " to array " << outp_matches);
+
+        bool l_failed = false;
+
+        ForEachMatchOfPatternMatcherInArray(
+            p_matcher, p_array,
+            [&](const Size& p_pattern, const Size& p_index)
+            {
+                if(l_failed)
+                {
+                    return;
+                }
+
+                Size l_oldSize = outp_matches.m_Size;
+                Array::AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+                    PatternMatch{p_pattern, p_index}, outp_matches,
+                    Array::g_DEFAULT_ARRAY_GROWTH_POLICY,
+                    p_reallocate, p_realloc_error, p_realloc_error_data
+                );
+                l_failed = outp_matches.m_Size == l_oldSize;
+            }
+        );
+
+    }
+    template<typename T>
+    inline void AddEachMatchOfPatternMatcherInArrayToArray(
+        const PatternMatcher<T>& p_matcher,
+        const Array::Array<T>& p_array,
+        Array::Array<PatternMatch>& outp_matches
+    )
+    {
+        LogDebugLine("Using defaults for AddEachMatchOfPatternMatcherInArrayToArrayUsingReallocator");
+        AddEachMatchOfPatternMatcherInArrayToArrayUsingReallocator(
+            p_matcher, p_array, outp_matches,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Counts the matches of each pattern of p_matcher in p_array.
+     *
+     * @details outp_counts.m_Size is set to p_matcher.m_PatternCount and
+     * outp_counts[i] to the number of matches of pattern i, overlapping
+     * matches are all counted.
+     *
+     * If outp_counts.m_Capacity is less than p_matcher.m_PatternCount or its
+     * buffer is null, the function returns without mutating it.
+     *
+     * @param p_matcher The patterns to count.
+     * @param p_array The array to search in.
+     * @param outp_counts Where the counts are written.
+     *
+     */
+    template<typename T>
+    void CountMatchesOfEachPatternOfPatternMatcherInArray(
+        const PatternMatcher<T>& p_matcher,
+        const Array::Array<T>& p_array,
+        Array::Array<Size>& outp_counts
+    )
+    {
+
+        LogDebugLine("Counting the matches of pattern matcher " << &p_matcher <<
+        " in array " << p_array);
+
+        if(outp_counts.m_Buffer == nullptr || outp_counts.m_Capacity < p_matcher.m_PatternCount)
+        {
+            LogDebugLine("outp_counts does not have room for the counts, returning.");
+            return;
+        }
+
+        for(Size i = 0; i < p_matcher.m_PatternCount; ++i)
+        {
+            outp_counts.m_Buffer[i] = 0;
+        }
+        outp_counts.m_Size = p_matcher.m_PatternCount;
+
+        Size* l_counts = outp_counts.m_Buffer;
+        ForEachMatchOfPatternMatcherInArray(
+            p_matcher, p_array,
+            [l_counts](const Size& p_pattern, const Size&)
+            {
+                ++l_counts[p_pattern];
+            }
+        );
+
+    }
+
+    /**
+     * @brief Returns the number of matches of all of the patterns of
+     * p_matcher in p_array, overlapping matches are all counted.
+     *
+     */
+    template<typename T>
+    Size FindNumberOfMatchesOfPatternMatcherInArray(
+        const PatternMatcher<T>& p_matcher,
+        const Array::Array<T>& p_array
+    )
+    {
+
+        Size l_result = 0;
+
+        ForEachMatchOfPatternMatcherInArray(
+            p_matcher, p_array,
+            [&l_result](const Size&, const Size&)
+            {
+                ++l_result;
+            }
+        );
+
+        return l_result;
+
+    }
+
+    #ifdef ASCII_STRING__DATA_STRUCTURES_STRINGS_ASCII_STRING_ASCII_STRING_HPP
+    /**
+     * @brief The same as @ref CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator
+     * for an array of strings.
+     *
+     */
+    inline void CreatePatternMatcherAtOfStringsUsingAllocatorAndDeallocator(
+        PatternMatcher<char>& outp_matcher,
+        const Array::Array<Strings::ASCIIString>& p_patterns,
+        const PatternMatcherLayout& p_layout,
+        Allocator p_allocate,
+        Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+        //An ASCIIString only holds an Array<char>, so the buffer of strings
+        //can be used as a buffer of arrays.
+        Array::Array<Array::Array<char>> l_patterns(
+            (Array::Array<char>*)p_patterns.m_Buffer,
+            p_patterns.m_Buffer == nullptr ? 0 : p_patterns.m_Size
+        );
+        CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+            outp_matcher, l_patterns, p_layout,
+            p_allocate, p_deallocate, p_alloc_error, p_alloc_error_data
+        );
+    }
+    inline void CreatePatternMatcherAtOfStrings(
+        PatternMatcher<char>& outp_matcher,
+        const Array::Array<Strings::ASCIIString>& p_patterns
+    )
+    {
+        LogDebugLine("Using defaults for CreatePatternMatcherAtOfStringsUsingAllocatorAndDeallocator");
+        CreatePatternMatcherAtOfStringsUsingAllocatorAndDeallocator(
+            outp_matcher, p_patterns,
+            PatternMatcherLayout::Automatic,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief The same as @ref AddEachMatchOfPatternMatcherInArrayToArrayUsingReallocator
+     * for a string.
+     *
+     */
+    inline void AddEachMatchOfPatternMatcherInStringToArrayUsingReallocator(
+        const PatternMatcher<char>& p_matcher,
+        const Strings::ASCIIString& p_string,
+        Array::Array<PatternMatch>& outp_matches,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+        AddEachMatchOfPatternMatcherInArrayToArrayUsingReallocator(
+            p_matcher, p_string.m_Array, outp_matches,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+    }
+    inline void AddEachMatchOfPatternMatcherInStringToArray(
+        const PatternMatcher<char>& p_matcher,
+        const Strings::ASCIIString& p_string,
+        Array::Array<PatternMatch>& outp_matches
+    )
+    {
+        AddEachMatchOfPatternMatcherInArrayToArray(p_matcher, p_string.m_Array, outp_matches);
+    }
+    /**
+     * @brief The same as @ref CountMatchesOfEachPatternOfPatternMatcherInArray
+     * for a string.
+     *
+     */
+    inline void CountMatchesOfEachPatternOfPatternMatcherInString(
+        const PatternMatcher<char>& p_matcher,
+        const Strings::ASCIIString& p_string,
+        Array::Array<Size>& outp_counts
+    )
+    {
+        CountMatchesOfEachPatternOfPatternMatcherInArray(p_matcher, p_string.m_Array, outp_counts);
+    }
+    /**
+     * @brief The same as @ref FindNumberOfMatchesOfPatternMatcherInArray for a
+     * string.
+     *
+     */
+    inline Size FindNumberOfMatchesOfPatternMatcherInString(
+        const PatternMatcher<char>& p_matcher,
+        const Strings::ASCIIString& p_string
+    )
+    {
+        return FindNumberOfMatchesOfPatternMatcherInArray(p_matcher, p_string.m_Array);
+    }
+    #endif //ASCII_STRING__DATA_STRUCTURES_STRINGS_ASCII_STRING_ASCII_STRING_HPP
+
+}
+
+#endif //PATTERN_MATCHER__DATA_STRUCTURES_PATTERN_MATCHER_PATTERN_MATCHER_HPP
@@ -0,0 +1,121 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../PatternMatcher.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::PatternMatcher;
+
+//The size of the text searched, 8MiB.
+static const Size g_TEXT_SIZE = 8 * 1024 * 1024;
+//The number of keywords searched for.
+static const Size g_KEYWORD_COUNT = 500;
+
+//Fills p_text with random lowercase words separated by spaces.
+static void FillText(Array<char>& p_text)
+{
+
+    srand(7);
+    while(p_text.m_Size < g_TEXT_SIZE)
+    {
+        Size l_length = 2 + rand() % 8;
+        for(Size i = 0; i < l_length && p_text.m_Size < g_TEXT_SIZE; ++i)
+        {
+            p_text.m_Buffer[p_text.m_Size++] = (char)('a' + rand() % 26);
+        }
+        if(p_text.m_Size < g_TEXT_SIZE)
+        {
+            p_text.m_Buffer[p_text.m_Size++] = ' ';
+        }
+    }
+
+}
+
+//Creates random keywords of 4 to 12 letters, most of them never match.
+static void FillKeywords(Array<Array<char>>& p_keywords)
+{
+
+    srand(11);
+    for(Size i = 0; i < g_KEYWORD_COUNT; ++i)
+    {
+        Array<char>& l_keyword = p_keywords.m_Buffer[p_keywords.m_Size++];
+        CreateArrayAtOfCapacity(l_keyword, 12);
+        l_keyword.m_Size = 4 + rand() % 9;
+        for(Size n = 0; n < l_keyword.m_Size; ++n)
+        {
+            l_keyword.m_Buffer[n] = (char)('a' + rand() % 26);
+        }
+    }
+
+}
+
+TEST_CASE("Searching for many keywords at once", "[PatternMatcher][Benchmark]")
+{
+
+    Array<char> l_text;
+    CreateArrayAtOfCapacity(l_text, g_TEXT_SIZE);
+    FillText(l_text);
+
+    Array<Array<char>> l_keywords;
+    CreateArrayAtOfCapacity(l_keywords, g_KEYWORD_COUNT);
+    FillKeywords(l_keywords);
+
+    PatternMatcher<char> l_dense;
+    CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+        l_dense, l_keywords, PatternMatcherLayout::Dense, malloc, free, nullptr, nullptr
+    );
+    PatternMatcher<char> l_banded;
+    CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+        l_banded, l_keywords, PatternMatcherLayout::Banded, malloc, free, nullptr, nullptr
+    );
+
+    ArrayNeedle<char>* l_needles = (ArrayNeedle<char>*)malloc(sizeof(ArrayNeedle<char>) * g_KEYWORD_COUNT);
+    for(Size i = 0; i < g_KEYWORD_COUNT; ++i)
+    {
+        CreateArrayNeedleAtOfArray(l_needles[i], l_keywords.m_Buffer[i]);
+    }
+
+    //Only 30 of the keywords, the whole set takes seconds.
+    BENCHMARK("Needle per keyword, 30 keywords")
+    {
+        Size l_result = 0;
+        for(Size i = 0; i < 30; ++i)
+        {
+            l_result += FindNumberOfInstanceOfArrayNeedleInArray(l_needles[i], l_text);
+        }
+        return l_result;
+    };
+    BENCHMARK("Dense matcher, all keywords")
+    {
+        return FindNumberOfMatchesOfPatternMatcherInArray(l_dense, l_text);
+    };
+    BENCHMARK("Banded matcher, all keywords")
+    {
+        return FindNumberOfMatchesOfPatternMatcherInArray(l_banded, l_text);
+    };
+    BENCHMARK("Building a matcher of all keywords")
+    {
+        PatternMatcher<char> l_matcher;
+        CreatePatternMatcherAtOfPatterns(l_matcher, l_keywords);
+        Size l_stateCount = l_matcher.m_StateCount;
+        DestroyPatternMatcher(l_matcher);
+        return l_stateCount;
+    };
+
+    for(Size i = 0; i < g_KEYWORD_COUNT; ++i)
+    {
+        DestroyArrayNeedle(l_needles[i]);
+        DestroyArrayUsingDeallocator(l_keywords.m_Buffer[i], free);
+    }
+    free(l_needles);
+    DestroyPatternMatcher(l_banded);
+    DestroyPatternMatcher(l_dense);
+    DestroyArrayUsingDeallocator(l_keywords, free);
+    DestroyArrayUsingDeallocator(l_text, free);
+
+}
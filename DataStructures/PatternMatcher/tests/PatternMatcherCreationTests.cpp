@@ -0,0 +1,169 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../PatternMatcher.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::PatternMatcher;
+using namespace Debugging;
+
+//Creates a char array holding p_items, without the null character.
+static Array<char> CreateCharArray(const char* p_items)
+{
+
+    Array<char> l_result;
+    CreateArrayAtOfCapacity(l_result, strlen(p_items) + 1);
+    for(Size i = 0; p_items[i] != '\0'; ++i)
+    {
+        l_result[l_result.m_Size++] = p_items[i];
+    }
+
+    return l_result;
+
+}
+
+TEST_CASE("Pattern matcher creation", "[PatternMatcher][Creation]")
+{
+
+    Array<Array<char>> l_patterns;
+    CreateArrayAtOfCapacity(l_patterns, 4);
+    l_patterns[0] = CreateCharArray("he");
+    l_patterns[1] = CreateCharArray("she");
+    l_patterns[2] = CreateCharArray("his");
+    l_patterns[3] = CreateCharArray("hers");
+    l_patterns.m_Size = 4;
+
+    PatternMatcherLayout l_layout = GENERATE(
+        PatternMatcherLayout::Automatic,
+        PatternMatcherLayout::Dense,
+        PatternMatcherLayout::Banded
+    );
+
+    SECTION("Normal creation")
+    {
+        PatternMatcher<char> l_matcher;
+        CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+            l_matcher, l_patterns, l_layout,
+            malloc, free, nullptr, nullptr
+        );
+
+        REQUIRE(l_matcher.m_Block != nullptr);
+        REQUIRE(l_matcher.m_PatternCount == 4);
+        //The root, h, he, s, sh, she, hi, his, her, hers.
+        REQUIRE(l_matcher.m_StateCount == 10);
+        //Class 0 and e, h, i, r, s.
+        REQUIRE(l_matcher.m_ClassCount == 6);
+        REQUIRE(l_matcher.m_PatternSizes[1] == 3);
+        if(l_layout == PatternMatcherLayout::Banded)
+        {
+            REQUIRE(l_matcher.m_Layout == PatternMatcherLayout::Banded);
+        }
+        else
+        {
+            REQUIRE(l_matcher.m_Layout == PatternMatcherLayout::Dense);
+        }
+
+        DestroyPatternMatcher(l_matcher);
+        REQUIRE(l_matcher.m_Block == nullptr);
+        REQUIRE(l_matcher.m_PatternCount == 0);
+    }
+    SECTION("Allocation failure")
+    {
+        PatternMatcher<char> l_matcher;
+        bool l_called = false;
+
+        CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+            l_matcher, l_patterns, l_layout,
+            NullMalloc, free, GeneralErrorCallback, &l_called
+        );
+        REQUIRE(l_called);
+        REQUIRE(l_matcher.m_Block == nullptr);
+
+        //The temporary tables are allocated, the matcher is not.
+        l_called = false;
+        SetCountOfNullMallocAfterCount(1);
+        CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+            l_matcher, l_patterns, l_layout,
+            NullMallocAfterCount, free, GeneralErrorCallback, &l_called
+        );
+        REQUIRE(l_called);
+        REQUIRE(l_matcher.m_Block == nullptr);
+
+        Array<char> l_text = CreateCharArray("ushers");
+        REQUIRE(FindNumberOfMatchesOfPatternMatcherInArray(l_matcher, l_text) == 0);
+        DestroyPatternMatcher(l_matcher);
+        DestroyArrayUsingDeallocator(l_text, free);
+    }
+    SECTION("No patterns")
+    {
+        PatternMatcher<char> l_matcher;
+        Array<Array<char>> l_nullPatterns;
+
+        CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+            l_matcher, l_nullPatterns, l_layout,
+            malloc, free, nullptr, nullptr
+        );
+        REQUIRE(l_matcher.m_PatternCount == 0);
+        REQUIRE(l_matcher.m_StateCount == 1);
+
+        Array<char> l_text = CreateCharArray("ushers");
+        REQUIRE(FindNumberOfMatchesOfPatternMatcherInArray(l_matcher, l_text) == 0);
+        DestroyPatternMatcher(l_matcher);
+        DestroyArrayUsingDeallocator(l_text, free);
+    }
+
+    for(Size i = 0; i < l_patterns.m_Size; ++i)
+    {
+        DestroyArrayUsingDeallocator(l_patterns[i], free);
+    }
+    DestroyArrayUsingDeallocator(l_patterns, free);
+
+}
+
+TEST_CASE("Pattern matcher layout choice", "[PatternMatcher][Creation]")
+{
+
+    //Every pair of 2 of 200 different ints, the dense table would be about
+    //40000 states * 201 classes * 4 bytes, way over the limit.
+    const Size l_itemCount = 200;
+    Array<Array<int>> l_patterns;
+    CreateArrayAtOfCapacity(l_patterns, l_itemCount * l_itemCount);
+    for(Size i = 0; i < l_itemCount; ++i)
+    {
+        for(Size n = 0; n < l_itemCount; ++n)
+        {
+            Array<int>& l_pattern = l_patterns[l_patterns.m_Size++];
+            CreateArrayAtOfCapacity(l_pattern, 2);
+            l_pattern[0] = (int)i * 7;
+            l_pattern[1] = (int)n * 7;
+            l_pattern.m_Size = 2;
+        }
+    }
+
+    PatternMatcher<int> l_matcher;
+    CreatePatternMatcherAtOfPatterns(l_matcher, l_patterns);
+    REQUIRE(l_matcher.m_Layout == PatternMatcherLayout::Banded);
+    REQUIRE(l_matcher.m_ClassCount == l_itemCount + 1);
+
+    Array<int> l_text;
+    CreateArrayAtOfCapacity(l_text, 3);
+    l_text[0] = 14;
+    l_text[1] = 21;
+    l_text[2] = 5;
+    l_text.m_Size = 3;
+    REQUIRE(FindNumberOfMatchesOfPatternMatcherInArray(l_matcher, l_text) == 1);
+
+    DestroyPatternMatcher(l_matcher);
+    DestroyArrayUsingDeallocator(l_text, free);
+    for(Size i = 0; i < l_patterns.m_Size; ++i)
+    {
+        DestroyArrayUsingDeallocator(l_patterns[i], free);
+    }
+    DestroyArrayUsingDeallocator(l_patterns, free);
+
+}
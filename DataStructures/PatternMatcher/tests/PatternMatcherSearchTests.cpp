@@ -0,0 +1,267 @@
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../Strings/ASCIIString/ASCIIString.hpp"
+#include "../PatternMatcher.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::PatternMatcher;
+using namespace Library::DataStructures::Strings;
+using namespace Debugging;
+
+//Finds every match by checking every pattern at every index, in the order a
+//pattern matcher reports them.
+template<typename T>
+static Array<PatternMatch> FindMatchesSlowly(const Array<Array<T>>& p_patterns, const Array<T>& p_array)
+{
+
+    Array<PatternMatch> l_result;
+    CreateArrayAtOfCapacity(l_result, 16);
+
+    for(Size l_end = 0; l_end < p_array.m_Size; ++l_end)
+    {
+        //The longest pattern first, patterns of the same size in the order
+        //they were given.
+        for(Size l_size = l_end + 1; l_size > 0; --l_size)
+        {
+            for(Size i = 0; i < p_patterns.m_Size; ++i)
+            {
+                const Array<T>& l_pattern = p_patterns.m_Buffer[i];
+                if(l_pattern.m_Size != l_size)
+                {
+                    continue;
+                }
+
+                Size l_start = l_end + 1 - l_size;
+                Size n = 0;
+                while(n < l_size && l_pattern.m_Buffer[n] == p_array.m_Buffer[l_start + n])
+                {
+                    ++n;
+                }
+                if(n == l_size)
+                {
+                    AddItemToEndOfArray(PatternMatch{i, l_start}, l_result);
+                }
+            }
+        }
+    }
+
+    return l_result;
+
+}
+
+static Array<char> CreateCharArray(const char* p_items)
+{
+
+    Array<char> l_result;
+    CreateArrayAtOfCapacity(l_result, strlen(p_items) + 1);
+    for(Size i = 0; p_items[i] != '\0'; ++i)
+    {
+        l_result[l_result.m_Size++] = p_items[i];
+    }
+
+    return l_result;
+
+}
+
+TEST_CASE("Pattern matcher finds overlapping matches", "[PatternMatcher][Search]")
+{
+
+    Array<Array<char>> l_patterns;
+    CreateArrayAtOfCapacity(l_patterns, 6);
+    l_patterns[0] = CreateCharArray("he");
+    l_patterns[1] = CreateCharArray("she");
+    l_patterns[2] = CreateCharArray("his");
+    l_patterns[3] = CreateCharArray("hers");
+    l_patterns[4] = CreateCharArray("");
+    l_patterns[5] = CreateCharArray("he");
+    l_patterns.m_Size = 6;
+
+    Array<char> l_text = CreateCharArray("ushers and his sheep");
+
+    PatternMatcherLayout l_layout = GENERATE(PatternMatcherLayout::Dense, PatternMatcherLayout::Banded);
+    PatternMatcher<char> l_matcher;
+    CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+        l_matcher, l_patterns, l_layout, malloc, free, nullptr, nullptr
+    );
+
+    SECTION("Matches")
+    {
+        Array<PatternMatch> l_matches;
+        AddEachMatchOfPatternMatcherInArrayToArray(l_matcher, l_text, l_matches);
+
+        //she, he twice, hers, his, she, he twice.
+        REQUIRE(l_matches.m_Size == 8);
+        REQUIRE(l_matches[0].m_Pattern == 1);
+        REQUIRE(l_matches[0].m_Index == 1);
+        REQUIRE(l_matches[1].m_Pattern == 0);
+        REQUIRE(l_matches[1].m_Index == 2);
+        REQUIRE(l_matches[2].m_Pattern == 5);
+        REQUIRE(l_matches[2].m_Index == 2);
+        REQUIRE(l_matches[3].m_Pattern == 3);
+        REQUIRE(l_matches[3].m_Index == 2);
+        REQUIRE(l_matches[4].m_Pattern == 2);
+        REQUIRE(l_matches[4].m_Index == 11);
+        REQUIRE(l_matches[5].m_Pattern == 1);
+        REQUIRE(l_matches[5].m_Index == 15);
+
+        DestroyArrayUsingDeallocator(l_matches, free);
+    }
+    SECTION("Counts")
+    {
+        Array<Size> l_counts;
+        CreateArrayAtOfCapacity(l_counts, 6);
+        CountMatchesOfEachPatternOfPatternMatcherInArray(l_matcher, l_text, l_counts);
+
+        REQUIRE(l_counts.m_Size == 6);
+        REQUIRE(l_counts[0] == 2);
+        REQUIRE(l_counts[1] == 2);
+        REQUIRE(l_counts[2] == 1);
+        REQUIRE(l_counts[3] == 1);
+        REQUIRE(l_counts[4] == 0);
+        REQUIRE(l_counts[5] == 2);
+        REQUIRE(FindNumberOfMatchesOfPatternMatcherInArray(l_matcher, l_text) == 8);
+
+        //Too small arrays are not mutated.
+        Array<Size> l_small;
+        CreateArrayAtOfCapacity(l_small, 2);
+        CountMatchesOfEachPatternOfPatternMatcherInArray(l_matcher, l_text, l_small);
+        REQUIRE(l_small.m_Size == 0);
+
+        DestroyArrayUsingDeallocator(l_small, free);
+        DestroyArrayUsingDeallocator(l_counts, free);
+    }
+    SECTION("Reallocation failure")
+    {
+        Array<PatternMatch> l_matches;
+        CreateArrayAtOfCapacity(l_matches, 2);
+        bool l_called = false;
+
+        AddEachMatchOfPatternMatcherInArrayToArrayUsingReallocator(
+            l_matcher, l_text, l_matches, NullRealloc, GeneralErrorCallback, &l_called
+        );
+        REQUIRE(l_called);
+        REQUIRE(l_matches.m_Size == 2);
+        REQUIRE(l_matches[1].m_Pattern == 0);
+
+        DestroyArrayUsingDeallocator(l_matches, free);
+    }
+    SECTION("Empty haystack")
+    {
+        Array<char> l_empty;
+        REQUIRE(FindNumberOfMatchesOfPatternMatcherInArray(l_matcher, l_empty) == 0);
+    }
+
+    DestroyPatternMatcher(l_matcher);
+    DestroyArrayUsingDeallocator(l_text, free);
+    for(Size i = 0; i < l_patterns.m_Size; ++i)
+    {
+        DestroyArrayUsingDeallocator(l_patterns[i], free);
+    }
+    DestroyArrayUsingDeallocator(l_patterns, free);
+
+}
+
+TEMPLATE_TEST_CASE("Pattern matcher matches a slow search", "[PatternMatcher][Search]", char, int)
+{
+
+    //A small alphabet, so that patterns share prefixes and suffixes a lot.
+    srand(GENERATE(1, 2, 3, 4, 5));
+    const int l_alphabetSize = 3;
+
+    Array<Array<TestType>> l_patterns;
+    CreateArrayAtOfCapacity(l_patterns, 40);
+    for(Size i = 0; i < l_patterns.m_Capacity; ++i)
+    {
+        Array<TestType>& l_pattern = l_patterns[l_patterns.m_Size++];
+        CreateArrayAtOfCapacity(l_pattern, 8);
+        l_pattern.m_Size = rand() % 8;
+        for(Size n = 0; n < l_pattern.m_Size; ++n)
+        {
+            l_pattern[n] = (TestType)(rand() % l_alphabetSize * 31);
+        }
+    }
+
+    Array<TestType> l_text;
+    CreateArrayAtOfCapacity(l_text, 2000);
+    for(Size i = 0; i < l_text.m_Capacity; ++i)
+    {
+        //Some items that are not in any pattern.
+        l_text[l_text.m_Size++] = (TestType)(rand() % (l_alphabetSize + 1) * 31);
+    }
+
+    Array<PatternMatch> l_expected = FindMatchesSlowly(l_patterns, l_text);
+
+    PatternMatcherLayout l_layout = GENERATE(PatternMatcherLayout::Dense, PatternMatcherLayout::Banded);
+    PatternMatcher<TestType> l_matcher;
+    CreatePatternMatcherAtOfPatternsUsingAllocatorAndDeallocator(
+        l_matcher, l_patterns, l_layout, malloc, free, nullptr, nullptr
+    );
+
+    Array<PatternMatch> l_matches;
+    AddEachMatchOfPatternMatcherInArrayToArray(l_matcher, l_text, l_matches);
+
+    REQUIRE(l_matches.m_Size == l_expected.m_Size);
+    for(Size i = 0; i < l_expected.m_Size; ++i)
+    {
+        REQUIRE(l_matches[i].m_Pattern == l_expected[i].m_Pattern);
+        REQUIRE(l_matches[i].m_Index == l_expected[i].m_Index);
+    }
+
+    DestroyArrayUsingDeallocator(l_matches, free);
+    DestroyArrayUsingDeallocator(l_expected, free);
+    DestroyPatternMatcher(l_matcher);
+    DestroyArrayUsingDeallocator(l_text, free);
+    for(Size i = 0; i < l_patterns.m_Size; ++i)
+    {
+        DestroyArrayUsingDeallocator(l_patterns[i], free);
+    }
+    DestroyArrayUsingDeallocator(l_patterns, free);
+
+}
+
+TEST_CASE("Pattern matcher of strings", "[PatternMatcher][Search]")
+{
+
+    Array<char> l_items[3] = {CreateCharArray("GET"), CreateCharArray("POST"), CreateCharArray("/api")};
+
+    Array<ASCIIString> l_keywords;
+    CreateArrayAtOfCapacity(l_keywords, 3);
+    for(Size i = 0; i < 3; ++i)
+    {
+        l_keywords[l_keywords.m_Size++] = ASCIIString(l_items[i]);
+    }
+    ASCIIString l_log(CreateCharArray("GET /api/users\nPOST /api/orders\nGET /health\n"));
+
+    PatternMatcher<char> l_matcher;
+    CreatePatternMatcherAtOfStrings(l_matcher, l_keywords);
+
+    Array<Size> l_counts;
+    CreateArrayAtOfCapacity(l_counts, 3);
+    CountMatchesOfEachPatternOfPatternMatcherInString(l_matcher, l_log, l_counts);
+    REQUIRE(l_counts[0] == 2);
+    REQUIRE(l_counts[1] == 1);
+    REQUIRE(l_counts[2] == 2);
+    REQUIRE(FindNumberOfMatchesOfPatternMatcherInString(l_matcher, l_log) == 5);
+
+    Array<PatternMatch> l_matches;
+    AddEachMatchOfPatternMatcherInStringToArray(l_matcher, l_log, l_matches);
+    REQUIRE(l_matches.m_Size == 5);
+    REQUIRE(l_matches[1].m_Pattern == 2);
+    REQUIRE(l_matches[1].m_Index == 4);
+
+    DestroyArrayUsingDeallocator(l_matches, free);
+    DestroyArrayUsingDeallocator(l_counts, free);
+    DestroyPatternMatcher(l_matcher);
+    DestroyArrayUsingDeallocator(l_log.m_Array, free);
+    DestroyArrayUsingDeallocator(l_keywords, free);
+    for(Size i = 0; i < 3; ++i)
+    {
+        DestroyArrayUsingDeallocator(l_items[i], free);
+    }
+
+}
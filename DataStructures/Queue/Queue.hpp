@@ -4,6 +4,8 @@
 #include "../../Debugging/Logging/Log.hpp"
 #include "../Array/Array.hpp"
 
+#include <algorithm>
+
 namespace Library::DataStructures::Queue
 {
 
@@ -150,7 +152,7 @@ namespace Library::DataStructures::Queue
     )
     {
         LogDebugLine("The created array will be used as part of a queue.");
-        Array::CreateArrayAtOfCapacity(
+        Array::CreateArrayAtOfCapacityUsingAllocator(
             outp_buffer.m_Buffer,
             p_capacity,
             p_allocate, p_alloc_error, p_alloc_error_data
@@ -208,7 +210,7 @@ namespace Library::DataStructures::Queue
         Array::Array<T> l_copy = p_queue.m_Buffer;
         l_copy.m_Size = l_copy.m_Capacity;
 
-        Array::CreateCopyAtOfArray(
+        Array::CreateCopyAtOfArrayUsingAllocator(
             outp_buffer.m_Buffer,
             l_copy,
             p_allocate, p_alloc_error, p_alloc_error_data
@@ -243,9 +245,9 @@ namespace Library::DataStructures::Queue
         CreateCopyAtOfQueueUsingAllocator(
             outp_buffer,
             p_queue,
-            Library::LibraryMeta::g_DEFAULT_ALLOCATOR,
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR,
-            Library::LibraryMeta::g_DEFAULT_ALLOC_ERROR_DATA
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR,
+            Library::g_DEFAULT_ALLOC_ERROR_DATA
         );
         LogDebugLine("Returing from defaults function");
     }
@@ -290,19 +292,23 @@ namespace Library::DataStructures::Queue
     Size FindNumberOfItemsInQueue(const Queue<T>& p_queue)
     {
 
-        //TODO: Possibly make this branchless.
+        //A full queue has its item head set to the capacity.
+        if(QueueIsFull(p_queue))
+        {
+            return p_queue.m_Buffer.m_Capacity;
+        }
 
         //If there no items before the item tail the distance between it and the
         //item head gives the number of items.
-        if(p_queue.m_Buffer.m_Size < p_queue.m_LastItem)
+        if(p_queue.m_LastItem <= p_queue.m_Buffer.m_Size)
         {
             return p_queue.m_Buffer.m_Size - p_queue.m_LastItem;
         }
         else
         {
             //Here the item head is the number of items after the begining of
-            //the buffer, while the item tail minus the buffer capacity is the
-            //number of items between the item head and the end of the buffer.
+            //the buffer, while the buffer capacity minus the item tail is the
+            //number of items between the item tail and the end of the buffer.
             //
             //To get the total number of items you just add them up.
             return p_queue.m_Buffer.m_Size + (p_queue.m_Buffer.m_Capacity - p_queue.m_LastItem);
@@ -358,6 +364,20 @@ namespace Library::DataStructures::Queue
         << " by " << p_amount);
 
         Size l_oldCapacity = p_queue.m_Buffer.m_Capacity;
+        Size l_numberOfItems = FindNumberOfItemsInQueue(p_queue);
+
+        //The items that wrapped around to the start of the buffer, these are
+        //the items before the item head, or before the item tail if the queue
+        //is full.
+        Size l_numberOfWrappedItems = 0;
+        if(QueueIsFull(p_queue))
+        {
+            l_numberOfWrappedItems = p_queue.m_LastItem;
+        }
+        else if(p_queue.m_Buffer.m_Size < p_queue.m_LastItem)
+        {
+            l_numberOfWrappedItems = p_queue.m_Buffer.m_Size;
+        }
 
         IncreaseArrayCapacityByAmountUsingReallocator(
             p_queue.m_Buffer,
@@ -365,31 +385,40 @@ namespace Library::DataStructures::Queue
             p_reallocate, p_realloc_error, p_realloc_error_data
         );
 
-        //TODO: Explain this edge case.
-        if(p_queue.m_Buffer.m_Size < p_queue.m_LastItem)
+        if(p_queue.m_Buffer.m_Capacity == l_oldCapacity)
+        {
+            LogDebugLine("The capacity did not change, returning.");
+            return;
+        }
+
+        //The increased capacity is added after the last slot of the old
+        //buffer, which leaves empty slots between the items at the end of the
+        //buffer and the ones that wrapped around to its start. The wrapped
+        //items are moved after the old end so that all of the items follow
+        //each other again. Moving in order is safe, an item that wraps around
+        //again is moved to a slot that was already emptied.
+        if(l_numberOfWrappedItems != 0)
         {
             LogDebugLine("There are empty slots before the item head due to"
             " the increased capacity, moving items backward.");
-            for(
-                Size i = l_oldCapacity, n = 0;
-                n != p_queue.m_Buffer.m_Size;
-                i = (i + 1) % p_queue.m_Buffer.m_Capacity, ++n
-            )
+            for(Size i = 0; i != l_numberOfWrappedItems; ++i)
             {
-                if(n == p_queue.m_Buffer.m_Size)
-                {
-                    LogDebugLine("No more items need moving, adjusting item head.");
-                    p_queue.m_Buffer.m_Size = i;
-                    break;
-                }
-
-                LogDebugLine("Moving item backward");
-                p_queue.m_Buffer[i] = p_queue.m_Buffer[n];
+                p_queue.m_Buffer[(l_oldCapacity + i) % p_queue.m_Buffer.m_Capacity] =
+                p_queue.m_Buffer[i];
             }
-
             LogDebugLine("Finished moving items.");
         }
 
+        LogDebugLine("Adjusting item head.");
+        if(l_numberOfItems == p_queue.m_Buffer.m_Capacity)
+        {
+            p_queue.m_Buffer.m_Size = p_queue.m_Buffer.m_Capacity;
+        }
+        else
+        {
+            p_queue.m_Buffer.m_Size = (p_queue.m_LastItem + l_numberOfItems) % p_queue.m_Buffer.m_Capacity;
+        }
+
     }
     template<typename T>
     inline void IncreasesQueueCapicityByAmountUsingReallocator(
@@ -400,9 +429,9 @@ namespace Library::DataStructures::Queue
         LogDebugLine("Using defaults for IncreasesQueueCapicityByAmountUsingReallocator");
         IncreasesQueueCapicityByAmountUsingReallocator(
             p_queue, p_amount,
-            Library::LibraryMeta::g_DEFAULT_REALLOCATOR,
-            Library::LibraryMeta::g_DEFAULT_REALLOC_ERROR,
-            Library::LibraryMeta::g_DEFAULT_REALLOC_ERROR_DATA
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
         );
         LogDebugLine("Returning from defaults function");
     }
@@ -419,7 +448,14 @@ namespace Library::DataStructures::Queue
      * this. Make sure to read it's documentation for details on how
      * reallocation is done and how it could fail.
      *
-     * Items are lost after a successful reallocation.
+     * Before reallocating, the items are moved so that the item tail is at
+     * the start of the buffer, keeping the order in which they are read. If
+     * the new capacity is smaller than the number of items in p_queue, the
+     * items that were added last are lost after a successful reallocation. If
+     * reallocation fails p_queue still holds all of its items.
+     *
+     * If p_amount is 0 or is greater than the capacity of p_queue the function
+     * returns without mutating p_queue.
      *
      * @param p_queue The queue who's capacity will be decreased.
      * @param p_amount By how much the capacity of p_queue should be decreased.
@@ -441,24 +477,44 @@ namespace Library::DataStructures::Queue
         LogDebugLine("Decreasing the capacity of queue " << p_queue
         << " by " << p_amount);
 
+        Size l_capacity = p_queue.m_Buffer.m_Capacity;
+
+        //The capacity would overflow, or there is nothing to do.
+        if(p_amount == 0 || p_amount > l_capacity)
+        {
+            LogDebugLine("Nothing to decrease, returning.");
+            return;
+        }
+
+        Size l_numberOfItems = FindNumberOfItemsInQueue(p_queue);
+
+        //Reallocating only keeps the start of the buffer, but the items can be
+        //anywhere in it and can wrap around its end. Rotating the buffer so
+        //that the item tail is at index 0 puts every item at the start of the
+        //buffer in the order it is read, so the ones cut off by the
+        //reallocation are the newest ones. A full queue keeps its item head at
+        //the capacity, which is also its number of items.
+        if(p_queue.m_LastItem != 0)
+        {
+            LogDebugLine("Moving the item tail to the start of the buffer.");
+            std::rotate(
+                p_queue.m_Buffer.m_Buffer,
+                p_queue.m_Buffer.m_Buffer + p_queue.m_LastItem,
+                p_queue.m_Buffer.m_Buffer + l_capacity
+            );
+        }
+        p_queue.m_LastItem = 0;
+        p_queue.m_Buffer.m_Size = l_numberOfItems;
+
+        //If the new capacity is smaller than the item head, the array sets the
+        //item head to the new capacity, which marks the queue as full. If the
+        //new capacity is 0 the array is set to null and so is the queue.
         DecreaseArrayCapacityByAmountUsingReallocator(
             p_queue.m_Buffer,
             p_amount,
             p_reallocate, p_realloc_error, p_realloc_error_data
         );
 
-        //TODO: Explain edge case.
-        if(p_queue.m_LastItem >= p_queue.m_Buffer.m_Capacity)
-        {
-            LogDebugLine("Adjusting the item tail.");
-            p_queue.m_LastItem = 0;
-            if(p_queue.m_Buffer.m_Size >= p_queue.m_Buffer.m_Capacity)
-            {
-                LogDebugLine("Adjusting the item head");
-                p_queue.m_Buffer.m_Size = 0;
-            }
-        }
-
     }
     template<typename T>
     inline void DecreaseQueueCapacityByAmountUsingReallocator(
@@ -469,9 +525,9 @@ namespace Library::DataStructures::Queue
         LogDebugLine("Using defaults for DecreaseQueueCapacityByAmountUsingReallocator.");
         DecreaseQueueCapacityByAmountUsingReallocator(
             p_queue, p_amount,
-            Library::LibraryMeta::g_DEFAULT_REALLOCATOR,
-            Library::LibraryMeta::g_DEFAULT_REALLOC_ERROR,
-            Library::LibraryMeta::g_DEFAULT_REALLOC_ERROR_DATA
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
         );
         LogDebugLine("Returing from defaults functions.");
     }
@@ -563,7 +619,7 @@ namespace Library::DataStructures::Queue
     inline void DestroyQueueUsingDeallocator(Queue<T>& p_queue, void (&p_deallocate) (void*))
     {
         LogDebugLine("Destroying queue " << p_queue);
-        Array::DestoryArray(p_queue.m_Buffer, p_deallocate);
+        Array::DestroyArrayUsingDeallocator(p_queue.m_Buffer, p_deallocate);
         p_queue = Queue<T>();
     }
     template<typename T>
@@ -9,6 +9,7 @@
 
 #include "../Queue.hpp"
 
+using namespace Library;
 using namespace Library::DataStructures::Queue;
 
 /**
@@ -321,16 +321,20 @@ TEST_CASE("Decrease queue capacity", "[Queue][Mutable][Capacity]")
         CHECK(l_queue.m_Buffer == l_oldBuffer);
         CHECK(l_queue.m_Buffer.m_Size == l_oldSize);
         CHECK(l_queue.m_Buffer.m_Capacity == l_capacity);
+        CHECK(l_queue.m_LastItem == l_oldLastItem);
 
+        DestroyQueueUsingDeallocator(l_queue);
         return;
     }
 
+    //The newest items that do not fit in the new capacity are lost.
     Size l_newNumberOfItems = l_oldNumberOfItems;
-    if(l_oldSize > l_queue.m_Buffer.m_Capacity)
+    if(l_newNumberOfItems > l_capacity - l_amount)
     {
-        l_newNumberOfItems -= l_amount - l_oldLastItem + 1;
+        l_newNumberOfItems = l_capacity - l_amount;
     }
-    CHECK(QueueIntegrityIsGoodAndItHasNumberOfItems(l_queue, l_oldNumberOfItems));
+    CHECK(l_queue.m_Buffer.m_Capacity == l_capacity - l_amount);
+    CHECK(QueueIntegrityIsGoodAndItHasNumberOfItems(l_queue, l_newNumberOfItems));
 
     DestroyQueueUsingDeallocator(l_queue);
 
@@ -0,0 +1,1106 @@
+/** @file Rope.hpp
+ * @brief Defines everything in the @ref RopeMod module.
+ *
+ */
+
+#ifndef ROPE__DATA_STRUCTURES_ROPE_ROPE_HPP
+#define ROPE__DATA_STRUCTURES_ROPE_ROPE_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <type_traits>
+
+namespace Library::DataStructures::Rope
+{
+
+    /**
+     * @brief The number of bytes of items a chunk of a rope has room for.
+     *
+     * @details Small enough that adding or removing items inside a chunk,
+     * which moves the items after them in it, is about as fast as following
+     * a few nodes, big enough that there are few nodes.
+     *
+     */
+    constexpr Size g_ROPE_CHUNK_BYTES = 1024;
+
+    /**
+     * @brief Returns the number of items of T a chunk of a rope has room
+     * for, at least 1.
+     *
+     */
+    template<typename T>
+    constexpr Size FindChunkCapacityOfRope()
+    {
+        return sizeof(T) < g_ROPE_CHUNK_BYTES ? g_ROPE_CHUNK_BYTES / sizeof(T) : 1;
+    }
+
+    /**
+     * @brief A node of a rope, holding a chunk of items and the nodes with
+     * the items before and after them.
+     *
+     * @details The node and its chunk are allocated together, the chunk
+     * right after the node.
+     *
+     */
+    template<typename T>
+    struct RopeNode
+    {
+        /**
+         * @brief The nodes with the items before those of this node.
+         *
+         */
+        RopeNode<T>* m_Left;
+        /**
+         * @brief The nodes with the items after those of this node.
+         *
+         */
+        RopeNode<T>* m_Right;
+        /**
+         * @brief The items of this node, room for
+         * @ref FindChunkCapacityOfRope items.
+         *
+         */
+        T* m_Items;
+        /**
+         * @brief The number of items in m_Items.
+         *
+         */
+        Size m_Count;
+        /**
+         * @brief The number of items of this node and all nodes under it.
+         *
+         */
+        Size m_Size;
+        /**
+         * @brief A random number not less than that of any node under this
+         * one, which keeps the tree balanced.
+         *
+         */
+        uint32_t m_Priority;
+    };
+
+    /**
+     * @brief Returns item p_index of the nodes of p_node, which must have
+     * more than p_index items.
+     *
+     * @time O(log n), n being the number of items.
+     *
+     */
+    template<typename T>
+    T& FindItemOfRopeNodesAtIndex(RopeNode<T>* p_node, Size p_index)
+    {
+        while(true)
+        {
+            Size l_leftSize = p_node->m_Left == nullptr ? 0 : p_node->m_Left->m_Size;
+            if(p_index < l_leftSize)
+            {
+                p_node = p_node->m_Left;
+            }
+            else if(p_index < l_leftSize + p_node->m_Count)
+            {
+                return p_node->m_Items[p_index - l_leftSize];
+            }
+            else
+            {
+                p_index -= l_leftSize + p_node->m_Count;
+                p_node = p_node->m_Right;
+            }
+        }
+    }
+
+    /**
+     * @brief A sequence of items of type T kept in chunks on the nodes of a
+     * balanced tree, so that adding, removing, splitting and joining at any
+     * index takes O(log n) time.
+     *
+     * @details The tree is ordered by index, the items of a node coming
+     * after those of its left nodes and before those of its right nodes.
+     * Each node knows how many items are under it, so finding the node of an
+     * index follows a single path from the root. The tree is kept balanced
+     * by giving each node a random priority that is never less than the ones
+     * under it, which makes paths O(log n) long no matter the order of the
+     * edits.
+     *
+     * Unlike a @ref Library::DataStructures::GapBuffer::GapBuffer "GapBuffer",
+     * an edit costs the same no matter how far it is from the last one.
+     *
+     * Items are moved with memmove, so T must be trivially copyable.
+     *
+     * A default constructed rope is empty. Copying one copies the handle
+     * only, the same as for arrays.
+     *
+     */
+    template<typename T>
+    struct Rope
+    {
+        static_assert(
+            std::is_trivially_copyable_v<T>,
+            "The items of a rope are moved with memmove and must be trivially copyable."
+        );
+
+        /**
+         * @brief The root of the tree, null if the rope is empty.
+         *
+         */
+        RopeNode<T>* m_Root;
+        /**
+         * @brief The state of the generator of the priorities of new nodes.
+         *
+         */
+        uint64_t m_Seed;
+
+        /**
+         * @brief Creates an empty rope.
+         *
+         */
+        Rope():
+        m_Root(nullptr),
+        m_Seed(0x9E3779B97F4A7C15)
+        {
+            LogDebugLine("Constructing rope at " << this);
+        }
+
+        /**
+         * @brief Returns item p_index.
+         *
+         * @details Finding the item follows a path from the root, to go over
+         * all items use @ref ForEachChunkOfRope instead. If p_index is not
+         * less than the number of items the behaviour is undefined, unless
+         * @ref ARRAY_CHECK_INDEXES is 1 in which case the process is aborted.
+         *
+         * @time O(log n), n being the number of items.
+         *
+         */
+        T& operator[] (const Size& p_index)
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(m_Root == nullptr || p_index >= m_Root->m_Size)
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in rope " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return FindItemOfRopeNodesAtIndex(m_Root, p_index);
+        }
+        /**
+         * @brief Returns item p_index, readonly version.
+         *
+         */
+        const T& operator[] (const Size& p_index) const
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(m_Root == nullptr || p_index >= m_Root->m_Size)
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in rope " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return FindItemOfRopeNodesAtIndex(m_Root, p_index);
+        }
+    };
+
+    /**
+     * @brief Returns the number of items in p_rope.
+     *
+     */
+    template<typename T>
+    inline Size FindSizeOfRope(const Rope<T>& p_rope)
+    {
+        return p_rope.m_Root == nullptr ? 0 : p_rope.m_Root->m_Size;
+    }
+
+    /**
+     * @brief Returns the number of items of the nodes of p_node, 0 if it is
+     * null.
+     *
+     */
+    template<typename T>
+    inline Size FindSizeOfRopeNode(const RopeNode<T>* p_node)
+    {
+        return p_node == nullptr ? 0 : p_node->m_Size;
+    }
+
+    /**
+     * @brief Sets the size of p_node from its count and the sizes of the
+     * nodes right under it.
+     *
+     */
+    template<typename T>
+    inline void UpdateSizeOfRopeNode(RopeNode<T>& p_node)
+    {
+        p_node.m_Size = FindSizeOfRopeNode(p_node.m_Left) + p_node.m_Count + FindSizeOfRopeNode(p_node.m_Right);
+    }
+
+    /**
+     * @brief Returns the next priority for a node of p_rope.
+     *
+     */
+    template<typename T>
+    inline uint32_t FindNextPriorityOfRope(Rope<T>& p_rope)
+    {
+        //xorshift64*
+        p_rope.m_Seed ^= p_rope.m_Seed >> 12;
+        p_rope.m_Seed ^= p_rope.m_Seed << 25;
+        p_rope.m_Seed ^= p_rope.m_Seed >> 27;
+        return (uint32_t)((p_rope.m_Seed * 0x2545F4914F6CDD1D) >> 32);
+    }
+
+    /**
+     * @brief Allocates a node without items and nodes under it, with a
+     * priority from p_rope.
+     *
+     * @return The node, or null if allocation failed, in which case
+     * p_alloc_error is called.
+     *
+     */
+    template<typename T>
+    RopeNode<T>* CreateRopeNodeOfRopeUsingAllocator(
+        Rope<T>& p_rope,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        //The chunk starts at the first multiple of its alignment after the
+        //node.
+        constexpr Size l_itemsOffset = (sizeof(RopeNode<T>) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        RopeNode<T>* l_node = (RopeNode<T>*)p_allocate(
+            l_itemsOffset + sizeof(T) * FindChunkCapacityOfRope<T>()
+        );
+        if(l_node == nullptr)
+        {
+            LogDebugLine("Allocation of a rope node failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return nullptr;
+        }
+
+        l_node->m_Left = nullptr;
+        l_node->m_Right = nullptr;
+        l_node->m_Items = (T*)((Byte*)l_node + l_itemsOffset);
+        l_node->m_Count = 0;
+        l_node->m_Size = 0;
+        l_node->m_Priority = FindNextPriorityOfRope(p_rope);
+
+        return l_node;
+
+    }
+
+    /**
+     * @brief Deallocates p_node and all nodes under it using p_deallocate.
+     *
+     * @time O(k), k being the number of nodes.
+     *
+     */
+    template<typename T>
+    void DestroyRopeNodesUsingDeallocator(RopeNode<T>* p_node, Deallocator p_deallocate)
+    {
+        while(p_node != nullptr)
+        {
+            DestroyRopeNodesUsingDeallocator(p_node->m_Left, p_deallocate);
+            RopeNode<T>* l_right = p_node->m_Right;
+            p_deallocate(p_node);
+            p_node = l_right;
+        }
+    }
+
+    /**
+     * @brief Joins the nodes of p_before and p_after into one tree with the
+     * items of p_before first, and returns its root.
+     *
+     * @time O(log n), n being the number of items.
+     *
+     */
+    template<typename T>
+    RopeNode<T>* JoinRopeNodes(RopeNode<T>* p_before, RopeNode<T>* p_after)
+    {
+
+        if(p_before == nullptr)
+        {
+            return p_after;
+        }
+        if(p_after == nullptr)
+        {
+            return p_before;
+        }
+
+        if(p_before->m_Priority >= p_after->m_Priority)
+        {
+            p_before->m_Right = JoinRopeNodes(p_before->m_Right, p_after);
+            UpdateSizeOfRopeNode(*p_before);
+            return p_before;
+        }
+        else
+        {
+            p_after->m_Left = JoinRopeNodes(p_before, p_after->m_Left);
+            UpdateSizeOfRopeNode(*p_after);
+            return p_after;
+        }
+
+    }
+
+    /**
+     * @brief Returns true if splitting the nodes of p_node at p_index would
+     * split the chunk of a node, which needs a new node.
+     *
+     */
+    template<typename T>
+    bool IsIndexInsideChunkOfRopeNodes(const RopeNode<T>* p_node, Size p_index)
+    {
+
+        while(p_node != nullptr)
+        {
+            Size l_leftSize = FindSizeOfRopeNode(p_node->m_Left);
+            if(p_index <= l_leftSize)
+            {
+                p_node = p_node->m_Left;
+            }
+            else if(p_index < l_leftSize + p_node->m_Count)
+            {
+                return true;
+            }
+            else
+            {
+                p_index -= l_leftSize + p_node->m_Count;
+                p_node = p_node->m_Right;
+            }
+        }
+        return false;
+
+    }
+
+    /**
+     * @brief Splits the nodes of p_node into those with the first p_index
+     * items, put in outp_before, and those with the rest, put in
+     * outp_after.
+     *
+     * @details If p_index is inside the chunk of a node, the items from it
+     * on are moved to p_spare which must then not be null, see
+     * @ref IsIndexInsideChunkOfRopeNodes. p_spare takes the priority of that
+     * node.
+     *
+     * @time O(log n), n being the number of items.
+     *
+     */
+    template<typename T>
+    void SplitRopeNodesAtIndex(
+        RopeNode<T>* p_node,
+        Size p_index,
+        RopeNode<T>* p_spare,
+        RopeNode<T>*& outp_before,
+        RopeNode<T>*& outp_after
+    )
+    {
+
+        if(p_node == nullptr)
+        {
+            outp_before = nullptr;
+            outp_after = nullptr;
+            return;
+        }
+
+        Size l_leftSize = FindSizeOfRopeNode(p_node->m_Left);
+        if(p_index <= l_leftSize)
+        {
+            SplitRopeNodesAtIndex(p_node->m_Left, p_index, p_spare, outp_before, p_node->m_Left);
+            UpdateSizeOfRopeNode(*p_node);
+            outp_after = p_node;
+        }
+        else if(p_index >= l_leftSize + p_node->m_Count)
+        {
+            SplitRopeNodesAtIndex(
+                p_node->m_Right, p_index - l_leftSize - p_node->m_Count, p_spare,
+                p_node->m_Right, outp_after
+            );
+            UpdateSizeOfRopeNode(*p_node);
+            outp_before = p_node;
+        }
+        else
+        {
+            Size l_index = p_index - l_leftSize;
+            p_spare->m_Count = p_node->m_Count - l_index;
+            memcpy((void*)p_spare->m_Items, (const void*)(p_node->m_Items + l_index), sizeof(T) * p_spare->m_Count);
+            p_spare->m_Priority = p_node->m_Priority;
+            p_spare->m_Left = nullptr;
+            p_spare->m_Right = p_node->m_Right;
+            UpdateSizeOfRopeNode(*p_spare);
+
+            p_node->m_Count = l_index;
+            p_node->m_Right = nullptr;
+            UpdateSizeOfRopeNode(*p_node);
+
+            outp_before = p_node;
+            outp_after = p_spare;
+        }
+
+    }
+
+    /**
+     * @brief Adds p_count items from p_items to the node whose chunk has
+     * index p_index of p_node in it or right after it, if the chunk has room
+     * for them.
+     *
+     * @return True if the items were added, false if p_index is past the
+     * end or the chunk has no room for them, in which case nothing is
+     * changed.
+     *
+     * @time O(log n + c), n being the number of items and c the chunk
+     * capacity.
+     *
+     */
+    template<typename T>
+    bool AddItemsToChunkOfRopeNodesAtIndex(
+        RopeNode<T>* p_node,
+        const Size& p_index,
+        const T* p_items, const Size& p_count
+    )
+    {
+
+        if(p_node == nullptr)
+        {
+            return false;
+        }
+
+        bool l_added;
+        Size l_leftSize = FindSizeOfRopeNode(p_node->m_Left);
+        if(p_index < l_leftSize)
+        {
+            l_added = AddItemsToChunkOfRopeNodesAtIndex(p_node->m_Left, p_index, p_items, p_count);
+        }
+        else if(p_index <= l_leftSize + p_node->m_Count)
+        {
+            l_added = p_node->m_Count + p_count <= FindChunkCapacityOfRope<T>();
+            if(l_added)
+            {
+                Size l_index = p_index - l_leftSize;
+                memmove(
+                    (void*)(p_node->m_Items + l_index + p_count),
+                    (const void*)(p_node->m_Items + l_index),
+                    sizeof(T) * (p_node->m_Count - l_index)
+                );
+                memcpy((void*)(p_node->m_Items + l_index), (const void*)p_items, sizeof(T) * p_count);
+                p_node->m_Count += p_count;
+            }
+        }
+        else
+        {
+            l_added = AddItemsToChunkOfRopeNodesAtIndex(
+                p_node->m_Right, p_index - l_leftSize - p_node->m_Count,
+                p_items, p_count
+            );
+        }
+
+        if(l_added)
+        {
+            p_node->m_Size += p_count;
+        }
+        return l_added;
+
+    }
+
+    /**
+     * @brief Removes p_count items starting from p_index from the nodes of
+     * p_node, deallocating nodes left without items using p_deallocate, and
+     * returns the new root.
+     *
+     * @details p_index + p_count must not be greater than the number of
+     * items.
+     *
+     * @time O(log n + k + c), n being the number of items, k the number of
+     * nodes with removed items and c the chunk capacity.
+     *
+     */
+    template<typename T>
+    RopeNode<T>* RemoveItemsFromRopeNodes(
+        RopeNode<T>* p_node,
+        const Size& p_index,
+        const Size& p_count,
+        Deallocator p_deallocate
+    )
+    {
+
+        if(p_node == nullptr || p_count == 0)
+        {
+            return p_node;
+        }
+
+        Size l_chunkStart = FindSizeOfRopeNode(p_node->m_Left);
+        Size l_chunkEnd = l_chunkStart + p_node->m_Count;
+        Size l_end = p_index + p_count;
+
+        if(p_index < l_chunkStart)
+        {
+            p_node->m_Left = RemoveItemsFromRopeNodes(
+                p_node->m_Left, p_index,
+                (l_end < l_chunkStart ? l_end : l_chunkStart) - p_index,
+                p_deallocate
+            );
+        }
+
+        Size l_from = p_index > l_chunkStart ? p_index : l_chunkStart;
+        Size l_to = l_end < l_chunkEnd ? l_end : l_chunkEnd;
+        if(l_from < l_to)
+        {
+            memmove(
+                (void*)(p_node->m_Items + l_from - l_chunkStart),
+                (const void*)(p_node->m_Items + l_to - l_chunkStart),
+                sizeof(T) * (l_chunkEnd - l_to)
+            );
+            p_node->m_Count -= l_to - l_from;
+        }
+
+        if(l_end > l_chunkEnd)
+        {
+            Size l_rightIndex = p_index > l_chunkEnd ? p_index - l_chunkEnd : 0;
+            p_node->m_Right = RemoveItemsFromRopeNodes(
+                p_node->m_Right, l_rightIndex,
+                l_end - l_chunkEnd - l_rightIndex,
+                p_deallocate
+            );
+        }
+
+        UpdateSizeOfRopeNode(*p_node);
+
+        if(p_node->m_Count == 0)
+        {
+            RopeNode<T>* l_joined = JoinRopeNodes(p_node->m_Left, p_node->m_Right);
+            p_deallocate(p_node);
+            return l_joined;
+        }
+        return p_node;
+
+    }
+
+    /**
+     * @brief Creates nodes for the p_count items of p_items, each but the
+     * last with a full chunk, and returns their root.
+     *
+     * @return The root, or null if allocation failed, in which case
+     * p_alloc_error is called and the nodes that were created are
+     * deallocated.
+     *
+     * @time O(k log k), k being the number of nodes created.
+     *
+     */
+    template<typename T>
+    RopeNode<T>* CreateRopeNodesOfRopeFromItemsUsingAllocatorAndDeallocator(
+        Rope<T>& p_rope,
+        const T* p_items, const Size& p_count,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        RopeNode<T>* l_root = nullptr;
+        for(Size i = 0; i < p_count;)
+        {
+            RopeNode<T>* l_node = CreateRopeNodeOfRopeUsingAllocator(
+                p_rope,
+                p_allocate, p_alloc_error, p_alloc_error_data
+            );
+            if(l_node == nullptr)
+            {
+                DestroyRopeNodesUsingDeallocator(l_root, p_deallocate);
+                return nullptr;
+            }
+
+            Size l_count = p_count - i < FindChunkCapacityOfRope<T>() ? p_count - i : FindChunkCapacityOfRope<T>();
+            memcpy((void*)l_node->m_Items, (const void*)(p_items + i), sizeof(T) * l_count);
+            l_node->m_Count = l_count;
+            l_node->m_Size = l_count;
+            l_root = JoinRopeNodes(l_root, l_node);
+            i += l_count;
+        }
+        return l_root;
+
+    }
+
+    /**
+     * @brief Creates a rope at outp_rope with a copy of each item of p_from,
+     * in order.
+     *
+     * @details outp_rope is overwritten without being destroyed. If
+     * allocation fails p_alloc_error is called and an empty rope is created.
+     *
+     * @time O(n), n being p_from.m_Size.
+     *
+     */
+    template<typename T>
+    void CreateRopeAtFromArrayUsingAllocatorAndDeallocator(
+        Rope<T>& outp_rope,
+        const Array::Array<T>& p_from,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating rope at " << &outp_rope << " from array " << p_from);
+
+        outp_rope = Rope<T>();
+        if(p_from.m_Buffer == nullptr)
+        {
+            LogDebugLine("p_from is null, returning.");
+            return;
+        }
+
+        outp_rope.m_Root = CreateRopeNodesOfRopeFromItemsUsingAllocatorAndDeallocator(
+            outp_rope, p_from.m_Buffer, p_from.m_Size,
+            p_allocate, p_deallocate,
+            p_alloc_error, p_alloc_error_data
+        );
+
+    }
+    template<typename T>
+    inline void CreateRopeAtFromArray(
+        Rope<T>& outp_rope,
+        const Array::Array<T>& p_from
+    )
+    {
+        LogDebugLine("Using defaults for CreateRopeAtFromArrayUsingAllocatorAndDeallocator");
+        CreateRopeAtFromArrayUsingAllocatorAndDeallocator(
+            outp_rope, p_from,
+            Library::g_DEFAULT_ALLOCATOR, Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Adds a copy of each item of p_to_add to p_rope so that the first
+     * one is at p_index, the items from p_index on coming after them.
+     *
+     * @details If the chunk at p_index has room the items are added to it.
+     * Otherwise the rope is split at p_index, the items are added to the end
+     * of the first part or the start of the second if either chunk has room,
+     * or else to new nodes put between the two, and the parts are joined
+     * again.
+     *
+     * If p_index is greater than the number of items p_index_error is called
+     * and p_rope is not mutated. If allocation fails p_alloc_error is called
+     * and no item is added, though a chunk may have been split in two.
+     *
+     * @param p_to_add The array whose items will be added, its buffer must
+     * not be a chunk of p_rope.
+     * @param p_rope The rope to add the items to.
+     * @param p_index The index the first added item will have. If it is the
+     * number of items, the items are added to the end.
+     * @param p_index_error A callback in case the index is incorrect.
+     * @param p_index_error_data Data that will be passed to p_index_error.
+     * @param p_allocate The allocator used for new nodes.
+     * @param p_deallocate The deallocator used for new nodes if allocating
+     * one of them fails.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     * @time O(log n + m), n being the number of items of p_rope and m
+     * p_to_add.m_Size.
+     *
+     */
+    template<typename T>
+    void AddArrayToRopeAtIndexUsingAllocatorAndDeallocator(
+        const Array::Array<T>& p_to_add,
+        Rope<T>& p_rope,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding array " << p_to_add << " to rope " << p_rope
+        << " at index " << p_index);
+
+        if(p_index > FindSizeOfRope(p_rope))
+        {
+            LogDebugLine("Index " << p_index << " is past the end.");
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+        if(p_to_add.m_Buffer == nullptr || p_to_add.m_Size == 0)
+        {
+            LogDebugLine("p_to_add is empty, returning.");
+            return;
+        }
+        if(FindSizeOfRope(p_rope) + p_to_add.m_Size < p_to_add.m_Size)
+        {
+            LogDebugLine("The new size overflows, returning.");
+            return;
+        }
+
+        if(AddItemsToChunkOfRopeNodesAtIndex(p_rope.m_Root, p_index, p_to_add.m_Buffer, p_to_add.m_Size))
+        {
+            LogDebugLine("Added the items to a chunk.");
+            return;
+        }
+
+        RopeNode<T>* l_spare = nullptr;
+        if(IsIndexInsideChunkOfRopeNodes(p_rope.m_Root, p_index))
+        {
+            l_spare = CreateRopeNodeOfRopeUsingAllocator(
+                p_rope,
+                p_allocate, p_alloc_error, p_alloc_error_data
+            );
+            if(l_spare == nullptr)
+            {
+                return;
+            }
+        }
+
+        RopeNode<T>* l_before;
+        RopeNode<T>* l_after;
+        SplitRopeNodesAtIndex(p_rope.m_Root, p_index, l_spare, l_before, l_after);
+
+        if(
+            !AddItemsToChunkOfRopeNodesAtIndex(l_before, p_index, p_to_add.m_Buffer, p_to_add.m_Size) &&
+            !AddItemsToChunkOfRopeNodesAtIndex(l_after, 0, p_to_add.m_Buffer, p_to_add.m_Size)
+        )
+        {
+            RopeNode<T>* l_added = CreateRopeNodesOfRopeFromItemsUsingAllocatorAndDeallocator(
+                p_rope, p_to_add.m_Buffer, p_to_add.m_Size,
+                p_allocate, p_deallocate,
+                p_alloc_error, p_alloc_error_data
+            );
+            l_before = JoinRopeNodes(l_before, l_added);
+        }
+
+        p_rope.m_Root = JoinRopeNodes(l_before, l_after);
+
+    }
+    template<typename T>
+    inline void AddArrayToRopeAtIndex(
+        const Array::Array<T>& p_to_add,
+        Rope<T>& p_rope,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data
+    )
+    {
+        LogDebugLine("Using defaults for AddArrayToRopeAtIndexUsingAllocatorAndDeallocator");
+        AddArrayToRopeAtIndexUsingAllocatorAndDeallocator(
+            p_to_add, p_rope,
+            p_index, p_index_error, p_index_error_data,
+            Library::g_DEFAULT_ALLOCATOR, Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Removes p_numberOfItems items from p_rope, starting from and
+     * including the one at p_index.
+     *
+     * @details Unlike for arrays exactly p_numberOfItems items are removed,
+     * so 0 removes nothing and p_index may be the number of items.
+     *
+     * The items after the removed ones in the same chunk are moved down,
+     * nodes left without items are deallocated using p_deallocate. Nothing
+     * is allocated.
+     *
+     * If p_index + p_numberOfItems is greater than the number of items, or
+     * overflows, p_index_error is called and p_rope is not mutated.
+     *
+     * @time O(log n + k), n being the number of items and k the number of
+     * nodes with removed items.
+     *
+     */
+    template<typename T>
+    void RemoveNumberOfItemsAtIndexFromRopeUsingDeallocator(
+        const Size& p_numberOfItems,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        Rope<T>& p_rope,
+        Deallocator p_deallocate
+    )
+    {
+
+        LogDebugLine("Removing " << p_numberOfItems << " items starting from "
+        "index " << p_index << " in rope " << p_rope);
+
+        if(p_index + p_numberOfItems < p_index || p_index + p_numberOfItems > FindSizeOfRope(p_rope))
+        {
+            LogDebugLine("The items to remove go past the end.");
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+
+        p_rope.m_Root = RemoveItemsFromRopeNodes(p_rope.m_Root, p_index, p_numberOfItems, p_deallocate);
+
+    }
+    template<typename T>
+    inline void RemoveNumberOfItemsAtIndexFromRope(
+        const Size& p_numberOfItems,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        Rope<T>& p_rope
+    )
+    {
+        LogDebugLine("Using defaults for RemoveNumberOfItemsAtIndexFromRopeUsingDeallocator");
+        RemoveNumberOfItemsAtIndexFromRopeUsingDeallocator(
+            p_numberOfItems, p_index,
+            p_index_error, p_index_error_data,
+            p_rope,
+            Library::g_DEFAULT_DEALLOCATOR
+        );
+    }
+
+    /**
+     * @brief Moves the items of p_rope from p_index on to outp_after, which
+     * is overwritten without being destroyed.
+     *
+     * @details At most one node is allocated, when p_index is inside a chunk.
+     *
+     * If p_index is greater than the number of items p_index_error is called
+     * and nothing is mutated. If allocation fails p_alloc_error is called
+     * and nothing is mutated.
+     *
+     * @time O(log n), n being the number of items.
+     *
+     */
+    template<typename T>
+    void SplitRopeAtIndexUsingAllocator(
+        Rope<T>& p_rope,
+        const Size& p_index,
+        Rope<T>& outp_after,
+        Callback p_index_error, void* p_index_error_data,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Splitting rope " << p_rope << " at index " << p_index
+        << " into rope at " << &outp_after);
+
+        if(p_index > FindSizeOfRope(p_rope))
+        {
+            LogDebugLine("Index " << p_index << " is past the end.");
+            if(p_index_error != nullptr)
+            {
+                LogDebugLine("Index error is not null so calling it.");
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+
+        RopeNode<T>* l_spare = nullptr;
+        if(IsIndexInsideChunkOfRopeNodes(p_rope.m_Root, p_index))
+        {
+            l_spare = CreateRopeNodeOfRopeUsingAllocator(
+                p_rope,
+                p_allocate, p_alloc_error, p_alloc_error_data
+            );
+            if(l_spare == nullptr)
+            {
+                return;
+            }
+        }
+
+        RopeNode<T>* l_after;
+        SplitRopeNodesAtIndex(p_rope.m_Root, p_index, l_spare, p_rope.m_Root, l_after);
+        outp_after = Rope<T>();
+        outp_after.m_Root = l_after;
+        outp_after.m_Seed = FindNextPriorityOfRope(p_rope) | (uint64_t)1 << 63;
+
+    }
+    template<typename T>
+    inline void SplitRopeAtIndex(
+        Rope<T>& p_rope,
+        const Size& p_index,
+        Rope<T>& outp_after,
+        Callback p_index_error, void* p_index_error_data
+    )
+    {
+        LogDebugLine("Using defaults for SplitRopeAtIndexUsingAllocator");
+        SplitRopeAtIndexUsingAllocator(
+            p_rope, p_index, outp_after,
+            p_index_error, p_index_error_data,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Moves the items of p_to_move to the end of p_rope, leaving
+     * p_to_move empty.
+     *
+     * @details No items are copied and nothing is allocated, the trees are
+     * joined.
+     *
+     * @time O(log n), n being the number of items of both.
+     *
+     */
+    template<typename T>
+    void MoveRopeToEndOfRope(Rope<T>& p_to_move, Rope<T>& p_rope)
+    {
+
+        LogDebugLine("Moving rope " << p_to_move << " to the end of rope " << p_rope);
+
+        if(&p_to_move == &p_rope)
+        {
+            LogDebugLine("Both ropes are the same, returning.");
+            return;
+        }
+
+        p_rope.m_Root = JoinRopeNodes(p_rope.m_Root, p_to_move.m_Root);
+        p_to_move.m_Root = nullptr;
+
+    }
+
+    /**
+     * @brief Calls p_function with an array of the items of each chunk of
+     * the nodes of p_node, in order, see @ref ForEachChunkOfRope.
+     *
+     */
+    template<typename T, typename F>
+    void ForEachChunkOfRopeNodes(RopeNode<T>* p_node, F& p_function)
+    {
+        while(p_node != nullptr)
+        {
+            ForEachChunkOfRopeNodes(p_node->m_Left, p_function);
+            Array::Array<T> l_chunk(p_node->m_Items, p_node->m_Count, p_node->m_Count);
+            p_function(l_chunk);
+            p_node = p_node->m_Right;
+        }
+    }
+
+    /**
+     * @brief Calls p_function with an array of the items of each chunk of
+     * p_rope, in order.
+     *
+     * @details The array given to p_function has the chunk as its buffer,
+     * the number of items in it as its size and capacity. It does not own
+     * the chunk and must not be resized or destroyed, but its items may be
+     * changed. p_rope must not be changed until this returns.
+     *
+     * @param p_rope The rope whose chunks to go over.
+     * @param p_function Called with an Array<T>&.
+     *
+     * @time O(k), k being the number of nodes, plus whatever p_function
+     * takes.
+     *
+     */
+    template<typename T, typename F>
+    void ForEachChunkOfRope(const Rope<T>& p_rope, F&& p_function)
+    {
+
+        LogDebugLine("Calling a function for each chunk of rope " << p_rope);
+
+        ForEachChunkOfRopeNodes(p_rope.m_Root, p_function);
+
+    }
+
+    /**
+     * @brief Creates an array at outp_array with a copy of each item of
+     * p_from, in order.
+     *
+     * @details The array's buffer is allocated using p_allocate and has a
+     * capacity of the number of items of p_from. If p_from is empty or
+     * allocation fails, in which case p_alloc_error is called, a null array
+     * is created.
+     *
+     * @time O(n), n being the number of items of p_from.
+     *
+     */
+    template<typename T>
+    void CreateArrayAtFromRopeUsingAllocator(
+        Array::Array<T>& outp_array,
+        const Rope<T>& p_from,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating array at " << &outp_array << " from rope " << p_from);
+
+        outp_array = Array::Array<T>();
+        Array::CreateArrayAtOfCapacityUsingAllocator(
+            outp_array, FindSizeOfRope(p_from),
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(outp_array.m_Buffer == nullptr)
+        {
+            LogDebugLine("The array is null, returning.");
+            return;
+        }
+
+        ForEachChunkOfRope(p_from, [&](const Array::Array<T>& p_chunk)
+        {
+            memcpy((void*)(outp_array.m_Buffer + outp_array.m_Size), (const void*)p_chunk.m_Buffer, sizeof(T) * p_chunk.m_Size);
+            outp_array.m_Size += p_chunk.m_Size;
+        });
+
+    }
+    template<typename T>
+    inline void CreateArrayAtFromRope(
+        Array::Array<T>& outp_array,
+        const Rope<T>& p_from
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayAtFromRopeUsingAllocator");
+        CreateArrayAtFromRopeUsingAllocator(
+            outp_array, p_from,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Deallocates all nodes of p_rope using p_deallocate, leaving it
+     * empty.
+     *
+     */
+    template<typename T>
+    void DestroyRopeUsingDeallocator(Rope<T>& p_rope, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying rope " << p_rope);
+
+        DestroyRopeNodesUsingDeallocator(p_rope.m_Root, p_deallocate);
+        p_rope.m_Root = nullptr;
+
+    }
+    template<typename T>
+    inline void DestroyRope(Rope<T>& p_rope)
+    {
+        LogDebugLine("Using defaults for DestroyRopeUsingDeallocator");
+        DestroyRopeUsingDeallocator(p_rope, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+
+    #ifdef DEBUG
+    /**
+     * @brief Logs the fields of p_rope, its nodes are not logged.
+     *
+     */
+    template<typename T>
+    const Debugging::Log& operator<< (const Debugging::Log& p_log, const Rope<T>& p_rope)
+    {
+
+        p_log << &p_rope;
+        p_log << " { m_Root = " << (void*)p_rope.m_Root;
+        p_log << ", size = " << FindSizeOfRope(p_rope);
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+}
+
+#endif //ROPE__DATA_STRUCTURES_ROPE_ROPE_HPP
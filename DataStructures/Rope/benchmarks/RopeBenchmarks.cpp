@@ -0,0 +1,195 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../Rope.hpp"
+#include "../../GapBuffer/GapBuffer.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::GapBuffer;
+using namespace Library::DataStructures::Rope;
+
+//The size of the text that is edited, 4MiB of chars.
+static const Size g_TEXT_SIZE = 4 * 1024 * 1024;
+static const Size g_EDIT_COUNT = 2000;
+
+struct Edit
+{
+    Size m_Index;
+    Size m_Count;
+    bool m_IsAdd;
+};
+
+//Edits anywhere in the text, like a search and replace over all of it or
+//many cursors. If p_isTyping they are instead close to each other, like
+//someone typing. Every edit is at least 1 item away from the start and stays
+//before the end.
+static Array<Edit> CreateEditTrace(bool p_isTyping)
+{
+
+    Array<Edit> l_trace;
+    CreateArrayAtOfCapacity(l_trace, g_EDIT_COUNT);
+    srand(42);
+
+    Size l_cursor = g_TEXT_SIZE / 2;
+    for(Size i = 0; i < g_EDIT_COUNT; ++i)
+    {
+        if(p_isTyping)
+        {
+            l_cursor += rand() % 65;
+            l_cursor -= rand() % 65;
+        }
+        else
+        {
+            l_cursor = ((Size)rand() * RAND_MAX + rand()) % (g_TEXT_SIZE - 64) + 1;
+        }
+        Edit l_edit;
+        l_edit.m_Index = l_cursor;
+        l_edit.m_Count = rand() % 16 + 1;
+        l_edit.m_IsAdd = rand() % 4 != 0;
+        l_trace.m_Buffer[i] = l_edit;
+    }
+    l_trace.m_Size = g_EDIT_COUNT;
+
+    return l_trace;
+
+}
+
+static void BenchmarkEditTrace(const Array<char>& p_text, const Array<Edit>& p_trace)
+{
+
+    char l_typed[16] = {'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x'};
+
+    //Each run starts with a copy of the text.
+    BENCHMARK_ADVANCED("Array")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            Array<char> l_array;
+            CreateArrayAtOfCapacity(l_array, g_TEXT_SIZE + g_EDIT_COUNT * 16);
+            memcpy(l_array.m_Buffer, p_text.m_Buffer, g_TEXT_SIZE);
+            l_array.m_Size = g_TEXT_SIZE;
+            for(const Edit& l_edit : p_trace)
+            {
+                if(l_edit.m_IsAdd)
+                {
+                    AddArrayToArrayAfterIndex(Array<char>(l_typed, l_edit.m_Count), l_array, l_edit.m_Index - 1, nullptr, nullptr);
+                }
+                else
+                {
+                    RemoveNumberOfItemsStartingFromAndIncludingIndexFromArray(l_edit.m_Count - 1, l_edit.m_Index, nullptr, nullptr, l_array);
+                }
+            }
+            Size l_size = l_array.m_Size;
+            DestoryArray(l_array);
+            return l_size;
+        });
+    };
+    BENCHMARK_ADVANCED("GapBuffer")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            GapBuffer<char> l_buffer;
+            CreateGapBufferAtFromArray(l_buffer, p_text);
+            for(const Edit& l_edit : p_trace)
+            {
+                if(l_edit.m_IsAdd)
+                {
+                    AddArrayToGapBufferAtIndex(Array<char>(l_typed, l_edit.m_Count), l_buffer, l_edit.m_Index, nullptr, nullptr);
+                }
+                else
+                {
+                    RemoveNumberOfItemsAtIndexFromGapBuffer(l_edit.m_Count, l_edit.m_Index, nullptr, nullptr, l_buffer);
+                }
+            }
+            Size l_size = FindSizeOfGapBuffer(l_buffer);
+            DestroyGapBuffer(l_buffer);
+            return l_size;
+        });
+    };
+    BENCHMARK_ADVANCED("Rope")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            Rope<char> l_rope;
+            CreateRopeAtFromArray(l_rope, p_text);
+            for(const Edit& l_edit : p_trace)
+            {
+                if(l_edit.m_IsAdd)
+                {
+                    AddArrayToRopeAtIndex(Array<char>(l_typed, l_edit.m_Count), l_rope, l_edit.m_Index, nullptr, nullptr);
+                }
+                else
+                {
+                    RemoveNumberOfItemsAtIndexFromRope(l_edit.m_Count, l_edit.m_Index, nullptr, nullptr, l_rope);
+                }
+            }
+            Size l_size = FindSizeOfRope(l_rope);
+            DestroyRope(l_rope);
+            return l_size;
+        });
+    };
+
+}
+
+TEST_CASE("Edit traces", "[Rope][Benchmark]")
+{
+
+    Array<char> l_text;
+    CreateArrayAtOfCapacity(l_text, g_TEXT_SIZE);
+    for(Size i = 0; i < g_TEXT_SIZE; ++i)
+    {
+        l_text.m_Buffer[i] = 'a' + i % 26;
+    }
+    l_text.m_Size = g_TEXT_SIZE;
+
+    SECTION("Scattered edits")
+    {
+        Array<Edit> l_trace = CreateEditTrace(false);
+        BenchmarkEditTrace(l_text, l_trace);
+        DestoryArray(l_trace);
+    }
+    SECTION("Typing")
+    {
+        Array<Edit> l_trace = CreateEditTrace(true);
+        BenchmarkEditTrace(l_text, l_trace);
+        DestoryArray(l_trace);
+    }
+
+    DestoryArray(l_text);
+
+}
+
+TEST_CASE("Rope splitting and joining", "[Rope][Benchmark]")
+{
+
+    Array<char> l_text;
+    CreateArrayAtOfCapacity(l_text, g_TEXT_SIZE);
+    for(Size i = 0; i < g_TEXT_SIZE; ++i)
+    {
+        l_text.m_Buffer[i] = 'a' + i % 26;
+    }
+    l_text.m_Size = g_TEXT_SIZE;
+    Rope<char> l_rope;
+    CreateRopeAtFromArray(l_rope, l_text);
+
+    //Cutting a piece out of the middle and putting it at the end, the rope
+    //has the same items again after 2 runs.
+    BENCHMARK("Moving a third of the text to the end")
+    {
+        Rope<char> l_middle;
+        Rope<char> l_end;
+        SplitRopeAtIndex(l_rope, g_TEXT_SIZE / 3, l_middle, nullptr, nullptr);
+        SplitRopeAtIndex(l_middle, g_TEXT_SIZE / 3, l_end, nullptr, nullptr);
+        MoveRopeToEndOfRope(l_end, l_rope);
+        MoveRopeToEndOfRope(l_middle, l_rope);
+        return FindSizeOfRope(l_rope);
+    };
+
+    DestroyRope(l_rope);
+    DestoryArray(l_text);
+
+}
@@ -0,0 +1,285 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../Rope.hpp"
+#include "../../Strings/ASCIIString/ASCIIString.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::Rope;
+using namespace Library::DataStructures::Strings;
+using namespace Debugging;
+
+//Checks the sizes and priorities of every node, and returns the height.
+template<typename T>
+static Size CheckRopeNodes(const RopeNode<T>* p_node)
+{
+    if(p_node == nullptr)
+    {
+        return 0;
+    }
+    REQUIRE(p_node->m_Count > 0);
+    REQUIRE(p_node->m_Count <= FindChunkCapacityOfRope<T>());
+    REQUIRE(p_node->m_Size == FindSizeOfRopeNode(p_node->m_Left) + p_node->m_Count + FindSizeOfRopeNode(p_node->m_Right));
+    if(p_node->m_Left != nullptr)
+    {
+        REQUIRE(p_node->m_Left->m_Priority <= p_node->m_Priority);
+    }
+    if(p_node->m_Right != nullptr)
+    {
+        REQUIRE(p_node->m_Right->m_Priority <= p_node->m_Priority);
+    }
+    Size l_left = CheckRopeNodes(p_node->m_Left);
+    Size l_right = CheckRopeNodes(p_node->m_Right);
+    return (l_left > l_right ? l_left : l_right) + 1;
+}
+
+template<typename T>
+static bool IsRopeEqualToItems(const Rope<T>& p_rope, const std::vector<T>& p_items)
+{
+    if(FindSizeOfRope(p_rope) != p_items.size())
+    {
+        return false;
+    }
+    Size l_index = 0;
+    bool l_isEqual = true;
+    ForEachChunkOfRope(p_rope, [&](const Array<T>& p_chunk)
+    {
+        for(Size i = 0; i < p_chunk.m_Size; ++i)
+        {
+            l_isEqual = l_isEqual && p_chunk.m_Buffer[i] == p_items[l_index + i];
+        }
+        l_index += p_chunk.m_Size;
+    });
+    return l_isEqual;
+}
+
+TEST_CASE("Rope creation", "[Rope]")
+{
+
+    Rope<int> l_rope;
+    CHECK(l_rope.m_Root == nullptr);
+    CHECK(FindSizeOfRope(l_rope) == 0);
+
+    SECTION("From an array and back")
+    {
+        Size l_size = GENERATE((Size)0, (Size)1, (Size)256, (Size)257, (Size)10000);
+        std::vector<int> l_items(l_size);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            l_items[i] = (int)i;
+        }
+        CreateRopeAtFromArray(l_rope, Array<int>(l_items.data(), l_size));
+        CHECK(FindSizeOfRope(l_rope) == l_size);
+        CheckRopeNodes(l_rope.m_Root);
+        CHECK(IsRopeEqualToItems(l_rope, l_items));
+        if(l_size > 0)
+        {
+            CHECK(l_rope[l_size / 2] == (int)(l_size / 2));
+            CHECK(l_rope[l_size - 1] == (int)(l_size - 1));
+        }
+
+        Array<int> l_back;
+        CreateArrayAtFromRope(l_back, l_rope);
+        CHECK(l_back.m_Size == l_size);
+        CHECK((l_size == 0 || memcmp(l_back.m_Buffer, l_items.data(), sizeof(int) * l_size) == 0));
+        DestoryArray(l_back);
+    }
+    SECTION("Allocation failure")
+    {
+        int l_items[300] = {};
+        SetCountOfNullMallocAfterCount(1);
+        bool l_called = false;
+        CreateRopeAtFromArrayUsingAllocatorAndDeallocator(
+            l_rope, Array<int>(l_items, 300),
+            NullMallocAfterCount, free,
+            GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(l_rope.m_Root == nullptr);
+    }
+
+    DestroyRope(l_rope);
+    CHECK(l_rope.m_Root == nullptr);
+
+}
+
+TEST_CASE("Rope of ASCII strings", "[Rope]")
+{
+
+    char l_text[] = "Hello world";
+    ASCIIString l_string(Array<char>(l_text, 11));
+
+    Rope<char> l_rope;
+    CreateRopeAtFromArray(l_rope, l_string.m_Array);
+    char l_comma[] = ", big";
+    AddArrayToRopeAtIndex(Array<char>(l_comma, 5), l_rope, 5, nullptr, nullptr);
+
+    ASCIIString l_edited;
+    CreateArrayAtFromRope(l_edited.m_Array, l_rope);
+    REQUIRE(l_edited.m_Array.m_Size == 16);
+    CHECK(memcmp(l_edited.m_Array.m_Buffer, "Hello, big world", 16) == 0);
+
+    DestoryArray(l_edited.m_Array);
+    DestroyRope(l_rope);
+
+}
+
+TEST_CASE("Rope edits", "[Rope]")
+{
+
+    std::vector<int> l_expected(1000);
+    for(Size i = 0; i < l_expected.size(); ++i)
+    {
+        l_expected[i] = (int)i;
+    }
+    Rope<int> l_rope;
+    CreateRopeAtFromArray(l_rope, Array<int>(l_expected.data(), l_expected.size()));
+
+    SECTION("Adding items")
+    {
+        //Small enough for a chunk, then more than any chunk has room for.
+        Size l_count = GENERATE((Size)1, (Size)10, (Size)1000);
+        Size l_index = GENERATE((Size)0, (Size)1, (Size)256, (Size)500, (Size)1000);
+        std::vector<int> l_toAdd(l_count, -1);
+        AddArrayToRopeAtIndex(Array<int>(l_toAdd.data(), l_count), l_rope, l_index, nullptr, nullptr);
+        l_expected.insert(l_expected.begin() + l_index, l_toAdd.begin(), l_toAdd.end());
+        CheckRopeNodes(l_rope.m_Root);
+        CHECK(IsRopeEqualToItems(l_rope, l_expected));
+    }
+    SECTION("Removing items")
+    {
+        Size l_index = GENERATE((Size)0, (Size)100, (Size)256, (Size)999);
+        Size l_count = GENERATE((Size)0, (Size)1, (Size)300);
+        l_count = l_index + l_count > 1000 ? 1000 - l_index : l_count;
+        RemoveNumberOfItemsAtIndexFromRope(l_count, l_index, nullptr, nullptr, l_rope);
+        l_expected.erase(l_expected.begin() + l_index, l_expected.begin() + l_index + l_count);
+        CheckRopeNodes(l_rope.m_Root);
+        CHECK(IsRopeEqualToItems(l_rope, l_expected));
+
+        RemoveNumberOfItemsAtIndexFromRope(FindSizeOfRope(l_rope), 0, nullptr, nullptr, l_rope);
+        CHECK(l_rope.m_Root == nullptr);
+    }
+    SECTION("Splitting and joining")
+    {
+        Size l_index = GENERATE((Size)0, (Size)256, (Size)300, (Size)1000);
+        Rope<int> l_after;
+        SplitRopeAtIndex(l_rope, l_index, l_after, nullptr, nullptr);
+        CheckRopeNodes(l_rope.m_Root);
+        CheckRopeNodes(l_after.m_Root);
+        CHECK(IsRopeEqualToItems(l_rope, std::vector<int>(l_expected.begin(), l_expected.begin() + l_index)));
+        CHECK(IsRopeEqualToItems(l_after, std::vector<int>(l_expected.begin() + l_index, l_expected.end())));
+
+        //Joined the other way around.
+        MoveRopeToEndOfRope(l_rope, l_after);
+        CHECK(l_rope.m_Root == nullptr);
+        CheckRopeNodes(l_after.m_Root);
+        std::vector<int> l_swapped(l_expected.begin() + l_index, l_expected.end());
+        l_swapped.insert(l_swapped.end(), l_expected.begin(), l_expected.begin() + l_index);
+        CHECK(IsRopeEqualToItems(l_after, l_swapped));
+
+        DestroyRope(l_after);
+    }
+    SECTION("Index errors")
+    {
+        bool l_called = false;
+        AddArrayToRopeAtIndex(Array<int>(l_expected.data(), 1), l_rope, 1001, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+
+        l_called = false;
+        RemoveNumberOfItemsAtIndexFromRope(101, 900, GeneralErrorCallback, &l_called, l_rope);
+        CHECK(l_called);
+
+        l_called = false;
+        Rope<int> l_after;
+        SplitRopeAtIndex(l_rope, 1001, l_after, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(l_after.m_Root == nullptr);
+
+        CHECK(IsRopeEqualToItems(l_rope, l_expected));
+    }
+    SECTION("Allocation failure")
+    {
+        std::vector<int> l_toAdd(1000, -1);
+        bool l_called = false;
+        AddArrayToRopeAtIndexUsingAllocatorAndDeallocator(
+            Array<int>(l_toAdd.data(), l_toAdd.size()), l_rope, 300,
+            nullptr, nullptr,
+            NullMalloc, free,
+            GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CheckRopeNodes(l_rope.m_Root);
+        CHECK(IsRopeEqualToItems(l_rope, l_expected));
+
+        l_called = false;
+        Rope<int> l_after;
+        SplitRopeAtIndexUsingAllocator(
+            l_rope, 300, l_after,
+            nullptr, nullptr,
+            NullMalloc, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(l_after.m_Root == nullptr);
+        CHECK(IsRopeEqualToItems(l_rope, l_expected));
+    }
+
+    DestroyRope(l_rope);
+
+}
+
+TEST_CASE("Rope edit trace", "[Rope]")
+{
+
+    Rope<int> l_rope;
+    std::vector<int> l_expected;
+    srand(42);
+
+    int l_items[600];
+    for(int i = 0; i < 3000; ++i)
+    {
+        Size l_size = l_expected.size();
+        Size l_index = rand() % (l_size + 1);
+        int l_edit = rand() % 8;
+        if(l_edit < 5 || l_size == 0)
+        {
+            Size l_count = l_edit == 0 ? rand() % 600 + 1 : rand() % 16 + 1;
+            for(Size n = 0; n < l_count; ++n)
+            {
+                l_items[n] = i;
+            }
+            AddArrayToRopeAtIndex(Array<int>(l_items, l_count), l_rope, l_index, nullptr, nullptr);
+            l_expected.insert(l_expected.begin() + l_index, l_items, l_items + l_count);
+        }
+        else if(l_edit < 7)
+        {
+            Size l_count = rand() % (l_size - l_index < 200 ? l_size - l_index + 1 : 200);
+            RemoveNumberOfItemsAtIndexFromRope(l_count, l_index, nullptr, nullptr, l_rope);
+            l_expected.erase(l_expected.begin() + l_index, l_expected.begin() + l_index + l_count);
+        }
+        else
+        {
+            Rope<int> l_after;
+            SplitRopeAtIndex(l_rope, l_index, l_after, nullptr, nullptr);
+            REQUIRE(FindSizeOfRope(l_rope) == l_index);
+            MoveRopeToEndOfRope(l_after, l_rope);
+        }
+        REQUIRE(FindSizeOfRope(l_rope) == l_expected.size());
+    }
+
+    //A few times log2 of the number of nodes.
+    CHECK(CheckRopeNodes(l_rope.m_Root) < 64);
+    CHECK(IsRopeEqualToItems(l_rope, l_expected));
+    for(Size i = 0; i < l_expected.size(); i += 97)
+    {
+        REQUIRE(l_rope[i] == l_expected[i]);
+    }
+
+    DestroyRope(l_rope);
+
+}
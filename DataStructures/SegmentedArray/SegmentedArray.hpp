@@ -0,0 +1,689 @@
+/** @file SegmentedArray.hpp
+ * @brief Defines everything in the @ref SegmentedArrayMod module.
+ *
+ */
+
+#ifndef SEGMENTED_ARRAY__DATA_STRUCTURES_SEGMENTED_ARRAY_SEGMENTED_ARRAY_HPP
+#define SEGMENTED_ARRAY__DATA_STRUCTURES_SEGMENTED_ARRAY_SEGMENTED_ARRAY_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <type_traits>
+
+namespace Library::DataStructures::SegmentedArray
+{
+
+    /**
+     * @brief The number of bytes a chunk has at most when its number of items
+     * is not given.
+     *
+     * @details Big enough that the directory of chunks stays tiny next to the
+     * items, small enough that adding a chunk takes about as long as adding
+     * a few thousand items.
+     *
+     */
+    constexpr Size g_SEGMENTED_ARRAY_DEFAULT_CHUNK_BYTES = 16 * 1024;
+
+    /**
+     * @brief Returns the biggest power of 2 number of items of T that fit in
+     * @ref g_SEGMENTED_ARRAY_DEFAULT_CHUNK_BYTES, at least 1.
+     *
+     */
+    template<typename T>
+    constexpr Size FindDefaultChunkSizeOfSegmentedArray()
+    {
+        Size l_chunkSize = 1;
+        while(l_chunkSize * 2 * sizeof(T) <= g_SEGMENTED_ARRAY_DEFAULT_CHUNK_BYTES)
+        {
+            l_chunkSize *= 2;
+        }
+        return l_chunkSize;
+    }
+
+    /**
+     * @brief Returns n such that 1 << n is p_chunkSize, which must be a power
+     * of 2.
+     *
+     */
+    constexpr Size FindShiftOfChunkSize(Size p_chunkSize)
+    {
+        Size l_shift = 0;
+        while(((Size)1 << l_shift) < p_chunkSize)
+        {
+            ++l_shift;
+        }
+        return l_shift;
+    }
+
+    /**
+     * @brief An array of items of type T kept in chunks of ChunkSize items,
+     * so that growing it never moves the items already in it.
+     *
+     * @details m_Chunks is the directory, an array of pointers to the chunks
+     * in order. Item i is item i % ChunkSize of chunk i / ChunkSize, since
+     * ChunkSize is a power of 2 that is a shift and a mask. Growing adds
+     * chunks to the end of the directory, so only the directory is ever
+     * reallocated, and pointers to items stay valid until the segmented
+     * array is destroyed.
+     *
+     * The items of a chunk are contiguous, so work that goes over every item
+     * is best done a chunk at a time with @ref ForEachChunkOfArray.
+     *
+     * Items are copy constructed into the chunks, which hold nothing past
+     * m_Size, and like for arrays are never destructed.
+     *
+     * A default constructed segmented array is empty and has no chunks.
+     * Copying one copies the handle only, the same as for arrays.
+     *
+     * @tparam T Must meet the same requirements as for
+     * @ref Library::DataStructures::Array::Array.
+     * @tparam ChunkSize The number of items of each chunk, a power of 2. By
+     * default as many as fit in @ref g_SEGMENTED_ARRAY_DEFAULT_CHUNK_BYTES.
+     *
+     */
+    template<typename T, Size ChunkSize = FindDefaultChunkSizeOfSegmentedArray<T>()>
+    struct SegmentedArray
+    {
+        static_assert(
+            ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+            "The chunk size of a segmented array must be a power of 2."
+        );
+
+        /**
+         * @brief The chunks, each a buffer of ChunkSize items. All but the
+         * ones after item m_Size - 1 are full.
+         *
+         */
+        Array::Array<T*> m_Chunks;
+        /**
+         * @brief The number of items.
+         *
+         */
+        Size m_Size;
+
+        /**
+         * @brief Creates an empty segmented array without chunks.
+         *
+         */
+        SegmentedArray():
+        m_Chunks(),
+        m_Size(0)
+        {
+            LogDebugLine("Constructing segmented array at " << this);
+        }
+
+        /**
+         * @brief Returns item p_index.
+         *
+         * @details If p_index is not less than the capacity the behaviour is
+         * undefined, unless @ref ARRAY_CHECK_INDEXES is 1 in which case the
+         * process is aborted.
+         *
+         */
+        T& operator[] (const Size& p_index)
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(p_index >= m_Chunks.m_Size * ChunkSize)
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in segmented array " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return m_Chunks.m_Buffer[p_index >> FindShiftOfChunkSize(ChunkSize)][p_index & (ChunkSize - 1)];
+        }
+        /**
+         * @brief Returns item p_index, readonly version.
+         *
+         */
+        const T& operator[] (const Size& p_index) const
+        {
+            #if ARRAY_CHECK_INDEXES
+            if(p_index >= m_Chunks.m_Size * ChunkSize)
+            {
+                LogDebugLine("\n------\nError invalid index " << p_index
+                << " in segmented array " << this << ", aborting proccess...\n------\n");
+                abort();
+            }
+            #endif //ARRAY_CHECK_INDEXES
+            return m_Chunks.m_Buffer[p_index >> FindShiftOfChunkSize(ChunkSize)][p_index & (ChunkSize - 1)];
+        }
+    };
+
+    /**
+     * @brief Returns the number of items p_array can hold without adding
+     * chunks.
+     *
+     */
+    template<typename T, Size C>
+    inline Size FindCapacityOfArray(const SegmentedArray<T, C>& p_array)
+    {
+        return p_array.m_Chunks.m_Size * C;
+    }
+
+    /**
+     * @brief Adds a chunk to the end of p_array, allocated by passing null to
+     * p_reallocate.
+     *
+     * @return True if the chunk was added. If allocating the chunk or growing
+     * the directory fails p_realloc_error is called, p_array is not mutated
+     * and false is returned.
+     *
+     */
+    template<typename T, Size C>
+    bool AddChunkToEndOfArrayUsingReallocator(
+        SegmentedArray<T, C>& p_array,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding a chunk to segmented array " << p_array);
+
+        if(C > SIZE_MAX / sizeof(T) || p_array.m_Chunks.m_Size > SIZE_MAX / C - 1)
+        {
+            LogDebugLine("The capacity would overflow, returning.");
+            return false;
+        }
+
+        T* l_chunk = (T*)p_reallocate(nullptr, sizeof(T) * C);
+        if(l_chunk == nullptr)
+        {
+            LogDebugLine("Allocation of the chunk failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return false;
+        }
+
+        Size l_oldChunkCount = p_array.m_Chunks.m_Size;
+        Array::AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            l_chunk, p_array.m_Chunks,
+            Array::ArrayGrowthPolicy::Double,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+        if(p_array.m_Chunks.m_Size == l_oldChunkCount)
+        {
+            LogDebugLine("Growing the directory failed, giving the chunk back.");
+            p_reallocate(l_chunk, 0);
+            return false;
+        }
+
+        return true;
+
+    }
+
+    /**
+     * @brief Makes sure that p_array can hold at least p_capacity items,
+     * adding chunks to its end as needed.
+     *
+     * @details No item is moved. If adding a chunk fails p_realloc_error is
+     * called and the function returns, keeping the chunks that were already
+     * added.
+     *
+     * @param p_array The segmented array to reserve capacity in.
+     * @param p_capacity The number of items it must be able to hold.
+     * @param p_reallocate The reallocator used for the chunks and directory.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     * @time O(c), c being the number of chunks added.
+     *
+     */
+    template<typename T, Size C>
+    void ReserveArrayCapacityUsingReallocator(
+        SegmentedArray<T, C>& p_array,
+        const Size& p_capacity,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reserving a capacity of " << p_capacity << " in segmented "
+        "array " << p_array);
+
+        while(FindCapacityOfArray(p_array) < p_capacity)
+        {
+            if(!AddChunkToEndOfArrayUsingReallocator(p_array, p_reallocate, p_realloc_error, p_realloc_error_data))
+            {
+                return;
+            }
+        }
+
+    }
+    template<typename T, Size C>
+    inline void ReserveArrayCapacity(
+        SegmentedArray<T, C>& p_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for ReserveArrayCapacityUsingReallocator");
+        ReserveArrayCapacityUsingReallocator(
+            p_array, p_capacity,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Creates an empty segmented array at outp_array with room for at
+     * least p_capacity items.
+     *
+     * @details outp_array is overwritten without being destroyed. If adding a
+     * chunk fails p_realloc_error is called and outp_array has fewer chunks.
+     *
+     */
+    template<typename T, Size C>
+    void CreateArrayAtOfCapacityUsingReallocator(
+        SegmentedArray<T, C>& outp_array,
+        const Size& p_capacity,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating segmented array at " << &outp_array << " of "
+        "capacity " << p_capacity);
+
+        outp_array.m_Chunks = Array::Array<T*>();
+        outp_array.m_Size = 0;
+
+        ReserveArrayCapacityUsingReallocator(
+            outp_array, p_capacity,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size C>
+    inline void CreateArrayAtOfCapacity(
+        SegmentedArray<T, C>& outp_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayAtOfCapacityUsingReallocator");
+        CreateArrayAtOfCapacityUsingReallocator(
+            outp_array, p_capacity,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Adds p_item after the last item of p_array, adding a chunk if
+     * p_array is full.
+     *
+     * @details Since no item ever moves p_item may be an item of p_array.
+     *
+     * If adding a chunk fails p_realloc_error is called and p_array is not
+     * mutated.
+     *
+     * @param p_item The item to add.
+     * @param p_array The segmented array to add the item to.
+     * @param p_reallocate The reallocator used for the chunks and directory.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     * @time O(1), or O(log c) amortized when a chunk is added, c being the
+     * number of chunks, for growing the directory.
+     *
+     */
+    template<typename T, Size C>
+    void AddItemToEndOfArrayUsingReallocator(
+        const T& p_item,
+        SegmentedArray<T, C>& p_array,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        if(p_array.m_Size == FindCapacityOfArray(p_array))
+        {
+            LogDebugLine("Segmented array " << p_array << " is full.");
+            if(!AddChunkToEndOfArrayUsingReallocator(p_array, p_reallocate, p_realloc_error, p_realloc_error_data))
+            {
+                return;
+            }
+        }
+
+        //The slot past m_Size does not hold an item.
+        new(&p_array[p_array.m_Size]) T(p_item);
+        ++p_array.m_Size;
+
+    }
+    template<typename T, Size C>
+    inline void AddItemToEndOfArray(
+        const T& p_item,
+        SegmentedArray<T, C>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for AddItemToEndOfArrayUsingReallocator");
+        AddItemToEndOfArrayUsingReallocator(
+            p_item, p_array,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Copies p_count items from p_from to p_to, where no items are
+     * constructed, with memcpy if T is trivially copyable and by copy
+     * constructing them otherwise.
+     *
+     */
+    template<typename T>
+    inline void CopyNumberOfItems(const Size& p_count, const T* p_from, T* p_to)
+    {
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            memcpy((void*)p_to, (const void*)p_from, sizeof(T) * p_count);
+        }
+        else
+        {
+            for(Size i = 0; i < p_count; ++i)
+            {
+                new(p_to + i) T(p_from[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds all of the items of p_to_add after the last item of
+     * p_array, adding chunks as needed.
+     *
+     * @details The items are copied a chunk at a time. If adding a chunk fails
+     * p_realloc_error is called and no item is added, though the chunks that
+     * were added are kept.
+     *
+     * @param p_to_add The array whose items will be added.
+     * @param p_array The segmented array to add the items to.
+     * @param p_reallocate The reallocator used for the chunks and directory.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     * @time O(n), n being p_to_add.m_Size.
+     *
+     */
+    template<typename T, Size C>
+    void AddArrayToEndOfArrayUsingReallocator(
+        const Array::Array<T>& p_to_add,
+        SegmentedArray<T, C>& p_array,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding array " << p_to_add << " to the end of segmented "
+        "array " << p_array);
+
+        if(p_to_add.m_Buffer == nullptr || p_to_add.m_Size == 0)
+        {
+            LogDebugLine("p_to_add is empty, returning.");
+            return;
+        }
+        if(p_array.m_Size + p_to_add.m_Size < p_array.m_Size)
+        {
+            LogDebugLine("The new size overflows, returning.");
+            return;
+        }
+
+        Size l_newSize = p_array.m_Size + p_to_add.m_Size;
+        ReserveArrayCapacityUsingReallocator(
+            p_array, l_newSize,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+        if(FindCapacityOfArray(p_array) < l_newSize)
+        {
+            LogDebugLine("Adding chunks failed, returning.");
+            return;
+        }
+
+        const T* l_from = p_to_add.m_Buffer;
+        for(Size i = p_array.m_Size; i < l_newSize;)
+        {
+            Size l_offset = i & (C - 1);
+            Size l_count = C - l_offset < l_newSize - i ? C - l_offset : l_newSize - i;
+            CopyNumberOfItems(l_count, l_from, p_array.m_Chunks.m_Buffer[i / C] + l_offset);
+            l_from += l_count;
+            i += l_count;
+        }
+        p_array.m_Size = l_newSize;
+
+    }
+    template<typename T, Size C>
+    inline void AddArrayToEndOfArray(
+        const Array::Array<T>& p_to_add,
+        SegmentedArray<T, C>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for AddArrayToEndOfArrayUsingReallocator");
+        AddArrayToEndOfArrayUsingReallocator(
+            p_to_add, p_array,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Calls p_function with an array of the items of each chunk of
+     * p_array that has items, in order.
+     *
+     * @details The array given to p_function has the chunk as its buffer,
+     * the number of items in the chunk as its size and the chunk size as
+     * its capacity. It does not own the chunk and must not be resized or
+     * destroyed, but its items may be changed. Any function of the
+     * @ref ArrayMod module that does not change the capacity can be used on
+     * it, and loops over it see contiguous items.
+     *
+     * @param p_array The segmented array whose chunks to go over.
+     * @param p_function Called with an Array<T>&.
+     *
+     * @time O(c), c being the number of chunks, plus whatever p_function
+     * takes.
+     *
+     */
+    template<typename T, Size C, typename F>
+    void ForEachChunkOfArray(SegmentedArray<T, C>& p_array, F&& p_function)
+    {
+
+        LogDebugLine("Calling a function for each chunk of segmented array " << p_array);
+
+        for(Size i = 0; i < p_array.m_Size; i += C)
+        {
+            Array::Array<T> l_chunk(
+                p_array.m_Chunks.m_Buffer[i / C],
+                p_array.m_Size - i < C ? p_array.m_Size - i : C,
+                C
+            );
+            p_function(l_chunk);
+        }
+
+    }
+    /**
+     * @brief Readonly version, p_function is called with a const Array<T>&.
+     *
+     */
+    template<typename T, Size C, typename F>
+    void ForEachChunkOfArray(const SegmentedArray<T, C>& p_array, F&& p_function)
+    {
+
+        LogDebugLine("Calling a function for each chunk of segmented array " << p_array);
+
+        for(Size i = 0; i < p_array.m_Size; i += C)
+        {
+            const Array::Array<T> l_chunk(
+                p_array.m_Chunks.m_Buffer[i / C],
+                p_array.m_Size - i < C ? p_array.m_Size - i : C,
+                C
+            );
+            p_function(l_chunk);
+        }
+
+    }
+
+    /**
+     * @brief Creates an array at outp_array with a copy of each item of
+     * p_from, in order.
+     *
+     * @details The array's buffer is allocated using p_allocate and has a
+     * capacity of p_from.m_Size, if p_from is empty a null array is created,
+     * see @ref Library::DataStructures::Array::CreateArrayAtOfCapacityUsingAllocator.
+     * If allocation fails p_alloc_error is called and a null array is
+     * created.
+     *
+     * @time O(n), n being p_from.m_Size.
+     *
+     */
+    template<typename T, Size C>
+    void CreateArrayAtFromSegmentedArrayUsingAllocator(
+        Array::Array<T>& outp_array,
+        const SegmentedArray<T, C>& p_from,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating array at " << &outp_array << " from segmented "
+        "array " << p_from);
+
+        Array::CreateArrayAtOfCapacityUsingAllocator(
+            outp_array, p_from.m_Size,
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(outp_array.m_Buffer == nullptr)
+        {
+            LogDebugLine("The array is null, returning.");
+            return;
+        }
+
+        ForEachChunkOfArray(p_from, [&](const Array::Array<T>& p_chunk)
+        {
+            CopyNumberOfItems(p_chunk.m_Size, p_chunk.m_Buffer, outp_array.m_Buffer + outp_array.m_Size);
+            outp_array.m_Size += p_chunk.m_Size;
+        });
+
+    }
+    template<typename T, Size C>
+    inline void CreateArrayAtFromSegmentedArray(
+        Array::Array<T>& outp_array,
+        const SegmentedArray<T, C>& p_from
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayAtFromSegmentedArrayUsingAllocator");
+        CreateArrayAtFromSegmentedArrayUsingAllocator(
+            outp_array, p_from,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Creates a segmented array at outp_array with a copy of each item
+     * of p_from, in order.
+     *
+     * @details outp_array is overwritten without being destroyed. If adding a
+     * chunk fails p_realloc_error is called and outp_array is empty, though
+     * it may have chunks.
+     *
+     * @time O(n), n being p_from.m_Size.
+     *
+     */
+    template<typename T, Size C>
+    void CreateSegmentedArrayAtFromArrayUsingReallocator(
+        SegmentedArray<T, C>& outp_array,
+        const Array::Array<T>& p_from,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating segmented array at " << &outp_array << " from "
+        "array " << p_from);
+
+        outp_array.m_Chunks = Array::Array<T*>();
+        outp_array.m_Size = 0;
+
+        AddArrayToEndOfArrayUsingReallocator(
+            p_from, outp_array,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size C>
+    inline void CreateSegmentedArrayAtFromArray(
+        SegmentedArray<T, C>& outp_array,
+        const Array::Array<T>& p_from
+    )
+    {
+        LogDebugLine("Using defaults for CreateSegmentedArrayAtFromArrayUsingReallocator");
+        CreateSegmentedArrayAtFromArrayUsingReallocator(
+            outp_array, p_from,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Deallocates each chunk of p_array and its directory using
+     * p_deallocate, leaving it empty without chunks.
+     *
+     * @details The items are not destructed, the same as for arrays.
+     *
+     */
+    template<typename T, Size C>
+    void DestroyArrayUsingDeallocator(SegmentedArray<T, C>& p_array, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying segmented array " << p_array);
+
+        for(T* l_chunk : p_array.m_Chunks)
+        {
+            p_deallocate(l_chunk);
+        }
+        Array::DestroyArrayUsingDeallocator(p_array.m_Chunks, p_deallocate);
+        p_array.m_Size = 0;
+
+    }
+    template<typename T, Size C>
+    inline void DestroyArray(SegmentedArray<T, C>& p_array)
+    {
+        LogDebugLine("Using defaults for DestroyArrayUsingDeallocator");
+        DestroyArrayUsingDeallocator(p_array, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+
+    #ifdef DEBUG
+    /**
+     * @brief Logs the fields of p_array, its items are not logged.
+     *
+     */
+    template<typename T, Size C>
+    const Debugging::Log& operator<< (const Debugging::Log& p_log, const SegmentedArray<T, C>& p_array)
+    {
+
+        p_log << &p_array;
+        p_log << " { m_Chunks = " << p_array.m_Chunks;
+        p_log << ", m_Size = " << p_array.m_Size;
+        p_log << ", chunk size = " << C;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+}
+
+#endif //SEGMENTED_ARRAY__DATA_STRUCTURES_SEGMENTED_ARRAY_SEGMENTED_ARRAY_HPP
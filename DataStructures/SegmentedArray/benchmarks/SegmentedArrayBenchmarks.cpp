@@ -0,0 +1,116 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <chrono>
+
+#include "../SegmentedArray.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::SegmentedArray;
+
+//64MiB of ints, well past the size of any cache.
+static const Size g_INGEST_SIZE = 16 * 1024 * 1024;
+
+TEST_CASE("Ingesting items one at a time", "[SegmentedArray][Benchmark]")
+{
+
+    BENCHMARK_ADVANCED("Array")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            Array<int> l_array;
+            for(Size i = 0; i < g_INGEST_SIZE; ++i)
+            {
+                AddItemToEndOfArray((int)i, l_array);
+            }
+            int l_last = l_array.m_Buffer[g_INGEST_SIZE - 1];
+            DestoryArray(l_array);
+            return l_last;
+        });
+    };
+    BENCHMARK_ADVANCED("SegmentedArray")(Catch::Benchmark::Chronometer p_meter)
+    {
+        p_meter.measure([&]
+        {
+            SegmentedArray<int> l_array;
+            for(Size i = 0; i < g_INGEST_SIZE; ++i)
+            {
+                AddItemToEndOfArray((int)i, l_array);
+            }
+            int l_last = l_array[g_INGEST_SIZE - 1];
+            DestroyArray(l_array);
+            return l_last;
+        });
+    };
+
+    //The slowest single add is when an array copies all of its items.
+    auto l_findSlowestAdd = [](auto& p_array)
+    {
+        using Clock = std::chrono::steady_clock;
+        Clock::duration l_slowest = Clock::duration::zero();
+        for(Size i = 0; i < g_INGEST_SIZE; ++i)
+        {
+            Clock::time_point l_start = Clock::now();
+            AddItemToEndOfArray((int)i, p_array);
+            Clock::duration l_took = Clock::now() - l_start;
+            l_slowest = l_took > l_slowest ? l_took : l_slowest;
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(l_slowest).count();
+    };
+    Array<int> l_array;
+    SegmentedArray<int> l_segmentedArray;
+    WARN("Slowest add to an Array: " << l_findSlowestAdd(l_array) << " us");
+    WARN("Slowest add to a SegmentedArray: " << l_findSlowestAdd(l_segmentedArray) << " us");
+    DestroyArray(l_segmentedArray);
+    DestoryArray(l_array);
+
+}
+
+TEST_CASE("Summing items", "[SegmentedArray][Benchmark]")
+{
+
+    SegmentedArray<int> l_array;
+    for(Size i = 0; i < g_INGEST_SIZE; ++i)
+    {
+        AddItemToEndOfArray((int)(i % 1000), l_array);
+    }
+    Array<int> l_contiguous;
+    CreateArrayAtFromSegmentedArray(l_contiguous, l_array);
+
+    BENCHMARK("Array")
+    {
+        int l_sum = 0;
+        for(int l_item : l_contiguous)
+        {
+            l_sum += l_item;
+        }
+        return l_sum;
+    };
+    BENCHMARK("SegmentedArray, by index")
+    {
+        int l_sum = 0;
+        for(Size i = 0; i < l_array.m_Size; ++i)
+        {
+            l_sum += l_array[i];
+        }
+        return l_sum;
+    };
+    BENCHMARK("SegmentedArray, chunk by chunk")
+    {
+        int l_sum = 0;
+        ForEachChunkOfArray(l_array, [&](const Array<int>& p_chunk)
+        {
+            for(int l_item : p_chunk)
+            {
+                l_sum += l_item;
+            }
+        });
+        return l_sum;
+    };
+
+    DestoryArray(l_contiguous);
+    DestroyArray(l_array);
+
+}
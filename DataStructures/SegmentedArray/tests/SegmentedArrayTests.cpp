@@ -0,0 +1,259 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../SegmentedArray.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::SegmentedArray;
+using namespace Debugging;
+
+TEST_CASE("Segmented array default chunk size", "[SegmentedArray]")
+{
+
+    CHECK(FindDefaultChunkSizeOfSegmentedArray<char>() == g_SEGMENTED_ARRAY_DEFAULT_CHUNK_BYTES);
+    CHECK(FindDefaultChunkSizeOfSegmentedArray<int>() == g_SEGMENTED_ARRAY_DEFAULT_CHUNK_BYTES / sizeof(int));
+    //Not a power of 2 in size.
+    struct Item { char m_Bytes[24]; };
+    CHECK(FindDefaultChunkSizeOfSegmentedArray<Item>() == 512);
+    struct Huge { char m_Bytes[100000]; };
+    CHECK(FindDefaultChunkSizeOfSegmentedArray<Huge>() == 1);
+
+}
+
+TEST_CASE("Segmented array creation and growth", "[SegmentedArray]")
+{
+
+    SegmentedArray<int, 8> l_array;
+    REQUIRE(l_array.m_Size == 0);
+    REQUIRE(FindCapacityOfArray(l_array) == 0);
+
+    SECTION("Creating with a capacity")
+    {
+        Size l_capacity = GENERATE((Size)0, (Size)1, (Size)8, (Size)9, (Size)100);
+        CreateArrayAtOfCapacity(l_array, l_capacity);
+        CHECK(l_array.m_Size == 0);
+        CHECK(FindCapacityOfArray(l_array) >= l_capacity);
+        CHECK(FindCapacityOfArray(l_array) < l_capacity + 8);
+    }
+    SECTION("Adding items never moves them")
+    {
+        AddItemToEndOfArray(0, l_array);
+        int* l_first = &l_array[0];
+        for(int i = 1; i < 1000; ++i)
+        {
+            AddItemToEndOfArray(i, l_array);
+        }
+        REQUIRE(l_array.m_Size == 1000);
+        CHECK(&l_array[0] == l_first);
+        CHECK(FindCapacityOfArray(l_array) == 1000);
+        for(int i = 0; i < 1000; ++i)
+        {
+            REQUIRE(l_array[i] == i);
+        }
+
+        //An item of the array itself, while it is full.
+        AddItemToEndOfArray(l_array[3], l_array);
+        REQUIRE(l_array.m_Size == 1001);
+        CHECK(l_array[1000] == 3);
+    }
+    SECTION("Allocation failure")
+    {
+        AddItemToEndOfArray(1, l_array);
+
+        bool l_called = false;
+        ReserveArrayCapacityUsingReallocator(l_array, 100, NullRealloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(FindCapacityOfArray(l_array) == 8);
+
+        for(int i = 2; i <= 8; ++i)
+        {
+            AddItemToEndOfArray(i, l_array);
+        }
+        l_called = false;
+        AddItemToEndOfArrayUsingReallocator(9, l_array, NullRealloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        REQUIRE(l_array.m_Size == 8);
+        CHECK(l_array[7] == 8);
+    }
+
+    DestroyArray(l_array);
+    CHECK(l_array.m_Size == 0);
+    CHECK(l_array.m_Chunks.m_Buffer == nullptr);
+
+}
+
+TEST_CASE("Segmented array chunks and conversion", "[SegmentedArray]")
+{
+
+    Size l_size = GENERATE((Size)0, (Size)1, (Size)15, (Size)16, (Size)17, (Size)100);
+    Size l_existing = GENERATE((Size)0, (Size)5);
+
+    Array<long> l_items;
+    CreateArrayAtOfCapacity(l_items, l_size + 1);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_items.m_Buffer[l_items.m_Size++] = (long)(i * 3);
+    }
+
+    SegmentedArray<long, 16> l_array;
+    for(Size i = 0; i < l_existing; ++i)
+    {
+        AddItemToEndOfArray(-1L, l_array);
+    }
+
+    AddArrayToEndOfArray(l_items, l_array);
+    REQUIRE(l_array.m_Size == l_existing + l_size);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        REQUIRE(l_array[l_existing + i] == (long)(i * 3));
+    }
+
+    SECTION("Chunk by chunk")
+    {
+        Size l_seen = 0;
+        Size l_chunks = 0;
+        ForEachChunkOfArray(l_array, [&](Array<long>& p_chunk)
+        {
+            CHECK(p_chunk.m_Capacity == 16);
+            CHECK(p_chunk.m_Size <= 16);
+            CHECK(p_chunk.m_Buffer == &l_array[l_seen]);
+            for(long& l_item : p_chunk)
+            {
+                l_item += 1;
+            }
+            l_seen += p_chunk.m_Size;
+            ++l_chunks;
+        });
+        CHECK(l_seen == l_array.m_Size);
+        CHECK(l_chunks == (l_array.m_Size + 15) / 16);
+        if(l_size > 0)
+        {
+            CHECK(l_array[l_existing + l_size - 1] == (long)((l_size - 1) * 3 + 1));
+        }
+    }
+    SECTION("To an array")
+    {
+        Array<long> l_copy;
+        CreateArrayAtFromSegmentedArray(l_copy, l_array);
+        REQUIRE(l_copy.m_Size == l_array.m_Size);
+        for(Size i = 0; i < l_copy.m_Size; ++i)
+        {
+            REQUIRE(l_copy.m_Buffer[i] == l_array[i]);
+        }
+        DestoryArray(l_copy);
+    }
+    SECTION("From an array")
+    {
+        SegmentedArray<long, 16> l_copy;
+        CreateSegmentedArrayAtFromArray(l_copy, l_items);
+        REQUIRE(l_copy.m_Size == l_size);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            REQUIRE(l_copy[i] == l_items.m_Buffer[i]);
+        }
+        DestroyArray(l_copy);
+    }
+    SECTION("Allocation failure")
+    {
+        bool l_called = false;
+        Array<long> l_copy;
+        CreateArrayAtFromSegmentedArrayUsingAllocator(l_copy, l_array, NullMalloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called == (l_array.m_Size > 0));
+        CHECK(l_copy.m_Buffer == nullptr);
+
+        l_called = false;
+        Size l_oldSize = l_array.m_Size;
+        Size l_needsChunks = FindCapacityOfArray(l_array) - l_array.m_Size < l_size;
+        AddArrayToEndOfArrayUsingReallocator(l_items, l_array, NullRealloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called == (l_size > 0 && l_needsChunks));
+        CHECK(l_array.m_Size == (l_called ? l_oldSize : l_oldSize + l_size));
+    }
+
+    DestroyArray(l_array);
+    DestoryArray(l_items);
+
+}
+
+TEST_CASE("Segmented array of items that are not trivially copyable", "[SegmentedArray]")
+{
+
+    Array<Array<int>> l_items;
+    CreateArrayAtOfCapacity(l_items, 10);
+    int l_values[10];
+    for(int i = 0; i < 10; ++i)
+    {
+        l_values[i] = i;
+        l_items.m_Buffer[l_items.m_Size++] = Array<int>(l_values + i, 1);
+    }
+
+    SegmentedArray<Array<int>, 4> l_array;
+    CreateSegmentedArrayAtFromArray(l_array, l_items);
+    REQUIRE(l_array.m_Size == 10);
+    for(Size i = 0; i < 10; ++i)
+    {
+        CHECK(l_array[i].m_Buffer == l_values + i);
+    }
+
+    DestroyArray(l_array);
+    DestoryArray(l_items);
+
+}
+
+//Counts how many times an item was copy assigned.
+struct CopyCountedItem
+{
+    static Size s_Copies;
+    int m_Value;
+
+    CopyCountedItem(int p_value): m_Value(p_value) {}
+    CopyCountedItem(const CopyCountedItem& p_other) = default;
+    CopyCountedItem& operator= (const CopyCountedItem& p_other)
+    {
+        ++s_Copies;
+        m_Value = p_other.m_Value;
+        return *this;
+    }
+};
+Size CopyCountedItem::s_Copies = 0;
+
+TEST_CASE("Segmented array items are constructed in new chunks", "[SegmentedArray]")
+{
+
+    Array<CopyCountedItem> l_items;
+    CreateArrayAtOfCapacity(l_items, 10);
+    for(int i = 0; i < 10; ++i)
+    {
+        new(l_items.m_Buffer + i) CopyCountedItem(i);
+    }
+    l_items.m_Size = 10;
+
+    CopyCountedItem::s_Copies = 0;
+
+    SegmentedArray<CopyCountedItem, 4> l_array;
+    for(int i = 0; i < 10; ++i)
+    {
+        AddItemToEndOfArray(CopyCountedItem(i), l_array);
+    }
+    AddArrayToEndOfArray(l_items, l_array);
+    REQUIRE(l_array.m_Size == 20);
+
+    Array<CopyCountedItem> l_copy;
+    CreateArrayAtFromSegmentedArray(l_copy, l_array);
+    REQUIRE(l_copy.m_Size == 20);
+
+    CHECK(CopyCountedItem::s_Copies == 0);
+    for(Size i = 0; i < 20; ++i)
+    {
+        CHECK(l_array[i].m_Value == (int)(i % 10));
+        CHECK(l_copy.m_Buffer[i].m_Value == (int)(i % 10));
+    }
+
+    DestoryArray(l_copy);
+    DestroyArray(l_array);
+    DestoryArray(l_items);
+
+}
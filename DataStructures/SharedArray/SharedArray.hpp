@@ -0,0 +1,459 @@
+/** @file SharedArray.hpp
+ * @brief Defines everything in the @ref SharedArrayMod module.
+ *
+ */
+
+#ifndef SHARED_ARRAY__DATA_STRUCTURES_SHARED_ARRAY_SHARED_ARRAY_HPP
+#define SHARED_ARRAY__DATA_STRUCTURES_SHARED_ARRAY_SHARED_ARRAY_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+#include <atomic>
+#include <new>
+
+namespace Library::DataStructures::SharedArray
+{
+
+    /**
+     * @brief Kept next to the items of a shared array, counts the shared
+     * arrays that use them.
+     *
+     */
+    struct SharedArrayHeader
+    {
+        /**
+         * @brief The number of shared arrays using the items, never 0 while
+         * the header exists.
+         *
+         */
+        std::atomic<Size> m_References;
+    };
+
+    /**
+     * @brief An array whose items can be used by many shared arrays at once
+     * without being copied, until one of them changes them.
+     *
+     * @details Every shared array using the same items has the same m_Header
+     * and m_Array. Sharing, see @ref CreateShareAtOfSharedArrayUsingAllocator,
+     * only adds 1 to the reference count, and destroying a shared array only
+     * takes 1 from it, the items are deallocated by whichever destroys the
+     * last one.
+     *
+     * m_Array can be passed to any function of the @ref ArrayMod module that
+     * does not change it. Before changing it, or any of its items, call
+     * @ref MakeSharedArrayUniqueUsingAllocatorAndDeallocator, which copies
+     * the items the first time if others use them too. After that m_Array
+     * can be changed like any array, until the shared array is shared again.
+     *
+     * The reference count is atomic, so shared arrays using the same items
+     * can be shared, made unique and destroyed on different threads. A single
+     * shared array must not be used by more than one thread at a time, the
+     * same as for arrays.
+     *
+     * A default constructed shared array is null, it has neither a header
+     * nor items.
+     *
+     * @tparam T Must meet the same requirements as for
+     * @ref Library::DataStructures::Array::Array.
+     *
+     */
+    template<typename T>
+    struct SharedArray
+    {
+        /**
+         * @brief The reference count of the items, null for a null shared
+         * array and for one given items without being made unique until it
+         * is first shared.
+         *
+         */
+        SharedArrayHeader* m_Header;
+        /**
+         * @brief The items, shared with every other shared array that has the
+         * same m_Header.
+         *
+         */
+        Array::Array<T> m_Array;
+
+        /**
+         * @brief Creates a null shared array.
+         *
+         */
+        SharedArray():
+        m_Header(nullptr),
+        m_Array()
+        {
+            LogDebugLine("Constructing shared array at " << this);
+        }
+    };
+
+    /**
+     * @brief Returns the number of shared arrays using the items of p_array,
+     * 0 for a null shared array.
+     *
+     * @details When other threads share or destroy shared arrays using the
+     * same items the result may be out of date by the time it is returned.
+     *
+     */
+    template<typename T>
+    inline Size FindNumberOfSharesOfSharedArray(const SharedArray<T>& p_array)
+    {
+        if(p_array.m_Header == nullptr)
+        {
+            return 0;
+        }
+        return p_array.m_Header->m_References.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns true if no other shared array uses the items of
+     * p_array, which is then safe to change.
+     *
+     * @details A shared array that is unique stays so until it is shared,
+     * no matter what other threads do.
+     *
+     */
+    template<typename T>
+    inline bool SharedArrayIsUnique(const SharedArray<T>& p_array)
+    {
+        return FindNumberOfSharesOfSharedArray(p_array) <= 1;
+    }
+
+    /**
+     * @brief Allocates a header with a reference count of 1 using
+     * p_allocate.
+     *
+     * @return The header, or null if allocation failed in which case
+     * p_alloc_error is called.
+     *
+     */
+    inline SharedArrayHeader* CreateSharedArrayHeaderUsingAllocator(
+        Allocator p_allocate, Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        void* l_memory = p_allocate(sizeof(SharedArrayHeader));
+        if(l_memory == nullptr)
+        {
+            LogDebugLine("Allocation of the shared array header failed.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return nullptr;
+        }
+
+        SharedArrayHeader* l_header = new(l_memory) SharedArrayHeader;
+        l_header->m_References.store(1, std::memory_order_relaxed);
+        return l_header;
+
+    }
+
+    /**
+     * @brief Creates a shared array at outp_array that takes p_array,
+     * without copying its items.
+     *
+     * @details Only the header is allocated, using p_allocate. p_array is
+     * set to a null array, its buffer is now owned by outp_array and has to
+     * have been allocated the way the deallocator later passed to
+     * @ref DestroySharedArrayUsingDeallocator expects.
+     *
+     * If allocating the header fails p_alloc_error is called, a null shared
+     * array is created at outp_array and p_array is not mutated.
+     *
+     * @time O(1).
+     *
+     */
+    template<typename T>
+    void CreateSharedArrayAtOfArrayUsingAllocator(
+        SharedArray<T>& outp_array,
+        Array::Array<T>& p_array,
+        Allocator p_allocate, Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating shared array at " << &outp_array << " of array "
+        << p_array);
+
+        outp_array = SharedArray<T>();
+
+        SharedArrayHeader* l_header = CreateSharedArrayHeaderUsingAllocator(
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(l_header == nullptr)
+        {
+            LogDebugLine("Returning after unsuccessful allocation.");
+            return;
+        }
+
+        outp_array.m_Header = l_header;
+        outp_array.m_Array = p_array;
+        p_array = Array::Array<T>();
+
+    }
+    /**
+     * @brief Default allocator, callback and data.
+     *
+     */
+    template<typename T>
+    inline void CreateSharedArrayAtOfArray(
+        SharedArray<T>& outp_array,
+        Array::Array<T>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for CreateSharedArrayAtOfArrayUsingAllocator");
+        CreateSharedArrayAtOfArrayUsingAllocator(
+            outp_array, p_array,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Creates a shared array at outp_array that uses the same items as
+     * p_array.
+     *
+     * @details Nothing is copied, the reference count is increased by 1. If
+     * p_array has no header but has items, which happens when items are
+     * added to a null shared array without making it unique, a header is
+     * first allocated for it using p_allocate. If p_array has neither, so
+     * is outp_array.
+     *
+     * If allocating the header fails p_alloc_error is called, a null shared
+     * array is created at outp_array and p_array is not mutated.
+     *
+     * @time O(1).
+     *
+     */
+    template<typename T>
+    void CreateShareAtOfSharedArrayUsingAllocator(
+        SharedArray<T>& outp_array,
+        SharedArray<T>& p_array,
+        Allocator p_allocate, Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Sharing shared array " << p_array << " at " << &outp_array);
+
+        if(p_array.m_Header == nullptr && p_array.m_Array.m_Buffer != nullptr)
+        {
+            //Without a header both would deallocate the items.
+            LogDebugLine("The shared array has items but no header, creating one.");
+            p_array.m_Header = CreateSharedArrayHeaderUsingAllocator(
+                p_allocate, p_alloc_error, p_alloc_error_data
+            );
+            if(p_array.m_Header == nullptr)
+            {
+                LogDebugLine("Returning after unsuccessful allocation.");
+                outp_array = SharedArray<T>();
+                return;
+            }
+        }
+
+        if(p_array.m_Header != nullptr)
+        {
+            //Whoever shares the items already holds a reference, so they
+            //cannot be destroyed meanwhile and no ordering is needed.
+            p_array.m_Header->m_References.fetch_add(1, std::memory_order_relaxed);
+        }
+        outp_array.m_Header = p_array.m_Header;
+        outp_array.m_Array = p_array.m_Array;
+
+    }
+    /**
+     * @brief Default allocator, callback and data.
+     *
+     */
+    template<typename T>
+    inline void CreateShareAtOfSharedArray(
+        SharedArray<T>& outp_array,
+        SharedArray<T>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for CreateShareAtOfSharedArrayUsingAllocator");
+        CreateShareAtOfSharedArrayUsingAllocator(
+            outp_array, p_array,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Makes sure no other shared array uses the items of p_array,
+     * copying them if any does.
+     *
+     * @details If p_array is unique nothing is done. Otherwise a new header
+     * and buffer of the same capacity are allocated using p_allocate, the
+     * items are copied into the buffer and p_array lets go of the old ones.
+     * If all others let go of them meanwhile, the old buffer and header are
+     * deallocated using p_deallocate.
+     *
+     * A null shared array gets a header, so it can be shared after items are
+     * added to it.
+     *
+     * If allocation fails p_alloc_error is called, p_array is not mutated
+     * and false is returned.
+     *
+     * @time O(1) if p_array is unique, O(n) otherwise, n being the number of
+     * items.
+     *
+     * @return True if p_array is now unique and m_Array can be changed.
+     *
+     */
+    template<typename T>
+    bool MakeSharedArrayUniqueUsingAllocatorAndDeallocator(
+        SharedArray<T>& p_array,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Making shared array " << p_array << " unique");
+
+        if(p_array.m_Header == nullptr)
+        {
+            LogDebugLine("The shared array is null, creating a header.");
+            p_array.m_Header = CreateSharedArrayHeaderUsingAllocator(
+                p_allocate, p_alloc_error, p_alloc_error_data
+            );
+            return p_array.m_Header != nullptr;
+        }
+
+        //Acquire so that changes after this do not race with reads by the
+        //shared arrays that let go of the items before.
+        if(p_array.m_Header->m_References.load(std::memory_order_acquire) == 1)
+        {
+            LogDebugLine("The shared array is already unique.");
+            return true;
+        }
+
+        LogDebugLine("The items are shared, copying them.");
+
+        Array::Array<T> l_copy;
+        if(p_array.m_Array.m_Capacity > 0)
+        {
+            Array::CreateArrayAtOfCapacityUsingAllocator(
+                l_copy, p_array.m_Array.m_Capacity,
+                p_allocate, p_alloc_error, p_alloc_error_data
+            );
+            if(l_copy.m_Buffer == nullptr)
+            {
+                LogDebugLine("Returning after unsuccessful allocation.");
+                return false;
+            }
+            //Nothing is constructed in the new buffer.
+            for(Size i = 0; i < p_array.m_Array.m_Size; ++i)
+            {
+                new(l_copy.m_Buffer + i) T(p_array.m_Array.m_Buffer[i]);
+            }
+            l_copy.m_Size = p_array.m_Array.m_Size;
+        }
+
+        SharedArrayHeader* l_header = CreateSharedArrayHeaderUsingAllocator(
+            p_allocate, p_alloc_error, p_alloc_error_data
+        );
+        if(l_header == nullptr)
+        {
+            LogDebugLine("Returning after unsuccessful allocation.");
+            Array::DestroyArrayUsingDeallocator(l_copy, p_deallocate);
+            return false;
+        }
+
+        if(p_array.m_Header->m_References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            LogDebugLine("The others let go of the items meanwhile, deallocating them.");
+            Array::DestroyArrayUsingDeallocator(p_array.m_Array, p_deallocate);
+            p_array.m_Header->~SharedArrayHeader();
+            p_deallocate(p_array.m_Header);
+        }
+
+        p_array.m_Header = l_header;
+        p_array.m_Array = l_copy;
+        return true;
+
+    }
+    /**
+     * @brief Default allocator, deallocator, callback and data.
+     *
+     */
+    template<typename T>
+    inline bool MakeSharedArrayUnique(SharedArray<T>& p_array)
+    {
+        LogDebugLine("Using defaults for MakeSharedArrayUniqueUsingAllocatorAndDeallocator");
+        return MakeSharedArrayUniqueUsingAllocatorAndDeallocator(
+            p_array,
+            Library::g_DEFAULT_ALLOCATOR, Library::g_DEFAULT_DEALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Lets go of the items of p_array, deallocating them and the
+     * header using p_deallocate if no other shared array uses them, and sets
+     * p_array to a null shared array.
+     *
+     * @details The items are not destructed, the same as for arrays.
+     *
+     */
+    template<typename T>
+    void DestroySharedArrayUsingDeallocator(SharedArray<T>& p_array, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying shared array " << p_array);
+
+        if(p_array.m_Header != nullptr)
+        {
+            //Release so that reads of the items happen before whoever
+            //deallocates them, acquire for when that is this one.
+            if(p_array.m_Header->m_References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                LogDebugLine("This was the last one, deallocating the items.");
+                Array::DestroyArrayUsingDeallocator(p_array.m_Array, p_deallocate);
+                p_array.m_Header->~SharedArrayHeader();
+                p_deallocate(p_array.m_Header);
+            }
+        }
+        else
+        {
+            //Items added to a null shared array without making it unique
+            //are owned by it alone.
+            Array::DestroyArrayUsingDeallocator(p_array.m_Array, p_deallocate);
+        }
+
+        p_array = SharedArray<T>();
+
+    }
+    template<typename T>
+    inline void DestroySharedArray(SharedArray<T>& p_array)
+    {
+        LogDebugLine("Using defaults for DestroySharedArrayUsingDeallocator");
+        DestroySharedArrayUsingDeallocator(p_array, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+
+    #ifdef DEBUG
+    /**
+     * @brief Logs the fields of p_array and its reference count, its items
+     * are not logged.
+     *
+     */
+    template<typename T>
+    const Debugging::Log& operator<< (const Debugging::Log& p_log, const SharedArray<T>& p_array)
+    {
+
+        p_log << &p_array;
+        p_log << " { m_Header = " << (void*)p_array.m_Header;
+        p_log << ", m_Array = " << p_array.m_Array;
+        p_log << ", references = " << FindNumberOfSharesOfSharedArray(p_array);
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+}
+
+#endif //SHARED_ARRAY__DATA_STRUCTURES_SHARED_ARRAY_SHARED_ARRAY_HPP
@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -O2 -std=c++17 -o SharedArrayBenchmarks.bench ../../../Meta/Meta.cpp -pthread *.cpp
\ No newline at end of file
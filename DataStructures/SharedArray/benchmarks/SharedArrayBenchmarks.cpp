@@ -0,0 +1,80 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include "../SharedArray.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::SharedArray;
+
+//The size of the buffer passed along, 16MiB of chars.
+static const Size g_BUFFER_SIZE = 16 * 1024 * 1024;
+static const Size g_STAGE_COUNT = 8;
+
+//Each stage only reads the buffer, it looks at a few of its items.
+static Size ReadStage(const Array<char>& p_buffer, Size p_stage)
+{
+    return p_buffer.m_Buffer[p_stage * 4096] + p_buffer.m_Size;
+}
+
+TEST_CASE("Passing a buffer between stages", "[SharedArray][Benchmark]")
+{
+
+    Array<char> l_items;
+    CreateArrayAtOfCapacity(l_items, g_BUFFER_SIZE);
+    for(Size i = 0; i < g_BUFFER_SIZE; ++i)
+    {
+        l_items.m_Buffer[i] = 'a' + i % 26;
+    }
+    l_items.m_Size = g_BUFFER_SIZE;
+
+    BENCHMARK("Copying for each stage")
+    {
+        Size l_result = 0;
+        for(Size i = 0; i < g_STAGE_COUNT; ++i)
+        {
+            Array<char> l_copy;
+            CreateCopyAtOfArray(l_copy, l_items);
+            l_result += ReadStage(l_copy, i);
+            DestoryArray(l_copy);
+        }
+        return l_result;
+    };
+
+    SharedArray<char> l_array;
+    CreateSharedArrayAtOfArray(l_array, l_items);
+
+    BENCHMARK("Sharing with each stage")
+    {
+        Size l_result = 0;
+        for(Size i = 0; i < g_STAGE_COUNT; ++i)
+        {
+            SharedArray<char> l_share;
+            CreateShareAtOfSharedArray(l_share, l_array);
+            l_result += ReadStage(l_share.m_Array, i);
+            DestroySharedArray(l_share);
+        }
+        return l_result;
+    };
+    //Only the last stage changes the buffer, so only it copies.
+    BENCHMARK("Sharing with each stage, the last one writing")
+    {
+        Size l_result = 0;
+        for(Size i = 0; i < g_STAGE_COUNT; ++i)
+        {
+            SharedArray<char> l_share;
+            CreateShareAtOfSharedArray(l_share, l_array);
+            if(i == g_STAGE_COUNT - 1 && MakeSharedArrayUnique(l_share))
+            {
+                l_share.m_Array.m_Buffer[0] = 'z';
+            }
+            l_result += ReadStage(l_share.m_Array, i);
+            DestroySharedArray(l_share);
+        }
+        return l_result;
+    };
+
+    DestroySharedArray(l_array);
+
+}
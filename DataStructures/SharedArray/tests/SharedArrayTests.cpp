@@ -0,0 +1,281 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "../SharedArray.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::SharedArray;
+using namespace Debugging;
+
+static Array<int> CreateArrayOfCount(Size p_count)
+{
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, p_count);
+    for(Size i = 0; i < p_count; ++i)
+    {
+        l_array.m_Buffer[i] = (int)i;
+    }
+    l_array.m_Size = p_count;
+    return l_array;
+}
+
+TEST_CASE("Shared array creation", "[SharedArray]")
+{
+
+    SECTION("Null shared array")
+    {
+        SharedArray<int> l_array;
+        CHECK(l_array.m_Header == nullptr);
+        CHECK(l_array.m_Array.m_Buffer == nullptr);
+        CHECK(FindNumberOfSharesOfSharedArray(l_array) == 0);
+        CHECK(SharedArrayIsUnique(l_array));
+
+        SharedArray<int> l_share;
+        CreateShareAtOfSharedArray(l_share, l_array);
+        CHECK(l_share.m_Header == nullptr);
+
+        DestroySharedArray(l_array);
+    }
+    SECTION("Of an array")
+    {
+        Array<int> l_items = CreateArrayOfCount(10);
+        int* l_buffer = l_items.m_Buffer;
+
+        SharedArray<int> l_array;
+        CreateSharedArrayAtOfArray(l_array, l_items);
+        CHECK(l_items.m_Buffer == nullptr);
+        CHECK(l_array.m_Array.m_Buffer == l_buffer);
+        CHECK(l_array.m_Array.m_Size == 10);
+        CHECK(FindNumberOfSharesOfSharedArray(l_array) == 1);
+
+        DestroySharedArray(l_array);
+        CHECK(l_array.m_Header == nullptr);
+        CHECK(l_array.m_Array.m_Buffer == nullptr);
+    }
+    SECTION("Allocation failure")
+    {
+        Array<int> l_items = CreateArrayOfCount(10);
+        int* l_buffer = l_items.m_Buffer;
+
+        bool l_called = false;
+        SharedArray<int> l_array;
+        CreateSharedArrayAtOfArrayUsingAllocator(l_array, l_items, NullMalloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(l_array.m_Header == nullptr);
+        CHECK(l_items.m_Buffer == l_buffer);
+
+        DestoryArray(l_items);
+    }
+
+}
+
+TEST_CASE("Shared array sharing and copying on write", "[SharedArray]")
+{
+
+    Array<int> l_items = CreateArrayOfCount(10);
+    int* l_buffer = l_items.m_Buffer;
+    SharedArray<int> l_array;
+    CreateSharedArrayAtOfArray(l_array, l_items);
+
+    SharedArray<int> l_share;
+    CreateShareAtOfSharedArray(l_share, l_array);
+    CHECK(l_share.m_Array.m_Buffer == l_buffer);
+    CHECK(FindNumberOfSharesOfSharedArray(l_array) == 2);
+    CHECK_FALSE(SharedArrayIsUnique(l_share));
+
+    SECTION("The first change copies")
+    {
+        REQUIRE(MakeSharedArrayUnique(l_share));
+        CHECK(l_share.m_Array.m_Buffer != l_buffer);
+        CHECK(l_share.m_Array == l_array.m_Array);
+        CHECK(l_share.m_Array.m_Capacity == l_array.m_Array.m_Capacity);
+        CHECK(SharedArrayIsUnique(l_share));
+        CHECK(SharedArrayIsUnique(l_array));
+
+        l_share.m_Array[0] = 100;
+        AddItemToEndOfArray(11, l_share.m_Array);
+        CHECK(l_array.m_Array.m_Buffer[0] == 0);
+        CHECK(l_array.m_Array.m_Size == 10);
+        CHECK(l_share.m_Array.m_Size == 11);
+
+        //The others are unique now, so nothing more is copied.
+        int* l_copied = l_share.m_Array.m_Buffer;
+        REQUIRE(MakeSharedArrayUnique(l_share));
+        CHECK(l_share.m_Array.m_Buffer == l_copied);
+        REQUIRE(MakeSharedArrayUnique(l_array));
+        CHECK(l_array.m_Array.m_Buffer == l_buffer);
+    }
+    SECTION("The last one keeps the items")
+    {
+        DestroySharedArray(l_array);
+        CHECK(SharedArrayIsUnique(l_share));
+        REQUIRE(MakeSharedArrayUnique(l_share));
+        CHECK(l_share.m_Array.m_Buffer == l_buffer);
+    }
+    SECTION("Copy allocation failure")
+    {
+        Size l_count = GENERATE((Size)0, (Size)1);
+        SetCountOfNullMallocAfterCount(l_count);
+        bool l_called = false;
+        CHECK_FALSE(MakeSharedArrayUniqueUsingAllocatorAndDeallocator(
+            l_share,
+            NullMallocAfterCount, free,
+            GeneralErrorCallback, &l_called
+        ));
+        CHECK(l_called);
+        CHECK(l_share.m_Array.m_Buffer == l_buffer);
+        CHECK(FindNumberOfSharesOfSharedArray(l_array) == 2);
+    }
+    SECTION("Making a null shared array unique")
+    {
+        SharedArray<int> l_null;
+        REQUIRE(MakeSharedArrayUnique(l_null));
+        CHECK(FindNumberOfSharesOfSharedArray(l_null) == 1);
+        AddItemToEndOfArray(1, l_null.m_Array);
+
+        SharedArray<int> l_nullShare;
+        CreateShareAtOfSharedArray(l_nullShare, l_null);
+        CHECK(FindNumberOfSharesOfSharedArray(l_null) == 2);
+        DestroySharedArray(l_nullShare);
+        DestroySharedArray(l_null);
+    }
+
+    DestroySharedArray(l_share);
+    DestroySharedArray(l_array);
+
+}
+
+TEST_CASE("Sharing a shared array given items without a header", "[SharedArray]")
+{
+
+    SharedArray<int> l_array;
+    AddItemToEndOfArray(1, l_array.m_Array);
+    AddItemToEndOfArray(2, l_array.m_Array);
+    REQUIRE(l_array.m_Header == nullptr);
+    int* l_buffer = l_array.m_Array.m_Buffer;
+
+    SECTION("A header is created for both")
+    {
+        SharedArray<int> l_share;
+        CreateShareAtOfSharedArray(l_share, l_array);
+        REQUIRE(l_array.m_Header != nullptr);
+        CHECK(l_share.m_Header == l_array.m_Header);
+        CHECK(l_share.m_Array.m_Buffer == l_buffer);
+        CHECK(FindNumberOfSharesOfSharedArray(l_array) == 2);
+
+        //Only the last one deallocates the items.
+        DestroySharedArray(l_share);
+        CHECK(FindNumberOfSharesOfSharedArray(l_array) == 1);
+        CHECK(l_array.m_Array.m_Buffer == l_buffer);
+        CHECK(l_array.m_Array[1] == 2);
+        DestroySharedArray(l_array);
+    }
+    SECTION("Header allocation failure")
+    {
+        bool l_called = false;
+        SharedArray<int> l_share;
+        CreateShareAtOfSharedArrayUsingAllocator(l_share, l_array, NullMalloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(l_share.m_Header == nullptr);
+        CHECK(l_share.m_Array.m_Buffer == nullptr);
+        CHECK(l_array.m_Header == nullptr);
+        CHECK(l_array.m_Array.m_Buffer == l_buffer);
+        DestroySharedArray(l_array);
+    }
+
+}
+
+struct ConstructionCountedItem
+{
+    static Size s_Constructions;
+    int m_Value;
+
+    ConstructionCountedItem(int p_value): m_Value(p_value) {}
+    ConstructionCountedItem(const ConstructionCountedItem& p_other): m_Value(p_other.m_Value)
+    {
+        ++s_Constructions;
+    }
+    ConstructionCountedItem& operator= (const ConstructionCountedItem& p_other) = default;
+};
+Size ConstructionCountedItem::s_Constructions = 0;
+
+TEST_CASE("Copying on write constructs the copies", "[SharedArray]")
+{
+
+    SharedArray<ConstructionCountedItem> l_array;
+    REQUIRE(MakeSharedArrayUnique(l_array));
+    for(int i = 0; i < 10; ++i)
+    {
+        AddItemToEndOfArray(ConstructionCountedItem(i), l_array.m_Array);
+    }
+    SharedArray<ConstructionCountedItem> l_share;
+    CreateShareAtOfSharedArray(l_share, l_array);
+
+    ConstructionCountedItem::s_Constructions = 0;
+    REQUIRE(MakeSharedArrayUnique(l_share));
+    CHECK(ConstructionCountedItem::s_Constructions == 10);
+    for(int i = 0; i < 10; ++i)
+    {
+        CHECK(l_share.m_Array.m_Buffer[i].m_Value == i);
+    }
+
+    DestroySharedArray(l_share);
+    DestroySharedArray(l_array);
+
+}
+
+TEST_CASE("Shared arrays on many threads", "[SharedArray]")
+{
+
+    Array<int> l_items = CreateArrayOfCount(1000);
+    SharedArray<int> l_array;
+    CreateSharedArrayAtOfArray(l_array, l_items);
+
+    //Each thread gets its own share, half of them change it.
+    std::vector<SharedArray<int>> l_shares(8);
+    for(SharedArray<int>& l_share : l_shares)
+    {
+        CreateShareAtOfSharedArray(l_share, l_array);
+    }
+    DestroySharedArray(l_array);
+
+    std::vector<int> l_sums(l_shares.size());
+    std::vector<std::thread> l_threads;
+    for(Size i = 0; i < l_shares.size(); ++i)
+    {
+        l_threads.emplace_back([&l_shares, &l_sums, i]
+        {
+            SharedArray<int>& l_share = l_shares[i];
+            if(i % 2 == 0 && MakeSharedArrayUnique(l_share))
+            {
+                for(int& l_item : l_share.m_Array)
+                {
+                    l_item += 1;
+                }
+            }
+            int l_sum = 0;
+            for(const int& l_item : l_share.m_Array)
+            {
+                l_sum += l_item;
+            }
+            l_sums[i] = l_sum;
+            DestroySharedArray(l_share);
+        });
+    }
+    for(std::thread& l_thread : l_threads)
+    {
+        l_thread.join();
+    }
+
+    for(Size i = 0; i < l_sums.size(); ++i)
+    {
+        CHECK(l_sums[i] == 999 * 1000 / 2 + (i % 2 == 0 ? 1000 : 0));
+    }
+
+}
@@ -0,0 +1,723 @@
+/** @file SmallArray.hpp
+ * @brief Defines everything in the @ref SmallArrayMod module.
+ *
+ */
+
+#ifndef SMALL_ARRAY__DATA_STRUCTURES_SMALL_ARRAY_SMALL_ARRAY_HPP
+#define SMALL_ARRAY__DATA_STRUCTURES_SMALL_ARRAY_SMALL_ARRAY_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+#include "../Array/Array.hpp"
+
+#include <string.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Library::DataStructures::SmallArray
+{
+
+    /**
+     * @brief An @ref Library::DataStructures::Array::Array "Array" that keeps
+     * up to N items inside of itself and only allocates a buffer once it
+     * needs more.
+     *
+     * @details m_Array is a normal array whose buffer is either
+     * m_InlineItems or a buffer allocated by the functions of this module,
+     * so it can be passed to every function of the @ref ArrayMod module that
+     * does not change the capacity. Functions that change the capacity have
+     * overloads in this namespace with the same names as the ones for
+     * arrays, these move the items between m_InlineItems and the allocated
+     * buffer as needed.
+     *
+     * A small array is never null, its capacity is always at least N. A
+     * default constructed small array is already usable, it is empty and
+     * uses m_InlineItems.
+     *
+     * Since m_Array can point into the small array itself, small arrays can
+     * not be copied or moved.
+     *
+     * @tparam T Must meet the same requirements as for
+     * @ref Library::DataStructures::Array::Array.
+     * @tparam N The number of items kept inside the small array, must be at
+     * least 1.
+     *
+     */
+    template<typename T, Size N>
+    struct SmallArray
+    {
+        static_assert(N > 0, "A small array must have at least 1 inline item.");
+
+        /**
+         * @brief The items, its buffer is m_InlineItems while its capacity is
+         * N.
+         *
+         */
+        Array::Array<T> m_Array;
+        /**
+         * @brief Room for the first N items.
+         *
+         */
+        alignas(T) Byte m_InlineItems[sizeof(T) * N];
+
+        /**
+         * @brief Creates an empty small array that uses m_InlineItems.
+         *
+         */
+        SmallArray():
+        m_Array((T*)m_InlineItems, 0, N)
+        {
+            LogDebugLine("Constructing small array at " << this);
+        }
+
+        SmallArray(const SmallArray<T, N>&) = delete;
+        SmallArray<T, N>& operator= (const SmallArray<T, N>&) = delete;
+
+        /**
+         * @brief Returns m_Array.
+         *
+         */
+        operator Array::Array<T>&()
+        {
+            return m_Array;
+        }
+        /**
+         * @brief Returns m_Array.
+         *
+         */
+        operator const Array::Array<T>&() const
+        {
+            return m_Array;
+        }
+    };
+
+    /**
+     * @brief Whether p_array keeps its items in m_InlineItems.
+     *
+     */
+    template<typename T, Size N>
+    inline bool SmallArrayIsInline(const SmallArray<T, N>& p_array)
+    {
+        return p_array.m_Array.m_Buffer == (const T*)p_array.m_InlineItems;
+    }
+
+    /**
+     * @brief Moves p_count items from p_from to p_to, where no items have
+     * been constructed yet.
+     *
+     * @details A single memcpy if T is trivially copyable, otherwise each
+     * item is move constructed. The buffers must not overlap.
+     *
+     */
+    template<typename T>
+    inline void MoveNumberOfItemsToUnconstructedBuffer(const Size& p_count, T* p_from, T* p_to)
+    {
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            memcpy(p_to, p_from, sizeof(T) * p_count);
+        }
+        else
+        {
+            for(Size i = 0; i < p_count; ++i)
+            {
+                new(p_to + i) T(std::move(p_from[i]));
+            }
+        }
+    }
+
+    /**
+     * @brief Creates a small array at outp_array that can hold p_capacity
+     * items.
+     *
+     * @details If p_capacity is at most N the small array uses its inline
+     * items and nothing is allocated, its capacity is N. Otherwise a buffer
+     * of p_capacity items is allocated using p_allocate.
+     *
+     * If allocation fails p_alloc_error is called and outp_array uses its
+     * inline items. If sizeof(T) * p_capacity overflows outp_array uses its
+     * inline items.
+     *
+     * @param outp_array Where the small array is created, it is overwritten
+     * without being destroyed.
+     * @param p_capacity The number of items the small array must be able to
+     * hold.
+     * @param p_allocate The allocator used for the buffer.
+     * @param p_alloc_error The callback for an allocation error.
+     * @param p_alloc_error_data The data that will be passed to p_alloc_error.
+     *
+     */
+    template<typename T, Size N>
+    void CreateArrayAtOfCapacityUsingAllocator(
+        SmallArray<T, N>& outp_array,
+        const Size& p_capacity,
+        Allocator p_allocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating small array at " << &outp_array << " of capacity "
+        << p_capacity);
+
+        outp_array.m_Array.m_Buffer = (T*)outp_array.m_InlineItems;
+        outp_array.m_Array.m_Size = 0;
+        outp_array.m_Array.m_Capacity = N;
+
+        if(p_capacity <= N)
+        {
+            LogDebugLine("The inline items are enough.");
+            return;
+        }
+
+        if(p_capacity > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine("sizeof(T) * p_capacity overflows, returning.");
+            return;
+        }
+
+        T* l_buffer = (T*)p_allocate(sizeof(T) * p_capacity);
+        if(l_buffer == nullptr)
+        {
+            LogDebugLine("Allocation failed.");
+            if(p_alloc_error != nullptr)
+            {
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        outp_array.m_Array.m_Buffer = l_buffer;
+        outp_array.m_Array.m_Capacity = p_capacity;
+
+    }
+    template<typename T, Size N>
+    inline void CreateArrayAtOfCapacity(
+        SmallArray<T, N>& outp_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for CreateArrayAtOfCapacityUsingAllocator");
+        CreateArrayAtOfCapacityUsingAllocator(
+            outp_array, p_capacity,
+            Library::g_DEFAULT_ALLOCATOR,
+            Library::g_DEFAULT_ALLOC_ERROR, Library::g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Deallocates p_array's buffer using p_deallocate if it has one,
+     * leaving it empty and using its inline items.
+     *
+     * @details The items are not destructed, the same as for arrays.
+     *
+     */
+    template<typename T, Size N>
+    void DestroyArrayUsingDeallocator(SmallArray<T, N>& p_array, Deallocator p_deallocate)
+    {
+
+        LogDebugLine("Destroying small array at " << &p_array);
+
+        if(!SmallArrayIsInline(p_array))
+        {
+            p_deallocate(p_array.m_Array.m_Buffer);
+        }
+
+        p_array.m_Array.m_Buffer = (T*)p_array.m_InlineItems;
+        p_array.m_Array.m_Size = 0;
+        p_array.m_Array.m_Capacity = N;
+
+    }
+    template<typename T, Size N>
+    inline void DestroyArray(SmallArray<T, N>& p_array)
+    {
+        LogDebugLine("Using defaults for DestroyArrayUsingDeallocator");
+        DestroyArrayUsingDeallocator(p_array, Library::g_DEFAULT_DEALLOCATOR);
+    }
+
+    /**
+     * @brief Changes the capacity of p_array, moving its items between the
+     * inline items and an allocated buffer as needed.
+     *
+     * @details
+     * - If p_new_capacity is at most N, p_array ends up using its inline items
+     * with a capacity of N. If it had a buffer the items are moved out of it
+     * and it is freed by passing it to p_reallocate with a size of 0, the same
+     * way @ref Library::DataStructures::Array::ResizeArrayToCapacityUsingReallocator
+     * frees buffers.
+     * - If p_new_capacity is bigger than N and p_array uses its inline items, a
+     * buffer is allocated by passing null to p_reallocate and the items are
+     * moved into it.
+     * - Otherwise the buffer is reallocated using p_reallocate.
+     *
+     * If p_new_capacity is less than p_array.m_Size, p_array.m_Size is set to
+     * it, the items after that are not moved.
+     *
+     * If reallocation fails p_realloc_error is called and p_array is not
+     * mutated. If sizeof(T) * p_new_capacity overflows, the function returns
+     * without mutating p_array.
+     *
+     * @param p_array The small array whose capacity will be changed.
+     * @param p_new_capacity The new capacity.
+     * @param p_reallocate The reallocator that will be used.
+     * @param p_realloc_error The callback for a reallocation error.
+     * @param p_realloc_error_data The data that will be passed to p_realloc_error.
+     *
+     */
+    template<typename T, Size N>
+    void ResizeArrayToCapacityUsingReallocator(
+        SmallArray<T, N>& p_array,
+        const Size& p_new_capacity,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Changing the capacity of small array " << p_array.m_Array
+        << " to " << p_new_capacity);
+
+        Array::Array<T>& l_array = p_array.m_Array;
+        T* l_inlineItems = (T*)p_array.m_InlineItems;
+        Size l_keptSize = l_array.m_Size < p_new_capacity ? l_array.m_Size : p_new_capacity;
+
+        if(p_new_capacity <= N)
+        {
+            if(!SmallArrayIsInline(p_array))
+            {
+                LogDebugLine("Moving the items back into the inline items.");
+                MoveNumberOfItemsToUnconstructedBuffer(l_keptSize, l_array.m_Buffer, l_inlineItems);
+                p_reallocate(l_array.m_Buffer, 0);
+                l_array.m_Buffer = l_inlineItems;
+                l_array.m_Capacity = N;
+            }
+            l_array.m_Size = l_keptSize;
+            return;
+        }
+
+        if(!SmallArrayIsInline(p_array))
+        {
+            Array::ResizeArrayToCapacityUsingReallocator(
+                l_array, p_new_capacity,
+                p_reallocate, p_realloc_error, p_realloc_error_data
+            );
+            return;
+        }
+
+        if(p_new_capacity > SIZE_MAX / sizeof(T))
+        {
+            LogDebugLine("sizeof(T) * p_new_capacity overflows, returning.");
+            return;
+        }
+
+        LogDebugLine("Moving the items out of the inline items.");
+        T* l_buffer = (T*)p_reallocate(nullptr, sizeof(T) * p_new_capacity);
+        if(l_buffer == nullptr)
+        {
+            LogDebugLine("Allocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        MoveNumberOfItemsToUnconstructedBuffer(l_keptSize, l_inlineItems, l_buffer);
+        l_array.m_Buffer = l_buffer;
+        l_array.m_Capacity = p_new_capacity;
+        l_array.m_Size = l_keptSize;
+
+    }
+    template<typename T, Size N>
+    inline void ResizeArrayToCapacity(
+        SmallArray<T, N>& p_array,
+        const Size& p_new_capacity
+    )
+    {
+        LogDebugLine("Using defaults for ResizeArrayToCapacityUsingReallocator");
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, p_new_capacity,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Makes sure that p_array can hold at least p_capacity items,
+     * see @ref Library::DataStructures::Array::ReserveArrayCapacityUsingReallocator.
+     *
+     */
+    template<typename T, Size N>
+    void ReserveArrayCapacityUsingReallocator(
+        SmallArray<T, N>& p_array,
+        const Size& p_capacity,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reserving a capacity of " << p_capacity << " in small "
+        "array " << p_array.m_Array);
+
+        if(p_capacity <= p_array.m_Array.m_Capacity)
+        {
+            return;
+        }
+
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, p_capacity,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size N>
+    inline void ReserveArrayCapacity(
+        SmallArray<T, N>& p_array,
+        const Size& p_capacity
+    )
+    {
+        LogDebugLine("Using defaults for ReserveArrayCapacityUsingReallocator");
+        ReserveArrayCapacityUsingReallocator(
+            p_array, p_capacity,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Shrinks the capacity of p_array to its size, moving its items
+     * back into the inline items if they fit.
+     *
+     * @details If p_array uses its inline items nothing happens. If
+     * reallocation fails p_realloc_error is called and p_array is not
+     * mutated.
+     *
+     */
+    template<typename T, Size N>
+    void ShrinkArrayCapacityToSizeUsingReallocator(
+        SmallArray<T, N>& p_array,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Shrinking the capacity of small array " << p_array.m_Array
+        << " to its size");
+
+        if(SmallArrayIsInline(p_array) || p_array.m_Array.m_Size == p_array.m_Array.m_Capacity)
+        {
+            return;
+        }
+
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, p_array.m_Array.m_Size <= N ? N : p_array.m_Array.m_Size,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size N>
+    inline void ShrinkArrayCapacityToSize(SmallArray<T, N>& p_array)
+    {
+        LogDebugLine("Using defaults for ShrinkArrayCapacityToSizeUsingReallocator");
+        ShrinkArrayCapacityToSizeUsingReallocator(
+            p_array,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Grows p_array according to p_policy so that it can hold p_size
+     * items, returns whether it can.
+     *
+     * @details Used by the functions that add items, they then call the
+     * array function which finds enough capacity and does not reallocate.
+     *
+     */
+    template<typename T, Size N>
+    bool GrowArrayForSizeUsingReallocatorAndGrowthPolicy(
+        SmallArray<T, N>& p_array,
+        const Size& p_size,
+        const Array::ArrayGrowthPolicy& p_policy,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        if(p_size <= p_array.m_Array.m_Capacity)
+        {
+            return true;
+        }
+
+        Size l_newCapacity = Array::FindGrownCapacityOfArrayForSizeUsingGrowthPolicy(
+            p_array.m_Array, p_size, p_policy
+        );
+        if(l_newCapacity == 0)
+        {
+            LogDebugLine("The new capacity overflows.");
+            return false;
+        }
+
+        ResizeArrayToCapacityUsingReallocator(
+            p_array, l_newCapacity,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+        return p_array.m_Array.m_Capacity == l_newCapacity;
+
+    }
+
+    /**
+     * @brief Adds p_item after the last item of p_array, see
+     * @ref Library::DataStructures::Array::AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy.
+     *
+     * @details Nothing is allocated until p_array has more than N items.
+     * p_item may be an item of p_array.
+     *
+     */
+    template<typename T, Size N>
+    void AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+        const T& p_item,
+        SmallArray<T, N>& p_array,
+        const Array::ArrayGrowthPolicy& p_policy,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        Array::Array<T>& l_array = p_array.m_Array;
+        const T* l_item = &p_item;
+
+        if(l_array.m_Size == l_array.m_Capacity)
+        {
+            if(l_array.m_Size == SIZE_MAX)
+            {
+                LogDebugLine("The size of the array would overflow, returning.");
+                return;
+            }
+
+            //Pointers are compared as integers since p_item is usually not in
+            //the buffer, and comparing unrelated pointers is unspecified.
+            bool l_itemIsInArray =
+                (uintptr_t)l_item >= (uintptr_t)l_array.m_Buffer &&
+                (uintptr_t)l_item < (uintptr_t)(l_array.m_Buffer + l_array.m_Size);
+            Size l_itemIndex = l_itemIsInArray ? l_item - l_array.m_Buffer : 0;
+
+            if(!GrowArrayForSizeUsingReallocatorAndGrowthPolicy(
+                p_array, l_array.m_Size + 1, p_policy,
+                p_reallocate, p_realloc_error, p_realloc_error_data
+            ))
+            {
+                LogDebugLine("Growing failed, returning.");
+                return;
+            }
+
+            if(l_itemIsInArray)
+            {
+                l_item = l_array.m_Buffer + l_itemIndex;
+            }
+        }
+
+        Array::AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            *l_item, l_array, p_policy,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size N>
+    inline void AddItemToEndOfArray(
+        const T& p_item,
+        SmallArray<T, N>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy");
+        AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            p_item, p_array,
+            Array::g_DEFAULT_ARRAY_GROWTH_POLICY,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Adds all of the items of p_to_add after the last item of
+     * p_array, see
+     * @ref Library::DataStructures::Array::AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy.
+     *
+     * @details p_to_add may be p_array.m_Array.
+     *
+     */
+    template<typename T, Size N>
+    void AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+        const Array::Array<T>& p_to_add,
+        SmallArray<T, N>& p_array,
+        const Array::ArrayGrowthPolicy& p_policy,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        if(Array::ArrayIsEmpty(p_to_add))
+        {
+            return;
+        }
+
+        Size l_newSize = p_array.m_Array.m_Size + p_to_add.m_Size;
+        if(l_newSize < p_to_add.m_Size)
+        {
+            LogDebugLine("The new size overflows, returning.");
+            return;
+        }
+
+        if(!GrowArrayForSizeUsingReallocatorAndGrowthPolicy(
+            p_array, l_newSize, p_policy,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        ))
+        {
+            LogDebugLine("Growing failed, returning.");
+            return;
+        }
+
+        Array::AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            p_to_add, p_array.m_Array, p_policy,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size N>
+    inline void AddArrayToEndOfArray(
+        const Array::Array<T>& p_to_add,
+        SmallArray<T, N>& p_array
+    )
+    {
+        LogDebugLine("Using defaults for AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy");
+        AddArrayToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            p_to_add, p_array,
+            Array::g_DEFAULT_ARRAY_GROWTH_POLICY,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief Adds p_to_add to p_array after p_index, see
+     * @ref Library::DataStructures::Array::AddArrayToArrayAfterIndexUsingReallocator.
+     *
+     * @details The index is checked the same way. Unlike for arrays, p_array
+     * grows by @ref Library::DataStructures::Array::g_DEFAULT_ARRAY_GROWTH_POLICY
+     * and nothing is allocated while the items fit into the inline items.
+     * p_to_add must not be part of p_array.
+     *
+     */
+    template<typename T, Size N>
+    void AddArrayToArrayAfterIndexUsingReallocator(
+        const Array::Array<T>& p_to_add,
+        SmallArray<T, N>& p_array,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        Reallocator p_reallocate,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Adding array " << p_to_add << " to small array "
+        << p_array.m_Array << " after index " << p_index);
+
+        if(Array::ArrayIsEmpty(p_to_add))
+        {
+            return;
+        }
+
+        if(p_array.m_Array.m_Size != 0 && p_index >= p_array.m_Array.m_Size)
+        {
+            LogDebugLine("Index error detected!");
+            if(p_index_error != nullptr)
+            {
+                p_index_error(p_index_error_data);
+            }
+            return;
+        }
+
+        Size l_newSize = p_array.m_Array.m_Size + p_to_add.m_Size;
+        if(l_newSize < p_to_add.m_Size)
+        {
+            LogDebugLine("The new size overflows, returning.");
+            return;
+        }
+
+        if(!GrowArrayForSizeUsingReallocatorAndGrowthPolicy(
+            p_array, l_newSize, Array::g_DEFAULT_ARRAY_GROWTH_POLICY,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        ))
+        {
+            LogDebugLine("Growing failed, returning.");
+            return;
+        }
+
+        Array::AddArrayToArrayAfterIndexUsingReallocator(
+            p_to_add, p_array.m_Array,
+            p_index, p_index_error, p_index_error_data,
+            p_reallocate, p_realloc_error, p_realloc_error_data
+        );
+
+    }
+    template<typename T, Size N>
+    inline void AddArrayToArrayAfterIndex(
+        const Array::Array<T>& p_to_add,
+        SmallArray<T, N>& p_array,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data
+    )
+    {
+        LogDebugLine("Using defaults for AddArrayToArrayAfterIndexUsingReallocator");
+        AddArrayToArrayAfterIndexUsingReallocator(
+            p_to_add, p_array,
+            p_index, p_index_error, p_index_error_data,
+            Library::g_DEFAULT_REALLOCATOR,
+            Library::g_DEFAULT_REALLOC_ERROR,
+            Library::g_DEFAULT_REALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @brief The same as
+     * @ref Library::DataStructures::Array::RemoveNumberOfItemsStartingFromAndIncludingIndexFromArray
+     * for p_array.m_Array, the capacity does not change.
+     *
+     */
+    template<typename T, Size N>
+    inline void RemoveNumberOfItemsStartingFromAndIncludingIndexFromArray(
+        const Size& p_numberOfItems,
+        const Size& p_index,
+        Callback p_index_error, void* p_index_error_data,
+        SmallArray<T, N>& p_array
+    )
+    {
+        Array::RemoveNumberOfItemsStartingFromAndIncludingIndexFromArray(
+            p_numberOfItems, p_index,
+            p_index_error, p_index_error_data,
+            p_array.m_Array
+        );
+    }
+
+    /**
+     * @brief The same as
+     * @ref Library::DataStructures::Array::RemoveEachInstanceOfArrayOfItemsFromArray
+     * for p_array.m_Array, the capacity does not change.
+     *
+     */
+    template<typename T, Size N>
+    inline void RemoveEachInstanceOfArrayOfItemsFromArray(
+        const Array::Array<T>& p_items,
+        SmallArray<T, N>& p_array
+    )
+    {
+        Array::RemoveEachInstanceOfArrayOfItemsFromArray(p_items, p_array.m_Array);
+    }
+
+}
+
+#endif //SMALL_ARRAY__DATA_STRUCTURES_SMALL_ARRAY_SMALL_ARRAY_HPP
@@ -0,0 +1,64 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include "../SmallArray.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::SmallArray;
+
+//The number of short lived arrays made per run.
+static const int g_ARRAY_COUNT = 100000;
+
+TEST_CASE("Short lived arrays of a few items", "[SmallArray][Benchmark]")
+{
+
+    BENCHMARK("Array, 12 items")
+    {
+        int l_result = 0;
+        for(int i = 0; i < g_ARRAY_COUNT; ++i)
+        {
+            Array<int> l_array;
+            for(int n = 0; n < 12; ++n)
+            {
+                AddItemToEndOfArray(i + n, l_array);
+            }
+            l_result += l_array[11];
+            DestoryArray(l_array);
+        }
+        return l_result;
+    };
+    BENCHMARK("Array with a reserved capacity of 16, 12 items")
+    {
+        int l_result = 0;
+        for(int i = 0; i < g_ARRAY_COUNT; ++i)
+        {
+            Array<int> l_array;
+            CreateArrayAtOfCapacity(l_array, 16);
+            for(int n = 0; n < 12; ++n)
+            {
+                AddItemToEndOfArray(i + n, l_array);
+            }
+            l_result += l_array[11];
+            DestoryArray(l_array);
+        }
+        return l_result;
+    };
+    BENCHMARK("SmallArray<int, 16>, 12 items")
+    {
+        int l_result = 0;
+        for(int i = 0; i < g_ARRAY_COUNT; ++i)
+        {
+            SmallArray<int, 16> l_array;
+            for(int n = 0; n < 12; ++n)
+            {
+                AddItemToEndOfArray(i + n, l_array);
+            }
+            l_result += l_array.m_Array[11];
+            DestroyArray(l_array);
+        }
+        return l_result;
+    };
+
+}
@@ -0,0 +1,201 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../SmallArray.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::SmallArray;
+using namespace Debugging;
+
+TEST_CASE("Small array creation and destruction", "[SmallArray]")
+{
+
+    SmallArray<int, 8> l_array;
+
+    REQUIRE(SmallArrayIsInline(l_array));
+    REQUIRE(l_array.m_Array.m_Size == 0);
+    REQUIRE(l_array.m_Array.m_Capacity == 8);
+
+    SECTION("Fits inline")
+    {
+        bool l_called = false;
+        CreateArrayAtOfCapacityUsingAllocator(l_array, 8, NullMalloc, GeneralErrorCallback, &l_called);
+        CHECK(!l_called);
+        CHECK(SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Capacity == 8);
+    }
+    SECTION("Does not fit inline")
+    {
+        CreateArrayAtOfCapacity(l_array, 9);
+        CHECK(!SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Capacity == 9);
+    }
+    SECTION("Allocation failure")
+    {
+        bool l_called = false;
+        CreateArrayAtOfCapacityUsingAllocator(l_array, 100, NullMalloc, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Capacity == 8);
+    }
+
+    DestroyArray(l_array);
+    CHECK(SmallArrayIsInline(l_array));
+    CHECK(l_array.m_Array.m_Size == 0);
+
+}
+
+TEST_CASE("Small array growth", "[SmallArray]")
+{
+
+    SmallArray<int, 8> l_array;
+
+    SECTION("No allocation while the items fit")
+    {
+        bool l_called = false;
+        for(int i = 0; i < 8; ++i)
+        {
+            AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+                i, l_array, ArrayGrowthPolicy::Double,
+                NullRealloc, GeneralErrorCallback, &l_called
+            );
+        }
+        CHECK(!l_called);
+        CHECK(SmallArrayIsInline(l_array));
+        REQUIRE(l_array.m_Array.m_Size == 8);
+
+        //The 9th item does not fit, the failed growth does not lose anything.
+        AddItemToEndOfArrayUsingReallocatorAndGrowthPolicy(
+            8, l_array, ArrayGrowthPolicy::Double,
+            NullRealloc, GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called);
+        CHECK(SmallArrayIsInline(l_array));
+        REQUIRE(l_array.m_Array.m_Size == 8);
+        for(int i = 0; i < 8; ++i)
+        {
+            CHECK(l_array.m_Array[i] == i);
+        }
+    }
+    SECTION("Spilling and moving back")
+    {
+        for(int i = 0; i < 20; ++i)
+        {
+            AddItemToEndOfArray(i, l_array);
+        }
+        CHECK(!SmallArrayIsInline(l_array));
+        REQUIRE(l_array.m_Array.m_Size == 20);
+
+        //An item of the array itself, while it is full.
+        ResizeArrayToCapacity(l_array, 20);
+        AddItemToEndOfArray(l_array.m_Array[3], l_array);
+        REQUIRE(l_array.m_Array.m_Size == 21);
+        CHECK(l_array.m_Array[20] == 3);
+
+        bool l_called = false;
+        RemoveNumberOfItemsStartingFromAndIncludingIndexFromArray(14, 6, GeneralErrorCallback, &l_called, l_array);
+        CHECK(!l_called);
+        REQUIRE(l_array.m_Array.m_Size == 6);
+
+        ShrinkArrayCapacityToSize(l_array);
+        CHECK(SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Capacity == 8);
+        for(int i = 0; i < 6; ++i)
+        {
+            CHECK(l_array.m_Array[i] == i);
+        }
+    }
+    SECTION("Reserve and resize")
+    {
+        AddItemToEndOfArray(1, l_array);
+        AddItemToEndOfArray(2, l_array);
+
+        ReserveArrayCapacity(l_array, 4);
+        CHECK(SmallArrayIsInline(l_array));
+
+        ReserveArrayCapacity(l_array, 100);
+        CHECK(!SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Capacity == 100);
+        CHECK(l_array.m_Array.m_Size == 2);
+
+        ResizeArrayToCapacity(l_array, 1);
+        CHECK(SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Capacity == 8);
+        REQUIRE(l_array.m_Array.m_Size == 1);
+        CHECK(l_array.m_Array[0] == 1);
+    }
+
+    DestroyArray(l_array);
+
+}
+
+TEST_CASE("Add arrays to small arrays", "[SmallArray]")
+{
+
+    Array<int> l_toAdd;
+    CreateArrayAtOfCapacity(l_toAdd, 5);
+    for(int i = 0; i < 5; ++i)
+    {
+        l_toAdd[l_toAdd.m_Size++] = 100 + i;
+    }
+
+    SmallArray<int, 8> l_array;
+    for(int i = 0; i < 4; ++i)
+    {
+        AddItemToEndOfArray(i, l_array);
+    }
+
+    SECTION("After index")
+    {
+        Size l_index = GENERATE(range((Size)0, (Size)4));
+        bool l_called = false;
+
+        AddArrayToArrayAfterIndex(l_toAdd, l_array, l_index, GeneralErrorCallback, &l_called);
+        CHECK(!l_called);
+        CHECK(!SmallArrayIsInline(l_array));
+        REQUIRE(l_array.m_Array.m_Size == 9);
+
+        for(Size i = 0, n = 0; i < 9; ++i)
+        {
+            if(i > l_index && i <= l_index + 5)
+            {
+                CHECK(l_array.m_Array[i] == 100 + (int)(i - l_index - 1));
+            }
+            else
+            {
+                CHECK(l_array.m_Array[i] == (int)n);
+                ++n;
+            }
+        }
+    }
+    SECTION("Index error")
+    {
+        bool l_called = false;
+        AddArrayToArrayAfterIndex(l_toAdd, l_array, 4, GeneralErrorCallback, &l_called);
+        CHECK(l_called);
+        CHECK(SmallArrayIsInline(l_array));
+        CHECK(l_array.m_Array.m_Size == 4);
+    }
+    SECTION("To the end")
+    {
+        l_toAdd.m_Size = 4;
+        AddArrayToEndOfArray(l_toAdd, l_array);
+        CHECK(SmallArrayIsInline(l_array));
+        REQUIRE(l_array.m_Array.m_Size == 8);
+        CHECK(l_array.m_Array[7] == 103);
+
+        //Itself, which makes it spill.
+        AddArrayToEndOfArray(l_array.m_Array, l_array);
+        CHECK(!SmallArrayIsInline(l_array));
+        REQUIRE(l_array.m_Array.m_Size == 16);
+        CHECK(l_array.m_Array[15] == 103);
+    }
+
+    DestroyArray(l_array);
+    DestoryArray(l_toAdd);
+
+}
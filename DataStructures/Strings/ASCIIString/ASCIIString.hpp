@@ -601,7 +601,7 @@ namespace Library::DataStructures::Strings
      */
     inline void ASCIILetterAtToUpper(char& outp_char)
     {
-        LogDebugLine("Character at " (void*)&outp_char << " to upper");
+        LogDebugLine("Character at " << (void*)&outp_char << " to upper");
         //0xDF = 11011111
         outp_char &= (char)0xDF;
     }
@@ -617,7 +617,7 @@ namespace Library::DataStructures::Strings
      */
     inline void ASCIILetterAtToLower(char& outp_char)
     {
-        LogDebugLine("Character at " (void*)&outp_char << " to lower");
+        LogDebugLine("Character at " << (void*)&outp_char << " to lower");
         //0x20 = 00100000
         outp_char |= (char)0x20;
     }
@@ -691,7 +691,7 @@ namespace Library::DataStructures::Strings
             //a-z
             if(p_number > 25)
             {
-                outp_char = (char)(p_number + 61)
+                outp_char = (char)(p_number + 61);
             }
             //A-Z
             else
@@ -746,7 +746,7 @@ namespace Library::DataStructures::Strings
             //a-z
             if(p_char > 'a')
             {
-                outp_number = (T)(p_char - 61)
+                outp_number = (T)(p_char - 61);
             }
             //A-Z
             else
@@ -773,17 +773,11 @@ namespace Library::DataStructures::Strings
         LogDebugLine("Converting number at " << (void*)&p_number << " in base "
         << p_base << " to ASCII string " << p_string);
 
-        //TODO: This assumes an unsigned number, make it support all types of
-        //numbers.
-        T l_multiple = p_base;
-        T l_copy = p_number;
-        while(l_copy != 0)
-        {
-            T l_number = l_copy % l_multiple;
-            
-            l_copy /= p_base;
-            l_multiple *= p_base;
-        }
+        //TODO: Implement it, for all types of numbers and not only unsigned
+        //ones. Until then nothing could be written to p_string.
+        LogDebugLine("\n------\nError converting numbers to ASCII strings is not"
+        " implemented yet, aborting proccess...\n------\n");
+        abort();
 
     }
     template<typename T>
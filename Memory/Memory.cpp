@@ -0,0 +1,958 @@
+#include "Memory.hpp"
+
+#include <atomic>
+#include <string.h>
+
+#ifdef __unix__
+#include <unistd.h>
+#endif //__unix__
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define MEMORY_X86_KERNELS
+#include <immintrin.h>
+#endif //defined(__x86_64__) && defined(__GNUC__)
+
+namespace Library
+{
+
+    namespace
+    {
+
+        //Fills are given a block of 64 bytes that repeats every 32 bytes, the
+        //vector that starts at offset o of the fill is the 32 bytes starting at
+        //o & 31 in the block.
+        constexpr Size g_BLOCK_SIZE = 64;
+        constexpr Size g_BLOCK_PERIOD = 32;
+
+        //Used when the size of the last level cache is unknown.
+        constexpr Size g_DEFAULT_NON_TEMPORAL_THRESHOLD = 4 * 1024 * 1024;
+        //The most bytes a pattern that is not a power of two is copied at
+        //once, small enough to stay in the first level cache.
+        constexpr Size g_PATTERN_CHUNK_SIZE = 16 * 1024;
+
+        struct MemoryKernels
+        {
+            MemoryKernelLevel m_Level;
+            void (*m_WriteBlock)(Byte* p_location, Size p_size, const Byte* p_block, Size p_threshold);
+            //Safe for overlapping bytes if p_destination is before p_source.
+            void (*m_CopyForward)(const Byte* p_source, Size p_size, Byte* p_destination, Size p_threshold);
+            //Safe for overlapping bytes if p_destination is after p_source.
+            void (*m_CopyBackward)(const Byte* p_source, Size p_size, Byte* p_destination);
+            int (*m_Compare)(const Byte* p_first, const Byte* p_second, Size p_size);
+            Size (*m_FindByte)(Byte p_byte, const Byte* p_location, Size p_size);
+        };
+
+
+        void WriteBlockScalar(Byte* p_location, Size p_size, const Byte* p_block, Size p_threshold)
+        {
+            (void)p_threshold;
+            for(Size i = 0; i < p_size; ++i)
+            {
+                p_location[i] = p_block[i & (g_BLOCK_PERIOD - 1)];
+            }
+        }
+        void CopyForwardScalar(const Byte* p_source, Size p_size, Byte* p_destination, Size p_threshold)
+        {
+            (void)p_threshold;
+            for(Size i = 0; i < p_size; ++i)
+            {
+                p_destination[i] = p_source[i];
+            }
+        }
+        void CopyBackwardScalar(const Byte* p_source, Size p_size, Byte* p_destination)
+        {
+            for(Size i = p_size; i-- > 0;)
+            {
+                p_destination[i] = p_source[i];
+            }
+        }
+        int CompareScalar(const Byte* p_first, const Byte* p_second, Size p_size)
+        {
+            for(Size i = 0; i < p_size; ++i)
+            {
+                if(p_first[i] != p_second[i])
+                {
+                    return (int)p_first[i] - (int)p_second[i];
+                }
+            }
+            return 0;
+        }
+        Size FindByteScalar(Byte p_byte, const Byte* p_location, Size p_size)
+        {
+            for(Size i = 0; i < p_size; ++i)
+            {
+                if(p_location[i] == p_byte)
+                {
+                    return i;
+                }
+            }
+            return p_size;
+        }
+
+        constexpr MemoryKernels g_SCALAR_KERNELS = {
+            MemoryKernelLevel::Scalar,
+            WriteBlockScalar,
+            CopyForwardScalar,
+            CopyBackwardScalar,
+            CompareScalar,
+            FindByteScalar
+        };
+
+
+        #ifdef MEMORY_X86_KERNELS
+
+        //Copies up to 16 bytes by loading all of them before storing any, so
+        //the bytes may overlap.
+        inline void CopyUpTo16(const Byte* p_source, Size p_size, Byte* p_destination)
+        {
+            if(p_size >= 8)
+            {
+                uint64_t l_head, l_tail;
+                memcpy(&l_head, p_source, 8);
+                memcpy(&l_tail, p_source + p_size - 8, 8);
+                memcpy(p_destination, &l_head, 8);
+                memcpy(p_destination + p_size - 8, &l_tail, 8);
+            }
+            else if(p_size >= 4)
+            {
+                uint32_t l_head, l_tail;
+                memcpy(&l_head, p_source, 4);
+                memcpy(&l_tail, p_source + p_size - 4, 4);
+                memcpy(p_destination, &l_head, 4);
+                memcpy(p_destination + p_size - 4, &l_tail, 4);
+            }
+            else if(p_size >= 2)
+            {
+                uint16_t l_head, l_tail;
+                memcpy(&l_head, p_source, 2);
+                memcpy(&l_tail, p_source + p_size - 2, 2);
+                memcpy(p_destination, &l_head, 2);
+                memcpy(p_destination + p_size - 2, &l_tail, 2);
+            }
+            else if(p_size == 1)
+            {
+                *p_destination = *p_source;
+            }
+        }
+        //The same for up to 32 bytes.
+        inline void CopyUpTo32(const Byte* p_source, Size p_size, Byte* p_destination)
+        {
+            if(p_size < 16)
+            {
+                CopyUpTo16(p_source, p_size, p_destination);
+                return;
+            }
+            __m128i l_head = _mm_loadu_si128((const __m128i*)p_source);
+            __m128i l_tail = _mm_loadu_si128((const __m128i*)(p_source + p_size - 16));
+            _mm_storeu_si128((__m128i*)p_destination, l_head);
+            _mm_storeu_si128((__m128i*)(p_destination + p_size - 16), l_tail);
+        }
+
+
+        void WriteBlockSSE2(Byte* p_location, Size p_size, const Byte* p_block, Size p_threshold)
+        {
+
+            if(p_size <= g_BLOCK_PERIOD)
+            {
+                CopyUpTo32(p_block, p_size, p_location);
+                return;
+            }
+
+            _mm_storeu_si128((__m128i*)p_location, _mm_loadu_si128((const __m128i*)p_block));
+            Size l_tailPhase = (p_size - 16) & (g_BLOCK_PERIOD - 1);
+            __m128i l_tail = _mm_loadu_si128((const __m128i*)(p_block + l_tailPhase));
+
+            //From here on every store is aligned, the phase of every other
+            //one is the same.
+            Size l_skip = 16 - ((uintptr_t)p_location & 15);
+            Byte* l_position = p_location + l_skip;
+            Byte* l_end = p_location + p_size;
+            __m128i l_even = _mm_loadu_si128((const __m128i*)(p_block + l_skip));
+            __m128i l_odd = _mm_loadu_si128((const __m128i*)(p_block + l_skip + 16));
+
+            if(p_size >= p_threshold)
+            {
+                for(; l_end - l_position >= 64; l_position += 64)
+                {
+                    _mm_stream_si128((__m128i*)l_position, l_even);
+                    _mm_stream_si128((__m128i*)(l_position + 16), l_odd);
+                    _mm_stream_si128((__m128i*)(l_position + 32), l_even);
+                    _mm_stream_si128((__m128i*)(l_position + 48), l_odd);
+                }
+                _mm_sfence();
+            }
+            for(; l_end - l_position >= 32; l_position += 32)
+            {
+                _mm_store_si128((__m128i*)l_position, l_even);
+                _mm_store_si128((__m128i*)(l_position + 16), l_odd);
+            }
+            if(l_end - l_position >= 16)
+            {
+                _mm_store_si128((__m128i*)l_position, l_even);
+            }
+
+            _mm_storeu_si128((__m128i*)(l_end - 16), l_tail);
+
+        }
+
+        void CopyForwardSSE2(const Byte* p_source, Size p_size, Byte* p_destination, Size p_threshold)
+        {
+
+            if(p_size <= 32)
+            {
+                CopyUpTo32(p_source, p_size, p_destination);
+                return;
+            }
+
+            //The first and last vectors are loaded before anything is stored
+            //and stored last, this keeps overlapping copies correct.
+            __m128i l_head = _mm_loadu_si128((const __m128i*)p_source);
+            __m128i l_tail = _mm_loadu_si128((const __m128i*)(p_source + p_size - 16));
+
+            Size l_skip = 16 - ((uintptr_t)p_destination & 15);
+            const Byte* l_source = p_source + l_skip;
+            Byte* l_destination = p_destination + l_skip;
+            Size l_left = p_size - l_skip;
+
+            if(p_size >= p_threshold)
+            {
+                for(; l_left >= 64; l_left -= 64, l_source += 64, l_destination += 64)
+                {
+                    __m128i l_0 = _mm_loadu_si128((const __m128i*)l_source);
+                    __m128i l_1 = _mm_loadu_si128((const __m128i*)(l_source + 16));
+                    __m128i l_2 = _mm_loadu_si128((const __m128i*)(l_source + 32));
+                    __m128i l_3 = _mm_loadu_si128((const __m128i*)(l_source + 48));
+                    _mm_stream_si128((__m128i*)l_destination, l_0);
+                    _mm_stream_si128((__m128i*)(l_destination + 16), l_1);
+                    _mm_stream_si128((__m128i*)(l_destination + 32), l_2);
+                    _mm_stream_si128((__m128i*)(l_destination + 48), l_3);
+                }
+                _mm_sfence();
+            }
+            for(; l_left > 64; l_left -= 64, l_source += 64, l_destination += 64)
+            {
+                __m128i l_0 = _mm_loadu_si128((const __m128i*)l_source);
+                __m128i l_1 = _mm_loadu_si128((const __m128i*)(l_source + 16));
+                __m128i l_2 = _mm_loadu_si128((const __m128i*)(l_source + 32));
+                __m128i l_3 = _mm_loadu_si128((const __m128i*)(l_source + 48));
+                _mm_store_si128((__m128i*)l_destination, l_0);
+                _mm_store_si128((__m128i*)(l_destination + 16), l_1);
+                _mm_store_si128((__m128i*)(l_destination + 32), l_2);
+                _mm_store_si128((__m128i*)(l_destination + 48), l_3);
+            }
+            for(; l_left > 16; l_left -= 16, l_source += 16, l_destination += 16)
+            {
+                _mm_store_si128((__m128i*)l_destination, _mm_loadu_si128((const __m128i*)l_source));
+            }
+
+            _mm_storeu_si128((__m128i*)p_destination, l_head);
+            _mm_storeu_si128((__m128i*)(p_destination + p_size - 16), l_tail);
+
+        }
+
+        void CopyBackwardSSE2(const Byte* p_source, Size p_size, Byte* p_destination)
+        {
+
+            if(p_size <= 32)
+            {
+                CopyUpTo32(p_source, p_size, p_destination);
+                return;
+            }
+
+            __m128i l_head = _mm_loadu_si128((const __m128i*)p_source);
+            __m128i l_tail = _mm_loadu_si128((const __m128i*)(p_source + p_size - 16));
+
+            Size l_skip = (uintptr_t)(p_destination + p_size) & 15;
+            const Byte* l_source = p_source + p_size - l_skip;
+            Byte* l_destination = p_destination + p_size - l_skip;
+            Size l_left = p_size - l_skip;
+
+            for(; l_left > 64; l_left -= 64)
+            {
+                l_source -= 64;
+                l_destination -= 64;
+                __m128i l_0 = _mm_loadu_si128((const __m128i*)(l_source + 48));
+                __m128i l_1 = _mm_loadu_si128((const __m128i*)(l_source + 32));
+                __m128i l_2 = _mm_loadu_si128((const __m128i*)(l_source + 16));
+                __m128i l_3 = _mm_loadu_si128((const __m128i*)l_source);
+                _mm_store_si128((__m128i*)(l_destination + 48), l_0);
+                _mm_store_si128((__m128i*)(l_destination + 32), l_1);
+                _mm_store_si128((__m128i*)(l_destination + 16), l_2);
+                _mm_store_si128((__m128i*)l_destination, l_3);
+            }
+            for(; l_left > 16; l_left -= 16)
+            {
+                l_source -= 16;
+                l_destination -= 16;
+                _mm_store_si128((__m128i*)l_destination, _mm_loadu_si128((const __m128i*)l_source));
+            }
+
+            _mm_storeu_si128((__m128i*)p_destination, l_head);
+            _mm_storeu_si128((__m128i*)(p_destination + p_size - 16), l_tail);
+
+        }
+
+        //Returns the difference of the first mismatching bytes of the 16 at
+        //the given locations, 0 if they are the same.
+        inline int CompareVectorSSE2(const Byte* p_first, const Byte* p_second)
+        {
+            unsigned l_equal = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128((const __m128i*)p_first),
+                _mm_loadu_si128((const __m128i*)p_second)
+            ));
+            if(l_equal == 0xFFFF)
+            {
+                return 0;
+            }
+            unsigned l_index = (unsigned)__builtin_ctz(~l_equal);
+            return (int)p_first[l_index] - (int)p_second[l_index];
+        }
+        int CompareSSE2(const Byte* p_first, const Byte* p_second, Size p_size)
+        {
+
+            if(p_size < 16)
+            {
+                return CompareScalar(p_first, p_second, p_size);
+            }
+
+            Size i = 0;
+            for(; i + 64 <= p_size; i += 64)
+            {
+                __m128i l_0 = _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(p_first + i)),
+                    _mm_loadu_si128((const __m128i*)(p_second + i))
+                );
+                __m128i l_1 = _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(p_first + i + 16)),
+                    _mm_loadu_si128((const __m128i*)(p_second + i + 16))
+                );
+                __m128i l_2 = _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(p_first + i + 32)),
+                    _mm_loadu_si128((const __m128i*)(p_second + i + 32))
+                );
+                __m128i l_3 = _mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(p_first + i + 48)),
+                    _mm_loadu_si128((const __m128i*)(p_second + i + 48))
+                );
+                __m128i l_all = _mm_and_si128(_mm_and_si128(l_0, l_1), _mm_and_si128(l_2, l_3));
+                if(_mm_movemask_epi8(l_all) != 0xFFFF)
+                {
+                    break;
+                }
+            }
+            for(; i + 16 <= p_size; i += 16)
+            {
+                int l_result = CompareVectorSSE2(p_first + i, p_second + i);
+                if(l_result != 0)
+                {
+                    return l_result;
+                }
+            }
+            if(i != p_size)
+            {
+                //Overlaps bytes that were already found to be the same.
+                return CompareVectorSSE2(p_first + p_size - 16, p_second + p_size - 16);
+            }
+
+            return 0;
+
+        }
+
+        Size FindByteSSE2(Byte p_byte, const Byte* p_location, Size p_size)
+        {
+
+            if(p_size < 16)
+            {
+                return FindByteScalar(p_byte, p_location, p_size);
+            }
+
+            __m128i l_byte = _mm_set1_epi8((char)p_byte);
+            Size i = 0;
+            for(; i + 64 <= p_size; i += 64)
+            {
+                __m128i l_0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p_location + i)), l_byte);
+                __m128i l_1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p_location + i + 16)), l_byte);
+                __m128i l_2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p_location + i + 32)), l_byte);
+                __m128i l_3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p_location + i + 48)), l_byte);
+                __m128i l_any = _mm_or_si128(_mm_or_si128(l_0, l_1), _mm_or_si128(l_2, l_3));
+                if(_mm_movemask_epi8(l_any) != 0)
+                {
+                    break;
+                }
+            }
+            for(; i + 16 <= p_size; i += 16)
+            {
+                unsigned l_found = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(p_location + i)), l_byte
+                ));
+                if(l_found != 0)
+                {
+                    return i + __builtin_ctz(l_found);
+                }
+            }
+            if(i != p_size)
+            {
+                i = p_size - 16;
+                unsigned l_found = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128((const __m128i*)(p_location + i)), l_byte
+                ));
+                if(l_found != 0)
+                {
+                    return i + __builtin_ctz(l_found);
+                }
+            }
+
+            return p_size;
+
+        }
+
+        constexpr MemoryKernels g_SSE2_KERNELS = {
+            MemoryKernelLevel::SSE2,
+            WriteBlockSSE2,
+            CopyForwardSSE2,
+            CopyBackwardSSE2,
+            CompareSSE2,
+            FindByteSSE2
+        };
+
+
+        __attribute__((target("avx2")))
+        void WriteBlockAVX2(Byte* p_location, Size p_size, const Byte* p_block, Size p_threshold)
+        {
+
+            if(p_size <= g_BLOCK_PERIOD)
+            {
+                CopyUpTo32(p_block, p_size, p_location);
+                return;
+            }
+
+            _mm256_storeu_si256((__m256i*)p_location, _mm256_loadu_si256((const __m256i*)p_block));
+            Size l_tailPhase = (p_size - 32) & (g_BLOCK_PERIOD - 1);
+            __m256i l_tail = _mm256_loadu_si256((const __m256i*)(p_block + l_tailPhase));
+
+            //Every aligned store has the same phase.
+            Size l_skip = 32 - ((uintptr_t)p_location & 31);
+            Byte* l_position = p_location + l_skip;
+            Byte* l_end = p_location + p_size;
+            __m256i l_vector = _mm256_loadu_si256((const __m256i*)(p_block + (l_skip & 31)));
+
+            if(p_size >= p_threshold)
+            {
+                for(; l_end - l_position >= 128; l_position += 128)
+                {
+                    _mm256_stream_si256((__m256i*)l_position, l_vector);
+                    _mm256_stream_si256((__m256i*)(l_position + 32), l_vector);
+                    _mm256_stream_si256((__m256i*)(l_position + 64), l_vector);
+                    _mm256_stream_si256((__m256i*)(l_position + 96), l_vector);
+                }
+                _mm_sfence();
+            }
+            for(; l_end - l_position >= 128; l_position += 128)
+            {
+                _mm256_store_si256((__m256i*)l_position, l_vector);
+                _mm256_store_si256((__m256i*)(l_position + 32), l_vector);
+                _mm256_store_si256((__m256i*)(l_position + 64), l_vector);
+                _mm256_store_si256((__m256i*)(l_position + 96), l_vector);
+            }
+            for(; l_end - l_position >= 32; l_position += 32)
+            {
+                _mm256_store_si256((__m256i*)l_position, l_vector);
+            }
+
+            _mm256_storeu_si256((__m256i*)(l_end - 32), l_tail);
+
+            _mm256_zeroupper();
+
+        }
+
+        __attribute__((target("avx2")))
+        void CopyForwardAVX2(const Byte* p_source, Size p_size, Byte* p_destination, Size p_threshold)
+        {
+
+            if(p_size <= 32)
+            {
+                CopyUpTo32(p_source, p_size, p_destination);
+                return;
+            }
+
+            __m256i l_head = _mm256_loadu_si256((const __m256i*)p_source);
+            __m256i l_tail = _mm256_loadu_si256((const __m256i*)(p_source + p_size - 32));
+
+            if(p_size <= 64)
+            {
+                _mm256_storeu_si256((__m256i*)p_destination, l_head);
+                _mm256_storeu_si256((__m256i*)(p_destination + p_size - 32), l_tail);
+                _mm256_zeroupper();
+                return;
+            }
+
+            Size l_skip = 32 - ((uintptr_t)p_destination & 31);
+            const Byte* l_source = p_source + l_skip;
+            Byte* l_destination = p_destination + l_skip;
+            Size l_left = p_size - l_skip;
+
+            if(p_size >= p_threshold)
+            {
+                for(; l_left >= 128; l_left -= 128, l_source += 128, l_destination += 128)
+                {
+                    __m256i l_0 = _mm256_loadu_si256((const __m256i*)l_source);
+                    __m256i l_1 = _mm256_loadu_si256((const __m256i*)(l_source + 32));
+                    __m256i l_2 = _mm256_loadu_si256((const __m256i*)(l_source + 64));
+                    __m256i l_3 = _mm256_loadu_si256((const __m256i*)(l_source + 96));
+                    _mm256_stream_si256((__m256i*)l_destination, l_0);
+                    _mm256_stream_si256((__m256i*)(l_destination + 32), l_1);
+                    _mm256_stream_si256((__m256i*)(l_destination + 64), l_2);
+                    _mm256_stream_si256((__m256i*)(l_destination + 96), l_3);
+                }
+                _mm_sfence();
+            }
+            for(; l_left > 128; l_left -= 128, l_source += 128, l_destination += 128)
+            {
+                __m256i l_0 = _mm256_loadu_si256((const __m256i*)l_source);
+                __m256i l_1 = _mm256_loadu_si256((const __m256i*)(l_source + 32));
+                __m256i l_2 = _mm256_loadu_si256((const __m256i*)(l_source + 64));
+                __m256i l_3 = _mm256_loadu_si256((const __m256i*)(l_source + 96));
+                _mm256_store_si256((__m256i*)l_destination, l_0);
+                _mm256_store_si256((__m256i*)(l_destination + 32), l_1);
+                _mm256_store_si256((__m256i*)(l_destination + 64), l_2);
+                _mm256_store_si256((__m256i*)(l_destination + 96), l_3);
+            }
+            for(; l_left > 32; l_left -= 32, l_source += 32, l_destination += 32)
+            {
+                _mm256_store_si256((__m256i*)l_destination, _mm256_loadu_si256((const __m256i*)l_source));
+            }
+
+            _mm256_storeu_si256((__m256i*)p_destination, l_head);
+            _mm256_storeu_si256((__m256i*)(p_destination + p_size - 32), l_tail);
+
+            _mm256_zeroupper();
+
+        }
+
+        __attribute__((target("avx2")))
+        void CopyBackwardAVX2(const Byte* p_source, Size p_size, Byte* p_destination)
+        {
+
+            if(p_size <= 32)
+            {
+                CopyUpTo32(p_source, p_size, p_destination);
+                return;
+            }
+
+            __m256i l_head = _mm256_loadu_si256((const __m256i*)p_source);
+            __m256i l_tail = _mm256_loadu_si256((const __m256i*)(p_source + p_size - 32));
+
+            if(p_size <= 64)
+            {
+                _mm256_storeu_si256((__m256i*)p_destination, l_head);
+                _mm256_storeu_si256((__m256i*)(p_destination + p_size - 32), l_tail);
+                _mm256_zeroupper();
+                return;
+            }
+
+            Size l_skip = (uintptr_t)(p_destination + p_size) & 31;
+            const Byte* l_source = p_source + p_size - l_skip;
+            Byte* l_destination = p_destination + p_size - l_skip;
+            Size l_left = p_size - l_skip;
+
+            for(; l_left > 128; l_left -= 128)
+            {
+                l_source -= 128;
+                l_destination -= 128;
+                __m256i l_0 = _mm256_loadu_si256((const __m256i*)(l_source + 96));
+                __m256i l_1 = _mm256_loadu_si256((const __m256i*)(l_source + 64));
+                __m256i l_2 = _mm256_loadu_si256((const __m256i*)(l_source + 32));
+                __m256i l_3 = _mm256_loadu_si256((const __m256i*)l_source);
+                _mm256_store_si256((__m256i*)(l_destination + 96), l_0);
+                _mm256_store_si256((__m256i*)(l_destination + 64), l_1);
+                _mm256_store_si256((__m256i*)(l_destination + 32), l_2);
+                _mm256_store_si256((__m256i*)l_destination, l_3);
+            }
+            for(; l_left > 32; l_left -= 32)
+            {
+                l_source -= 32;
+                l_destination -= 32;
+                _mm256_store_si256((__m256i*)l_destination, _mm256_loadu_si256((const __m256i*)l_source));
+            }
+
+            _mm256_storeu_si256((__m256i*)p_destination, l_head);
+            _mm256_storeu_si256((__m256i*)(p_destination + p_size - 32), l_tail);
+
+            _mm256_zeroupper();
+
+        }
+
+        __attribute__((target("avx2")))
+        inline int CompareVectorAVX2(const Byte* p_first, const Byte* p_second)
+        {
+            unsigned l_equal = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                _mm256_loadu_si256((const __m256i*)p_first),
+                _mm256_loadu_si256((const __m256i*)p_second)
+            ));
+            if(l_equal == 0xFFFFFFFF)
+            {
+                return 0;
+            }
+            unsigned l_index = (unsigned)__builtin_ctz(~l_equal);
+            return (int)p_first[l_index] - (int)p_second[l_index];
+        }
+        __attribute__((target("avx2")))
+        int CompareAVX2(const Byte* p_first, const Byte* p_second, Size p_size)
+        {
+
+            if(p_size < 32)
+            {
+                return CompareSSE2(p_first, p_second, p_size);
+            }
+
+            int l_result = 0;
+            Size i = 0;
+            //Four vectors are checked at once, the one that differs is only
+            //looked for once a difference is found.
+            for(; i + 128 <= p_size; i += 128)
+            {
+                __m256i l_0 = _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)(p_first + i)),
+                    _mm256_loadu_si256((const __m256i*)(p_second + i))
+                );
+                __m256i l_1 = _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)(p_first + i + 32)),
+                    _mm256_loadu_si256((const __m256i*)(p_second + i + 32))
+                );
+                __m256i l_2 = _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)(p_first + i + 64)),
+                    _mm256_loadu_si256((const __m256i*)(p_second + i + 64))
+                );
+                __m256i l_3 = _mm256_cmpeq_epi8(
+                    _mm256_loadu_si256((const __m256i*)(p_first + i + 96)),
+                    _mm256_loadu_si256((const __m256i*)(p_second + i + 96))
+                );
+                __m256i l_all = _mm256_and_si256(_mm256_and_si256(l_0, l_1), _mm256_and_si256(l_2, l_3));
+                if((unsigned)_mm256_movemask_epi8(l_all) != 0xFFFFFFFF)
+                {
+                    break;
+                }
+            }
+            for(; i + 32 <= p_size; i += 32)
+            {
+                l_result = CompareVectorAVX2(p_first + i, p_second + i);
+                if(l_result != 0)
+                {
+                    break;
+                }
+            }
+            if(l_result == 0 && i < p_size)
+            {
+                l_result = CompareVectorAVX2(p_first + p_size - 32, p_second + p_size - 32);
+            }
+
+            _mm256_zeroupper();
+            return l_result;
+
+        }
+
+        __attribute__((target("avx2")))
+        inline unsigned FindByteInVectorAVX2(const __m256i& p_byte, const Byte* p_location)
+        {
+            return (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                _mm256_loadu_si256((const __m256i*)p_location), p_byte
+            ));
+        }
+        __attribute__((target("avx2")))
+        Size FindByteAVX2(Byte p_byte, const Byte* p_location, Size p_size)
+        {
+
+            if(p_size < 32)
+            {
+                return FindByteSSE2(p_byte, p_location, p_size);
+            }
+
+            __m256i l_byte = _mm256_set1_epi8((char)p_byte);
+            Size l_result = p_size;
+            Size i = 0;
+            for(; i + 128 <= p_size; i += 128)
+            {
+                __m256i l_0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p_location + i)), l_byte);
+                __m256i l_1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p_location + i + 32)), l_byte);
+                __m256i l_2 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p_location + i + 64)), l_byte);
+                __m256i l_3 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p_location + i + 96)), l_byte);
+                __m256i l_any = _mm256_or_si256(_mm256_or_si256(l_0, l_1), _mm256_or_si256(l_2, l_3));
+                if(_mm256_movemask_epi8(l_any) != 0)
+                {
+                    break;
+                }
+            }
+            for(; i + 32 <= p_size; i += 32)
+            {
+                unsigned l_found = FindByteInVectorAVX2(l_byte, p_location + i);
+                if(l_found != 0)
+                {
+                    l_result = i + __builtin_ctz(l_found);
+                    break;
+                }
+            }
+            if(l_result == p_size && i < p_size)
+            {
+                i = p_size - 32;
+                unsigned l_found = FindByteInVectorAVX2(l_byte, p_location + i);
+                if(l_found != 0)
+                {
+                    l_result = i + __builtin_ctz(l_found);
+                }
+            }
+
+            _mm256_zeroupper();
+            return l_result;
+
+        }
+
+        constexpr MemoryKernels g_AVX2_KERNELS = {
+            MemoryKernelLevel::AVX2,
+            WriteBlockAVX2,
+            CopyForwardAVX2,
+            CopyBackwardAVX2,
+            CompareAVX2,
+            FindByteAVX2
+        };
+
+        #endif //MEMORY_X86_KERNELS
+
+
+        const MemoryKernels* FindKernelsOfLevel(const MemoryKernelLevel& p_level)
+        {
+            switch(p_level)
+            {
+            #ifdef MEMORY_X86_KERNELS
+            case MemoryKernelLevel::AVX2:
+                return &g_AVX2_KERNELS;
+            case MemoryKernelLevel::SSE2:
+                return &g_SSE2_KERNELS;
+            #endif //MEMORY_X86_KERNELS
+            default:
+                return &g_SCALAR_KERNELS;
+            }
+        }
+
+        std::atomic<const MemoryKernels*> g_Kernels(nullptr);
+        std::atomic<Size> g_NonTemporalThreshold(0);
+
+        const MemoryKernels& GetKernels()
+        {
+
+            const MemoryKernels* l_kernels = g_Kernels.load(std::memory_order_acquire);
+            if(l_kernels != nullptr)
+            {
+                return *l_kernels;
+            }
+
+            //Threads that get here at the same time all store the same values.
+            Size l_threshold = g_DEFAULT_NON_TEMPORAL_THRESHOLD;
+            #ifdef _SC_LEVEL3_CACHE_SIZE
+            long l_cacheSize = sysconf(_SC_LEVEL3_CACHE_SIZE);
+            if(l_cacheSize > 0)
+            {
+                //Anything bigger would push most of the cache out anyway.
+                l_threshold = (Size)l_cacheSize / 4 * 3;
+            }
+            #endif //_SC_LEVEL3_CACHE_SIZE
+            g_NonTemporalThreshold.store(l_threshold, std::memory_order_relaxed);
+
+            l_kernels = FindKernelsOfLevel(FindBestMemoryKernelLevel());
+            g_Kernels.store(l_kernels, std::memory_order_release);
+
+            return *l_kernels;
+
+        }
+        Size GetNonTemporalThreshold()
+        {
+            return g_NonTemporalThreshold.load(std::memory_order_relaxed);
+        }
+
+        //The copy of the pattern starting at offset 0, repeated g_BLOCK_SIZE
+        //bytes long. Only for patterns whose size divides g_BLOCK_PERIOD.
+        void FillBlockWithPattern(Byte* outp_block, const Byte* p_pattern, const Size& p_pattern_size)
+        {
+            memcpy(outp_block, p_pattern, p_pattern_size);
+            for(Size l_filled = p_pattern_size; l_filled < g_BLOCK_SIZE; l_filled *= 2)
+            {
+                memcpy(outp_block + l_filled, outp_block, l_filled);
+            }
+        }
+
+    }
+
+
+    MemoryKernelLevel FindBestMemoryKernelLevel()
+    {
+        #ifdef MEMORY_X86_KERNELS
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"))
+        {
+            return MemoryKernelLevel::AVX2;
+        }
+        return MemoryKernelLevel::SSE2;
+        #else
+        return MemoryKernelLevel::Scalar;
+        #endif //MEMORY_X86_KERNELS
+    }
+    MemoryKernelLevel GetMemoryKernelLevel()
+    {
+        return GetKernels().m_Level;
+    }
+    bool SetMemoryKernelLevel(const MemoryKernelLevel& p_level)
+    {
+
+        //Makes sure the threshold is found.
+        GetKernels();
+
+        if(p_level > FindBestMemoryKernelLevel())
+        {
+            return false;
+        }
+
+        g_Kernels.store(FindKernelsOfLevel(p_level), std::memory_order_release);
+        return true;
+
+    }
+
+
+    void WriteZerosToBytes(Byte* p_location, const Size& p_size)
+    {
+        static const Byte l_zeros[g_BLOCK_SIZE] = {};
+        const MemoryKernels& l_kernels = GetKernels();
+        l_kernels.m_WriteBlock(p_location, p_size, l_zeros, GetNonTemporalThreshold());
+    }
+
+    void WritePatternToBytes(
+        const Byte* p_pattern, const Size& p_pattern_size,
+        Byte* p_location, const Size& p_size
+    )
+    {
+
+        if(p_pattern_size == 0 || p_size == 0)
+        {
+            return;
+        }
+
+        const MemoryKernels& l_kernels = GetKernels();
+
+        if(p_pattern_size <= g_BLOCK_PERIOD && (p_pattern_size & (p_pattern_size - 1)) == 0)
+        {
+            Byte l_block[g_BLOCK_SIZE];
+            FillBlockWithPattern(l_block, p_pattern, p_pattern_size);
+            l_kernels.m_WriteBlock(p_location, p_size, l_block, GetNonTemporalThreshold());
+            return;
+        }
+
+        //Any other pattern is written once and then copied over itself, the
+        //copied chunk doubles until it is big enough to copy quickly but still
+        //fits in the cache.
+        Size l_written = p_pattern_size < p_size ? p_pattern_size : p_size;
+        l_kernels.m_CopyForward(p_pattern, l_written, p_location, SIZE_MAX);
+
+        Size l_chunk = l_written;
+        while(l_written < p_size)
+        {
+            Size l_toWrite = p_size - l_written;
+            if(l_toWrite > l_chunk)
+            {
+                l_toWrite = l_chunk;
+            }
+            l_kernels.m_CopyForward(p_location, l_toWrite, p_location + l_written, SIZE_MAX);
+            l_written += l_toWrite;
+            if(l_chunk < g_PATTERN_CHUNK_SIZE)
+            {
+                l_chunk = l_written;
+            }
+        }
+
+    }
+
+    void CopyBytesToLocation(const Byte* p_source, const Size& p_size, Byte* p_destination)
+    {
+        const MemoryKernels& l_kernels = GetKernels();
+        l_kernels.m_CopyForward(p_source, p_size, p_destination, GetNonTemporalThreshold());
+    }
+
+    void MoveBytesToLocation(const Byte* p_source, const Size& p_size, Byte* p_destination)
+    {
+
+        const MemoryKernels& l_kernels = GetKernels();
+
+        uintptr_t l_source = (uintptr_t)p_source;
+        uintptr_t l_destination = (uintptr_t)p_destination;
+
+        if(l_destination == l_source)
+        {
+            return;
+        }
+        if(l_destination - l_source >= p_size && l_source - l_destination >= p_size)
+        {
+            l_kernels.m_CopyForward(p_source, p_size, p_destination, GetNonTemporalThreshold());
+        }
+        else if(l_destination < l_source)
+        {
+            l_kernels.m_CopyForward(p_source, p_size, p_destination, SIZE_MAX);
+        }
+        else
+        {
+            l_kernels.m_CopyBackward(p_source, p_size, p_destination);
+        }
+
+    }
+
+    int CompareBytesToBytes(const Byte* p_first, const Byte* p_second, const Size& p_size)
+    {
+        if(p_first == p_second)
+        {
+            return 0;
+        }
+        return GetKernels().m_Compare(p_first, p_second, p_size);
+    }
+
+    Size FindIndexOfByteInBytes(const Byte& p_byte, const Byte* p_location, const Size& p_size)
+    {
+        return GetKernels().m_FindByte(p_byte, p_location, p_size);
+    }
+
+
+    void WriteZerosToMemory(const Memory& p_mem)
+    {
+        WriteZerosToBytes(p_mem.m_Location, p_mem.m_Size);
+    }
+    void WritePatternToMemory(const Byte* p_pattern, const Size& p_pattern_size, const Memory& p_mem)
+    {
+        WritePatternToBytes(p_pattern, p_pattern_size, p_mem.m_Location, p_mem.m_Size);
+    }
+    Size CopyMemoryToMemory(const Memory& p_source, const Memory& p_destination)
+    {
+        Size l_size = p_source.m_Size < p_destination.m_Size ? p_source.m_Size : p_destination.m_Size;
+        CopyBytesToLocation(p_source.m_Location, l_size, p_destination.m_Location);
+        return l_size;
+    }
+    Size MoveMemoryToMemory(const Memory& p_source, const Memory& p_destination)
+    {
+        Size l_size = p_source.m_Size < p_destination.m_Size ? p_source.m_Size : p_destination.m_Size;
+        MoveBytesToLocation(p_source.m_Location, l_size, p_destination.m_Location);
+        return l_size;
+    }
+    int CompareMemoryToMemory(const Memory& p_first, const Memory& p_second)
+    {
+
+        Size l_size = p_first.m_Size < p_second.m_Size ? p_first.m_Size : p_second.m_Size;
+        int l_result = CompareBytesToBytes(p_first.m_Location, p_second.m_Location, l_size);
+        if(l_result != 0)
+        {
+            return l_result;
+        }
+
+        //The shorter one comes first.
+        return (p_first.m_Size > p_second.m_Size) - (p_first.m_Size < p_second.m_Size);
+
+    }
+    Size FindIndexOfByteInMemory(const Byte& p_byte, const Memory& p_mem)
+    {
+        return FindIndexOfByteInBytes(p_byte, p_mem.m_Location, p_mem.m_Size);
+    }
+
+}
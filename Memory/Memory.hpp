@@ -1,3 +1,6 @@
+#ifndef MEMORY__MEMORY_MEMORY_HPP
+#define MEMORY__MEMORY_MEMORY_HPP
+
 #include "../Meta/Meta.hpp"
 
 namespace Library
@@ -8,32 +11,52 @@ namespace Library
 
         Byte* m_Location;
         Size m_Size;
+        //A power of two that m_Location is guaranteed to be a multiple of, 0
+        //if nothing is guaranteed. Memory allocators take it as the alignment
+        //wanted and overwrite it with the one given.
+        Size m_Alignment;
         Byte m_Permissions: 3;
 
 
         Memory():
         m_Location(nullptr),
         m_Size(0),
+        m_Alignment(0),
         m_Permissions(0)
         { }
         Memory(Byte* const& p_location, const Size& p_size, const Byte& p_permissions):
         m_Location(p_location),
         m_Size(p_size),
+        m_Alignment(0),
+        m_Permissions(p_permissions)
+        { }
+        Memory(
+            Byte* const& p_location,
+            const Size& p_size,
+            const Byte& p_permissions,
+            const Size& p_alignment
+        ):
+        m_Location(p_location),
+        m_Size(p_size),
+        m_Alignment(p_alignment),
         m_Permissions(p_permissions)
         { }
 
         Memory(const Memory& p_other):
         m_Location(p_other.m_Location),
         m_Size(p_other.m_Size),
+        m_Alignment(p_other.m_Alignment),
         m_Permissions(p_other.m_Permissions)
         { }
         Memory(Memory&& p_other):
         m_Location(p_other.m_Location),
         m_Size(p_other.m_Size),
+        m_Alignment(p_other.m_Alignment),
         m_Permissions(p_other.m_Permissions)
         {
             p_other.m_Location = nullptr;
             p_other.m_Size = 0;
+            p_other.m_Alignment = 0;
             p_other.m_Permissions = 0;
         }
 
@@ -43,6 +66,7 @@ namespace Library
 
             m_Location = p_other.m_Location;
             m_Size = p_other.m_Size;
+            m_Alignment = p_other.m_Alignment;
             m_Permissions = p_other.m_Permissions;
         
             return *this;
@@ -53,10 +77,12 @@ namespace Library
 
             m_Location = p_other.m_Location;
             m_Size = p_other.m_Size;
+            m_Alignment = p_other.m_Alignment;
             m_Permissions = p_other.m_Permissions;
         
             p_other.m_Location = nullptr;
             p_other.m_Size = 0;
+            p_other.m_Alignment = 0;
             p_other.m_Permissions = 0;
 
             return *this;
@@ -71,6 +97,8 @@ namespace Library
                 &&
                 m_Size == p_other.m_Size
                 &&
+                m_Alignment == p_other.m_Alignment
+                &&
                 m_Permissions == p_other.m_Permissions;
         }
         bool operator!=(const Memory& p_other)
@@ -96,17 +124,66 @@ namespace Library
     {
         return p_mem.m_Permissions & 0b100;
     }
+    //p_alignment must be a power of two. True if m_Alignment guarantees it,
+    //the location itself is not looked at.
+    inline bool MemoryIsAlignedTo(const Memory& p_mem, const Size& p_alignment)
+    {
+        return p_mem.m_Alignment >= p_alignment;
+    }
 
     //TODO: Functions that change permissions instead of having to do manual
     //bit wise operations
 
-    //TODO: Should not be inline
-    inline void WriteZerosToMemory(const Memory& p_mem)
+    //The instruction sets the functions bellow can use, each level can use
+    //all of the ones before it.
+    enum class MemoryKernelLevel : Byte
     {
-        for(Size i = 0; i < p_mem.m_Size; ++i)
-        {
-            p_mem.m_Location[i] = 0;
-        }
-    }
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    //The best level the CPU running the program supports.
+    MemoryKernelLevel FindBestMemoryKernelLevel();
+    //The level in use, the best one unless it was set.
+    MemoryKernelLevel GetMemoryKernelLevel();
+    //Returns false and changes nothing if the CPU does not support p_level.
+    //Meant for testing and benchmarking, affects every thread.
+    bool SetMemoryKernelLevel(const MemoryKernelLevel& p_level);
+
+    //These behave like memset, memcpy, memmove, memcmp and memchr. Buffers
+    //bigger than most of the last level cache are written around the cache,
+    //so writing them does not evict everything else.
+    void WriteZerosToBytes(Byte* p_location, const Size& p_size);
+    //p_pattern is repeated from p_location onwards, the last repetition is
+    //cut off if p_size is not a multiple of p_pattern_size. Patterns whose
+    //size is a power of two of up to 32 bytes are the fastest.
+    void WritePatternToBytes(
+        const Byte* p_pattern, const Size& p_pattern_size,
+        Byte* p_location, const Size& p_size
+    );
+    //The bytes must not overlap.
+    void CopyBytesToLocation(const Byte* p_source, const Size& p_size, Byte* p_destination);
+    //The bytes may overlap.
+    void MoveBytesToLocation(const Byte* p_source, const Size& p_size, Byte* p_destination);
+    //Less than, equal to or greater than 0 if the first mismatching byte of
+    //p_first is less than, equal to or greater than the one in p_second.
+    int CompareBytesToBytes(const Byte* p_first, const Byte* p_second, const Size& p_size);
+    //Returns p_size if p_byte is not found.
+    Size FindIndexOfByteInBytes(const Byte& p_byte, const Byte* p_location, const Size& p_size);
+
+    void WriteZerosToMemory(const Memory& p_mem);
+    void WritePatternToMemory(const Byte* p_pattern, const Size& p_pattern_size, const Memory& p_mem);
+    //Copies as many bytes as both can hold and returns their number.
+    Size CopyMemoryToMemory(const Memory& p_source, const Memory& p_destination);
+    //The same but the memories may overlap.
+    Size MoveMemoryToMemory(const Memory& p_source, const Memory& p_destination);
+    //Compares the bytes both have, if they are the same the smaller memory
+    //comes first.
+    int CompareMemoryToMemory(const Memory& p_first, const Memory& p_second);
+    //Returns p_mem.m_Size if p_byte is not found.
+    Size FindIndexOfByteInMemory(const Byte& p_byte, const Memory& p_mem);
 
 }
+
+#endif //MEMORY__MEMORY_MEMORY_HPP
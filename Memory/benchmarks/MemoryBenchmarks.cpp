@@ -0,0 +1,126 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "../Memory.hpp"
+
+using namespace Library;
+
+static const char* const g_LEVEL_NAMES[] = {"Scalar", "SSE2", "AVX2"};
+
+//Runs every kernel at every level the CPU supports on p_size bytes, along
+//with the C library function that does the same. Throughput is p_size
+//divided by the mean time.
+static void BenchmarkKernelsOnSize(const Size& p_size)
+{
+
+    //The source and the destination are right after each other, moving
+    //shifts the destination over itself by a few bytes.
+    Byte* l_buffer = (Byte*)malloc(2 * p_size + 64);
+    REQUIRE(l_buffer != nullptr);
+    Byte* l_source = l_buffer;
+    Byte* l_destination = l_buffer + p_size + 32;
+    memset(l_buffer, 1, 2 * p_size + 64);
+
+    const Byte l_pattern[4] = {1, 2, 3, 4};
+
+    for(int l_level = 0; l_level <= (int)FindBestMemoryKernelLevel(); ++l_level)
+    {
+        REQUIRE(SetMemoryKernelLevel((MemoryKernelLevel)l_level));
+        std::string l_name = g_LEVEL_NAMES[l_level];
+
+        BENCHMARK("Zeros " + l_name)
+        {
+            WriteZerosToBytes(l_destination, p_size);
+            return l_destination[0];
+        };
+        BENCHMARK("Pattern " + l_name)
+        {
+            WritePatternToBytes(l_pattern, 4, l_destination, p_size);
+            return l_destination[0];
+        };
+        BENCHMARK("Copy " + l_name)
+        {
+            CopyBytesToLocation(l_source, p_size, l_destination);
+            return l_destination[0];
+        };
+        BENCHMARK("Overlapping move " + l_name)
+        {
+            MoveBytesToLocation(l_destination, p_size - 1, l_destination + 1);
+            return l_destination[0];
+        };
+        BENCHMARK("Compare " + l_name)
+        {
+            return CompareBytesToBytes(l_source, l_destination, p_size);
+        };
+        BENCHMARK("Find byte " + l_name)
+        {
+            return FindIndexOfByteInBytes(7, l_source, p_size);
+        };
+    }
+    SetMemoryKernelLevel(FindBestMemoryKernelLevel());
+
+    BENCHMARK("Zeros memset")
+    {
+        memset(l_destination, 0, p_size);
+        return l_destination[0];
+    };
+    BENCHMARK("Copy memcpy")
+    {
+        memcpy(l_destination, l_source, p_size);
+        return l_destination[0];
+    };
+    BENCHMARK("Overlapping move memmove")
+    {
+        memmove(l_destination + 1, l_destination, p_size - 1);
+        return l_destination[0];
+    };
+    BENCHMARK("Compare memcmp")
+    {
+        return memcmp(l_source, l_destination, p_size);
+    };
+    BENCHMARK("Find byte memchr")
+    {
+        return memchr(l_source, 7, p_size);
+    };
+
+    free(l_buffer);
+
+}
+
+TEST_CASE("Memory kernels on 16B", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(16);
+}
+TEST_CASE("Memory kernels on 256B", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(256);
+}
+TEST_CASE("Memory kernels on 4KB", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(4 * 1024);
+}
+TEST_CASE("Memory kernels on 64KB", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(64 * 1024);
+}
+TEST_CASE("Memory kernels on 1MB", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(1024 * 1024);
+}
+TEST_CASE("Memory kernels on 16MB", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(16 * 1024 * 1024);
+}
+TEST_CASE("Memory kernels on 256MB", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(256 * 1024 * 1024);
+}
+TEST_CASE("Memory kernels on 1GB", "[Memory][Benchmark]")
+{
+    BenchmarkKernelsOnSize(1024 * 1024 * 1024);
+}
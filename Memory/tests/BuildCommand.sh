@@ -1 +1 @@
-g++ -Wall -Wextra -pedantic -g -O0 -std=c++17 -DDEBUG -o MemoryTests.test ../../Meta/Meta.cpp *.cpp 
\ No newline at end of file
+g++ -Wall -Wextra -pedantic -g -O0 -std=c++17 -DDEBUG -o MemoryTests.test ../../Meta/Meta.cpp ../Memory.cpp *.cpp 
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 
+#include <stdlib.h>
+#include <string.h>
 #include "../Memory.hpp"
 
 using namespace Library;
@@ -19,3 +21,121 @@ TEST_CASE("Memory permission checking", "[Memory][Immutable]")
     CHECK(MemoryIsExecutable(l_mem) == (bool)((l_permissions & 0b100) == 0b100));
 
 }
+
+
+TEST_CASE("Memory alignment checking", "[Memory][Immutable]")
+{
+
+    Byte* l_dummyLocation = (Byte*)0xdeadbec0;
+    Size l_dummySize = 2693420;
+    Size l_alignment = GENERATE(0, 1, 16, 64);
+
+    Memory l_mem(l_dummyLocation, l_dummySize, 0b011, l_alignment);
+
+    CHECK(MemoryIsAlignedTo(l_mem, 1) == (l_alignment >= 1));
+    CHECK(MemoryIsAlignedTo(l_mem, 16) == (l_alignment >= 16));
+    CHECK(MemoryIsAlignedTo(l_mem, 64) == (l_alignment >= 64));
+    CHECK_FALSE(MemoryIsAlignedTo(l_mem, 128));
+
+}
+
+
+TEST_CASE("Comparing bytes", "[Memory][Immutable]")
+{
+
+    MemoryKernelLevel l_level = (MemoryKernelLevel)GENERATE(range(0, 3));
+    if(l_level > FindBestMemoryKernelLevel())
+    {
+        l_level = FindBestMemoryKernelLevel();
+    }
+    REQUIRE(SetMemoryKernelLevel(l_level));
+
+    Size l_size = GENERATE(range(0, 100), 1000, 4099);
+    INFO("Level " << (int)l_level << ", size " << l_size);
+
+    Byte* l_first = (Byte*)malloc(l_size + 1);
+    Byte* l_second = (Byte*)malloc(l_size + 1);
+    REQUIRE(l_first != nullptr);
+    REQUIRE(l_second != nullptr);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_first[i] = l_second[i] = (Byte)(i * 7);
+    }
+
+    CHECK(CompareBytesToBytes(l_first, l_second, l_size) == 0);
+
+    for(Size i = 0; i < l_size; i += 1 + l_size / 17)
+    {
+        INFO("Mismatch at " << i);
+        Byte l_old = l_second[i];
+
+        l_second[i] = l_old + 1;
+        //The later mismatch must not matter.
+        l_second[l_size - 1] ^= (i == l_size - 1) ? 0 : 0x80;
+        CHECK(CompareBytesToBytes(l_first, l_second, l_size) < 0);
+        CHECK(CompareBytesToBytes(l_second, l_first, l_size) > 0);
+        CHECK((CompareBytesToBytes(l_first, l_second, l_size) < 0) == (memcmp(l_first, l_second, l_size) < 0));
+
+        l_second[l_size - 1] ^= (i == l_size - 1) ? 0 : 0x80;
+        l_second[i] = l_old;
+    }
+
+    free(l_first);
+    free(l_second);
+
+    SetMemoryKernelLevel(FindBestMemoryKernelLevel());
+
+}
+
+TEST_CASE("Comparing memory", "[Memory][Immutable]")
+{
+
+    Byte l_bytes[] = {1, 2, 3, 4};
+    Byte l_other[] = {1, 2, 4};
+
+    CHECK(CompareMemoryToMemory(Memory(l_bytes, 4, 0b001), Memory(l_bytes, 4, 0b001)) == 0);
+    CHECK(CompareMemoryToMemory(Memory(l_bytes, 3, 0b001), Memory(l_bytes, 4, 0b001)) < 0);
+    CHECK(CompareMemoryToMemory(Memory(l_bytes, 4, 0b001), Memory(l_bytes, 3, 0b001)) > 0);
+    CHECK(CompareMemoryToMemory(Memory(l_bytes, 4, 0b001), Memory(l_other, 3, 0b001)) < 0);
+    CHECK(CompareMemoryToMemory(Memory(), Memory()) == 0);
+
+}
+
+TEST_CASE("Finding bytes", "[Memory][Immutable]")
+{
+
+    MemoryKernelLevel l_level = (MemoryKernelLevel)GENERATE(range(0, 3));
+    if(l_level > FindBestMemoryKernelLevel())
+    {
+        l_level = FindBestMemoryKernelLevel();
+    }
+    REQUIRE(SetMemoryKernelLevel(l_level));
+
+    Size l_size = GENERATE(range(0, 100), 1000, 4099);
+    INFO("Level " << (int)l_level << ", size " << l_size);
+
+    Byte* l_bytes = (Byte*)malloc(l_size + 1);
+    REQUIRE(l_bytes != nullptr);
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_bytes[i] = (Byte)(i % 200);
+    }
+
+    CHECK(FindIndexOfByteInBytes(250, l_bytes, l_size) == l_size);
+    CHECK(FindIndexOfByteInMemory(250, Memory(l_bytes, l_size, 0b001)) == l_size);
+    for(Size i = 0; i < l_size && i < 200; i += 1 + l_size / 13)
+    {
+        INFO("i = " << i);
+        CHECK(FindIndexOfByteInBytes((Byte)i, l_bytes, l_size) == i);
+    }
+    if(l_size > 0)
+    {
+        l_bytes[l_size - 1] = 250;
+        CHECK(FindIndexOfByteInBytes(250, l_bytes, l_size) == l_size - 1);
+    }
+
+    free(l_bytes);
+
+    SetMemoryKernelLevel(FindBestMemoryKernelLevel());
+
+}
@@ -13,6 +13,7 @@ TEST_CASE("Default constructor", "[Memory][Member]")
 
     CHECK(l_mem.m_Location == nullptr);
     CHECK(l_mem.m_Size == 0);
+    CHECK(l_mem.m_Alignment == 0);
     CHECK(l_mem.m_Permissions == 0);
 
 }
@@ -28,6 +29,24 @@ TEST_CASE("Field constructor", "[Memory][Member]")
 
     CHECK(l_mem.m_Location == l_dummyLocation);
     CHECK(l_mem.m_Size == l_dummySize);
+    CHECK(l_mem.m_Alignment == 0);
+    CHECK(l_mem.m_Permissions == l_dummyPremissions);
+
+}
+
+TEST_CASE("Field constructor with alignment", "[Memory][Member]")
+{
+
+    Byte* l_dummyLocation = (Byte*)GENERATE(take(10, random(INTPTR_MIN, INTPTR_MAX)));
+    Size l_dummySize = GENERATE(take(10, random<Size>(0, SIZE_MAX)));;
+    Byte l_dummyPremissions = GENERATE(take(10, random(0, 7)));;
+    Size l_dummyAlignment = (Size)1 << GENERATE(take(10, random(0, 12)));
+
+    Memory l_mem(l_dummyLocation, l_dummySize, l_dummyPremissions, l_dummyAlignment);
+
+    CHECK(l_mem.m_Location == l_dummyLocation);
+    CHECK(l_mem.m_Size == l_dummySize);
+    CHECK(l_mem.m_Alignment == l_dummyAlignment);
     CHECK(l_mem.m_Permissions == l_dummyPremissions);
 
 }
@@ -39,7 +58,9 @@ TEST_CASE("Copying and moving", "[Memory][Member]")
     Size l_dummySize = GENERATE(take(10, random<Size>(0, SIZE_MAX)));;
     Byte l_dummyPremissions = GENERATE(take(10, random(0, 7)));;
 
-    Memory l_source(l_dummyLocation, l_dummySize, l_dummyPremissions);
+    Size l_dummyAlignment = (Size)1 << GENERATE(take(3, random(0, 12)));
+
+    Memory l_source(l_dummyLocation, l_dummySize, l_dummyPremissions, l_dummyAlignment);
     Memory l_destination;
 
     SECTION("Copying")
@@ -66,11 +87,13 @@ TEST_CASE("Copying and moving", "[Memory][Member]")
 
         CHECK(l_source.m_Location == nullptr);
         CHECK(l_source.m_Size == 0);
+        CHECK(l_source.m_Alignment == 0);
         CHECK(l_source.m_Permissions == 0);
     }
 
     CHECK(l_destination.m_Location == l_dummyLocation);
     CHECK(l_destination.m_Size == l_dummySize);
+    CHECK(l_destination.m_Alignment == l_dummyAlignment);
     CHECK(l_destination.m_Permissions == l_dummyPremissions);
 
 
@@ -86,13 +109,16 @@ TEST_CASE("Comparison", "[Memory][Member]")
     Memory l_mem(l_dummyLocation, l_dummySize, l_dummyPremissions);
     Memory l_same(l_dummyLocation, l_dummySize, l_dummyPremissions);
     Memory l_different(l_dummyLocation + 2, l_dummySize - 2, l_dummyPremissions & 1);
+    Memory l_differentAlignment(l_dummyLocation, l_dummySize, l_dummyPremissions, 64);
 
     CHECK((l_mem == l_same));
     CHECK_FALSE((l_mem == l_different));
     CHECK((l_mem == l_mem));
+    CHECK_FALSE((l_mem == l_differentAlignment));
 
     CHECK_FALSE((l_mem != l_same));
     CHECK((l_mem != l_different));
     CHECK_FALSE((l_mem != l_mem));
+    CHECK((l_mem != l_differentAlignment));
 
 }
@@ -0,0 +1,201 @@
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+#include "../Memory.hpp"
+
+using namespace Library;
+using namespace Catch::Generators;
+
+//Every level the CPU supports, the best one is set back after each test.
+static MemoryKernelLevel GenerateMemoryKernelLevel()
+{
+    MemoryKernelLevel l_level = (MemoryKernelLevel)GENERATE(range(0, 3));
+    if(l_level > FindBestMemoryKernelLevel())
+    {
+        l_level = FindBestMemoryKernelLevel();
+    }
+    REQUIRE(SetMemoryKernelLevel(l_level));
+    return l_level;
+}
+
+struct KernelLevelRestorer
+{
+    ~KernelLevelRestorer()
+    {
+        SetMemoryKernelLevel(FindBestMemoryKernelLevel());
+    }
+};
+
+static void WriteRandomBytes(Byte* p_location, const Size& p_size)
+{
+    for(Size i = 0; i < p_size; ++i)
+    {
+        p_location[i] = (Byte)rand();
+    }
+}
+
+TEST_CASE("Memory kernel levels", "[Memory][Mutable]")
+{
+
+    KernelLevelRestorer l_restorer;
+
+    CHECK(GetMemoryKernelLevel() == FindBestMemoryKernelLevel());
+    CHECK(SetMemoryKernelLevel(MemoryKernelLevel::Scalar));
+    CHECK(GetMemoryKernelLevel() == MemoryKernelLevel::Scalar);
+
+    if(FindBestMemoryKernelLevel() != MemoryKernelLevel::AVX2)
+    {
+        CHECK_FALSE(SetMemoryKernelLevel(MemoryKernelLevel::AVX2));
+        CHECK(GetMemoryKernelLevel() == MemoryKernelLevel::Scalar);
+    }
+
+}
+
+TEST_CASE("Writing zeros and patterns", "[Memory][Mutable]")
+{
+
+    KernelLevelRestorer l_restorer;
+    MemoryKernelLevel l_level = GenerateMemoryKernelLevel();
+    Size l_size = GENERATE(range(0, 200), 1000, 4099, 100000);
+    Size l_offset = GENERATE(0, 1, 7, 16, 31);
+    Size l_patternSize = GENERATE(1, 2, 3, 4, 8, 12, 16, 32, 33, 100);
+    INFO("Level " << (int)l_level << ", size " << l_size << ", offset "
+    << l_offset << ", pattern size " << l_patternSize);
+
+    //Guard bytes on both sides catch writes outside of the bytes.
+    Byte* l_buffer = (Byte*)malloc(l_size + l_offset + 64);
+    REQUIRE(l_buffer != nullptr);
+    memset(l_buffer, 0xcd, l_size + l_offset + 64);
+    Byte* l_location = l_buffer + l_offset;
+
+    Byte l_pattern[100];
+    WriteRandomBytes(l_pattern, l_patternSize);
+
+    SECTION("Zeros")
+    {
+        WriteZerosToMemory(Memory(l_location, l_size, 0b011));
+        Size i = 0;
+        while(i < l_size && l_location[i] == 0)
+        {
+            ++i;
+        }
+        CHECK(i == l_size);
+    }
+    SECTION("Pattern")
+    {
+        WritePatternToMemory(l_pattern, l_patternSize, Memory(l_location, l_size, 0b011));
+        Size i = 0;
+        while(i < l_size && l_location[i] == l_pattern[i % l_patternSize])
+        {
+            ++i;
+        }
+        CHECK(i == l_size);
+    }
+
+    for(Size i = 0; i < l_offset; ++i)
+    {
+        REQUIRE(l_buffer[i] == 0xcd);
+    }
+    for(Size i = 0; i < 64; ++i)
+    {
+        REQUIRE(l_location[l_size + i] == 0xcd);
+    }
+
+    free(l_buffer);
+
+}
+
+TEST_CASE("Copying and moving bytes", "[Memory][Mutable]")
+{
+
+    KernelLevelRestorer l_restorer;
+    MemoryKernelLevel l_level = GenerateMemoryKernelLevel();
+    Size l_size = GENERATE(range(0, 150), 255, 256, 257, 1000, 4099, 100000);
+    Size l_sourceOffset = GENERATE(0, 5, 32);
+    INFO("Level " << (int)l_level << ", size " << l_size << ", source offset "
+    << l_sourceOffset);
+
+    Size l_bufferSize = 2 * l_size + 128;
+    Byte* l_buffer = (Byte*)malloc(l_bufferSize);
+    Byte* l_expected = (Byte*)malloc(l_bufferSize);
+    REQUIRE(l_buffer != nullptr);
+    REQUIRE(l_expected != nullptr);
+    WriteRandomBytes(l_buffer, l_bufferSize);
+    Byte* l_source = l_buffer + l_sourceOffset;
+
+    SECTION("Copying")
+    {
+        Byte* l_destination = l_buffer + l_size + 64 + GENERATE(0, 3, 17);
+        memcpy(l_expected, l_buffer, l_bufferSize);
+        memcpy(l_expected + (l_destination - l_buffer), l_source, l_size);
+
+        CopyBytesToLocation(l_source, l_size, l_destination);
+    }
+    SECTION("Moving")
+    {
+        //Overlapping in both directions by different amounts.
+        long l_distance = GENERATE(-5, -1, 0, 1, 3, 16, 33);
+        if((long)l_sourceOffset + l_distance < 0)
+        {
+            l_distance = -(long)l_sourceOffset;
+        }
+        Byte* l_destination = l_buffer + (l_sourceOffset + l_distance);
+        memcpy(l_expected, l_buffer, l_bufferSize);
+        memmove(l_expected + (l_destination - l_buffer), l_source, l_size);
+
+        MoveBytesToLocation(l_source, l_size, l_destination);
+    }
+
+    REQUIRE(memcmp(l_buffer, l_expected, l_bufferSize) == 0);
+
+    free(l_buffer);
+    free(l_expected);
+
+}
+
+TEST_CASE("Copying and moving memory", "[Memory][Mutable]")
+{
+
+    Byte l_first[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    Byte l_second[] = {0, 0, 0, 0};
+
+    CHECK(CopyMemoryToMemory(Memory(l_first, 8, 0b011), Memory(l_second, 4, 0b011)) == 4);
+    CHECK(memcmp(l_first, l_second, 4) == 0);
+
+    CHECK(MoveMemoryToMemory(Memory(l_first, 6, 0b011), Memory(l_first + 2, 6, 0b011)) == 6);
+    Byte l_moved[] = {1, 2, 1, 2, 3, 4, 5, 6};
+    CHECK(memcmp(l_first, l_moved, 8) == 0);
+
+}
+
+TEST_CASE("Writing around the cache", "[Memory][Mutable]")
+{
+
+    //Big enough to be bigger than most of the last level cache of most
+    //machines, so the non temporal paths are taken.
+    Size l_size = 192 * 1024 * 1024 + 3;
+    Byte* l_buffer = (Byte*)malloc(2 * l_size);
+    REQUIRE(l_buffer != nullptr);
+    Byte* l_source = l_buffer;
+    Byte* l_destination = l_buffer + l_size;
+
+    Byte l_pattern[4] = {1, 2, 3, 4};
+    WritePatternToBytes(l_pattern, 4, l_source + 1, l_size - 1);
+    l_source[0] = 9;
+    CopyBytesToLocation(l_source, l_size, l_destination);
+
+    CHECK(l_destination[0] == 9);
+    bool l_same = true;
+    for(Size i = 1; i < l_size; ++i)
+    {
+        l_same &= l_destination[i] == l_pattern[(i - 1) % 4];
+    }
+    CHECK(l_same);
+
+    WriteZerosToBytes(l_destination, l_size);
+    CHECK(FindIndexOfByteInBytes(9, l_destination, l_size) == l_size);
+
+    free(l_buffer);
+
+}
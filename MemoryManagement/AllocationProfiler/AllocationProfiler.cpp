@@ -0,0 +1,752 @@
+/**
+ * @file AllocationProfiler.cpp
+ * @brief Defines everything in the @ref AllocationProfilerMod module.
+ *
+ * @details Every thread counts into its own table of counters, which is only
+ * read by other threads when statistics are asked for. The counters are
+ * atomics so that those reads are not data races, but only their owner writes
+ * to them, so counting is a plain load and store. The sites themselves are
+ * kept in a single table that is only locked when a new site is added.
+ *
+ */
+#include "AllocationProfiler.hpp"
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <atomic>
+#include <new>
+
+namespace Library
+{
+
+    //This is where the hidden global variables are stored.
+    namespace
+    {
+
+        struct alignas(g_ALLOCATION_PROFILER_HEADER_SIZE) AllocationProfilerHeader
+        {
+            Size m_Size;
+            //The id of the site.
+            Size m_Site;
+        };
+        static_assert(sizeof(AllocationProfilerHeader) == g_ALLOCATION_PROFILER_HEADER_SIZE);
+
+        //The site table is an open addressing hash table that is bigger than
+        //the number of sites it holds, so that probing stays short.
+        constexpr Size g_SITE_TABLE_SIZE = 2 * g_ALLOCATION_PROFILER_MAX_SITE_COUNT;
+        //Sites get ids in the order they are added, the overflow site gets
+        //the id after the last one.
+        constexpr Size g_OVERFLOW_SITE = g_ALLOCATION_PROFILER_MAX_SITE_COUNT;
+
+        //Threads only add their live bytes to the shared count once they
+        //changed by this much.
+        constexpr long long g_LIVE_BYTES_PUBLISH_THRESHOLD = 64 * 1024;
+
+        struct Site
+        {
+            //Written before m_IsReady is set and never after.
+            const char* m_Tag;
+            const void* m_CallSite;
+            Size m_Id;
+            std::atomic<bool> m_IsReady;
+        };
+
+        struct SiteCounters
+        {
+            std::atomic<Size> m_NumberOfAllocations;
+            std::atomic<Size> m_NumberOfReallocations;
+            std::atomic<Size> m_NumberOfDeallocations;
+            std::atomic<Size> m_AllocatedBytes;
+            std::atomic<Size> m_DeallocatedBytes;
+            std::atomic<Size> m_SizeHistogram[g_ALLOCATION_PROFILER_HISTOGRAM_SIZE];
+        };
+
+        struct ThreadProfile
+        {
+            //Indexed by the ids of the sites.
+            SiteCounters m_Sites[g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1];
+            //Only used by the owning thread.
+            long long m_UnpublishedLiveBytes;
+            ThreadProfile* m_NextProfile;
+            ThreadProfile* m_PreviousProfile;
+        };
+
+        //Constant initialized, so these are usable before any constructor
+        //runs and after every destructor ran.
+        Site g_Sites[g_SITE_TABLE_SIZE] = {};
+        Site* g_SitesById[g_ALLOCATION_PROFILER_MAX_SITE_COUNT] = {};
+        Size g_NumberOfSites = 0;
+        //Locks g_NumberOfSites, adding sites, the list of profiles and
+        //g_RetiredProfile.
+        pthread_mutex_t g_Mutex = PTHREAD_MUTEX_INITIALIZER;
+        ThreadProfile* g_FirstProfile = nullptr;
+        //The counts of threads that exited, and of threads that are exiting.
+        ThreadProfile g_RetiredProfile = {};
+
+        std::atomic<long long> g_PublishedLiveBytes(0);
+        std::atomic<Size> g_PeakLiveBytes(0);
+
+        thread_local ThreadProfile* g_ProfileOfThisThread = nullptr;
+        thread_local const char* g_TagOfThisThread = nullptr;
+        //The last site found by this thread, most allocations in a row come
+        //from the same one.
+        thread_local const char* g_LastTagOfThisThread = nullptr;
+        thread_local const void* g_LastCallSiteOfThisThread = nullptr;
+        //SIZE_MAX until the thread found its first site.
+        thread_local Size g_LastSiteOfThisThread = SIZE_MAX;
+        //Set once the thread starts exiting, from then on everything is
+        //counted in g_RetiredProfile.
+        thread_local bool g_ThisThreadIsExiting = false;
+
+        //Moves the counts of the thread it belongs to into g_RetiredProfile
+        //when that thread exits.
+        struct ThreadProfileRetirer
+        {
+            ~ThreadProfileRetirer();
+        };
+
+    }
+
+
+    static inline void AddToCounter(std::atomic<Size>& p_counter, const Size& p_amount)
+    {
+        p_counter.store(p_counter.load(std::memory_order_relaxed) + p_amount, std::memory_order_relaxed);
+    }
+
+    static void AddCountersToCounters(const SiteCounters& p_counters, SiteCounters& p_destination)
+    {
+
+        AddToCounter(p_destination.m_NumberOfAllocations, p_counters.m_NumberOfAllocations.load(std::memory_order_relaxed));
+        AddToCounter(p_destination.m_NumberOfReallocations, p_counters.m_NumberOfReallocations.load(std::memory_order_relaxed));
+        AddToCounter(p_destination.m_NumberOfDeallocations, p_counters.m_NumberOfDeallocations.load(std::memory_order_relaxed));
+        AddToCounter(p_destination.m_AllocatedBytes, p_counters.m_AllocatedBytes.load(std::memory_order_relaxed));
+        AddToCounter(p_destination.m_DeallocatedBytes, p_counters.m_DeallocatedBytes.load(std::memory_order_relaxed));
+        for(Size i = 0; i < g_ALLOCATION_PROFILER_HISTOGRAM_SIZE; ++i)
+        {
+            AddToCounter(p_destination.m_SizeHistogram[i], p_counters.m_SizeHistogram[i].load(std::memory_order_relaxed));
+        }
+
+    }
+
+    static void PublishLiveBytes(const long long& p_live_bytes)
+    {
+
+        long long l_liveBytes = g_PublishedLiveBytes.fetch_add(p_live_bytes, std::memory_order_relaxed) + p_live_bytes;
+        if(l_liveBytes <= 0)
+        {
+            return;
+        }
+
+        Size l_peak = g_PeakLiveBytes.load(std::memory_order_relaxed);
+        while(
+            (Size)l_liveBytes > l_peak &&
+            g_PeakLiveBytes.compare_exchange_weak(l_peak, (Size)l_liveBytes, std::memory_order_relaxed) == false
+        );
+
+    }
+
+    ThreadProfileRetirer::~ThreadProfileRetirer()
+    {
+
+        LogDebugLine("Retiring the allocation profile of this thread.");
+
+        ThreadProfile* l_profile = g_ProfileOfThisThread;
+        g_ThisThreadIsExiting = true;
+        g_ProfileOfThisThread = nullptr;
+
+        PublishLiveBytes(l_profile->m_UnpublishedLiveBytes);
+
+        pthread_mutex_lock(&g_Mutex);
+        for(Size i = 0; i <= g_ALLOCATION_PROFILER_MAX_SITE_COUNT; ++i)
+        {
+            AddCountersToCounters(l_profile->m_Sites[i], g_RetiredProfile.m_Sites[i]);
+        }
+        if(l_profile->m_PreviousProfile != nullptr)
+        {
+            l_profile->m_PreviousProfile->m_NextProfile = l_profile->m_NextProfile;
+        }
+        else
+        {
+            g_FirstProfile = l_profile->m_NextProfile;
+        }
+        if(l_profile->m_NextProfile != nullptr)
+        {
+            l_profile->m_NextProfile->m_PreviousProfile = l_profile->m_PreviousProfile;
+        }
+        pthread_mutex_unlock(&g_Mutex);
+
+        l_profile->~ThreadProfile();
+        free(l_profile);
+
+    }
+
+    //Returns the profile of the calling thread, making it if it has none.
+    //Returns null if it could not be made or if the thread is exiting, the
+    //caller must then count in g_RetiredProfile.
+    static ThreadProfile* GetProfileOfThisThread()
+    {
+
+        if(g_ProfileOfThisThread != nullptr || g_ThisThreadIsExiting)
+        {
+            return g_ProfileOfThisThread;
+        }
+
+        LogDebugLine("Making the allocation profile of this thread.");
+
+        void* l_location = malloc(sizeof(ThreadProfile));
+        if(l_location == nullptr)
+        {
+            return nullptr;
+        }
+        ThreadProfile* l_profile = new(l_location) ThreadProfile();
+
+        pthread_mutex_lock(&g_Mutex);
+        l_profile->m_NextProfile = g_FirstProfile;
+        if(g_FirstProfile != nullptr)
+        {
+            g_FirstProfile->m_PreviousProfile = l_profile;
+        }
+        g_FirstProfile = l_profile;
+        pthread_mutex_unlock(&g_Mutex);
+
+        g_ProfileOfThisThread = l_profile;
+
+        //Makes sure the retirer of the calling thread is constructed, so that
+        //its destructor runs when the thread exits.
+        thread_local ThreadProfileRetirer l_retirer;
+        (void)l_retirer;
+
+        return l_profile;
+
+    }
+
+    static inline Size HashSite(const char* const& p_tag, const void* const& p_call_site)
+    {
+
+        uintptr_t l_key = (uintptr_t)p_tag ^ (uintptr_t)p_call_site;
+        //Fibonacci hashing, the low bits of return addresses are not random.
+        return (Size)((l_key * (uintptr_t)11400714819323198485ull) >> 32) % g_SITE_TABLE_SIZE;
+
+    }
+
+    //Finds the id of the site in the shared table, adding it if it is new.
+    static Size FindSiteIdInTable(const char* p_tag, const void* p_call_site)
+    {
+
+        Size l_index = HashSite(p_tag, p_call_site);
+
+        //Sites are never removed, so a ready site can be compared without
+        //locking.
+        for(Size i = l_index; ; i = (i + 1) % g_SITE_TABLE_SIZE)
+        {
+            if(g_Sites[i].m_IsReady.load(std::memory_order_acquire) == false)
+            {
+                break;
+            }
+            if(g_Sites[i].m_Tag == p_tag && g_Sites[i].m_CallSite == p_call_site)
+            {
+                return g_Sites[i].m_Id;
+            }
+        }
+
+        pthread_mutex_lock(&g_Mutex);
+
+        Size i = l_index;
+        for(; g_Sites[i].m_IsReady.load(std::memory_order_relaxed); i = (i + 1) % g_SITE_TABLE_SIZE)
+        {
+            if(g_Sites[i].m_Tag == p_tag && g_Sites[i].m_CallSite == p_call_site)
+            {
+                pthread_mutex_unlock(&g_Mutex);
+                return g_Sites[i].m_Id;
+            }
+        }
+
+        if(g_NumberOfSites == g_ALLOCATION_PROFILER_MAX_SITE_COUNT)
+        {
+            LogDebugLine("There are too many sites, using the overflow site.");
+            pthread_mutex_unlock(&g_Mutex);
+            return g_OVERFLOW_SITE;
+        }
+
+        Size l_id = g_NumberOfSites;
+        LogDebugLine("Adding allocation site " << (const void*)p_tag << " "
+        << p_call_site << " with id " << l_id);
+
+        g_Sites[i].m_Tag = p_tag;
+        g_Sites[i].m_CallSite = p_call_site;
+        g_Sites[i].m_Id = l_id;
+        g_Sites[i].m_IsReady.store(true, std::memory_order_release);
+        g_SitesById[l_id] = &g_Sites[i];
+        ++g_NumberOfSites;
+
+        pthread_mutex_unlock(&g_Mutex);
+        return l_id;
+
+    }
+
+    //Finds the id of the site of p_tag, or of p_call_site if p_tag is null,
+    //adding it if it is new.
+    static Size FindSiteId(const char* p_tag, const void* p_call_site)
+    {
+
+        if(p_tag != nullptr)
+        {
+            p_call_site = nullptr;
+        }
+
+        if(
+            p_tag == g_LastTagOfThisThread &&
+            p_call_site == g_LastCallSiteOfThisThread &&
+            g_LastSiteOfThisThread != SIZE_MAX
+        )
+        {
+            return g_LastSiteOfThisThread;
+        }
+
+        Size l_id = FindSiteIdInTable(p_tag, p_call_site);
+        g_LastTagOfThisThread = p_tag;
+        g_LastCallSiteOfThisThread = p_call_site;
+        g_LastSiteOfThisThread = l_id;
+
+        return l_id;
+
+    }
+
+    //Counts p_allocated_bytes as allocated and p_deallocated_bytes as
+    //deallocated at p_site, and increases the p_count counter of the site.
+    static void CountAtSite(
+        const Size& p_site,
+        const Size& p_allocated_bytes,
+        const Size& p_deallocated_bytes,
+        std::atomic<Size> SiteCounters::* p_count
+    )
+    {
+
+        ThreadProfile* l_profile = GetProfileOfThisThread();
+        bool l_isRetired = l_profile == nullptr;
+        if(l_isRetired)
+        {
+            pthread_mutex_lock(&g_Mutex);
+            l_profile = &g_RetiredProfile;
+        }
+
+        SiteCounters& l_counters = l_profile->m_Sites[p_site];
+        AddToCounter(l_counters.*p_count, 1);
+        if(p_allocated_bytes != 0)
+        {
+            AddToCounter(l_counters.m_AllocatedBytes, p_allocated_bytes);
+            AddToCounter(l_counters.m_SizeHistogram[FindAllocationHistogramBucketOfSize(p_allocated_bytes)], 1);
+        }
+        if(p_deallocated_bytes != 0)
+        {
+            AddToCounter(l_counters.m_DeallocatedBytes, p_deallocated_bytes);
+        }
+
+        long long l_change = (long long)p_allocated_bytes - (long long)p_deallocated_bytes;
+        if(l_isRetired)
+        {
+            pthread_mutex_unlock(&g_Mutex);
+            PublishLiveBytes(l_change);
+            return;
+        }
+
+        l_profile->m_UnpublishedLiveBytes += l_change;
+        if(
+            l_profile->m_UnpublishedLiveBytes >= g_LIVE_BYTES_PUBLISH_THRESHOLD ||
+            l_profile->m_UnpublishedLiveBytes <= -g_LIVE_BYTES_PUBLISH_THRESHOLD
+        )
+        {
+            PublishLiveBytes(l_profile->m_UnpublishedLiveBytes);
+            l_profile->m_UnpublishedLiveBytes = 0;
+        }
+
+    }
+
+    //Allocates p_size bytes counted at p_call_site, or at the tag of the
+    //thread.
+    static void* AllocateAtCallSite(const Size& p_size, const void* p_call_site)
+    {
+
+        if(p_size > SIZE_MAX - g_ALLOCATION_PROFILER_HEADER_SIZE)
+        {
+            return nullptr;
+        }
+
+        AllocationProfilerHeader* l_header = (AllocationProfilerHeader*)malloc(
+            p_size + g_ALLOCATION_PROFILER_HEADER_SIZE
+        );
+        if(l_header == nullptr)
+        {
+            return nullptr;
+        }
+
+        l_header->m_Size = p_size;
+        l_header->m_Site = FindSiteId(g_TagOfThisThread, p_call_site);
+        CountAtSite(l_header->m_Site, p_size, 0, &SiteCounters::m_NumberOfAllocations);
+
+        return l_header + 1;
+
+    }
+
+    #if defined(__GNUC__)
+    #define ALLOCATION_PROFILER_CALL_SITE __builtin_return_address(0)
+    #else
+    #define ALLOCATION_PROFILER_CALL_SITE nullptr
+    #endif
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const AllocationSiteStatistics& p_statistics)
+    {
+
+        p_log << (void*)&p_statistics;
+        p_log << " { m_Tag = " << (const void*)p_statistics.m_Tag;
+        p_log << ", m_CallSite = " << p_statistics.m_CallSite;
+        p_log << ", m_NumberOfAllocations = " << p_statistics.m_NumberOfAllocations;
+        p_log << ", m_NumberOfReallocations = " << p_statistics.m_NumberOfReallocations;
+        p_log << ", m_NumberOfDeallocations = " << p_statistics.m_NumberOfDeallocations;
+        p_log << ", m_AllocatedBytes = " << p_statistics.m_AllocatedBytes;
+        p_log << ", m_DeallocatedBytes = " << p_statistics.m_DeallocatedBytes;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const AllocationStatistics& p_statistics)
+    {
+
+        p_log << (void*)&p_statistics;
+        p_log << " { m_NumberOfAllocations = " << p_statistics.m_NumberOfAllocations;
+        p_log << ", m_NumberOfReallocations = " << p_statistics.m_NumberOfReallocations;
+        p_log << ", m_NumberOfDeallocations = " << p_statistics.m_NumberOfDeallocations;
+        p_log << ", m_AllocatedBytes = " << p_statistics.m_AllocatedBytes;
+        p_log << ", m_DeallocatedBytes = " << p_statistics.m_DeallocatedBytes;
+        p_log << ", m_LiveBytes = " << p_statistics.m_LiveBytes;
+        p_log << ", m_PeakLiveBytes = " << p_statistics.m_PeakLiveBytes;
+        p_log << ", m_NumberOfSites = " << p_statistics.m_NumberOfSites;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+
+    Size FindAllocationHistogramBucketOfSize(const Size& p_size)
+    {
+
+        if(p_size <= 16)
+        {
+            return 0;
+        }
+
+        //The number of bits needed for p_size - 1 is the power of 2 that
+        //p_size rounds up to.
+        #if defined(__GNUC__)
+        Size l_power = sizeof(unsigned long long) * CHAR_BIT - __builtin_clzll((unsigned long long)(p_size - 1));
+        #else
+        Size l_power = 0;
+        for(Size l_rest = p_size - 1; l_rest != 0; l_rest >>= 1)
+        {
+            ++l_power;
+        }
+        #endif
+        Size l_bucket = l_power - 4;
+        return l_bucket < g_ALLOCATION_PROFILER_HISTOGRAM_SIZE ? l_bucket : g_ALLOCATION_PROFILER_HISTOGRAM_SIZE - 1;
+
+    }
+
+    Size FindBiggestSizeOfAllocationHistogramBucket(const Size& p_bucket)
+    {
+
+        if(p_bucket == g_ALLOCATION_PROFILER_HISTOGRAM_SIZE - 1)
+        {
+            return SIZE_MAX;
+        }
+        return (Size)16 << p_bucket;
+
+    }
+
+
+    const char* const g_ALLOCATION_PROFILER_OVERFLOW_TAG = "Other sites";
+
+    void* ProfilingMalloc(Size p_size)
+    {
+        return AllocateAtCallSite(p_size, ALLOCATION_PROFILER_CALL_SITE);
+    }
+
+    void* ProfilingRealloc(void* p_location, Size p_size)
+    {
+
+        if(p_location == nullptr)
+        {
+            return AllocateAtCallSite(p_size, ALLOCATION_PROFILER_CALL_SITE);
+        }
+        if(p_size == 0)
+        {
+            ProfilingFree(p_location);
+            return nullptr;
+        }
+        if(p_size > SIZE_MAX - g_ALLOCATION_PROFILER_HEADER_SIZE)
+        {
+            return nullptr;
+        }
+
+        Size l_newSite = FindSiteId(g_TagOfThisThread, ALLOCATION_PROFILER_CALL_SITE);
+
+        AllocationProfilerHeader* l_header = (AllocationProfilerHeader*)realloc(
+            (AllocationProfilerHeader*)p_location - 1,
+            p_size + g_ALLOCATION_PROFILER_HEADER_SIZE
+        );
+        if(l_header == nullptr)
+        {
+            return nullptr;
+        }
+
+        if(l_header->m_Site == l_newSite)
+        {
+            CountAtSite(l_newSite, p_size, l_header->m_Size, &SiteCounters::m_NumberOfReallocations);
+        }
+        else
+        {
+            CountAtSite(l_newSite, p_size, 0, &SiteCounters::m_NumberOfReallocations);
+            ThreadProfile* l_profile = GetProfileOfThisThread();
+            if(l_profile != nullptr)
+            {
+                //Not counted as a deallocation, only the bytes move.
+                AddToCounter(l_profile->m_Sites[l_header->m_Site].m_DeallocatedBytes, l_header->m_Size);
+                l_profile->m_UnpublishedLiveBytes -= l_header->m_Size;
+            }
+            else
+            {
+                pthread_mutex_lock(&g_Mutex);
+                AddToCounter(g_RetiredProfile.m_Sites[l_header->m_Site].m_DeallocatedBytes, l_header->m_Size);
+                pthread_mutex_unlock(&g_Mutex);
+                PublishLiveBytes(-(long long)l_header->m_Size);
+            }
+        }
+
+        l_header->m_Size = p_size;
+        l_header->m_Site = l_newSite;
+
+        return l_header + 1;
+
+    }
+
+    void ProfilingFree(void* p_location)
+    {
+
+        if(p_location == nullptr)
+        {
+            return;
+        }
+
+        AllocationProfilerHeader* l_header = (AllocationProfilerHeader*)p_location - 1;
+        CountAtSite(l_header->m_Site, 0, l_header->m_Size, &SiteCounters::m_NumberOfDeallocations);
+        free(l_header);
+
+    }
+
+
+    const char* SetAllocationTagOfThisThread(const char* p_tag)
+    {
+        const char* l_previousTag = g_TagOfThisThread;
+        g_TagOfThisThread = p_tag;
+        return l_previousTag;
+    }
+
+    const char* GetAllocationTagOfThisThread()
+    {
+        return g_TagOfThisThread;
+    }
+
+
+    //Adds up the counters of p_site in every profile, g_Mutex must be locked.
+    static void AddUpCountersOfSite(const Size& p_site, AllocationSiteStatistics& outp_statistics)
+    {
+
+        SiteCounters l_total = {};
+        AddCountersToCounters(g_RetiredProfile.m_Sites[p_site], l_total);
+        for(ThreadProfile* l_profile = g_FirstProfile; l_profile != nullptr; l_profile = l_profile->m_NextProfile)
+        {
+            AddCountersToCounters(l_profile->m_Sites[p_site], l_total);
+        }
+
+        outp_statistics.m_NumberOfAllocations = l_total.m_NumberOfAllocations.load(std::memory_order_relaxed);
+        outp_statistics.m_NumberOfReallocations = l_total.m_NumberOfReallocations.load(std::memory_order_relaxed);
+        outp_statistics.m_NumberOfDeallocations = l_total.m_NumberOfDeallocations.load(std::memory_order_relaxed);
+        outp_statistics.m_AllocatedBytes = l_total.m_AllocatedBytes.load(std::memory_order_relaxed);
+        outp_statistics.m_DeallocatedBytes = l_total.m_DeallocatedBytes.load(std::memory_order_relaxed);
+        for(Size i = 0; i < g_ALLOCATION_PROFILER_HISTOGRAM_SIZE; ++i)
+        {
+            outp_statistics.m_SizeHistogram[i] = l_total.m_SizeHistogram[i].load(std::memory_order_relaxed);
+        }
+
+    }
+
+    Size FindAllocationStatisticsOfSites(AllocationSiteStatistics* outp_sites, const Size& p_capacity)
+    {
+
+        LogDebugLine("Finding the statistics of every allocation site.");
+
+        Size l_numberOfSites = 0;
+
+        pthread_mutex_lock(&g_Mutex);
+        for(Size i = 0; i <= g_ALLOCATION_PROFILER_MAX_SITE_COUNT; ++i)
+        {
+            if(i != g_OVERFLOW_SITE && i >= g_NumberOfSites)
+            {
+                continue;
+            }
+
+            AllocationSiteStatistics l_statistics;
+            AddUpCountersOfSite(i, l_statistics);
+            if(i == g_OVERFLOW_SITE)
+            {
+                if(l_statistics.m_NumberOfAllocations == 0 && l_statistics.m_NumberOfReallocations == 0)
+                {
+                    continue;
+                }
+                l_statistics.m_Tag = g_ALLOCATION_PROFILER_OVERFLOW_TAG;
+            }
+            else
+            {
+                l_statistics.m_Tag = g_SitesById[i]->m_Tag;
+                l_statistics.m_CallSite = g_SitesById[i]->m_CallSite;
+            }
+
+            if(l_numberOfSites < p_capacity)
+            {
+                outp_sites[l_numberOfSites] = l_statistics;
+            }
+            ++l_numberOfSites;
+        }
+        pthread_mutex_unlock(&g_Mutex);
+
+        return l_numberOfSites;
+
+    }
+
+    void FindAllocationStatistics(AllocationStatistics& outp_statistics)
+    {
+
+        LogDebugLine("Finding the allocation statistics.");
+
+        AllocationSiteStatistics* l_sites = (AllocationSiteStatistics*)malloc(
+            sizeof(AllocationSiteStatistics) * (g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1)
+        );
+        outp_statistics = AllocationStatistics();
+        if(l_sites == nullptr)
+        {
+            return;
+        }
+
+        Size l_numberOfSites = FindAllocationStatisticsOfSites(l_sites, g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1);
+        for(Size i = 0; i < l_numberOfSites; ++i)
+        {
+            outp_statistics.m_NumberOfAllocations += l_sites[i].m_NumberOfAllocations;
+            outp_statistics.m_NumberOfReallocations += l_sites[i].m_NumberOfReallocations;
+            outp_statistics.m_NumberOfDeallocations += l_sites[i].m_NumberOfDeallocations;
+            outp_statistics.m_AllocatedBytes += l_sites[i].m_AllocatedBytes;
+            outp_statistics.m_DeallocatedBytes += l_sites[i].m_DeallocatedBytes;
+        }
+        free(l_sites);
+
+        outp_statistics.m_NumberOfSites = l_numberOfSites;
+        outp_statistics.m_LiveBytes = outp_statistics.m_AllocatedBytes - outp_statistics.m_DeallocatedBytes;
+        outp_statistics.m_PeakLiveBytes = g_PeakLiveBytes.load(std::memory_order_relaxed);
+        if(outp_statistics.m_PeakLiveBytes < outp_statistics.m_LiveBytes)
+        {
+            outp_statistics.m_PeakLiveBytes = outp_statistics.m_LiveBytes;
+        }
+
+    }
+
+    static int CompareAllocatedBytesOfSites(const void* p_first, const void* p_second)
+    {
+
+        Size l_first = ((const AllocationSiteStatistics*)p_first)->m_AllocatedBytes;
+        Size l_second = ((const AllocationSiteStatistics*)p_second)->m_AllocatedBytes;
+        return (l_first < l_second) - (l_first > l_second);
+
+    }
+
+    void WriteAllocationReportToFile(FILE* p_file)
+    {
+
+        LogDebugLine("Writing the allocation report.");
+
+        AllocationStatistics l_statistics;
+        FindAllocationStatistics(l_statistics);
+
+        fprintf(
+            p_file,
+            "Allocations: %zu, reallocations: %zu, deallocations: %zu\n"
+            "Allocated bytes: %zu, deallocated bytes: %zu\n"
+            "Live bytes: %zu, peak live bytes: %zu\n",
+            l_statistics.m_NumberOfAllocations,
+            l_statistics.m_NumberOfReallocations,
+            l_statistics.m_NumberOfDeallocations,
+            l_statistics.m_AllocatedBytes,
+            l_statistics.m_DeallocatedBytes,
+            l_statistics.m_LiveBytes,
+            l_statistics.m_PeakLiveBytes
+        );
+
+        AllocationSiteStatistics* l_sites = (AllocationSiteStatistics*)malloc(
+            sizeof(AllocationSiteStatistics) * (g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1)
+        );
+        if(l_sites == nullptr)
+        {
+            return;
+        }
+        Size l_numberOfSites = FindAllocationStatisticsOfSites(l_sites, g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1);
+        qsort(l_sites, l_numberOfSites, sizeof(AllocationSiteStatistics), CompareAllocatedBytesOfSites);
+
+        for(Size i = 0; i < l_numberOfSites; ++i)
+        {
+            const AllocationSiteStatistics& l_site = l_sites[i];
+
+            fprintf(p_file, "\n");
+            if(l_site.m_Tag != nullptr)
+            {
+                fprintf(p_file, "Site \"%s\":\n", l_site.m_Tag);
+            }
+            else
+            {
+                fprintf(p_file, "Site %p:\n", l_site.m_CallSite);
+            }
+            fprintf(
+                p_file,
+                "    Allocations: %zu, reallocations: %zu, deallocations: %zu\n"
+                "    Allocated bytes: %zu, live bytes: %zu\n"
+                "    Sizes:",
+                l_site.m_NumberOfAllocations,
+                l_site.m_NumberOfReallocations,
+                l_site.m_NumberOfDeallocations,
+                l_site.m_AllocatedBytes,
+                l_site.m_AllocatedBytes - l_site.m_DeallocatedBytes
+            );
+            for(Size j = 0; j < g_ALLOCATION_PROFILER_HISTOGRAM_SIZE; ++j)
+            {
+                if(l_site.m_SizeHistogram[j] == 0)
+                {
+                    continue;
+                }
+                if(j == g_ALLOCATION_PROFILER_HISTOGRAM_SIZE - 1)
+                {
+                    fprintf(p_file, " >%zu: %zu", FindBiggestSizeOfAllocationHistogramBucket(j - 1), l_site.m_SizeHistogram[j]);
+                }
+                else
+                {
+                    fprintf(p_file, " <=%zu: %zu", FindBiggestSizeOfAllocationHistogramBucket(j), l_site.m_SizeHistogram[j]);
+                }
+            }
+            fprintf(p_file, "\n");
+        }
+
+        free(l_sites);
+
+    }
+
+}
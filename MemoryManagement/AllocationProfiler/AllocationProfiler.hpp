@@ -0,0 +1,327 @@
+/**
+ * @file AllocationProfiler.hpp
+ * @brief Declares everything in the @ref AllocationProfilerMod module.
+ *
+ * @details Everything is defined in AllocationProfiler.cpp.
+ *
+ */
+#ifndef ALLOCATION_PROFILER__MEMORY_MANAGEMENT_ALLOCATION_PROFILER_ALLOCATION_PROFILER_HPP
+#define ALLOCATION_PROFILER__MEMORY_MANAGEMENT_ALLOCATION_PROFILER_ALLOCATION_PROFILER_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+#include <stdio.h>
+
+namespace Library
+{
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief The number of bytes in front of every location given out by
+     * @ref ProfilingMalloc, used to remember its size and site.
+     *
+     */
+    constexpr Size g_ALLOCATION_PROFILER_HEADER_SIZE = alignof(max_align_t);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief The most sites that are told apart.
+     *
+     * @details Once there are this many sites every new one is counted as
+     * part of a single overflow site, which is reported with the tag
+     * @ref g_ALLOCATION_PROFILER_OVERFLOW_TAG.
+     *
+     */
+    constexpr Size g_ALLOCATION_PROFILER_MAX_SITE_COUNT = 256;
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief The number of buckets in the size histogram of a site.
+     *
+     * @details The first bucket counts sizes of up to 16 bytes, each bucket
+     * after it counts sizes of up to twice as many bytes as the one before
+     * it, and the last one counts everything bigger.
+     *
+     */
+    constexpr Size g_ALLOCATION_PROFILER_HISTOGRAM_SIZE = 20;
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief The tag of the site that counts everything after
+     * @ref g_ALLOCATION_PROFILER_MAX_SITE_COUNT sites were found.
+     *
+     */
+    extern const char* const g_ALLOCATION_PROFILER_OVERFLOW_TAG;
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief The statistics of every allocation made at a site.
+     *
+     * @details A site is either a tag given with
+     * @ref SetAllocationTagOfThisThread or, if there was no tag, the location
+     * that called the profiler. The live bytes of a site are
+     * m_AllocatedBytes - m_DeallocatedBytes.
+     *
+     * Reallocating counts as deallocating the old bytes and allocating the
+     * new ones, the new ones are counted at the site of the reallocation.
+     * Deallocating is counted at the site that made the allocation.
+     *
+     */
+    struct AllocationSiteStatistics
+    {
+
+        /**
+         * @brief The tag of the site, null if the site is a call site.
+         *
+         */
+        const char* m_Tag;
+        /**
+         * @brief The location that called the profiler, null if the site is a
+         * tag.
+         *
+         * @details This is a return address, tools like addr2line can turn it
+         * into a line of code.
+         *
+         */
+        const void* m_CallSite;
+
+        Size m_NumberOfAllocations;
+        Size m_NumberOfReallocations;
+        Size m_NumberOfDeallocations;
+        Size m_AllocatedBytes;
+        Size m_DeallocatedBytes;
+        /**
+         * @brief The number of allocations and reallocations of each size, see
+         * @ref FindAllocationHistogramBucketOfSize.
+         *
+         */
+        Size m_SizeHistogram[g_ALLOCATION_PROFILER_HISTOGRAM_SIZE];
+
+
+        /**
+         * @brief Constructs the statistics of a site with no allocations.
+         *
+         */
+        AllocationSiteStatistics():
+        m_Tag(nullptr),
+        m_CallSite(nullptr),
+        m_NumberOfAllocations(0),
+        m_NumberOfReallocations(0),
+        m_NumberOfDeallocations(0),
+        m_AllocatedBytes(0),
+        m_DeallocatedBytes(0),
+        m_SizeHistogram()
+        {
+        }
+
+    };
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief The statistics of every allocation made through the profiler.
+     *
+     */
+    struct AllocationStatistics
+    {
+
+        Size m_NumberOfAllocations;
+        Size m_NumberOfReallocations;
+        Size m_NumberOfDeallocations;
+        Size m_AllocatedBytes;
+        Size m_DeallocatedBytes;
+        /**
+         * @brief The bytes that are currently allocated.
+         *
+         */
+        Size m_LiveBytes;
+        /**
+         * @brief The most bytes that were allocated at once.
+         *
+         * @details Threads only share their live bytes once they changed by
+         * 64 KB, so this can miss up to 64 KB per thread.
+         *
+         */
+        Size m_PeakLiveBytes;
+        /**
+         * @brief The number of sites that allocated anything.
+         *
+         */
+        Size m_NumberOfSites;
+
+
+        /**
+         * @brief Constructs statistics with no allocations.
+         *
+         */
+        AllocationStatistics():
+        m_NumberOfAllocations(0),
+        m_NumberOfReallocations(0),
+        m_NumberOfDeallocations(0),
+        m_AllocatedBytes(0),
+        m_DeallocatedBytes(0),
+        m_LiveBytes(0),
+        m_PeakLiveBytes(0),
+        m_NumberOfSites(0)
+        {
+        }
+
+    };
+
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Finds the histogram bucket that counts allocations of p_size
+     * bytes.
+     *
+     * @time O(1).
+     *
+     */
+    Size FindAllocationHistogramBucketOfSize(const Size& p_size);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Finds the biggest size counted by p_bucket, SIZE_MAX for the last
+     * bucket.
+     *
+     * @warning p_bucket must be less than
+     * @ref g_ALLOCATION_PROFILER_HISTOGRAM_SIZE.
+     *
+     */
+    Size FindBiggestSizeOfAllocationHistogramBucket(const Size& p_bucket);
+
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief An @ref Allocator that counts the allocation and then gives it
+     * to malloc, behaves like malloc.
+     *
+     * @details The allocation is counted at the tag of the calling thread, or
+     * at the caller if the thread has no tag. Counting only touches counters
+     * of the calling thread, no locks are taken apart from the first time a
+     * site or a thread is seen.
+     *
+     * @return The allocated location or null on failure. The location is
+     * aligned to @ref g_ALLOCATION_PROFILER_HEADER_SIZE.
+     *
+     * @time O(1), on top of malloc.
+     *
+     */
+    void* ProfilingMalloc(Size p_size);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief A @ref Reallocator for locations from @ref ProfilingMalloc,
+     * behaves like realloc.
+     *
+     * @details If p_location is null this is the same as
+     * @ref ProfilingMalloc. If p_size is 0 p_location is deallocated and null
+     * is returned. On failure null is returned, p_location is unchanged and
+     * nothing is counted.
+     *
+     */
+    void* ProfilingRealloc(void* p_location, Size p_size);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief A @ref Deallocator for locations from @ref ProfilingMalloc and
+     * @ref ProfilingRealloc.
+     *
+     * @details The deallocation is counted at the site that made the
+     * allocation. Does nothing if p_location is null.
+     *
+     */
+    void ProfilingFree(void* p_location);
+
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Makes the calling thread count its allocations at p_tag instead
+     * of their callers. Returns the tag it had before.
+     *
+     * @details Tags are told apart by their location, not by their contents.
+     * A null tag goes back to counting at the callers.
+     *
+     * @warning p_tag must live for as long as the program, string literals
+     * are the intended use.
+     *
+     */
+    const char* SetAllocationTagOfThisThread(const char* p_tag);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Returns the tag of the calling thread, null if it has none.
+     *
+     */
+    const char* GetAllocationTagOfThisThread();
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Tags the allocations of the calling thread for as long as it
+     * lives.
+     *
+     * @details The tag the thread had before is given back when this is
+     * destructed.
+     *
+     */
+    struct ScopedAllocationTag
+    {
+
+        /**
+         * @brief The tag to give back to the thread.
+         *
+         */
+        const char* m_PreviousTag;
+
+
+        ScopedAllocationTag(const char* p_tag):
+        m_PreviousTag(SetAllocationTagOfThisThread(p_tag))
+        {
+            LogDebugLine("Constructed scoped allocation tag at " << (void*)this);
+        }
+        ScopedAllocationTag(const ScopedAllocationTag& p_other) = delete;
+        ScopedAllocationTag(ScopedAllocationTag&& p_other) = delete;
+
+        ~ScopedAllocationTag()
+        {
+            SetAllocationTagOfThisThread(m_PreviousTag);
+        }
+
+    };
+
+
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Adds up the counters of every thread and writes the totals to
+     * outp_statistics.
+     *
+     * @details Threads keep counting while this runs, so counts made during
+     * it may or may not be included.
+     *
+     * @time O(n * m), n being the number of threads and m the number of sites.
+     *
+     */
+    void FindAllocationStatistics(AllocationStatistics& outp_statistics);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Writes the statistics of up to p_capacity sites to outp_sites
+     * and returns the number of sites there are.
+     *
+     * @details The sites are in no particular order. If the returned number
+     * is bigger than p_capacity only the first p_capacity sites were written,
+     * at most @ref g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1 sites can exist.
+     *
+     * @time O(n * m), n being the number of threads and m the number of sites.
+     *
+     */
+    Size FindAllocationStatisticsOfSites(AllocationSiteStatistics* outp_sites, const Size& p_capacity);
+    /**
+     * @ingroup AllocationProfilerMod
+     * @brief Writes a readable report of the totals and of every site to
+     * p_file, the sites with the most allocated bytes first.
+     *
+     */
+    void WriteAllocationReportToFile(FILE* p_file);
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const AllocationSiteStatistics& p_statistics);
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const AllocationStatistics& p_statistics);
+    #endif //DEBUG
+
+}
+
+#endif //ALLOCATION_PROFILER__MEMORY_MANAGEMENT_ALLOCATION_PROFILER_ALLOCATION_PROFILER_HPP
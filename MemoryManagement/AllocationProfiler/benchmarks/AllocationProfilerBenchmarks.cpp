@@ -0,0 +1,113 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "../AllocationProfiler.hpp"
+
+using namespace Library;
+
+//The number of allocations each thread does per run.
+static const Size g_OPERATION_COUNT = 200000;
+//The number of allocations each thread keeps alive at once.
+static const Size g_LIVE_COUNT = 256;
+
+//Keeps a window of live small objects and keeps replacing them, the worst
+//case for the overhead of profiling since the allocations themselves are
+//cheap.
+static void WorkUsingAllocatorAndDeallocator(
+    const Size& p_seed,
+    Allocator p_allocate, Deallocator p_deallocate
+)
+{
+
+    void* l_live[g_LIVE_COUNT] = {};
+    Size l_random = p_seed * 2654435761u + 1;
+
+    for(Size i = 0; i < g_OPERATION_COUNT; ++i)
+    {
+        l_random = l_random * 6364136223846793005u + 1442695040888963407u;
+        Size l_slot = (l_random >> 33) % g_LIVE_COUNT;
+        Size l_size = 8 + (l_random >> 45) % 248;
+
+        p_deallocate(l_live[l_slot]);
+        l_live[l_slot] = p_allocate(l_size);
+        *(volatile Byte*)l_live[l_slot] = (Byte)i;
+    }
+
+    for(Size i = 0; i < g_LIVE_COUNT; ++i)
+    {
+        p_deallocate(l_live[i]);
+    }
+
+}
+
+static void RunThreadsUsingAllocatorAndDeallocator(
+    const Size& p_thread_count,
+    Allocator p_allocate, Deallocator p_deallocate
+)
+{
+
+    std::vector<std::thread> l_threads;
+    for(Size t = 0; t < p_thread_count; ++t)
+    {
+        l_threads.emplace_back([t, &p_allocate, &p_deallocate]()
+        {
+            WorkUsingAllocatorAndDeallocator(t, p_allocate, p_deallocate);
+        });
+    }
+    for(std::thread& l_thread : l_threads)
+    {
+        l_thread.join();
+    }
+
+}
+
+TEST_CASE("Overhead of profiling small allocations", "[AllocationProfiler][Benchmark]")
+{
+
+    Size l_threadCount = GENERATE(1, 4);
+
+    BENCHMARK("malloc/free " + std::to_string(l_threadCount) + " threads")
+    {
+        RunThreadsUsingAllocatorAndDeallocator(l_threadCount, malloc, free);
+    };
+
+    BENCHMARK("profiling " + std::to_string(l_threadCount) + " threads")
+    {
+        RunThreadsUsingAllocatorAndDeallocator(l_threadCount, ProfilingMalloc, ProfilingFree);
+    };
+
+    BENCHMARK("profiling with a tag " + std::to_string(l_threadCount) + " threads")
+    {
+        std::vector<std::thread> l_threads;
+        for(Size t = 0; t < l_threadCount; ++t)
+        {
+            l_threads.emplace_back([t]()
+            {
+                ScopedAllocationTag l_tag("Benchmark");
+                WorkUsingAllocatorAndDeallocator(t, ProfilingMalloc, ProfilingFree);
+            });
+        }
+        for(std::thread& l_thread : l_threads)
+        {
+            l_thread.join();
+        }
+    };
+
+}
+
+TEST_CASE("Finding statistics", "[AllocationProfiler][Benchmark]")
+{
+
+    BENCHMARK("FindAllocationStatistics")
+    {
+        AllocationStatistics l_statistics;
+        FindAllocationStatistics(l_statistics);
+        return l_statistics.m_LiveBytes;
+    };
+
+}
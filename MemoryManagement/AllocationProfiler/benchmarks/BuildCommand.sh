@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -O2 -std=c++17 -o AllocationProfilerBenchmarks.bench ../AllocationProfiler.cpp ../../../Meta/Meta.cpp -pthread *.cpp
\ No newline at end of file
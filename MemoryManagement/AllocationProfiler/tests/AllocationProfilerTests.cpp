@@ -0,0 +1,386 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../AllocationProfiler.hpp"
+#include "../../../Debugging/Debugging.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+
+#include <string.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+//Finds the statistics of the site of p_tag, or of p_call_site if p_tag is
+//null. A site with no allocations is written if there is none.
+static AllocationSiteStatistics FindStatisticsOfSite(const char* p_tag, const void* p_call_site)
+{
+
+    std::vector<AllocationSiteStatistics> l_sites(g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1);
+    Size l_numberOfSites = FindAllocationStatisticsOfSites(l_sites.data(), l_sites.size());
+    REQUIRE(l_numberOfSites <= l_sites.size());
+
+    for(Size i = 0; i < l_numberOfSites; ++i)
+    {
+        if(l_sites[i].m_Tag == p_tag && (p_tag != nullptr || l_sites[i].m_CallSite == p_call_site))
+        {
+            return l_sites[i];
+        }
+    }
+
+    return AllocationSiteStatistics();
+
+}
+
+TEST_CASE("Histogram buckets", "[AllocationProfiler][Histogram]")
+{
+
+    CHECK(FindAllocationHistogramBucketOfSize(0) == 0);
+    CHECK(FindAllocationHistogramBucketOfSize(1) == 0);
+    CHECK(FindAllocationHistogramBucketOfSize(16) == 0);
+    CHECK(FindAllocationHistogramBucketOfSize(17) == 1);
+    CHECK(FindAllocationHistogramBucketOfSize(32) == 1);
+    CHECK(FindAllocationHistogramBucketOfSize(33) == 2);
+    CHECK(FindAllocationHistogramBucketOfSize(SIZE_MAX) == g_ALLOCATION_PROFILER_HISTOGRAM_SIZE - 1);
+    CHECK(FindBiggestSizeOfAllocationHistogramBucket(g_ALLOCATION_PROFILER_HISTOGRAM_SIZE - 1) == SIZE_MAX);
+
+    for(Size i = 0; i < g_ALLOCATION_PROFILER_HISTOGRAM_SIZE - 1; ++i)
+    {
+        Size l_biggest = FindBiggestSizeOfAllocationHistogramBucket(i);
+        CHECK(FindAllocationHistogramBucketOfSize(l_biggest) == i);
+        CHECK(FindAllocationHistogramBucketOfSize(l_biggest + 1) == i + 1);
+    }
+
+}
+
+TEST_CASE("Tags", "[AllocationProfiler][Tag]")
+{
+
+    CHECK(GetAllocationTagOfThisThread() == nullptr);
+    {
+        ScopedAllocationTag l_outer("Outer");
+        CHECK(strcmp(GetAllocationTagOfThisThread(), "Outer") == 0);
+        {
+            ScopedAllocationTag l_inner("Inner");
+            CHECK(strcmp(GetAllocationTagOfThisThread(), "Inner") == 0);
+        }
+        CHECK(strcmp(GetAllocationTagOfThisThread(), "Outer") == 0);
+    }
+    CHECK(GetAllocationTagOfThisThread() == nullptr);
+
+    CHECK(SetAllocationTagOfThisThread("Set") == nullptr);
+    CHECK(SetAllocationTagOfThisThread(nullptr) != nullptr);
+
+}
+
+TEST_CASE("Counting at a tag", "[AllocationProfiler][Counting]")
+{
+
+    static const char* const s_tag = "Counting at a tag";
+    ScopedAllocationTag l_tag(s_tag);
+
+    AllocationSiteStatistics l_before = FindStatisticsOfSite(s_tag, nullptr);
+    AllocationStatistics l_totalBefore;
+    FindAllocationStatistics(l_totalBefore);
+
+    Byte* l_location = (Byte*)ProfilingMalloc(100);
+    REQUIRE(l_location != nullptr);
+    CHECK((uintptr_t)l_location % g_ALLOCATION_PROFILER_HEADER_SIZE == 0);
+    memset(l_location, 1, 100);
+
+    AllocationSiteStatistics l_after = FindStatisticsOfSite(s_tag, nullptr);
+    CHECK(l_after.m_CallSite == nullptr);
+    CHECK(l_after.m_NumberOfAllocations == l_before.m_NumberOfAllocations + 1);
+    CHECK(l_after.m_AllocatedBytes == l_before.m_AllocatedBytes + 100);
+    CHECK(l_after.m_SizeHistogram[FindAllocationHistogramBucketOfSize(100)] == l_before.m_SizeHistogram[FindAllocationHistogramBucketOfSize(100)] + 1);
+
+    SECTION("Freeing")
+    {
+        ProfilingFree(l_location);
+
+        l_after = FindStatisticsOfSite(s_tag, nullptr);
+        CHECK(l_after.m_NumberOfDeallocations == l_before.m_NumberOfDeallocations + 1);
+        CHECK(l_after.m_DeallocatedBytes == l_before.m_DeallocatedBytes + 100);
+    }
+    SECTION("Reallocating")
+    {
+        l_location = (Byte*)ProfilingRealloc(l_location, 5000);
+        REQUIRE(l_location != nullptr);
+        for(Size i = 0; i < 100; ++i)
+        {
+            REQUIRE(l_location[i] == 1);
+        }
+
+        l_after = FindStatisticsOfSite(s_tag, nullptr);
+        CHECK(l_after.m_NumberOfAllocations == l_before.m_NumberOfAllocations + 1);
+        CHECK(l_after.m_NumberOfReallocations == l_before.m_NumberOfReallocations + 1);
+        CHECK(l_after.m_AllocatedBytes == l_before.m_AllocatedBytes + 5100);
+        CHECK(l_after.m_DeallocatedBytes == l_before.m_DeallocatedBytes + 100);
+
+        AllocationStatistics l_total;
+        FindAllocationStatistics(l_total);
+        CHECK(l_total.m_LiveBytes == l_totalBefore.m_LiveBytes + 5000);
+
+        SECTION("At another tag")
+        {
+            static const char* const s_otherTag = "Counting at a tag, other";
+            ScopedAllocationTag l_otherTag(s_otherTag);
+            AllocationSiteStatistics l_otherBefore = FindStatisticsOfSite(s_otherTag, nullptr);
+
+            l_location = (Byte*)ProfilingRealloc(l_location, 6000);
+            REQUIRE(l_location != nullptr);
+
+            AllocationSiteStatistics l_first = FindStatisticsOfSite(s_tag, nullptr);
+            AllocationSiteStatistics l_other = FindStatisticsOfSite(s_otherTag, nullptr);
+            CHECK(l_first.m_AllocatedBytes - l_first.m_DeallocatedBytes == l_before.m_AllocatedBytes - l_before.m_DeallocatedBytes);
+            CHECK(l_other.m_NumberOfReallocations == l_otherBefore.m_NumberOfReallocations + 1);
+            CHECK(l_other.m_AllocatedBytes - l_other.m_DeallocatedBytes == l_otherBefore.m_AllocatedBytes - l_otherBefore.m_DeallocatedBytes + 6000);
+        }
+
+        ProfilingFree(l_location);
+        l_after = FindStatisticsOfSite(s_tag, nullptr);
+        CHECK(l_after.m_AllocatedBytes - l_after.m_DeallocatedBytes == l_before.m_AllocatedBytes - l_before.m_DeallocatedBytes);
+    }
+    SECTION("Reallocating to 0")
+    {
+        CHECK(ProfilingRealloc(l_location, 0) == nullptr);
+
+        l_after = FindStatisticsOfSite(s_tag, nullptr);
+        CHECK(l_after.m_NumberOfDeallocations == l_before.m_NumberOfDeallocations + 1);
+        CHECK(l_after.m_DeallocatedBytes == l_before.m_DeallocatedBytes + 100);
+    }
+    SECTION("Failed reallocation")
+    {
+        CHECK(ProfilingRealloc(l_location, SIZE_MAX - 10) == nullptr);
+        CHECK(l_location[99] == 1);
+
+        AllocationSiteStatistics l_failed = FindStatisticsOfSite(s_tag, nullptr);
+        CHECK(l_failed.m_NumberOfReallocations == l_after.m_NumberOfReallocations);
+        CHECK(l_failed.m_AllocatedBytes == l_after.m_AllocatedBytes);
+
+        ProfilingFree(l_location);
+    }
+
+    CHECK(ProfilingMalloc(SIZE_MAX - 10) == nullptr);
+    ProfilingFree(nullptr);
+
+    AllocationStatistics l_totalAfter;
+    FindAllocationStatistics(l_totalAfter);
+    CHECK(l_totalAfter.m_LiveBytes == l_totalBefore.m_LiveBytes);
+    CHECK(l_totalAfter.m_PeakLiveBytes >= l_totalAfter.m_LiveBytes);
+
+}
+
+TEST_CASE("Counting at call sites", "[AllocationProfiler][Counting]")
+{
+
+    REQUIRE(GetAllocationTagOfThisThread() == nullptr);
+
+    AllocationStatistics l_before;
+    FindAllocationStatistics(l_before);
+
+    //The array allocates from inside of its own function, which is the call
+    //site.
+    Array<int> l_array;
+    CreateArrayAtOfCapacityUsingAllocator(l_array, 1000, ProfilingMalloc, nullptr, nullptr);
+    REQUIRE(l_array != nullptr);
+
+    std::vector<AllocationSiteStatistics> l_sites(g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1);
+    Size l_numberOfSites = FindAllocationStatisticsOfSites(l_sites.data(), l_sites.size());
+    bool l_found = false;
+    for(Size i = 0; i < l_numberOfSites; ++i)
+    {
+        if(l_sites[i].m_Tag == nullptr && l_sites[i].m_AllocatedBytes >= 1000 * sizeof(int))
+        {
+            CHECK(l_sites[i].m_CallSite != nullptr);
+            l_found = true;
+        }
+    }
+    CHECK(l_found);
+
+    AllocationStatistics l_after;
+    FindAllocationStatistics(l_after);
+    CHECK(l_after.m_NumberOfAllocations == l_before.m_NumberOfAllocations + 1);
+    CHECK(l_after.m_LiveBytes == l_before.m_LiveBytes + 1000 * sizeof(int));
+
+    DestroyArrayUsingDeallocator(l_array, ProfilingFree);
+
+    FindAllocationStatistics(l_after);
+    CHECK(l_after.m_LiveBytes == l_before.m_LiveBytes);
+
+}
+
+TEST_CASE("Counting in other threads", "[AllocationProfiler][Counting][Threads]")
+{
+
+    static const char* const s_tag = "Counting in other threads";
+    AllocationSiteStatistics l_before = FindStatisticsOfSite(s_tag, nullptr);
+
+    const Size l_numberOfThreads = 4;
+    const Size l_numberOfAllocations = 1000;
+
+    std::atomic<bool> l_allocated[l_numberOfThreads] = {};
+    std::atomic<bool> l_canFree(false);
+    std::atomic<bool> l_failed(false);
+
+    std::vector<std::thread> l_threads;
+    for(Size i = 0; i < l_numberOfThreads; ++i)
+    {
+        l_threads.emplace_back([&, i]()
+        {
+            ScopedAllocationTag l_tag(s_tag);
+            std::vector<void*> l_locations;
+            for(Size n = 0; n < l_numberOfAllocations; ++n)
+            {
+                void* l_location = ProfilingMalloc(64);
+                if(l_location == nullptr)
+                {
+                    l_failed = true;
+                }
+                l_locations.push_back(l_location);
+            }
+            l_allocated[i] = true;
+
+            while(l_canFree == false)
+            {
+                std::this_thread::yield();
+            }
+            for(void* l_location : l_locations)
+            {
+                ProfilingFree(l_location);
+            }
+        });
+    }
+
+    for(Size i = 0; i < l_numberOfThreads; ++i)
+    {
+        while(l_allocated[i] == false)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    //Read while the threads are still alive.
+    AllocationSiteStatistics l_during = FindStatisticsOfSite(s_tag, nullptr);
+    CHECK(l_during.m_NumberOfAllocations == l_before.m_NumberOfAllocations + l_numberOfThreads * l_numberOfAllocations);
+    CHECK(l_during.m_AllocatedBytes == l_before.m_AllocatedBytes + l_numberOfThreads * l_numberOfAllocations * 64);
+
+    l_canFree = true;
+    for(std::thread& l_thread : l_threads)
+    {
+        l_thread.join();
+    }
+    CHECK(l_failed == false);
+
+    //Read after the threads exited.
+    AllocationSiteStatistics l_after = FindStatisticsOfSite(s_tag, nullptr);
+    CHECK(l_after.m_NumberOfAllocations == l_during.m_NumberOfAllocations);
+    CHECK(l_after.m_NumberOfDeallocations == l_before.m_NumberOfDeallocations + l_numberOfThreads * l_numberOfAllocations);
+    CHECK(l_after.m_AllocatedBytes - l_after.m_DeallocatedBytes == l_before.m_AllocatedBytes - l_before.m_DeallocatedBytes);
+
+}
+
+TEST_CASE("Freeing in another thread", "[AllocationProfiler][Counting][Threads]")
+{
+
+    static const char* const s_tag = "Freeing in another thread";
+    AllocationSiteStatistics l_before = FindStatisticsOfSite(s_tag, nullptr);
+
+    void* l_location = nullptr;
+    {
+        ScopedAllocationTag l_tag(s_tag);
+        l_location = ProfilingMalloc(1000);
+    }
+    REQUIRE(l_location != nullptr);
+
+    std::thread l_thread([l_location]()
+    {
+        ProfilingFree(l_location);
+    });
+    l_thread.join();
+
+    AllocationSiteStatistics l_after = FindStatisticsOfSite(s_tag, nullptr);
+    CHECK(l_after.m_NumberOfDeallocations == l_before.m_NumberOfDeallocations + 1);
+    CHECK(l_after.m_AllocatedBytes - l_after.m_DeallocatedBytes == l_before.m_AllocatedBytes - l_before.m_DeallocatedBytes);
+
+}
+
+TEST_CASE("Peak live bytes", "[AllocationProfiler][Counting]")
+{
+
+    AllocationStatistics l_before;
+    FindAllocationStatistics(l_before);
+
+    void* l_location = ProfilingMalloc(l_before.m_PeakLiveBytes + 1024 * 1024);
+    REQUIRE(l_location != nullptr);
+    ProfilingFree(l_location);
+
+    AllocationStatistics l_after;
+    FindAllocationStatistics(l_after);
+    CHECK(l_after.m_LiveBytes == l_before.m_LiveBytes);
+    CHECK(l_after.m_PeakLiveBytes >= l_before.m_PeakLiveBytes + 1024 * 1024);
+
+}
+
+TEST_CASE("Report", "[AllocationProfiler][Report]")
+{
+
+    static const char* const s_tag = "Report";
+    void* l_location = nullptr;
+    {
+        ScopedAllocationTag l_tag(s_tag);
+        l_location = ProfilingMalloc(12345);
+    }
+
+    FILE* l_file = tmpfile();
+    REQUIRE(l_file != nullptr);
+    WriteAllocationReportToFile(l_file);
+
+    std::string l_report;
+    rewind(l_file);
+    char l_buffer[256];
+    while(fgets(l_buffer, sizeof(l_buffer), l_file) != nullptr)
+    {
+        l_report += l_buffer;
+    }
+    fclose(l_file);
+
+    CHECK(l_report.find("Live bytes:") != std::string::npos);
+    CHECK(l_report.find("Site \"Report\":") != std::string::npos);
+    CHECK(l_report.find("<=16384: 1") != std::string::npos);
+
+    ProfilingFree(l_location);
+
+}
+
+//Must be last, no new sites can be told apart after it.
+TEST_CASE("Too many sites", "[AllocationProfiler][Overflow]")
+{
+
+    //Tags are told apart by their location.
+    static char s_tags[g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 10][2];
+
+    AllocationStatistics l_before;
+    FindAllocationStatistics(l_before);
+
+    for(Size i = 0; i < g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 10; ++i)
+    {
+        ScopedAllocationTag l_tag(s_tags[i]);
+        ProfilingFree(ProfilingMalloc(10));
+    }
+
+    AllocationStatistics l_after;
+    FindAllocationStatistics(l_after);
+    CHECK(l_after.m_NumberOfSites == g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 1);
+    CHECK(l_after.m_NumberOfAllocations == l_before.m_NumberOfAllocations + g_ALLOCATION_PROFILER_MAX_SITE_COUNT + 10);
+    CHECK(l_after.m_LiveBytes == l_before.m_LiveBytes);
+
+    AllocationSiteStatistics l_overflow = FindStatisticsOfSite(g_ALLOCATION_PROFILER_OVERFLOW_TAG, nullptr);
+    CHECK(l_overflow.m_NumberOfAllocations >= 10);
+
+}
@@ -0,0 +1,499 @@
+/**
+ * @file Arena.cpp
+ * @brief Defines everything in the @ref ArenaMod module that is not defined
+ * inline in Arena.hpp.
+ *
+ */
+#include "Arena.hpp"
+
+namespace Library
+{
+
+    //This is where the hidden global variables are stored.
+    namespace
+    {
+        //The arena used by ArenaMalloc, ArenaRealloc and ArenaFree.
+        thread_local Arena* g_ArenaOfThisThread = nullptr;
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const Arena& p_arena)
+    {
+
+        p_log << (void*)&p_arena;
+        p_log << " { m_CurrentChunk = " << (void*)p_arena.m_CurrentChunk;
+        p_log << ", m_Top = " << (void*)p_arena.m_Top;
+        p_log << ", m_End = " << (void*)p_arena.m_End;
+        p_log << ", m_ChunkSize = " << p_arena.m_ChunkSize;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+
+    //Allocates a chunk with at least p_size usable bytes and makes it the
+    //current chunk of p_arena. Returns false on failure, p_arena is not
+    //mutated in that case.
+    static bool AddChunkOfSizeToArena(Arena& p_arena, const Size& p_size)
+    {
+
+        LogDebugLine("Adding chunk of size " << p_size << " to arena " << p_arena);
+
+        if(p_size > SIZE_MAX - sizeof(ArenaChunk))
+        {
+            LogDebugLine("The size of the chunk overflows, returning false.");
+            return false;
+        }
+
+        ArenaChunk* l_chunk = (ArenaChunk*)p_arena.m_Allocate(sizeof(ArenaChunk) + p_size);
+        if(l_chunk == nullptr)
+        {
+            LogDebugLine("Allocation of the chunk failed, returning false.");
+            return false;
+        }
+
+        l_chunk->m_PreviousChunk = p_arena.m_CurrentChunk;
+        l_chunk->m_Size = p_size;
+
+        p_arena.m_CurrentChunk = l_chunk;
+        p_arena.m_Top = (Byte*)(l_chunk + 1);
+        p_arena.m_End = p_arena.m_Top + p_size;
+
+        LogDebugLine("Successfully added chunk at " << (void*)l_chunk);
+        return true;
+
+    }
+
+
+    void CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+        Arena& outp_arena,
+        const Size& p_chunk_size,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating arena at " << (void*)&outp_arena << " with chunk "
+        "size " << p_chunk_size);
+
+        outp_arena = Arena();
+
+        if(p_chunk_size == 0)
+        {
+            LogDebugLine("The chunk size is 0, leaving a null arena and returning.");
+            return;
+        }
+
+        outp_arena.m_ChunkSize = p_chunk_size;
+        outp_arena.m_Allocate = p_allocate;
+        outp_arena.m_Deallocate = p_deallocate;
+
+        if(AddChunkOfSizeToArena(outp_arena, p_chunk_size) == false)
+        {
+            LogDebugLine("Could not allocate the first chunk, creating null arena.");
+            outp_arena = Arena();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        LogDebugLine("Successfully created arena " << outp_arena);
+
+    }
+
+
+    void* AllocateFromNewChunkOfArena(Arena& p_arena, const Size& p_size)
+    {
+
+        LogDebugLine("Allocating " << p_size << " bytes from a new chunk of "
+        "arena " << p_arena);
+
+        if(p_arena.m_Allocate == nullptr)
+        {
+            LogDebugLine("The arena is a null arena, returning null.");
+            return nullptr;
+        }
+
+        //The worst case is a full alignment of padding and the size header in
+        //front of the allocation.
+        Size l_overhead = sizeof(Size) + g_ARENA_ALIGNMENT;
+        if(p_size > SIZE_MAX - l_overhead)
+        {
+            LogDebugLine("The needed size overflows, returning null.");
+            return nullptr;
+        }
+
+        Size l_needed = p_size + l_overhead;
+        if(l_needed < p_arena.m_ChunkSize)
+        {
+            l_needed = p_arena.m_ChunkSize;
+        }
+
+        if(AddChunkOfSizeToArena(p_arena, l_needed) == false)
+        {
+            LogDebugLine("Could not add a chunk, returning null.");
+            return nullptr;
+        }
+
+        //Guaranteed to fit, so the fast path will not recurse.
+        return AllocateFromArena(p_arena, p_size);
+
+    }
+
+
+    void* ReallocateInArena(Arena& p_arena, void* p_pointer, const Size& p_size)
+    {
+
+        LogDebugLine("Reallocating " << p_pointer << " to " << p_size
+        << " bytes in arena " << p_arena);
+
+        if(p_pointer == nullptr)
+        {
+            LogDebugLine("The pointer is null, allocating instead.");
+            return AllocateFromArena(p_arena, p_size);
+        }
+        if(p_size == 0)
+        {
+            LogDebugLine("The new size is 0, deallocating instead.");
+            DeallocateFromArena(p_arena, p_pointer);
+            return nullptr;
+        }
+
+        Byte* l_location = (Byte*)p_pointer;
+        Size l_oldSize;
+        memcpy(&l_oldSize, l_location - sizeof(Size), sizeof(Size));
+
+        //The last allocation can grow in place as long as the chunk has space.
+        if(l_location + l_oldSize == p_arena.m_Top)
+        {
+            if(p_size <= (Size)(p_arena.m_End - l_location))
+            {
+                LogDebugLine("Resizing the last allocation in place.");
+                memcpy(l_location - sizeof(Size), &p_size, sizeof(Size));
+                p_arena.m_Top = l_location + p_size;
+                return p_pointer;
+            }
+        }
+        else if(p_size <= l_oldSize)
+        {
+            LogDebugLine("Shrinking in place, the tail stays unused until reset.");
+            memcpy(l_location - sizeof(Size), &p_size, sizeof(Size));
+            return p_pointer;
+        }
+
+        LogDebugLine("Moving the allocation.");
+        void* l_newLocation = AllocateFromArena(p_arena, p_size);
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Allocation failed, returning null.");
+            return nullptr;
+        }
+
+        memcpy(l_newLocation, p_pointer, l_oldSize < p_size ? l_oldSize : p_size);
+
+        return l_newLocation;
+
+    }
+
+    void DeallocateFromArena(Arena& p_arena, void* p_pointer)
+    {
+
+        LogDebugLine("Deallocating " << p_pointer << " from arena " << p_arena);
+
+        if(p_pointer == nullptr)
+        {
+            return;
+        }
+
+        Byte* l_location = (Byte*)p_pointer;
+        Size l_size;
+        memcpy(&l_size, l_location - sizeof(Size), sizeof(Size));
+
+        if(l_location + l_size == p_arena.m_Top)
+        {
+            LogDebugLine("This is the last allocation, giving it back.");
+            p_arena.m_Top = l_location - sizeof(Size);
+        }
+
+    }
+
+
+    void ResetArena(Arena& p_arena)
+    {
+
+        LogDebugLine("Resetting arena " << p_arena);
+
+        if(p_arena.m_CurrentChunk == nullptr)
+        {
+            LogDebugLine("Null arena, nothing to reset.");
+            return;
+        }
+
+        ArenaChunk* l_chunk = p_arena.m_CurrentChunk->m_PreviousChunk;
+        while(l_chunk != nullptr)
+        {
+            ArenaChunk* l_previous = l_chunk->m_PreviousChunk;
+            LogDebugLine("Deallocating chunk at " << (void*)l_chunk);
+            p_arena.m_Deallocate(l_chunk);
+            l_chunk = l_previous;
+        }
+
+        p_arena.m_CurrentChunk->m_PreviousChunk = nullptr;
+        p_arena.m_Top = (Byte*)(p_arena.m_CurrentChunk + 1);
+
+    }
+
+    void DestroyArena(Arena& p_arena)
+    {
+
+        LogDebugLine("Destroying arena " << p_arena);
+
+        ArenaChunk* l_chunk = p_arena.m_CurrentChunk;
+        while(l_chunk != nullptr)
+        {
+            ArenaChunk* l_previous = l_chunk->m_PreviousChunk;
+            LogDebugLine("Deallocating chunk at " << (void*)l_chunk);
+            p_arena.m_Deallocate(l_chunk);
+            l_chunk = l_previous;
+        }
+
+        p_arena = Arena();
+
+    }
+
+
+    void SetArenaOfThisThread(Arena* p_arena)
+    {
+        g_ArenaOfThisThread = p_arena;
+    }
+    Arena* GetArenaOfThisThread()
+    {
+        return g_ArenaOfThisThread;
+    }
+
+    void* ArenaMalloc(Size p_size)
+    {
+        if(g_ArenaOfThisThread == nullptr)
+        {
+            return nullptr;
+        }
+        return AllocateFromArena(*g_ArenaOfThisThread, p_size);
+    }
+    void* ArenaRealloc(void* p_pointer, Size p_size)
+    {
+        if(g_ArenaOfThisThread == nullptr)
+        {
+            return nullptr;
+        }
+        return ReallocateInArena(*g_ArenaOfThisThread, p_pointer, p_size);
+    }
+    void ArenaFree(void* p_pointer)
+    {
+        if(g_ArenaOfThisThread == nullptr)
+        {
+            return;
+        }
+        DeallocateFromArena(*g_ArenaOfThisThread, p_pointer);
+    }
+
+
+    void AllocateMemoryFromArena(
+        Memory& outp_memory,
+        void*& p_state,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Allocating memory of size " << outp_memory.m_Size
+        << " from arena at " << p_state);
+
+        if(outp_memory.m_Size == 0)
+        {
+            LogDebugLine("The size is 0, writing null memory.");
+            outp_memory = Memory();
+            return;
+        }
+
+        void* l_location = nullptr;
+        //Arena chunks are never executable and are only aligned to
+        //g_ARENA_ALIGNMENT.
+        if(
+            MemoryIsExecutable(outp_memory) == false &&
+            outp_memory.m_Alignment <= g_ARENA_ALIGNMENT
+        )
+        {
+            l_location = AllocateFromArena(*(Arena*)p_state, outp_memory.m_Size);
+        }
+
+        if(l_location == nullptr)
+        {
+            LogDebugLine("Allocation failed, writing null memory.");
+            outp_memory = Memory();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        outp_memory.m_Location = (Byte*)l_location;
+        outp_memory.m_Alignment = g_ARENA_ALIGNMENT;
+        //Readable and writable.
+        outp_memory.m_Permissions = 0b011;
+
+    }
+
+    void RepermissionateMemoryFromArena(
+        Memory& p_memory,
+        const Byte& p_new_permissions,
+        void*& p_state,
+        Callback p_repermission_error, void* p_repermission_error_data
+    )
+    {
+
+        LogDebugLine("Repermissionating arena memory at "
+        << (void*)p_memory.m_Location << " to " << (unsigned)p_new_permissions);
+
+        (void)p_state;
+
+        //Anything other than read and write can not be given.
+        if((p_new_permissions & ~0b011) != 0)
+        {
+            LogDebugLine("The new permissions can not be given by an arena.");
+            if(p_repermission_error != nullptr)
+            {
+                LogDebugLine("Repermission error is not null so calling it.");
+                p_repermission_error(p_repermission_error_data);
+            }
+            return;
+        }
+
+        p_memory.m_Permissions = p_new_permissions;
+
+    }
+
+    void ReallocateFrontOfMemoryFromArena(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reallocating the front of arena memory at "
+        << (void*)p_memory.m_Location << " to " << p_new_size << " bytes");
+
+        Arena& l_arena = *(Arena*)p_state;
+
+        if(p_new_size == 0)
+        {
+            DeallocateMemoryFromArena(p_memory, p_state);
+            return;
+        }
+
+        if(p_new_size <= p_memory.m_Size)
+        {
+            LogDebugLine("Shrinking in place.");
+            Byte* l_newLocation = p_memory.m_Location + (p_memory.m_Size - p_new_size);
+            //The header is rewritten over bytes that are being dropped, it
+            //may not be aligned so it is copied.
+            memcpy(l_newLocation - sizeof(Size), &p_new_size, sizeof(Size));
+            //Moving the location forward keeps only the alignment of the
+            //number of bytes it moved by.
+            Size l_moved = p_memory.m_Size - p_new_size;
+            if(l_moved != 0 && (l_moved & (0 - l_moved)) < p_memory.m_Alignment)
+            {
+                p_memory.m_Alignment = l_moved & (0 - l_moved);
+            }
+            p_memory.m_Location = l_newLocation;
+            p_memory.m_Size = p_new_size;
+            return;
+        }
+
+        Byte* l_newLocation = (Byte*)AllocateFromArena(l_arena, p_new_size);
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Allocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        if(p_memory.m_Location != nullptr)
+        {
+            memcpy(
+                l_newLocation + (p_new_size - p_memory.m_Size),
+                p_memory.m_Location,
+                p_memory.m_Size
+            );
+        }
+
+        p_memory.m_Location = l_newLocation;
+        p_memory.m_Size = p_new_size;
+        p_memory.m_Alignment = g_ARENA_ALIGNMENT;
+        p_memory.m_Permissions = 0b011;
+
+    }
+
+    void ReallocateBackOfMemoryFromArena(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reallocating the back of arena memory at "
+        << (void*)p_memory.m_Location << " to " << p_new_size << " bytes");
+
+        if(p_new_size == 0)
+        {
+            DeallocateMemoryFromArena(p_memory, p_state);
+            return;
+        }
+
+        void* l_newLocation = ReallocateInArena(*(Arena*)p_state, p_memory.m_Location, p_new_size);
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Reallocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        //Growing in place keeps a location that may have been moved by a
+        //front reallocation.
+        if(l_newLocation != p_memory.m_Location)
+        {
+            p_memory.m_Alignment = g_ARENA_ALIGNMENT;
+        }
+        p_memory.m_Location = (Byte*)l_newLocation;
+        p_memory.m_Size = p_new_size;
+        p_memory.m_Permissions = 0b011;
+
+    }
+
+    void DeallocateMemoryFromArena(Memory& p_memory, void*& p_state)
+    {
+
+        LogDebugLine("Deallocating arena memory at " << (void*)p_memory.m_Location);
+
+        DeallocateFromArena(*(Arena*)p_state, p_memory.m_Location);
+        p_memory = Memory();
+
+    }
+
+}
@@ -0,0 +1,485 @@
+/**
+ * @file Arena.hpp
+ * @brief Declares everything in the @ref ArenaMod module.
+ *
+ * @details The fast path of arena allocation is defined inline in this file,
+ * everything else is defined in Arena.cpp.
+ *
+ */
+#ifndef ARENA__MEMORY_MANAGEMENT_ARENA_ARENA_HPP
+#define ARENA__MEMORY_MANAGEMENT_ARENA_ARENA_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../MemoryManagement.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+//Included for memcpy
+#include <string.h>
+
+namespace Library
+{
+
+    /**
+     * @ingroup ArenaMod
+     * @brief The alignment of every location given out by an arena.
+     *
+     * @details This is the same alignment that malloc gives, so that memory
+     * from an arena can be used for any type, just like memory from malloc.
+     *
+     */
+    constexpr Size g_ARENA_ALIGNMENT = alignof(max_align_t);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief The header of a single chunk of memory owned by an arena.
+     *
+     * @details Chunks are allocated with the arena's allocator, the header is
+     * placed at the start of the chunk and the usable memory right after it.
+     * Chunks form a singly linked chain from the newest to the oldest chunk.
+     *
+     * The header is padded so that the usable memory after it keeps the
+     * alignment given by the arena's allocator.
+     *
+     */
+    struct alignas(g_ARENA_ALIGNMENT) ArenaChunk
+    {
+
+        /**
+         * @brief The chunk that was allocated before this one, null if this
+         * is the oldest chunk.
+         *
+         */
+        ArenaChunk* m_PreviousChunk;
+        /**
+         * @brief The number of usable bytes after the header.
+         *
+         */
+        Size m_Size;
+
+    };
+
+    /**
+     * @ingroup ArenaMod
+     * @brief A region of memory that items are bump allocated from and that is
+     * freed all at once.
+     *
+     * @details An arena owns a chain of large chunks, see @ref ArenaChunk.
+     * Allocation moves @ref m_Top forward inside of the newest chunk, when the
+     * newest chunk runs out a new one is allocated. Individual allocations are
+     * never given back to the arena's allocator, instead everything is
+     * released at once with @ref ResetArena or @ref DestroyArena.
+     *
+     * Every allocation is preceded by a Size that holds the number of bytes
+     * that were requested, this is what allows reallocation to know how many
+     * bytes need to be copied.
+     *
+     * Arenas are not thread safe, each thread should use its own arena.
+     *
+     * @section ArenaTypes Types of arenas
+     * - Null arena, every field is null or 0. Allocating from this arena
+     * always fails. This is what the default constructor makes.
+     * - Valid arena, created using
+     * @ref CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator.
+     *
+     */
+    struct Arena
+    {
+
+        /**
+         * @brief The newest chunk, all allocations are done from this chunk.
+         *
+         */
+        ArenaChunk* m_CurrentChunk;
+        /**
+         * @brief The first free byte in @ref m_CurrentChunk.
+         *
+         */
+        Byte* m_Top;
+        /**
+         * @brief One past the last usable byte in @ref m_CurrentChunk.
+         *
+         */
+        Byte* m_End;
+        /**
+         * @brief The minimum number of usable bytes in each new chunk.
+         *
+         */
+        Size m_ChunkSize;
+
+        /**
+         * @brief Used for allocating new chunks.
+         *
+         */
+        void* (*m_Allocate) (Size);
+        /**
+         * @brief Used for freeing chunks on reset and destruction.
+         *
+         */
+        void (*m_Deallocate) (void*);
+
+
+        /**
+         * @brief Constructs a null arena.
+         *
+         */
+        Arena():
+        m_CurrentChunk(nullptr),
+        m_Top(nullptr),
+        m_End(nullptr),
+        m_ChunkSize(0),
+        m_Allocate(nullptr),
+        m_Deallocate(nullptr)
+        {
+            LogDebugLine("Constructed null arena at " << (void*)this);
+        }
+
+        /**
+         * @brief Copies every field from p_other, the chunks are shared.
+         *
+         * @warning Only one of the two arenas should ever be used after this.
+         *
+         */
+        Arena(const Arena& p_other) = default;
+        /**
+         * @brief Copies every field from p_other and then makes p_other a null
+         * arena.
+         *
+         */
+        Arena(Arena&& p_other):
+        m_CurrentChunk(p_other.m_CurrentChunk),
+        m_Top(p_other.m_Top),
+        m_End(p_other.m_End),
+        m_ChunkSize(p_other.m_ChunkSize),
+        m_Allocate(p_other.m_Allocate),
+        m_Deallocate(p_other.m_Deallocate)
+        {
+            LogDebugLine("Moved arena from " << (void*)&p_other << " to "
+            << (void*)this);
+            p_other = Arena();
+        }
+
+        Arena& operator=(const Arena& p_other) = default;
+        Arena& operator=(Arena&& p_other)
+        {
+
+            LogDebugLine("Moving arena from " << (void*)&p_other << " to "
+            << (void*)this);
+
+            m_CurrentChunk = p_other.m_CurrentChunk;
+            m_Top = p_other.m_Top;
+            m_End = p_other.m_End;
+            m_ChunkSize = p_other.m_ChunkSize;
+            m_Allocate = p_other.m_Allocate;
+            m_Deallocate = p_other.m_Deallocate;
+
+            p_other.m_CurrentChunk = nullptr;
+            p_other.m_Top = nullptr;
+            p_other.m_End = nullptr;
+            p_other.m_ChunkSize = 0;
+            p_other.m_Allocate = nullptr;
+            p_other.m_Deallocate = nullptr;
+
+            return *this;
+
+        }
+
+    };
+
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Creates an arena at outp_arena that allocates chunks of at least
+     * p_chunk_size bytes using p_allocate and frees them using p_deallocate.
+     *
+     * @details The first chunk is allocated right away.
+     *
+     * @warning Any arena already at outp_arena is overwritten, not destroyed.
+     *
+     * If p_chunk_size is 0 or allocation of the first chunk fails a null arena
+     * is created at outp_arena. In the case of allocation failure
+     * p_alloc_error is also called with p_alloc_error_data, if it is not null.
+     *
+     */
+    void CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+        Arena& outp_arena,
+        const Size& p_chunk_size,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    inline void CreateArenaAtOfChunkSize(Arena& outp_arena, const Size& p_chunk_size)
+    {
+        LogDebugLine("Using defaults for CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator");
+        CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+            outp_arena, p_chunk_size,
+            g_DEFAULT_ALLOCATOR, g_DEFAULT_DEALLOCATOR,
+            g_DEFAULT_ALLOC_ERROR, g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Used by @ref AllocateFromArena when the current chunk is out of
+     * space, you don't need to call this yourself.
+     *
+     * @details Allocates a new chunk big enough for p_size bytes and
+     * allocates from it. Returns null if p_arena is a null arena or if the
+     * chunk could not be allocated.
+     *
+     */
+    void* AllocateFromNewChunkOfArena(Arena& p_arena, const Size& p_size);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Allocates p_size bytes from p_arena, behaves like malloc.
+     *
+     * @details The returned location is aligned to @ref g_ARENA_ALIGNMENT. If
+     * the current chunk does not have enough space a new one is allocated,
+     * see @ref AllocateFromNewChunkOfArena.
+     *
+     * @return The allocated location or null on failure.
+     *
+     * @time O(1), the fast path is just a pointer bump.
+     *
+     */
+    inline void* AllocateFromArena(Arena& p_arena, const Size& p_size)
+    {
+
+        //The size header goes right before the aligned location.
+        uintptr_t l_location =
+            ((uintptr_t)p_arena.m_Top + sizeof(Size) + (g_ARENA_ALIGNMENT - 1))
+            & ~(uintptr_t)(g_ARENA_ALIGNMENT - 1);
+
+        //Also covers null arenas, where m_End is null.
+        if(l_location > (uintptr_t)p_arena.m_End || p_size > (uintptr_t)p_arena.m_End - l_location)
+        {
+            return AllocateFromNewChunkOfArena(p_arena, p_size);
+        }
+
+        memcpy((Byte*)l_location - sizeof(Size), &p_size, sizeof(Size));
+        p_arena.m_Top = (Byte*)l_location + p_size;
+
+        return (void*)l_location;
+
+    }
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Changes the size of a location allocated from p_arena, behaves
+     * like realloc.
+     *
+     * @details If p_pointer is the last allocation in the current chunk and
+     * the chunk has enough space, it is resized in place. Shrinking is always
+     * done in place. In any other case a new location is allocated and the
+     * old bytes are copied over.
+     *
+     * If p_pointer is null this is the same as @ref AllocateFromArena. If
+     * p_size is 0 p_pointer is deallocated and null is returned.
+     *
+     * @warning p_pointer must have been allocated from p_arena.
+     *
+     */
+    void* ReallocateInArena(Arena& p_arena, void* p_pointer, const Size& p_size);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Deallocates p_pointer from p_arena, behaves like free.
+     *
+     * @details Only the last allocation in the current chunk is actually given
+     * back, anything else stays allocated until the arena is reset or
+     * destroyed.
+     *
+     */
+    void DeallocateFromArena(Arena& p_arena, void* p_pointer);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Frees every allocation made from p_arena at once.
+     *
+     * @details Every chunk except the current one is given back to the
+     * arena's deallocator, the current chunk is kept so that the next round
+     * of allocations does not need to allocate again.
+     *
+     * @warning Every location allocated from p_arena is invalid after this.
+     *
+     * @time O(n), n being the number of chunks.
+     *
+     */
+    void ResetArena(Arena& p_arena);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Frees every chunk of p_arena and makes it a null arena.
+     *
+     */
+    void DestroyArena(Arena& p_arena);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Finds the number of bytes currently handed out from the current
+     * chunk of p_arena, including size headers and padding.
+     *
+     */
+    inline Size FindNumberOfUsedBytesInCurrentChunkOfArena(const Arena& p_arena)
+    {
+        if(p_arena.m_CurrentChunk == nullptr)
+        {
+            return 0;
+        }
+        return p_arena.m_Top - (Byte*)(p_arena.m_CurrentChunk + 1);
+    }
+
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Sets the arena used by @ref ArenaMalloc, @ref ArenaRealloc and
+     * @ref ArenaFree on the calling thread.
+     *
+     * @details Each thread has its own arena pointer, the default is null,
+     * which makes @ref ArenaMalloc always fail.
+     *
+     */
+    void SetArenaOfThisThread(Arena* p_arena);
+    /**
+     * @ingroup ArenaMod
+     * @brief Returns the arena set by @ref SetArenaOfThisThread for the
+     * calling thread.
+     *
+     */
+    Arena* GetArenaOfThisThread();
+
+    /**
+     * @ingroup ArenaMod
+     * @brief An @ref Allocator that allocates from the arena of the calling
+     * thread.
+     *
+     * @details This lets arenas be used with everything in the library that
+     * takes an @ref Allocator, for example:
+     * @code{.cpp}
+     * SetArenaOfThisThread(&l_arena);
+     * CreateArrayAtOfCapacityUsingAllocator(l_array, 16, ArenaMalloc, nullptr, nullptr);
+     * @endcode
+     *
+     * Returns null if the calling thread does not have an arena.
+     *
+     */
+    void* ArenaMalloc(Size p_size);
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref Reallocator that reallocates in the arena of the calling
+     * thread, see @ref ReallocateInArena.
+     *
+     */
+    void* ArenaRealloc(void* p_pointer, Size p_size);
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref Deallocator that deallocates from the arena of the calling
+     * thread, see @ref DeallocateFromArena.
+     *
+     */
+    void ArenaFree(void* p_pointer);
+
+
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref MemoryAllocator that allocates outp_memory.m_Size bytes
+     * from the arena pointed to by p_state.
+     *
+     * @details Arena memory is always readable and writable, if the requested
+     * permissions include execution allocation fails. The same goes for an
+     * outp_memory.m_Alignment bigger than @ref g_ARENA_ALIGNMENT, on success
+     * it is set to @ref g_ARENA_ALIGNMENT.
+     *
+     * On failure a null memory is written to outp_memory and p_alloc_error is
+     * called with p_alloc_error_data, if it is not null. If outp_memory.m_Size
+     * is 0 a null memory is written and nothing is called.
+     *
+     */
+    void AllocateMemoryFromArena(
+        Memory& outp_memory,
+        void*& p_state,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref MemoryRepermissionator for arena memory.
+     *
+     * @details Arenas can not change the protection of their chunks, so only
+     * permissions that are a subset of read and write are accepted, those are
+     * just written to p_memory. For anything else p_repermission_error is
+     * called and p_memory is not mutated.
+     *
+     */
+    void RepermissionateMemoryFromArena(
+        Memory& p_memory,
+        const Byte& p_new_permissions,
+        void*& p_state,
+        Callback p_repermission_error, void* p_repermission_error_data
+    );
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref MemoryReallocatorFront for arena memory, the bytes at the
+     * end of p_memory are kept.
+     *
+     * @details Shrinking is done in place by moving p_memory.m_Location
+     * forward, which lowers p_memory.m_Alignment to what the new location
+     * still has. Growing allocates a new location and copies the old bytes to
+     * its end. On failure p_realloc_error is called and p_memory is not
+     * mutated.
+     *
+     */
+    void ReallocateFrontOfMemoryFromArena(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    );
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref MemoryReallocatorBack for arena memory, the bytes at the
+     * start of p_memory are kept, see @ref ReallocateInArena.
+     *
+     * @details On failure p_realloc_error is called and p_memory is not
+     * mutated.
+     *
+     */
+    void ReallocateBackOfMemoryFromArena(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    );
+    /**
+     * @ingroup ArenaMod
+     * @brief A @ref MemoryDeallocator for arena memory, see
+     * @ref DeallocateFromArena. A null memory is written to p_memory.
+     *
+     */
+    void DeallocateMemoryFromArena(Memory& p_memory, void*& p_state);
+
+    /**
+     * @ingroup ArenaMod
+     * @brief Returns a @ref MemoryManagement that uses p_arena.
+     *
+     * @warning p_arena must outlive the returned value.
+     *
+     */
+    inline MemoryManagement GetMemoryManagementOfArena(Arena& p_arena)
+    {
+        return MemoryManagement{
+            AllocateMemoryFromArena,
+            RepermissionateMemoryFromArena,
+            ReallocateFrontOfMemoryFromArena,
+            ReallocateBackOfMemoryFromArena,
+            DeallocateMemoryFromArena,
+            &p_arena
+        };
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const Arena& p_arena);
+    #endif //DEBUG
+
+}
+
+#endif //ARENA__MEMORY_MANAGEMENT_ARENA_ARENA_HPP
@@ -0,0 +1,149 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../Arena.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+#include "../../../DataStructures/Lists/SinglyLinked/Node.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::Lists::SinglyLinked;
+
+//The amount of objects created while handling a single simulated request.
+static const Size g_ARRAYS_PER_REQUEST = 64;
+static const Size g_STRINGS_PER_REQUEST = 32;
+static const Size g_NODES_PER_REQUEST = 128;
+
+//Builds everything a request needs using the given memory functions. The
+//result is summed up so that the compiler can not throw the work away.
+static int HandleRequestUsingAllocatorAndReallocator(
+    Array<int>* p_arrays,
+    Array<char>* p_strings,
+    Node<int>& p_first_node,
+    Allocator p_allocate, Reallocator p_reallocate
+)
+{
+
+    int l_sum = 0;
+
+    for(Size i = 0; i < g_ARRAYS_PER_REQUEST; ++i)
+    {
+        CreateArrayAtOfCapacityUsingAllocator(p_arrays[i], 16, p_allocate, nullptr, nullptr);
+        for(Size n = 0; n < 16; ++n)
+        {
+            p_arrays[i].m_Buffer[n] = (int)(i + n);
+        }
+        l_sum += p_arrays[i].m_Buffer[15];
+    }
+
+    //Strings grow a couple of times, just like when they are being parsed.
+    for(Size i = 0; i < g_STRINGS_PER_REQUEST; ++i)
+    {
+        CreateArrayAtOfCapacityUsingAllocator(p_strings[i], 8, p_allocate, nullptr, nullptr);
+        ResizeArrayToCapacityUsingReallocator(p_strings[i], 24, p_reallocate, nullptr, nullptr);
+        ResizeArrayToCapacityUsingReallocator(p_strings[i], 72, p_reallocate, nullptr, nullptr);
+        p_strings[i].m_Buffer[71] = (char)i;
+        l_sum += p_strings[i].m_Buffer[71];
+    }
+
+    p_first_node.m_NextNode = nullptr;
+    for(Size i = 0; i < g_NODES_PER_REQUEST; ++i)
+    {
+        AddItemAfterNodeUsingAllocator((int)i, p_first_node, p_allocate, nullptr, nullptr);
+    }
+    l_sum += p_first_node.m_NextNode->m_Item;
+
+    return l_sum;
+
+}
+
+TEST_CASE("Per request malloc and free against arena reset", "[Arena][Benchmark]")
+{
+
+    Array<int> l_arrays[g_ARRAYS_PER_REQUEST];
+    Array<char> l_strings[g_STRINGS_PER_REQUEST];
+    Node<int> l_firstNode;
+
+    BENCHMARK("malloc/free churn")
+    {
+        int l_sum = HandleRequestUsingAllocatorAndReallocator(
+            l_arrays, l_strings, l_firstNode, malloc, realloc
+        );
+
+        for(Size i = 0; i < g_ARRAYS_PER_REQUEST; ++i)
+        {
+            DestroyArrayUsingDeallocator(l_arrays[i], free);
+        }
+        for(Size i = 0; i < g_STRINGS_PER_REQUEST; ++i)
+        {
+            DestroyArrayUsingDeallocator(l_strings[i], free);
+        }
+        while(l_firstNode.m_NextNode != nullptr)
+        {
+            RemoveNodeAfterNodeUsingDeallocator(l_firstNode, free);
+        }
+
+        return l_sum;
+    };
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 64 * 1024);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+    SetArenaOfThisThread(&l_arena);
+
+    BENCHMARK("arena reset")
+    {
+        int l_sum = HandleRequestUsingAllocatorAndReallocator(
+            l_arrays, l_strings, l_firstNode, ArenaMalloc, ArenaRealloc
+        );
+
+        ResetArena(l_arena);
+
+        return l_sum;
+    };
+
+    SetArenaOfThisThread(nullptr);
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Raw allocation throughput", "[Arena][Benchmark]")
+{
+
+    Size l_size = GENERATE(16, 64, 256);
+
+    void* l_pointers[1024];
+
+    BENCHMARK("malloc/free " + std::to_string(l_size) + " bytes x1024")
+    {
+        for(Size i = 0; i < 1024; ++i)
+        {
+            l_pointers[i] = malloc(l_size);
+        }
+        for(Size i = 0; i < 1024; ++i)
+        {
+            free(l_pointers[i]);
+        }
+        return l_pointers[1023];
+    };
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 1024 * (l_size + 32));
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    BENCHMARK("arena " + std::to_string(l_size) + " bytes x1024")
+    {
+        for(Size i = 0; i < 1024; ++i)
+        {
+            l_pointers[i] = AllocateFromArena(l_arena, l_size);
+        }
+        ResetArena(l_arena);
+        return l_pointers[1023];
+    };
+
+    DestroyArena(l_arena);
+
+}
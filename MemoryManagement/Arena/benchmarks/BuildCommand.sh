@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -O2 -std=c++17 -o ArenaBenchmarks.bench ../Arena.cpp ../../../Meta/Meta.cpp *.cpp
@@ -0,0 +1,123 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../Arena.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+TEST_CASE("Default constructor", "[Arena][Member]")
+{
+
+    Arena l_arena;
+
+    CHECK(l_arena.m_CurrentChunk == nullptr);
+    CHECK(l_arena.m_Top == nullptr);
+    CHECK(l_arena.m_End == nullptr);
+    CHECK(l_arena.m_ChunkSize == 0);
+    CHECK(l_arena.m_Allocate == nullptr);
+    CHECK(l_arena.m_Deallocate == nullptr);
+
+}
+
+TEST_CASE("Moving", "[Arena][Member]")
+{
+
+    Arena l_source;
+    CreateArenaAtOfChunkSize(l_source, 256);
+    REQUIRE(l_source.m_CurrentChunk != nullptr);
+
+    ArenaChunk* l_chunk = l_source.m_CurrentChunk;
+    Byte* l_top = l_source.m_Top;
+
+    Arena l_destination;
+
+    SECTION("Constructor")
+    {
+        l_destination = Arena((Arena&&)l_source);
+    }
+    SECTION("Operator")
+    {
+        l_destination = (Arena&&)l_source;
+    }
+
+    CHECK(l_destination.m_CurrentChunk == l_chunk);
+    CHECK(l_destination.m_Top == l_top);
+    CHECK(l_destination.m_ChunkSize == 256);
+
+    CHECK(l_source.m_CurrentChunk == nullptr);
+    CHECK(l_source.m_Top == nullptr);
+    CHECK(l_source.m_Allocate == nullptr);
+
+    DestroyArena(l_destination);
+
+}
+
+TEST_CASE("Creation and destruction", "[Arena][Creation][Destruction]")
+{
+
+    Size l_chunkSize = GENERATE(1, 16, 1000, 4096);
+
+    Arena l_arena;
+
+    SECTION("Defaults")
+    {
+        CreateArenaAtOfChunkSize(l_arena, l_chunkSize);
+    }
+    SECTION("Customs")
+    {
+        bool l_called = false;
+        CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+            l_arena, l_chunkSize,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+    CHECK(l_arena.m_CurrentChunk->m_PreviousChunk == nullptr);
+    CHECK(l_arena.m_CurrentChunk->m_Size == l_chunkSize);
+    CHECK(l_arena.m_End - l_arena.m_Top == (ptrdiff_t)l_chunkSize);
+    CHECK(FindNumberOfUsedBytesInCurrentChunkOfArena(l_arena) == 0);
+
+    DestroyArena(l_arena);
+
+    CHECK(l_arena.m_CurrentChunk == nullptr);
+    CHECK(l_arena.m_Top == nullptr);
+    CHECK(l_arena.m_Allocate == nullptr);
+
+}
+
+TEST_CASE("Failed creation", "[Arena][Creation]")
+{
+
+    Arena l_arena;
+    bool l_called = false;
+
+    SECTION("Allocation failure")
+    {
+        CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+            l_arena, 100,
+            NullMalloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == true);
+    }
+    SECTION("Zero chunk size")
+    {
+        CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+            l_arena, 0,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    CHECK(l_arena.m_CurrentChunk == nullptr);
+    CHECK(l_arena.m_Allocate == nullptr);
+    CHECK(AllocateFromArena(l_arena, 1) == nullptr);
+
+}
@@ -0,0 +1,339 @@
+#include <catch2/catch.hpp>
+
+#include "../Arena.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+TEST_CASE("Allocation", "[Arena][Mutable][Allocation]")
+{
+
+    Size l_size = GENERATE(1, 7, 16, 33, 100, 5000);
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 1024);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    Byte* l_locations[20];
+    for(Size i = 0; i < 20; ++i)
+    {
+        l_locations[i] = (Byte*)AllocateFromArena(l_arena, l_size);
+        REQUIRE(l_locations[i] != nullptr);
+        CHECK((uintptr_t)l_locations[i] % g_ARENA_ALIGNMENT == 0);
+        memset(l_locations[i], (int)i, l_size);
+    }
+
+    //None of the allocations overlap.
+    for(Size i = 0; i < 20; ++i)
+    {
+        for(Size n = 0; n < l_size; ++n)
+        {
+            REQUIRE(l_locations[i][n] == (Byte)i);
+        }
+    }
+
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Chunk growth", "[Arena][Mutable][Allocation]")
+{
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 128);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    ArenaChunk* l_firstChunk = l_arena.m_CurrentChunk;
+
+    SECTION("Many small allocations")
+    {
+        for(Size i = 0; i < 100; ++i)
+        {
+            REQUIRE(AllocateFromArena(l_arena, 24) != nullptr);
+        }
+        CHECK(l_arena.m_CurrentChunk != l_firstChunk);
+        CHECK(l_arena.m_CurrentChunk->m_Size == 128);
+    }
+    SECTION("One allocation bigger than the chunk size")
+    {
+        void* l_location = AllocateFromArena(l_arena, 10000);
+        REQUIRE(l_location != nullptr);
+        CHECK(l_arena.m_CurrentChunk != l_firstChunk);
+        CHECK(l_arena.m_CurrentChunk->m_Size >= 10000);
+        memset(l_location, 0xff, 10000);
+    }
+
+    CHECK(l_arena.m_CurrentChunk->m_PreviousChunk != nullptr);
+
+    //Reset keeps only the newest chunk.
+    ArenaChunk* l_current = l_arena.m_CurrentChunk;
+    ResetArena(l_arena);
+    CHECK(l_arena.m_CurrentChunk == l_current);
+    CHECK(l_arena.m_CurrentChunk->m_PreviousChunk == nullptr);
+    CHECK(FindNumberOfUsedBytesInCurrentChunkOfArena(l_arena) == 0);
+
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Allocation failure of a new chunk", "[Arena][Mutable][Allocation]")
+{
+
+    Arena l_arena;
+    SetCountOfNullMallocAfterCount(1);
+    CreateArenaAtOfChunkSizeUsingAllocatorAndDeallocator(
+        l_arena, 64,
+        NullMallocAfterCount, free,
+        nullptr, nullptr
+    );
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    Byte* l_oldTop = l_arena.m_Top;
+    CHECK(AllocateFromArena(l_arena, 1000) == nullptr);
+    CHECK(l_arena.m_Top == l_oldTop);
+    CHECK(AllocateFromArena(l_arena, 8) != nullptr);
+
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Reallocation", "[Arena][Mutable][Reallocation]")
+{
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 1024);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    Byte* l_first = (Byte*)AllocateFromArena(l_arena, 16);
+    REQUIRE(l_first != nullptr);
+    memset(l_first, 1, 16);
+
+    SECTION("Last allocation grows in place")
+    {
+        Byte* l_new = (Byte*)ReallocateInArena(l_arena, l_first, 100);
+        CHECK(l_new == l_first);
+        CHECK(l_arena.m_Top == l_first + 100);
+        for(Size i = 0; i < 16; ++i)
+        {
+            CHECK(l_new[i] == 1);
+        }
+    }
+    SECTION("Other allocations are moved")
+    {
+        Byte* l_second = (Byte*)AllocateFromArena(l_arena, 16);
+        REQUIRE(l_second != nullptr);
+        Byte* l_new = (Byte*)ReallocateInArena(l_arena, l_first, 100);
+        REQUIRE(l_new != nullptr);
+        CHECK(l_new != l_first);
+        for(Size i = 0; i < 16; ++i)
+        {
+            CHECK(l_new[i] == 1);
+        }
+    }
+    SECTION("Shrinking is in place")
+    {
+        CHECK(ReallocateInArena(l_arena, l_first, 4) == l_first);
+    }
+    SECTION("Growing past the chunk")
+    {
+        Byte* l_new = (Byte*)ReallocateInArena(l_arena, l_first, 5000);
+        REQUIRE(l_new != nullptr);
+        CHECK(l_new != l_first);
+        for(Size i = 0; i < 16; ++i)
+        {
+            CHECK(l_new[i] == 1);
+        }
+    }
+    SECTION("Null pointer")
+    {
+        CHECK(ReallocateInArena(l_arena, nullptr, 10) != nullptr);
+    }
+    SECTION("Zero size")
+    {
+        CHECK(ReallocateInArena(l_arena, l_first, 0) == nullptr);
+        CHECK(FindNumberOfUsedBytesInCurrentChunkOfArena(l_arena) < g_ARENA_ALIGNMENT);
+    }
+
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Deallocation", "[Arena][Mutable][Deallocation]")
+{
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 1024);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    void* l_first = AllocateFromArena(l_arena, 16);
+    Byte* l_topAfterFirst = l_arena.m_Top;
+    void* l_second = AllocateFromArena(l_arena, 16);
+    Byte* l_topAfterSecond = l_arena.m_Top;
+
+    DeallocateFromArena(l_arena, l_first);
+    CHECK(l_arena.m_Top == l_topAfterSecond);
+
+    DeallocateFromArena(l_arena, l_second);
+    CHECK(l_arena.m_Top < l_topAfterSecond);
+    CHECK(l_arena.m_Top >= l_topAfterFirst);
+
+    DeallocateFromArena(l_arena, nullptr);
+
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Adapters", "[Arena][Mutable][Adapters]")
+{
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 1024);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    SECTION("No arena")
+    {
+        SetArenaOfThisThread(nullptr);
+        CHECK(GetArenaOfThisThread() == nullptr);
+        CHECK(ArenaMalloc(10) == nullptr);
+        CHECK(ArenaRealloc(nullptr, 10) == nullptr);
+        ArenaFree(nullptr);
+    }
+    SECTION("With arena")
+    {
+        SetArenaOfThisThread(&l_arena);
+        CHECK(GetArenaOfThisThread() == &l_arena);
+
+        Allocator l_allocate = ArenaMalloc;
+        Reallocator l_reallocate = ArenaRealloc;
+        Deallocator l_deallocate = ArenaFree;
+
+        int* l_ints = (int*)l_allocate(sizeof(int) * 4);
+        REQUIRE(l_ints != nullptr);
+        for(int i = 0; i < 4; ++i)
+        {
+            l_ints[i] = i;
+        }
+
+        l_ints = (int*)l_reallocate(l_ints, sizeof(int) * 64);
+        REQUIRE(l_ints != nullptr);
+        for(int i = 0; i < 4; ++i)
+        {
+            CHECK(l_ints[i] == i);
+        }
+
+        l_deallocate(l_ints);
+        CHECK(FindNumberOfUsedBytesInCurrentChunkOfArena(l_arena) < g_ARENA_ALIGNMENT);
+
+        SetArenaOfThisThread(nullptr);
+    }
+
+    DestroyArena(l_arena);
+
+}
+
+TEST_CASE("Memory management interface", "[Arena][Mutable][MemoryManagement]")
+{
+
+    Arena l_arena;
+    CreateArenaAtOfChunkSize(l_arena, 1024);
+    REQUIRE(l_arena.m_CurrentChunk != nullptr);
+
+    MemoryManagement l_management = GetMemoryManagementOfArena(l_arena);
+    CHECK(l_management.m_State == &l_arena);
+
+    Memory l_memory(nullptr, 32, 0b011);
+    bool l_called = false;
+
+    l_management.m_Allocate(l_memory, l_management.m_State, &GeneralErrorCallback, &l_called);
+    CHECK(l_called == false);
+    REQUIRE(l_memory.m_Location != nullptr);
+    CHECK(l_memory.m_Size == 32);
+    CHECK(l_memory.m_Alignment == g_ARENA_ALIGNMENT);
+    CHECK((uintptr_t)l_memory.m_Location % g_ARENA_ALIGNMENT == 0);
+    CHECK(MemoryIsReadable(l_memory));
+    CHECK(MemoryIsWritable(l_memory));
+
+    for(Size i = 0; i < 32; ++i)
+    {
+        l_memory.m_Location[i] = (Byte)i;
+    }
+
+    SECTION("Executable allocation fails")
+    {
+        Memory l_executable(nullptr, 32, 0b111);
+        l_management.m_Allocate(l_executable, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_executable.m_Location == nullptr);
+        CHECK(l_executable.m_Size == 0);
+    }
+    SECTION("Overaligned allocation fails")
+    {
+        Memory l_overaligned(nullptr, 32, 0b011, 2 * g_ARENA_ALIGNMENT);
+        l_management.m_Allocate(l_overaligned, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_overaligned.m_Location == nullptr);
+        CHECK(l_overaligned.m_Size == 0);
+    }
+    SECTION("Repermissionating")
+    {
+        l_management.m_Repermissionate(l_memory, 0b001, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Permissions == 0b001);
+
+        l_management.m_Repermissionate(l_memory, 0b100, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_memory.m_Permissions == 0b001);
+    }
+    SECTION("Back reallocation")
+    {
+        l_management.m_ReallocateBack(l_memory, 64, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        REQUIRE(l_memory.m_Size == 64);
+        for(Size i = 0; i < 32; ++i)
+        {
+            CHECK(l_memory.m_Location[i] == (Byte)i);
+        }
+    }
+    SECTION("Front reallocation")
+    {
+        SECTION("Growing")
+        {
+            l_management.m_ReallocateFront(l_memory, 64, l_management.m_State, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            REQUIRE(l_memory.m_Size == 64);
+            for(Size i = 0; i < 32; ++i)
+            {
+                CHECK(l_memory.m_Location[32 + i] == (Byte)i);
+            }
+        }
+        SECTION("Shrinking")
+        {
+            Byte* l_oldLocation = l_memory.m_Location;
+            l_management.m_ReallocateFront(l_memory, 8, l_management.m_State, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Location == l_oldLocation + 24);
+            CHECK(l_memory.m_Alignment == 8);
+            REQUIRE(l_memory.m_Size == 8);
+            for(Size i = 0; i < 8; ++i)
+            {
+                CHECK(l_memory.m_Location[i] == (Byte)(24 + i));
+            }
+            //Back reallocation still works after the front moved.
+            l_management.m_ReallocateBack(l_memory, 16, l_management.m_State, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Location[0] == 24);
+            CHECK((uintptr_t)l_memory.m_Location % l_memory.m_Alignment == 0);
+        }
+    }
+    SECTION("Deallocation")
+    {
+        l_management.m_Deallocate(l_memory, l_management.m_State);
+        CHECK(l_memory.m_Location == nullptr);
+        CHECK(l_memory.m_Size == 0);
+    }
+
+    DestroyArena(l_arena);
+
+}
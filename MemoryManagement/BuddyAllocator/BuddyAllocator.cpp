@@ -0,0 +1,968 @@
+/**
+ * @file BuddyAllocator.cpp
+ * @brief Defines everything in the @ref BuddyAllocatorMod module.
+ *
+ */
+#include "BuddyAllocator.hpp"
+
+//Included for memcpy and memmove
+#include <string.h>
+//Included for clock_gettime
+#include <time.h>
+
+namespace Library
+{
+
+    //This is where the hidden global variables are stored.
+    namespace
+    {
+        //The buddy allocator used by BuddyMalloc, BuddyRealloc and BuddyFree.
+        thread_local BuddyAllocator* g_BuddyAllocatorOfThisThread = nullptr;
+
+        //The bit of a block state that is set if the block is free.
+        constexpr Byte g_FREE_BLOCK_BIT = 0x80;
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(
+        const Debugging::Log& p_log,
+        const BuddyAllocator& p_buddy_allocator
+    )
+    {
+
+        p_log << (void*)&p_buddy_allocator;
+        p_log << " { m_Region = " << (void*)p_buddy_allocator.m_Region;
+        p_log << ", m_RegionSize = " << p_buddy_allocator.m_RegionSize;
+        p_log << ", m_MinimumBlockSize = " << p_buddy_allocator.m_MinimumBlockSize;
+        p_log << ", m_OrderCount = " << p_buddy_allocator.m_OrderCount;
+        p_log << ", m_UsedBytes = " << p_buddy_allocator.m_Statistics.m_UsedBytes;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+
+    //Returns p_size rounded up to a power of two, 0 if that overflows.
+    static Size RoundUpToPowerOfTwo(const Size& p_size)
+    {
+        Size l_power = 1;
+        while(l_power < p_size)
+        {
+            if(l_power > SIZE_MAX / 2)
+            {
+                return 0;
+            }
+            l_power *= 2;
+        }
+        return l_power;
+    }
+
+    static Size FindMinimumBlockShiftOfBuddyAllocator(const BuddyAllocator& p_buddy_allocator)
+    {
+        return __builtin_ctzll(p_buddy_allocator.m_MinimumBlockSize);
+    }
+
+    //Returns the order of the smallest block with at least p_size bytes, which
+    //may be bigger than the biggest order of p_buddy_allocator.
+    static Size FindOrderOfSizeInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const Size& p_size
+    )
+    {
+        Size l_blocks =
+            (p_size >> FindMinimumBlockShiftOfBuddyAllocator(p_buddy_allocator)) +
+            ((p_size & (p_buddy_allocator.m_MinimumBlockSize - 1)) != 0);
+        if(l_blocks <= 1)
+        {
+            return 0;
+        }
+        return 64 - __builtin_clzll(l_blocks - 1);
+    }
+
+    static Size FindIndexOfLocationInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const void* p_location
+    )
+    {
+        return ((const Byte*)p_location - p_buddy_allocator.m_Region)
+            >> FindMinimumBlockShiftOfBuddyAllocator(p_buddy_allocator);
+    }
+
+    static Byte* FindLocationOfIndexInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const Size& p_index
+    )
+    {
+        return p_buddy_allocator.m_Region +
+            (p_index << FindMinimumBlockShiftOfBuddyAllocator(p_buddy_allocator));
+    }
+
+
+    static void PushFreeBlockToBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        const Size& p_index,
+        const Size& p_order
+    )
+    {
+
+        BuddyFreeBlock* l_block =
+            (BuddyFreeBlock*)FindLocationOfIndexInBuddyAllocator(p_buddy_allocator, p_index);
+        BuddyFreeBlock*& l_first = p_buddy_allocator.m_FreeBlocks[p_order];
+
+        l_block->m_NextBlock = l_first;
+        l_block->m_PreviousBlock = nullptr;
+        if(l_first != nullptr)
+        {
+            l_first->m_PreviousBlock = l_block;
+        }
+        l_first = l_block;
+
+        p_buddy_allocator.m_BlockStates[p_index] = (Byte)(p_order + 1) | g_FREE_BLOCK_BIT;
+
+    }
+
+    //Takes the block out of its free list, its state is left for the caller.
+    static void RemoveFreeBlockFromBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        const Size& p_index,
+        const Size& p_order
+    )
+    {
+
+        BuddyFreeBlock* l_block =
+            (BuddyFreeBlock*)FindLocationOfIndexInBuddyAllocator(p_buddy_allocator, p_index);
+
+        if(l_block->m_PreviousBlock != nullptr)
+        {
+            l_block->m_PreviousBlock->m_NextBlock = l_block->m_NextBlock;
+        }
+        else
+        {
+            p_buddy_allocator.m_FreeBlocks[p_order] = l_block->m_NextBlock;
+        }
+        if(l_block->m_NextBlock != nullptr)
+        {
+            l_block->m_NextBlock->m_PreviousBlock = l_block->m_PreviousBlock;
+        }
+
+    }
+
+    static bool BlockIsFreeOfOrderInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const Size& p_index,
+        const Size& p_order
+    )
+    {
+        return p_buddy_allocator.m_BlockStates[p_index] == ((Byte)(p_order + 1) | g_FREE_BLOCK_BIT);
+    }
+
+    //Returns the index of an allocated block of order p_order, or SIZE_MAX if
+    //there is no free block big enough.
+    static Size AllocateBlockOfOrderFromBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        const Size& p_order
+    )
+    {
+
+        Size l_order = p_order;
+        while(l_order < p_buddy_allocator.m_OrderCount && p_buddy_allocator.m_FreeBlocks[l_order] == nullptr)
+        {
+            ++l_order;
+        }
+        if(l_order >= p_buddy_allocator.m_OrderCount)
+        {
+            LogDebugLine("There is no free block of order " << p_order << " or bigger.");
+            return SIZE_MAX;
+        }
+
+        Size l_index = FindIndexOfLocationInBuddyAllocator(
+            p_buddy_allocator, p_buddy_allocator.m_FreeBlocks[l_order]
+        );
+        RemoveFreeBlockFromBuddyAllocator(p_buddy_allocator, l_index, l_order);
+
+        //The second half is given back each time, the first half is split
+        //again until it is the right size.
+        Size l_splits = l_order - p_order;
+        while(l_order > p_order)
+        {
+            --l_order;
+            PushFreeBlockToBuddyAllocator(p_buddy_allocator, l_index + ((Size)1 << l_order), l_order);
+        }
+
+        p_buddy_allocator.m_BlockStates[l_index] = (Byte)(p_order + 1);
+
+        p_buddy_allocator.m_Statistics.m_UsedBytes += p_buddy_allocator.m_MinimumBlockSize << p_order;
+        if(l_splits > p_buddy_allocator.m_Statistics.m_MostSplits)
+        {
+            p_buddy_allocator.m_Statistics.m_MostSplits = l_splits;
+        }
+
+        return l_index;
+
+    }
+
+    //Frees the block, merging it with its buddies while they are free.
+    static void FreeBlockOfOrderToBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        Size p_index,
+        Size p_order
+    )
+    {
+
+        p_buddy_allocator.m_Statistics.m_UsedBytes -= p_buddy_allocator.m_MinimumBlockSize << p_order;
+        p_buddy_allocator.m_BlockStates[p_index] = 0;
+
+        Size l_merges = 0;
+        while(p_order + 1 < p_buddy_allocator.m_OrderCount)
+        {
+            Size l_buddy = p_index ^ ((Size)1 << p_order);
+            if(BlockIsFreeOfOrderInBuddyAllocator(p_buddy_allocator, l_buddy, p_order) == false)
+            {
+                break;
+            }
+
+            RemoveFreeBlockFromBuddyAllocator(p_buddy_allocator, l_buddy, p_order);
+            p_buddy_allocator.m_BlockStates[l_buddy] = 0;
+            if(l_buddy < p_index)
+            {
+                p_index = l_buddy;
+            }
+            ++p_order;
+            ++l_merges;
+        }
+
+        PushFreeBlockToBuddyAllocator(p_buddy_allocator, p_index, p_order);
+
+        if(l_merges > p_buddy_allocator.m_Statistics.m_MostMerges)
+        {
+            p_buddy_allocator.m_Statistics.m_MostMerges = l_merges;
+        }
+
+    }
+
+    //Changes the order of an allocated block without moving it. Shrinking
+    //always works, growing only works if the block is the first half of every
+    //buddy it needs and those buddies are free. Returns false if the block
+    //could not be resized, it is not mutated in that case.
+    static bool ResizeBlockInPlaceInBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        const Size& p_index,
+        const Size& p_order,
+        const Size& p_new_order
+    )
+    {
+
+        if(p_new_order < p_order)
+        {
+            //The second halves are given back, their buddies are the block
+            //itself so they can not be merged.
+            for(Size l_order = p_order; l_order > p_new_order; --l_order)
+            {
+                PushFreeBlockToBuddyAllocator(
+                    p_buddy_allocator, p_index + ((Size)1 << (l_order - 1)), l_order - 1
+                );
+            }
+        }
+        else
+        {
+            if(p_new_order >= p_buddy_allocator.m_OrderCount)
+            {
+                return false;
+            }
+            for(Size l_order = p_order; l_order < p_new_order; ++l_order)
+            {
+                if(
+                    (p_index & ((Size)1 << l_order)) != 0 ||
+                    BlockIsFreeOfOrderInBuddyAllocator(
+                        p_buddy_allocator, p_index + ((Size)1 << l_order), l_order
+                    ) == false
+                )
+                {
+                    return false;
+                }
+            }
+
+            for(Size l_order = p_order; l_order < p_new_order; ++l_order)
+            {
+                Size l_buddy = p_index + ((Size)1 << l_order);
+                RemoveFreeBlockFromBuddyAllocator(p_buddy_allocator, l_buddy, l_order);
+                p_buddy_allocator.m_BlockStates[l_buddy] = 0;
+            }
+
+            if(p_new_order - p_order > p_buddy_allocator.m_Statistics.m_MostMerges)
+            {
+                p_buddy_allocator.m_Statistics.m_MostMerges = p_new_order - p_order;
+            }
+        }
+
+        p_buddy_allocator.m_BlockStates[p_index] = (Byte)(p_new_order + 1);
+        p_buddy_allocator.m_Statistics.m_UsedBytes -= p_buddy_allocator.m_MinimumBlockSize << p_order;
+        p_buddy_allocator.m_Statistics.m_UsedBytes += p_buddy_allocator.m_MinimumBlockSize << p_new_order;
+
+        return true;
+
+    }
+
+
+    static Size GetNanosecondsOfBuddyAllocator(const BuddyAllocator& p_buddy_allocator)
+    {
+        if(p_buddy_allocator.m_MeasureLatency == false)
+        {
+            return 0;
+        }
+        timespec l_time;
+        clock_gettime(CLOCK_MONOTONIC, &l_time);
+        return (Size)l_time.tv_sec * 1000000000 + (Size)l_time.tv_nsec;
+    }
+
+    static void RecordLatencyInBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        const Size& p_start
+    )
+    {
+
+        if(p_buddy_allocator.m_MeasureLatency == false)
+        {
+            return;
+        }
+
+        Size l_latency = GetNanosecondsOfBuddyAllocator(p_buddy_allocator) - p_start;
+        BuddyAllocatorStatistics& l_statistics = p_buddy_allocator.m_Statistics;
+
+        Size l_bucket = 0;
+        while(l_bucket + 1 < g_BUDDY_ALLOCATOR_LATENCY_HISTOGRAM_SIZE && l_latency >= ((Size)32 << l_bucket))
+        {
+            ++l_bucket;
+        }
+        ++l_statistics.m_LatencyHistogram[l_bucket];
+
+        if(l_latency > l_statistics.m_LongestLatency)
+        {
+            l_statistics.m_LongestLatency = l_latency;
+        }
+        l_statistics.m_TotalLatency += l_latency;
+
+    }
+
+
+    //Buddy allocators can not be assigned, so this does what assigning a
+    //default constructed one would.
+    static void MakeNullBuddyAllocator(BuddyAllocator& p_buddy_allocator)
+    {
+        p_buddy_allocator.m_Region = nullptr;
+        p_buddy_allocator.m_RegionSize = 0;
+        p_buddy_allocator.m_MinimumBlockSize = 0;
+        p_buddy_allocator.m_OrderCount = 0;
+        p_buddy_allocator.m_BlockStates = nullptr;
+        for(Size i = 0; i < g_BUDDY_ALLOCATOR_MAX_ORDER_COUNT; ++i)
+        {
+            p_buddy_allocator.m_FreeBlocks[i] = nullptr;
+        }
+        p_buddy_allocator.m_MeasureLatency = false;
+        p_buddy_allocator.m_Statistics = BuddyAllocatorStatistics();
+        p_buddy_allocator.m_Deallocate = nullptr;
+    }
+
+
+    void CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+        BuddyAllocator& outp_buddy_allocator,
+        const Size& p_size,
+        const Size& p_minimum_block_size,
+        AlignedAllocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating buddy allocator at " << (void*)&outp_buddy_allocator
+        << " of size " << p_size << " and minimum block size " << p_minimum_block_size);
+
+        MakeNullBuddyAllocator(outp_buddy_allocator);
+
+        Size l_minimumBlockSize = RoundUpToPowerOfTwo(
+            p_minimum_block_size < g_BUDDY_ALLOCATOR_MINIMUM_BLOCK_SIZE ?
+            g_BUDDY_ALLOCATOR_MINIMUM_BLOCK_SIZE : p_minimum_block_size
+        );
+        Size l_regionSize = RoundUpToPowerOfTwo(p_size < l_minimumBlockSize ? l_minimumBlockSize : p_size);
+        if(p_size == 0 || l_minimumBlockSize == 0 || l_regionSize == 0)
+        {
+            LogDebugLine("The sizes are 0 or overflow, leaving a null buddy allocator and returning.");
+            return;
+        }
+
+        Size l_blockCount = l_regionSize / l_minimumBlockSize;
+        Size l_orderCount = __builtin_ctzll(l_blockCount) + 1;
+        if(l_orderCount > g_BUDDY_ALLOCATOR_MAX_ORDER_COUNT || l_blockCount > SIZE_MAX - l_regionSize)
+        {
+            LogDebugLine("The region needs too many orders, leaving a null buddy allocator and returning.");
+            return;
+        }
+
+        //The block states go right after the region.
+        Byte* l_region = (Byte*)p_allocate(g_BUDDY_ALLOCATOR_REGION_ALIGNMENT, l_regionSize + l_blockCount);
+        if(l_region == nullptr)
+        {
+            LogDebugLine("Could not allocate the region, leaving a null buddy allocator.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        outp_buddy_allocator.m_Region = l_region;
+        outp_buddy_allocator.m_RegionSize = l_regionSize;
+        outp_buddy_allocator.m_MinimumBlockSize = l_minimumBlockSize;
+        outp_buddy_allocator.m_OrderCount = l_orderCount;
+        outp_buddy_allocator.m_BlockStates = l_region + l_regionSize;
+        outp_buddy_allocator.m_Deallocate = p_deallocate;
+
+        memset(outp_buddy_allocator.m_BlockStates, 0, l_blockCount);
+        PushFreeBlockToBuddyAllocator(outp_buddy_allocator, 0, l_orderCount - 1);
+
+        LogDebugLine("Successfully created buddy allocator " << outp_buddy_allocator);
+
+    }
+
+    void DestroyBuddyAllocator(BuddyAllocator& p_buddy_allocator)
+    {
+
+        LogDebugLine("Destroying buddy allocator " << p_buddy_allocator);
+
+        if(p_buddy_allocator.m_Region != nullptr)
+        {
+            p_buddy_allocator.m_Deallocate(p_buddy_allocator.m_Region);
+        }
+
+        MakeNullBuddyAllocator(p_buddy_allocator);
+
+    }
+
+
+    //The functions below do the work without measuring it, so that the
+    //public functions that call each other are only measured once.
+
+    static void* AllocateBytesFromBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        const Size& p_size
+    )
+    {
+
+        if(p_buddy_allocator.m_OrderCount == 0)
+        {
+            LogDebugLine("The buddy allocator is a null buddy allocator, returning null.");
+            ++p_buddy_allocator.m_Statistics.m_NumberOfFailedAllocations;
+            return nullptr;
+        }
+
+        Size l_order = FindOrderOfSizeInBuddyAllocator(p_buddy_allocator, p_size);
+        Size l_index = SIZE_MAX;
+        if(l_order < p_buddy_allocator.m_OrderCount)
+        {
+            l_index = AllocateBlockOfOrderFromBuddyAllocator(p_buddy_allocator, l_order);
+        }
+
+        if(l_index == SIZE_MAX)
+        {
+            ++p_buddy_allocator.m_Statistics.m_NumberOfFailedAllocations;
+            return nullptr;
+        }
+
+        ++p_buddy_allocator.m_Statistics.m_NumberOfAllocations;
+        return FindLocationOfIndexInBuddyAllocator(p_buddy_allocator, l_index);
+
+    }
+
+    static void DeallocateBytesFromBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        void* p_pointer
+    )
+    {
+
+        Size l_index = FindIndexOfLocationInBuddyAllocator(p_buddy_allocator, p_pointer);
+        Size l_order = p_buddy_allocator.m_BlockStates[l_index] - 1;
+
+        FreeBlockOfOrderToBuddyAllocator(p_buddy_allocator, l_index, l_order);
+        ++p_buddy_allocator.m_Statistics.m_NumberOfDeallocations;
+
+    }
+
+    static void* ReallocateBytesInBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        void* p_pointer,
+        const Size& p_size
+    )
+    {
+
+        Size l_index = FindIndexOfLocationInBuddyAllocator(p_buddy_allocator, p_pointer);
+        Size l_order = p_buddy_allocator.m_BlockStates[l_index] - 1;
+        Size l_newOrder = FindOrderOfSizeInBuddyAllocator(p_buddy_allocator, p_size);
+
+        if(l_newOrder == l_order)
+        {
+            LogDebugLine("The new size fits in the block, nothing to do.");
+            return p_pointer;
+        }
+
+        if(ResizeBlockInPlaceInBuddyAllocator(p_buddy_allocator, l_index, l_order, l_newOrder))
+        {
+            LogDebugLine("Resized the block in place.");
+            ++p_buddy_allocator.m_Statistics.m_NumberOfInPlaceReallocations;
+            return p_pointer;
+        }
+
+        LogDebugLine("Moving the block.");
+        void* l_newLocation = AllocateBytesFromBuddyAllocator(p_buddy_allocator, p_size);
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Allocation failed, returning null.");
+            return nullptr;
+        }
+        //The allocation counted above is part of the reallocation.
+        --p_buddy_allocator.m_Statistics.m_NumberOfAllocations;
+
+        //Only growing moves, so the whole old block is copied.
+        memcpy(l_newLocation, p_pointer, p_buddy_allocator.m_MinimumBlockSize << l_order);
+        FreeBlockOfOrderToBuddyAllocator(p_buddy_allocator, l_index, l_order);
+        ++p_buddy_allocator.m_Statistics.m_NumberOfMovingReallocations;
+
+        return l_newLocation;
+
+    }
+
+
+    void* AllocateFromBuddyAllocator(BuddyAllocator& p_buddy_allocator, const Size& p_size)
+    {
+
+        LogDebugLine("Allocating " << p_size << " bytes from buddy allocator "
+        << p_buddy_allocator);
+
+        Size l_start = GetNanosecondsOfBuddyAllocator(p_buddy_allocator);
+
+        void* l_location = AllocateBytesFromBuddyAllocator(p_buddy_allocator, p_size);
+        if(l_location != nullptr)
+        {
+            p_buddy_allocator.m_Statistics.m_RequestedBytes +=
+                FindSizeOfBlockInBuddyAllocator(p_buddy_allocator, l_location);
+        }
+
+        RecordLatencyInBuddyAllocator(p_buddy_allocator, l_start);
+
+        return l_location;
+
+    }
+
+    void* ReallocateInBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        void* p_pointer,
+        const Size& p_size
+    )
+    {
+
+        LogDebugLine("Reallocating " << p_pointer << " to " << p_size
+        << " bytes in buddy allocator " << p_buddy_allocator);
+
+        if(p_pointer == nullptr)
+        {
+            LogDebugLine("The pointer is null, allocating instead.");
+            return AllocateFromBuddyAllocator(p_buddy_allocator, p_size);
+        }
+        if(p_size == 0)
+        {
+            LogDebugLine("The new size is 0, deallocating instead.");
+            DeallocateFromBuddyAllocator(p_buddy_allocator, p_pointer);
+            return nullptr;
+        }
+
+        Size l_start = GetNanosecondsOfBuddyAllocator(p_buddy_allocator);
+
+        Size l_oldSize = FindSizeOfBlockInBuddyAllocator(p_buddy_allocator, p_pointer);
+        void* l_location = ReallocateBytesInBuddyAllocator(p_buddy_allocator, p_pointer, p_size);
+        if(l_location != nullptr)
+        {
+            p_buddy_allocator.m_Statistics.m_RequestedBytes -= l_oldSize;
+            p_buddy_allocator.m_Statistics.m_RequestedBytes +=
+                FindSizeOfBlockInBuddyAllocator(p_buddy_allocator, l_location);
+        }
+
+        RecordLatencyInBuddyAllocator(p_buddy_allocator, l_start);
+
+        return l_location;
+
+    }
+
+    void DeallocateFromBuddyAllocator(BuddyAllocator& p_buddy_allocator, void* p_pointer)
+    {
+
+        LogDebugLine("Deallocating " << p_pointer << " from buddy allocator "
+        << p_buddy_allocator);
+
+        if(p_pointer == nullptr)
+        {
+            return;
+        }
+
+        Size l_start = GetNanosecondsOfBuddyAllocator(p_buddy_allocator);
+
+        p_buddy_allocator.m_Statistics.m_RequestedBytes -=
+            FindSizeOfBlockInBuddyAllocator(p_buddy_allocator, p_pointer);
+        DeallocateBytesFromBuddyAllocator(p_buddy_allocator, p_pointer);
+
+        RecordLatencyInBuddyAllocator(p_buddy_allocator, l_start);
+
+    }
+
+    Size FindSizeOfBlockInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const void* p_pointer
+    )
+    {
+        Size l_index = FindIndexOfLocationInBuddyAllocator(p_buddy_allocator, p_pointer);
+        Size l_order = (p_buddy_allocator.m_BlockStates[l_index] & ~g_FREE_BLOCK_BIT) - 1;
+        return p_buddy_allocator.m_MinimumBlockSize << l_order;
+    }
+
+
+    Size FindSizeOfLargestFreeBlockInBuddyAllocator(const BuddyAllocator& p_buddy_allocator)
+    {
+        for(Size l_order = p_buddy_allocator.m_OrderCount; l_order > 0; --l_order)
+        {
+            if(p_buddy_allocator.m_FreeBlocks[l_order - 1] != nullptr)
+            {
+                return p_buddy_allocator.m_MinimumBlockSize << (l_order - 1);
+            }
+        }
+        return 0;
+    }
+
+    Size FindNumberOfFreeBlocksOfOrderInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const Size& p_order
+    )
+    {
+
+        if(p_order >= p_buddy_allocator.m_OrderCount)
+        {
+            return 0;
+        }
+
+        Size l_count = 0;
+        for(
+            BuddyFreeBlock* l_block = p_buddy_allocator.m_FreeBlocks[p_order];
+            l_block != nullptr;
+            l_block = l_block->m_NextBlock
+        )
+        {
+            ++l_count;
+        }
+
+        return l_count;
+
+    }
+
+    double FindExternalFragmentationOfBuddyAllocator(const BuddyAllocator& p_buddy_allocator)
+    {
+        Size l_freeBytes = FindNumberOfFreeBytesInBuddyAllocator(p_buddy_allocator);
+        if(l_freeBytes == 0)
+        {
+            return 0;
+        }
+        return 1 - (double)FindSizeOfLargestFreeBlockInBuddyAllocator(p_buddy_allocator) / l_freeBytes;
+    }
+
+
+    void SetBuddyAllocatorOfThisThread(BuddyAllocator* p_buddy_allocator)
+    {
+        g_BuddyAllocatorOfThisThread = p_buddy_allocator;
+    }
+    BuddyAllocator* GetBuddyAllocatorOfThisThread()
+    {
+        return g_BuddyAllocatorOfThisThread;
+    }
+
+    void* BuddyMalloc(Size p_size)
+    {
+        if(g_BuddyAllocatorOfThisThread == nullptr)
+        {
+            return nullptr;
+        }
+        return AllocateFromBuddyAllocator(*g_BuddyAllocatorOfThisThread, p_size);
+    }
+    void* BuddyRealloc(void* p_pointer, Size p_size)
+    {
+        if(g_BuddyAllocatorOfThisThread == nullptr)
+        {
+            return nullptr;
+        }
+        return ReallocateInBuddyAllocator(*g_BuddyAllocatorOfThisThread, p_pointer, p_size);
+    }
+    void BuddyFree(void* p_pointer)
+    {
+        if(g_BuddyAllocatorOfThisThread == nullptr)
+        {
+            return;
+        }
+        DeallocateFromBuddyAllocator(*g_BuddyAllocatorOfThisThread, p_pointer);
+    }
+
+
+    //Returns the alignment of the block at p_location.
+    static Size FindAlignmentOfBlockInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const void* p_location
+    )
+    {
+        Size l_size = FindSizeOfBlockInBuddyAllocator(p_buddy_allocator, p_location);
+        return l_size < g_BUDDY_ALLOCATOR_REGION_ALIGNMENT ? l_size : g_BUDDY_ALLOCATOR_REGION_ALIGNMENT;
+    }
+
+    void AllocateMemoryFromBuddyAllocator(
+        Memory& outp_memory,
+        void*& p_state,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Allocating memory of size " << outp_memory.m_Size
+        << " from buddy allocator at " << p_state);
+
+        if(outp_memory.m_Size == 0)
+        {
+            LogDebugLine("The size is 0, writing null memory.");
+            outp_memory = Memory();
+            return;
+        }
+
+        BuddyAllocator& l_buddyAllocator = *(BuddyAllocator*)p_state;
+        Size l_start = GetNanosecondsOfBuddyAllocator(l_buddyAllocator);
+
+        void* l_location = nullptr;
+        //Blocks are aligned to their size, so a big enough block is aligned
+        //enough.
+        if(
+            MemoryIsExecutable(outp_memory) == false &&
+            outp_memory.m_Alignment <= g_BUDDY_ALLOCATOR_REGION_ALIGNMENT
+        )
+        {
+            l_location = AllocateBytesFromBuddyAllocator(
+                l_buddyAllocator,
+                outp_memory.m_Size < outp_memory.m_Alignment ? outp_memory.m_Alignment : outp_memory.m_Size
+            );
+        }
+
+        RecordLatencyInBuddyAllocator(l_buddyAllocator, l_start);
+
+        if(l_location == nullptr)
+        {
+            LogDebugLine("Allocation failed, writing null memory.");
+            outp_memory = Memory();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        l_buddyAllocator.m_Statistics.m_RequestedBytes += outp_memory.m_Size;
+
+        outp_memory.m_Location = (Byte*)l_location;
+        outp_memory.m_Alignment = FindAlignmentOfBlockInBuddyAllocator(l_buddyAllocator, l_location);
+        //Readable and writable.
+        outp_memory.m_Permissions = 0b011;
+
+    }
+
+    void RepermissionateMemoryFromBuddyAllocator(
+        Memory& p_memory,
+        const Byte& p_new_permissions,
+        void*& p_state,
+        Callback p_repermission_error, void* p_repermission_error_data
+    )
+    {
+
+        LogDebugLine("Repermissionating buddy allocator memory at "
+        << (void*)p_memory.m_Location << " to " << (unsigned)p_new_permissions);
+
+        (void)p_state;
+
+        //Anything other than read and write can not be given.
+        if((p_new_permissions & ~0b011) != 0)
+        {
+            LogDebugLine("The new permissions can not be given by a buddy allocator.");
+            if(p_repermission_error != nullptr)
+            {
+                LogDebugLine("Repermission error is not null so calling it.");
+                p_repermission_error(p_repermission_error_data);
+            }
+            return;
+        }
+
+        p_memory.m_Permissions = p_new_permissions;
+
+    }
+
+    void ReallocateFrontOfMemoryFromBuddyAllocator(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reallocating the front of buddy allocator memory at "
+        << (void*)p_memory.m_Location << " to " << p_new_size << " bytes");
+
+        if(p_new_size == 0)
+        {
+            DeallocateMemoryFromBuddyAllocator(p_memory, p_state);
+            return;
+        }
+        if(p_memory.m_Location == nullptr)
+        {
+            Memory l_memory(nullptr, p_new_size, 0b011);
+            AllocateMemoryFromBuddyAllocator(l_memory, p_state, p_realloc_error, p_realloc_error_data);
+            if(l_memory.m_Location != nullptr)
+            {
+                p_memory = l_memory;
+            }
+            return;
+        }
+
+        BuddyAllocator& l_buddyAllocator = *(BuddyAllocator*)p_state;
+        Size l_start = GetNanosecondsOfBuddyAllocator(l_buddyAllocator);
+
+        Byte* l_newLocation;
+        if(p_new_size <= p_memory.m_Size)
+        {
+            LogDebugLine("Moving the kept bytes to the start and shrinking.");
+            memmove(p_memory.m_Location, p_memory.m_Location + (p_memory.m_Size - p_new_size), p_new_size);
+            l_newLocation = (Byte*)ReallocateBytesInBuddyAllocator(l_buddyAllocator, p_memory.m_Location, p_new_size);
+        }
+        else
+        {
+            LogDebugLine("Moving the kept bytes to the end of a new block.");
+            l_newLocation = (Byte*)AllocateBytesFromBuddyAllocator(l_buddyAllocator, p_new_size);
+            if(l_newLocation != nullptr)
+            {
+                --l_buddyAllocator.m_Statistics.m_NumberOfAllocations;
+                ++l_buddyAllocator.m_Statistics.m_NumberOfMovingReallocations;
+                memcpy(l_newLocation + (p_new_size - p_memory.m_Size), p_memory.m_Location, p_memory.m_Size);
+                DeallocateBytesFromBuddyAllocator(l_buddyAllocator, p_memory.m_Location);
+                --l_buddyAllocator.m_Statistics.m_NumberOfDeallocations;
+            }
+        }
+
+        RecordLatencyInBuddyAllocator(l_buddyAllocator, l_start);
+
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Allocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        l_buddyAllocator.m_Statistics.m_RequestedBytes -= p_memory.m_Size;
+        l_buddyAllocator.m_Statistics.m_RequestedBytes += p_new_size;
+
+        p_memory.m_Location = l_newLocation;
+        p_memory.m_Size = p_new_size;
+        p_memory.m_Alignment = FindAlignmentOfBlockInBuddyAllocator(l_buddyAllocator, l_newLocation);
+
+    }
+
+    void ReallocateBackOfMemoryFromBuddyAllocator(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reallocating the back of buddy allocator memory at "
+        << (void*)p_memory.m_Location << " to " << p_new_size << " bytes");
+
+        if(p_new_size == 0)
+        {
+            DeallocateMemoryFromBuddyAllocator(p_memory, p_state);
+            return;
+        }
+        if(p_memory.m_Location == nullptr)
+        {
+            Memory l_memory(nullptr, p_new_size, 0b011);
+            AllocateMemoryFromBuddyAllocator(l_memory, p_state, p_realloc_error, p_realloc_error_data);
+            if(l_memory.m_Location != nullptr)
+            {
+                p_memory = l_memory;
+            }
+            return;
+        }
+
+        BuddyAllocator& l_buddyAllocator = *(BuddyAllocator*)p_state;
+        Size l_start = GetNanosecondsOfBuddyAllocator(l_buddyAllocator);
+
+        //Shrinking never moves the block, so its location keeps the alignment
+        //it has and the block only has to fit p_new_size. Growing can move it
+        //and blocks are only aligned to their size, so a block that grows is
+        //kept at least as big as the alignment.
+        Size l_size = p_new_size;
+        if(p_new_size > p_memory.m_Size && p_new_size < p_memory.m_Alignment)
+        {
+            l_size = p_memory.m_Alignment;
+        }
+        Byte* l_newLocation = (Byte*)ReallocateBytesInBuddyAllocator(l_buddyAllocator, p_memory.m_Location, l_size);
+
+        RecordLatencyInBuddyAllocator(l_buddyAllocator, l_start);
+
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Reallocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        l_buddyAllocator.m_Statistics.m_RequestedBytes -= p_memory.m_Size;
+        l_buddyAllocator.m_Statistics.m_RequestedBytes += p_new_size;
+
+        Size l_alignment = FindAlignmentOfBlockInBuddyAllocator(l_buddyAllocator, l_newLocation);
+        if(l_alignment > p_memory.m_Alignment || l_newLocation != p_memory.m_Location)
+        {
+            p_memory.m_Alignment = l_alignment;
+        }
+        p_memory.m_Location = l_newLocation;
+        p_memory.m_Size = p_new_size;
+
+    }
+
+    void DeallocateMemoryFromBuddyAllocator(Memory& p_memory, void*& p_state)
+    {
+
+        LogDebugLine("Deallocating buddy allocator memory at " << (void*)p_memory.m_Location);
+
+        if(p_memory.m_Location != nullptr)
+        {
+            BuddyAllocator& l_buddyAllocator = *(BuddyAllocator*)p_state;
+            Size l_start = GetNanosecondsOfBuddyAllocator(l_buddyAllocator);
+
+            l_buddyAllocator.m_Statistics.m_RequestedBytes -= p_memory.m_Size;
+            DeallocateBytesFromBuddyAllocator(l_buddyAllocator, p_memory.m_Location);
+
+            RecordLatencyInBuddyAllocator(l_buddyAllocator, l_start);
+        }
+
+        p_memory = Memory();
+
+    }
+
+}
@@ -0,0 +1,593 @@
+/**
+ * @file BuddyAllocator.hpp
+ * @brief Declares everything in the @ref BuddyAllocatorMod module.
+ *
+ * @details Everything is defined in BuddyAllocator.cpp.
+ *
+ */
+#ifndef BUDDY_ALLOCATOR__MEMORY_MANAGEMENT_BUDDY_ALLOCATOR_BUDDY_ALLOCATOR_HPP
+#define BUDDY_ALLOCATOR__MEMORY_MANAGEMENT_BUDDY_ALLOCATOR_BUDDY_ALLOCATOR_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../MemoryManagement.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+namespace Library
+{
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief The smallest block a buddy allocator can have, smaller minimum
+     * block sizes are rounded up to this.
+     *
+     * @details Free blocks hold the links of their free list, so they need
+     * room for 2 pointers. This is also the alignment that malloc gives.
+     *
+     */
+    constexpr Size g_BUDDY_ALLOCATOR_MINIMUM_BLOCK_SIZE = alignof(max_align_t) < 2 * sizeof(void*) ?
+        2 * sizeof(void*) : alignof(max_align_t);
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief The alignment of the region of every buddy allocator.
+     *
+     * @details A block is aligned to its own size or to this, whichever is
+     * smaller.
+     *
+     */
+    constexpr Size g_BUDDY_ALLOCATOR_REGION_ALIGNMENT = 4096;
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief The most orders a buddy allocator can have, a block of order n
+     * is 2^n minimum blocks big.
+     *
+     */
+    constexpr Size g_BUDDY_ALLOCATOR_MAX_ORDER_COUNT = 48;
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief The number of buckets in the latency histogram of a buddy
+     * allocator.
+     *
+     * @details The first bucket counts operations that took less than 32
+     * nanoseconds, each bucket after it counts operations that took less than
+     * twice as long as the one before it, and the last one counts everything
+     * slower.
+     *
+     */
+    constexpr Size g_BUDDY_ALLOCATOR_LATENCY_HISTOGRAM_SIZE = 20;
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief The links placed at the start of every free block.
+     *
+     */
+    struct BuddyFreeBlock
+    {
+        BuddyFreeBlock* m_NextBlock;
+        BuddyFreeBlock* m_PreviousBlock;
+    };
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief The statistics of a buddy allocator, used to keep an eye on its
+     * fragmentation and latency.
+     *
+     * @details The worst case latency of a buddy allocator is bounded by the
+     * number of splits and merges a single operation does, which is never
+     * more than the number of orders. @ref m_MostSplits and @ref m_MostMerges
+     * are the worst that was actually seen.
+     *
+     * The latency fields are only updated while
+     * @ref BuddyAllocator::m_MeasureLatency is true, since reading the clock
+     * costs about as much as an allocation.
+     *
+     */
+    struct BuddyAllocatorStatistics
+    {
+
+        Size m_NumberOfAllocations;
+        Size m_NumberOfFailedAllocations;
+        Size m_NumberOfDeallocations;
+        /**
+         * @brief The number of reallocations that were done in place, by
+         * merging with free buddies or by splitting off the unused end.
+         *
+         */
+        Size m_NumberOfInPlaceReallocations;
+        /**
+         * @brief The number of reallocations that had to copy the bytes to a
+         * new block.
+         *
+         */
+        Size m_NumberOfMovingReallocations;
+
+        /**
+         * @brief The number of bytes currently asked for, only known when
+         * allocating through the @ref MemoryManagement interface, otherwise
+         * whole blocks are counted.
+         *
+         */
+        Size m_RequestedBytes;
+        /**
+         * @brief The number of bytes in every block that is currently
+         * allocated, m_UsedBytes - m_RequestedBytes is the internal
+         * fragmentation.
+         *
+         */
+        Size m_UsedBytes;
+
+        /**
+         * @brief The most blocks split by a single allocation.
+         *
+         */
+        Size m_MostSplits;
+        /**
+         * @brief The most blocks merged by a single deallocation or
+         * reallocation.
+         *
+         */
+        Size m_MostMerges;
+
+        /**
+         * @brief The number of operations of each latency, see
+         * @ref g_BUDDY_ALLOCATOR_LATENCY_HISTOGRAM_SIZE.
+         *
+         */
+        Size m_LatencyHistogram[g_BUDDY_ALLOCATOR_LATENCY_HISTOGRAM_SIZE];
+        /**
+         * @brief The slowest operation, in nanoseconds.
+         *
+         */
+        Size m_LongestLatency;
+        /**
+         * @brief The time spent in every measured operation, in nanoseconds.
+         *
+         */
+        Size m_TotalLatency;
+
+
+        /**
+         * @brief Constructs the statistics of a buddy allocator that was not
+         * used yet.
+         *
+         */
+        BuddyAllocatorStatistics():
+        m_NumberOfAllocations(0),
+        m_NumberOfFailedAllocations(0),
+        m_NumberOfDeallocations(0),
+        m_NumberOfInPlaceReallocations(0),
+        m_NumberOfMovingReallocations(0),
+        m_RequestedBytes(0),
+        m_UsedBytes(0),
+        m_MostSplits(0),
+        m_MostMerges(0),
+        m_LatencyHistogram(),
+        m_LongestLatency(0),
+        m_TotalLatency(0)
+        {
+        }
+
+    };
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief An allocator that splits a single region into power of two
+     * blocks and merges them back together when they are freed.
+     *
+     * @details The region is 2^(@ref m_OrderCount - 1) blocks of
+     * @ref m_MinimumBlockSize bytes. Every allocation is rounded up to the
+     * nearest power of two number of minimum blocks, its order. A free block
+     * of a bigger order is split in halves, buddies, until it is the right
+     * size. When a block is freed and its buddy is also free the two are
+     * merged back, and so on upwards. This keeps fragmentation bounded, the
+     * region never ends up as many small holes like a general purpose heap
+     * can after days of running.
+     *
+     * Each minimum block has a byte in @ref m_BlockStates, so no header is
+     * needed in front of allocations and every block is aligned to its own
+     * size, up to @ref g_BUDDY_ALLOCATOR_REGION_ALIGNMENT.
+     *
+     * Buddy allocators never grow, when the region is full allocation fails.
+     * They are not thread safe, each thread should use its own.
+     *
+     * @section BuddyAllocatorTypes Types of buddy allocators
+     * - Null buddy allocator, every field is null or 0. Allocating from it
+     * always fails. This is what the default constructor makes.
+     * - Valid buddy allocator, created using
+     * @ref CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator.
+     *
+     */
+    struct BuddyAllocator
+    {
+
+        /**
+         * @brief The start of the region blocks are given out from.
+         *
+         */
+        Byte* m_Region;
+        /**
+         * @brief The number of bytes in @ref m_Region, always a power of two.
+         *
+         */
+        Size m_RegionSize;
+        /**
+         * @brief The size of a block of order 0, always a power of two.
+         *
+         */
+        Size m_MinimumBlockSize;
+        /**
+         * @brief The number of orders, the only block of the biggest order is
+         * the whole region.
+         *
+         */
+        Size m_OrderCount;
+        /**
+         * @brief One byte for each minimum block of the region.
+         *
+         * @details The byte of the first minimum block of a block is its
+         * order plus 1, with the highest bit set if the block is free. The
+         * bytes of every other minimum block are 0.
+         *
+         */
+        Byte* m_BlockStates;
+        /**
+         * @brief The first free block of each order.
+         *
+         */
+        BuddyFreeBlock* m_FreeBlocks[g_BUDDY_ALLOCATOR_MAX_ORDER_COUNT];
+
+        /**
+         * @brief If true the latency of every operation is measured, see
+         * @ref BuddyAllocatorStatistics.
+         *
+         */
+        bool m_MeasureLatency;
+        BuddyAllocatorStatistics m_Statistics;
+
+        /**
+         * @brief Used for freeing the region on destruction.
+         *
+         */
+        void (*m_Deallocate) (void*);
+
+
+        /**
+         * @brief Constructs a null buddy allocator.
+         *
+         */
+        BuddyAllocator():
+        m_Region(nullptr),
+        m_RegionSize(0),
+        m_MinimumBlockSize(0),
+        m_OrderCount(0),
+        m_BlockStates(nullptr),
+        m_FreeBlocks(),
+        m_MeasureLatency(false),
+        m_Statistics(),
+        m_Deallocate(nullptr)
+        {
+            LogDebugLine("Constructed null buddy allocator at " << (void*)this);
+        }
+
+        //Two buddy allocators sharing a region would corrupt each other's free
+        //lists, so a buddy allocator can not be copied.
+        BuddyAllocator(const BuddyAllocator& p_other) = delete;
+        BuddyAllocator& operator=(const BuddyAllocator& p_other) = delete;
+
+    };
+
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Creates a buddy allocator at outp_buddy_allocator with a region
+     * of at least p_size bytes and blocks of at least p_minimum_block_size
+     * bytes.
+     *
+     * @details Both sizes are rounded up to a power of two, the minimum block
+     * size is also rounded up to @ref g_BUDDY_ALLOCATOR_MINIMUM_BLOCK_SIZE.
+     * The region and the block states are allocated with p_allocate as a
+     * single location aligned to @ref g_BUDDY_ALLOCATOR_REGION_ALIGNMENT, it
+     * is freed with p_deallocate.
+     *
+     * @warning Any buddy allocator already at outp_buddy_allocator is
+     * overwritten, not destroyed.
+     *
+     * If p_size is 0, the region would need more than
+     * @ref g_BUDDY_ALLOCATOR_MAX_ORDER_COUNT orders or its allocation fails
+     * a null buddy allocator is created at outp_buddy_allocator. In the case
+     * of allocation failure p_alloc_error is also called with
+     * p_alloc_error_data, if it is not null.
+     *
+     */
+    void CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+        BuddyAllocator& outp_buddy_allocator,
+        const Size& p_size,
+        const Size& p_minimum_block_size,
+        AlignedAllocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    inline void CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(
+        BuddyAllocator& outp_buddy_allocator,
+        const Size& p_size,
+        const Size& p_minimum_block_size
+    )
+    {
+        LogDebugLine("Using defaults for CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator");
+        CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+            outp_buddy_allocator, p_size, p_minimum_block_size,
+            g_DEFAULT_ALIGNED_ALLOCATOR, g_DEFAULT_ALIGNED_DEALLOCATOR,
+            g_DEFAULT_ALLOC_ERROR, g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Frees the region of p_buddy_allocator and makes it a null buddy
+     * allocator.
+     *
+     * @warning Every location allocated from p_buddy_allocator is invalid
+     * after this.
+     *
+     */
+    void DestroyBuddyAllocator(BuddyAllocator& p_buddy_allocator);
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Allocates a block of at least p_size bytes from
+     * p_buddy_allocator, behaves like malloc.
+     *
+     * @return The allocated location or null if there is no free block big
+     * enough. A p_size of 0 gives a block of the minimum size.
+     *
+     * @time O(k), k being the number of orders.
+     *
+     */
+    void* AllocateFromBuddyAllocator(BuddyAllocator& p_buddy_allocator, const Size& p_size);
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Changes the size of a block allocated from p_buddy_allocator,
+     * behaves like realloc.
+     *
+     * @details If the new size fits in the block nothing is done, if it fits
+     * in half of the block or less the unused halves are freed. If the block
+     * is the first half of its buddy and the buddies that it needs are free
+     * it grows in place by merging with them. In any other case a new block
+     * is allocated, the old bytes are copied over and the old block is freed.
+     *
+     * If p_pointer is null this is the same as
+     * @ref AllocateFromBuddyAllocator. If p_size is 0 p_pointer is
+     * deallocated and null is returned. On failure null is returned and
+     * p_pointer is not freed.
+     *
+     * @warning p_pointer must have been allocated from p_buddy_allocator.
+     *
+     * @time O(k) when done in place, k being the number of orders.
+     *
+     */
+    void* ReallocateInBuddyAllocator(
+        BuddyAllocator& p_buddy_allocator,
+        void* p_pointer,
+        const Size& p_size
+    );
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Frees p_pointer back to p_buddy_allocator, merging it with its
+     * buddies while they are free. Behaves like free.
+     *
+     * @warning p_pointer must have been allocated from p_buddy_allocator.
+     *
+     * @time O(k), k being the number of orders.
+     *
+     */
+    void DeallocateFromBuddyAllocator(BuddyAllocator& p_buddy_allocator, void* p_pointer);
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Finds the number of usable bytes in the block at p_pointer,
+     * which was allocated from p_buddy_allocator.
+     *
+     */
+    Size FindSizeOfBlockInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const void* p_pointer
+    );
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Finds the number of bytes of p_buddy_allocator that are not in
+     * an allocated block.
+     *
+     */
+    inline Size FindNumberOfFreeBytesInBuddyAllocator(const BuddyAllocator& p_buddy_allocator)
+    {
+        return p_buddy_allocator.m_RegionSize - p_buddy_allocator.m_Statistics.m_UsedBytes;
+    }
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Finds the size of the biggest free block of p_buddy_allocator,
+     * which is the biggest allocation that can currently succeed.
+     *
+     * @time O(k), k being the number of orders.
+     *
+     */
+    Size FindSizeOfLargestFreeBlockInBuddyAllocator(const BuddyAllocator& p_buddy_allocator);
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Finds the number of free blocks of order p_order in
+     * p_buddy_allocator.
+     *
+     * @time O(n), n being the number of free blocks of order p_order.
+     *
+     */
+    Size FindNumberOfFreeBlocksOfOrderInBuddyAllocator(
+        const BuddyAllocator& p_buddy_allocator,
+        const Size& p_order
+    );
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Finds the external fragmentation of p_buddy_allocator.
+     *
+     * @details This is 1 - largest free block / free bytes, 0 when all of the
+     * free bytes are in one block and close to 1 when they are spread over
+     * many small blocks. It is 0 if there are no free bytes.
+     *
+     */
+    double FindExternalFragmentationOfBuddyAllocator(const BuddyAllocator& p_buddy_allocator);
+
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Sets the buddy allocator used by @ref BuddyMalloc,
+     * @ref BuddyRealloc and @ref BuddyFree on the calling thread.
+     *
+     * @details Each thread has its own buddy allocator pointer, the default
+     * is null, which makes @ref BuddyMalloc always fail.
+     *
+     */
+    void SetBuddyAllocatorOfThisThread(BuddyAllocator* p_buddy_allocator);
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Returns the buddy allocator set by
+     * @ref SetBuddyAllocatorOfThisThread for the calling thread.
+     *
+     */
+    BuddyAllocator* GetBuddyAllocatorOfThisThread();
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief An @ref Allocator that allocates from the buddy allocator of the
+     * calling thread.
+     *
+     * @details This lets buddy allocators be used with everything in the
+     * library that takes an @ref Allocator, such as Array and Queue. Returns
+     * null if the calling thread does not have a buddy allocator.
+     *
+     */
+    void* BuddyMalloc(Size p_size);
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref Reallocator that reallocates in the buddy allocator of the
+     * calling thread, see @ref ReallocateInBuddyAllocator.
+     *
+     */
+    void* BuddyRealloc(void* p_pointer, Size p_size);
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref Deallocator that deallocates from the buddy allocator of
+     * the calling thread, see @ref DeallocateFromBuddyAllocator.
+     *
+     */
+    void BuddyFree(void* p_pointer);
+
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref MemoryAllocator that allocates outp_memory.m_Size bytes
+     * from the buddy allocator pointed to by p_state.
+     *
+     * @details Buddy allocator memory is always readable and writable, if the
+     * requested permissions include execution allocation fails. Alignments of
+     * up to @ref g_BUDDY_ALLOCATOR_REGION_ALIGNMENT are given by allocating a
+     * block at least that big, on success outp_memory.m_Alignment is set to
+     * the alignment of the block.
+     *
+     * On failure a null memory is written to outp_memory and p_alloc_error is
+     * called with p_alloc_error_data, if it is not null. If outp_memory.m_Size
+     * is 0 a null memory is written and nothing is called.
+     *
+     */
+    void AllocateMemoryFromBuddyAllocator(
+        Memory& outp_memory,
+        void*& p_state,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref MemoryRepermissionator for buddy allocator memory.
+     *
+     * @details Only permissions that are a subset of read and write are
+     * accepted, those are just written to p_memory. For anything else
+     * p_repermission_error is called and p_memory is not mutated.
+     *
+     */
+    void RepermissionateMemoryFromBuddyAllocator(
+        Memory& p_memory,
+        const Byte& p_new_permissions,
+        void*& p_state,
+        Callback p_repermission_error, void* p_repermission_error_data
+    );
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref MemoryReallocatorFront for buddy allocator memory, the
+     * bytes at the end of p_memory are kept.
+     *
+     * @details Blocks can only be found by their start, so the kept bytes are
+     * always moved, to the start of the block when shrinking and to the end
+     * of a new block when growing. On failure p_realloc_error is called and
+     * p_memory is not mutated.
+     *
+     */
+    void ReallocateFrontOfMemoryFromBuddyAllocator(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    );
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref MemoryReallocatorBack for buddy allocator memory, the
+     * bytes at the start of p_memory are kept, see
+     * @ref ReallocateInBuddyAllocator.
+     *
+     * @details Shrinking is done in place and gives back the part of the
+     * block p_memory no longer needs, p_memory.m_Alignment is kept. Growing
+     * keeps the block at least as big as p_memory.m_Alignment, so it is kept
+     * too. On failure p_realloc_error is called and p_memory is not mutated.
+     *
+     */
+    void ReallocateBackOfMemoryFromBuddyAllocator(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    );
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief A @ref MemoryDeallocator for buddy allocator memory, see
+     * @ref DeallocateFromBuddyAllocator. A null memory is written to
+     * p_memory.
+     *
+     */
+    void DeallocateMemoryFromBuddyAllocator(Memory& p_memory, void*& p_state);
+
+    /**
+     * @ingroup BuddyAllocatorMod
+     * @brief Returns a @ref MemoryManagement that uses p_buddy_allocator.
+     *
+     * @warning p_buddy_allocator must outlive the returned value.
+     *
+     */
+    inline MemoryManagement GetMemoryManagementOfBuddyAllocator(BuddyAllocator& p_buddy_allocator)
+    {
+        return MemoryManagement{
+            AllocateMemoryFromBuddyAllocator,
+            RepermissionateMemoryFromBuddyAllocator,
+            ReallocateFrontOfMemoryFromBuddyAllocator,
+            ReallocateBackOfMemoryFromBuddyAllocator,
+            DeallocateMemoryFromBuddyAllocator,
+            &p_buddy_allocator
+        };
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(
+        const Debugging::Log& p_log,
+        const BuddyAllocator& p_buddy_allocator
+    );
+    #endif //DEBUG
+
+}
+
+#endif //BUDDY_ALLOCATOR__MEMORY_MANAGEMENT_BUDDY_ALLOCATOR_BUDDY_ALLOCATOR_HPP
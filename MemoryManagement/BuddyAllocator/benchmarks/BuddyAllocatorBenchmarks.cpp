@@ -0,0 +1,167 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "../BuddyAllocator.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+
+//The number of buffers alive at once in the churn benchmark.
+static const Size g_LIVE_BUFFER_COUNT = 1024;
+static const Size g_CHURN_OPERATION_COUNT = 100000;
+
+//Grows an array by doubling, just like pushing back one item at a time does.
+static int GrowArrayUsingAllocatorAndReallocator(
+    Array<int>& p_array,
+    const Size& p_capacity,
+    Allocator p_allocate, Reallocator p_reallocate
+)
+{
+    CreateArrayAtOfCapacityUsingAllocator(p_array, 16, p_allocate, nullptr, nullptr);
+    p_array.m_Buffer[0] = 1;
+    while(p_array.m_Capacity < p_capacity)
+    {
+        IncreaseArrayCapacityByAmountUsingReallocator(p_array, p_array.m_Capacity, p_reallocate, nullptr, nullptr);
+        p_array.m_Buffer[p_array.m_Capacity - 1] = 1;
+    }
+    return p_array.m_Buffer[0] + p_array.m_Buffer[p_array.m_Capacity - 1];
+}
+
+//Resizes and frees buffers of power of two ish sizes in a random order, like
+//a long running service does. The same seed is used for every allocator.
+static Size ChurnUsingAllocatorAndReallocatorAndDeallocator(
+    void** p_buffers,
+    Allocator p_allocate, Reallocator p_reallocate, Deallocator p_deallocate
+)
+{
+
+    srand(17);
+    Size l_sum = 0;
+
+    for(Size n = 0; n < g_CHURN_OPERATION_COUNT; ++n)
+    {
+        Size i = rand() % g_LIVE_BUFFER_COUNT;
+        Size l_size = ((Size)16 << (rand() % 10)) + rand() % 64;
+        if(p_buffers[i] == nullptr)
+        {
+            p_buffers[i] = p_allocate(l_size);
+        }
+        else if(rand() % 4 != 0)
+        {
+            void* l_new = p_reallocate(p_buffers[i], l_size);
+            if(l_new != nullptr)
+            {
+                p_buffers[i] = l_new;
+            }
+        }
+        else
+        {
+            p_deallocate(p_buffers[i]);
+            p_buffers[i] = nullptr;
+        }
+        l_sum += (Size)p_buffers[i];
+    }
+
+    for(Size i = 0; i < g_LIVE_BUFFER_COUNT; ++i)
+    {
+        p_deallocate(p_buffers[i]);
+        p_buffers[i] = nullptr;
+    }
+
+    return l_sum;
+
+}
+
+TEST_CASE("Growing an array by doubling", "[BuddyAllocator][Benchmark]")
+{
+
+    Size l_capacity = GENERATE(1024, 64 * 1024, 1024 * 1024);
+
+    Array<int> l_array;
+
+    BENCHMARK("realloc to " + std::to_string(l_capacity) + " ints")
+    {
+        int l_result = GrowArrayUsingAllocatorAndReallocator(l_array, l_capacity, malloc, realloc);
+        DestroyArrayUsingDeallocator(l_array, free);
+        return l_result;
+    };
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 16 * 1024 * 1024, 64);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+    SetBuddyAllocatorOfThisThread(&l_buddyAllocator);
+
+    BENCHMARK("buddy allocator to " + std::to_string(l_capacity) + " ints")
+    {
+        int l_result = GrowArrayUsingAllocatorAndReallocator(l_array, l_capacity, BuddyMalloc, BuddyRealloc);
+        DestroyArrayUsingDeallocator(l_array, BuddyFree);
+        return l_result;
+    };
+
+    SetBuddyAllocatorOfThisThread(nullptr);
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
+
+TEST_CASE("Long running churn", "[BuddyAllocator][Benchmark]")
+{
+
+    void* l_buffers[g_LIVE_BUFFER_COUNT] = {};
+
+    BENCHMARK("malloc churn")
+    {
+        return ChurnUsingAllocatorAndReallocatorAndDeallocator(l_buffers, malloc, realloc, free);
+    };
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 64 * 1024 * 1024, 16);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+    SetBuddyAllocatorOfThisThread(&l_buddyAllocator);
+
+    BENCHMARK("buddy allocator churn")
+    {
+        return ChurnUsingAllocatorAndReallocatorAndDeallocator(l_buffers, BuddyMalloc, BuddyRealloc, BuddyFree);
+    };
+
+    //One more round with the latency measured, the worst case is printed
+    //along with how fragmented the region was at the end of it.
+    l_buddyAllocator.m_MeasureLatency = true;
+    l_buddyAllocator.m_Statistics = BuddyAllocatorStatistics();
+    srand(17);
+    for(Size n = 0; n < g_CHURN_OPERATION_COUNT; ++n)
+    {
+        Size i = rand() % g_LIVE_BUFFER_COUNT;
+        Size l_size = ((Size)16 << (rand() % 10)) + rand() % 64;
+        if(l_buffers[i] == nullptr)
+        {
+            l_buffers[i] = BuddyMalloc(l_size);
+        }
+        else
+        {
+            void* l_new = BuddyRealloc(l_buffers[i], l_size);
+            l_buffers[i] = l_new != nullptr ? l_new : l_buffers[i];
+        }
+    }
+
+    BuddyAllocatorStatistics& l_statistics = l_buddyAllocator.m_Statistics;
+    Size l_count = l_statistics.m_NumberOfAllocations + l_statistics.m_NumberOfInPlaceReallocations +
+        l_statistics.m_NumberOfMovingReallocations + l_statistics.m_NumberOfDeallocations;
+    printf(
+        "Buddy allocator: longest %zu ns, mean %zu ns, most splits %zu, most merges %zu, "
+        "external fragmentation %.3f, used %zu of %zu bytes for %zu requested\n",
+        l_statistics.m_LongestLatency,
+        l_count == 0 ? 0 : l_statistics.m_TotalLatency / l_count,
+        l_statistics.m_MostSplits, l_statistics.m_MostMerges,
+        FindExternalFragmentationOfBuddyAllocator(l_buddyAllocator),
+        l_statistics.m_UsedBytes, l_buddyAllocator.m_RegionSize, l_statistics.m_RequestedBytes
+    );
+
+    SetBuddyAllocatorOfThisThread(nullptr);
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
@@ -0,0 +1,118 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../BuddyAllocator.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+//An AlignedAllocator that always fails.
+static void* NullAlignedMalloc(Size p_alignment, Size p_size)
+{
+    (void)p_alignment;
+    (void)p_size;
+    return nullptr;
+}
+
+TEST_CASE("Default constructor", "[BuddyAllocator][Member]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+
+    CHECK(l_buddyAllocator.m_Region == nullptr);
+    CHECK(l_buddyAllocator.m_RegionSize == 0);
+    CHECK(l_buddyAllocator.m_MinimumBlockSize == 0);
+    CHECK(l_buddyAllocator.m_OrderCount == 0);
+    CHECK(l_buddyAllocator.m_BlockStates == nullptr);
+    CHECK(l_buddyAllocator.m_MeasureLatency == false);
+    CHECK(l_buddyAllocator.m_Deallocate == nullptr);
+    for(Size i = 0; i < g_BUDDY_ALLOCATOR_MAX_ORDER_COUNT; ++i)
+    {
+        CHECK(l_buddyAllocator.m_FreeBlocks[i] == nullptr);
+    }
+
+}
+
+TEST_CASE("Creation and destruction", "[BuddyAllocator][Creation][Destruction]")
+{
+
+    Size l_size = GENERATE(1, 100, 4096, 5000, 1024 * 1024);
+    Size l_minimumBlockSize = GENERATE(1, 16, 64, 100);
+
+    BuddyAllocator l_buddyAllocator;
+
+    SECTION("Defaults")
+    {
+        CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, l_size, l_minimumBlockSize);
+    }
+    SECTION("Customs")
+    {
+        bool l_called = false;
+        CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+            l_buddyAllocator, l_size, l_minimumBlockSize,
+            g_DEFAULT_ALIGNED_ALLOCATOR, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+    CHECK((uintptr_t)l_buddyAllocator.m_Region % g_BUDDY_ALLOCATOR_REGION_ALIGNMENT == 0);
+    CHECK(l_buddyAllocator.m_MinimumBlockSize >= g_BUDDY_ALLOCATOR_MINIMUM_BLOCK_SIZE);
+    CHECK(l_buddyAllocator.m_MinimumBlockSize >= l_minimumBlockSize);
+    CHECK(l_buddyAllocator.m_RegionSize >= l_size);
+    CHECK(l_buddyAllocator.m_RegionSize == l_buddyAllocator.m_MinimumBlockSize << (l_buddyAllocator.m_OrderCount - 1));
+    CHECK(FindNumberOfFreeBytesInBuddyAllocator(l_buddyAllocator) == l_buddyAllocator.m_RegionSize);
+    CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == l_buddyAllocator.m_RegionSize);
+    CHECK(FindNumberOfFreeBlocksOfOrderInBuddyAllocator(l_buddyAllocator, l_buddyAllocator.m_OrderCount - 1) == 1);
+    CHECK(FindExternalFragmentationOfBuddyAllocator(l_buddyAllocator) == 0);
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+    CHECK(l_buddyAllocator.m_Region == nullptr);
+    CHECK(l_buddyAllocator.m_RegionSize == 0);
+    CHECK(l_buddyAllocator.m_Deallocate == nullptr);
+
+}
+
+TEST_CASE("Failed creation", "[BuddyAllocator][Creation]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    bool l_called = false;
+
+    SECTION("Allocation failure")
+    {
+        CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+            l_buddyAllocator, 4096, 16,
+            NullAlignedMalloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == true);
+    }
+    SECTION("Zero size")
+    {
+        CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+            l_buddyAllocator, 0, 16,
+            g_DEFAULT_ALIGNED_ALLOCATOR, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+    SECTION("Too many orders")
+    {
+        CreateBuddyAllocatorAtOfSizeAndMinimumBlockSizeUsingAllocatorAndDeallocator(
+            l_buddyAllocator, (Size)1 << 62, 16,
+            g_DEFAULT_ALIGNED_ALLOCATOR, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    CHECK(l_buddyAllocator.m_Region == nullptr);
+    CHECK(l_buddyAllocator.m_OrderCount == 0);
+    CHECK(AllocateFromBuddyAllocator(l_buddyAllocator, 1) == nullptr);
+
+}
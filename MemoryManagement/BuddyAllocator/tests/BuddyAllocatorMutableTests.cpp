@@ -0,0 +1,467 @@
+#include <catch2/catch.hpp>
+
+#include "../BuddyAllocator.hpp"
+#include "../../../Debugging/Debugging.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+
+#include <string.h>
+
+using namespace Library;
+using namespace Debugging;
+using namespace Library::DataStructures::Array;
+using namespace Catch::Generators;
+
+TEST_CASE("Allocation and coalescing", "[BuddyAllocator][Mutable][Allocation]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    //16 blocks of 64 bytes, so 5 orders.
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 1024, 64);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+    REQUIRE(l_buddyAllocator.m_OrderCount == 5);
+
+    SECTION("Sizes are rounded up to a power of two number of blocks")
+    {
+        Size l_size = GENERATE(0, 1, 64, 65, 128, 129, 500, 1024);
+        void* l_location = AllocateFromBuddyAllocator(l_buddyAllocator, l_size);
+        REQUIRE(l_location != nullptr);
+
+        Size l_expected = 64;
+        while(l_expected < l_size)
+        {
+            l_expected *= 2;
+        }
+        CHECK(FindSizeOfBlockInBuddyAllocator(l_buddyAllocator, l_location) == l_expected);
+        CHECK((uintptr_t)l_location % l_expected == 0);
+        CHECK(FindNumberOfFreeBytesInBuddyAllocator(l_buddyAllocator) == 1024 - l_expected);
+        memset(l_location, 0xff, l_expected);
+
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_location);
+    }
+    SECTION("Splitting and merging")
+    {
+        void* l_first = AllocateFromBuddyAllocator(l_buddyAllocator, 64);
+        REQUIRE(l_first == l_buddyAllocator.m_Region);
+        CHECK(l_buddyAllocator.m_Statistics.m_MostSplits == 4);
+        for(Size l_order = 0; l_order < 4; ++l_order)
+        {
+            CHECK(FindNumberOfFreeBlocksOfOrderInBuddyAllocator(l_buddyAllocator, l_order) == 1);
+        }
+
+        void* l_second = AllocateFromBuddyAllocator(l_buddyAllocator, 64);
+        CHECK(l_second == l_buddyAllocator.m_Region + 64);
+        void* l_third = AllocateFromBuddyAllocator(l_buddyAllocator, 256);
+        CHECK(l_third == l_buddyAllocator.m_Region + 256);
+
+        CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == 512);
+        //128 + 512 bytes free, the largest is 512.
+        CHECK(FindExternalFragmentationOfBuddyAllocator(l_buddyAllocator) == Approx(1 - 512.0 / 640.0));
+
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_first);
+        CHECK(FindNumberOfFreeBlocksOfOrderInBuddyAllocator(l_buddyAllocator, 0) == 1);
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_third);
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_second);
+
+        CHECK(l_buddyAllocator.m_Statistics.m_MostMerges == 4);
+        CHECK(FindNumberOfFreeBlocksOfOrderInBuddyAllocator(l_buddyAllocator, 4) == 1);
+        CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == 1024);
+    }
+    SECTION("Running out")
+    {
+        void* l_locations[16];
+        for(Size i = 0; i < 16; ++i)
+        {
+            l_locations[i] = AllocateFromBuddyAllocator(l_buddyAllocator, 1);
+            REQUIRE(l_locations[i] != nullptr);
+        }
+        CHECK(AllocateFromBuddyAllocator(l_buddyAllocator, 1) == nullptr);
+        CHECK(AllocateFromBuddyAllocator(l_buddyAllocator, 2048) == nullptr);
+        CHECK(l_buddyAllocator.m_Statistics.m_NumberOfFailedAllocations == 2);
+        CHECK(FindNumberOfFreeBytesInBuddyAllocator(l_buddyAllocator) == 0);
+        CHECK(FindExternalFragmentationOfBuddyAllocator(l_buddyAllocator) == 0);
+
+        //Freeing every other block leaves half of the bytes free but nothing
+        //bigger than a single block.
+        for(Size i = 0; i < 16; i += 2)
+        {
+            DeallocateFromBuddyAllocator(l_buddyAllocator, l_locations[i]);
+        }
+        CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == 64);
+        CHECK(FindExternalFragmentationOfBuddyAllocator(l_buddyAllocator) == Approx(1 - 64.0 / 512.0));
+
+        for(Size i = 1; i < 16; i += 2)
+        {
+            DeallocateFromBuddyAllocator(l_buddyAllocator, l_locations[i]);
+        }
+        CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == 1024);
+    }
+
+    CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 0);
+    CHECK(l_buddyAllocator.m_Statistics.m_RequestedBytes == 0);
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
+
+TEST_CASE("Reallocation", "[BuddyAllocator][Mutable][Reallocation]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 1024, 64);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+
+    Byte* l_first = (Byte*)AllocateFromBuddyAllocator(l_buddyAllocator, 64);
+    REQUIRE(l_first != nullptr);
+    for(Size i = 0; i < 64; ++i)
+    {
+        l_first[i] = (Byte)i;
+    }
+
+    SECTION("Growing in place while the buddies are free")
+    {
+        CHECK(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 100) == l_first);
+        CHECK(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 1000) == l_first);
+        CHECK(FindSizeOfBlockInBuddyAllocator(l_buddyAllocator, l_first) == 1024);
+        CHECK(l_buddyAllocator.m_Statistics.m_NumberOfInPlaceReallocations == 2);
+        CHECK(l_buddyAllocator.m_Statistics.m_NumberOfMovingReallocations == 0);
+        CHECK(FindNumberOfFreeBytesInBuddyAllocator(l_buddyAllocator) == 0);
+    }
+    SECTION("Shrinking in place gives back the unused halves")
+    {
+        REQUIRE(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 1024) == l_first);
+        CHECK(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 1000) == l_first);
+        CHECK(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 10) == l_first);
+        CHECK(FindSizeOfBlockInBuddyAllocator(l_buddyAllocator, l_first) == 64);
+        CHECK(FindNumberOfFreeBytesInBuddyAllocator(l_buddyAllocator) == 960);
+        CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == 512);
+    }
+    SECTION("Moving when the buddy is taken")
+    {
+        Byte* l_second = (Byte*)AllocateFromBuddyAllocator(l_buddyAllocator, 64);
+        REQUIRE(l_second == l_first + 64);
+
+        Byte* l_new = (Byte*)ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 128);
+        REQUIRE(l_new != nullptr);
+        CHECK(l_new != l_first);
+        CHECK(l_buddyAllocator.m_Statistics.m_NumberOfMovingReallocations == 1);
+        l_first = l_new;
+
+        //The second half of a pair can not grow in place.
+        Byte* l_newSecond = (Byte*)ReallocateInBuddyAllocator(l_buddyAllocator, l_second, 128);
+        REQUIRE(l_newSecond != nullptr);
+        CHECK(l_newSecond != l_second);
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_newSecond);
+    }
+    SECTION("Failure keeps the block")
+    {
+        //Takes the buddy of l_first and the only block of 512 bytes.
+        Byte* l_second = (Byte*)AllocateFromBuddyAllocator(l_buddyAllocator, 64);
+        Byte* l_third = (Byte*)AllocateFromBuddyAllocator(l_buddyAllocator, 512);
+        REQUIRE(l_second != nullptr);
+        REQUIRE(l_third != nullptr);
+        CHECK(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 512) == nullptr);
+        CHECK(FindSizeOfBlockInBuddyAllocator(l_buddyAllocator, l_first) == 64);
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_second);
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_third);
+    }
+
+    for(Size i = 0; i < 64; ++i)
+    {
+        REQUIRE(l_first[i] == (Byte)i);
+    }
+
+    CHECK(ReallocateInBuddyAllocator(l_buddyAllocator, l_first, 0) == nullptr);
+    CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 0);
+    CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == 1024);
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
+
+TEST_CASE("Random use keeps the region consistent", "[BuddyAllocator][Mutable]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 64 * 1024, 16);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+
+    Byte* l_locations[64] = {};
+    Size l_sizes[64] = {};
+
+    srand(5);
+    for(Size n = 0; n < 5000; ++n)
+    {
+        Size i = rand() % 64;
+        if(l_locations[i] == nullptr)
+        {
+            l_sizes[i] = 1 + rand() % 2000;
+            l_locations[i] = (Byte*)AllocateFromBuddyAllocator(l_buddyAllocator, l_sizes[i]);
+            if(l_locations[i] != nullptr)
+            {
+                memset(l_locations[i], (int)i, l_sizes[i]);
+            }
+        }
+        else if(rand() % 2 == 0)
+        {
+            Size l_size = 1 + rand() % 4000;
+            Byte* l_new = (Byte*)ReallocateInBuddyAllocator(l_buddyAllocator, l_locations[i], l_size);
+            if(l_new != nullptr)
+            {
+                l_locations[i] = l_new;
+                if(l_size > l_sizes[i])
+                {
+                    memset(l_new + l_sizes[i], (int)i, l_size - l_sizes[i]);
+                }
+                l_sizes[i] = l_size;
+            }
+        }
+        else
+        {
+            DeallocateFromBuddyAllocator(l_buddyAllocator, l_locations[i]);
+            l_locations[i] = nullptr;
+        }
+
+        //Every live block still holds its own bytes, so none overlap.
+        if(n % 100 == 0)
+        {
+            for(Size k = 0; k < 64; ++k)
+            {
+                Size l_same = 0;
+                while(l_locations[k] != nullptr && l_same < l_sizes[k] && l_locations[k][l_same] == (Byte)k)
+                {
+                    ++l_same;
+                }
+                REQUIRE((l_locations[k] == nullptr || l_same == l_sizes[k]));
+            }
+        }
+    }
+
+    for(Size i = 0; i < 64; ++i)
+    {
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_locations[i]);
+    }
+    CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 0);
+    CHECK(l_buddyAllocator.m_Statistics.m_RequestedBytes == 0);
+    CHECK(FindSizeOfLargestFreeBlockInBuddyAllocator(l_buddyAllocator) == l_buddyAllocator.m_RegionSize);
+    CHECK(l_buddyAllocator.m_Statistics.m_MostSplits < l_buddyAllocator.m_OrderCount);
+    CHECK(l_buddyAllocator.m_Statistics.m_MostMerges < l_buddyAllocator.m_OrderCount);
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
+
+TEST_CASE("Latency measurement", "[BuddyAllocator][Mutable]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 4096, 16);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+
+    void* l_location = AllocateFromBuddyAllocator(l_buddyAllocator, 16);
+    DeallocateFromBuddyAllocator(l_buddyAllocator, l_location);
+    CHECK(l_buddyAllocator.m_Statistics.m_TotalLatency == 0);
+
+    l_buddyAllocator.m_MeasureLatency = true;
+    for(Size i = 0; i < 10; ++i)
+    {
+        l_location = AllocateFromBuddyAllocator(l_buddyAllocator, 16);
+        l_location = ReallocateInBuddyAllocator(l_buddyAllocator, l_location, 100);
+        DeallocateFromBuddyAllocator(l_buddyAllocator, l_location);
+    }
+
+    Size l_count = 0;
+    for(Size i = 0; i < g_BUDDY_ALLOCATOR_LATENCY_HISTOGRAM_SIZE; ++i)
+    {
+        l_count += l_buddyAllocator.m_Statistics.m_LatencyHistogram[i];
+    }
+    CHECK(l_count == 30);
+    CHECK(l_buddyAllocator.m_Statistics.m_LongestLatency <= l_buddyAllocator.m_Statistics.m_TotalLatency);
+    CHECK(l_buddyAllocator.m_Statistics.m_NumberOfAllocations == 11);
+    CHECK(l_buddyAllocator.m_Statistics.m_NumberOfDeallocations == 11);
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
+
+TEST_CASE("Adapters", "[BuddyAllocator][Mutable][Adapters]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 64 * 1024, 16);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+
+    SECTION("No buddy allocator")
+    {
+        SetBuddyAllocatorOfThisThread(nullptr);
+        CHECK(GetBuddyAllocatorOfThisThread() == nullptr);
+        CHECK(BuddyMalloc(10) == nullptr);
+        CHECK(BuddyRealloc(nullptr, 10) == nullptr);
+        BuddyFree(nullptr);
+    }
+    SECTION("With buddy allocator")
+    {
+        SetBuddyAllocatorOfThisThread(&l_buddyAllocator);
+        CHECK(GetBuddyAllocatorOfThisThread() == &l_buddyAllocator);
+
+        //An array that keeps doubling grows in place every time.
+        Array<int> l_array;
+        CreateArrayAtOfCapacityUsingAllocator(l_array, 4, BuddyMalloc, nullptr, nullptr);
+        REQUIRE(l_array.m_Buffer != nullptr);
+        for(int i = 0; i < 4; ++i)
+        {
+            l_array.m_Buffer[i] = i;
+        }
+        int* l_buffer = l_array.m_Buffer;
+        for(Size l_capacity = 8; l_capacity <= 4096; l_capacity *= 2)
+        {
+            ResizeArrayToCapacityUsingReallocator(l_array, l_capacity, BuddyRealloc, nullptr, nullptr);
+            REQUIRE(l_array.m_Buffer == l_buffer);
+        }
+        for(int i = 0; i < 4; ++i)
+        {
+            CHECK(l_array.m_Buffer[i] == i);
+        }
+        CHECK(l_buddyAllocator.m_Statistics.m_NumberOfMovingReallocations == 0);
+
+        DestroyArrayUsingDeallocator(l_array, BuddyFree);
+        CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 0);
+
+        SetBuddyAllocatorOfThisThread(nullptr);
+    }
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
+
+TEST_CASE("Memory management interface", "[BuddyAllocator][Mutable][MemoryManagement]")
+{
+
+    BuddyAllocator l_buddyAllocator;
+    CreateBuddyAllocatorAtOfSizeAndMinimumBlockSize(l_buddyAllocator, 64 * 1024, 16);
+    REQUIRE(l_buddyAllocator.m_Region != nullptr);
+
+    MemoryManagement l_management = GetMemoryManagementOfBuddyAllocator(l_buddyAllocator);
+    CHECK(l_management.m_State == &l_buddyAllocator);
+
+    Memory l_memory(nullptr, 40, 0b011);
+    bool l_called = false;
+
+    l_management.m_Allocate(l_memory, l_management.m_State, &GeneralErrorCallback, &l_called);
+    CHECK(l_called == false);
+    REQUIRE(l_memory.m_Location != nullptr);
+    CHECK(l_memory.m_Size == 40);
+    CHECK(l_memory.m_Alignment == 64);
+    CHECK(MemoryIsAlignedTo(l_memory, 64));
+    CHECK(MemoryIsReadable(l_memory));
+    CHECK(MemoryIsWritable(l_memory));
+    CHECK(l_buddyAllocator.m_Statistics.m_RequestedBytes == 40);
+    CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 64);
+
+    for(Size i = 0; i < 40; ++i)
+    {
+        l_memory.m_Location[i] = (Byte)i;
+    }
+
+    SECTION("Executable allocation fails")
+    {
+        Memory l_executable(nullptr, 32, 0b111);
+        l_management.m_Allocate(l_executable, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_executable.m_Location == nullptr);
+    }
+    SECTION("Aligned allocation")
+    {
+        Memory l_aligned(nullptr, 32, 0b011, 1024);
+        l_management.m_Allocate(l_aligned, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        REQUIRE(l_aligned.m_Location != nullptr);
+        CHECK(l_aligned.m_Alignment == 1024);
+        CHECK(MemoryIsAlignedTo(l_aligned, 1024));
+        l_management.m_Deallocate(l_aligned, l_management.m_State);
+    }
+    SECTION("Overaligned allocation fails")
+    {
+        Memory l_overaligned(nullptr, 32, 0b011, 2 * g_BUDDY_ALLOCATOR_REGION_ALIGNMENT);
+        l_management.m_Allocate(l_overaligned, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_overaligned.m_Location == nullptr);
+    }
+    SECTION("Repermissionating")
+    {
+        l_management.m_Repermissionate(l_memory, 0b001, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Permissions == 0b001);
+
+        l_management.m_Repermissionate(l_memory, 0b100, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_memory.m_Permissions == 0b001);
+    }
+    SECTION("Back reallocation")
+    {
+        Byte* l_oldLocation = l_memory.m_Location;
+        l_management.m_ReallocateBack(l_memory, 200, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Location == l_oldLocation);
+        REQUIRE(l_memory.m_Size == 200);
+        CHECK(l_memory.m_Alignment == 256);
+        for(Size i = 0; i < 40; ++i)
+        {
+            CHECK(l_memory.m_Location[i] == (Byte)i);
+        }
+        CHECK(l_buddyAllocator.m_Statistics.m_RequestedBytes == 200);
+    }
+    SECTION("Back shrinking")
+    {
+        Memory l_big(nullptr, 2048, 0b011);
+        l_management.m_Allocate(l_big, l_management.m_State, &GeneralErrorCallback, &l_called);
+        REQUIRE(l_big.m_Location != nullptr);
+        CHECK(l_big.m_Alignment == 2048);
+        CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 64 + 2048);
+
+        Byte* l_oldLocation = l_big.m_Location;
+        l_management.m_ReallocateBack(l_big, 20, l_management.m_State, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_big.m_Location == l_oldLocation);
+        CHECK(l_big.m_Size == 20);
+        //The location did not move, so it is as aligned as it was.
+        CHECK(l_big.m_Alignment == 2048);
+        CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 64 + 32);
+        CHECK(l_buddyAllocator.m_Statistics.m_RequestedBytes == 40 + 20);
+
+        l_management.m_Deallocate(l_big, l_management.m_State);
+    }
+    SECTION("Front reallocation")
+    {
+        SECTION("Growing")
+        {
+            l_management.m_ReallocateFront(l_memory, 100, l_management.m_State, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            REQUIRE(l_memory.m_Size == 100);
+            for(Size i = 0; i < 40; ++i)
+            {
+                CHECK(l_memory.m_Location[60 + i] == (Byte)i);
+            }
+        }
+        SECTION("Shrinking")
+        {
+            Byte* l_oldLocation = l_memory.m_Location;
+            l_management.m_ReallocateFront(l_memory, 8, l_management.m_State, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Location == l_oldLocation);
+            REQUIRE(l_memory.m_Size == 8);
+            for(Size i = 0; i < 8; ++i)
+            {
+                CHECK(l_memory.m_Location[i] == (Byte)(32 + i));
+            }
+        }
+    }
+
+    l_management.m_Deallocate(l_memory, l_management.m_State);
+    CHECK(l_memory.m_Location == nullptr);
+    CHECK(l_memory.m_Size == 0);
+    CHECK(l_buddyAllocator.m_Statistics.m_RequestedBytes == 0);
+    CHECK(l_buddyAllocator.m_Statistics.m_UsedBytes == 0);
+
+    DestroyBuddyAllocator(l_buddyAllocator);
+
+}
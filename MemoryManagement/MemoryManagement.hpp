@@ -1,3 +1,6 @@
+#ifndef MEMORY_MANAGEMENT__MEMORY_MANAGEMENT_MEMORY_MANAGEMENT_HPP
+#define MEMORY_MANAGEMENT__MEMORY_MANAGEMENT_MEMORY_MANAGEMENT_HPP
+
 #include "../Memory/Memory.hpp"
 
 namespace Library
@@ -5,8 +8,10 @@ namespace Library
 
     //TODO: Should memory management functions have special naming rules?
 
-    //m_Location is ignored, m_Size and m_Permissions are used. All of them
-    //may be mutated.
+    //m_Location is ignored, m_Size, m_Permissions and m_Alignment are used.
+    //All of them may be mutated. An m_Alignment the allocator cannot give is
+    //an allocation failure, on success it is set to the alignment given,
+    //which reallocators keep unless it says otherwise.
     using MemoryAllocator = void (*)(
         Memory& outp_memory,
         void*& p_state,
@@ -72,3 +77,5 @@ namespace Library
     };    
 
 }
+
+#endif //MEMORY_MANAGEMENT__MEMORY_MANAGEMENT_MEMORY_MANAGEMENT_HPP
@@ -0,0 +1,627 @@
+/**
+ * @file PageAllocator.cpp
+ * @brief Defines everything in the @ref PageAllocatorMod module.
+ *
+ * @details This implementation uses POSIX mmap, mprotect and munmap. The huge
+ * page and discard hints use the Linux madvise flags when they are available
+ * and are skipped otherwise. Growing uses the Linux mremap to move pages
+ * instead of copying them, where it is not available the bytes are copied.
+ *
+ */
+#include "PageAllocator.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+//Included for memcpy
+#include <string.h>
+
+namespace Library
+{
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const PageAllocator& p_allocator)
+    {
+
+        p_log << (void*)&p_allocator;
+        p_log << " { m_HugePageThreshold = " << p_allocator.m_HugePageThreshold;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+
+    //Converts the permission bits of Memory to mmap protection flags.
+    static int ConvertPermissionsToProtection(const Byte& p_permissions)
+    {
+
+        int l_protection = PROT_NONE;
+        if(p_permissions & 0b001)
+        {
+            l_protection |= PROT_READ;
+        }
+        if(p_permissions & 0b010)
+        {
+            l_protection |= PROT_WRITE;
+        }
+        if(p_permissions & 0b100)
+        {
+            l_protection |= PROT_EXEC;
+        }
+
+        return l_protection;
+
+    }
+
+    static Size GetHugePageThresholdOfState(void* const& p_state)
+    {
+        if(p_state == nullptr)
+        {
+            return g_PAGE_ALLOCATOR_DEFAULT_HUGE_PAGE_THRESHOLD;
+        }
+        return ((PageAllocator*)p_state)->m_HugePageThreshold;
+    }
+
+    //Maps p_size bytes, p_size must be a whole number of pages. Returns null
+    //on failure.
+    static Byte* MapPagesOfSizeWithProtection(
+        const Size& p_size,
+        const int& p_protection,
+        const Size& p_huge_page_threshold
+    )
+    {
+
+        bool l_useHugePages = p_huge_page_threshold != 0 && p_size >= p_huge_page_threshold;
+
+        if(l_useHugePages == false)
+        {
+            void* l_location = mmap(
+                nullptr, p_size, p_protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+            );
+            if(l_location == MAP_FAILED)
+            {
+                LogDebugLine("mmap of " << p_size << " bytes failed.");
+                return nullptr;
+            }
+            return (Byte*)l_location;
+        }
+
+        //Map an extra huge page and cut off whatever is outside of the aligned
+        //range.
+        if(p_size > SIZE_MAX - g_HUGE_PAGE_SIZE)
+        {
+            return nullptr;
+        }
+        Size l_mappedSize = p_size + g_HUGE_PAGE_SIZE;
+        void* l_mapping = mmap(
+            nullptr, l_mappedSize, p_protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+        );
+        if(l_mapping == MAP_FAILED)
+        {
+            LogDebugLine("mmap of " << l_mappedSize << " bytes failed.");
+            return nullptr;
+        }
+
+        Byte* l_start = (Byte*)l_mapping;
+        Byte* l_location = (Byte*)(
+            ((uintptr_t)l_start + (g_HUGE_PAGE_SIZE - 1)) & ~(uintptr_t)(g_HUGE_PAGE_SIZE - 1)
+        );
+        Byte* l_end = l_start + l_mappedSize;
+
+        if(l_location != l_start)
+        {
+            munmap(l_start, l_location - l_start);
+        }
+        if(l_location + p_size != l_end)
+        {
+            munmap(l_location + p_size, l_end - (l_location + p_size));
+        }
+
+        #ifdef MADV_HUGEPAGE
+        //Only a hint, nothing to do if it is not supported.
+        madvise(l_location, p_size, MADV_HUGEPAGE);
+        #endif //MADV_HUGEPAGE
+
+        LogDebugLine("Mapped " << p_size << " bytes at " << (void*)l_location
+        << " with huge pages.");
+
+        return l_location;
+
+    }
+
+    //Maps p_new_size bytes with the protection of p_memory and copies
+    //p_memory's bytes into them at p_offset. p_memory is unmapped on success.
+    //Returns null on failure, p_memory is not mutated in that case.
+    static Byte* MoveMemoryToNewPagesOfSizeAtOffset(
+        Memory& p_memory,
+        const Size& p_new_size,
+        const Size& p_offset,
+        const Size& p_huge_page_threshold
+    )
+    {
+
+        int l_protection = ConvertPermissionsToProtection(p_memory.m_Permissions);
+
+        //Writable until the copy is done.
+        Byte* l_newLocation = MapPagesOfSizeWithProtection(
+            p_new_size, PROT_READ | PROT_WRITE, p_huge_page_threshold
+        );
+        if(l_newLocation == nullptr)
+        {
+            return nullptr;
+        }
+
+        if(p_memory.m_Location != nullptr)
+        {
+            if(MemoryIsReadable(p_memory) == false)
+            {
+                if(mprotect(p_memory.m_Location, p_memory.m_Size, l_protection | PROT_READ) != 0)
+                {
+                    LogDebugLine("Could not make the old pages readable.");
+                    munmap(l_newLocation, p_new_size);
+                    return nullptr;
+                }
+            }
+
+            memcpy(l_newLocation + p_offset, p_memory.m_Location, p_memory.m_Size);
+            munmap(p_memory.m_Location, p_memory.m_Size);
+        }
+
+        if(l_protection != (PROT_READ | PROT_WRITE))
+        {
+            //Can only fail for execute permissions, which were allowed for
+            //the old pages.
+            mprotect(l_newLocation, p_new_size, l_protection);
+        }
+
+        return l_newLocation;
+
+    }
+
+    //Grows p_memory to p_new_size bytes, which must be a whole number of
+    //pages bigger than its size. The old bytes end up at the end of the new
+    //memory if p_keep_end is true and at its start otherwise. Where mremap is
+    //available the old pages are moved instead of copied, which only touches
+    //their page table entries. Returns null on failure, p_memory is not
+    //mutated in that case.
+    static Byte* GrowMemoryToSize(
+        Memory& p_memory,
+        const Size& p_new_size,
+        const bool& p_keep_end,
+        const Size& p_huge_page_threshold
+    )
+    {
+
+        Size l_offset = p_keep_end ? p_new_size - p_memory.m_Size : 0;
+
+        #ifdef MREMAP_MAYMOVE
+        if(p_memory.m_Location != nullptr)
+        {
+            if(p_keep_end == false)
+            {
+                //The kernel grows the mapping in place if the pages after it
+                //are free and moves it somewhere else otherwise.
+                void* l_newLocation = mremap(
+                    p_memory.m_Location, p_memory.m_Size, p_new_size, MREMAP_MAYMOVE
+                );
+                if(l_newLocation != MAP_FAILED)
+                {
+                    LogDebugLine("Remapped the back to " << l_newLocation);
+                    return (Byte*)l_newLocation;
+                }
+                LogDebugLine("mremap failed, copying.");
+            }
+            else
+            {
+                //A mapping can only be extended at its end, so map the new
+                //front and move the old pages right after it.
+                Byte* l_newLocation = MapPagesOfSizeWithProtection(
+                    p_new_size,
+                    ConvertPermissionsToProtection(p_memory.m_Permissions),
+                    p_huge_page_threshold
+                );
+                if(l_newLocation == nullptr)
+                {
+                    return nullptr;
+                }
+                if(
+                    mremap(
+                        p_memory.m_Location, p_memory.m_Size, p_memory.m_Size,
+                        MREMAP_MAYMOVE | MREMAP_FIXED, l_newLocation + l_offset
+                    ) != MAP_FAILED
+                )
+                {
+                    LogDebugLine("Remapped the front to " << (void*)l_newLocation);
+                    return l_newLocation;
+                }
+                LogDebugLine("mremap failed, copying.");
+                munmap(l_newLocation, p_new_size);
+            }
+        }
+        #endif //MREMAP_MAYMOVE
+
+        return MoveMemoryToNewPagesOfSizeAtOffset(
+            p_memory, p_new_size, l_offset, p_huge_page_threshold
+        );
+
+    }
+
+
+    Size GetPageSize()
+    {
+        static const Size s_pageSize = (Size)sysconf(_SC_PAGESIZE);
+        return s_pageSize;
+    }
+
+    Size RoundSizeUpToPages(const Size& p_size)
+    {
+
+        Size l_pageSize = GetPageSize();
+        if(p_size > SIZE_MAX - (l_pageSize - 1))
+        {
+            return 0;
+        }
+
+        return (p_size + (l_pageSize - 1)) & ~(l_pageSize - 1);
+
+    }
+
+
+    void AllocateMemoryFromPages(
+        Memory& outp_memory,
+        void*& p_state,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Allocating memory of size " << outp_memory.m_Size
+        << " from pages.");
+
+        if(outp_memory.m_Size == 0)
+        {
+            LogDebugLine("The size is 0, writing null memory.");
+            outp_memory = Memory();
+            return;
+        }
+
+        Size l_size = RoundSizeUpToPages(outp_memory.m_Size);
+        Byte* l_location = nullptr;
+        //Only page alignment is kept by mremap, so nothing more is given.
+        if(l_size != 0 && outp_memory.m_Alignment <= GetPageSize())
+        {
+            l_location = MapPagesOfSizeWithProtection(
+                l_size,
+                ConvertPermissionsToProtection(outp_memory.m_Permissions),
+                GetHugePageThresholdOfState(p_state)
+            );
+        }
+
+        if(l_location == nullptr)
+        {
+            LogDebugLine("Allocation failed, writing null memory.");
+            outp_memory = Memory();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        outp_memory.m_Location = l_location;
+        outp_memory.m_Size = l_size;
+        outp_memory.m_Alignment = GetPageSize();
+
+    }
+
+    void RepermissionateMemoryFromPages(
+        Memory& p_memory,
+        const Byte& p_new_permissions,
+        void*& p_state,
+        Callback p_repermission_error, void* p_repermission_error_data
+    )
+    {
+
+        LogDebugLine("Repermissionating page memory at "
+        << (void*)p_memory.m_Location << " to " << (unsigned)p_new_permissions);
+
+        (void)p_state;
+
+        if(
+            p_memory.m_Location != nullptr &&
+            mprotect(
+                p_memory.m_Location, p_memory.m_Size,
+                ConvertPermissionsToProtection(p_new_permissions)
+            ) != 0
+        )
+        {
+            LogDebugLine("mprotect failed.");
+            if(p_repermission_error != nullptr)
+            {
+                LogDebugLine("Repermission error is not null so calling it.");
+                p_repermission_error(p_repermission_error_data);
+            }
+            return;
+        }
+
+        p_memory.m_Permissions = p_new_permissions;
+
+    }
+
+    void ReallocateFrontOfMemoryFromPages(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reallocating the front of page memory at "
+        << (void*)p_memory.m_Location << " to " << p_new_size << " bytes");
+
+        if(p_new_size == 0)
+        {
+            DeallocateMemoryFromPages(p_memory, p_state);
+            return;
+        }
+
+        Size l_newSize = RoundSizeUpToPages(p_new_size);
+
+        if(l_newSize != 0 && l_newSize <= p_memory.m_Size)
+        {
+            LogDebugLine("Unmapping pages from the front.");
+            Size l_removed = p_memory.m_Size - l_newSize;
+            if(l_removed != 0)
+            {
+                munmap(p_memory.m_Location, l_removed);
+            }
+            p_memory.m_Location += l_removed;
+            p_memory.m_Size = l_newSize;
+            return;
+        }
+
+        Byte* l_newLocation = nullptr;
+        if(l_newSize != 0)
+        {
+            l_newLocation = GrowMemoryToSize(
+                p_memory, l_newSize, true,
+                GetHugePageThresholdOfState(p_state)
+            );
+        }
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Reallocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        p_memory.m_Location = l_newLocation;
+        p_memory.m_Size = l_newSize;
+
+    }
+
+    void ReallocateBackOfMemoryFromPages(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    )
+    {
+
+        LogDebugLine("Reallocating the back of page memory at "
+        << (void*)p_memory.m_Location << " to " << p_new_size << " bytes");
+
+        if(p_new_size == 0)
+        {
+            DeallocateMemoryFromPages(p_memory, p_state);
+            return;
+        }
+
+        Size l_newSize = RoundSizeUpToPages(p_new_size);
+
+        if(l_newSize != 0 && l_newSize <= p_memory.m_Size)
+        {
+            LogDebugLine("Unmapping pages from the back.");
+            if(l_newSize != p_memory.m_Size)
+            {
+                munmap(p_memory.m_Location + l_newSize, p_memory.m_Size - l_newSize);
+            }
+            p_memory.m_Size = l_newSize;
+            return;
+        }
+
+        Byte* l_newLocation = nullptr;
+        if(l_newSize != 0)
+        {
+            l_newLocation = GrowMemoryToSize(
+                p_memory, l_newSize, false,
+                GetHugePageThresholdOfState(p_state)
+            );
+        }
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Reallocation failed.");
+            if(p_realloc_error != nullptr)
+            {
+                LogDebugLine("Realloc error is not null so calling it.");
+                p_realloc_error(p_realloc_error_data);
+            }
+            return;
+        }
+
+        p_memory.m_Location = l_newLocation;
+        p_memory.m_Size = l_newSize;
+
+    }
+
+    void DeallocateMemoryFromPages(Memory& p_memory, void*& p_state)
+    {
+
+        LogDebugLine("Deallocating page memory at " << (void*)p_memory.m_Location);
+
+        (void)p_state;
+
+        if(p_memory.m_Location != nullptr)
+        {
+            munmap(p_memory.m_Location, p_memory.m_Size);
+        }
+        p_memory = Memory();
+
+    }
+
+    void DiscardBytesOfMemoryFromPages(Memory& p_memory, const Size& p_offset, const Size& p_size)
+    {
+
+        LogDebugLine("Discarding " << p_size << " bytes at offset " << p_offset
+        << " of page memory at " << (void*)p_memory.m_Location);
+
+        if(p_offset >= p_memory.m_Size)
+        {
+            return;
+        }
+
+        Size l_pageSize = GetPageSize();
+        Size l_end = p_memory.m_Size - p_offset < p_size ? p_memory.m_Size : p_offset + p_size;
+
+        //Only whole pages can be discarded.
+        Size l_start = (p_offset + (l_pageSize - 1)) & ~(l_pageSize - 1);
+        l_end &= ~(l_pageSize - 1);
+        if(l_start >= l_end)
+        {
+            LogDebugLine("No whole pages in the range, nothing to discard.");
+            return;
+        }
+
+        #ifdef MADV_FREE
+        if(madvise(p_memory.m_Location + l_start, l_end - l_start, MADV_FREE) == 0)
+        {
+            return;
+        }
+        LogDebugLine("MADV_FREE is not supported, using MADV_DONTNEED.");
+        #endif //MADV_FREE
+
+        #ifdef MADV_DONTNEED
+        madvise(p_memory.m_Location + l_start, l_end - l_start, MADV_DONTNEED);
+        #endif //MADV_DONTNEED
+
+    }
+
+
+    //The header in front of the locations from PageMalloc.
+    struct alignas(g_PAGE_MALLOC_HEADER_SIZE) PageMallocHeader
+    {
+        Size m_MappedSize;
+    };
+    static_assert(
+        sizeof(PageMallocHeader) == g_PAGE_MALLOC_HEADER_SIZE,
+        "The page malloc header must be g_PAGE_MALLOC_HEADER_SIZE bytes."
+    );
+
+    //Returns the mapped size needed for p_size bytes after the header, 0 if
+    //it does not fit in a Size.
+    static Size FindMappedSizeOfPageMallocSize(const Size& p_size)
+    {
+        if(p_size > SIZE_MAX - g_PAGE_MALLOC_HEADER_SIZE)
+        {
+            return 0;
+        }
+        return RoundSizeUpToPages(p_size + g_PAGE_MALLOC_HEADER_SIZE);
+    }
+
+    void* PageMalloc(Size p_size)
+    {
+
+        if(p_size == 0)
+        {
+            return nullptr;
+        }
+
+        Size l_mappedSize = FindMappedSizeOfPageMallocSize(p_size);
+        if(l_mappedSize == 0)
+        {
+            return nullptr;
+        }
+
+        Byte* l_mapping = MapPagesOfSizeWithProtection(
+            l_mappedSize, PROT_READ | PROT_WRITE,
+            g_PAGE_ALLOCATOR_DEFAULT_HUGE_PAGE_THRESHOLD
+        );
+        if(l_mapping == nullptr)
+        {
+            return nullptr;
+        }
+
+        ((PageMallocHeader*)l_mapping)->m_MappedSize = l_mappedSize;
+        return l_mapping + g_PAGE_MALLOC_HEADER_SIZE;
+
+    }
+
+    void* PageRealloc(void* p_location, Size p_size)
+    {
+
+        if(p_location == nullptr)
+        {
+            return PageMalloc(p_size);
+        }
+        if(p_size == 0)
+        {
+            PageFree(p_location);
+            return nullptr;
+        }
+
+        Byte* l_mapping = (Byte*)p_location - g_PAGE_MALLOC_HEADER_SIZE;
+        Size l_oldMappedSize = ((PageMallocHeader*)l_mapping)->m_MappedSize;
+        Size l_newMappedSize = FindMappedSizeOfPageMallocSize(p_size);
+        if(l_newMappedSize == 0)
+        {
+            return nullptr;
+        }
+        if(l_newMappedSize == l_oldMappedSize)
+        {
+            return p_location;
+        }
+
+        #ifdef MREMAP_MAYMOVE
+        void* l_newMapping = mremap(
+            l_mapping, l_oldMappedSize, l_newMappedSize, MREMAP_MAYMOVE
+        );
+        if(l_newMapping == MAP_FAILED)
+        {
+            LogDebugLine("mremap of " << (void*)l_mapping << " failed.");
+            return nullptr;
+        }
+        ((PageMallocHeader*)l_newMapping)->m_MappedSize = l_newMappedSize;
+        return (Byte*)l_newMapping + g_PAGE_MALLOC_HEADER_SIZE;
+        #else
+        Byte* l_newLocation = (Byte*)PageMalloc(p_size);
+        if(l_newLocation == nullptr)
+        {
+            return nullptr;
+        }
+        Size l_oldSize = l_oldMappedSize - g_PAGE_MALLOC_HEADER_SIZE;
+        memcpy(l_newLocation, p_location, l_oldSize < p_size ? l_oldSize : p_size);
+        PageFree(p_location);
+        return l_newLocation;
+        #endif //MREMAP_MAYMOVE
+
+    }
+
+    void PageFree(void* p_location)
+    {
+
+        if(p_location == nullptr)
+        {
+            return;
+        }
+
+        Byte* l_mapping = (Byte*)p_location - g_PAGE_MALLOC_HEADER_SIZE;
+        munmap(l_mapping, ((PageMallocHeader*)l_mapping)->m_MappedSize);
+
+    }
+
+}
@@ -0,0 +1,274 @@
+/**
+ * @file PageAllocator.hpp
+ * @brief Declares everything in the @ref PageAllocatorMod module.
+ *
+ * @details Everything is defined in PageAllocator.cpp.
+ *
+ */
+#ifndef PAGE_ALLOCATOR__MEMORY_MANAGEMENT_PAGE_ALLOCATOR_PAGE_ALLOCATOR_HPP
+#define PAGE_ALLOCATOR__MEMORY_MANAGEMENT_PAGE_ALLOCATOR_PAGE_ALLOCATOR_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../MemoryManagement.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+namespace Library
+{
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief The size of a transparent huge page.
+     *
+     * @details Memory that is given huge page hints is also aligned to this,
+     * otherwise the kernel can not back its start and end with huge pages.
+     *
+     */
+    constexpr Size g_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief The huge page threshold used when a page allocator memory
+     * management function is given a null state.
+     *
+     */
+    constexpr Size g_PAGE_ALLOCATOR_DEFAULT_HUGE_PAGE_THRESHOLD = 4 * g_HUGE_PAGE_SIZE;
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief The settings of the page allocator, this is what the state of its
+     * @ref MemoryManagement points to.
+     *
+     * @details The page allocator itself has no state, every memory is its
+     * own mapping. A null state can be used to get the default settings.
+     *
+     */
+    struct PageAllocator
+    {
+
+        /**
+         * @brief Memory of at least this many bytes is aligned to
+         * @ref g_HUGE_PAGE_SIZE and the kernel is told that it should back it
+         * with transparent huge pages. 0 disables this.
+         *
+         */
+        Size m_HugePageThreshold;
+
+
+        /**
+         * @brief Constructs a page allocator with the default settings.
+         *
+         */
+        PageAllocator():
+        m_HugePageThreshold(g_PAGE_ALLOCATOR_DEFAULT_HUGE_PAGE_THRESHOLD)
+        {
+            LogDebugLine("Constructed default page allocator at " << (void*)this);
+        }
+        PageAllocator(const Size& p_huge_page_threshold):
+        m_HugePageThreshold(p_huge_page_threshold)
+        {
+            LogDebugLine("Constructed page allocator at " << (void*)this
+            << " with huge page threshold " << p_huge_page_threshold);
+        }
+
+    };
+
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief Returns the size of a page of the system.
+     *
+     */
+    Size GetPageSize();
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief Rounds p_size up to a whole number of pages.
+     *
+     * @details Returns 0 if the rounded size does not fit in a Size.
+     *
+     */
+    Size RoundSizeUpToPages(const Size& p_size);
+
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref MemoryAllocator that maps fresh zeroed pages for
+     * outp_memory.
+     *
+     * @details outp_memory.m_Size is rounded up to a whole number of pages and
+     * the pages get exactly the protection asked for by
+     * outp_memory.m_Permissions, including none at all. p_state points to a
+     * @ref PageAllocator or is null for the default settings. If the size
+     * reaches the huge page threshold the location is aligned to
+     * @ref g_HUGE_PAGE_SIZE and the kernel is told to use transparent huge
+     * pages for it.
+     *
+     * The guaranteed alignment is the page size, see @ref GetPageSize, that is
+     * what outp_memory.m_Alignment is set to. Asking for a bigger one is an
+     * allocation failure.
+     *
+     * On failure a null memory is written to outp_memory and p_alloc_error is
+     * called with p_alloc_error_data, if it is not null. If outp_memory.m_Size
+     * is 0 a null memory is written and nothing is called.
+     *
+     */
+    void AllocateMemoryFromPages(
+        Memory& outp_memory,
+        void*& p_state,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref MemoryRepermissionator that changes the protection of the
+     * pages of p_memory.
+     *
+     * @details After this accessing p_memory in a way that is not allowed by
+     * p_new_permissions results in a segmentation fault. If the protection
+     * can not be changed p_repermission_error is called and p_memory is not
+     * mutated.
+     *
+     */
+    void RepermissionateMemoryFromPages(
+        Memory& p_memory,
+        const Byte& p_new_permissions,
+        void*& p_state,
+        Callback p_repermission_error, void* p_repermission_error_data
+    );
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref MemoryReallocatorFront for page memory, the bytes at the
+     * end of p_memory are kept.
+     *
+     * @details The new size is rounded up to a whole number of pages.
+     * Shrinking unmaps pages from the front. Growing maps new pages for the
+     * front and moves the old pages after them with mremap, where that is
+     * not available the old bytes are copied instead. On failure
+     * p_realloc_error is called and p_memory is not mutated.
+     *
+     */
+    void ReallocateFrontOfMemoryFromPages(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    );
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref MemoryReallocatorBack for page memory, the bytes at the
+     * start of p_memory are kept.
+     *
+     * @details The new size is rounded up to a whole number of pages.
+     * Shrinking unmaps pages from the back. Growing extends the mapping with
+     * mremap, in place if the pages after it are free, and moves its pages
+     * otherwise. Where mremap is not available the old bytes are copied
+     * instead. On failure p_realloc_error is called and p_memory is not
+     * mutated.
+     *
+     */
+    void ReallocateBackOfMemoryFromPages(
+        Memory& p_memory,
+        const Size& p_new_size,
+        void*& p_state,
+        Callback p_realloc_error, void* p_realloc_error_data
+    );
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref MemoryDeallocator that unmaps the pages of p_memory. A
+     * null memory is written to p_memory.
+     *
+     */
+    void DeallocateMemoryFromPages(Memory& p_memory, void*& p_state);
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief Tells the system that the contents of p_size bytes of p_memory,
+     * starting at p_offset, are no longer needed.
+     *
+     * @details Only pages that are completely inside of the range are
+     * affected. The pages stay mapped and accessible, but the system may take
+     * them back whenever it needs memory, after which they read as zeros.
+     * Writing to a page before that cancels this. This is much cheaper than
+     * unmapping and mapping the pages again, and useful for buffers that are
+     * emptied and filled again later.
+     *
+     * @warning The contents of the affected pages are undefined after this.
+     *
+     */
+    void DiscardBytesOfMemoryFromPages(Memory& p_memory, const Size& p_offset, const Size& p_size);
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief The number of bytes in front of every location returned by
+     * @ref PageMalloc, used to remember the size of its mapping.
+     *
+     */
+    constexpr Size g_PAGE_MALLOC_HEADER_SIZE = alignof(max_align_t);
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief An @ref Allocator that gives every allocation its own mapping.
+     *
+     * @details Returns a location to at least p_size zeroed readable and
+     * writable bytes, or null on failure or if p_size is 0. The mapping is
+     * rounded up to whole pages and starts @ref g_PAGE_MALLOC_HEADER_SIZE
+     * bytes before the location. Allocations that reach
+     * @ref g_PAGE_ALLOCATOR_DEFAULT_HUGE_PAGE_THRESHOLD get huge page hints.
+     *
+     * This is meant for big buffers, small ones waste most of their page.
+     *
+     */
+    void* PageMalloc(Size p_size);
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref Reallocator for locations from @ref PageMalloc.
+     *
+     * @details Behaves like realloc. The pages are moved with mremap instead
+     * of being copied where it is available, so growing a buffer of any size
+     * costs about as much as mapping the new pages. If p_location is null
+     * this is @ref PageMalloc, if p_size is 0 p_location is freed and null is
+     * returned. On failure null is returned and p_location is unchanged.
+     *
+     * @time O(1) in the size of p_location where mremap is available, O(n)
+     * otherwise.
+     *
+     */
+    void* PageRealloc(void* p_location, Size p_size);
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief A @ref Deallocator for locations from @ref PageMalloc and
+     * @ref PageRealloc, the mapping is given back to the system.
+     *
+     * @details Does nothing if p_location is null.
+     *
+     */
+    void PageFree(void* p_location);
+
+    /**
+     * @ingroup PageAllocatorMod
+     * @brief Returns a @ref MemoryManagement that uses the page allocator with
+     * the settings p_settings.
+     *
+     * @details p_settings can be null for the default settings.
+     *
+     * @warning p_settings must outlive the returned value.
+     *
+     */
+    inline MemoryManagement GetMemoryManagementOfPageAllocator(PageAllocator* p_settings)
+    {
+        return MemoryManagement{
+            AllocateMemoryFromPages,
+            RepermissionateMemoryFromPages,
+            ReallocateFrontOfMemoryFromPages,
+            ReallocateBackOfMemoryFromPages,
+            DeallocateMemoryFromPages,
+            p_settings
+        };
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const PageAllocator& p_allocator);
+    #endif //DEBUG
+
+}
+
+#endif //PAGE_ALLOCATOR__MEMORY_MANAGEMENT_PAGE_ALLOCATOR_PAGE_ALLOCATOR_HPP
@@ -0,0 +1,246 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+
+#include "../PageAllocator.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+#include "../../../DataStructures/Queue/Queue.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::Queue;
+
+static const Size g_START_SIZE = 1024 * 1024;
+
+//A reallocator that always copies, this is what growing costs without
+//mremap.
+static void* CopyingRealloc(void* p_location, Size p_size)
+{
+
+    void* l_newLocation = malloc(p_size);
+    if(l_newLocation == nullptr)
+    {
+        return nullptr;
+    }
+    if(p_location != nullptr)
+    {
+        Size l_oldSize = malloc_usable_size(p_location);
+        memcpy(l_newLocation, p_location, l_oldSize < p_size ? l_oldSize : p_size);
+        free(p_location);
+    }
+
+    return l_newLocation;
+
+}
+
+//Grows a byte array from g_START_SIZE to p_final_size by doubling its
+//capacity, writing to every page that is added like a filling buffer would.
+//Returns the sum of a byte of every page so the writes are not optimized out.
+static Size GrowArrayToSizeUsingReallocatorAndDeallocator(
+    const Size& p_final_size,
+    Reallocator p_reallocate,
+    Deallocator p_deallocate
+)
+{
+
+    Size l_pageSize = GetPageSize();
+
+    Array<Byte> l_array;
+    ResizeArrayToCapacityUsingReallocator(l_array, g_START_SIZE, p_reallocate, nullptr, nullptr);
+    memset(l_array.m_Buffer, 1, g_START_SIZE);
+    l_array.m_Size = g_START_SIZE;
+
+    while(l_array.m_Capacity < p_final_size)
+    {
+        Size l_oldCapacity = l_array.m_Capacity;
+        IncreaseArrayCapacityByAmountUsingReallocator(l_array, l_oldCapacity, p_reallocate, nullptr, nullptr);
+        if(l_array.m_Capacity == l_oldCapacity)
+        {
+            FAIL("Reallocation failed");
+        }
+        for(Size i = l_oldCapacity; i < l_array.m_Capacity; i += l_pageSize)
+        {
+            l_array.m_Buffer[i] = 1;
+        }
+        l_array.m_Size = l_array.m_Capacity;
+    }
+
+    Size l_sum = 0;
+    for(Size i = 0; i < l_array.m_Size; i += l_pageSize)
+    {
+        l_sum += l_array.m_Buffer[i];
+    }
+
+    DestroyArrayUsingDeallocator(l_array, p_deallocate);
+    return l_sum;
+
+}
+
+static void BenchmarkArrayGrowthToSize(const Size& p_final_size)
+{
+
+    BENCHMARK("realloc")
+    {
+        return GrowArrayToSizeUsingReallocatorAndDeallocator(p_final_size, realloc, free);
+    };
+    BENCHMARK("Copying realloc")
+    {
+        return GrowArrayToSizeUsingReallocatorAndDeallocator(p_final_size, CopyingRealloc, free);
+    };
+    BENCHMARK("PageRealloc")
+    {
+        return GrowArrayToSizeUsingReallocatorAndDeallocator(p_final_size, PageRealloc, PageFree);
+    };
+
+}
+
+TEST_CASE("Array growth from 1MB to 16MB", "[PageAllocator][Benchmark]")
+{
+    BenchmarkArrayGrowthToSize(16 * g_START_SIZE);
+}
+TEST_CASE("Array growth from 1MB to 256MB", "[PageAllocator][Benchmark]")
+{
+    BenchmarkArrayGrowthToSize(256 * g_START_SIZE);
+}
+TEST_CASE("Array growth from 1MB to 1GB", "[PageAllocator][Benchmark]")
+{
+    BenchmarkArrayGrowthToSize(1024 * g_START_SIZE);
+}
+//Copying needs 6GB at the peak, so this is hidden. Run it with [4GB].
+TEST_CASE("Array growth from 1MB to 4GB", "[.][4GB][PageAllocator][Benchmark]")
+{
+    BenchmarkArrayGrowthToSize(4096 * g_START_SIZE);
+}
+
+//Fills a queue of ints from g_START_SIZE bytes and doubles its capacity
+//every time it becomes full, until it holds p_final_size bytes. Half of the
+//items are read before every growth so that the queue wraps around.
+static Size GrowQueueToSizeUsingReallocatorAndDeallocator(
+    const Size& p_final_size,
+    Reallocator p_reallocate,
+    Deallocator p_deallocate
+)
+{
+
+    Queue<int> l_queue;
+    IncreasesQueueCapicityByAmountUsingReallocator(l_queue, g_START_SIZE / sizeof(int), p_reallocate, nullptr, nullptr);
+
+    int l_item = 0;
+    Size l_sum = 0;
+    while(l_queue.m_Buffer.m_Capacity * sizeof(int) < p_final_size)
+    {
+        while(QueueIsFull(l_queue) == false)
+        {
+            AddItemToQueue(l_item++, l_queue);
+        }
+        for(Size i = 0; i < l_queue.m_Buffer.m_Capacity / 2; ++i)
+        {
+            RemoveItemFromQueuePutItAt(l_queue, l_item);
+            l_sum += l_item;
+        }
+        while(QueueIsFull(l_queue) == false)
+        {
+            AddItemToQueue(l_item++, l_queue);
+        }
+
+        Size l_oldCapacity = l_queue.m_Buffer.m_Capacity;
+        IncreasesQueueCapicityByAmountUsingReallocator(l_queue, l_oldCapacity, p_reallocate, nullptr, nullptr);
+        if(l_queue.m_Buffer.m_Capacity == l_oldCapacity)
+        {
+            FAIL("Reallocation failed");
+        }
+    }
+
+    DestroyQueueUsingDeallocator(l_queue, p_deallocate);
+    return l_sum;
+
+}
+
+TEST_CASE("Queue growth from 1MB to 256MB", "[PageAllocator][Benchmark]")
+{
+
+    BENCHMARK("realloc")
+    {
+        return GrowQueueToSizeUsingReallocatorAndDeallocator(256 * g_START_SIZE, realloc, free);
+    };
+    BENCHMARK("Copying realloc")
+    {
+        return GrowQueueToSizeUsingReallocatorAndDeallocator(256 * g_START_SIZE, CopyingRealloc, free);
+    };
+    BENCHMARK("PageRealloc")
+    {
+        return GrowQueueToSizeUsingReallocatorAndDeallocator(256 * g_START_SIZE, PageRealloc, PageFree);
+    };
+
+}
+
+//Grows memory from g_START_SIZE to p_final_size by doubling it at the front,
+//like a buffer that is prepended to. If p_copy is true the memory is grown by
+//allocating new pages and copying to their end instead.
+static Size GrowFrontOfMemoryToSize(const Size& p_final_size, const bool& p_copy)
+{
+
+    Size l_pageSize = GetPageSize();
+    void* l_state = nullptr;
+
+    Memory l_memory(nullptr, g_START_SIZE, 0b011);
+    AllocateMemoryFromPages(l_memory, l_state, nullptr, nullptr);
+    memset(l_memory.m_Location, 1, l_memory.m_Size);
+
+    while(l_memory.m_Size < p_final_size)
+    {
+        Size l_oldSize = l_memory.m_Size;
+        if(p_copy)
+        {
+            Memory l_newMemory(nullptr, 2 * l_oldSize, 0b011);
+            AllocateMemoryFromPages(l_newMemory, l_state, nullptr, nullptr);
+            if(l_newMemory.m_Location == nullptr)
+            {
+                FAIL("Allocation failed");
+            }
+            memcpy(l_newMemory.m_Location + l_oldSize, l_memory.m_Location, l_oldSize);
+            DeallocateMemoryFromPages(l_memory, l_state);
+            l_memory = l_newMemory;
+        }
+        else
+        {
+            ReallocateFrontOfMemoryFromPages(l_memory, 2 * l_oldSize, l_state, nullptr, nullptr);
+            if(l_memory.m_Size == l_oldSize)
+            {
+                FAIL("Reallocation failed");
+            }
+        }
+        for(Size i = 0; i < l_memory.m_Size - l_oldSize; i += l_pageSize)
+        {
+            l_memory.m_Location[i] = 1;
+        }
+    }
+
+    Size l_sum = 0;
+    for(Size i = 0; i < l_memory.m_Size; i += l_pageSize)
+    {
+        l_sum += l_memory.m_Location[i];
+    }
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+    return l_sum;
+
+}
+
+TEST_CASE("Front growth from 1MB to 1GB", "[PageAllocator][Benchmark]")
+{
+
+    BENCHMARK("Copying")
+    {
+        return GrowFrontOfMemoryToSize(1024 * g_START_SIZE, true);
+    };
+    BENCHMARK("ReallocateFrontOfMemoryFromPages")
+    {
+        return GrowFrontOfMemoryToSize(1024 * g_START_SIZE, false);
+    };
+
+}
@@ -0,0 +1,53 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../PageAllocator.hpp"
+
+using namespace Library;
+using namespace Catch::Generators;
+
+TEST_CASE("Constructors", "[PageAllocator][Member]")
+{
+
+    SECTION("Default")
+    {
+        PageAllocator l_allocator;
+        CHECK(l_allocator.m_HugePageThreshold == g_PAGE_ALLOCATOR_DEFAULT_HUGE_PAGE_THRESHOLD);
+    }
+    SECTION("Threshold")
+    {
+        PageAllocator l_allocator(0);
+        CHECK(l_allocator.m_HugePageThreshold == 0);
+    }
+
+}
+
+TEST_CASE("Page size", "[PageAllocator][Member]")
+{
+
+    Size l_pageSize = GetPageSize();
+    REQUIRE(l_pageSize > 0);
+    CHECK((l_pageSize & (l_pageSize - 1)) == 0);
+
+    CHECK(RoundSizeUpToPages(0) == 0);
+    CHECK(RoundSizeUpToPages(1) == l_pageSize);
+    CHECK(RoundSizeUpToPages(l_pageSize) == l_pageSize);
+    CHECK(RoundSizeUpToPages(l_pageSize + 1) == 2 * l_pageSize);
+    CHECK(RoundSizeUpToPages(SIZE_MAX) == 0);
+
+}
+
+TEST_CASE("Memory management", "[PageAllocator][Member]")
+{
+
+    PageAllocator l_allocator;
+    MemoryManagement l_management = GetMemoryManagementOfPageAllocator(&l_allocator);
+
+    CHECK(l_management.m_Allocate == AllocateMemoryFromPages);
+    CHECK(l_management.m_Repermissionate == RepermissionateMemoryFromPages);
+    CHECK(l_management.m_ReallocateFront == ReallocateFrontOfMemoryFromPages);
+    CHECK(l_management.m_ReallocateBack == ReallocateBackOfMemoryFromPages);
+    CHECK(l_management.m_Deallocate == DeallocateMemoryFromPages);
+    CHECK(l_management.m_State == &l_allocator);
+
+}
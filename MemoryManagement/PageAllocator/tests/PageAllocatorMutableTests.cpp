@@ -0,0 +1,439 @@
+#include <catch2/catch.hpp>
+
+#include "../PageAllocator.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+using namespace Library;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+//Finds the protection of the mapping that holds p_location as written in
+///proc/self/maps, for example "rw-p". Empty if it is not mapped.
+static std::string FindProtectionOfLocation(const void* p_location)
+{
+
+    FILE* l_maps = fopen("/proc/self/maps", "r");
+    if(l_maps == nullptr)
+    {
+        return "";
+    }
+
+    std::string l_protection;
+    unsigned long l_start, l_end;
+    char l_permissions[5];
+    char l_line[512];
+    while(fgets(l_line, sizeof(l_line), l_maps) != nullptr)
+    {
+        if(sscanf(l_line, "%lx-%lx %4s", &l_start, &l_end, l_permissions) != 3)
+        {
+            continue;
+        }
+        if((uintptr_t)p_location >= l_start && (uintptr_t)p_location < l_end)
+        {
+            l_protection = l_permissions;
+            break;
+        }
+    }
+
+    fclose(l_maps);
+    return l_protection;
+
+}
+
+TEST_CASE("Allocation", "[PageAllocator][Mutable][Allocation]")
+{
+
+    Size l_pageSize = GetPageSize();
+    Size l_size = GENERATE_COPY(1, 100, l_pageSize, l_pageSize + 1, 10 * l_pageSize);
+
+    void* l_state = nullptr;
+    Memory l_memory(nullptr, l_size, 0b011);
+    bool l_called = false;
+
+    AllocateMemoryFromPages(l_memory, l_state, &GeneralErrorCallback, &l_called);
+    CHECK(l_called == false);
+    REQUIRE(l_memory.m_Location != nullptr);
+    CHECK((uintptr_t)l_memory.m_Location % l_pageSize == 0);
+    CHECK(l_memory.m_Alignment == l_pageSize);
+    CHECK(l_memory.m_Size == RoundSizeUpToPages(l_size));
+    CHECK(l_memory.m_Permissions == 0b011);
+    CHECK(FindProtectionOfLocation(l_memory.m_Location) == "rw-p");
+
+    //Fresh pages are zeroed.
+    for(Size i = 0; i < l_memory.m_Size; ++i)
+    {
+        REQUIRE(l_memory.m_Location[i] == 0);
+    }
+    memset(l_memory.m_Location, 0xab, l_memory.m_Size);
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+    CHECK(l_memory.m_Location == nullptr);
+    CHECK(l_memory.m_Size == 0);
+
+}
+
+TEST_CASE("Allocation with huge pages", "[PageAllocator][Mutable][Allocation]")
+{
+
+    PageAllocator l_allocator(g_HUGE_PAGE_SIZE);
+    void* l_state = &l_allocator;
+
+    Memory l_memory(nullptr, 3 * g_HUGE_PAGE_SIZE, 0b011);
+    AllocateMemoryFromPages(l_memory, l_state, nullptr, nullptr);
+    REQUIRE(l_memory.m_Location != nullptr);
+    CHECK((uintptr_t)l_memory.m_Location % g_HUGE_PAGE_SIZE == 0);
+    CHECK(l_memory.m_Size == 3 * g_HUGE_PAGE_SIZE);
+    memset(l_memory.m_Location, 1, l_memory.m_Size);
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+
+}
+
+TEST_CASE("Failed and empty allocation", "[PageAllocator][Mutable][Allocation]")
+{
+
+    void* l_state = nullptr;
+    bool l_called = false;
+
+    SECTION("Too big")
+    {
+        Memory l_memory(nullptr, SIZE_MAX - 10, 0b011);
+        AllocateMemoryFromPages(l_memory, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_memory.m_Location == nullptr);
+        CHECK(l_memory.m_Size == 0);
+    }
+    SECTION("Alignment bigger than a page")
+    {
+        Memory l_memory(nullptr, 100, 0b011, 2 * GetPageSize());
+        AllocateMemoryFromPages(l_memory, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_memory.m_Location == nullptr);
+        CHECK(l_memory.m_Size == 0);
+    }
+    SECTION("Zero size")
+    {
+        Memory l_memory(nullptr, 0, 0b011);
+        AllocateMemoryFromPages(l_memory, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Location == nullptr);
+    }
+
+}
+
+TEST_CASE("Repermissionating", "[PageAllocator][Mutable][Repermissionating]")
+{
+
+    void* l_state = nullptr;
+    Memory l_memory(nullptr, 2 * GetPageSize(), 0b011);
+    AllocateMemoryFromPages(l_memory, l_state, nullptr, nullptr);
+    REQUIRE(l_memory.m_Location != nullptr);
+    l_memory.m_Location[0] = 42;
+
+    bool l_called = false;
+
+    SECTION("Read only")
+    {
+        RepermissionateMemoryFromPages(l_memory, 0b001, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Permissions == 0b001);
+        CHECK(FindProtectionOfLocation(l_memory.m_Location) == "r--p");
+        CHECK(l_memory.m_Location[0] == 42);
+    }
+    SECTION("No access")
+    {
+        RepermissionateMemoryFromPages(l_memory, 0b000, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Permissions == 0b000);
+        CHECK(FindProtectionOfLocation(l_memory.m_Location) == "---p");
+
+        //The bytes come back when access is given again.
+        RepermissionateMemoryFromPages(l_memory, 0b011, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_memory.m_Location[0] == 42);
+    }
+    SECTION("Executable")
+    {
+        RepermissionateMemoryFromPages(l_memory, 0b101, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Permissions == 0b101);
+        CHECK(FindProtectionOfLocation(l_memory.m_Location) == "r-xp");
+    }
+    SECTION("Failure")
+    {
+        //Pages that are not mapped can not be repermissionated.
+        Memory l_unmapped = l_memory;
+        DeallocateMemoryFromPages(l_memory, l_state);
+        RepermissionateMemoryFromPages(l_unmapped, 0b001, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == true);
+        CHECK(l_unmapped.m_Permissions == 0b011);
+    }
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+
+}
+
+TEST_CASE("Reallocation", "[PageAllocator][Mutable][Reallocation]")
+{
+
+    Size l_pageSize = GetPageSize();
+    void* l_state = nullptr;
+
+    Memory l_memory(nullptr, 4 * l_pageSize, 0b011);
+    AllocateMemoryFromPages(l_memory, l_state, nullptr, nullptr);
+    REQUIRE(l_memory.m_Location != nullptr);
+    for(Size i = 0; i < l_memory.m_Size; ++i)
+    {
+        l_memory.m_Location[i] = (Byte)(i / l_pageSize + 1);
+    }
+
+    bool l_called = false;
+
+    SECTION("Back")
+    {
+        SECTION("Growing")
+        {
+            ReallocateBackOfMemoryFromPages(l_memory, 10 * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            REQUIRE(l_memory.m_Size == 10 * l_pageSize);
+            for(Size i = 0; i < 4 * l_pageSize; ++i)
+            {
+                REQUIRE(l_memory.m_Location[i] == (Byte)(i / l_pageSize + 1));
+            }
+            CHECK(l_memory.m_Location[9 * l_pageSize] == 0);
+        }
+        SECTION("Shrinking")
+        {
+            Byte* l_oldLocation = l_memory.m_Location;
+            ReallocateBackOfMemoryFromPages(l_memory, l_pageSize + 1, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Location == l_oldLocation);
+            CHECK(l_memory.m_Size == 2 * l_pageSize);
+            CHECK(FindProtectionOfLocation(l_oldLocation + 2 * l_pageSize) == "");
+        }
+        SECTION("Growing read only memory")
+        {
+            RepermissionateMemoryFromPages(l_memory, 0b001, l_state, nullptr, nullptr);
+            ReallocateBackOfMemoryFromPages(l_memory, 8 * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Permissions == 0b001);
+            CHECK(FindProtectionOfLocation(l_memory.m_Location) == "r--p");
+            CHECK(l_memory.m_Location[0] == 1);
+        }
+        SECTION("Growing inaccessible memory")
+        {
+            RepermissionateMemoryFromPages(l_memory, 0b000, l_state, nullptr, nullptr);
+            ReallocateBackOfMemoryFromPages(l_memory, 8 * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(FindProtectionOfLocation(l_memory.m_Location) == "---p");
+            RepermissionateMemoryFromPages(l_memory, 0b001, l_state, nullptr, nullptr);
+            CHECK(l_memory.m_Location[3 * l_pageSize] == 4);
+        }
+        SECTION("Failure")
+        {
+            Byte* l_oldLocation = l_memory.m_Location;
+            ReallocateBackOfMemoryFromPages(l_memory, SIZE_MAX - 10, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == true);
+            CHECK(l_memory.m_Location == l_oldLocation);
+            CHECK(l_memory.m_Size == 4 * l_pageSize);
+        }
+    }
+    SECTION("Front")
+    {
+        SECTION("Growing")
+        {
+            ReallocateFrontOfMemoryFromPages(l_memory, 6 * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            REQUIRE(l_memory.m_Size == 6 * l_pageSize);
+            CHECK(l_memory.m_Location[0] == 0);
+            for(Size i = 0; i < 4 * l_pageSize; ++i)
+            {
+                REQUIRE(l_memory.m_Location[2 * l_pageSize + i] == (Byte)(i / l_pageSize + 1));
+            }
+        }
+        SECTION("Growing read only memory")
+        {
+            RepermissionateMemoryFromPages(l_memory, 0b001, l_state, nullptr, nullptr);
+            ReallocateFrontOfMemoryFromPages(l_memory, 8 * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Permissions == 0b001);
+            CHECK(FindProtectionOfLocation(l_memory.m_Location) == "r--p");
+            CHECK(FindProtectionOfLocation(l_memory.m_Location + 4 * l_pageSize) == "r--p");
+            CHECK(l_memory.m_Location[0] == 0);
+            CHECK(l_memory.m_Location[4 * l_pageSize] == 1);
+        }
+        SECTION("Shrinking")
+        {
+            Byte* l_oldLocation = l_memory.m_Location;
+            ReallocateFrontOfMemoryFromPages(l_memory, l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == false);
+            CHECK(l_memory.m_Location == l_oldLocation + 3 * l_pageSize);
+            CHECK(l_memory.m_Size == l_pageSize);
+            CHECK(l_memory.m_Location[0] == 4);
+            CHECK(FindProtectionOfLocation(l_oldLocation) == "");
+        }
+        SECTION("Failure")
+        {
+            Byte* l_oldLocation = l_memory.m_Location;
+            ReallocateFrontOfMemoryFromPages(l_memory, SIZE_MAX - 10, l_state, &GeneralErrorCallback, &l_called);
+            CHECK(l_called == true);
+            CHECK(l_memory.m_Location == l_oldLocation);
+            CHECK(l_memory.m_Size == 4 * l_pageSize);
+        }
+    }
+    SECTION("Zero size")
+    {
+        ReallocateBackOfMemoryFromPages(l_memory, 0, l_state, &GeneralErrorCallback, &l_called);
+        CHECK(l_called == false);
+        CHECK(l_memory.m_Location == nullptr);
+        CHECK(l_memory.m_Size == 0);
+    }
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+
+}
+
+TEST_CASE("Growing big memory", "[PageAllocator][Mutable][Reallocation]")
+{
+
+    Size l_pageSize = GetPageSize();
+    void* l_state = nullptr;
+
+    //Every page is marked with its index so that moved pages can be told
+    //apart.
+    Size l_numberOfPages = GENERATE(1, 512, 2048);
+    Memory l_memory(nullptr, l_numberOfPages * l_pageSize, 0b011);
+    AllocateMemoryFromPages(l_memory, l_state, nullptr, nullptr);
+    REQUIRE(l_memory.m_Location != nullptr);
+    for(Size i = 0; i < l_numberOfPages; ++i)
+    {
+        *(Size*)(l_memory.m_Location + i * l_pageSize) = i + 1;
+    }
+
+    bool l_called = false;
+    Size l_newNumberOfPages = 3 * l_numberOfPages + 1;
+    Size l_offset = 0;
+
+    SECTION("Back")
+    {
+        ReallocateBackOfMemoryFromPages(l_memory, l_newNumberOfPages * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+    }
+    SECTION("Front")
+    {
+        ReallocateFrontOfMemoryFromPages(l_memory, l_newNumberOfPages * l_pageSize, l_state, &GeneralErrorCallback, &l_called);
+        l_offset = l_newNumberOfPages - l_numberOfPages;
+    }
+
+    CHECK(l_called == false);
+    REQUIRE(l_memory.m_Size == l_newNumberOfPages * l_pageSize);
+    CHECK(FindProtectionOfLocation(l_memory.m_Location) == "rw-p");
+    CHECK(FindProtectionOfLocation(l_memory.m_Location + l_memory.m_Size - 1) == "rw-p");
+    for(Size i = 0; i < l_newNumberOfPages; ++i)
+    {
+        Size l_expected = 0;
+        if(i >= l_offset && i < l_offset + l_numberOfPages)
+        {
+            l_expected = i - l_offset + 1;
+        }
+        REQUIRE(*(Size*)(l_memory.m_Location + i * l_pageSize) == l_expected);
+    }
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+
+}
+
+TEST_CASE("Page malloc", "[PageAllocator][Mutable][Malloc]")
+{
+
+    Size l_pageSize = GetPageSize();
+
+    CHECK(PageMalloc(0) == nullptr);
+    CHECK(PageMalloc(SIZE_MAX - 10) == nullptr);
+    PageFree(nullptr);
+
+    Size l_size = GENERATE_COPY(1, 100, l_pageSize, 3 * l_pageSize + 1);
+
+    Byte* l_location = (Byte*)PageMalloc(l_size);
+    REQUIRE(l_location != nullptr);
+    CHECK((uintptr_t)l_location % g_PAGE_MALLOC_HEADER_SIZE == 0);
+    CHECK(FindProtectionOfLocation(l_location) == "rw-p");
+    for(Size i = 0; i < l_size; ++i)
+    {
+        REQUIRE(l_location[i] == 0);
+    }
+    for(Size i = 0; i < l_size; ++i)
+    {
+        l_location[i] = (Byte)i;
+    }
+
+    SECTION("Growing")
+    {
+        Size l_newSize = l_size + 100 * l_pageSize;
+        l_location = (Byte*)PageRealloc(l_location, l_newSize);
+        REQUIRE(l_location != nullptr);
+        for(Size i = 0; i < l_size; ++i)
+        {
+            REQUIRE(l_location[i] == (Byte)i);
+        }
+        CHECK(l_location[l_newSize - 1] == 0);
+        l_location[l_newSize - 1] = 1;
+    }
+    SECTION("Shrinking")
+    {
+        l_location = (Byte*)PageRealloc(l_location, 10);
+        REQUIRE(l_location != nullptr);
+        for(Size i = 0; i < 10 && i < l_size; ++i)
+        {
+            REQUIRE(l_location[i] == (Byte)i);
+        }
+    }
+    SECTION("Failure")
+    {
+        CHECK(PageRealloc(l_location, SIZE_MAX - 10) == nullptr);
+        CHECK(l_location[0] == 0);
+        CHECK(l_location[l_size - 1] == (Byte)(l_size - 1));
+    }
+    SECTION("Zero size")
+    {
+        CHECK(PageRealloc(l_location, 0) == nullptr);
+        CHECK(FindProtectionOfLocation(l_location) == "");
+        l_location = (Byte*)PageRealloc(nullptr, l_size);
+        REQUIRE(l_location != nullptr);
+        CHECK(l_location[0] == 0);
+    }
+
+    PageFree(l_location);
+
+}
+
+TEST_CASE("Discarding", "[PageAllocator][Mutable][Discarding]")
+{
+
+    Size l_pageSize = GetPageSize();
+    void* l_state = nullptr;
+
+    Memory l_memory(nullptr, 4 * l_pageSize, 0b011);
+    AllocateMemoryFromPages(l_memory, l_state, nullptr, nullptr);
+    REQUIRE(l_memory.m_Location != nullptr);
+    memset(l_memory.m_Location, 7, l_memory.m_Size);
+
+    //Only the 2 whole pages in the middle are affected.
+    DiscardBytesOfMemoryFromPages(l_memory, l_pageSize / 2, 3 * l_pageSize);
+    CHECK(l_memory.m_Location[0] == 7);
+    CHECK(l_memory.m_Location[l_pageSize - 1] == 7);
+    CHECK(l_memory.m_Location[3 * l_pageSize] == 7);
+
+    //Discarded pages can still be used.
+    memset(l_memory.m_Location, 9, l_memory.m_Size);
+    CHECK(l_memory.m_Location[2 * l_pageSize] == 9);
+    CHECK(FindProtectionOfLocation(l_memory.m_Location + l_pageSize) == "rw-p");
+
+    DiscardBytesOfMemoryFromPages(l_memory, 0, SIZE_MAX);
+    DiscardBytesOfMemoryFromPages(l_memory, 100 * l_pageSize, 10);
+    DiscardBytesOfMemoryFromPages(l_memory, 1, 10);
+
+    DeallocateMemoryFromPages(l_memory, l_state);
+
+}
@@ -0,0 +1,182 @@
+/**
+ * @file Pool.cpp
+ * @brief Defines everything in the @ref PoolMod module that is not defined
+ * inline in Pool.hpp.
+ *
+ */
+#include "Pool.hpp"
+
+namespace Library
+{
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const Pool& p_pool)
+    {
+
+        p_log << (void*)&p_pool;
+        p_log << " { m_FreeBlock = " << (void*)p_pool.m_FreeBlock;
+        p_log << ", m_Top = " << (void*)p_pool.m_Top;
+        p_log << ", m_End = " << (void*)p_pool.m_End;
+        p_log << ", m_CurrentPage = " << (void*)p_pool.m_CurrentPage;
+        p_log << ", m_BlockSize = " << p_pool.m_BlockSize;
+        p_log << ", m_BlocksPerPage = " << p_pool.m_BlocksPerPage;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+
+    //Allocates a page and makes it the current page of p_pool. Returns false
+    //on failure, p_pool is not mutated in that case.
+    static bool AddPageToPool(Pool& p_pool)
+    {
+
+        LogDebugLine("Adding page to pool " << p_pool);
+
+        PoolPage* l_page = (PoolPage*)p_pool.m_Allocate(
+            sizeof(PoolPage) + p_pool.m_BlockSize * p_pool.m_BlocksPerPage
+        );
+        if(l_page == nullptr)
+        {
+            LogDebugLine("Allocation of the page failed, returning false.");
+            return false;
+        }
+
+        l_page->m_PreviousPage = p_pool.m_CurrentPage;
+
+        p_pool.m_CurrentPage = l_page;
+        p_pool.m_Top = (Byte*)(l_page + 1);
+        p_pool.m_End = p_pool.m_Top + p_pool.m_BlockSize * p_pool.m_BlocksPerPage;
+
+        LogDebugLine("Successfully added page at " << (void*)l_page);
+        return true;
+
+    }
+
+
+    void CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+        Pool& outp_pool,
+        const Size& p_block_size, const Size& p_blocks_per_page,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating pool at " << (void*)&outp_pool << " with block "
+        "size " << p_block_size << " and " << p_blocks_per_page << " blocks "
+        "per page");
+
+        outp_pool = Pool();
+
+        if(p_block_size == 0 || p_blocks_per_page == 0)
+        {
+            LogDebugLine("The block size or blocks per page is 0, leaving a "
+            "null pool and returning.");
+            return;
+        }
+
+        //Every block must be able to hold the free list link and keep it
+        //aligned.
+        Size l_blockSize = p_block_size < sizeof(PoolBlock) ? sizeof(PoolBlock) : p_block_size;
+        if(l_blockSize > SIZE_MAX - (alignof(PoolBlock) - 1))
+        {
+            LogDebugLine("The block size overflows, leaving a null pool.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+        l_blockSize = (l_blockSize + (alignof(PoolBlock) - 1)) & ~(alignof(PoolBlock) - 1);
+
+        if(p_blocks_per_page > (SIZE_MAX - sizeof(PoolPage)) / l_blockSize)
+        {
+            LogDebugLine("The page size overflows, leaving a null pool.");
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        outp_pool.m_BlockSize = l_blockSize;
+        outp_pool.m_BlocksPerPage = p_blocks_per_page;
+        outp_pool.m_Allocate = p_allocate;
+        outp_pool.m_Deallocate = p_deallocate;
+
+        if(AddPageToPool(outp_pool) == false)
+        {
+            LogDebugLine("Could not allocate the first page, creating null pool.");
+            outp_pool = Pool();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        LogDebugLine("Successfully created pool " << outp_pool);
+
+    }
+
+
+    void* AllocateFromNewPageOfPool(Pool& p_pool)
+    {
+
+        LogDebugLine("Allocating a block from a new page of pool " << p_pool);
+
+        if(p_pool.m_Allocate == nullptr)
+        {
+            LogDebugLine("The pool is a null pool, returning null.");
+            return nullptr;
+        }
+
+        if(AddPageToPool(p_pool) == false)
+        {
+            LogDebugLine("Could not add a page, returning null.");
+            return nullptr;
+        }
+
+        //Guaranteed to have a block, so the fast path will not recurse.
+        return AllocateFromPool(p_pool);
+
+    }
+
+
+    void DestroyPool(Pool& p_pool)
+    {
+
+        LogDebugLine("Destroying pool " << p_pool);
+
+        PoolPage* l_page = p_pool.m_CurrentPage;
+        while(l_page != nullptr)
+        {
+            PoolPage* l_previous = l_page->m_PreviousPage;
+            LogDebugLine("Deallocating page at " << (void*)l_page);
+            p_pool.m_Deallocate(l_page);
+            l_page = l_previous;
+        }
+
+        p_pool = Pool();
+
+    }
+
+    Size FindNumberOfPagesInPool(const Pool& p_pool)
+    {
+
+        Size l_count = 0;
+        for(PoolPage* l_page = p_pool.m_CurrentPage; l_page != nullptr; l_page = l_page->m_PreviousPage)
+        {
+            ++l_count;
+        }
+
+        return l_count;
+
+    }
+
+}
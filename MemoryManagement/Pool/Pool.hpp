@@ -0,0 +1,452 @@
+/**
+ * @file Pool.hpp
+ * @brief Declares everything in the @ref PoolMod module.
+ *
+ * @details The fast paths of pool allocation and deallocation and the typed
+ * adapters are defined inline in this file, everything else is defined in
+ * Pool.cpp.
+ *
+ */
+#ifndef POOL__MEMORY_MANAGEMENT_POOL_POOL_HPP
+#define POOL__MEMORY_MANAGEMENT_POOL_POOL_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+namespace Library
+{
+
+    /**
+     * @ingroup PoolMod
+     * @brief The alignment of the first block in every page of a pool.
+     *
+     * @details Block i of a page starts i block sizes after the first one, so
+     * a block is aligned to the largest power of 2 that divides the block
+     * size, up to this value. Since sizeof(T) is always a multiple of
+     * alignof(T) this is enough for any T allocated from a pool of
+     * sizeof(T) blocks.
+     *
+     */
+    constexpr Size g_POOL_ALIGNMENT = alignof(max_align_t);
+    /**
+     * @ingroup PoolMod
+     * @brief The number of blocks in each page of the pools used by
+     * @ref PoolMalloc and @ref PoolFree.
+     *
+     */
+    constexpr Size g_POOL_DEFAULT_BLOCKS_PER_PAGE = 1024;
+
+    /**
+     * @ingroup PoolMod
+     * @brief The header of a single page of blocks owned by a pool.
+     *
+     * @details Pages are allocated with the pool's allocator, the header is
+     * placed at the start of the page and the blocks right after it. Pages
+     * form a singly linked chain from the newest to the oldest page.
+     *
+     */
+    struct alignas(g_POOL_ALIGNMENT) PoolPage
+    {
+
+        /**
+         * @brief The page that was allocated before this one, null if this is
+         * the oldest page.
+         *
+         */
+        PoolPage* m_PreviousPage;
+
+    };
+
+    /**
+     * @ingroup PoolMod
+     * @brief What a free block of a pool holds.
+     *
+     * @details Free blocks are linked into the free list of their pool
+     * through the first bytes of the block, so they need no extra memory.
+     *
+     */
+    struct PoolBlock
+    {
+        /**
+         * @brief The next free block, null if this is the last one.
+         *
+         */
+        PoolBlock* m_NextBlock;
+    };
+
+    /**
+     * @ingroup PoolMod
+     * @brief Hands out blocks of one fixed size from large contiguous pages.
+     *
+     * @details A pool owns a chain of pages, see @ref PoolPage, each holding
+     * @ref m_BlocksPerPage blocks. Deallocated blocks go on a free list and
+     * are handed out again before any new block is touched, blocks that were
+     * never handed out are taken from the newest page in order. Both are
+     * O(1) and neither calls the pool's allocator, that only happens when the
+     * newest page runs out.
+     *
+     * Since consecutive allocations come from consecutive blocks, a list
+     * built from a pool has its nodes next to each other in memory instead of
+     * scattered around the heap.
+     *
+     * Pages are only given back to the pool's deallocator when the pool is
+     * destroyed.
+     *
+     * Pools are not thread safe, each thread should use its own pool.
+     *
+     * @section PoolTypes Types of pools
+     * - Null pool, every field is null or 0. Allocating from this pool always
+     * fails. This is what the default constructor makes.
+     * - Valid pool, created using
+     * @ref CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator.
+     *
+     */
+    struct Pool
+    {
+
+        /**
+         * @brief The first free block, null if there are none.
+         *
+         */
+        PoolBlock* m_FreeBlock;
+        /**
+         * @brief The first block in @ref m_CurrentPage that was never handed
+         * out.
+         *
+         */
+        Byte* m_Top;
+        /**
+         * @brief One past the last block in @ref m_CurrentPage.
+         *
+         */
+        Byte* m_End;
+        /**
+         * @brief The newest page.
+         *
+         */
+        PoolPage* m_CurrentPage;
+        /**
+         * @brief The size of each block in bytes.
+         *
+         */
+        Size m_BlockSize;
+        /**
+         * @brief The number of blocks in each page.
+         *
+         */
+        Size m_BlocksPerPage;
+
+        /**
+         * @brief Used for allocating new pages.
+         *
+         */
+        void* (*m_Allocate) (Size);
+        /**
+         * @brief Used for freeing pages on destruction.
+         *
+         */
+        void (*m_Deallocate) (void*);
+
+
+        /**
+         * @brief Constructs a null pool.
+         *
+         */
+        Pool():
+        m_FreeBlock(nullptr),
+        m_Top(nullptr),
+        m_End(nullptr),
+        m_CurrentPage(nullptr),
+        m_BlockSize(0),
+        m_BlocksPerPage(0),
+        m_Allocate(nullptr),
+        m_Deallocate(nullptr)
+        {
+            LogDebugLine("Constructed null pool at " << (void*)this);
+        }
+
+        /**
+         * @brief Copies every field from p_other, the pages are shared.
+         *
+         * @warning Only one of the two pools should ever be used after this.
+         *
+         */
+        Pool(const Pool& p_other) = default;
+        /**
+         * @brief Copies every field from p_other and then makes p_other a null
+         * pool.
+         *
+         */
+        Pool(Pool&& p_other):
+        m_FreeBlock(p_other.m_FreeBlock),
+        m_Top(p_other.m_Top),
+        m_End(p_other.m_End),
+        m_CurrentPage(p_other.m_CurrentPage),
+        m_BlockSize(p_other.m_BlockSize),
+        m_BlocksPerPage(p_other.m_BlocksPerPage),
+        m_Allocate(p_other.m_Allocate),
+        m_Deallocate(p_other.m_Deallocate)
+        {
+            LogDebugLine("Moved pool from " << (void*)&p_other << " to "
+            << (void*)this);
+            p_other = Pool();
+        }
+
+        Pool& operator=(const Pool& p_other) = default;
+        Pool& operator=(Pool&& p_other)
+        {
+
+            LogDebugLine("Moving pool from " << (void*)&p_other << " to "
+            << (void*)this);
+
+            m_FreeBlock = p_other.m_FreeBlock;
+            m_Top = p_other.m_Top;
+            m_End = p_other.m_End;
+            m_CurrentPage = p_other.m_CurrentPage;
+            m_BlockSize = p_other.m_BlockSize;
+            m_BlocksPerPage = p_other.m_BlocksPerPage;
+            m_Allocate = p_other.m_Allocate;
+            m_Deallocate = p_other.m_Deallocate;
+
+            p_other.m_FreeBlock = nullptr;
+            p_other.m_Top = nullptr;
+            p_other.m_End = nullptr;
+            p_other.m_CurrentPage = nullptr;
+            p_other.m_BlockSize = 0;
+            p_other.m_BlocksPerPage = 0;
+            p_other.m_Allocate = nullptr;
+            p_other.m_Deallocate = nullptr;
+
+            return *this;
+
+        }
+
+    };
+
+
+    /**
+     * @ingroup PoolMod
+     * @brief Creates a pool at outp_pool that hands out blocks of at least
+     * p_block_size bytes from pages of p_blocks_per_page blocks, pages are
+     * allocated using p_allocate and freed using p_deallocate.
+     *
+     * @details The block size is rounded up so that each block can hold a
+     * @ref PoolBlock. The first page is allocated right away.
+     *
+     * @warning Any pool already at outp_pool is overwritten, not destroyed.
+     *
+     * If p_block_size or p_blocks_per_page is 0 or allocation of the first
+     * page fails a null pool is created at outp_pool. In the case of
+     * allocation failure p_alloc_error is also called with p_alloc_error_data,
+     * if it is not null.
+     *
+     */
+    void CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+        Pool& outp_pool,
+        const Size& p_block_size, const Size& p_blocks_per_page,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    inline void CreatePoolAtOfBlockSizeAndBlocksPerPage(
+        Pool& outp_pool,
+        const Size& p_block_size, const Size& p_blocks_per_page
+    )
+    {
+        LogDebugLine("Using defaults for CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator");
+        CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+            outp_pool, p_block_size, p_blocks_per_page,
+            g_DEFAULT_ALLOCATOR, g_DEFAULT_DEALLOCATOR,
+            g_DEFAULT_ALLOC_ERROR, g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @ingroup PoolMod
+     * @brief Used by @ref AllocateFromPool when the pool has no free blocks
+     * left, you don't need to call this yourself.
+     *
+     * @details Allocates a new page and hands out its first block. Returns
+     * null if p_pool is a null pool or if the page could not be allocated.
+     *
+     */
+    void* AllocateFromNewPageOfPool(Pool& p_pool);
+
+    /**
+     * @ingroup PoolMod
+     * @brief Allocates a single block from p_pool.
+     *
+     * @details Free blocks are handed out first, then blocks from the newest
+     * page that were never handed out. If there are neither a new page is
+     * allocated, see @ref AllocateFromNewPageOfPool.
+     *
+     * @return The allocated block or null on failure.
+     *
+     * @time O(1).
+     *
+     */
+    inline void* AllocateFromPool(Pool& p_pool)
+    {
+
+        if(p_pool.m_FreeBlock != nullptr)
+        {
+            PoolBlock* l_block = p_pool.m_FreeBlock;
+            p_pool.m_FreeBlock = l_block->m_NextBlock;
+            return l_block;
+        }
+
+        //Pages hold a whole number of blocks, so the top either points to a
+        //full block or is the end. Also covers null pools, where both are
+        //null.
+        if(p_pool.m_Top != p_pool.m_End)
+        {
+            void* l_block = p_pool.m_Top;
+            p_pool.m_Top += p_pool.m_BlockSize;
+            return l_block;
+        }
+
+        return AllocateFromNewPageOfPool(p_pool);
+
+    }
+
+    /**
+     * @ingroup PoolMod
+     * @brief Gives p_pointer back to p_pool so that it is handed out by the
+     * next allocation.
+     *
+     * @details Does nothing if p_pointer is null.
+     *
+     * @warning p_pointer must have been allocated from p_pool.
+     *
+     * @time O(1).
+     *
+     */
+    inline void DeallocateToPool(Pool& p_pool, void* p_pointer)
+    {
+
+        if(p_pointer == nullptr)
+        {
+            return;
+        }
+
+        PoolBlock* l_block = (PoolBlock*)p_pointer;
+        l_block->m_NextBlock = p_pool.m_FreeBlock;
+        p_pool.m_FreeBlock = l_block;
+
+    }
+
+    /**
+     * @ingroup PoolMod
+     * @brief Frees every page of p_pool and makes it a null pool.
+     *
+     * @warning Every block allocated from p_pool is invalid after this.
+     *
+     * @time O(n), n being the number of pages.
+     *
+     */
+    void DestroyPool(Pool& p_pool);
+
+    /**
+     * @ingroup PoolMod
+     * @brief Finds the number of pages p_pool has allocated.
+     *
+     * @time O(n), n being the number of pages.
+     *
+     */
+    Size FindNumberOfPagesInPool(const Pool& p_pool);
+
+
+    /**
+     * @ingroup PoolMod
+     * @brief A pool owned by a single thread, destroyed when that thread
+     * exits. Used by @ref GetPoolOfTypeOfThisThread.
+     *
+     */
+    struct PoolOfThisThread
+    {
+
+        Pool m_Pool;
+
+        PoolOfThisThread(const Size& p_block_size)
+        {
+            CreatePoolAtOfBlockSizeAndBlocksPerPage(
+                m_Pool, p_block_size, g_POOL_DEFAULT_BLOCKS_PER_PAGE
+            );
+        }
+        PoolOfThisThread(const PoolOfThisThread& p_other) = delete;
+        ~PoolOfThisThread()
+        {
+            DestroyPool(m_Pool);
+        }
+
+    };
+
+    /**
+     * @ingroup PoolMod
+     * @brief Returns the pool of sizeof(T) blocks of the calling thread.
+     *
+     * @details The pool is created the first time this is called on a thread
+     * and destroyed when the thread exits. Its pages are allocated with
+     * @ref g_DEFAULT_ALLOCATOR.
+     *
+     */
+    template<typename T>
+    inline Pool& GetPoolOfTypeOfThisThread()
+    {
+        thread_local PoolOfThisThread l_pool(sizeof(T));
+        return l_pool.m_Pool;
+    }
+
+    /**
+     * @ingroup PoolMod
+     * @brief An @ref Allocator that allocates a block from the sizeof(T) pool
+     * of the calling thread.
+     *
+     * @details This lets pools be used with everything in the library that
+     * takes an @ref Allocator, list nodes in particular:
+     * @code{.cpp}
+     * AddItemAfterNodeUsingAllocator(l_item, l_node, PoolMalloc<Node<int>>, nullptr, nullptr);
+     * RemoveNodeAfterNodeUsingDeallocator(l_node, PoolFree<Node<int>>);
+     * @endcode
+     *
+     * Returns null if p_size is bigger than sizeof(T) or if allocation fails.
+     *
+     * @warning Blocks must be freed with PoolFree<T> on the thread that
+     * allocated them, before that thread exits.
+     *
+     */
+    template<typename T>
+    inline void* PoolMalloc(Size p_size)
+    {
+
+        Pool& l_pool = GetPoolOfTypeOfThisThread<T>();
+
+        if(p_size > l_pool.m_BlockSize)
+        {
+            LogDebugLine("Can not allocate " << p_size << " bytes from a pool "
+            "of " << l_pool.m_BlockSize << " byte blocks, returning null.");
+            return nullptr;
+        }
+
+        return AllocateFromPool(l_pool);
+
+    }
+    /**
+     * @ingroup PoolMod
+     * @brief A @ref Deallocator that gives a block back to the sizeof(T) pool
+     * of the calling thread, see @ref PoolMalloc.
+     *
+     */
+    template<typename T>
+    inline void PoolFree(void* p_pointer)
+    {
+        DeallocateToPool(GetPoolOfTypeOfThisThread<T>(), p_pointer);
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(const Debugging::Log& p_log, const Pool& p_pool);
+    #endif //DEBUG
+
+}
+
+#endif //POOL__MEMORY_MANAGEMENT_POOL_POOL_HPP
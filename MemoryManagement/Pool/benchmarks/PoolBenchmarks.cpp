@@ -0,0 +1,137 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <vector>
+
+#include "../Pool.hpp"
+#include "../../../DataStructures/Lists/SinglyLinked/Node.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Lists::SinglyLinked;
+
+//Big enough that the list does not fit in any cache.
+static const Size g_NODE_COUNT = 1 << 20;
+
+//Builds a list of g_NODE_COUNT nodes after p_first_node. Between every node
+//some other allocation of a random size is made, like the rest of a program
+//would, and half of those are freed again afterwards. This is what scatters
+//malloc backed nodes across the heap.
+static void BuildListAfterNodeUsingAllocator(
+    Node<int>& p_first_node,
+    std::vector<void*>& outp_other_allocations,
+    Allocator p_allocate
+)
+{
+
+    srand(1);
+
+    p_first_node.m_NextNode = nullptr;
+    Node<int>* l_last = &p_first_node;
+    for(Size i = 0; i < g_NODE_COUNT; ++i)
+    {
+        l_last = AddItemAfterNodeUsingAllocator((int)i, *l_last, p_allocate, nullptr, nullptr);
+        outp_other_allocations.push_back(malloc(16 + rand() % 240));
+    }
+
+    for(Size i = 0; i < outp_other_allocations.size(); i += 2)
+    {
+        free(outp_other_allocations[i]);
+        outp_other_allocations[i] = nullptr;
+    }
+
+}
+
+static void DestroyListAfterNodeUsingDeallocator(
+    Node<int>& p_first_node,
+    std::vector<void*>& p_other_allocations,
+    Deallocator p_deallocate
+)
+{
+
+    while(p_first_node.m_NextNode != nullptr)
+    {
+        RemoveNodeAfterNodeUsingDeallocator(p_first_node, p_deallocate);
+    }
+
+    for(void* l_allocation : p_other_allocations)
+    {
+        free(l_allocation);
+    }
+    p_other_allocations.clear();
+
+}
+
+static long long SumList(const Node<int>& p_first_node)
+{
+
+    long long l_sum = 0;
+    for(Node<int>* l_node = p_first_node.m_NextNode; l_node != nullptr; l_node = l_node->m_NextNode)
+    {
+        l_sum += l_node->m_Item;
+    }
+
+    return l_sum;
+
+}
+
+TEST_CASE("Traversal of malloc and pool backed lists", "[Pool][Benchmark]")
+{
+
+    Node<int> l_firstNode;
+    std::vector<void*> l_otherAllocations;
+
+    BuildListAfterNodeUsingAllocator(l_firstNode, l_otherAllocations, malloc);
+    BENCHMARK("malloc backed list traversal")
+    {
+        return SumList(l_firstNode);
+    };
+    DestroyListAfterNodeUsingDeallocator(l_firstNode, l_otherAllocations, free);
+
+    BuildListAfterNodeUsingAllocator(l_firstNode, l_otherAllocations, PoolMalloc<Node<int>>);
+    BENCHMARK("pool backed list traversal")
+    {
+        return SumList(l_firstNode);
+    };
+    DestroyListAfterNodeUsingDeallocator(l_firstNode, l_otherAllocations, PoolFree<Node<int>>);
+
+}
+
+TEST_CASE("Building and destroying lists", "[Pool][Benchmark]")
+{
+
+    Node<int> l_firstNode;
+    l_firstNode.m_NextNode = nullptr;
+
+    BENCHMARK("malloc/free 4096 nodes")
+    {
+        Node<int>* l_last = &l_firstNode;
+        for(int i = 0; i < 4096; ++i)
+        {
+            l_last = AddItemAfterNodeUsingAllocator(i, *l_last, malloc, nullptr, nullptr);
+        }
+        int l_item = l_last->m_Item;
+        while(l_firstNode.m_NextNode != nullptr)
+        {
+            RemoveNodeAfterNodeUsingDeallocator(l_firstNode, free);
+        }
+        return l_item;
+    };
+
+    BENCHMARK("pool 4096 nodes")
+    {
+        Node<int>* l_last = &l_firstNode;
+        for(int i = 0; i < 4096; ++i)
+        {
+            l_last = AddItemAfterNodeUsingAllocator(i, *l_last, PoolMalloc<Node<int>>, nullptr, nullptr);
+        }
+        int l_item = l_last->m_Item;
+        while(l_firstNode.m_NextNode != nullptr)
+        {
+            RemoveNodeAfterNodeUsingDeallocator(l_firstNode, PoolFree<Node<int>>);
+        }
+        return l_item;
+    };
+
+}
@@ -0,0 +1,166 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../Pool.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+TEST_CASE("Default constructor", "[Pool][Member]")
+{
+
+    Pool l_pool;
+
+    CHECK(l_pool.m_FreeBlock == nullptr);
+    CHECK(l_pool.m_Top == nullptr);
+    CHECK(l_pool.m_End == nullptr);
+    CHECK(l_pool.m_CurrentPage == nullptr);
+    CHECK(l_pool.m_BlockSize == 0);
+    CHECK(l_pool.m_BlocksPerPage == 0);
+    CHECK(l_pool.m_Allocate == nullptr);
+    CHECK(l_pool.m_Deallocate == nullptr);
+
+}
+
+TEST_CASE("Moving", "[Pool][Member]")
+{
+
+    Pool l_source;
+    CreatePoolAtOfBlockSizeAndBlocksPerPage(l_source, 16, 8);
+    REQUIRE(l_source.m_CurrentPage != nullptr);
+
+    PoolPage* l_page = l_source.m_CurrentPage;
+    Byte* l_top = l_source.m_Top;
+
+    Pool l_destination;
+
+    SECTION("Constructor")
+    {
+        l_destination = Pool((Pool&&)l_source);
+    }
+    SECTION("Operator")
+    {
+        l_destination = (Pool&&)l_source;
+    }
+
+    CHECK(l_destination.m_CurrentPage == l_page);
+    CHECK(l_destination.m_Top == l_top);
+    CHECK(l_destination.m_BlockSize == 16);
+    CHECK(l_destination.m_BlocksPerPage == 8);
+
+    CHECK(l_source.m_CurrentPage == nullptr);
+    CHECK(l_source.m_Top == nullptr);
+    CHECK(l_source.m_Allocate == nullptr);
+
+    DestroyPool(l_destination);
+
+}
+
+TEST_CASE("Creation and destruction", "[Pool][Creation][Destruction]")
+{
+
+    Size l_blockSize = GENERATE(8, 16, 24, 100);
+    Size l_blocksPerPage = GENERATE(1, 3, 64);
+
+    Pool l_pool;
+
+    SECTION("Defaults")
+    {
+        CreatePoolAtOfBlockSizeAndBlocksPerPage(l_pool, l_blockSize, l_blocksPerPage);
+    }
+    SECTION("Customs")
+    {
+        bool l_called = false;
+        CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+            l_pool, l_blockSize, l_blocksPerPage,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    REQUIRE(l_pool.m_CurrentPage != nullptr);
+    CHECK(l_pool.m_CurrentPage->m_PreviousPage == nullptr);
+    CHECK(l_pool.m_FreeBlock == nullptr);
+    CHECK(l_pool.m_BlockSize >= l_blockSize);
+    CHECK(l_pool.m_BlockSize % alignof(PoolBlock) == 0);
+    CHECK(l_pool.m_BlocksPerPage == l_blocksPerPage);
+    CHECK(l_pool.m_End - l_pool.m_Top == (ptrdiff_t)(l_pool.m_BlockSize * l_blocksPerPage));
+    CHECK(FindNumberOfPagesInPool(l_pool) == 1);
+
+    DestroyPool(l_pool);
+
+    CHECK(l_pool.m_CurrentPage == nullptr);
+    CHECK(l_pool.m_Top == nullptr);
+    CHECK(l_pool.m_Allocate == nullptr);
+    CHECK(FindNumberOfPagesInPool(l_pool) == 0);
+
+}
+
+TEST_CASE("Small block sizes are rounded up", "[Pool][Creation]")
+{
+
+    Size l_blockSize = GENERATE(1, 3, 7, 9);
+
+    Pool l_pool;
+    CreatePoolAtOfBlockSizeAndBlocksPerPage(l_pool, l_blockSize, 4);
+    REQUIRE(l_pool.m_CurrentPage != nullptr);
+
+    CHECK(l_pool.m_BlockSize >= sizeof(PoolBlock));
+    CHECK(l_pool.m_BlockSize >= l_blockSize);
+    CHECK(l_pool.m_BlockSize % alignof(PoolBlock) == 0);
+
+    DestroyPool(l_pool);
+
+}
+
+TEST_CASE("Failed creation", "[Pool][Creation]")
+{
+
+    Pool l_pool;
+    bool l_called = false;
+
+    SECTION("Allocation failure")
+    {
+        CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+            l_pool, 16, 16,
+            NullMalloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == true);
+    }
+    SECTION("Overflowing page size")
+    {
+        CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+            l_pool, 1024, SIZE_MAX / 512,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == true);
+    }
+    SECTION("Zero block size")
+    {
+        CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+            l_pool, 0, 16,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+    SECTION("Zero blocks per page")
+    {
+        CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+            l_pool, 16, 0,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    CHECK(l_pool.m_CurrentPage == nullptr);
+    CHECK(l_pool.m_Allocate == nullptr);
+    CHECK(AllocateFromPool(l_pool) == nullptr);
+
+}
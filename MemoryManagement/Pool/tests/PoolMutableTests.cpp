@@ -0,0 +1,172 @@
+#include <catch2/catch.hpp>
+
+#include "../Pool.hpp"
+#include "../../../Debugging/Debugging.hpp"
+#include "../../../DataStructures/Lists/SinglyLinked/Node.hpp"
+
+#include <string.h>
+#include <thread>
+
+using namespace Library;
+using namespace Library::DataStructures::Lists::SinglyLinked;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+TEST_CASE("Allocation", "[Pool][Mutable][Allocation]")
+{
+
+    Size l_blockSize = GENERATE(8, 16, 24, 48);
+
+    Pool l_pool;
+    CreatePoolAtOfBlockSizeAndBlocksPerPage(l_pool, l_blockSize, 4);
+    REQUIRE(l_pool.m_CurrentPage != nullptr);
+
+    Byte* l_blocks[20];
+    for(Size i = 0; i < 20; ++i)
+    {
+        l_blocks[i] = (Byte*)AllocateFromPool(l_pool);
+        REQUIRE(l_blocks[i] != nullptr);
+        //Aligned to the biggest power of 2 that divides the block size.
+        Size l_alignment = l_blockSize & (~l_blockSize + 1);
+        if(l_alignment > g_POOL_ALIGNMENT)
+        {
+            l_alignment = g_POOL_ALIGNMENT;
+        }
+        CHECK((uintptr_t)l_blocks[i] % l_alignment == 0);
+        memset(l_blocks[i], (int)i, l_blockSize);
+    }
+
+    //None of the blocks overlap.
+    for(Size i = 0; i < 20; ++i)
+    {
+        for(Size n = 0; n < l_blockSize; ++n)
+        {
+            REQUIRE(l_blocks[i][n] == (Byte)i);
+        }
+    }
+
+    //Blocks of the same page are handed out one after the other.
+    CHECK(l_blocks[1] == l_blocks[0] + l_pool.m_BlockSize);
+    CHECK(l_blocks[3] == l_blocks[2] + l_pool.m_BlockSize);
+
+    CHECK(FindNumberOfPagesInPool(l_pool) == 5);
+
+    DestroyPool(l_pool);
+
+}
+
+TEST_CASE("Deallocation and reuse", "[Pool][Mutable][Deallocation]")
+{
+
+    Pool l_pool;
+    CreatePoolAtOfBlockSizeAndBlocksPerPage(l_pool, 16, 4);
+    REQUIRE(l_pool.m_CurrentPage != nullptr);
+
+    void* l_first = AllocateFromPool(l_pool);
+    void* l_second = AllocateFromPool(l_pool);
+    Byte* l_top = l_pool.m_Top;
+
+    DeallocateToPool(l_pool, l_first);
+    DeallocateToPool(l_pool, l_second);
+    DeallocateToPool(l_pool, nullptr);
+
+    //Last in, first out, and the untouched blocks are not used.
+    CHECK(AllocateFromPool(l_pool) == l_second);
+    CHECK(AllocateFromPool(l_pool) == l_first);
+    CHECK(l_pool.m_Top == l_top);
+    CHECK(l_pool.m_FreeBlock == nullptr);
+
+    CHECK(FindNumberOfPagesInPool(l_pool) == 1);
+
+    DestroyPool(l_pool);
+
+}
+
+TEST_CASE("Allocation failure of a new page", "[Pool][Mutable][Allocation]")
+{
+
+    Pool l_pool;
+    SetCountOfNullMallocAfterCount(1);
+    CreatePoolAtOfBlockSizeAndBlocksPerPageUsingAllocatorAndDeallocator(
+        l_pool, 16, 2,
+        NullMallocAfterCount, free,
+        nullptr, nullptr
+    );
+    REQUIRE(l_pool.m_CurrentPage != nullptr);
+
+    void* l_first = AllocateFromPool(l_pool);
+    CHECK(l_first != nullptr);
+    CHECK(AllocateFromPool(l_pool) != nullptr);
+    CHECK(AllocateFromPool(l_pool) == nullptr);
+    CHECK(FindNumberOfPagesInPool(l_pool) == 1);
+
+    //Freed blocks can still be handed out.
+    DeallocateToPool(l_pool, l_first);
+    CHECK(AllocateFromPool(l_pool) == l_first);
+
+    DestroyPool(l_pool);
+
+}
+
+TEST_CASE("Typed adapters", "[Pool][Mutable][Adapters]")
+{
+
+    Pool& l_pool = GetPoolOfTypeOfThisThread<Node<int>>();
+    CHECK(&l_pool == &GetPoolOfTypeOfThisThread<Node<int>>());
+    CHECK(l_pool.m_BlockSize == sizeof(Node<int>));
+    CHECK(&l_pool != &GetPoolOfTypeOfThisThread<Node<double>>());
+
+    SECTION("Too big")
+    {
+        CHECK(PoolMalloc<Node<int>>(sizeof(Node<int>) + 1) == nullptr);
+    }
+    SECTION("With singly linked nodes")
+    {
+        Node<int> l_first;
+        Node<int>* l_last = &l_first;
+        for(int i = 0; i < 10; ++i)
+        {
+            l_last = AddItemAfterNodeUsingAllocator(i, *l_last, PoolMalloc<Node<int>>, nullptr, nullptr);
+            REQUIRE(l_last != nullptr);
+        }
+
+        //Added one after the other, so the nodes are next to each other.
+        int l_expected = 0;
+        for(Node<int>* l_node = l_first.m_NextNode; l_node != nullptr; l_node = l_node->m_NextNode)
+        {
+            CHECK(l_node->m_Item == l_expected);
+            if(l_node->m_NextNode != nullptr)
+            {
+                CHECK(l_node->m_NextNode == l_node + 1);
+            }
+            ++l_expected;
+        }
+        CHECK(l_expected == 10);
+
+        Node<int>* l_second = l_first.m_NextNode;
+        while(l_first.m_NextNode != nullptr)
+        {
+            RemoveNodeAfterNodeUsingDeallocator(l_first, PoolFree<Node<int>>);
+        }
+
+        //The last freed node is reused first.
+        CHECK(l_pool.m_FreeBlock == (PoolBlock*)l_last);
+        Node<int>* l_reused = AddItemAfterNodeUsingAllocator(100, l_first, PoolMalloc<Node<int>>, nullptr, nullptr);
+        CHECK(l_reused == l_last);
+        CHECK(l_reused != l_second);
+        RemoveNodeAfterNodeUsingDeallocator(l_first, PoolFree<Node<int>>);
+    }
+    SECTION("Each thread has its own pool")
+    {
+        Pool* l_otherPool = nullptr;
+        std::thread l_thread([&l_otherPool]()
+        {
+            l_otherPool = &GetPoolOfTypeOfThisThread<Node<int>>();
+            void* l_block = PoolMalloc<Node<int>>(sizeof(Node<int>));
+            PoolFree<Node<int>>(l_block);
+        });
+        l_thread.join();
+        CHECK(l_otherPool != &l_pool);
+    }
+
+}
@@ -0,0 +1,408 @@
+/**
+ * @file StackAllocator.cpp
+ * @brief Defines everything in the @ref StackAllocatorMod module that is not
+ * defined inline in StackAllocator.hpp.
+ *
+ */
+#include "StackAllocator.hpp"
+
+namespace Library
+{
+
+    //This is where the hidden global variables are stored.
+    namespace
+    {
+        //The stack allocator used by StackMalloc, StackRealloc and StackFree.
+        thread_local StackAllocator* g_StackAllocatorOfThisThread = nullptr;
+    }
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(
+        const Debugging::Log& p_log,
+        const StackAllocator& p_stack_allocator
+    )
+    {
+
+        p_log << (void*)&p_stack_allocator;
+        p_log << " { m_CurrentChunk = " << (void*)p_stack_allocator.m_CurrentChunk;
+        p_log << ", m_Top = " << (void*)p_stack_allocator.m_Top;
+        p_log << ", m_End = " << (void*)p_stack_allocator.m_End;
+        p_log << ", m_SpareChunk = " << (void*)p_stack_allocator.m_SpareChunk;
+        p_log << ", m_ChunkSize = " << p_stack_allocator.m_ChunkSize;
+        p_log << " }";
+
+        return p_log;
+
+    }
+    #endif //DEBUG
+
+
+    //Makes p_chunk the current chunk of p_stack_allocator, with nothing
+    //allocated from it.
+    static void PushChunkToStackAllocator(
+        StackAllocator& p_stack_allocator,
+        StackAllocatorChunk* p_chunk
+    )
+    {
+        p_chunk->m_PreviousChunk = p_stack_allocator.m_CurrentChunk;
+
+        p_stack_allocator.m_CurrentChunk = p_chunk;
+        p_stack_allocator.m_Top = (Byte*)(p_chunk + 1);
+        p_stack_allocator.m_End = p_stack_allocator.m_Top + p_chunk->m_Size;
+    }
+
+    //Makes the current chunk of p_stack_allocator the spare chunk, freeing the
+    //old spare chunk, and makes the previous chunk the current one with its
+    //top at p_new_top. The current chunk must have a previous chunk.
+    static void PopChunkOfStackAllocator(
+        StackAllocator& p_stack_allocator,
+        Byte* p_new_top
+    )
+    {
+
+        StackAllocatorChunk* l_chunk = p_stack_allocator.m_CurrentChunk;
+        StackAllocatorChunk* l_previous = l_chunk->m_PreviousChunk;
+
+        LogDebugLine("Popping chunk at " << (void*)l_chunk << " of stack "
+        "allocator " << p_stack_allocator);
+
+        if(p_stack_allocator.m_SpareChunk != nullptr)
+        {
+            LogDebugLine("Deallocating old spare chunk at "
+            << (void*)p_stack_allocator.m_SpareChunk);
+            p_stack_allocator.m_Deallocate(p_stack_allocator.m_SpareChunk);
+        }
+        p_stack_allocator.m_SpareChunk = l_chunk;
+
+        p_stack_allocator.m_CurrentChunk = l_previous;
+        p_stack_allocator.m_Top = p_new_top;
+        p_stack_allocator.m_End = (Byte*)(l_previous + 1) + l_previous->m_Size;
+
+    }
+
+    //Allocates a chunk with at least p_size usable bytes and makes it the
+    //current chunk of p_stack_allocator. Returns false on failure,
+    //p_stack_allocator is not mutated in that case.
+    static bool AddChunkOfSizeToStackAllocator(
+        StackAllocator& p_stack_allocator,
+        const Size& p_size
+    )
+    {
+
+        LogDebugLine("Adding chunk of size " << p_size << " to stack allocator "
+        << p_stack_allocator);
+
+        if(p_size > SIZE_MAX - sizeof(StackAllocatorChunk))
+        {
+            LogDebugLine("The size of the chunk overflows, returning false.");
+            return false;
+        }
+
+        StackAllocatorChunk* l_chunk = (StackAllocatorChunk*)p_stack_allocator.m_Allocate(
+            sizeof(StackAllocatorChunk) + p_size
+        );
+        if(l_chunk == nullptr)
+        {
+            LogDebugLine("Allocation of the chunk failed, returning false.");
+            return false;
+        }
+
+        l_chunk->m_Size = p_size;
+        PushChunkToStackAllocator(p_stack_allocator, l_chunk);
+
+        LogDebugLine("Successfully added chunk at " << (void*)l_chunk);
+        return true;
+
+    }
+
+
+    void CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+        StackAllocator& outp_stack_allocator,
+        const Size& p_chunk_size,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    )
+    {
+
+        LogDebugLine("Creating stack allocator at " << (void*)&outp_stack_allocator
+        << " with chunk size " << p_chunk_size);
+
+        outp_stack_allocator = StackAllocator();
+
+        if(p_chunk_size == 0)
+        {
+            LogDebugLine("The chunk size is 0, leaving a null stack allocator and returning.");
+            return;
+        }
+
+        outp_stack_allocator.m_ChunkSize = p_chunk_size;
+        outp_stack_allocator.m_Allocate = p_allocate;
+        outp_stack_allocator.m_Deallocate = p_deallocate;
+
+        if(AddChunkOfSizeToStackAllocator(outp_stack_allocator, p_chunk_size) == false)
+        {
+            LogDebugLine("Could not allocate the first chunk, creating null stack allocator.");
+            outp_stack_allocator = StackAllocator();
+            if(p_alloc_error != nullptr)
+            {
+                LogDebugLine("Alloc error is not null so calling it.");
+                p_alloc_error(p_alloc_error_data);
+            }
+            return;
+        }
+
+        LogDebugLine("Successfully created stack allocator " << outp_stack_allocator);
+
+    }
+
+
+    void* AllocateFromNewChunkOfStackAllocator(
+        StackAllocator& p_stack_allocator,
+        const Size& p_size
+    )
+    {
+
+        LogDebugLine("Allocating " << p_size << " bytes from a new chunk of "
+        "stack allocator " << p_stack_allocator);
+
+        if(p_stack_allocator.m_Allocate == nullptr)
+        {
+            LogDebugLine("The stack allocator is a null stack allocator, returning null.");
+            return nullptr;
+        }
+
+        //The worst case is a full alignment of padding and the header in
+        //front of the allocation.
+        Size l_overhead = sizeof(StackAllocationHeader) + g_STACK_ALLOCATOR_ALIGNMENT;
+        if(p_size > SIZE_MAX - l_overhead)
+        {
+            LogDebugLine("The needed size overflows, returning null.");
+            return nullptr;
+        }
+
+        Size l_needed = p_size + l_overhead;
+        Byte* l_oldTop = p_stack_allocator.m_Top;
+
+        StackAllocatorChunk* l_spare = p_stack_allocator.m_SpareChunk;
+        if(l_spare != nullptr && l_spare->m_Size >= l_needed)
+        {
+            LogDebugLine("Reusing the spare chunk at " << (void*)l_spare);
+            p_stack_allocator.m_SpareChunk = nullptr;
+            PushChunkToStackAllocator(p_stack_allocator, l_spare);
+        }
+        else
+        {
+            if(l_needed < p_stack_allocator.m_ChunkSize)
+            {
+                l_needed = p_stack_allocator.m_ChunkSize;
+            }
+
+            if(AddChunkOfSizeToStackAllocator(p_stack_allocator, l_needed) == false)
+            {
+                LogDebugLine("Could not add a chunk, returning null.");
+                return nullptr;
+            }
+        }
+
+        //Guaranteed to fit, so the fast path will not recurse.
+        Byte* l_location = (Byte*)AllocateFromStackAllocator(p_stack_allocator, p_size);
+
+        //Deallocating the first allocation of a chunk goes back to the top of
+        //the previous chunk, which is also how it is recognized.
+        memcpy(
+            l_location - sizeof(StackAllocationHeader) + offsetof(StackAllocationHeader, m_PreviousTop),
+            &l_oldTop,
+            sizeof(Byte*)
+        );
+
+        return l_location;
+
+    }
+
+
+    void* ReallocateInStackAllocator(
+        StackAllocator& p_stack_allocator,
+        void* p_pointer,
+        const Size& p_size
+    )
+    {
+
+        LogDebugLine("Reallocating " << p_pointer << " to " << p_size
+        << " bytes in stack allocator " << p_stack_allocator);
+
+        if(p_pointer == nullptr)
+        {
+            LogDebugLine("The pointer is null, allocating instead.");
+            return AllocateFromStackAllocator(p_stack_allocator, p_size);
+        }
+        if(p_size == 0)
+        {
+            LogDebugLine("The new size is 0, deallocating instead.");
+            DeallocateFromStackAllocator(p_stack_allocator, p_pointer);
+            return nullptr;
+        }
+
+        Byte* l_location = (Byte*)p_pointer;
+        StackAllocationHeader l_header;
+        memcpy(&l_header, l_location - sizeof(StackAllocationHeader), sizeof(StackAllocationHeader));
+
+        //The top allocation can grow in place as long as the chunk has space.
+        if(l_location + l_header.m_Size == p_stack_allocator.m_Top)
+        {
+            if(p_size <= (Size)(p_stack_allocator.m_End - l_location))
+            {
+                LogDebugLine("Resizing the top allocation in place.");
+                l_header.m_Size = p_size;
+                memcpy(l_location - sizeof(StackAllocationHeader), &l_header, sizeof(StackAllocationHeader));
+                p_stack_allocator.m_Top = l_location + p_size;
+                return p_pointer;
+            }
+        }
+        else if(p_size <= l_header.m_Size)
+        {
+            LogDebugLine("Shrinking in place, the tail stays unused until rolled back.");
+            l_header.m_Size = p_size;
+            memcpy(l_location - sizeof(StackAllocationHeader), &l_header, sizeof(StackAllocationHeader));
+            return p_pointer;
+        }
+
+        LogDebugLine("Moving the allocation.");
+        void* l_newLocation = AllocateFromStackAllocator(p_stack_allocator, p_size);
+        if(l_newLocation == nullptr)
+        {
+            LogDebugLine("Allocation failed, returning null.");
+            return nullptr;
+        }
+
+        memcpy(l_newLocation, p_pointer, l_header.m_Size < p_size ? l_header.m_Size : p_size);
+
+        return l_newLocation;
+
+    }
+
+    void DeallocateFromStackAllocator(
+        StackAllocator& p_stack_allocator,
+        void* p_pointer
+    )
+    {
+
+        LogDebugLine("Deallocating " << p_pointer << " from stack allocator "
+        << p_stack_allocator);
+
+        if(p_pointer == nullptr)
+        {
+            return;
+        }
+
+        Byte* l_location = (Byte*)p_pointer;
+        StackAllocationHeader l_header;
+        memcpy(&l_header, l_location - sizeof(StackAllocationHeader), sizeof(StackAllocationHeader));
+
+        if(l_location + l_header.m_Size != p_stack_allocator.m_Top)
+        {
+            LogDebugLine("This is not the top allocation, it stays until rolled back.");
+            return;
+        }
+
+        //The first allocation of a chunk was made while the previous chunk was
+        //current, so its previous top is outside of the current chunk.
+        uintptr_t l_start = (uintptr_t)(p_stack_allocator.m_CurrentChunk + 1);
+        uintptr_t l_previousTop = (uintptr_t)l_header.m_PreviousTop;
+        if(l_previousTop < l_start || l_previousTop > (uintptr_t)p_stack_allocator.m_End)
+        {
+            LogDebugLine("This empties the current chunk, popping it.");
+            PopChunkOfStackAllocator(p_stack_allocator, l_header.m_PreviousTop);
+            return;
+        }
+
+        LogDebugLine("This is the top allocation, giving it back.");
+        p_stack_allocator.m_Top = l_header.m_PreviousTop;
+
+    }
+
+
+    void RollBackStackAllocatorToMarker(
+        StackAllocator& p_stack_allocator,
+        const StackAllocatorMarker& p_marker
+    )
+    {
+
+        LogDebugLine("Rolling back stack allocator " << p_stack_allocator
+        << " to the marker { m_Chunk = " << (void*)p_marker.m_Chunk
+        << ", m_Top = " << (void*)p_marker.m_Top << " }");
+
+        if(p_stack_allocator.m_CurrentChunk == nullptr)
+        {
+            LogDebugLine("Null stack allocator, nothing to roll back.");
+            return;
+        }
+
+        while(p_stack_allocator.m_CurrentChunk != p_marker.m_Chunk)
+        {
+            PopChunkOfStackAllocator(p_stack_allocator, p_marker.m_Top);
+        }
+
+        p_stack_allocator.m_Top = p_marker.m_Top;
+
+    }
+
+    void DestroyStackAllocator(StackAllocator& p_stack_allocator)
+    {
+
+        LogDebugLine("Destroying stack allocator " << p_stack_allocator);
+
+        StackAllocatorChunk* l_chunk = p_stack_allocator.m_CurrentChunk;
+        while(l_chunk != nullptr)
+        {
+            StackAllocatorChunk* l_previous = l_chunk->m_PreviousChunk;
+            LogDebugLine("Deallocating chunk at " << (void*)l_chunk);
+            p_stack_allocator.m_Deallocate(l_chunk);
+            l_chunk = l_previous;
+        }
+        if(p_stack_allocator.m_SpareChunk != nullptr)
+        {
+            LogDebugLine("Deallocating spare chunk at " << (void*)p_stack_allocator.m_SpareChunk);
+            p_stack_allocator.m_Deallocate(p_stack_allocator.m_SpareChunk);
+        }
+
+        p_stack_allocator = StackAllocator();
+
+    }
+
+
+    void SetStackAllocatorOfThisThread(StackAllocator* p_stack_allocator)
+    {
+        g_StackAllocatorOfThisThread = p_stack_allocator;
+    }
+    StackAllocator* GetStackAllocatorOfThisThread()
+    {
+        return g_StackAllocatorOfThisThread;
+    }
+
+    void* StackMalloc(Size p_size)
+    {
+        if(g_StackAllocatorOfThisThread == nullptr)
+        {
+            return nullptr;
+        }
+        return AllocateFromStackAllocator(*g_StackAllocatorOfThisThread, p_size);
+    }
+    void* StackRealloc(void* p_pointer, Size p_size)
+    {
+        if(g_StackAllocatorOfThisThread == nullptr)
+        {
+            return nullptr;
+        }
+        return ReallocateInStackAllocator(*g_StackAllocatorOfThisThread, p_pointer, p_size);
+    }
+    void StackFree(void* p_pointer)
+    {
+        if(g_StackAllocatorOfThisThread == nullptr)
+        {
+            return;
+        }
+        DeallocateFromStackAllocator(*g_StackAllocatorOfThisThread, p_pointer);
+    }
+
+}
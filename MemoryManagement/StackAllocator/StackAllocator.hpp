@@ -0,0 +1,556 @@
+/**
+ * @file StackAllocator.hpp
+ * @brief Declares everything in the @ref StackAllocatorMod module.
+ *
+ * @details The fast path of stack allocation, saving markers and the scoped
+ * marker are defined inline in this file, everything else is defined in
+ * StackAllocator.cpp.
+ *
+ */
+#ifndef STACK_ALLOCATOR__MEMORY_MANAGEMENT_STACK_ALLOCATOR_STACK_ALLOCATOR_HPP
+#define STACK_ALLOCATOR__MEMORY_MANAGEMENT_STACK_ALLOCATOR_STACK_ALLOCATOR_HPP
+
+#include "../../Meta/Meta.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+//Included for memcpy
+#include <string.h>
+
+namespace Library
+{
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief The alignment of every location given out by a stack allocator.
+     *
+     * @details This is the same alignment that malloc gives, so that memory
+     * from a stack allocator can be used for any type.
+     *
+     */
+    constexpr Size g_STACK_ALLOCATOR_ALIGNMENT = alignof(max_align_t);
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief The header of a single chunk of memory owned by a stack
+     * allocator.
+     *
+     * @details Chunks are allocated with the stack allocator's allocator, the
+     * header is placed at the start of the chunk and the usable memory right
+     * after it. Chunks form a singly linked chain from the newest to the
+     * oldest chunk.
+     *
+     */
+    struct alignas(g_STACK_ALLOCATOR_ALIGNMENT) StackAllocatorChunk
+    {
+
+        /**
+         * @brief The chunk that was allocated before this one, null if this
+         * is the oldest chunk.
+         *
+         */
+        StackAllocatorChunk* m_PreviousChunk;
+        /**
+         * @brief The number of usable bytes after the header.
+         *
+         */
+        Size m_Size;
+
+    };
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief The header placed right before every allocation of a stack
+     * allocator.
+     *
+     * @details It may not be aligned, so it is always accessed with memcpy.
+     *
+     */
+    struct StackAllocationHeader
+    {
+
+        /**
+         * @brief The top of the stack allocator before this allocation was
+         * made, deallocating this allocation sets the top back to it.
+         *
+         */
+        Byte* m_PreviousTop;
+        /**
+         * @brief The number of bytes that were requested.
+         *
+         */
+        Size m_Size;
+
+    };
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief A position in a stack allocator that it can be rolled back to.
+     *
+     * @details Made by @ref SaveMarkerOfStackAllocator and used by
+     * @ref RollBackStackAllocatorToMarker.
+     *
+     */
+    struct StackAllocatorMarker
+    {
+
+        /**
+         * @brief The current chunk at the time the marker was saved.
+         *
+         */
+        StackAllocatorChunk* m_Chunk;
+        /**
+         * @brief The top at the time the marker was saved.
+         *
+         */
+        Byte* m_Top;
+
+    };
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief An allocator that hands out memory in last in first out order.
+     *
+     * @details Like an @ref Arena "arena" a stack allocator owns a chain of
+     * chunks and allocation moves @ref m_Top forward inside of the newest one.
+     * Unlike an arena each allocation remembers the top from before it was
+     * made, so allocations deallocated in the reverse order of their
+     * allocation are all given back, even across chunks.
+     *
+     * Everything allocated after a @ref StackAllocatorMarker "marker" was
+     * saved can be released at once with @ref RollBackStackAllocatorToMarker,
+     * or automatically at the end of a scope using a
+     * @ref ScopedStackAllocatorMarker.
+     *
+     * Chunks emptied by deallocation or rollback are given back to the
+     * deallocator, except for the last one, which is kept in
+     * @ref m_SpareChunk so that code that keeps crossing the end of a chunk
+     * does not allocate and free a chunk every time.
+     *
+     * Stack allocators are not thread safe, each thread should use its own.
+     *
+     * @section StackAllocatorTypes Types of stack allocators
+     * - Null stack allocator, every field is null or 0. Allocating from it
+     * always fails. This is what the default constructor makes.
+     * - Valid stack allocator, created using
+     * @ref CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator.
+     *
+     */
+    struct StackAllocator
+    {
+
+        /**
+         * @brief The newest chunk, all allocations are done from this chunk.
+         *
+         */
+        StackAllocatorChunk* m_CurrentChunk;
+        /**
+         * @brief The first free byte in @ref m_CurrentChunk.
+         *
+         */
+        Byte* m_Top;
+        /**
+         * @brief One past the last usable byte in @ref m_CurrentChunk.
+         *
+         */
+        Byte* m_End;
+        /**
+         * @brief The last chunk that was emptied, null if there is none.
+         *
+         */
+        StackAllocatorChunk* m_SpareChunk;
+        /**
+         * @brief The minimum number of usable bytes in each new chunk.
+         *
+         */
+        Size m_ChunkSize;
+
+        /**
+         * @brief Used for allocating new chunks.
+         *
+         */
+        void* (*m_Allocate) (Size);
+        /**
+         * @brief Used for freeing chunks.
+         *
+         */
+        void (*m_Deallocate) (void*);
+
+
+        /**
+         * @brief Constructs a null stack allocator.
+         *
+         */
+        StackAllocator():
+        m_CurrentChunk(nullptr),
+        m_Top(nullptr),
+        m_End(nullptr),
+        m_SpareChunk(nullptr),
+        m_ChunkSize(0),
+        m_Allocate(nullptr),
+        m_Deallocate(nullptr)
+        {
+            LogDebugLine("Constructed null stack allocator at " << (void*)this);
+        }
+
+        /**
+         * @brief Copies every field from p_other, the chunks are shared.
+         *
+         * @warning Only one of the two stack allocators should ever be used
+         * after this.
+         *
+         */
+        StackAllocator(const StackAllocator& p_other) = default;
+        /**
+         * @brief Copies every field from p_other and then makes p_other a null
+         * stack allocator.
+         *
+         */
+        StackAllocator(StackAllocator&& p_other):
+        m_CurrentChunk(p_other.m_CurrentChunk),
+        m_Top(p_other.m_Top),
+        m_End(p_other.m_End),
+        m_SpareChunk(p_other.m_SpareChunk),
+        m_ChunkSize(p_other.m_ChunkSize),
+        m_Allocate(p_other.m_Allocate),
+        m_Deallocate(p_other.m_Deallocate)
+        {
+            LogDebugLine("Moved stack allocator from " << (void*)&p_other
+            << " to " << (void*)this);
+            p_other = StackAllocator();
+        }
+
+        StackAllocator& operator=(const StackAllocator& p_other) = default;
+        StackAllocator& operator=(StackAllocator&& p_other)
+        {
+
+            LogDebugLine("Moving stack allocator from " << (void*)&p_other
+            << " to " << (void*)this);
+
+            m_CurrentChunk = p_other.m_CurrentChunk;
+            m_Top = p_other.m_Top;
+            m_End = p_other.m_End;
+            m_SpareChunk = p_other.m_SpareChunk;
+            m_ChunkSize = p_other.m_ChunkSize;
+            m_Allocate = p_other.m_Allocate;
+            m_Deallocate = p_other.m_Deallocate;
+
+            p_other.m_CurrentChunk = nullptr;
+            p_other.m_Top = nullptr;
+            p_other.m_End = nullptr;
+            p_other.m_SpareChunk = nullptr;
+            p_other.m_ChunkSize = 0;
+            p_other.m_Allocate = nullptr;
+            p_other.m_Deallocate = nullptr;
+
+            return *this;
+
+        }
+
+    };
+
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Creates a stack allocator at outp_stack_allocator that allocates
+     * chunks of at least p_chunk_size bytes using p_allocate and frees them
+     * using p_deallocate.
+     *
+     * @details The first chunk is allocated right away.
+     *
+     * @warning Any stack allocator already at outp_stack_allocator is
+     * overwritten, not destroyed.
+     *
+     * If p_chunk_size is 0 or allocation of the first chunk fails a null stack
+     * allocator is created at outp_stack_allocator. In the case of allocation
+     * failure p_alloc_error is also called with p_alloc_error_data, if it is
+     * not null.
+     *
+     */
+    void CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+        StackAllocator& outp_stack_allocator,
+        const Size& p_chunk_size,
+        Allocator p_allocate, Deallocator p_deallocate,
+        Callback p_alloc_error, void* p_alloc_error_data
+    );
+    inline void CreateStackAllocatorAtOfChunkSize(
+        StackAllocator& outp_stack_allocator,
+        const Size& p_chunk_size
+    )
+    {
+        LogDebugLine("Using defaults for CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator");
+        CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+            outp_stack_allocator, p_chunk_size,
+            g_DEFAULT_ALLOCATOR, g_DEFAULT_DEALLOCATOR,
+            g_DEFAULT_ALLOC_ERROR, g_DEFAULT_ALLOC_ERROR_DATA
+        );
+    }
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Used by @ref AllocateFromStackAllocator when the current chunk is
+     * out of space, you don't need to call this yourself.
+     *
+     * @details Switches to the spare chunk if it is big enough, otherwise
+     * allocates a new chunk big enough for p_size bytes, and then allocates
+     * from it. Returns null if p_stack_allocator is a null stack allocator or
+     * if the chunk could not be allocated.
+     *
+     */
+    void* AllocateFromNewChunkOfStackAllocator(
+        StackAllocator& p_stack_allocator,
+        const Size& p_size
+    );
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Allocates p_size bytes from p_stack_allocator, behaves like
+     * malloc.
+     *
+     * @details The returned location is aligned to
+     * @ref g_STACK_ALLOCATOR_ALIGNMENT. If the current chunk does not have
+     * enough space a new one is used, see
+     * @ref AllocateFromNewChunkOfStackAllocator.
+     *
+     * @return The allocated location or null on failure.
+     *
+     * @time O(1), the fast path is just a pointer bump.
+     *
+     */
+    inline void* AllocateFromStackAllocator(
+        StackAllocator& p_stack_allocator,
+        const Size& p_size
+    )
+    {
+
+        //The header goes right before the aligned location.
+        uintptr_t l_location =
+            (
+                (uintptr_t)p_stack_allocator.m_Top +
+                sizeof(StackAllocationHeader) +
+                (g_STACK_ALLOCATOR_ALIGNMENT - 1)
+            )
+            & ~(uintptr_t)(g_STACK_ALLOCATOR_ALIGNMENT - 1);
+
+        //Also covers null stack allocators, where m_End is null.
+        if(
+            l_location > (uintptr_t)p_stack_allocator.m_End ||
+            p_size > (uintptr_t)p_stack_allocator.m_End - l_location
+        )
+        {
+            return AllocateFromNewChunkOfStackAllocator(p_stack_allocator, p_size);
+        }
+
+        StackAllocationHeader l_header{p_stack_allocator.m_Top, p_size};
+        memcpy(
+            (Byte*)l_location - sizeof(StackAllocationHeader),
+            &l_header,
+            sizeof(StackAllocationHeader)
+        );
+        p_stack_allocator.m_Top = (Byte*)l_location + p_size;
+
+        return (void*)l_location;
+
+    }
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Changes the size of a location allocated from p_stack_allocator,
+     * behaves like realloc.
+     *
+     * @details If p_pointer is the top allocation and the current chunk has
+     * enough space, it is resized in place. Shrinking is always done in place.
+     * In any other case a new location is allocated and the old bytes are
+     * copied over, the old location stays allocated until it is rolled back.
+     *
+     * If p_pointer is null this is the same as
+     * @ref AllocateFromStackAllocator. If p_size is 0 p_pointer is deallocated
+     * and null is returned.
+     *
+     * @warning p_pointer must have been allocated from p_stack_allocator.
+     *
+     */
+    void* ReallocateInStackAllocator(
+        StackAllocator& p_stack_allocator,
+        void* p_pointer,
+        const Size& p_size
+    );
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Deallocates p_pointer from p_stack_allocator, behaves like free.
+     *
+     * @details If p_pointer is the top allocation the top is set back to what
+     * it was before p_pointer was allocated, if that empties the current chunk
+     * the previous chunk becomes the current one again. Anything else stays
+     * allocated until it is rolled back or p_stack_allocator is destroyed.
+     *
+     * @time O(1)
+     *
+     */
+    void DeallocateFromStackAllocator(
+        StackAllocator& p_stack_allocator,
+        void* p_pointer
+    );
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Returns a marker of the current top of p_stack_allocator.
+     *
+     * @time O(1)
+     *
+     */
+    inline StackAllocatorMarker SaveMarkerOfStackAllocator(
+        const StackAllocator& p_stack_allocator
+    )
+    {
+        return StackAllocatorMarker{
+            p_stack_allocator.m_CurrentChunk,
+            p_stack_allocator.m_Top
+        };
+    }
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Frees every allocation made from p_stack_allocator after
+     * p_marker was saved.
+     *
+     * @details Chunks made after p_marker was saved are given back to the
+     * deallocator, except for one that is kept as the spare chunk.
+     *
+     * @warning Every location allocated from p_stack_allocator after p_marker
+     * was saved is invalid after this. p_marker must have been saved from
+     * p_stack_allocator and it must not have been rolled back past already,
+     * markers are rolled back to in the reverse order of saving them.
+     *
+     * @time O(1) if no chunks were added since p_marker was saved, O(n)
+     * otherwise, n being the number of chunks added.
+     *
+     */
+    void RollBackStackAllocatorToMarker(
+        StackAllocator& p_stack_allocator,
+        const StackAllocatorMarker& p_marker
+    );
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Frees every chunk of p_stack_allocator, including the spare
+     * chunk, and makes it a null stack allocator.
+     *
+     */
+    void DestroyStackAllocator(StackAllocator& p_stack_allocator);
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Finds the number of bytes currently handed out from the current
+     * chunk of p_stack_allocator, including headers and padding.
+     *
+     */
+    inline Size FindNumberOfUsedBytesInCurrentChunkOfStackAllocator(
+        const StackAllocator& p_stack_allocator
+    )
+    {
+        if(p_stack_allocator.m_CurrentChunk == nullptr)
+        {
+            return 0;
+        }
+        return p_stack_allocator.m_Top - (Byte*)(p_stack_allocator.m_CurrentChunk + 1);
+    }
+
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Saves a marker of a stack allocator when constructed and rolls
+     * the stack allocator back to it when destroyed.
+     *
+     * @details This is the stack allocator version of @ref ScopedObject,
+     * instead of destroying one object at the end of the scope everything
+     * allocated from the stack allocator inside of the scope is released at
+     * once:
+     * @code{.cpp}
+     * {
+     *     ScopedStackAllocatorMarker l_scope(l_stackAllocator);
+     *     CreateArrayAtOfCapacityUsingAllocator(l_array, 16, StackMalloc, nullptr, nullptr);
+     *     //No destruction of l_array is needed.
+     * }
+     * @endcode
+     *
+     * Can not be copied or moved, since that would roll back twice.
+     *
+     */
+    struct ScopedStackAllocatorMarker
+    {
+
+        StackAllocator& m_StackAllocator;
+        StackAllocatorMarker m_Marker;
+
+        ScopedStackAllocatorMarker(StackAllocator& p_stack_allocator):
+            m_StackAllocator(p_stack_allocator),
+            m_Marker(SaveMarkerOfStackAllocator(p_stack_allocator))
+        { }
+
+        ScopedStackAllocatorMarker(const ScopedStackAllocatorMarker& p_other) = delete;
+        ScopedStackAllocatorMarker& operator= (const ScopedStackAllocatorMarker& p_other) = delete;
+
+        ~ScopedStackAllocatorMarker()
+        {
+            RollBackStackAllocatorToMarker(m_StackAllocator, m_Marker);
+        }
+
+    };
+
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Sets the stack allocator used by @ref StackMalloc,
+     * @ref StackRealloc and @ref StackFree on the calling thread.
+     *
+     * @details Each thread has its own stack allocator pointer, the default is
+     * null, which makes @ref StackMalloc always fail.
+     *
+     */
+    void SetStackAllocatorOfThisThread(StackAllocator* p_stack_allocator);
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief Returns the stack allocator set by
+     * @ref SetStackAllocatorOfThisThread for the calling thread.
+     *
+     */
+    StackAllocator* GetStackAllocatorOfThisThread();
+
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief An @ref Allocator that allocates from the stack allocator of the
+     * calling thread.
+     *
+     * @details This lets stack allocators be used with everything in the
+     * library that takes an @ref Allocator. Returns null if the calling thread
+     * does not have a stack allocator.
+     *
+     */
+    void* StackMalloc(Size p_size);
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief A @ref Reallocator that reallocates in the stack allocator of the
+     * calling thread, see @ref ReallocateInStackAllocator.
+     *
+     */
+    void* StackRealloc(void* p_pointer, Size p_size);
+    /**
+     * @ingroup StackAllocatorMod
+     * @brief A @ref Deallocator that deallocates from the stack allocator of
+     * the calling thread, see @ref DeallocateFromStackAllocator.
+     *
+     */
+    void StackFree(void* p_pointer);
+
+
+    #ifdef DEBUG
+    const Debugging::Log& operator<<(
+        const Debugging::Log& p_log,
+        const StackAllocator& p_stack_allocator
+    );
+    #endif //DEBUG
+
+}
+
+#endif //STACK_ALLOCATOR__MEMORY_MANAGEMENT_STACK_ALLOCATOR_STACK_ALLOCATOR_HPP
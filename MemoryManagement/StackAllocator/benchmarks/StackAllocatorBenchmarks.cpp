@@ -0,0 +1,102 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+
+#include "../StackAllocator.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+#include "../../../DataStructures/Lists/SinglyLinked/Node.hpp"
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::Lists::SinglyLinked;
+
+//A simulated request is parsed in parts, everything made for a part is
+//temporary.
+static const Size g_PARTS_PER_REQUEST = 16;
+static const Size g_STRINGS_PER_PART = 8;
+static const Size g_NODES_PER_PART = 16;
+
+//Builds everything a part needs using the given memory functions. The result
+//is summed up so that the compiler can not throw the work away.
+static int ParsePartUsingAllocatorAndReallocator(
+    Array<char>* p_strings,
+    Node<int>& p_first_node,
+    Allocator p_allocate, Reallocator p_reallocate
+)
+{
+
+    int l_sum = 0;
+
+    //Strings grow a couple of times, just like when they are being parsed.
+    for(Size i = 0; i < g_STRINGS_PER_PART; ++i)
+    {
+        CreateArrayAtOfCapacityUsingAllocator(p_strings[i], 8, p_allocate, nullptr, nullptr);
+        ResizeArrayToCapacityUsingReallocator(p_strings[i], 24, p_reallocate, nullptr, nullptr);
+        ResizeArrayToCapacityUsingReallocator(p_strings[i], 72, p_reallocate, nullptr, nullptr);
+        p_strings[i].m_Buffer[71] = (char)i;
+        l_sum += p_strings[i].m_Buffer[71];
+    }
+
+    p_first_node.m_NextNode = nullptr;
+    for(Size i = 0; i < g_NODES_PER_PART; ++i)
+    {
+        AddItemAfterNodeUsingAllocator((int)i, p_first_node, p_allocate, nullptr, nullptr);
+    }
+    l_sum += p_first_node.m_NextNode->m_Item;
+
+    return l_sum;
+
+}
+
+TEST_CASE("Per object free against scoped rollback", "[StackAllocator][Benchmark]")
+{
+
+    Array<char> l_strings[g_STRINGS_PER_PART];
+    Node<int> l_firstNode;
+
+    BENCHMARK("malloc/free per object")
+    {
+        int l_sum = 0;
+        for(Size n = 0; n < g_PARTS_PER_REQUEST; ++n)
+        {
+            l_sum += ParsePartUsingAllocatorAndReallocator(
+                l_strings, l_firstNode, malloc, realloc
+            );
+
+            for(Size i = 0; i < g_STRINGS_PER_PART; ++i)
+            {
+                DestroyArrayUsingDeallocator(l_strings[i], free);
+            }
+            while(l_firstNode.m_NextNode != nullptr)
+            {
+                RemoveNodeAfterNodeUsingDeallocator(l_firstNode, free);
+            }
+        }
+        return l_sum;
+    };
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 64 * 1024);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+    SetStackAllocatorOfThisThread(&l_stackAllocator);
+
+    BENCHMARK("scoped stack allocator rollback")
+    {
+        ScopedStackAllocatorMarker l_requestScope(l_stackAllocator);
+        int l_sum = 0;
+        for(Size n = 0; n < g_PARTS_PER_REQUEST; ++n)
+        {
+            ScopedStackAllocatorMarker l_partScope(l_stackAllocator);
+            l_sum += ParsePartUsingAllocatorAndReallocator(
+                l_strings, l_firstNode, StackMalloc, StackRealloc
+            );
+        }
+        return l_sum;
+    };
+
+    SetStackAllocatorOfThisThread(nullptr);
+    DestroyStackAllocator(l_stackAllocator);
+
+}
@@ -0,0 +1,129 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../StackAllocator.hpp"
+#include "../../../Debugging/Debugging.hpp"
+
+using namespace Library;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+TEST_CASE("Default constructor", "[StackAllocator][Member]")
+{
+
+    StackAllocator l_stackAllocator;
+
+    CHECK(l_stackAllocator.m_CurrentChunk == nullptr);
+    CHECK(l_stackAllocator.m_Top == nullptr);
+    CHECK(l_stackAllocator.m_End == nullptr);
+    CHECK(l_stackAllocator.m_SpareChunk == nullptr);
+    CHECK(l_stackAllocator.m_ChunkSize == 0);
+    CHECK(l_stackAllocator.m_Allocate == nullptr);
+    CHECK(l_stackAllocator.m_Deallocate == nullptr);
+
+}
+
+TEST_CASE("Moving", "[StackAllocator][Member]")
+{
+
+    StackAllocator l_source;
+    CreateStackAllocatorAtOfChunkSize(l_source, 256);
+    REQUIRE(l_source.m_CurrentChunk != nullptr);
+
+    StackAllocatorChunk* l_chunk = l_source.m_CurrentChunk;
+    Byte* l_top = l_source.m_Top;
+
+    StackAllocator l_destination;
+
+    SECTION("Constructor")
+    {
+        l_destination = StackAllocator((StackAllocator&&)l_source);
+    }
+    SECTION("Operator")
+    {
+        l_destination = (StackAllocator&&)l_source;
+    }
+
+    CHECK(l_destination.m_CurrentChunk == l_chunk);
+    CHECK(l_destination.m_Top == l_top);
+    CHECK(l_destination.m_ChunkSize == 256);
+
+    CHECK(l_source.m_CurrentChunk == nullptr);
+    CHECK(l_source.m_Top == nullptr);
+    CHECK(l_source.m_Allocate == nullptr);
+
+    DestroyStackAllocator(l_destination);
+
+}
+
+TEST_CASE("Creation and destruction", "[StackAllocator][Creation][Destruction]")
+{
+
+    Size l_chunkSize = GENERATE(1, 16, 1000, 4096);
+
+    StackAllocator l_stackAllocator;
+
+    SECTION("Defaults")
+    {
+        CreateStackAllocatorAtOfChunkSize(l_stackAllocator, l_chunkSize);
+    }
+    SECTION("Customs")
+    {
+        bool l_called = false;
+        CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+            l_stackAllocator, l_chunkSize,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+    CHECK(l_stackAllocator.m_CurrentChunk->m_PreviousChunk == nullptr);
+    CHECK(l_stackAllocator.m_CurrentChunk->m_Size == l_chunkSize);
+    CHECK(l_stackAllocator.m_End - l_stackAllocator.m_Top == (ptrdiff_t)l_chunkSize);
+    CHECK(l_stackAllocator.m_SpareChunk == nullptr);
+    CHECK(FindNumberOfUsedBytesInCurrentChunkOfStackAllocator(l_stackAllocator) == 0);
+
+    DestroyStackAllocator(l_stackAllocator);
+
+    CHECK(l_stackAllocator.m_CurrentChunk == nullptr);
+    CHECK(l_stackAllocator.m_Top == nullptr);
+    CHECK(l_stackAllocator.m_Allocate == nullptr);
+
+}
+
+TEST_CASE("Failed creation", "[StackAllocator][Creation]")
+{
+
+    StackAllocator l_stackAllocator;
+    bool l_called = false;
+
+    SECTION("Allocation failure")
+    {
+        CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+            l_stackAllocator, 100,
+            NullMalloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == true);
+    }
+    SECTION("Zero chunk size")
+    {
+        CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+            l_stackAllocator, 0,
+            malloc, free,
+            &GeneralErrorCallback, &l_called
+        );
+        CHECK(l_called == false);
+    }
+
+    CHECK(l_stackAllocator.m_CurrentChunk == nullptr);
+    CHECK(l_stackAllocator.m_Allocate == nullptr);
+    CHECK(AllocateFromStackAllocator(l_stackAllocator, 1) == nullptr);
+
+    //Rolling back a null stack allocator does nothing.
+    RollBackStackAllocatorToMarker(l_stackAllocator, SaveMarkerOfStackAllocator(l_stackAllocator));
+    CHECK(l_stackAllocator.m_Top == nullptr);
+
+}
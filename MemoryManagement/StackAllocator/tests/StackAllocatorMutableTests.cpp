@@ -0,0 +1,314 @@
+#include <catch2/catch.hpp>
+
+#include "../StackAllocator.hpp"
+#include "../../../Debugging/Debugging.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+#include "../../../DataStructures/Lists/SinglyLinked/Node.hpp"
+
+using namespace Library;
+using namespace Debugging;
+using namespace Library::DataStructures::Array;
+using namespace Library::DataStructures::Lists::SinglyLinked;
+using namespace Catch::Generators;
+
+TEST_CASE("Allocation", "[StackAllocator][Mutable][Allocation]")
+{
+
+    Size l_size = GENERATE(1, 7, 16, 33, 100, 5000);
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 1024);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+
+    Byte* l_locations[20];
+    for(Size i = 0; i < 20; ++i)
+    {
+        l_locations[i] = (Byte*)AllocateFromStackAllocator(l_stackAllocator, l_size);
+        REQUIRE(l_locations[i] != nullptr);
+        CHECK((uintptr_t)l_locations[i] % g_STACK_ALLOCATOR_ALIGNMENT == 0);
+        memset(l_locations[i], (int)i, l_size);
+    }
+
+    //None of the allocations overlap.
+    for(Size i = 0; i < 20; ++i)
+    {
+        for(Size n = 0; n < l_size; ++n)
+        {
+            REQUIRE(l_locations[i][n] == (Byte)i);
+        }
+    }
+
+    DestroyStackAllocator(l_stackAllocator);
+
+}
+
+TEST_CASE("Allocation failure of a new chunk", "[StackAllocator][Mutable][Allocation]")
+{
+
+    StackAllocator l_stackAllocator;
+    SetCountOfNullMallocAfterCount(1);
+    CreateStackAllocatorAtOfChunkSizeUsingAllocatorAndDeallocator(
+        l_stackAllocator, 64,
+        NullMallocAfterCount, free,
+        nullptr, nullptr
+    );
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+
+    Byte* l_oldTop = l_stackAllocator.m_Top;
+    CHECK(AllocateFromStackAllocator(l_stackAllocator, 1000) == nullptr);
+    CHECK(l_stackAllocator.m_Top == l_oldTop);
+    CHECK(AllocateFromStackAllocator(l_stackAllocator, 8) != nullptr);
+
+    DestroyStackAllocator(l_stackAllocator);
+
+}
+
+TEST_CASE("Last in first out deallocation", "[StackAllocator][Mutable][Deallocation]")
+{
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 128);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+
+    StackAllocatorChunk* l_firstChunk = l_stackAllocator.m_CurrentChunk;
+    Byte* l_firstTop = l_stackAllocator.m_Top;
+
+    //Enough to cross into a couple of new chunks.
+    void* l_locations[20];
+    for(Size i = 0; i < 20; ++i)
+    {
+        l_locations[i] = AllocateFromStackAllocator(l_stackAllocator, 24);
+        REQUIRE(l_locations[i] != nullptr);
+    }
+    CHECK(l_stackAllocator.m_CurrentChunk != l_firstChunk);
+
+    SECTION("Out of order deallocation keeps the top")
+    {
+        Byte* l_top = l_stackAllocator.m_Top;
+        DeallocateFromStackAllocator(l_stackAllocator, l_locations[3]);
+        CHECK(l_stackAllocator.m_Top == l_top);
+        DeallocateFromStackAllocator(l_stackAllocator, nullptr);
+        CHECK(l_stackAllocator.m_Top == l_top);
+    }
+    SECTION("In order deallocation gives everything back")
+    {
+        for(Size i = 20; i > 0; --i)
+        {
+            DeallocateFromStackAllocator(l_stackAllocator, l_locations[i - 1]);
+        }
+        CHECK(l_stackAllocator.m_CurrentChunk == l_firstChunk);
+        CHECK(l_stackAllocator.m_Top == l_firstTop);
+        CHECK(l_stackAllocator.m_End == l_firstTop + 128);
+        CHECK(l_stackAllocator.m_SpareChunk != nullptr);
+
+        //The spare chunk is used again.
+        StackAllocatorChunk* l_spare = l_stackAllocator.m_SpareChunk;
+        for(Size i = 0; i < 20; ++i)
+        {
+            REQUIRE(AllocateFromStackAllocator(l_stackAllocator, 24) != nullptr);
+        }
+        CHECK(l_stackAllocator.m_SpareChunk != l_spare);
+    }
+
+    DestroyStackAllocator(l_stackAllocator);
+
+}
+
+TEST_CASE("Reallocation", "[StackAllocator][Mutable][Reallocation]")
+{
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 1024);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+
+    Byte* l_first = (Byte*)AllocateFromStackAllocator(l_stackAllocator, 16);
+    REQUIRE(l_first != nullptr);
+    memset(l_first, 1, 16);
+
+    SECTION("Top allocation grows in place")
+    {
+        Byte* l_new = (Byte*)ReallocateInStackAllocator(l_stackAllocator, l_first, 100);
+        CHECK(l_new == l_first);
+        CHECK(l_stackAllocator.m_Top == l_first + 100);
+        for(Size i = 0; i < 16; ++i)
+        {
+            CHECK(l_new[i] == 1);
+        }
+    }
+    SECTION("Other allocations are moved")
+    {
+        Byte* l_second = (Byte*)AllocateFromStackAllocator(l_stackAllocator, 16);
+        REQUIRE(l_second != nullptr);
+        Byte* l_new = (Byte*)ReallocateInStackAllocator(l_stackAllocator, l_first, 100);
+        REQUIRE(l_new != nullptr);
+        CHECK(l_new != l_first);
+        for(Size i = 0; i < 16; ++i)
+        {
+            CHECK(l_new[i] == 1);
+        }
+    }
+    SECTION("Shrinking is in place")
+    {
+        CHECK(ReallocateInStackAllocator(l_stackAllocator, l_first, 4) == l_first);
+    }
+    SECTION("Growing past the chunk")
+    {
+        Byte* l_new = (Byte*)ReallocateInStackAllocator(l_stackAllocator, l_first, 5000);
+        REQUIRE(l_new != nullptr);
+        CHECK(l_new != l_first);
+        for(Size i = 0; i < 16; ++i)
+        {
+            CHECK(l_new[i] == 1);
+        }
+    }
+    SECTION("Null pointer")
+    {
+        CHECK(ReallocateInStackAllocator(l_stackAllocator, nullptr, 10) != nullptr);
+    }
+    SECTION("Zero size")
+    {
+        CHECK(ReallocateInStackAllocator(l_stackAllocator, l_first, 0) == nullptr);
+        CHECK(FindNumberOfUsedBytesInCurrentChunkOfStackAllocator(l_stackAllocator) == 0);
+    }
+
+    DestroyStackAllocator(l_stackAllocator);
+
+}
+
+TEST_CASE("Rolling back to markers", "[StackAllocator][Mutable][Markers]")
+{
+
+    Size l_size = GENERATE(8, 100, 3000);
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 1024);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+
+    Byte* l_kept = (Byte*)AllocateFromStackAllocator(l_stackAllocator, 32);
+    REQUIRE(l_kept != nullptr);
+    memset(l_kept, 7, 32);
+
+    StackAllocatorMarker l_outer = SaveMarkerOfStackAllocator(l_stackAllocator);
+    for(Size i = 0; i < 10; ++i)
+    {
+        REQUIRE(AllocateFromStackAllocator(l_stackAllocator, l_size) != nullptr);
+    }
+
+    StackAllocatorMarker l_inner = SaveMarkerOfStackAllocator(l_stackAllocator);
+    for(Size i = 0; i < 10; ++i)
+    {
+        REQUIRE(AllocateFromStackAllocator(l_stackAllocator, l_size) != nullptr);
+    }
+
+    RollBackStackAllocatorToMarker(l_stackAllocator, l_inner);
+    CHECK(l_stackAllocator.m_CurrentChunk == l_inner.m_Chunk);
+    CHECK(l_stackAllocator.m_Top == l_inner.m_Top);
+
+    RollBackStackAllocatorToMarker(l_stackAllocator, l_outer);
+    CHECK(l_stackAllocator.m_CurrentChunk == l_outer.m_Chunk);
+    CHECK(l_stackAllocator.m_Top == l_outer.m_Top);
+    CHECK(l_stackAllocator.m_CurrentChunk->m_PreviousChunk == nullptr);
+
+    for(Size i = 0; i < 32; ++i)
+    {
+        CHECK(l_kept[i] == 7);
+    }
+
+    //The kept allocation is the top again, so it can still be deallocated.
+    DeallocateFromStackAllocator(l_stackAllocator, l_kept);
+    CHECK(FindNumberOfUsedBytesInCurrentChunkOfStackAllocator(l_stackAllocator) == 0);
+
+    DestroyStackAllocator(l_stackAllocator);
+
+}
+
+TEST_CASE("Scoped markers", "[StackAllocator][Mutable][Markers]")
+{
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 256);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+    SetStackAllocatorOfThisThread(&l_stackAllocator);
+
+    StackAllocatorChunk* l_chunk = l_stackAllocator.m_CurrentChunk;
+    Byte* l_top = l_stackAllocator.m_Top;
+
+    {
+        ScopedStackAllocatorMarker l_outerScope(l_stackAllocator);
+
+        Array<int> l_array;
+        CreateArrayAtOfCapacityUsingAllocator(l_array, 16, StackMalloc, nullptr, nullptr);
+        REQUIRE(l_array.m_Buffer != nullptr);
+        ResizeArrayToCapacityUsingReallocator(l_array, 200, StackRealloc, nullptr, nullptr);
+        REQUIRE(l_array.m_Buffer != nullptr);
+
+        Byte* l_topAfterArray = l_stackAllocator.m_Top;
+        {
+            ScopedStackAllocatorMarker l_innerScope(l_stackAllocator);
+
+            Node<int> l_first;
+            l_first.m_NextNode = nullptr;
+            for(int i = 0; i < 100; ++i)
+            {
+                AddItemAfterNodeUsingAllocator(i, l_first, StackMalloc, nullptr, nullptr);
+                REQUIRE(l_first.m_NextNode != nullptr);
+            }
+        }
+        CHECK(l_stackAllocator.m_Top == l_topAfterArray);
+    }
+
+    CHECK(l_stackAllocator.m_CurrentChunk == l_chunk);
+    CHECK(l_stackAllocator.m_Top == l_top);
+
+    SetStackAllocatorOfThisThread(nullptr);
+    DestroyStackAllocator(l_stackAllocator);
+
+}
+
+TEST_CASE("Adapters", "[StackAllocator][Mutable][Adapters]")
+{
+
+    StackAllocator l_stackAllocator;
+    CreateStackAllocatorAtOfChunkSize(l_stackAllocator, 1024);
+    REQUIRE(l_stackAllocator.m_CurrentChunk != nullptr);
+
+    SECTION("No stack allocator")
+    {
+        SetStackAllocatorOfThisThread(nullptr);
+        CHECK(GetStackAllocatorOfThisThread() == nullptr);
+        CHECK(StackMalloc(10) == nullptr);
+        CHECK(StackRealloc(nullptr, 10) == nullptr);
+        StackFree(nullptr);
+    }
+    SECTION("With stack allocator")
+    {
+        SetStackAllocatorOfThisThread(&l_stackAllocator);
+        CHECK(GetStackAllocatorOfThisThread() == &l_stackAllocator);
+
+        Allocator l_allocate = StackMalloc;
+        Reallocator l_reallocate = StackRealloc;
+        Deallocator l_deallocate = StackFree;
+
+        int* l_ints = (int*)l_allocate(sizeof(int) * 4);
+        REQUIRE(l_ints != nullptr);
+        for(int i = 0; i < 4; ++i)
+        {
+            l_ints[i] = i;
+        }
+
+        l_ints = (int*)l_reallocate(l_ints, sizeof(int) * 64);
+        REQUIRE(l_ints != nullptr);
+        for(int i = 0; i < 4; ++i)
+        {
+            CHECK(l_ints[i] == i);
+        }
+
+        l_deallocate(l_ints);
+        CHECK(FindNumberOfUsedBytesInCurrentChunkOfStackAllocator(l_stackAllocator) == 0);
+
+        SetStackAllocatorOfThisThread(nullptr);
+    }
+
+    DestroyStackAllocator(l_stackAllocator);
+
+}
@@ -0,0 +1,430 @@
+/**
+ * @file ThreadCache.cpp
+ * @brief Defines everything in the @ref ThreadCacheMod module.
+ *
+ * @details Memory for the central heap and for big allocations is always
+ * taken from malloc directly and never from @ref Library::g_DEFAULT_ALLOCATOR,
+ * since the default allocator may be @ref Library::ThreadCacheMalloc itself.
+ *
+ */
+#include "ThreadCache.hpp"
+#include "../../Debugging/Logging/Log.hpp"
+
+#include <stdlib.h>
+//Included for memcpy
+#include <string.h>
+#include <pthread.h>
+
+namespace Library
+{
+
+    //This is where the hidden global variables are stored.
+    namespace
+    {
+
+        //Placed at the start of every block. Free blocks reuse it as the link
+        //of their free list.
+        union alignas(g_THREAD_CACHE_HEADER_SIZE) ThreadCacheHeader
+        {
+            //For blocks that are handed out, the size class or SIZE_MAX for
+            //blocks that came from malloc.
+            Size m_SizeClass;
+            //For free blocks, the next free block of the same class.
+            ThreadCacheHeader* m_NextBlock;
+        };
+        static_assert(sizeof(ThreadCacheHeader) == g_THREAD_CACHE_HEADER_SIZE);
+
+        //Used for big allocations, the size is needed by realloc.
+        struct alignas(g_THREAD_CACHE_HEADER_SIZE) ThreadCacheBigHeader
+        {
+            Size m_Size;
+            //Must be at the end so that it is right before the location.
+            ThreadCacheHeader m_Header;
+        };
+
+        struct ThreadCacheBin
+        {
+            ThreadCacheHeader* m_FirstBlock;
+            Size m_Count;
+        };
+
+        struct CentralBin
+        {
+            pthread_mutex_t m_Mutex;
+            ThreadCacheHeader* m_FirstBlock;
+        };
+
+        //The minimum size of the memory the central heap asks malloc for.
+        constexpr Size g_SPAN_SIZE = 64 * 1024;
+
+        //Constant initialized, so these are usable before any constructor
+        //runs and after every destructor ran.
+        CentralBin g_CentralBins[g_THREAD_CACHE_SIZE_CLASS_COUNT] = {};
+        pthread_once_t g_CentralBinsOnce = PTHREAD_ONCE_INIT;
+
+        thread_local ThreadCacheBin g_BinsOfThisThread[g_THREAD_CACHE_SIZE_CLASS_COUNT] = {};
+        //Set once the thread starts exiting, from then on frees go straight
+        //to the central heap.
+        thread_local bool g_ThisThreadIsExiting = false;
+
+        constexpr Size CalculateBlockSizeOfSizeClass(const Size& p_size_class)
+        {
+
+            if(p_size_class < 7)
+            {
+                return (p_size_class + 2) * 16;
+            }
+
+            Size l_power = 7 + (p_size_class - 7) / 4;
+            Size l_step = (Size)1 << (l_power - 2);
+            return ((Size)1 << l_power) + ((p_size_class - 7) % 4 + 1) * l_step;
+
+        }
+
+        //Worked out at compile time since it is needed by every free.
+        struct BatchSizes
+        {
+
+            Size m_Sizes[g_THREAD_CACHE_SIZE_CLASS_COUNT];
+
+            constexpr BatchSizes():
+            m_Sizes()
+            {
+                for(Size i = 0; i < g_THREAD_CACHE_SIZE_CLASS_COUNT; ++i)
+                {
+                    Size l_batchSize = 32768 / CalculateBlockSizeOfSizeClass(i);
+                    m_Sizes[i] = l_batchSize < 2 ? 2 : (l_batchSize > 64 ? 64 : l_batchSize);
+                }
+            }
+
+        };
+        constexpr BatchSizes g_BatchSizes;
+
+        //Flushes the cache of the thread it belongs to when that thread exits.
+        struct ThreadCacheFlusher
+        {
+            ~ThreadCacheFlusher()
+            {
+                FlushThreadCacheOfThisThread();
+                g_ThisThreadIsExiting = true;
+            }
+        };
+
+    }
+
+
+    static void InitializeCentralBins()
+    {
+        for(Size i = 0; i < g_THREAD_CACHE_SIZE_CLASS_COUNT; ++i)
+        {
+            pthread_mutex_init(&g_CentralBins[i].m_Mutex, nullptr);
+            g_CentralBins[i].m_FirstBlock = nullptr;
+        }
+    }
+
+    //Makes sure the flusher of the calling thread is constructed, so that its
+    //destructor runs when the thread exits.
+    static void RegisterFlushOfThisThread()
+    {
+        thread_local ThreadCacheFlusher l_flusher;
+        (void)l_flusher;
+    }
+
+    //The number of blocks moved between a thread and the central heap at once.
+    static inline Size FindBatchSizeOfSizeClass(const Size& p_size_class)
+    {
+        return g_BatchSizes.m_Sizes[p_size_class];
+    }
+
+
+    Size FindSizeClassOfBlockSize(const Size& p_block_size)
+    {
+
+        if(p_block_size <= 128)
+        {
+            //Classes 0 to 6 are 32, 48, ..., 128. Everything has a header so
+            //there is nothing smaller than 32.
+            if(p_block_size <= 32)
+            {
+                return 0;
+            }
+            return (p_block_size + 15) / 16 - 2;
+        }
+
+        //p_block_size is in (2^l_power, 2^(l_power + 1)], which is split into
+        //4 classes.
+        Size l_power = sizeof(unsigned long long) * CHAR_BIT - 1
+            - __builtin_clzll((unsigned long long)(p_block_size - 1));
+        return 7 + (l_power - 7) * 4 + ((p_block_size - 1) >> (l_power - 2)) - 4;
+
+    }
+
+    Size FindBlockSizeOfSizeClass(const Size& p_size_class)
+    {
+        return CalculateBlockSizeOfSizeClass(p_size_class);
+    }
+
+
+    //Moves a batch of blocks of p_size_class from the central heap to the
+    //calling thread. Returns false if there was no memory for it.
+    static bool RefillBinOfThisThread(const Size& p_size_class)
+    {
+
+        LogDebugLine("Refilling the thread cache of size class " << p_size_class);
+
+        pthread_once(&g_CentralBinsOnce, InitializeCentralBins);
+        RegisterFlushOfThisThread();
+
+        CentralBin& l_central = g_CentralBins[p_size_class];
+        ThreadCacheBin& l_bin = g_BinsOfThisThread[p_size_class];
+        Size l_batchSize = FindBatchSizeOfSizeClass(p_size_class);
+        Size l_blockSize = FindBlockSizeOfSizeClass(p_size_class);
+
+        pthread_mutex_lock(&l_central.m_Mutex);
+
+        if(l_central.m_FirstBlock == nullptr)
+        {
+            //Carve a new span into blocks, they all go on the central list.
+            Size l_blockCount = g_SPAN_SIZE / l_blockSize;
+            if(l_blockCount < l_batchSize)
+            {
+                l_blockCount = l_batchSize;
+            }
+
+            LogDebugLine("The central heap is empty, allocating a span of "
+            << l_blockCount << " blocks.");
+
+            Byte* l_span = (Byte*)malloc(l_blockCount * l_blockSize);
+            if(l_span == nullptr)
+            {
+                LogDebugLine("Allocation of the span failed, returning false.");
+                pthread_mutex_unlock(&l_central.m_Mutex);
+                return false;
+            }
+
+            for(Size i = 0; i < l_blockCount; ++i)
+            {
+                ThreadCacheHeader* l_block = (ThreadCacheHeader*)(l_span + i * l_blockSize);
+                l_block->m_NextBlock = (i + 1 < l_blockCount) ?
+                    (ThreadCacheHeader*)(l_span + (i + 1) * l_blockSize) : nullptr;
+            }
+            l_central.m_FirstBlock = (ThreadCacheHeader*)l_span;
+        }
+
+        //Take up to a batch from the front of the central list.
+        ThreadCacheHeader* l_first = l_central.m_FirstBlock;
+        ThreadCacheHeader* l_last = l_first;
+        Size l_count = 1;
+        while(l_count < l_batchSize && l_last->m_NextBlock != nullptr)
+        {
+            l_last = l_last->m_NextBlock;
+            ++l_count;
+        }
+        l_central.m_FirstBlock = l_last->m_NextBlock;
+
+        pthread_mutex_unlock(&l_central.m_Mutex);
+
+        l_last->m_NextBlock = l_bin.m_FirstBlock;
+        l_bin.m_FirstBlock = l_first;
+        l_bin.m_Count += l_count;
+
+        return true;
+
+    }
+
+    //Gives p_count blocks from the front of the calling thread's list of
+    //p_size_class back to the central heap.
+    static void ReleaseBlocksOfThisThread(const Size& p_size_class, const Size& p_count)
+    {
+
+        LogDebugLine("Releasing " << p_count << " blocks of size class "
+        << p_size_class << " to the central heap.");
+
+        ThreadCacheBin& l_bin = g_BinsOfThisThread[p_size_class];
+        if(p_count == 0 || l_bin.m_FirstBlock == nullptr)
+        {
+            return;
+        }
+
+        //The chain is cut before taking the lock.
+        ThreadCacheHeader* l_first = l_bin.m_FirstBlock;
+        ThreadCacheHeader* l_last = l_first;
+        Size l_count = 1;
+        while(l_count < p_count && l_last->m_NextBlock != nullptr)
+        {
+            l_last = l_last->m_NextBlock;
+            ++l_count;
+        }
+        l_bin.m_FirstBlock = l_last->m_NextBlock;
+        l_bin.m_Count -= l_count;
+
+        pthread_once(&g_CentralBinsOnce, InitializeCentralBins);
+        CentralBin& l_central = g_CentralBins[p_size_class];
+
+        pthread_mutex_lock(&l_central.m_Mutex);
+        l_last->m_NextBlock = l_central.m_FirstBlock;
+        l_central.m_FirstBlock = l_first;
+        pthread_mutex_unlock(&l_central.m_Mutex);
+
+    }
+
+
+    void* ThreadCacheMalloc(Size p_size)
+    {
+
+        if(p_size > g_THREAD_CACHE_MAX_BLOCK_SIZE - g_THREAD_CACHE_HEADER_SIZE)
+        {
+            LogDebugLine("Allocating " << p_size << " bytes using malloc.");
+
+            if(p_size > SIZE_MAX - sizeof(ThreadCacheBigHeader))
+            {
+                return nullptr;
+            }
+
+            ThreadCacheBigHeader* l_header =
+                (ThreadCacheBigHeader*)malloc(sizeof(ThreadCacheBigHeader) + p_size);
+            if(l_header == nullptr)
+            {
+                return nullptr;
+            }
+            l_header->m_Size = p_size;
+            l_header->m_Header.m_SizeClass = SIZE_MAX;
+            return l_header + 1;
+        }
+
+        Size l_sizeClass = FindSizeClassOfBlockSize(p_size + g_THREAD_CACHE_HEADER_SIZE);
+        ThreadCacheBin& l_bin = g_BinsOfThisThread[l_sizeClass];
+
+        if(l_bin.m_FirstBlock == nullptr && RefillBinOfThisThread(l_sizeClass) == false)
+        {
+            return nullptr;
+        }
+
+        ThreadCacheHeader* l_block = l_bin.m_FirstBlock;
+        l_bin.m_FirstBlock = l_block->m_NextBlock;
+        --l_bin.m_Count;
+
+        l_block->m_SizeClass = l_sizeClass;
+        return l_block + 1;
+
+    }
+
+    void* ThreadCacheRealloc(void* p_pointer, Size p_size)
+    {
+
+        if(p_pointer == nullptr)
+        {
+            return ThreadCacheMalloc(p_size);
+        }
+        if(p_size == 0)
+        {
+            ThreadCacheFree(p_pointer);
+            return nullptr;
+        }
+
+        ThreadCacheHeader* l_header = (ThreadCacheHeader*)p_pointer - 1;
+
+        Size l_oldSize;
+        if(l_header->m_SizeClass == SIZE_MAX)
+        {
+            ThreadCacheBigHeader* l_bigHeader = (ThreadCacheBigHeader*)p_pointer - 1;
+            l_oldSize = l_bigHeader->m_Size;
+
+            //Big blocks stay big when they grow, so realloc can do the copy,
+            //or even avoid it.
+            if(p_size > g_THREAD_CACHE_MAX_BLOCK_SIZE - g_THREAD_CACHE_HEADER_SIZE)
+            {
+                if(p_size > SIZE_MAX - sizeof(ThreadCacheBigHeader))
+                {
+                    return nullptr;
+                }
+                l_bigHeader = (ThreadCacheBigHeader*)realloc(
+                    l_bigHeader, sizeof(ThreadCacheBigHeader) + p_size
+                );
+                if(l_bigHeader == nullptr)
+                {
+                    return nullptr;
+                }
+                l_bigHeader->m_Size = p_size;
+                return l_bigHeader + 1;
+            }
+        }
+        else
+        {
+            l_oldSize = FindBlockSizeOfSizeClass(l_header->m_SizeClass) - g_THREAD_CACHE_HEADER_SIZE;
+            if(p_size <= l_oldSize)
+            {
+                return p_pointer;
+            }
+        }
+
+        void* l_newLocation = ThreadCacheMalloc(p_size);
+        if(l_newLocation == nullptr)
+        {
+            return nullptr;
+        }
+
+        memcpy(l_newLocation, p_pointer, l_oldSize < p_size ? l_oldSize : p_size);
+        ThreadCacheFree(p_pointer);
+
+        return l_newLocation;
+
+    }
+
+    void ThreadCacheFree(void* p_pointer)
+    {
+
+        if(p_pointer == nullptr)
+        {
+            return;
+        }
+
+        ThreadCacheHeader* l_block = (ThreadCacheHeader*)p_pointer - 1;
+        Size l_sizeClass = l_block->m_SizeClass;
+
+        if(l_sizeClass == SIZE_MAX)
+        {
+            LogDebugLine("Freeing big allocation at " << p_pointer << " using free.");
+            free((ThreadCacheBigHeader*)p_pointer - 1);
+            return;
+        }
+
+        //A thread that only frees blocks other threads allocated never
+        //refills, its cache still has to be flushed when it exits.
+        RegisterFlushOfThisThread();
+
+        ThreadCacheBin& l_bin = g_BinsOfThisThread[l_sizeClass];
+        l_block->m_NextBlock = l_bin.m_FirstBlock;
+        l_bin.m_FirstBlock = l_block;
+        ++l_bin.m_Count;
+
+        if(g_ThisThreadIsExiting)
+        {
+            ReleaseBlocksOfThisThread(l_sizeClass, l_bin.m_Count);
+        }
+        else if(l_bin.m_Count > 2 * FindBatchSizeOfSizeClass(l_sizeClass))
+        {
+            ReleaseBlocksOfThisThread(l_sizeClass, FindBatchSizeOfSizeClass(l_sizeClass));
+        }
+
+    }
+
+
+    void FlushThreadCacheOfThisThread()
+    {
+
+        LogDebugLine("Flushing the thread cache of this thread.");
+
+        for(Size i = 0; i < g_THREAD_CACHE_SIZE_CLASS_COUNT; ++i)
+        {
+            ReleaseBlocksOfThisThread(i, g_BinsOfThisThread[i].m_Count);
+        }
+
+    }
+
+    Size FindNumberOfCachedBlocksOfSizeClassInThisThread(const Size& p_size_class)
+    {
+        return g_BinsOfThisThread[p_size_class].m_Count;
+    }
+
+}
@@ -0,0 +1,129 @@
+/**
+ * @file ThreadCache.hpp
+ * @brief Declares everything in the @ref ThreadCacheMod module.
+ *
+ * @details Everything is defined in ThreadCache.cpp.
+ *
+ */
+#ifndef THREAD_CACHE__MEMORY_MANAGEMENT_THREAD_CACHE_THREAD_CACHE_HPP
+#define THREAD_CACHE__MEMORY_MANAGEMENT_THREAD_CACHE_THREAD_CACHE_HPP
+
+#include "../../Meta/Meta.hpp"
+
+namespace Library
+{
+
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief The number of bytes in front of every location given out by
+     * @ref ThreadCacheMalloc, used to remember which size class it belongs to.
+     *
+     * @details This is also the alignment of every location, so that memory
+     * from the thread cache can be used for any type, just like memory from
+     * malloc.
+     *
+     */
+    constexpr Size g_THREAD_CACHE_HEADER_SIZE = alignof(max_align_t);
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief The biggest block, header included, that is served from a size
+     * class. Anything bigger goes straight to malloc.
+     *
+     */
+    constexpr Size g_THREAD_CACHE_MAX_BLOCK_SIZE = 32768;
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief The number of size classes.
+     *
+     * @details Blocks of up to 128 bytes are rounded up to a multiple of 16,
+     * bigger ones have 4 size classes between each power of 2, for example
+     * 160, 192, 224 and 256. This keeps the wasted space of any block under
+     * 25%.
+     *
+     */
+    constexpr Size g_THREAD_CACHE_SIZE_CLASS_COUNT = 39;
+
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief Finds the size class of a block of p_block_size bytes, header
+     * included.
+     *
+     * @warning p_block_size must be between 1 and
+     * @ref g_THREAD_CACHE_MAX_BLOCK_SIZE.
+     *
+     * @time O(1).
+     *
+     */
+    Size FindSizeClassOfBlockSize(const Size& p_block_size);
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief Finds the size of the blocks of p_size_class, header included.
+     *
+     * @warning p_size_class must be less than
+     * @ref g_THREAD_CACHE_SIZE_CLASS_COUNT.
+     *
+     */
+    Size FindBlockSizeOfSizeClass(const Size& p_size_class);
+
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief An @ref Allocator that allocates from the cache of the calling
+     * thread, behaves like malloc.
+     *
+     * @details Small allocations are rounded up to their size class and taken
+     * from the calling thread's free list of that class without any locking.
+     * When that list is empty a whole batch of blocks is moved over from the
+     * central heap at once, taking a single lock. Allocations bigger than
+     * @ref g_THREAD_CACHE_MAX_BLOCK_SIZE are given to malloc.
+     *
+     * @return The allocated location or null on failure. The location is
+     * aligned to @ref g_THREAD_CACHE_HEADER_SIZE.
+     *
+     */
+    void* ThreadCacheMalloc(Size p_size);
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief A @ref Reallocator for locations from @ref ThreadCacheMalloc,
+     * behaves like realloc.
+     *
+     * @details If the new size still fits in the block of p_pointer it is
+     * returned as is, otherwise a new location is allocated and the old bytes
+     * are copied over. If p_pointer is null this is the same as
+     * @ref ThreadCacheMalloc. If p_size is 0 p_pointer is freed and null is
+     * returned.
+     *
+     */
+    void* ThreadCacheRealloc(void* p_pointer, Size p_size);
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief A @ref Deallocator for locations from @ref ThreadCacheMalloc,
+     * behaves like free.
+     *
+     * @details The block goes on the calling thread's free list of its size
+     * class. It does not matter which thread allocated it. Once a list holds
+     * more than two batches one batch is given back to the central heap, so
+     * a thread that only frees does not hoard memory.
+     *
+     */
+    void ThreadCacheFree(void* p_pointer);
+
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief Gives every block cached by the calling thread back to the
+     * central heap.
+     *
+     * @details This is done automatically when a thread exits.
+     *
+     */
+    void FlushThreadCacheOfThisThread();
+    /**
+     * @ingroup ThreadCacheMod
+     * @brief Finds the number of blocks of p_size_class cached by the calling
+     * thread.
+     *
+     */
+    Size FindNumberOfCachedBlocksOfSizeClassInThisThread(const Size& p_size_class);
+
+}
+
+#endif //THREAD_CACHE__MEMORY_MANAGEMENT_THREAD_CACHE_THREAD_CACHE_HPP
@@ -0,0 +1,122 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "../ThreadCache.hpp"
+
+using namespace Library;
+
+//The number of allocations each thread does per run.
+static const Size g_OPERATION_COUNT = 200000;
+//The number of allocations each thread keeps alive at once.
+static const Size g_LIVE_COUNT = 256;
+
+//What a worker thread does, it keeps a window of live small objects and keeps
+//replacing them, like a thread building and dropping short lived objects.
+static void WorkUsingAllocatorAndDeallocator(
+    const Size& p_seed,
+    Allocator p_allocate, Deallocator p_deallocate
+)
+{
+
+    void* l_live[g_LIVE_COUNT] = {};
+    Size l_random = p_seed * 2654435761u + 1;
+
+    for(Size i = 0; i < g_OPERATION_COUNT; ++i)
+    {
+        l_random = l_random * 6364136223846793005u + 1442695040888963407u;
+        Size l_slot = (l_random >> 33) % g_LIVE_COUNT;
+        Size l_size = 8 + (l_random >> 45) % 248;
+
+        p_deallocate(l_live[l_slot]);
+        l_live[l_slot] = p_allocate(l_size);
+        *(volatile Byte*)l_live[l_slot] = (Byte)i;
+    }
+
+    for(Size i = 0; i < g_LIVE_COUNT; ++i)
+    {
+        p_deallocate(l_live[i]);
+    }
+
+}
+
+static void RunThreadsUsingAllocatorAndDeallocator(
+    const Size& p_thread_count,
+    Allocator p_allocate, Deallocator p_deallocate
+)
+{
+
+    std::vector<std::thread> l_threads;
+    for(Size t = 0; t < p_thread_count; ++t)
+    {
+        l_threads.emplace_back([t, &p_allocate, &p_deallocate]()
+        {
+            WorkUsingAllocatorAndDeallocator(t, p_allocate, p_deallocate);
+        });
+    }
+    for(std::thread& l_thread : l_threads)
+    {
+        l_thread.join();
+    }
+
+}
+
+TEST_CASE("Multi threaded small allocations", "[ThreadCache][Benchmark]")
+{
+
+    Size l_threadCount = GENERATE(1, 2, 4, 8);
+
+    BENCHMARK("malloc/free " + std::to_string(l_threadCount) + " threads")
+    {
+        RunThreadsUsingAllocatorAndDeallocator(l_threadCount, malloc, free);
+    };
+
+    BENCHMARK("thread cache " + std::to_string(l_threadCount) + " threads")
+    {
+        RunThreadsUsingAllocatorAndDeallocator(l_threadCount, ThreadCacheMalloc, ThreadCacheFree);
+    };
+
+}
+
+TEST_CASE("Producer and consumer threads", "[ThreadCache][Benchmark]")
+{
+
+    //Everything allocated by one thread is freed by another, which is the
+    //worst case for per thread caches.
+    static void* s_locations[g_OPERATION_COUNT];
+
+    auto l_run = [](Allocator p_allocate, Deallocator p_deallocate)
+    {
+        std::thread l_producer([&p_allocate]()
+        {
+            for(Size i = 0; i < g_OPERATION_COUNT; ++i)
+            {
+                s_locations[i] = p_allocate(8 + i % 120);
+            }
+        });
+        l_producer.join();
+        std::thread l_consumer([&p_deallocate]()
+        {
+            for(Size i = 0; i < g_OPERATION_COUNT; ++i)
+            {
+                p_deallocate(s_locations[i]);
+            }
+        });
+        l_consumer.join();
+    };
+
+    BENCHMARK("malloc/free producer and consumer")
+    {
+        l_run(malloc, free);
+    };
+
+    BENCHMARK("thread cache producer and consumer")
+    {
+        l_run(ThreadCacheMalloc, ThreadCacheFree);
+    };
+
+}
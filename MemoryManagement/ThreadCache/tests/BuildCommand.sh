@@ -0,0 +1 @@
+g++ -Wall -Wextra -pedantic -g -Og -std=c++17 -DDEBUG -DADDITIONAL_INCLUDE='"../MemoryManagement/ThreadCache/ThreadCache.hpp"' -DOVERWRITE_DEFAULT_ALLOCATOR=ThreadCacheMalloc -DOVERWRITE_DEFAULT_REALLOCATOR=ThreadCacheRealloc -DOVERWRITE_DEFAULT_DEALLOCATOR=ThreadCacheFree -o ThreadCacheTests.test ../ThreadCache.cpp ../../../Meta/Meta.cpp ../../../Debugging/Debugging.cpp ../../../Debugging/Logging/Log.cpp -pthread *.cpp
\ No newline at end of file
@@ -0,0 +1,264 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include "../ThreadCache.hpp"
+#include "../../../Debugging/Debugging.hpp"
+#include "../../../DataStructures/Array/Array.hpp"
+
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+using namespace Library;
+using namespace Library::DataStructures::Array;
+using namespace Debugging;
+using namespace Catch::Generators;
+
+TEST_CASE("Size classes", "[ThreadCache][SizeClass]")
+{
+
+    CHECK(FindSizeClassOfBlockSize(1) == 0);
+    CHECK(FindSizeClassOfBlockSize(32) == 0);
+    CHECK(FindSizeClassOfBlockSize(33) == 1);
+    CHECK(FindSizeClassOfBlockSize(128) == 6);
+    CHECK(FindSizeClassOfBlockSize(129) == 7);
+    CHECK(FindSizeClassOfBlockSize(g_THREAD_CACHE_MAX_BLOCK_SIZE) == g_THREAD_CACHE_SIZE_CLASS_COUNT - 1);
+    CHECK(FindBlockSizeOfSizeClass(g_THREAD_CACHE_SIZE_CLASS_COUNT - 1) == g_THREAD_CACHE_MAX_BLOCK_SIZE);
+
+    Size l_previous = 0;
+    for(Size i = 0; i < g_THREAD_CACHE_SIZE_CLASS_COUNT; ++i)
+    {
+        Size l_blockSize = FindBlockSizeOfSizeClass(i);
+        CHECK(l_blockSize > l_previous);
+        CHECK(l_blockSize % g_THREAD_CACHE_HEADER_SIZE == 0);
+        CHECK(FindSizeClassOfBlockSize(l_blockSize) == i);
+        CHECK(FindSizeClassOfBlockSize(l_previous + 1) == i);
+        l_previous = l_blockSize;
+    }
+
+}
+
+TEST_CASE("Allocation and freeing", "[ThreadCache][Allocation]")
+{
+
+    Size l_size = GENERATE(0, 1, 16, 100, 1000, 32000, 40000, 100000);
+
+    Byte* l_locations[200];
+    for(Size i = 0; i < 200; ++i)
+    {
+        l_locations[i] = (Byte*)ThreadCacheMalloc(l_size);
+        REQUIRE(l_locations[i] != nullptr);
+        CHECK((uintptr_t)l_locations[i] % g_THREAD_CACHE_HEADER_SIZE == 0);
+        memset(l_locations[i], (int)i, l_size);
+    }
+
+    //None of the allocations overlap.
+    for(Size i = 0; i < 200; ++i)
+    {
+        for(Size n = 0; n < l_size; ++n)
+        {
+            REQUIRE(l_locations[i][n] == (Byte)i);
+        }
+    }
+
+    for(Size i = 0; i < 200; ++i)
+    {
+        ThreadCacheFree(l_locations[i]);
+    }
+    ThreadCacheFree(nullptr);
+
+}
+
+TEST_CASE("Reallocation", "[ThreadCache][Reallocation]")
+{
+
+    Size l_from = GENERATE(1, 20, 5000, 40000);
+    Size l_to = GENERATE(1, 30, 200, 30000, 50000, 2000000);
+
+    Byte* l_location = (Byte*)ThreadCacheMalloc(l_from);
+    REQUIRE(l_location != nullptr);
+    for(Size i = 0; i < l_from; ++i)
+    {
+        l_location[i] = (Byte)i;
+    }
+
+    l_location = (Byte*)ThreadCacheRealloc(l_location, l_to);
+    REQUIRE(l_location != nullptr);
+    for(Size i = 0; i < l_from && i < l_to; ++i)
+    {
+        REQUIRE(l_location[i] == (Byte)i);
+    }
+    memset(l_location, 0, l_to);
+
+    SECTION("Freeing")
+    {
+        ThreadCacheFree(l_location);
+    }
+    SECTION("Zero size")
+    {
+        CHECK(ThreadCacheRealloc(l_location, 0) == nullptr);
+    }
+
+}
+
+TEST_CASE("Reallocation in place and of null", "[ThreadCache][Reallocation]")
+{
+
+    void* l_location = ThreadCacheMalloc(20);
+    REQUIRE(l_location != nullptr);
+
+    //20 bytes and the header are rounded up to 48.
+    CHECK(ThreadCacheRealloc(l_location, 32) == l_location);
+    CHECK(ThreadCacheRealloc(l_location, 8) == l_location);
+    ThreadCacheFree(l_location);
+
+    l_location = ThreadCacheRealloc(nullptr, 10);
+    CHECK(l_location != nullptr);
+    ThreadCacheFree(l_location);
+
+}
+
+TEST_CASE("Caching and flushing", "[ThreadCache][Caching]")
+{
+
+    FlushThreadCacheOfThisThread();
+    Size l_sizeClass = FindSizeClassOfBlockSize(64 + g_THREAD_CACHE_HEADER_SIZE);
+    CHECK(FindNumberOfCachedBlocksOfSizeClassInThisThread(l_sizeClass) == 0);
+
+    //The first allocation moves a whole batch over.
+    void* l_location = ThreadCacheMalloc(64);
+    REQUIRE(l_location != nullptr);
+    Size l_cached = FindNumberOfCachedBlocksOfSizeClassInThisThread(l_sizeClass);
+    CHECK(l_cached > 0);
+
+    ThreadCacheFree(l_location);
+    CHECK(FindNumberOfCachedBlocksOfSizeClassInThisThread(l_sizeClass) == l_cached + 1);
+
+    //Freeing a lot does not keep everything in the thread.
+    void* l_locations[1000];
+    for(Size i = 0; i < 1000; ++i)
+    {
+        l_locations[i] = ThreadCacheMalloc(64);
+        REQUIRE(l_locations[i] != nullptr);
+    }
+    for(Size i = 0; i < 1000; ++i)
+    {
+        ThreadCacheFree(l_locations[i]);
+    }
+    CHECK(FindNumberOfCachedBlocksOfSizeClassInThisThread(l_sizeClass) < 1000);
+
+    FlushThreadCacheOfThisThread();
+    CHECK(FindNumberOfCachedBlocksOfSizeClassInThisThread(l_sizeClass) == 0);
+
+}
+
+TEST_CASE("Multiple threads", "[ThreadCache][Threads]")
+{
+
+    const Size l_count = 10000;
+    static void* s_locations[4][10000];
+    //Catch's assertions can not be used from other threads.
+    std::atomic<bool> l_failed(false);
+
+    std::thread l_threads[4];
+    for(Size t = 0; t < 4; ++t)
+    {
+        l_threads[t] = std::thread([t, l_count, &l_failed]()
+        {
+            for(Size i = 0; i < l_count; ++i)
+            {
+                Size l_size = 1 + (i * 7 + t) % 500;
+                Byte* l_location = (Byte*)ThreadCacheMalloc(l_size);
+                if(l_location == nullptr)
+                {
+                    l_failed = true;
+                    return;
+                }
+                memset(l_location, (int)t, l_size);
+                s_locations[t][i] = l_location;
+            }
+        });
+    }
+    for(Size t = 0; t < 4; ++t)
+    {
+        l_threads[t].join();
+    }
+    REQUIRE(l_failed == false);
+
+    for(Size t = 0; t < 4; ++t)
+    {
+        for(Size i = 0; i < l_count; ++i)
+        {
+            Size l_size = 1 + (i * 7 + t) % 500;
+            Byte* l_location = (Byte*)s_locations[t][i];
+            REQUIRE(l_location[0] == (Byte)t);
+            REQUIRE(l_location[l_size - 1] == (Byte)t);
+        }
+    }
+
+    //Blocks allocated by one thread are freed by another.
+    for(Size t = 0; t < 4; ++t)
+    {
+        l_threads[t] = std::thread([t, l_count]()
+        {
+            for(Size i = 0; i < l_count; ++i)
+            {
+                ThreadCacheFree(s_locations[(t + 1) % 4][i]);
+            }
+        });
+    }
+    for(Size t = 0; t < 4; ++t)
+    {
+        l_threads[t].join();
+    }
+
+}
+
+TEST_CASE("A thread that only frees flushes its cache when it exits", "[ThreadCache][Threads]")
+{
+
+    //This thread keeps none of the blocks of the size class.
+    void* l_location = ThreadCacheMalloc(200);
+    REQUIRE(l_location != nullptr);
+    FlushThreadCacheOfThisThread();
+
+    std::thread l_thread([l_location]()
+    {
+        ThreadCacheFree(l_location);
+    });
+    l_thread.join();
+
+    //The block went back to the front of the central list, so it is the
+    //first one handed out again.
+    void* l_reused = ThreadCacheMalloc(200);
+    CHECK(l_reused == l_location);
+    ThreadCacheFree(l_reused);
+
+}
+
+TEST_CASE("Selected as the default", "[ThreadCache][Defaults]")
+{
+
+    //The build command overwrites the defaults in Meta.cpp.
+    CHECK(&g_DEFAULT_ALLOCATOR == &ThreadCacheMalloc);
+    CHECK(&g_DEFAULT_REALLOCATOR == &ThreadCacheRealloc);
+    CHECK(&g_DEFAULT_DEALLOCATOR == &ThreadCacheFree);
+
+    Array<int> l_array;
+    CreateArrayAtOfCapacity(l_array, 10);
+    REQUIRE(l_array.m_Buffer != nullptr);
+    for(int i = 0; i < 10; ++i)
+    {
+        l_array.m_Buffer[i] = i;
+    }
+
+    ResizeArrayToCapacity(l_array, 10000);
+    REQUIRE(l_array.m_Buffer != nullptr);
+    for(int i = 0; i < 10; ++i)
+    {
+        CHECK(l_array.m_Buffer[i] == i);
+    }
+
+    DestroyArrayUsingDeallocator(l_array, g_DEFAULT_DEALLOCATOR);
+
+}
@@ -5,6 +5,7 @@
 #include "Meta.hpp"
 
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef ADDITIONAL_INCLUDE
 #include ADDITIONAL_INCLUDE
@@ -13,6 +14,77 @@
 namespace Library
 {
 
+    namespace
+    {
+
+        bool AlignmentIsValid(const Size& p_alignment)
+        {
+            return p_alignment != 0 && (p_alignment & (p_alignment - 1)) == 0;
+        }
+
+        void* AlignedMalloc(Size p_alignment, Size p_size)
+        {
+
+            if(AlignmentIsValid(p_alignment) == false)
+            {
+                return nullptr;
+            }
+
+            //posix_memalign only takes multiples of sizeof(void*), any
+            //smaller power of two divides it anyway.
+            if(p_alignment < sizeof(void*))
+            {
+                p_alignment = sizeof(void*);
+            }
+
+            void* l_location = nullptr;
+            if(posix_memalign(&l_location, p_alignment, p_size) != 0)
+            {
+                return nullptr;
+            }
+
+            return l_location;
+
+        }
+
+        void* AlignedRealloc(void* p_location, Size p_old_size, Size p_alignment, Size p_new_size)
+        {
+
+            if(p_location == nullptr)
+            {
+                return AlignedMalloc(p_alignment, p_new_size);
+            }
+            if(p_new_size == 0)
+            {
+                free(p_location);
+                return nullptr;
+            }
+            if(AlignmentIsValid(p_alignment) == false)
+            {
+                return nullptr;
+            }
+
+            //realloc already keeps these, and may grow in place.
+            if(p_alignment <= alignof(max_align_t))
+            {
+                return realloc(p_location, p_new_size);
+            }
+
+            void* l_newLocation = AlignedMalloc(p_alignment, p_new_size);
+            if(l_newLocation == nullptr)
+            {
+                return nullptr;
+            }
+
+            memcpy(l_newLocation, p_location, p_old_size < p_new_size ? p_old_size : p_new_size);
+            free(p_location);
+
+            return l_newLocation;
+
+        }
+
+    }
+
     //This code is hard to read so here it is described with words:
     //
     //If a overwrite macro for some default is defined set it to that macro,
@@ -21,6 +93,9 @@ namespace Library
     //Default allocator = malloc;
     //Default reallocator = realloc;
     //Default deallocator = free;
+    //Default aligned allocator = posix_memalign;
+    //Default aligned reallocator = realloc or posix_memalign and a copy;
+    //Default aligned deallocator = free;
     //Default error callback(all) = nullptr;
     //Default error callback data(all) = nullptr;
 
@@ -62,10 +137,30 @@ namespace Library
     #endif //OVERWRITE_DEFAULT_REALLOC_ERROR_DATA
 
 
-    #ifndef OVERWRITE_DEFAULT_DEALLOCTOR
+    #ifndef OVERWRITE_DEFAULT_DEALLOCATOR
         const Deallocator g_DEFAULT_DEALLOCATOR = free;
     #else
         const Deallocator g_DEFAULT_DEALLOCATOR = OVERWRITE_DEFAULT_DEALLOCATOR;
     #endif //OVERWRITE_DEFAULT_DEALLOCATOR
 
+
+
+    #ifndef OVERWRITE_DEFAULT_ALIGNED_ALLOCATOR
+        const AlignedAllocator g_DEFAULT_ALIGNED_ALLOCATOR = AlignedMalloc;
+    #else
+        const AlignedAllocator g_DEFAULT_ALIGNED_ALLOCATOR = OVERWRITE_DEFAULT_ALIGNED_ALLOCATOR;
+    #endif //OVERWRITE_DEFAULT_ALIGNED_ALLOCATOR
+
+    #ifndef OVERWRITE_DEFAULT_ALIGNED_REALLOCATOR
+        const AlignedReallocator g_DEFAULT_ALIGNED_REALLOCATOR = AlignedRealloc;
+    #else
+        const AlignedReallocator g_DEFAULT_ALIGNED_REALLOCATOR = OVERWRITE_DEFAULT_ALIGNED_REALLOCATOR;
+    #endif //OVERWRITE_DEFAULT_ALIGNED_REALLOCATOR
+
+    #ifndef OVERWRITE_DEFAULT_ALIGNED_DEALLOCATOR
+        const Deallocator g_DEFAULT_ALIGNED_DEALLOCATOR = free;
+    #else
+        const Deallocator g_DEFAULT_ALIGNED_DEALLOCATOR = OVERWRITE_DEFAULT_ALIGNED_DEALLOCATOR;
+    #endif //OVERWRITE_DEFAULT_ALIGNED_DEALLOCATOR
+
 }
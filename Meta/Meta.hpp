@@ -215,6 +215,43 @@ namespace Library
      * 
      */
     using Callback = void (*) (void*);
+    /**
+     * @ingroup MetaMod
+     * @brief An alias for a function reference that can be used to allocate
+     * memory at an alignment.
+     *
+     * @details The function reference takes the form of:
+     * void* (&) (Size alignment, Size size).
+     *
+     * **ALL AlignedAllocator type objects MUST behave like aligned_alloc**,
+     * with two differences: the size does not have to be a multiple of the
+     * alignment, and any power of two is a valid alignment. The returned
+     * location is a multiple of the alignment, the alignment not being a
+     * power of two is a failure.
+     *
+     * Memory allocated with an aligned allocator is reallocated with an
+     * @ref Library::AlignedReallocator "AlignedReallocator" and deallocated
+     * with a @ref Library::Deallocator "Deallocator" of the same bundle.
+     *
+     */
+    using AlignedAllocator = void* (&) (Size, Size);
+    /**
+     * @ingroup MetaMod
+     * @brief An alias for a function reference that can be used to reallocate
+     * memory from an @ref Library::AlignedAllocator "AlignedAllocator".
+     *
+     * @details The function reference takes the form of:
+     * void* (&) (void* location, Size old_size, Size alignment, Size new_size).
+     *
+     * **ALL AlignedReallocator type objects MUST behave like realloc**, except
+     * that the returned location is a multiple of the alignment, like with an
+     * @ref Library::AlignedAllocator "AlignedAllocator". The old size is the
+     * number of bytes at location that are kept, realloc has no way of
+     * keeping the alignment when it has to move memory so it is up to the
+     * reallocator to copy them.
+     *
+     */
+    using AlignedReallocator = void* (&) (void*, Size, Size, Size);
     
 
     /**
@@ -395,6 +432,69 @@ namespace Library
      */
     extern const Deallocator g_DEFAULT_DEALLOCATOR;
 
+    /**
+     * @ingroup MetaMod
+     * @brief A function reference to the default aligned allocator.
+     *
+     * @details This is the @ref Library::AlignedAllocator "AlignedAllocator"
+     * version of @ref Library::g_DEFAULT_ALLOCATOR, by default it uses
+     * posix_memalign. Allocation failure should be handled with the same
+     * callback and data as the default allocator,
+     * @ref Library::g_DEFAULT_ALLOC_ERROR.
+     *
+     * The overwrite for this one is:
+     * @code{.cpp}
+     * OVERWRITE_DEFAULT_ALIGNED_ALLOCATOR
+     * @endcode
+     * If you don't know what an overwrite is please refer to the file docs at
+     * @ref LibraryMetahpp_Overwriting :).
+     *
+     * This value MUST NOT be mutated at run time.
+     *
+     */
+    extern const AlignedAllocator g_DEFAULT_ALIGNED_ALLOCATOR;
+    /**
+     * @ingroup MetaMod
+     * @brief A function reference to the default aligned reallocator.
+     *
+     * @details Reallocates memory from the default aligned allocator. By
+     * default alignments of up to alignof(max_align_t) are given straight to
+     * realloc, since it already keeps them, bigger ones are allocated again
+     * and copied. Reallocation failure should be handled with
+     * @ref Library::g_DEFAULT_REALLOC_ERROR.
+     *
+     * The overwrite for this one is:
+     * @code{.cpp}
+     * OVERWRITE_DEFAULT_ALIGNED_REALLOCATOR
+     * @endcode
+     * If you don't know what an overwrite is please refer to the file docs at
+     * @ref LibraryMetahpp_Overwriting :).
+     *
+     * This value MUST NOT be mutated at run time.
+     *
+     */
+    extern const AlignedReallocator g_DEFAULT_ALIGNED_REALLOCATOR;
+    /**
+     * @ingroup MetaMod
+     * @brief A function reference to the deallocator for memory from the
+     * default aligned allocator and reallocator, by default free.
+     *
+     * @details This is separate from @ref Library::g_DEFAULT_DEALLOCATOR so
+     * that the aligned bundle can be overwritten on its own, some systems
+     * need a different function for freeing aligned memory.
+     *
+     * The overwrite for this one is:
+     * @code{.cpp}
+     * OVERWRITE_DEFAULT_ALIGNED_DEALLOCATOR
+     * @endcode
+     * If you don't know what an overwrite is please refer to the file docs at
+     * @ref LibraryMetahpp_Overwriting :).
+     *
+     * This value MUST NOT be mutated at run time.
+     *
+     */
+    extern const Deallocator g_DEFAULT_ALIGNED_DEALLOCATOR;
+
 }
 
 #endif //META__META_META_HPP
\ No newline at end of file